@@ -17,6 +17,7 @@ namespace platform {
 
 enum class IdleTaskSupport { kDisabled, kEnabled };
 enum class InProcessStackDumping { kDisabled, kEnabled };
+enum class NumaPinning { kDisabled, kEnabled };
 
 enum class MessageLoopBehavior : bool {
   kDoNotWait = false,
@@ -35,13 +36,17 @@ enum class MessageLoopBehavior : bool {
  * calling v8::platform::RunIdleTasks to process the idle tasks.
  * If |tracing_controller| is nullptr, the default platform will create a
  * v8::platform::TracingController instance and use it.
+ * If |numa_pinning| is enabled and the machine has more than one NUMA node,
+ * the worker threads are distributed round-robin over the nodes and each one
+ * is restricted to the CPUs of its node.
  */
 V8_PLATFORM_EXPORT std::unique_ptr<v8::Platform> NewDefaultPlatform(
     int thread_pool_size = 0,
     IdleTaskSupport idle_task_support = IdleTaskSupport::kDisabled,
     InProcessStackDumping in_process_stack_dumping =
         InProcessStackDumping::kDisabled,
-    std::unique_ptr<v8::TracingController> tracing_controller = {});
+    std::unique_ptr<v8::TracingController> tracing_controller = {},
+    NumaPinning numa_pinning = NumaPinning::kDisabled);
 
 /**
  * The same as NewDefaultPlatform but disables the worker thread pool.
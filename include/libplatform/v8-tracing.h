@@ -25,6 +25,7 @@ namespace v8 {
 
 namespace base {
 class Mutex;
+class SharedMutex;
 }  // namespace base
 
 namespace platform {
@@ -306,6 +307,11 @@ class V8_PLATFORM_EXPORT TracingController
 #endif  // !defined(V8_USE_PERFETTO)
 
   std::unique_ptr<base::Mutex> mutex_;
+#if !defined(V8_USE_PERFETTO)
+  // Taken shared while adding an event, and exclusively while flushing the
+  // trace buffer.
+  std::unique_ptr<base::SharedMutex> trace_buffer_mutex_;
+#endif  // !defined(V8_USE_PERFETTO)
   std::unique_ptr<TraceConfig> trace_config_;
   std::atomic_bool recording_{false};
   std::unordered_set<v8::TracingController::TraceStateObserver*> observers_;
@@ -163,6 +163,11 @@
  *  - uint64_t
  *  - float32_t
  *  - float64_t
+ *  - const FastApiTypedArray<T>&, where T is one of the integer or floating
+ *    point types above. The argument gives direct access to the backing store
+ *    of a typed array with the matching element type. Any other value,
+ *    including a detached or length-tracking typed array, goes to the slow
+ *    callback instead.
  *
  * The 64-bit integer types currently have the IDL (unsigned) long long
  * semantics: https://heycam.github.io/webidl/#abstract-opdef-converttoint
@@ -176,7 +181,7 @@
  * passes NaN values as-is, i.e. doesn't normalize them.
  *
  * To be supported types:
- *  - arrays of C types
+ *  - sequences of C types
  *  - arrays of embedder types
  *
  *
@@ -297,6 +302,8 @@ class CTypeInfo {
   Flags flags_;
 };
 
+// Typed array arguments must be taken by const reference, the fast call
+// passes a pointer to this struct.
 template <typename T>
 struct FastApiTypedArray {
   T* data;        // should include the typed array offset applied
@@ -562,7 +569,7 @@ BASIC_C_TYPES(SPECIALIZE_GET_TYPE_INFO_HELPER_FOR)
 
 #define SPECIALIZE_GET_TYPE_INFO_HELPER_FOR_TA(T, Enum)                       \
   template <>                                                                 \
-  struct TypeInfoHelper<FastApiTypedArray<T>> {                               \
+  struct TypeInfoHelper<const FastApiTypedArray<T>&> {                        \
     static constexpr CTypeInfo::Flags Flags() {                               \
       return CTypeInfo::Flags::kNone;                                         \
     }                                                                         \
@@ -5,6 +5,9 @@
 #ifndef V8_METRICS_H_
 #define V8_METRICS_H_
 
+#include <string>
+#include <vector>
+
 #include "v8-internal.h"  // NOLINT(build/include_directory)
 #include "v8.h"           // NOLINT(build/include_directory)
 
@@ -63,6 +66,106 @@ struct GarbageCollectionYoungCycle {
   double main_thread_efficiency_in_bytes_per_us;
 };
 
+struct ObjectStatsSampleEntry {
+  // Name of the instance type, e.g. "JS_OBJECT_TYPE".
+  const char* instance_type = nullptr;
+  size_t sampled_objects = 0;
+  size_t sampled_bytes = 0;
+};
+
+// Heap composition of the live objects found by a full garbage collection.
+// Only one in sampling_rate objects is counted; multiply by sampling_rate to
+// estimate totals. Instance types without samples are omitted.
+struct GarbageCollectionObjectStatsSample {
+  int sampling_rate = 0;
+  std::vector<ObjectStatsSampleEntry> entries;
+};
+
+struct GarbageCollectionPhaseHistogram {
+  // Name of the tracer scope, e.g. "V8.GC_MC_EVACUATE_UPDATE_POINTERS".
+  const char* scope = nullptr;
+  // Whether the scope runs on background threads. Durations of background
+  // scopes are summed over all threads.
+  bool background = false;
+  // Number of garbage collections in which the scope was entered.
+  int64_t sample_count = 0;
+  int64_t total_duration_in_us = 0;
+  // Log2 histogram of the per-collection durations: bucket i counts the
+  // collections in which the scope took [2^i, 2^(i+1)) us, except that the
+  // first bucket also counts durations below 1 us and the last bucket also
+  // counts all longer durations.
+  std::vector<int64_t> buckets;
+};
+
+// Per-phase durations of the garbage collections since the last report,
+// batched over a number of collections to keep the overhead low. Phases that
+// were not entered are omitted.
+struct GarbageCollectionPhaseHistograms {
+  int gc_count = 0;
+  // Time spent in garbage collection pauses on the main thread.
+  int64_t main_thread_busy_time_in_us = 0;
+  // Time spent in garbage collection scopes on background threads.
+  int64_t background_threads_busy_time_in_us = 0;
+  std::vector<GarbageCollectionPhaseHistogram> phases;
+};
+
+struct JSDeoptimization {
+  // Human readable reason of the deoptimization, e.g. "wrong map". Points to
+  // a string with static lifetime.
+  const char* reason = nullptr;
+  int script_id = -1;
+  // Offset into the script source of the deoptimizing site, attributed to the
+  // outermost (non-inlined) function.
+  int source_position = -1;
+  int bytecode_offset = -1;
+  // Whether the deoptimization was lazy (i.e. triggered by invalidation of the
+  // optimized code rather than by a failed check at the site itself).
+  bool lazy = false;
+};
+
+struct JSMegamorphicTransition {
+  // Kind of the inline cache, e.g. "LoadIC" or "KeyedStoreIC". Points to a
+  // string with static lifetime.
+  const char* ic_type = nullptr;
+  // Name of the accessed property, truncated to 64 characters. Empty for
+  // element accesses.
+  std::string property_name;
+  // Number of maps the inline cache had seen when it went megamorphic.
+  int map_count = 0;
+  int64_t count = 0;
+};
+
+// Inline caches that went megamorphic since the last report, aggregated by
+// kind, property name and map count. Reported in batches, see
+// --cliff-metrics-batch-size.
+struct JSMegamorphicTransitions {
+  std::vector<JSMegamorphicTransition> transitions;
+  // Transitions that were not aggregated because there were too many
+  // distinct ones.
+  int64_t dropped_count = 0;
+};
+
+struct JSDeoptimizationCount {
+  // Human readable reason of the deoptimizations, e.g. "wrong map". Points to
+  // a string with static lifetime.
+  const char* reason = nullptr;
+  int script_id = -1;
+  // Start of the deoptimized (outermost) function in the script source.
+  int function_position = -1;
+  std::string function_name;
+  int64_t eager_count = 0;
+  int64_t lazy_count = 0;
+};
+
+// Deoptimizations since the last report, aggregated by reason and function.
+// Reported in batches together with JSMegamorphicTransitions.
+struct JSDeoptimizationCounts {
+  std::vector<JSDeoptimizationCount> deoptimizations;
+  // Deoptimizations that were not aggregated because there were too many
+  // distinct ones.
+  int64_t dropped_count = 0;
+};
+
 struct WasmModuleDecoded {
   bool async = false;
   bool streamed = false;
@@ -94,6 +197,7 @@ struct WasmModuleInstantiated {
 struct WasmModuleTieredUp {
   bool lazy = false;
   size_t code_size_in_bytes = 0;
+  size_t committed_code_size_in_bytes = 0;
   int64_t wall_clock_duration_in_us = -1;
 };
 
@@ -101,17 +205,45 @@ struct WasmModulesPerIsolate {
   size_t count = 0;
 };
 
+struct RuntimeCallStatsSampleEntry {
+  // Name of the runtime call counter, e.g. "CompileLazy". Points to a string
+  // with static lifetime.
+  const char* name = nullptr;
+  int64_t main_thread_samples = 0;
+  // Samples taken on the isolate's worker threads, summed over all threads.
+  int64_t background_samples = 0;
+};
+
+// Runtime call counters that were active when the isolate's threads were
+// sampled with --runtime-call-stats-sampling, since the last report. Samples
+// are taken every sampling_interval_in_us; multiply the sample counts by it to
+// estimate the time spent. Counters without samples are omitted.
+struct RuntimeCallStatsSample {
+  int64_t sampling_interval_in_us = 0;
+  // Number of samples of the main thread, including those without an active
+  // counter.
+  int64_t main_thread_sample_count = 0;
+  std::vector<RuntimeCallStatsSampleEntry> entries;
+};
+
 #define V8_MAIN_THREAD_METRICS_EVENTS(V)             \
   V(GarbageCollectionFullCycle)                      \
   V(GarbageCollectionFullMainThreadIncrementalMark)  \
   V(GarbageCollectionFullMainThreadIncrementalSweep) \
   V(GarbageCollectionYoungCycle)                     \
+  V(GarbageCollectionObjectStatsSample)              \
+  V(GarbageCollectionPhaseHistograms)                \
+  V(JSDeoptimization)                                \
+  V(JSDeoptimizationCounts)                          \
+  V(JSMegamorphicTransitions)                        \
   V(WasmModuleDecoded)                               \
   V(WasmModuleCompiled)                              \
   V(WasmModuleInstantiated)                          \
   V(WasmModuleTieredUp)
 
-#define V8_THREAD_SAFE_METRICS_EVENTS(V) V(WasmModulesPerIsolate)
+#define V8_THREAD_SAFE_METRICS_EVENTS(V) \
+  V(WasmModulesPerIsolate)               \
+  V(RuntimeCallStatsSample)
 
 /**
  * This class serves as a base class for recording event-based metrics in V8.
@@ -210,6 +342,35 @@ struct V8_EXPORT LongTaskStats {
   int64_t gc_young_wall_clock_duration_us = 0;
 };
 
+/**
+ * Statistics of the caches that megamorphic property loads and stores use to
+ * find their handlers, accumulated over the lifetime of the isolate. The
+ * caches grow once if they miss often, see --stub-cache-growth.
+ */
+struct V8_EXPORT MegamorphicCacheStats {
+  /**
+   * Returns the current statistics of the given isolate.
+   */
+  static MegamorphicCacheStats Get(Isolate* isolate);
+
+  /**
+   * Lookups that found a handler. Counting them would slow down every
+   * megamorphic access, so they are only available if generated code
+   * maintains native code counters and the embedder has installed a counter
+   * function with Isolate::SetCounterFunction(); otherwise this is -1.
+   */
+  int64_t hits = -1;
+  /**
+   * Lookups that did not find a handler and went to the runtime.
+   */
+  int64_t misses = 0;
+  /**
+   * The current number of entries of the load and store caches.
+   */
+  int load_cache_size = 0;
+  int store_cache_size = 0;
+};
+
 }  // namespace metrics
 }  // namespace v8
 
@@ -434,6 +434,13 @@ class PageAllocator {
    */
   virtual bool DiscardSystemPages(void* address, size_t size) { return true; }
 
+  /**
+   * Advises the operating system to back the given [address, address + size)
+   * range with huge pages (e.g. transparent huge pages on Linux) where
+   * possible. Returns false if the hint is not supported.
+   */
+  virtual bool AdviseHugePages(void* address, size_t size) { return false; }
+
   /**
    * INTERNAL ONLY: This interface has not been stabilised and may change
    * without notice from one release to another without being deprecated first.
@@ -702,6 +702,13 @@ class V8_EXPORT AllocationProfile {
      * what samples were added or removed between two snapshots.
      */
     uint64_t sample_id;
+
+    /**
+     * The number of garbage collections that the sampled object has survived
+     * since it was allocated. Objects that are retained for a long time have
+     * high ages, while short-lived ones are dropped from the profile.
+     */
+    unsigned int survived_gcs;
   };
 
   /**
@@ -135,6 +135,7 @@ class Heap;
 class HeapObject;
 class Isolate;
 class LocalEmbedderHeapTracer;
+class MemoryBudget;
 class MicrotaskQueue;
 class PropertyCallbackArguments;
 class ReadOnlyHeap;
@@ -2460,6 +2461,34 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
       Local<Context> context, Local<String> json_string);
 
+  /**
+   * Supplies the input of Parse in consecutive chunks.
+   */
+  class V8_EXPORT InputSource {
+   public:
+    virtual ~InputSource() = default;
+
+    /**
+     * Returns the next chunk of the input, or an empty handle once all of the
+     * input has been returned.
+     */
+    virtual Local<String> ReadChunk() = 0;
+  };
+
+  /**
+   * Tries to parse the concatenation of the chunks read from |source| and
+   * returns it as value if successful. The chunks are copied outside of the
+   * V8 heap as they are read, so that the input never has to be a single
+   * heap string. The input is only parsed once the last chunk was read, and
+   * may be at most String::kMaxLength characters long.
+   *
+   * \param context The context in which to parse and create the value.
+   * \param source The source of the input chunks.
+   * \return The corresponding value if successfully parsed.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(Local<Context> context,
+                                                       InputSource* source);
+
   /**
    * Tries to stringify the JSON-serializable object |json_object| and returns
    * it as string if successful.
@@ -2470,6 +2499,34 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Receives the output of Stringify in consecutive chunks.
+   */
+  class V8_EXPORT OutputSink {
+   public:
+    virtual ~OutputSink() = default;
+
+    /**
+     * Called with the next chunk of the output. The chunks are not
+     * necessarily flat.
+     */
+    virtual void WriteChunk(Local<String> chunk) = 0;
+  };
+
+  /**
+   * Tries to stringify the JSON-serializable object |json_object| and writes
+   * the result to |sink| in chunks, so that the whole output never has to be
+   * held in a single string.
+   *
+   * \param json_object The JSON-serializable object to stringify.
+   * \return true if the output was written, false if |json_object| has no
+   *   JSON representation (e.g. it is undefined), and nothing if an exception
+   *   was thrown. Chunks written before an exception are not revoked.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> Stringify(
+      Local<Context> context, Local<Value> json_object, OutputSink* sink,
+      Local<String> gap = Local<String>());
 };
 
 /**
@@ -2511,6 +2568,20 @@ class V8_EXPORT ValueSerializer {
 
     virtual Maybe<uint32_t> GetWasmModuleTransferId(
         Isolate* isolate, Local<WasmModuleObject> module);
+
+    /**
+     * Called when the ValueSerializer is going to serialize an external
+     * string. The embedder may return an ID for it, in which case only the ID
+     * is written and the contents are not copied. When deserializing, this ID
+     * will be passed to ValueDeserializer::GetExternalStringFromId as
+     * |transfer_id|.
+     *
+     * The default implementation returns Nothing<uint32_t>(), and the
+     * contents of the string are serialized as usual.
+     */
+    virtual Maybe<uint32_t> GetExternalStringTransferId(Isolate* isolate,
+                                                        Local<String> string);
+
     /**
      * Allocates memory for the buffer of at least the size provided. The actual
      * size (which may be greater or equal) is written to |actual_size|. If no
@@ -2622,6 +2693,13 @@ class V8_EXPORT ValueDeserializer {
      */
     virtual MaybeLocal<SharedArrayBuffer> GetSharedArrayBufferFromId(
         Isolate* isolate, uint32_t clone_id);
+
+    /**
+     * Get a string given a transfer_id previously provided by
+     * ValueSerializer::GetExternalStringTransferId
+     */
+    virtual MaybeLocal<String> GetExternalStringFromId(Isolate* isolate,
+                                                       uint32_t transfer_id);
   };
 
   ValueDeserializer(Isolate* isolate, const uint8_t* data, size_t size);
@@ -3529,6 +3607,19 @@ class V8_EXPORT String : public Name {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalOneByte(
       Isolate* isolate, ExternalOneByteStringResource* resource);
 
+  /**
+   * Creates a new string from the UTF-8 data defined in the given resource,
+   * taking over ownership of the resource. If the data is ASCII, which is
+   * also valid one-byte data, the result is an external string that uses the
+   * resource without copying, like with NewExternalOneByte. Otherwise, the
+   * data is transcoded into a new string like with NewFromUtf8, and the
+   * resource is disposed immediately. Either way, the caller should not use,
+   * delete or modify the resource afterwards. Returns an empty handle, and
+   * disposes the resource, if the data is longer than String::kMaxLength.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalFromUtf8(
+      Isolate* isolate, ExternalOneByteStringResource* resource);
+
   /**
    * Associate an external string resource with this string by transforming it
    * in place so that existing references to this string in the JavaScript heap
@@ -7089,6 +7180,42 @@ V8_INLINE Local<Primitive> Null(Isolate* isolate);
 V8_INLINE Local<Boolean> True(Isolate* isolate);
 V8_INLINE Local<Boolean> False(Isolate* isolate);
 
+/**
+ * A memory budget that can be shared by the heaps of several isolates in the
+ * same process, see ResourceConstraints::set_shared_memory_budget.
+ *
+ * Once the combined heap memory of all isolates using the budget exceeds the
+ * soft limit, the isolates grow their heaps more conservatively and then, in
+ * order, perform memory-reducing garbage collections, flush bytecode and
+ * evict their compilation caches as usage approaches the hard limit.
+ */
+class V8_EXPORT SharedHeapMemoryBudget final {
+ public:
+  static std::shared_ptr<SharedHeapMemoryBudget> New(
+      size_t soft_limit_in_bytes, size_t hard_limit_in_bytes);
+
+  ~SharedHeapMemoryBudget();
+  SharedHeapMemoryBudget(const SharedHeapMemoryBudget&) = delete;
+  SharedHeapMemoryBudget& operator=(const SharedHeapMemoryBudget&) = delete;
+
+  size_t soft_limit_in_bytes() const;
+  size_t hard_limit_in_bytes() const;
+
+  /**
+   * The combined heap memory of all isolates using this budget as of their
+   * last garbage collection.
+   */
+  size_t used_in_bytes() const;
+
+ private:
+  explicit SharedHeapMemoryBudget(
+      std::shared_ptr<internal::MemoryBudget> budget);
+
+  std::shared_ptr<internal::MemoryBudget> budget_;
+
+  friend class internal::Heap;
+};
+
 /**
  * A set of constraints that specifies the limits of the runtime's memory use.
  * You must set the heap size before initializing the VM - the size cannot be
@@ -7196,6 +7323,33 @@ class V8_EXPORT ResourceConstraints {
     initial_young_generation_size_ = initial_size;
   }
 
+  /**
+   * The desired interval between young generation garbage collections in
+   * milliseconds, or zero to use the default growing heuristics. When set,
+   * the young generation is sized within its configured limits based on the
+   * observed allocation throughput so that young generation garbage
+   * collections happen roughly at this interval. Larger intervals trade memory
+   * for less time spent in garbage collection.
+   */
+  size_t young_generation_target_gc_interval_in_ms() const {
+    return young_generation_target_gc_interval_in_ms_;
+  }
+  void set_young_generation_target_gc_interval_in_ms(size_t interval) {
+    young_generation_target_gc_interval_in_ms_ = interval;
+  }
+
+  /**
+   * A memory budget shared with other isolates. The budget is applied in
+   * addition to the per-isolate limits above.
+   */
+  std::shared_ptr<SharedHeapMemoryBudget> shared_memory_budget() const {
+    return shared_memory_budget_;
+  }
+  void set_shared_memory_budget(
+      std::shared_ptr<SharedHeapMemoryBudget> budget) {
+    shared_memory_budget_ = std::move(budget);
+  }
+
  private:
   static constexpr size_t kMB = 1048576u;
   size_t code_range_size_ = 0;
@@ -7203,6 +7357,8 @@ class V8_EXPORT ResourceConstraints {
   size_t max_young_generation_size_ = 0;
   size_t initial_old_generation_size_ = 0;
   size_t initial_young_generation_size_ = 0;
+  size_t young_generation_target_gc_interval_in_ms_ = 0;
+  std::shared_ptr<SharedHeapMemoryBudget> shared_memory_budget_;
   uint32_t* stack_limit_ = nullptr;
 };
 
@@ -9353,6 +9509,25 @@ class V8_EXPORT Isolate {
    */
   bool IdleNotificationDeadline(double deadline_in_seconds);
 
+  /**
+   * Optional notification that the embedder expects to stay idle until
+   * deadline_in_seconds, which uses the same timebase as
+   * IdleNotificationDeadline(). Unlike IdleNotificationDeadline(), this call
+   * returns right away: V8 schedules its garbage collection tasks into the
+   * window, e.g. incremental marking steps and scavenges, running them on the
+   * platform's foreground task runner.
+   */
+  void NotifyExpectedIdleWindow(double deadline_in_seconds);
+
+  /**
+   * Optional notifications that the embedder starts or finishes work with
+   * tight latency requirements, e.g. handling a request. Calls may nest. V8
+   * defers garbage collection tasks until the outermost such work has
+   * finished. Collections required to satisfy allocations still happen.
+   */
+  void NotifyLatencyCriticalWorkStarted();
+  void NotifyLatencyCriticalWorkFinished();
+
   /**
    * Optional notification that the system is running low on memory.
    * V8 uses these notifications to attempt to free memory.
@@ -9503,9 +9678,21 @@ class V8_EXPORT Isolate {
    * than |capacity|. In this case, only |capacity| pages will be copied into
    * |code_pages_out|. The caller should provide a bigger buffer on the next
    * call in order to get all available code pages, but this is not required.
+   * Returns 0 if the code pages kept changing concurrently while copying.
    */
   size_t CopyCodePages(size_t capacity, MemoryRange* code_pages_out);
 
+  /**
+   * Returns a version number of the code pages that changes whenever the
+   * result of CopyCodePages() would change. Profilers can keep a copy of the
+   * code pages across samples and only call CopyCodePages() again when the
+   * version differs from the one read before the last copy.
+   *
+   * Signal-safe, does not allocate, does not access the V8 heap. Can be
+   * called from any thread.
+   */
+  size_t GetCodePagesVersion();
+
   /** Set the callback to invoke in case of fatal errors. */
   void SetFatalErrorHandler(FatalErrorCallback that);
 
@@ -69,6 +69,17 @@ MaybeHandle<Object> Instantiate(
   }
 }
 
+// Accessor pairs normally keep FunctionTemplateInfos and instantiate them on
+// first use. Accessors that need a real JSFunction up front are instantiated
+// eagerly instead: those with a break point at entry, and those with C
+// function overloads, since TurboFan only turns calls to API JSFunctions into
+// fast API calls.
+bool ShouldInstantiateAccessor(Handle<Object> accessor) {
+  if (!accessor->IsFunctionTemplateInfo()) return false;
+  FunctionTemplateInfo info = FunctionTemplateInfo::cast(*accessor);
+  return info.BreakAtEntry() || info.GetCFunctionsCount() > 0;
+}
+
 MaybeHandle<Object> DefineAccessorProperty(Isolate* isolate,
                                            Handle<JSObject> object,
                                            Handle<Name> name,
@@ -79,16 +90,14 @@ MaybeHandle<Object> DefineAccessorProperty(Isolate* isolate,
          FunctionTemplateInfo::cast(*getter).should_cache());
   DCHECK(!setter->IsFunctionTemplateInfo() ||
          FunctionTemplateInfo::cast(*setter).should_cache());
-  if (getter->IsFunctionTemplateInfo() &&
-      FunctionTemplateInfo::cast(*getter).BreakAtEntry()) {
+  if (ShouldInstantiateAccessor(getter)) {
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, getter,
         InstantiateFunction(isolate,
                             Handle<FunctionTemplateInfo>::cast(getter)),
         Object);
   }
-  if (setter->IsFunctionTemplateInfo() &&
-      FunctionTemplateInfo::cast(*setter).BreakAtEntry()) {
+  if (ShouldInstantiateAccessor(setter)) {
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, setter,
         InstantiateFunction(isolate,
@@ -202,6 +211,18 @@ MaybeHandle<JSObject> ConfigureInstance(Isolate* isolate, Handle<JSObject> obj,
     info = info.GetParent(isolate);
   }
 
+  // An instance that receives more properties than a descriptor array can
+  // hold ends up in dictionary mode anyway. Normalize it up front with room
+  // for all of them, instead of walking a long chain of map transitions first
+  // and then growing the dictionary step by step.
+  int number_of_properties =
+      max_number_of_properties + data->number_of_properties();
+  if (obj->HasFastProperties() &&
+      number_of_properties > kMaxNumberOfDescriptors) {
+    JSObject::NormalizeProperties(isolate, obj, KEEP_INOBJECT_PROPERTIES,
+                                  number_of_properties, "ConfigureInstance");
+  }
+
   if (max_number_of_properties > 0) {
     int valid_descriptors = 0;
     // Use a temporary FixedArray to accumulate unique accessors.
@@ -51,6 +51,8 @@
 #include "src/handles/persistent-handles.h"
 #include "src/heap/embedder-tracing.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/memory-budget.h"
+#include "src/ic/stub-cache.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/icu_util.h"
 #include "src/init/startup-data-util.h"
@@ -743,6 +745,34 @@ void ResourceConstraints::ConfigureDefaults(uint64_t physical_memory,
   }
 }
 
+std::shared_ptr<SharedHeapMemoryBudget> SharedHeapMemoryBudget::New(
+    size_t soft_limit_in_bytes, size_t hard_limit_in_bytes) {
+  Utils::ApiCheck(soft_limit_in_bytes <= hard_limit_in_bytes,
+                  "v8::SharedHeapMemoryBudget::New",
+                  "soft limit must not exceed the hard limit");
+  return std::shared_ptr<SharedHeapMemoryBudget>(new SharedHeapMemoryBudget(
+      std::make_shared<i::MemoryBudget>(soft_limit_in_bytes,
+                                        hard_limit_in_bytes)));
+}
+
+SharedHeapMemoryBudget::SharedHeapMemoryBudget(
+    std::shared_ptr<i::MemoryBudget> budget)
+    : budget_(std::move(budget)) {}
+
+SharedHeapMemoryBudget::~SharedHeapMemoryBudget() = default;
+
+size_t SharedHeapMemoryBudget::soft_limit_in_bytes() const {
+  return budget_->soft_limit_in_bytes();
+}
+
+size_t SharedHeapMemoryBudget::hard_limit_in_bytes() const {
+  return budget_->hard_limit_in_bytes();
+}
+
+size_t SharedHeapMemoryBudget::used_in_bytes() const {
+  return budget_->used_in_bytes();
+}
+
 i::Address* V8::GlobalizeReference(i::Isolate* isolate, i::Address* obj) {
   LOG_API(isolate, Persistent, New);
   i::Handle<i::Object> result = isolate->global_handles()->Create(*obj);
@@ -2686,7 +2716,7 @@ ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheForFunction(
   Utils::ApiCheck(shared->is_wrapped(),
                   "v8::ScriptCompiler::CreateCodeCacheForFunction",
                   "Expected SharedFunctionInfo with wrapped source code.");
-  return i::CodeSerializer::Serialize(shared);
+  return i::CodeSerializer::Serialize(shared, js_function);
 }
 
 MaybeLocal<Script> Script::Compile(Local<Context> context, Local<String> source,
@@ -3110,6 +3140,100 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+namespace {
+// Owns the input of a chunked JSON::Parse outside of the V8 heap.
+class JsonOneByteInputResource final
+    : public String::ExternalOneByteStringResource {
+ public:
+  explicit JsonOneByteInputResource(std::vector<uint8_t> data)
+      : data_(std::move(data)) {}
+
+  const char* data() const override {
+    return reinterpret_cast<const char*>(data_.data());
+  }
+  size_t length() const override { return data_.size(); }
+
+ private:
+  const std::vector<uint8_t> data_;
+};
+
+class JsonTwoByteInputResource final : public String::ExternalStringResource {
+ public:
+  explicit JsonTwoByteInputResource(std::vector<uint16_t> data)
+      : data_(std::move(data)) {}
+
+  const uint16_t* data() const override { return data_.data(); }
+  size_t length() const override { return data_.size(); }
+
+ private:
+  const std::vector<uint16_t> data_;
+};
+}  // namespace
+
+MaybeLocal<Value> JSON::Parse(Local<Context> context, InputSource* source) {
+  PREPARE_FOR_EXECUTION(context, JSON, Parse, Value);
+  // Collect the chunks as one-byte characters until the first two-byte chunk
+  // is read.
+  std::vector<uint8_t> one_byte_input;
+  std::vector<uint16_t> two_byte_input;
+  bool is_one_byte = true;
+  while (true) {
+    i::HandleScope chunk_scope(isolate);
+    Local<String> chunk = source->ReadChunk();
+    if (chunk.IsEmpty()) break;
+    i::Handle<i::String> string =
+        i::String::Flatten(isolate, Utils::OpenHandle(*chunk));
+    const size_t offset =
+        is_one_byte ? one_byte_input.size() : two_byte_input.size();
+    const size_t length = string->length();
+    if (length > static_cast<size_t>(i::String::kMaxLength) - offset) {
+      isolate->Throw(*isolate->factory()->NewInvalidStringLengthError());
+      has_pending_exception = true;
+      RETURN_ON_FAILED_EXECUTION(Value);
+    }
+    if (is_one_byte && !string->IsOneByteRepresentation()) {
+      is_one_byte = false;
+      two_byte_input.assign(one_byte_input.begin(), one_byte_input.end());
+      std::vector<uint8_t>().swap(one_byte_input);
+    }
+    if (is_one_byte) {
+      one_byte_input.resize(offset + length);
+      i::String::WriteToFlat(*string, one_byte_input.data() + offset, 0,
+                             static_cast<int>(length));
+    } else {
+      two_byte_input.resize(offset + length);
+      i::String::WriteToFlat(*string, two_byte_input.data() + offset, 0,
+                             static_cast<int>(length));
+    }
+  }
+
+  i::Handle<i::String> json_string = isolate->factory()->empty_string();
+  if (is_one_byte && !one_byte_input.empty()) {
+    auto resource =
+        std::make_unique<JsonOneByteInputResource>(std::move(one_byte_input));
+    json_string = isolate->factory()
+                      ->NewExternalStringFromOneByte(resource.get())
+                      .ToHandleChecked();
+    resource.release();
+  } else if (!is_one_byte && !two_byte_input.empty()) {
+    auto resource =
+        std::make_unique<JsonTwoByteInputResource>(std::move(two_byte_input));
+    json_string = isolate->factory()
+                      ->NewExternalStringFromTwoByte(resource.get())
+                      .ToHandleChecked();
+    resource.release();
+  }
+  i::Handle<i::Object> undefined = isolate->factory()->undefined_value();
+  auto maybe =
+      json_string->IsOneByteRepresentation()
+          ? i::JsonParser<uint8_t>::Parse(isolate, json_string, undefined)
+          : i::JsonParser<uint16_t>::Parse(isolate, json_string, undefined);
+  Local<Value> result;
+  has_pending_exception = !ToLocal<Value>(maybe, &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3130,6 +3254,39 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+namespace {
+class JsonOutputSinkAdapter final : public i::JsonStringifyOutput {
+ public:
+  explicit JsonOutputSinkAdapter(JSON::OutputSink* sink) : sink_(sink) {}
+
+  void WritePart(i::Handle<i::String> part) override {
+    sink_->WriteChunk(Utils::ToLocal(part));
+  }
+
+ private:
+  JSON::OutputSink* const sink_;
+};
+}  // namespace
+
+Maybe<bool> JSON::Stringify(Local<Context> context, Local<Value> json_object,
+                            OutputSink* sink, Local<String> gap) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, JSON, Stringify, Nothing<bool>(),
+           i::HandleScope);
+  i::Handle<i::Object> object = Utils::OpenHandle(*json_object);
+  i::Handle<i::Object> replacer = isolate->factory()->undefined_value();
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  JsonOutputSinkAdapter output(sink);
+  i::Handle<i::Object> result;
+  has_pending_exception =
+      !i::JsonStringify(isolate, object, replacer, gap_string, &output)
+           .ToHandle(&result);
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return Just(!result->IsUndefined(isolate));
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 Maybe<bool> ValueSerializer::Delegate::WriteHostObject(Isolate* v8_isolate,
@@ -3155,6 +3312,11 @@ Maybe<uint32_t> ValueSerializer::Delegate::GetWasmModuleTransferId(
   return Nothing<uint32_t>();
 }
 
+Maybe<uint32_t> ValueSerializer::Delegate::GetExternalStringTransferId(
+    Isolate* v8_isolate, Local<String> string) {
+  return Nothing<uint32_t>();
+}
+
 void* ValueSerializer::Delegate::ReallocateBufferMemory(void* old_buffer,
                                                         size_t size,
                                                         size_t* actual_size) {
@@ -3244,6 +3406,15 @@ MaybeLocal<WasmModuleObject> ValueDeserializer::Delegate::GetWasmModuleFromId(
   return MaybeLocal<WasmModuleObject>();
 }
 
+MaybeLocal<String> ValueDeserializer::Delegate::GetExternalStringFromId(
+    Isolate* v8_isolate, uint32_t transfer_id) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  isolate->ScheduleThrow(*isolate->factory()->NewError(
+      isolate->error_function(),
+      i::MessageTemplate::kDataCloneDeserializationError));
+  return MaybeLocal<String>();
+}
+
 MaybeLocal<SharedArrayBuffer>
 ValueDeserializer::Delegate::GetSharedArrayBufferFromId(Isolate* v8_isolate,
                                                         uint32_t id) {
@@ -5864,9 +6035,7 @@ bool TryHandleWebAssemblyTrapPosix(int sig_code, siginfo_t* info,
   // code rather than the wasm code, so the trap handler cannot find the landing
   // pad and lets the process crash. Therefore, only enable trap handlers if
   // the host and target arch are the same.
-#if V8_ENABLE_WEBASSEMBLY &&                   \
-    ((V8_TARGET_ARCH_X64 && !V8_OS_ANDROID) || \
-     (V8_HOST_ARCH_ARM64 && V8_TARGET_ARCH_ARM64 && V8_OS_MACOSX))
+#if V8_ENABLE_WEBASSEMBLY && V8_TRAP_HANDLER_SUPPORTED
   return i::trap_handler::TryHandleSignal(sig_code, info, context);
 #else
   return false;
@@ -6371,6 +6540,28 @@ metrics::LongTaskStats metrics::LongTaskStats::Get(v8::Isolate* isolate) {
   return *i_isolate->GetCurrentLongTaskStats();
 }
 
+metrics::MegamorphicCacheStats metrics::MegamorphicCacheStats::Get(
+    v8::Isolate* isolate) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i::StubCache* load_cache = i_isolate->load_stub_cache();
+  i::StubCache* store_cache = i_isolate->store_stub_cache();
+  metrics::MegamorphicCacheStats stats;
+  stats.misses = load_cache->miss_count() + store_cache->miss_count();
+  // Hits are only counted by generated code with native code counters.
+  i::Counters* counters = i_isolate->counters();
+  i::StatsCounter* probes = counters->megamorphic_stub_cache_probes();
+  i::StatsCounter* misses = counters->megamorphic_stub_cache_misses();
+  if (i::FLAG_native_code_counters && probes->Enabled() && misses->Enabled()) {
+    stats.hits = static_cast<int64_t>(*probes->GetInternalPointer()) -
+                 *misses->GetInternalPointer();
+  }
+  stats.load_cache_size =
+      load_cache->primary_table_size() + load_cache->secondary_table_size();
+  stats.store_cache_size =
+      store_cache->primary_table_size() + store_cache->secondary_table_size();
+  return stats;
+}
+
 namespace {
 i::Address* GetSerializedDataFromFixedArray(i::Isolate* isolate,
                                             i::FixedArray list, size_t index) {
@@ -6680,6 +6871,31 @@ MaybeLocal<String> v8::String::NewExternalOneByte(
   return Utils::ToLocal(string);
 }
 
+MaybeLocal<String> v8::String::NewExternalFromUtf8(
+    Isolate* isolate, v8::String::ExternalOneByteStringResource* resource) {
+  CHECK_NOT_NULL(resource);
+  const size_t length = resource->length();
+  if (length > static_cast<size_t>(i::String::kMaxLength)) {
+    resource->Dispose();
+    return MaybeLocal<String>();
+  }
+  if (length == 0 ||
+      i::String::IsAscii(resource->data(), static_cast<int>(length))) {
+    return NewExternalOneByte(isolate, resource);
+  }
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  LOG_API(i_isolate, String, NewExternalFromUtf8);
+  i::Handle<i::String> string =
+      i_isolate->factory()
+          ->NewStringFromUtf8(
+              base::Vector<const char>(resource->data(), length))
+          .ToHandleChecked();
+  // The transcoded string doesn't refer to the resource.
+  resource->Dispose();
+  return Utils::ToLocal(string);
+}
+
 bool v8::String::MakeExternal(v8::String::ExternalStringResource* resource) {
   i::DisallowGarbageCollection no_gc;
 
@@ -7096,9 +7312,15 @@ Local<v8::Array> v8::Array::New(Isolate* isolate, Local<Value>* elements,
   int len = static_cast<int>(length);
 
   i::Handle<i::FixedArray> result = factory->NewFixedArray(len);
-  for (int i = 0; i < len; i++) {
-    i::Handle<i::Object> element = Utils::OpenHandle(*elements[i]);
-    result->set(i, *element);
+  {
+    // Fill the backing store with a single write barrier decision; a freshly
+    // allocated young array needs none.
+    i::DisallowGarbageCollection no_gc;
+    i::FixedArray raw_result = *result;
+    i::WriteBarrierMode mode = raw_result.GetWriteBarrierMode(no_gc);
+    for (int i = 0; i < len; i++) {
+      raw_result.set(i, *Utils::OpenHandle(*elements[i]), mode);
+    }
   }
 
   return Utils::ToLocal(
@@ -8875,6 +9097,22 @@ bool Isolate::IdleNotificationDeadline(double deadline_in_seconds) {
   return isolate->heap()->IdleNotification(deadline_in_seconds);
 }
 
+void Isolate::NotifyExpectedIdleWindow(double deadline_in_seconds) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  if (!i::FLAG_use_idle_notification) return;
+  isolate->heap()->NotifyExpectedIdleWindow(deadline_in_seconds);
+}
+
+void Isolate::NotifyLatencyCriticalWorkStarted() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->NotifyLatencyCriticalWorkStarted();
+}
+
+void Isolate::NotifyLatencyCriticalWorkFinished() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->NotifyLatencyCriticalWorkFinished();
+}
+
 void Isolate::LowMemoryNotification() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   {
@@ -9014,22 +9252,39 @@ size_t Isolate::CopyCodePages(size_t capacity, MemoryRange* code_pages_out) {
 #else
 
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
-  std::vector<MemoryRange>* code_pages = isolate->GetCodePages();
-
-  DCHECK_NOT_NULL(code_pages);
-
-  // Copy as many elements into the output vector as we can. If the
-  // caller-provided buffer is not big enough, we fill it, and the caller can
-  // provide a bigger one next time. We do it this way because allocation is not
-  // allowed in signal handlers.
-  size_t limit = std::min(capacity, code_pages->size());
-  for (size_t i = 0; i < limit; i++) {
-    code_pages_out[i] = code_pages->at(i);
+  // When copying from another thread than the one that modifies the code
+  // pages, retry if they changed concurrently. A signal handler interrupting
+  // the modifying thread always sees a consistent buffer. Locking is not
+  // signal-safe, so give up and report no pages if the copy never settles.
+  static const int kMaxAttempts = 8;
+  for (int attempt = 0; attempt < kMaxAttempts; attempt++) {
+    size_t version = isolate->code_pages_version();
+    std::vector<MemoryRange>* code_pages = isolate->GetCodePages();
+
+    DCHECK_NOT_NULL(code_pages);
+
+    // Copy as many elements into the output vector as we can. If the
+    // caller-provided buffer is not big enough, we fill it, and the caller
+    // can provide a bigger one next time. We do it this way because
+    // allocation is not allowed in signal handlers.
+    const MemoryRange* pages = code_pages->data();
+    size_t size = code_pages->size();
+    size_t limit = std::min(capacity, size);
+    for (size_t i = 0; i < limit; i++) {
+      code_pages_out[i] = pages[i];
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (version == isolate->code_pages_version()) return size;
   }
-  return code_pages->size();
+  return 0;
 #endif
 }
 
+size_t Isolate::GetCodePagesVersion() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  return isolate->code_pages_version();
+}
+
 #define CALLBACK_SETTER(ExternalName, Type, InternalName)      \
   void Isolate::Set##ExternalName(Type callback) {             \
     i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this); \
@@ -10086,7 +10341,16 @@ const size_t HandleScopeImplementer::kEnteredContextsOffset =
 const size_t HandleScopeImplementer::kIsMicrotaskContextOffset =
     offsetof(HandleScopeImplementer, is_microtask_context_);
 
-void HandleScopeImplementer::FreeThreadResources() { Free(); }
+void HandleScopeImplementer::FreeThreadResources() {
+  // The backing stores and the spare block are not tied to the thread that
+  // used them, so keep them for the next thread that locks the isolate. This
+  // way moving an isolate between threads does not reallocate them.
+  DCHECK(blocks_.empty());
+  DCHECK(entered_contexts_.empty());
+  DCHECK(is_microtask_context_.empty());
+  DCHECK(saved_contexts_.empty());
+  DCHECK(isolate_->thread_local_top()->CallDepthIsZero());
+}
 
 char* HandleScopeImplementer::ArchiveThread(char* storage) {
   HandleScopeData* current = isolate_->handle_scope_data();
@@ -10104,6 +10368,8 @@ int HandleScopeImplementer::ArchiveSpacePerThread() {
 }
 
 char* HandleScopeImplementer::RestoreThread(char* storage) {
+  // Drop whatever FreeThreadResources kept before it is overwritten.
+  Free();
   MemCopy(this, storage, sizeof(*this));
   *isolate_->handle_scope_data() = handle_scope_data_;
   return storage + ArchiveSpacePerThread();
@@ -10234,10 +10500,10 @@ void InvokeFunctionCallback(const v8::FunctionCallbackInfo<v8::Value>& info,
   callback(info);
 }
 
-void InvokeFinalizationRegistryCleanupFromTask(
+bool InvokeFinalizationRegistryCleanupFromTask(
     Handle<Context> context,
     Handle<JSFinalizationRegistry> finalization_registry,
-    Handle<Object> callback) {
+    Handle<Object> callback, int max_cells) {
   Isolate* isolate = finalization_registry->native_context().GetIsolate();
   RCS_SCOPE(isolate,
             RuntimeCallCounterId::kFinalizationRegistryCleanupFromTask);
@@ -10245,17 +10511,19 @@ void InvokeFinalizationRegistryCleanupFromTask(
   // FinalizationRegistryCleanupTask within V8 and we should not log it as an
   // API call. This method is implemented here to avoid duplication of the
   // exception handling and microtask running logic in CallDepthScope.
-  if (IsExecutionTerminatingCheck(isolate)) return;
+  if (IsExecutionTerminatingCheck(isolate)) return false;
   Local<v8::Context> api_context = Utils::ToLocal(context);
   CallDepthScope<true> call_depth_scope(isolate, api_context);
   VMState<OTHER> state(isolate);
-  Handle<Object> argv[] = {callback};
+  Handle<Object> argv[] = {callback, handle(Smi::FromInt(max_cells), isolate)};
   if (Execution::CallBuiltin(isolate,
-                             isolate->finalization_registry_cleanup_some(),
+                             isolate->finalization_registry_cleanup_slice(),
                              finalization_registry, arraysize(argv), argv)
           .is_null()) {
     call_depth_scope.Escape();
+    return false;
   }
+  return true;
 }
 
 // Undefine macros for jumbo build.
@@ -410,7 +410,6 @@ class HandleScopeImplementer {
       DeleteArray(spare_);
       spare_ = nullptr;
     }
-    DCHECK(isolate_->thread_local_top()->CallDepthIsZero());
   }
 
   void BeginDeferredScope();
@@ -531,10 +530,13 @@ void InvokeAccessorGetterCallback(
 void InvokeFunctionCallback(const v8::FunctionCallbackInfo<v8::Value>& info,
                             v8::FunctionCallback callback);
 
-void InvokeFinalizationRegistryCleanupFromTask(
+// Calls {callback} for at most {max_cells} cleared cells of
+// {finalization_registry}. Returns false if execution is terminating or the
+// callback threw.
+bool InvokeFinalizationRegistryCleanupFromTask(
     Handle<Context> context,
     Handle<JSFinalizationRegistry> finalization_registry,
-    Handle<Object> callback);
+    Handle<Object> callback, int max_cells);
 
 }  // namespace internal
 }  // namespace v8
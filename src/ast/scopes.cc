@@ -2057,6 +2057,12 @@ Variable* Scope::Lookup(VariableProxy* proxy, Scope* scope,
                               force_context_allocation);
     }
 
+    if (mode == kParsedScope && outer_scope_end == nullptr &&
+        scope->is_function_scope() &&
+        scope->AsDeclarationScope()->outer_lookup_cache_ != nullptr) {
+      return scope->AsDeclarationScope()->LookupInOuterScopes(proxy);
+    }
+
     force_context_allocation |= scope->is_function_scope();
     scope = scope->outer_scope_;
 
@@ -2182,6 +2188,35 @@ Variable* Scope::LookupSloppyEval(VariableProxy* proxy, Scope* scope,
   return var;
 }
 
+void DeclarationScope::InitializeOuterLookupCache() {
+  DCHECK(is_function_scope());
+  DCHECK_NULL(outer_lookup_cache_);
+  for (Scope* scope = outer_scope_; scope != nullptr;
+       scope = scope->outer_scope_) {
+    if (!scope->scope_info_.is_null() || scope->is_with_scope() ||
+        scope->is_eval_scope() || scope->is_debug_evaluate_scope_) {
+      return;
+    }
+    if (scope->is_declaration_scope() &&
+        scope->AsDeclarationScope()->sloppy_eval_can_extend_vars()) {
+      return;
+    }
+  }
+  outer_lookup_cache_ = zone()->New<VariableMap>(zone());
+}
+
+Variable* DeclarationScope::LookupInOuterScopes(VariableProxy* proxy) {
+  Variable* var = outer_lookup_cache_->Lookup(proxy->raw_name());
+  if (var != nullptr) return var;
+  // Variables found outside of a function scope are always context
+  // allocated, so this lookup has the same effect for every proxy.
+  var = Lookup<kParsedScope>(proxy, outer_scope_, nullptr, nullptr, true);
+  DCHECK_NOT_NULL(var);
+  DCHECK_EQ(var->raw_name(), proxy->raw_name());
+  outer_lookup_cache_->Add(var);
+  return var;
+}
+
 void Scope::ResolveVariable(VariableProxy* proxy) {
   DCHECK(!proxy->is_resolved());
   Variable* var = Lookup<kParsedScope>(proxy, this, nullptr);
@@ -2284,6 +2319,10 @@ bool Scope::ResolveVariablesRecursively(Scope* end) {
       ResolvePreparsedVariable(proxy, outer_scope(), end);
     }
   } else {
+    if (FLAG_scope_lookup_cache && is_function_scope()) {
+      AsDeclarationScope()->InitializeOuterLookupCache();
+    }
+
     // Resolve unresolved variables for this scope.
     for (VariableProxy* proxy : unresolved_list_) {
       ResolveVariable(proxy);
@@ -1331,6 +1331,18 @@ class V8_EXPORT_PRIVATE DeclarationScope : public Scope {
   }
 
   RareData* rare_data_ = nullptr;
+
+  friend class Scope;
+
+  // With --scope-lookup-cache, function scopes whose outer scopes are all
+  // parsed scopes without 'with' or sloppy 'eval' cache the variables that
+  // names resolve to outside of them during variable resolution. Every
+  // lookup that leaves such a function resolves a given name to the same
+  // variable, so the outer scope chain only has to be walked once per name.
+  void InitializeOuterLookupCache();
+  Variable* LookupInOuterScopes(VariableProxy* proxy);
+
+  VariableMap* outer_lookup_cache_ = nullptr;
 };
 
 void Scope::RecordEvalCall() {
@@ -907,6 +907,9 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return ptr;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 // static
 bool OS::HasLazyCommits() {
   // TODO(alph): implement for the platform.
@@ -300,6 +300,10 @@ class V8_BASE_EXPORT OS {
   V8_WARN_UNUSED_RESULT static bool DiscardSystemPages(void* address,
                                                        size_t size);
 
+  // Hints the OS to back the given region with huge pages. Returns false if
+  // not supported on the platform.
+  static bool AdviseHugePages(void* address, size_t size);
+
   static const int msPerSecond = 1000;
 
 #if V8_OS_POSIX
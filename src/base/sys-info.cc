@@ -18,6 +18,12 @@
 #include <sys/sysctl.h>
 #endif
 
+#if V8_OS_LINUX
+#include <sched.h>
+#include <stdio.h>
+#endif
+
+#include <algorithm>
 #include <limits>
 
 #include "src/base/logging.h"
@@ -115,5 +121,68 @@ int64_t SysInfo::AmountOfVirtualMemory() {
 #endif
 }
 
+#if V8_OS_LINUX
+namespace {
+
+// Parses a sysfs list of ranges like "0-3,8-11" and calls |callback| with each
+// number in it. Returns false if the file can't be read.
+template <typename Callback>
+bool ForEachInSysfsList(const char* path, Callback callback) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) return false;
+  int first, last;
+  while (fscanf(file, "%d", &first) == 1) {
+    last = first;
+    int c = fgetc(file);
+    if (c == '-') {
+      if (fscanf(file, "%d", &last) != 1) break;
+      c = fgetc(file);
+    }
+    for (int i = first; i <= last; i++) callback(i);
+    if (c != ',') break;
+  }
+  fclose(file);
+  return true;
+}
+
+}  // namespace
+#endif  // V8_OS_LINUX
+
+// static
+int SysInfo::NumberOfNumaNodes() {
+  return std::max(1, static_cast<int>(OnlineNumaNodes().size()));
+}
+
+// static
+std::vector<int> SysInfo::OnlineNumaNodes() {
+  std::vector<int> nodes;
+#if V8_OS_LINUX
+  ForEachInSysfsList("/sys/devices/system/node/online",
+                     [&](int node) { nodes.push_back(node); });
+#endif
+  return nodes;
+}
+
+// static
+bool SysInfo::SetCurrentThreadNumaNode(int node) {
+#if V8_OS_LINUX
+  char path[64];
+  snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist",
+           node);
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  int count = 0;
+  bool found = ForEachInSysfsList(path, [&](int cpu) {
+    if (cpu >= CPU_SETSIZE) return;
+    CPU_SET(cpu, &cpus);
+    count++;
+  });
+  if (!found || count == 0) return false;
+  return sched_setaffinity(0, sizeof(cpus), &cpus) == 0;
+#else
+  return false;
+#endif
+}
+
 }  // namespace base
 }  // namespace v8
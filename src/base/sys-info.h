@@ -7,6 +7,8 @@
 
 #include <stdint.h>
 
+#include <vector>
+
 #include "src/base/base-export.h"
 #include "src/base/compiler-specific.h"
 
@@ -24,6 +26,19 @@ class V8_BASE_EXPORT SysInfo final {
   // Returns the number of bytes of virtual memory of this process. A return
   // value of zero means that there is no limit on the available virtual memory.
   static int64_t AmountOfVirtualMemory();
+
+  // Returns the number of online NUMA nodes on the current machine, or 1 if
+  // that is not known.
+  static int NumberOfNumaNodes();
+
+  // Returns the ids of the online NUMA nodes on the current machine in
+  // ascending order. The ids need not be contiguous. Returns an empty vector
+  // if that is not known.
+  static std::vector<int> OnlineNumaNodes();
+
+  // Restricts the current thread to the processors of NUMA node |node|.
+  // Returns false if that is not supported on the current machine.
+  static bool SetCurrentThreadNumaNode(int node);
 };
 
 }  // namespace base
@@ -31,7 +31,22 @@ void ProcessorImpl::Multiply(RWDigits Z, Digits X, Digits Y) {
   if (X.len() < Y.len()) std::swap(X, Y);
   if (Y.len() == 1) return MultiplySingle(Z, X, Y[0]);
   if (Y.len() < kKaratsubaThreshold) return MultiplySchoolbook(Z, X, Y);
-  return MultiplyKaratsuba(Z, X, Y);
+  if (Y.len() < kToomThreshold) return MultiplyKaratsuba(Z, X, Y);
+  if (Y.len() < kFftThreshold) return MultiplyToomCook(Z, X, Y);
+  return MultiplyFFT(Z, X, Y);
+}
+
+// Barrett division only pays off for large divisors. Computing the
+// reciprocal costs a few multiplications of the divisor's size, which is
+// amortized when the quotient is considerably longer than the divisor, or
+// when the divisor is very large. Quotients that are much shorter than the
+// divisor are computed from the top digits of the operands alone, without
+// a reciprocal of the full divisor.
+static bool ShouldUseBarrett(Digits A, Digits B) {
+  if (B.len() < kBarrettThreshold) return false;
+  if (B.len() >= kBarrettBalancedThreshold) return true;
+  int quotient_len = A.len() - B.len();
+  return quotient_len <= B.len() / 2 || quotient_len >= 2 * B.len();
 }
 
 void ProcessorImpl::Divide(RWDigits Q, Digits A, Digits B) {
@@ -49,6 +64,9 @@ void ProcessorImpl::Divide(RWDigits Q, Digits A, Digits B) {
     digit_t remainder;
     return DivideSingle(Q, &remainder, A, B[0]);
   }
+  if (ShouldUseBarrett(A, B)) {
+    return DivideBarrett(Q, RWDigits(nullptr, 0), A, B);
+  }
   return DivideSchoolbook(Q, RWDigits(nullptr, 0), A, B);
 }
 
@@ -70,9 +88,37 @@ void ProcessorImpl::Modulo(RWDigits R, Digits A, Digits B) {
     for (int i = 1; i < R.len(); i++) R[i] = 0;
     return;
   }
+  if (ShouldUseBarrett(A, B)) {
+    return DivideBarrett(RWDigits(nullptr, 0), R, A, B);
+  }
   return DivideSchoolbook(RWDigits(nullptr, 0), R, A, B);
 }
 
+// Computes both Q := A / B and R := A % B. Q needs at least
+// DivideResultLength(A, B) digits, R needs at least B.len() digits.
+void ProcessorImpl::DivideWithRemainder(RWDigits Q, RWDigits R, Digits A,
+                                        Digits B) {
+  A.Normalize();
+  B.Normalize();
+  DCHECK(B.len() > 0);  // NOLINT(readability/check)
+  if (Compare(A, B) < 0) {
+    Q.Clear();
+    int i = 0;
+    for (; i < A.len(); i++) R[i] = A[i];
+    for (; i < R.len(); i++) R[i] = 0;
+    return;
+  }
+  if (B.len() == 1) {
+    digit_t remainder;
+    DivideSingle(Q, &remainder, A, B[0]);
+    R[0] = remainder;
+    for (int i = 1; i < R.len(); i++) R[i] = 0;
+    return;
+  }
+  if (ShouldUseBarrett(A, B)) return DivideBarrett(Q, R, A, B);
+  return DivideSchoolbook(Q, R, A, B);
+}
+
 Status Processor::Multiply(RWDigits Z, Digits X, Digits Y) {
   ProcessorImpl* impl = static_cast<ProcessorImpl*>(this);
   impl->Multiply(Z, X, Y);
@@ -91,5 +137,19 @@ Status Processor::Modulo(RWDigits R, Digits A, Digits B) {
   return impl->get_and_clear_status();
 }
 
+Status Processor::ToString(char* out, int* out_length, Digits X, int radix,
+                           bool sign) {
+  ProcessorImpl* impl = static_cast<ProcessorImpl*>(this);
+  impl->ToString(out, out_length, X, radix, sign);
+  return impl->get_and_clear_status();
+}
+
+Status Processor::FromStringParts(RWDigits Z, Digits parts,
+                                  digit_t multiplier) {
+  ProcessorImpl* impl = static_cast<ProcessorImpl*>(this);
+  impl->FromStringParts(Z, parts, multiplier);
+  return impl->get_and_clear_status();
+}
+
 }  // namespace bigint
 }  // namespace v8
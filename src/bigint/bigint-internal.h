@@ -12,7 +12,23 @@
 namespace v8 {
 namespace bigint {
 
+// The crossover points between the algorithms, in digits of the shorter
+// operand (for multiplication) or of the divisor (for division). These were
+// determined with "bigint_shell --benchmark" on x64.
 constexpr int kKaratsubaThreshold = 34;
+constexpr int kToomThreshold = 193;
+constexpr int kFftThreshold = 2500;
+constexpr int kFftMinLog2Length = 4;
+// Models the cost of the pointwise multiplications when choosing the FFT
+// parameters, see {FftParameters}.
+constexpr double kFftPointwiseExponent = 1.5;
+constexpr int kNewtonInversionThreshold = 50;
+constexpr int kBarrettThreshold = 500;
+constexpr int kBarrettBalancedThreshold = 2000;
+// For conversions to and from strings, in digits of the BigInt and in
+// parts of the parsed string, respectively.
+constexpr int kToStringFastThreshold = 43;
+constexpr int kFromStringFastThreshold = 64;
 
 class ProcessorImpl : public Processor {
  public:
@@ -30,13 +46,38 @@ class ProcessorImpl : public Processor {
   void KaratsubaChunk(RWDigits Z, Digits X, Digits Y, RWDigits scratch);
   void KaratsubaMain(RWDigits Z, Digits X, Digits Y, RWDigits scratch, int n);
 
+  void MultiplyToomCook(RWDigits Z, Digits X, Digits Y);
+  void Toom3Main(RWDigits Z, Digits X, Digits Y);
+  void Toom3Evaluate(Digits X0, Digits X1, Digits X2, RWDigits P1,
+                     RWDigits Pm1, bool* pm1_negative, RWDigits Pm2,
+                     bool* pm2_negative);
+
+  void MultiplyFFT(RWDigits Z, Digits X, Digits Y);
+  void FftParameters(int x_len, int y_len, int* m, int* s, int* k);
+  void FftForward(RWDigits A, int m, int k, RWDigits temp, RWDigits scratch);
+  void FftBackward(RWDigits A, int m, int k, RWDigits temp, RWDigits scratch);
+
   void Divide(RWDigits Q, Digits A, Digits B);
   void DivideSingle(RWDigits Q, digit_t* remainder, Digits A, digit_t b);
   void DivideSchoolbook(RWDigits Q, RWDigits R, Digits A, Digits B);
 
+  void DivideBarrett(RWDigits Q, RWDigits R, Digits A, Digits B);
+  void DivideBarrett(RWDigits Q, RWDigits R, Digits A, Digits B, int shift,
+                     Digits I);
+  void DivideShortQuotient(RWDigits Q, RWDigits R, Digits A, Digits B);
+  void DivideBarrettStep(RWDigits Q, RWDigits R, Digits A, Digits B, Digits I,
+                         RWDigits scratch);
+  void InvertNewton(RWDigits Z, Digits V);
+  void InvertCorrection(RWDigits X, Digits V);
+
   void Modulo(RWDigits R, Digits A, Digits B);
+  void DivideWithRemainder(RWDigits Q, RWDigits R, Digits A, Digits B);
+
+  void ToString(char* out, int* out_length, Digits X, int radix, bool sign);
+
+  void FromStringParts(RWDigits Z, Digits parts, digit_t multiplier);
+  void FromStringClassic(RWDigits Z, Digits parts, digit_t multiplier);
 
- private:
   // Each unit is supposed to represent approximately one CPU {mul} instruction.
   // Doesn't need to be accurate; we just want to make sure to check for
   // interrupt requests every now and then (roughly every 10-100 ms; often
@@ -56,6 +97,7 @@ class ProcessorImpl : public Processor {
 
   bool should_terminate() { return status_ == Status::kInterrupted; }
 
+ private:
   uintptr_t work_estimate_{0};
   Status status_{Status::kOk};
   Platform* platform_;
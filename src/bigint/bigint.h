@@ -240,6 +240,19 @@ class Processor {
   Status Divide(RWDigits Q, Digits A, Digits B);
   // R := A % B
   Status Modulo(RWDigits R, Digits A, Digits B);
+
+  // Writes the string representation of X in the given {radix} (2..36) to
+  // {out}. {out_length} must initially contain the capacity of {out}, which
+  // must be at least ToStringResultLength(X, radix, sign); it is set to the
+  // actual length of the string. X must not be zero.
+  Status ToString(char* out, int* out_length, Digits X, int radix, bool sign);
+
+  // Z := sum(parts[i] * multiplier^i), i.e. computes the value of a string
+  // that has been parsed into little-endian {parts} of several characters
+  // each, where every part is smaller than {multiplier}. Z must be large
+  // enough for the result; FromStringPartsResultLength(parts, multiplier)
+  // digits always are.
+  Status FromStringParts(RWDigits Z, Digits parts, digit_t multiplier);
 };
 
 inline int MultiplyResultLength(Digits X, Digits Y) {
@@ -250,6 +263,23 @@ inline int DivideResultLength(Digits A, Digits B) {
 }
 inline int ModuloResultLength(Digits B) { return B.len(); }
 
+// Overestimates the number of characters of X in the given radix, using
+// the number of whole bits that a character can represent.
+inline int ToStringResultLength(Digits X, int radix, bool sign) {
+  X.Normalize();
+  int min_bits_per_char = 1;
+  while ((2 << min_bits_per_char) <= radix) min_bits_per_char++;
+  int bit_length = X.len() * kDigitBits;
+  return (bit_length + min_bits_per_char - 1) / min_bits_per_char + sign;
+}
+inline int FromStringPartsResultLength(Digits parts, digit_t multiplier) {
+  int bits_per_part = 0;
+  while (bits_per_part < kDigitBits && (multiplier >> bits_per_part) != 0) {
+    bits_per_part++;
+  }
+  return (parts.len() * bits_per_part + kDigitBits - 1) / kDigitBits + 1;
+}
+
 }  // namespace bigint
 }  // namespace v8
 
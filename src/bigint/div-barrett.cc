@@ -0,0 +1,281 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Barrett division, using a reciprocal of the divisor computed with Newton's
+// method. This makes division about as fast as a few multiplications of the
+// same size, so it benefits from the fast multiplication algorithms.
+// Reference: Brent & Zimmermann, "Modern Computer Arithmetic", sections
+// 2.4.1 (Barrett's algorithm) and 3.4.1 (Newton's method for the
+// reciprocal).
+
+#include <algorithm>
+
+#include "src/bigint/bigint-internal.h"
+#include "src/bigint/digit-arithmetic.h"
+#include "src/bigint/div-helpers.h"
+#include "src/bigint/util.h"
+#include "src/bigint/vector-arithmetic.h"
+
+namespace v8 {
+namespace bigint {
+
+namespace {
+
+// X := X + 1.
+void Increment(RWDigits X) {
+  digit_t carry = 1;
+  for (int i = 0; carry != 0 && i < X.len(); i++) {
+    X[i] = digit_add2(X[i], carry, &carry);
+  }
+  DCHECK(carry == 0);  // NOLINT(readability/check)
+}
+
+// X := X - 1.
+void Decrement(RWDigits X) {
+  digit_t borrow = 1;
+  for (int i = 0; borrow != 0 && i < X.len(); i++) {
+    X[i] = digit_sub(X[i], borrow, &borrow);
+  }
+  DCHECK(borrow == 0);  // NOLINT(readability/check)
+}
+
+}  // namespace
+
+// Turns an approximation X of (b^(2n) - 1) / V (where b is the digit base
+// and n == V.len()) into its exact floor. X must have n + 1 digits.
+void ProcessorImpl::InvertCorrection(RWDigits X, Digits V) {
+  const int n = V.len();
+  ScratchDigits P(2 * n + 2);
+  ScratchDigits R(2 * n + 2);
+  Multiply(P, V, X);
+  if (should_terminate()) return;
+  // R := b^(2n) - 1 - V * X, which is all-one digits minus P.
+  for (int i = 0; i < 2 * n; i++) R[i] = ~digit_t{0};
+  R[2 * n] = 0;
+  R[2 * n + 1] = 0;
+  bool r_negative = SubtractSigned(R, R, false, P, false);
+  while (r_negative) {
+    Decrement(X);
+    r_negative = AddSigned(R, R, true, V, false);
+  }
+  while (GreaterThanOrEqual(R, V)) {
+    Increment(X);
+    Subtract(R, R, V);
+  }
+}
+
+// Computes Z := floor((b^(2n) - 1) / V), where b is the digit base and
+// n == V.len(). V must be bit-normalized, i.e. its top bit must be set;
+// then Z has n + 1 digits, the top one being 0 or 1.
+void ProcessorImpl::InvertNewton(RWDigits Z, Digits V) {
+  const int n = V.len();
+  DCHECK(Z.len() >= n + 1);
+  DCHECK(V.msd() >> (kDigitBits - 1) == 1);
+  if (n < kNewtonInversionThreshold) {
+    // Base case: plain division.
+    ScratchDigits all_ones(2 * n);
+    for (int i = 0; i < 2 * n; i++) all_ones[i] = ~digit_t{0};
+    RWDigits Q(Z, 0, n + 1);
+    if (n == 1) {
+      digit_t remainder;
+      DivideSingle(Q, &remainder, all_ones, V[0]);
+    } else {
+      DivideSchoolbook(Q, RWDigits(nullptr, 0), all_ones, V);
+    }
+    for (int i = n + 1; i < Z.len(); i++) Z[i] = 0;
+    return;
+  }
+
+  // Invert the top h digits of V; with two guard digits, one Newton step
+  // then roughly doubles the number of correct digits to more than n.
+  const int h = n / 2 + 2;
+  Digits V_high(V, n - h, h);
+  ScratchDigits I_high(h + 1);
+  InvertNewton(I_high, V_high);
+  if (should_terminate()) return;
+
+  // X0 := I_high * b^(n - h) approximates b^(2n) / V.
+  RWDigits X(Z, 0, n + 1);
+  for (int i = 0; i < n - h; i++) X[i] = 0;
+  for (int i = 0; i <= h; i++) X[n - h + i] = I_high[i];
+
+  // Newton step: X1 := X0 + X0 * (b^(2n) - V * X0) / b^(2n). Because of the
+  // shape of X0, this is X0 + I_high * E / b^(2h) with
+  // E := b^(n+h) - V * I_high, and E is only about h digits long, so this
+  // is much cheaper than multiplying the full-length values.
+  ScratchDigits P(n + h + 2);
+  Multiply(P, V, I_high);
+  if (should_terminate()) return;
+  ScratchDigits E(n + h + 2);
+  E.Clear();
+  E[n + h] = 1;
+  bool e_negative = SubtractSigned(E, E, false, P, false);
+  Digits e = E;
+  e.Normalize();
+  ScratchDigits IE(h + 1 + e.len());
+  Multiply(IE, I_high, e);
+  if (should_terminate()) return;
+  Digits correction(IE, 2 * h, IE.len());
+  if (e_negative) {
+    SubAt(X, correction);
+  } else {
+    AddAt(X, correction);
+  }
+
+  // Fix the last few digits.
+  InvertCorrection(X, V);
+  for (int i = n + 1; i < Z.len(); i++) Z[i] = 0;
+}
+
+// Computes one quotient block Q := floor(A / B) and R := A mod B, given the
+// reciprocal I == InvertNewton(B). Requires A < B * b^n, where n == B.len(),
+// so that the quotient fits into n digits. Q needs n + 1 digits, of which
+// the top one will be zero, R needs n digits. {scratch} needs at least
+// 6n + 3 digits.
+void ProcessorImpl::DivideBarrettStep(RWDigits Q, RWDigits R, Digits A,
+                                      Digits B, Digits I, RWDigits scratch) {
+  const int n = B.len();
+  // Q := floor(floor(A / b^(n-1)) * I / b^(n+1)). This underestimates the
+  // quotient by at most 2.
+  Digits A_high = A + std::min(A.len(), n - 1);
+  RWDigits QI(scratch, 0, 2 * n + 2);
+  Multiply(QI, A_high, I);
+  if (should_terminate()) return;
+  Digits Q_estimate(QI, n + 1, n + 1);
+  int i = 0;
+  for (; i < Q_estimate.len(); i++) Q[i] = Q_estimate[i];
+  for (; i < Q.len(); i++) Q[i] = 0;
+
+  // R := A - Q * B.
+  RWDigits QB(scratch, 2 * n + 2, 2 * n + 1);
+  Multiply(QB, Q, B);
+  if (should_terminate()) return;
+  RWDigits remainder(scratch, 4 * n + 3, 2 * n);
+  Subtract(remainder, A, QB);
+  while (GreaterThanOrEqual(remainder, B)) {
+    Increment(Q);
+    Subtract(remainder, remainder, B);
+  }
+  for (i = 0; i < n; i++) R[i] = remainder[i];
+  for (; i < remainder.len(); i++) {
+    DCHECK(remainder[i] == 0);  // NOLINT(readability/check)
+  }
+}
+
+// Division with a quotient that is much shorter than the divisor. The
+// quotient then mostly depends on the top digits of A and B: dividing them
+// gives an estimate that is off by at most a few units, which is corrected
+// by computing the remainder with a single (unbalanced) multiplication.
+void ProcessorImpl::DivideShortQuotient(RWDigits Q, RWDigits R, Digits A,
+                                        Digits B) {
+  const int n = B.len();
+  const int q_len = A.len() - n + 1;
+  // Two guard digits keep the estimate within a few units.
+  const int t = q_len + 2;
+  DCHECK(t < n);
+  Digits A_top(A, n - t, A.len() - (n - t));
+  Digits B_top(B, n - t, t);
+  ScratchDigits q(q_len + 1);
+  ScratchDigits unused_remainder(t);
+  DivideWithRemainder(q, unused_remainder, A_top, B_top);
+  if (should_terminate()) return;
+
+  // remainder := A - q * B, then correct q until 0 <= remainder < B.
+  ScratchDigits QB(q.len() + n);
+  Multiply(QB, q, B);
+  if (should_terminate()) return;
+  ScratchDigits remainder(QB.len());
+  bool r_negative = SubtractSigned(remainder, A, false, QB, false);
+  while (r_negative) {
+    Decrement(q);
+    r_negative = AddSigned(remainder, remainder, true, B, false);
+  }
+  while (GreaterThanOrEqual(remainder, B)) {
+    Increment(q);
+    Subtract(remainder, remainder, B);
+  }
+  if (Q.len() != 0) {
+    int i = 0;
+    for (; i < q_len; i++) Q[i] = q[i];
+    DCHECK(q[q_len] == 0);  // NOLINT(readability/check)
+    for (; i < Q.len(); i++) Q[i] = 0;
+  }
+  if (R.len() != 0) {
+    int i = 0;
+    for (; i < n; i++) R[i] = remainder[i];
+    for (; i < R.len(); i++) R[i] = 0;
+  }
+}
+
+// Computes Q(uotient) and R(emainder) for A/B, such that
+// Q = (A - R) / B, with 0 <= R < B. Like for DivideSchoolbook, both Q and R
+// are optional, and need at least A.len - B.len + 1 and B.len digits.
+void ProcessorImpl::DivideBarrett(RWDigits Q, RWDigits R, Digits A, Digits B) {
+  DCHECK(B.len() >= kBarrettThreshold);
+  DCHECK(A.len() >= B.len());
+  DCHECK(Q.len() == 0 || Q.len() >= A.len() - B.len() + 1);
+  DCHECK(R.len() == 0 || R.len() >= B.len());
+  const int n = B.len();
+  if (A.len() - n + 3 < n) return DivideShortQuotient(Q, R, A, B);
+
+  ShiftedDigits b_normalized(B);
+  ScratchDigits I(n + 1);
+  InvertNewton(I, b_normalized);
+  if (should_terminate()) return;
+  DivideBarrett(Q, R, A, b_normalized, b_normalized.shift(), I);
+}
+
+// Same as above, for a divisor B that has already been bit-normalized by
+// a left shift by {shift} bits, and whose reciprocal I == InvertNewton(B)
+// is known. This is useful for dividing many numbers by the same divisor.
+void ProcessorImpl::DivideBarrett(RWDigits Q, RWDigits R, Digits A, Digits B,
+                                  int shift, Digits I) {
+  DCHECK(B.msd() >> (kDigitBits - 1) == 1);
+  DCHECK(Q.len() == 0 || Q.len() >= A.len() - B.len() + 1);
+  DCHECK(R.len() == 0 || R.len() >= B.len());
+  const int n = B.len();
+
+  // Shift the dividend like the divisor.
+  ScratchDigits A_shifted(A.len() + 1);
+  LeftShift(A_shifted, A, shift);
+  Digits A_normalized = A_shifted;
+  A_normalized.Normalize();
+
+  // Divide the dividend block by block, from the most significant end, like
+  // long division with base b^n: each block together with the remainder so
+  // far is less than B * b^n.
+  ScratchDigits current(2 * n);
+  ScratchDigits q(n + 1);
+  ScratchDigits remainder(n);
+  remainder.Clear();
+  ScratchDigits scratch(6 * n + 3);
+  if (Q.len() != 0) Q.Clear();
+  const int num_blocks = std::max(1, DIV_CEIL(A_normalized.len(), n));
+  for (int block = num_blocks - 1; block >= 0; block--) {
+    Digits chunk(A_normalized, block * n, n);
+    int i = 0;
+    for (; i < chunk.len(); i++) current[i] = chunk[i];
+    for (int j = 0; j < n; j++) current[i++] = remainder[j];
+    for (; i < current.len(); i++) current[i] = 0;
+    RWDigits current_view(current, 0, chunk.len() + n);
+    DivideBarrettStep(q, remainder, current_view, B, I, scratch);
+    if (should_terminate()) return;
+    if (Q.len() != 0) {
+      for (int j = 0; j < chunk.len(); j++) {
+        int pos = block * n + j;
+        if (pos < Q.len()) {
+          Q[pos] = q[j];
+        } else {
+          DCHECK(q[j] == 0);  // NOLINT(readability/check)
+        }
+      }
+    }
+  }
+  if (R.len() != 0) {
+    RightShift(R, Digits(remainder, 0, n), shift);
+  }
+}
+
+}  // namespace bigint
+}  // namespace v8
@@ -0,0 +1,134 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Conversion of parsed strings to BigInts. The caller splits the string
+// into parts of a fixed number of characters, each of which fits into a
+// digit. Few parts are combined by multiply-adding them one by one. Many
+// parts are combined recursively: the upper and lower half are converted
+// separately, and combined with a single multiplication by a precomputed
+// power multiplier^(2^level). That makes the conversion about as fast as
+// a few multiplications of the full result size.
+
+#include <vector>
+
+#include "src/bigint/bigint-internal.h"
+#include "src/bigint/digit-arithmetic.h"
+#include "src/bigint/vector-arithmetic.h"
+
+namespace v8 {
+namespace bigint {
+
+namespace {
+
+class FromStringConverter {
+ public:
+  FromStringConverter(ProcessorImpl* processor, digit_t multiplier)
+      : processor_(processor), multiplier_(multiplier) {}
+
+  // Computes powers_[i] := multiplier^(2^i), up to the level that splits
+  // {num_parts} parts into two halves, and returns that level.
+  int ComputePowers(int num_parts) {
+    powers_.reserve(32);
+    powers_.emplace_back(1);
+    powers_[0][0] = multiplier_;
+    int level = 0;
+    while ((2 << level) < num_parts) {
+      Digits last = powers_.back();
+      last.Normalize();
+      powers_.emplace_back(2 * last.len());
+      processor_->Multiply(powers_.back(), last, last);
+      if (processor_->should_terminate()) return level;
+      level++;
+    }
+    return level;
+  }
+
+  // The number of digits that the result for 2^(level + 1) parts needs.
+  int ResultLength(int level) {
+    Digits power = powers_[level];
+    power.Normalize();
+    return 2 * power.len();
+  }
+
+  // Converts {parts}, of which there are at most 2^(level + 1). Z must have
+  // at least ResultLength(level) digits.
+  void Recursive(RWDigits Z, Digits parts, int level) {
+    if (level == 0 || parts.len() < kFromStringFastThreshold) {
+      return processor_->FromStringClassic(Z, parts, multiplier_);
+    }
+    const int half = 1 << level;
+    if (parts.len() <= half) return Recursive(Z, parts, level - 1);
+    Digits low_parts(parts, 0, half);
+    Digits high_parts(parts, half, parts.len() - half);
+    ScratchDigits low(ResultLength(level - 1));
+    Recursive(low, low_parts, level - 1);
+    if (processor_->should_terminate()) return;
+    ScratchDigits high(ResultLength(level - 1));
+    Recursive(high, high_parts, level - 1);
+    if (processor_->should_terminate()) return;
+    // Z := high * multiplier^half + low.
+    Digits power = powers_[level];
+    processor_->Multiply(Z, high, power);
+    if (processor_->should_terminate()) return;
+    AddAt(Z, low);
+  }
+
+ private:
+  ProcessorImpl* processor_;
+  const digit_t multiplier_;
+  std::vector<ScratchDigits> powers_;
+};
+
+}  // namespace
+
+// Multiply-adds the parts into Z one by one, starting with the most
+// significant one.
+void ProcessorImpl::FromStringClassic(RWDigits Z, Digits parts,
+                                      digit_t multiplier) {
+  int len = 0;
+  for (int i = parts.len() - 1; i >= 0; i--) {
+    digit_t carry = parts[i];
+    for (int j = 0; j < len; j++) {
+      digit_t high;
+      digit_t low = digit_mul(Z[j], multiplier, &high);
+      Z[j] = digit_add2(low, carry, &carry);
+      carry += high;
+    }
+    if (carry != 0) {
+      DCHECK(len < Z.len());
+      Z[len++] = carry;
+    }
+    AddWorkEstimate(len);
+    if (should_terminate()) return;
+  }
+  for (int j = len; j < Z.len(); j++) Z[j] = 0;
+}
+
+void ProcessorImpl::FromStringParts(RWDigits Z, Digits parts,
+                                    digit_t multiplier) {
+  DCHECK(multiplier > 1);
+  parts.Normalize();
+  if (parts.len() < kFromStringFastThreshold) {
+    return FromStringClassic(Z, parts, multiplier);
+  }
+  FromStringConverter converter(this, multiplier);
+  int level = converter.ComputePowers(parts.len());
+  if (should_terminate()) return;
+  int result_length = converter.ResultLength(level);
+  if (Z.len() >= result_length) {
+    return converter.Recursive(Z, parts, level);
+  }
+  // {ResultLength} can overestimate slightly.
+  ScratchDigits result(result_length);
+  converter.Recursive(result, parts, level);
+  if (should_terminate()) return;
+  int i = 0;
+  for (; i < Z.len(); i++) Z[i] = result[i];
+  for (; i < result.len(); i++) {
+    DCHECK(result[i] == 0);  // NOLINT(readability/check)
+  }
+}
+
+}  // namespace bigint
+}  // namespace v8
@@ -0,0 +1,272 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// FFT-based multiplication, due to Schönhage and Strassen.
+// The inputs are cut into chunks of {s} digits, which are the coefficients
+// of two polynomials. These are multiplied by transforming them with an FFT
+// of length L = 2^m over the ring of integers modulo F = 2^K + 1, where
+// 2 is a (2K)-th root of unity, so all multiplications by roots of unity
+// are just shifts. K is chosen so that the coefficients of the product
+// polynomial fit into the ring without ambiguity; they are then added up to
+// form the product.
+// Reference: Crandall & Pomerance, "Prime Numbers: A Computational
+// Perspective", section 9.5.6.
+
+#include <algorithm>
+#include <cmath>
+
+#include "src/bigint/bigint-internal.h"
+#include "src/bigint/digit-arithmetic.h"
+#include "src/bigint/div-helpers.h"
+#include "src/bigint/util.h"
+#include "src/bigint/vector-arithmetic.h"
+
+namespace v8 {
+namespace bigint {
+
+namespace {
+
+// Elements of the ring are stored in (k + 1) digits, where K = k * kDigitBits.
+// Values are kept in the range [0, 2^K], i.e. the top digit is 0 or 1, and
+// if it is 1, all other digits are 0.
+
+// Computes Z := (low K bits of T) - (T >> K) mod F, which is T mod F if
+// T >> K <= 2^K. T must have at least 2k + 1 digits.
+void ReduceModF(RWDigits Z, Digits T, int k) {
+  digit_t borrow = 0;
+  int i = 0;
+  for (; i < k; i++) {
+    Z[i] = digit_sub2(T[i], T[i + k], borrow, &borrow);
+  }
+  Z[k] = digit_sub2(0, T[2 * k], borrow, &borrow);
+  if (borrow != 0) {
+    // The result is negative, add F. Carries out of the top digit are
+    // dropped, which undoes the wraparound of the subtraction.
+    digit_t carry = 1;
+    for (i = 0; i < k && carry != 0; i++) {
+      Z[i] = digit_add2(Z[i], carry, &carry);
+    }
+    Z[k] = Z[k] + 1 + carry;
+  }
+}
+
+// Z := A + B mod F. Z may alias A or B.
+void AddModF(RWDigits Z, Digits A, Digits B, int k) {
+  digit_t carry = 0;
+  for (int i = 0; i <= k; i++) {
+    Z[i] = digit_add3(A[i], B[i], carry, &carry);
+  }
+  // The sum is at most 2^(K+1), so the top digit is at most 2.
+  digit_t top = Z[k];
+  if (top == 0) return;
+  Z[k] = 0;
+  // Since 2^K == -1 mod F, subtract the top digit from the rest.
+  digit_t borrow = top;
+  for (int i = 0; i < k && borrow != 0; i++) {
+    Z[i] = digit_sub(Z[i], borrow, &borrow);
+  }
+  if (borrow != 0) {
+    // Wrapped around: add F. The low k digits are all-ones or close to it,
+    // adding 1 carries through them into the top digit.
+    digit_t add_carry = 1;
+    for (int i = 0; i < k && add_carry != 0; i++) {
+      Z[i] = digit_add2(Z[i], add_carry, &add_carry);
+    }
+    Z[k] = add_carry;
+  }
+}
+
+// Z := A - B mod F. Z may alias A or B.
+void SubtractModF(RWDigits Z, Digits A, Digits B, int k) {
+  digit_t borrow = 0;
+  for (int i = 0; i <= k; i++) {
+    Z[i] = digit_sub2(A[i], B[i], borrow, &borrow);
+  }
+  if (borrow != 0) {
+    // Add F, dropping the carry out of the top digit.
+    digit_t carry = 1;
+    for (int i = 0; i < k && carry != 0; i++) {
+      Z[i] = digit_add2(Z[i], carry, &carry);
+    }
+    Z[k] = Z[k] + 1 + carry;
+  }
+}
+
+// Z := A * 2^shift mod F, for 0 <= shift < 2K. {scratch} must have at least
+// 2k + 2 digits. Z may alias A.
+void ShiftModF(RWDigits Z, Digits A, int shift, int k, RWDigits scratch) {
+  const int K = k * kDigitBits;
+  bool negate = false;
+  if (shift >= K) {
+    negate = true;
+    shift -= K;
+  }
+  const int digit_shift = shift / kDigitBits;
+  const int bit_shift = shift % kDigitBits;
+  for (int i = 0; i < digit_shift; i++) scratch[i] = 0;
+  LeftShift(scratch + digit_shift, Digits(A, 0, k + 1), bit_shift);
+  ReduceModF(Z, scratch, k);
+  if (!negate) return;
+  // Z := F - Z, unless Z is zero.
+  bool is_zero = true;
+  for (int i = 0; i <= k; i++) {
+    if (Z[i] != 0) {
+      is_zero = false;
+      break;
+    }
+  }
+  if (is_zero) return;
+  digit_t borrow = 0;
+  Z[0] = digit_sub2(1, Z[0], borrow, &borrow);
+  for (int i = 1; i < k; i++) Z[i] = digit_sub2(0, Z[i], borrow, &borrow);
+  Z[k] = 1 - Z[k] - borrow;
+}
+
+}  // namespace
+
+// Chooses the transform length 2^m, the chunk size s and the element size
+// k for multiplying inputs with {x_len} and {y_len} digits.
+void ProcessorImpl::FftParameters(int x_len, int y_len, int* m_out, int* s_out,
+                                  int* k_out) {
+  const int z_len = x_len + y_len;
+  double best_cost = 0;
+  for (int m = kFftMinLog2Length;; m++) {
+    const int L = 1 << m;
+    // Cut the inputs into chunks such that the product has at most L
+    // coefficients.
+    int s = DIV_CEIL(z_len, L - 1);
+    while (DIV_CEIL(x_len, s) + DIV_CEIL(y_len, s) - 1 > L) s++;
+    // Each coefficient of the product is a sum of at most L products of two
+    // chunks, so it needs 2 * s digits plus m bits. K must also be a
+    // multiple of L / 2 so that 2^(2K / L) is an L-th root of unity.
+    const int k_unit = std::max(1, L / (2 * kDigitBits));
+    const int k = RoundUp(2 * s + 1, k_unit);
+    // This is a rough model: the three transforms cost O(L * m * k), the
+    // pointwise multiplications are fast but not linear.
+    double cost = static_cast<double>(L) *
+                  (3.0 * m * (k + 1) + std::pow(k + 1, kFftPointwiseExponent));
+    if (m == kFftMinLog2Length || cost < best_cost) {
+      best_cost = cost;
+      *m_out = m;
+      *s_out = s;
+      *k_out = k;
+    }
+    if (s == 1 || cost > 2 * best_cost) break;
+  }
+}
+
+// Forward transform (decimation in frequency). Takes the coefficients in
+// natural order and leaves the transformed values in bit-reversed order.
+void ProcessorImpl::FftForward(RWDigits A, int m, int k, RWDigits temp,
+                               RWDigits scratch) {
+  const int L = 1 << m;
+  const int n = k + 1;
+  // The L-th root of unity, as a power of two.
+  const int omega_shift = 2 * k * kDigitBits / L;
+  for (int len = L; len >= 2; len >>= 1) {
+    const int half = len >> 1;
+    const int stride = omega_shift * (L / len);
+    for (int start = 0; start < L; start += len) {
+      for (int j = 0; j < half; j++) {
+        RWDigits a(A, (start + j) * n, n);
+        RWDigits b(A, (start + j + half) * n, n);
+        SubtractModF(temp, a, b, k);
+        AddModF(a, a, b, k);
+        ShiftModF(b, temp, j * stride, k, scratch);
+      }
+    }
+    AddWorkEstimate(static_cast<uintptr_t>(L) * n);
+    if (should_terminate()) return;
+  }
+}
+
+// Inverse transform (decimation in time), without the final division by L.
+// Takes the values in bit-reversed order and leaves the coefficients in
+// natural order.
+void ProcessorImpl::FftBackward(RWDigits A, int m, int k, RWDigits temp,
+                                RWDigits scratch) {
+  const int L = 1 << m;
+  const int n = k + 1;
+  const int two_K = 2 * k * kDigitBits;
+  const int omega_shift = two_K / L;
+  for (int len = 2; len <= L; len <<= 1) {
+    const int half = len >> 1;
+    const int stride = omega_shift * (L / len);
+    for (int start = 0; start < L; start += len) {
+      for (int j = 0; j < half; j++) {
+        RWDigits a(A, (start + j) * n, n);
+        RWDigits b(A, (start + j + half) * n, n);
+        // Multiply by the inverse root of unity: 2^-e == 2^(2K - e).
+        int shift = j == 0 ? 0 : two_K - j * stride;
+        ShiftModF(temp, b, shift, k, scratch);
+        SubtractModF(b, a, temp, k);
+        AddModF(a, a, temp, k);
+      }
+    }
+    AddWorkEstimate(static_cast<uintptr_t>(L) * n);
+    if (should_terminate()) return;
+  }
+}
+
+// Cuts X into L chunks of s digits, each stored as a ring element.
+static void FftSplit(RWDigits A, Digits X, int L, int s, int k) {
+  const int n = k + 1;
+  for (int i = 0; i < L; i++) {
+    Digits chunk(X, i * s, s);
+    RWDigits element(A, i * n, n);
+    int j = 0;
+    for (; j < chunk.len(); j++) element[j] = chunk[j];
+    for (; j < n; j++) element[j] = 0;
+  }
+}
+
+void ProcessorImpl::MultiplyFFT(RWDigits Z, Digits X, Digits Y) {
+  DCHECK(X.len() >= Y.len());
+  DCHECK(Y.len() >= kFftThreshold);
+  DCHECK(Z.len() >= X.len() + Y.len());
+  int m, s, k;
+  FftParameters(X.len(), Y.len(), &m, &s, &k);
+  const int L = 1 << m;
+  const int n = k + 1;
+  ScratchDigits temp(n);
+  ScratchDigits scratch(2 * n);
+  ScratchDigits product(2 * n);
+
+  ScratchDigits A(L * n);
+  FftSplit(A, X, L, s, k);
+  FftForward(A, m, k, temp, scratch);
+  if (should_terminate()) return;
+  // Squaring only needs one forward transform.
+  const bool squaring = X == Y;
+  ScratchDigits B(squaring ? 0 : L * n);
+  if (!squaring) {
+    FftSplit(B, Y, L, s, k);
+    FftForward(B, m, k, temp, scratch);
+    if (should_terminate()) return;
+  }
+
+  // Pointwise multiplication.
+  for (int i = 0; i < L; i++) {
+    RWDigits a(A, i * n, n);
+    Digits b = squaring ? Digits(a) : Digits(B, i * n, n);
+    Multiply(product, a, b);
+    if (should_terminate()) return;
+    ReduceModF(a, product, k);
+  }
+
+  FftBackward(A, m, k, temp, scratch);
+  if (should_terminate()) return;
+
+  // Divide by L (i.e. multiply by 2^(2K - m)) and add up the coefficients.
+  const int shift = 2 * k * kDigitBits - m;
+  Z.Clear();
+  for (int i = 0; i < L && i * s < Z.len(); i++) {
+    RWDigits a(A, i * n, n);
+    ShiftModF(temp, a, shift, k, scratch);
+    AddAt(Z + i * s, temp);
+  }
+}
+
+}  // namespace bigint
+}  // namespace v8
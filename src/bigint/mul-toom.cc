@@ -0,0 +1,170 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Toom-Cook multiplication.
+// Reference: https://en.wikipedia.org/wiki/Toom%E2%80%93Cook_multiplication
+// The evaluation points and the interpolation sequence are the ones
+// proposed by Marco Bodrato, see "Towards Optimal Toom-Cook Multiplication
+// for Univariate and Multivariate Polynomials in Characteristic 2 and 0".
+
+#include <algorithm>
+
+#include "src/bigint/bigint-internal.h"
+#include "src/bigint/digit-arithmetic.h"
+#include "src/bigint/util.h"
+#include "src/bigint/vector-arithmetic.h"
+
+namespace v8 {
+namespace bigint {
+
+namespace {
+
+// X := X * 2.
+void TimesTwo(RWDigits X) {
+  digit_t carry = 0;
+  for (int i = 0; i < X.len(); i++) {
+    digit_t d = X[i];
+    X[i] = (d << 1) | carry;
+    carry = d >> (kDigitBits - 1);
+  }
+  DCHECK(carry == 0);  // NOLINT(readability/check)
+}
+
+// X := X / 2. The division must be exact.
+void DivideByTwo(RWDigits X) {
+  digit_t carry = 0;
+  for (int i = X.len() - 1; i >= 0; i--) {
+    digit_t d = X[i];
+    X[i] = (d >> 1) | carry;
+    carry = d << (kDigitBits - 1);
+  }
+  DCHECK(carry == 0);  // NOLINT(readability/check)
+}
+
+// X := X / 3. The division must be exact.
+void DivideByThree(RWDigits X) {
+  digit_t remainder = 0;
+  for (int i = X.len() - 1; i >= 0; i--) {
+    X[i] = digit_div(remainder, X[i], 3, &remainder);
+  }
+  DCHECK(remainder == 0);  // NOLINT(readability/check)
+}
+
+}  // namespace
+
+// Computes the values of the polynomial with coefficients X0, X1, X2 at
+// 1, -1 and -2. The results need (part_length + 1) digits each.
+void ProcessorImpl::Toom3Evaluate(Digits X0, Digits X1, Digits X2, RWDigits P1,
+                                  RWDigits Pm1, bool* pm1_negative,
+                                  RWDigits Pm2, bool* pm2_negative) {
+  // P1 temporarily holds X0 + X2.
+  Add(P1, X0, X2);
+  *pm1_negative = SubtractSigned(Pm1, P1, false, X1, false);
+  Add(P1, P1, X1);
+  *pm2_negative = AddSigned(Pm2, Pm1, *pm1_negative, X2, false);
+  TimesTwo(Pm2);
+  *pm2_negative = SubtractSigned(Pm2, Pm2, *pm2_negative, X0, false);
+}
+
+// Toom-Cook-3 for inputs of similar length.
+void ProcessorImpl::Toom3Main(RWDigits Z, Digits X, Digits Y) {
+  DCHECK(Z.len() >= X.len() + Y.len());
+  // Each of X and Y is split into three parts of {i} digits; the
+  // evaluations at 1, -1, -2 need one extra digit, their products two.
+  const int i = DIV_CEIL(std::max(X.len(), Y.len()), 3);
+  const int p_len = i + 1;
+  const int r_len = 2 * p_len;
+  Digits X0(X, 0, i);
+  Digits X1(X, i, i);
+  Digits X2(X, 2 * i, i);
+  Digits Y0(Y, 0, i);
+  Digits Y1(Y, i, i);
+  Digits Y2(Y, 2 * i, i);
+
+  // Evaluation.
+  ScratchDigits P1(p_len);
+  ScratchDigits Pm1(p_len);
+  ScratchDigits Pm2(p_len);
+  bool pm1_neg, pm2_neg;
+  Toom3Evaluate(X0, X1, X2, P1, Pm1, &pm1_neg, Pm2, &pm2_neg);
+  ScratchDigits Q1(p_len);
+  ScratchDigits Qm1(p_len);
+  ScratchDigits Qm2(p_len);
+  bool qm1_neg, qm2_neg;
+  Toom3Evaluate(Y0, Y1, Y2, Q1, Qm1, &qm1_neg, Qm2, &qm2_neg);
+
+  // Pointwise multiplication. r(0) and r(inf) are written to their final
+  // positions in Z right away.
+  RWDigits R0(Z, 0, 2 * i);
+  Multiply(R0, X0, Y0);
+  if (should_terminate()) return;
+  RWDigits R4(Z, 4 * i, Z.len() - 4 * i);
+  Multiply(R4, X2, Y2);
+  if (should_terminate()) return;
+  for (int j = 2 * i; j < std::min(4 * i, Z.len()); j++) Z[j] = 0;
+  ScratchDigits R1(r_len);
+  Multiply(R1, P1, Q1);
+  if (should_terminate()) return;
+  ScratchDigits Rm1(r_len);
+  Multiply(Rm1, Pm1, Qm1);
+  if (should_terminate()) return;
+  bool rm1_neg = pm1_neg != qm1_neg;
+  ScratchDigits Rm2(r_len);
+  Multiply(Rm2, Pm2, Qm2);
+  if (should_terminate()) return;
+  bool rm2_neg = pm2_neg != qm2_neg;
+
+  // Interpolation.
+  // r3 := (r(-2) - r(1)) / 3
+  bool r3_neg = SubtractSigned(Rm2, Rm2, rm2_neg, R1, false);
+  DivideByThree(Rm2);
+  // r1 := (r(1) - r(-1)) / 2
+  bool r1_neg = SubtractSigned(R1, R1, false, Rm1, rm1_neg);
+  DivideByTwo(R1);
+  // r2 := r(-1) - r(0)
+  bool r2_neg = SubtractSigned(Rm1, Rm1, rm1_neg, R0, false);
+  // r3 := (r2 - r3) / 2 + 2 * r(inf)
+  r3_neg = SubtractSigned(Rm2, Rm1, r2_neg, Rm2, r3_neg);
+  DivideByTwo(Rm2);
+  r3_neg = AddSigned(Rm2, Rm2, r3_neg, R4, false);
+  r3_neg = AddSigned(Rm2, Rm2, r3_neg, R4, false);
+  // r2 := r2 + r1 - r(inf)
+  r2_neg = AddSigned(Rm1, Rm1, r2_neg, R1, r1_neg);
+  r2_neg = SubtractSigned(Rm1, Rm1, r2_neg, R4, false);
+  // r1 := r1 - r3
+  r1_neg = SubtractSigned(R1, R1, r1_neg, Rm2, r3_neg);
+
+  // The coefficients of the product polynomial are never negative. Add the
+  // remaining ones to Z.
+  DCHECK(!r1_neg);
+  DCHECK(!r2_neg);
+  DCHECK(!r3_neg);
+  AddAt(Z + i, R1);
+  AddAt(Z + 2 * i, Rm1);
+  AddAt(Z + 3 * i, Rm2);
+}
+
+// Entry point for Toom-Cook multiplication: X is cut into chunks of Y's
+// length, each of which is multiplied with Y using Toom3Main.
+void ProcessorImpl::MultiplyToomCook(RWDigits Z, Digits X, Digits Y) {
+  DCHECK(X.len() >= Y.len());
+  DCHECK(Y.len() >= kToomThreshold);
+  DCHECK(Z.len() >= X.len() + Y.len());
+  const int k = Y.len();
+  Digits X0(X, 0, k);
+  Toom3Main(Z, X0, Y);
+  if (should_terminate()) return;
+  if (X.len() > k) {
+    ScratchDigits T(2 * k);
+    for (int i = k; i < X.len(); i += k) {
+      Digits Xi(X, i, k);
+      Multiply(T, Xi, Y);
+      if (should_terminate()) return;
+      AddAt(Z + i, T);
+    }
+  }
+}
+
+}  // namespace bigint
+}  // namespace v8
@@ -0,0 +1,202 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Conversion of BigInts to strings. Small inputs are converted by repeatedly
+// dividing by the largest power of the radix that fits into a digit. Large
+// inputs are split recursively by dividing by precomputed powers
+// radix^(chunk_chars * 2^level) of about half their size, which makes the
+// conversion about as fast as a division of the full input.
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "src/bigint/bigint-internal.h"
+#include "src/bigint/digit-arithmetic.h"
+#include "src/bigint/div-helpers.h"
+#include "src/bigint/util.h"
+
+namespace v8 {
+namespace bigint {
+
+namespace {
+
+constexpr char kConversionChars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+class ToStringFormatter {
+ public:
+  ToStringFormatter(ProcessorImpl* processor, int radix, char* out,
+                    int capacity)
+      : processor_(processor),
+        radix_(radix),
+        out_start_(out),
+        out_end_(out + capacity),
+        out_(out_end_) {
+    // Find the largest power of the radix that fits into a digit.
+    chunk_divisor_ = static_cast<digit_t>(radix);
+    chunk_chars_ = 1;
+    while (chunk_divisor_ <= ~digit_t{0} / radix) {
+      chunk_divisor_ *= radix;
+      chunk_chars_++;
+    }
+  }
+
+  // Writes the characters of X to the end of the output buffer. Returns
+  // a pointer to the first character.
+  char* Format(Digits X) {
+    X.Normalize();
+    if (X.len() < kToStringFastThreshold) {
+      Classic(X, 0);
+    } else {
+      int level = ComputePowers(X);
+      if (processor_->should_terminate()) return out_;
+      Recursive(X, level, 0);
+    }
+    // Padding of the top parts can leave leading zeros.
+    while (out_ < out_end_ - 1 && *out_ == '0') out_++;
+    return out_;
+  }
+
+  void WriteSign() { Write('-'); }
+
+ private:
+  void Write(char c) {
+    DCHECK(out_ > out_start_);
+    *(--out_) = c;
+  }
+
+  // Writes X as at least {width} characters, padding with zeros.
+  void Classic(Digits X, int width) {
+    char* const end = out_;
+    X.Normalize();
+    if (X.len() > 0) {
+      ScratchDigits rest_storage(X.len());
+      RWDigits rest = rest_storage;
+      Digits dividend = X;
+      while (true) {
+        digit_t chunk;
+        processor_->DivideSingle(rest, &chunk, dividend, chunk_divisor_);
+        rest.Normalize();
+        dividend = rest;
+        if (rest.len() == 0) {
+          // Last chunk, write only its significant characters.
+          for (; chunk != 0; chunk /= radix_) {
+            Write(kConversionChars[chunk % radix_]);
+          }
+          break;
+        }
+        for (int i = 0; i < chunk_chars_; i++) {
+          Write(kConversionChars[chunk % radix_]);
+          chunk /= radix_;
+        }
+        DCHECK(chunk == 0);  // NOLINT(readability/check)
+        // Each round is a single-digit division of the rest.
+        processor_->AddWorkEstimate(rest.len());
+        if (processor_->should_terminate()) return;
+      }
+    }
+    while (end - out_ < width) Write('0');
+  }
+
+  // Writes X, which must be less than powers_[level + 1], as at least
+  // {width} characters.
+  void Recursive(Digits X, int level, int width) {
+    X.Normalize();
+    if (level < 0 || X.len() < kToStringFastThreshold) {
+      return Classic(X, width);
+    }
+    Digits divisor = powers_[level];
+    divisor.Normalize();
+    // The low part is padded to the full number of characters that
+    // powers_[level] covers.
+    const int low_width = chunk_chars_ << level;
+    const int high_width = width == 0 ? 0 : width - low_width;
+    if (Compare(X, divisor) < 0) {
+      return Recursive(X, level - 1, width);
+    }
+    ScratchDigits quotient(DivideResultLength(X, divisor));
+    ScratchDigits remainder(divisor.len());
+    Divide(quotient, remainder, X, level);
+    if (processor_->should_terminate()) return;
+    Recursive(remainder, level - 1, low_width);
+    if (processor_->should_terminate()) return;
+    Recursive(quotient, level - 1, high_width);
+  }
+
+  // Divides X by powers_[level]. All divisions on the same level use the
+  // same divisor, so for Barrett division, its reciprocal is computed only
+  // once.
+  void Divide(RWDigits Q, RWDigits R, Digits X, int level) {
+    Digits divisor = powers_[level];
+    divisor.Normalize();
+    if (divisor.len() < kBarrettThreshold) {
+      return processor_->DivideWithRemainder(Q, R, X, divisor);
+    }
+    if (inverses_.size() <= static_cast<size_t>(level)) {
+      normalized_powers_.resize(level + 1);
+      inverses_.resize(level + 1);
+    }
+    if (!inverses_[level]) {
+      normalized_powers_[level].reset(new ShiftedDigits(divisor));
+      inverses_[level].reset(new ScratchDigits(divisor.len() + 1));
+      processor_->InvertNewton(*inverses_[level], *normalized_powers_[level]);
+      if (processor_->should_terminate()) return;
+    }
+    ShiftedDigits& normalized = *normalized_powers_[level];
+    processor_->DivideBarrett(Q, R, X, normalized, normalized.shift(),
+                              *inverses_[level]);
+  }
+
+  // Computes powers_[i] := chunk_divisor ^ (2^i) until the next one would
+  // be larger than X, and returns the index of the last one.
+  int ComputePowers(Digits X) {
+    powers_.reserve(32);
+    powers_.emplace_back(1);
+    powers_[0][0] = chunk_divisor_;
+    while (true) {
+      Digits last = powers_.back();
+      last.Normalize();
+      // X < b^X.len() <= b^(2 * last.len() - 2) <= last^2.
+      if (2 * last.len() - 2 >= X.len()) break;
+      powers_.emplace_back(2 * last.len());
+      processor_->Multiply(powers_.back(), last, last);
+      if (processor_->should_terminate()) break;
+    }
+    return static_cast<int>(powers_.size()) - 1;
+  }
+
+  ProcessorImpl* processor_;
+  const int radix_;
+  char* const out_start_;
+  char* const out_end_;
+  char* out_;
+  digit_t chunk_divisor_;
+  int chunk_chars_;
+  std::vector<ScratchDigits> powers_;
+  std::vector<std::unique_ptr<ShiftedDigits>> normalized_powers_;
+  std::vector<std::unique_ptr<ScratchDigits>> inverses_;
+};
+
+}  // namespace
+
+void ProcessorImpl::ToString(char* out, int* out_length, Digits X, int radix,
+                             bool sign) {
+  DCHECK(radix >= 2 && radix <= 36);
+  X.Normalize();
+  DCHECK(X.len() > 0);  // NOLINT(readability/check)
+  ToStringFormatter formatter(this, radix, out, *out_length);
+  char* start = formatter.Format(X);
+  if (should_terminate()) return;
+  if (sign) {
+    formatter.WriteSign();
+    start--;
+  }
+  // The string was written right-aligned; move it to the front.
+  int length = static_cast<int>(out + *out_length - start);
+  memmove(out, start, length);
+  *out_length = length;
+}
+
+}  // namespace bigint
+}  // namespace v8
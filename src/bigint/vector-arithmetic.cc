@@ -53,5 +53,67 @@ digit_t SubtractAndReturnBorrow(RWDigits Z, Digits X, Digits Y) {
   return borrow;
 }
 
+void Add(RWDigits Z, Digits X, Digits Y) {
+  X.Normalize();
+  Y.Normalize();
+  if (X.len() < Y.len()) std::swap(X, Y);
+  DCHECK(Z.len() >= X.len());
+  digit_t carry = 0;
+  int i = 0;
+  for (; i < Y.len(); i++) {
+    Z[i] = digit_add3(X[i], Y[i], carry, &carry);
+  }
+  for (; i < X.len(); i++) {
+    Z[i] = digit_add2(X[i], carry, &carry);
+  }
+  if (i < Z.len()) {
+    Z[i++] = carry;
+  } else {
+    DCHECK(carry == 0);  // NOLINT(readability/check)
+  }
+  for (; i < Z.len(); i++) Z[i] = 0;
+}
+
+void Subtract(RWDigits Z, Digits X, Digits Y) {
+  X.Normalize();
+  Y.Normalize();
+  DCHECK(GreaterThanOrEqual(X, Y));
+  DCHECK(Z.len() >= X.len());
+  digit_t borrow = 0;
+  int i = 0;
+  for (; i < Y.len(); i++) {
+    Z[i] = digit_sub2(X[i], Y[i], borrow, &borrow);
+  }
+  for (; i < X.len(); i++) {
+    Z[i] = digit_sub(X[i], borrow, &borrow);
+  }
+  DCHECK(borrow == 0);  // NOLINT(readability/check)
+  for (; i < Z.len(); i++) Z[i] = 0;
+}
+
+bool AddSigned(RWDigits Z, Digits X, bool x_negative, Digits Y,
+               bool y_negative) {
+  if (x_negative == y_negative) {
+    Add(Z, X, Y);
+    return x_negative;
+  }
+  int cmp = Compare(X, Y);
+  if (cmp == 0) {
+    Z.Clear();
+    return false;
+  }
+  if (cmp > 0) {
+    Subtract(Z, X, Y);
+    return x_negative;
+  }
+  Subtract(Z, Y, X);
+  return !x_negative;
+}
+
+bool SubtractSigned(RWDigits Z, Digits X, bool x_negative, Digits Y,
+                    bool y_negative) {
+  return AddSigned(Z, X, x_negative, Y, !y_negative);
+}
+
 }  // namespace bigint
 }  // namespace v8
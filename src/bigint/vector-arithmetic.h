@@ -23,6 +23,20 @@ void SubAt(RWDigits Z, Digits X);
 digit_t AddAndReturnCarry(RWDigits Z, Digits X, Digits Y);
 digit_t SubtractAndReturnBorrow(RWDigits Z, Digits X, Digits Y);
 
+// Z := X + Y. Z must be long enough to hold the result; its remaining digits
+// are cleared. Z may be the same as X or Y.
+void Add(RWDigits Z, Digits X, Digits Y);
+// Z := X - Y. Requires X >= Y. Z may be the same as X or Y.
+void Subtract(RWDigits Z, Digits X, Digits Y);
+
+// Signed variants of the above: X and Y are magnitudes with the given signs.
+// These return whether the result is negative (a zero result is positive);
+// Z holds its magnitude.
+bool AddSigned(RWDigits Z, Digits X, bool x_negative, Digits Y,
+               bool y_negative);
+bool SubtractSigned(RWDigits Z, Digits X, bool x_negative, Digits Y,
+                    bool y_negative);
+
 inline bool IsDigitNormalized(Digits X) { return X.len() == 0 || X.msd() != 0; }
 
 inline bool GreaterThanOrEqual(Digits A, Digits B) {
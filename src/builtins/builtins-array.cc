@@ -1541,6 +1541,7 @@ BUILTIN(ArrayConcat) {
     if (isolate->has_pending_exception())
       return ReadOnlyRoots(isolate).exception();
   }
+  isolate->counters()->array_concat_slow()->Increment();
   return Slow_ArrayConcat(&args, species, isolate);
 }
 
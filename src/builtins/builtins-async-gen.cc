@@ -30,28 +30,6 @@ TNode<Object> AsyncBuiltinsAssembler::AwaitOld(
     TNode<Oddball> is_predicted_as_caught) {
   const TNode<NativeContext> native_context = LoadNativeContext(context);
 
-  static const int kClosureContextSize =
-      FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
-  TNode<Context> closure_context =
-      UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
-  {
-    // Initialize the await context, storing the {generator} as extension.
-    TNode<Map> map = CAST(
-        LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
-    StoreMapNoWriteBarrier(closure_context, map);
-    StoreObjectFieldNoWriteBarrier(
-        closure_context, Context::kLengthOffset,
-        SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
-    const TNode<Object> empty_scope_info =
-        LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
-    StoreContextElementNoWriteBarrier(
-        closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
-    StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
-                                      native_context);
-    StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
-                                      generator);
-  }
-
   // Let promiseCapability be ! NewPromiseCapability(%Promise%).
   const TNode<JSFunction> promise_fun =
       CAST(LoadContextElement(native_context, Context::PROMISE_FUNCTION_INDEX));
@@ -78,17 +56,12 @@ TNode<Object> AsyncBuiltinsAssembler::AwaitOld(
     PromiseInit(promise);
   }
 
-  // Allocate and initialize resolve handler
-  TNode<HeapObject> on_resolve =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_resolve,
-                          on_resolve_sfi);
-
-  // Allocate and initialize reject handler
-  TNode<HeapObject> on_reject =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_reject,
-                          on_reject_sfi);
+  TVARIABLE(JSFunction, var_on_resolve);
+  TVARIABLE(JSFunction, var_on_reject);
+  LoadOrAllocateAwaitClosures(native_context, generator, on_resolve_sfi,
+                              on_reject_sfi, &var_on_resolve, &var_on_reject);
+  const TNode<JSFunction> on_resolve = var_on_resolve.value();
+  const TNode<JSFunction> on_reject = var_on_reject.value();
 
   TVARIABLE(HeapObject, var_throwaway, UndefinedConstant());
 
@@ -117,39 +90,12 @@ TNode<Object> AsyncBuiltinsAssembler::AwaitOptimized(
   // We skip this step, because promise is already guaranteed to be a
   // JSPRomise at this point.
 
-  static const int kClosureContextSize =
-      FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
-  TNode<Context> closure_context =
-      UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
-  {
-    // Initialize the await context, storing the {generator} as extension.
-    TNode<Map> map = CAST(
-        LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
-    StoreMapNoWriteBarrier(closure_context, map);
-    StoreObjectFieldNoWriteBarrier(
-        closure_context, Context::kLengthOffset,
-        SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
-    const TNode<Object> empty_scope_info =
-        LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
-    StoreContextElementNoWriteBarrier(
-        closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
-    StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
-                                      native_context);
-    StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
-                                      generator);
-  }
-
-  // Allocate and initialize resolve handler
-  TNode<HeapObject> on_resolve =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_resolve,
-                          on_resolve_sfi);
-
-  // Allocate and initialize reject handler
-  TNode<HeapObject> on_reject =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_reject,
-                          on_reject_sfi);
+  TVARIABLE(JSFunction, var_on_resolve);
+  TVARIABLE(JSFunction, var_on_reject);
+  LoadOrAllocateAwaitClosures(native_context, generator, on_resolve_sfi,
+                              on_reject_sfi, &var_on_resolve, &var_on_reject);
+  const TNode<JSFunction> on_resolve = var_on_resolve.value();
+  const TNode<JSFunction> on_reject = var_on_reject.value();
 
   TVARIABLE(HeapObject, var_throwaway, UndefinedConstant());
 
@@ -161,6 +107,85 @@ TNode<Object> AsyncBuiltinsAssembler::AwaitOptimized(
                      on_resolve, on_reject, var_throwaway.value());
 }
 
+void AsyncBuiltinsAssembler::LoadOrAllocateAwaitClosures(
+    TNode<NativeContext> native_context, TNode<JSGeneratorObject> generator,
+    TNode<SharedFunctionInfo> on_resolve_sfi,
+    TNode<SharedFunctionInfo> on_reject_sfi,
+    TVariable<JSFunction>* var_on_resolve,
+    TVariable<JSFunction>* var_on_reject) {
+  Label if_cache(this), allocate(this), done(this);
+  TVARIABLE(BoolT, var_cache, Int32FalseConstant());
+  GotoIfNot(HasInstanceType(generator, JS_ASYNC_FUNCTION_OBJECT_TYPE),
+            &allocate);
+  GotoIf(IsIsolatePromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
+         &allocate);
+  const TNode<Object> cached_on_resolve = LoadObjectField(
+      generator, JSAsyncFunctionObject::kAwaitResolveClosureOffset);
+  GotoIf(IsUndefined(cached_on_resolve), &if_cache);
+  CSA_ASSERT(this,
+             TaggedEqual(LoadObjectField(CAST(cached_on_resolve),
+                                         JSFunction::kSharedFunctionInfoOffset),
+                         on_resolve_sfi));
+  *var_on_resolve = CAST(cached_on_resolve);
+  *var_on_reject = LoadObjectField<JSFunction>(
+      generator, JSAsyncFunctionObject::kAwaitRejectClosureOffset);
+  Goto(&done);
+
+  BIND(&if_cache);
+  var_cache = Int32TrueConstant();
+  Goto(&allocate);
+
+  BIND(&allocate);
+  {
+    static const int kClosureContextSize =
+        FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
+    TNode<Context> closure_context =
+        UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
+    {
+      // Initialize the await context, storing the {generator} as extension.
+      TNode<Map> map = CAST(
+          LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
+      StoreMapNoWriteBarrier(closure_context, map);
+      StoreObjectFieldNoWriteBarrier(
+          closure_context, Context::kLengthOffset,
+          SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
+      const TNode<Object> empty_scope_info =
+          LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
+      StoreContextElementNoWriteBarrier(
+          closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
+      StoreContextElementNoWriteBarrier(
+          closure_context, Context::PREVIOUS_INDEX, native_context);
+      StoreContextElementNoWriteBarrier(
+          closure_context, Context::EXTENSION_INDEX, generator);
+    }
+
+    // Allocate and initialize resolve handler
+    TNode<HeapObject> on_resolve =
+        AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
+    InitializeNativeClosure(closure_context, native_context, on_resolve,
+                            on_resolve_sfi);
+
+    // Allocate and initialize reject handler
+    TNode<HeapObject> on_reject =
+        AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
+    InitializeNativeClosure(closure_context, native_context, on_reject,
+                            on_reject_sfi);
+
+    *var_on_resolve = CAST(on_resolve);
+    *var_on_reject = CAST(on_reject);
+    GotoIfNot(var_cache.value(), &done);
+    StoreObjectField(generator,
+                     JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+                     on_resolve);
+    StoreObjectField(generator,
+                     JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+                     on_reject);
+    Goto(&done);
+  }
+
+  BIND(&done);
+}
+
 void AsyncBuiltinsAssembler::InitAwaitPromise(
     Runtime::FunctionId id, TNode<Context> context, TNode<Object> value,
     TNode<Object> promise, TNode<Object> outer_promise,
@@ -202,7 +227,7 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     TNode<SharedFunctionInfo> on_reject_sfi,
     TNode<Oddball> is_predicted_as_caught) {
   TVARIABLE(Object, result);
-  Label if_old(this), if_new(this), done(this),
+  Label if_old(this), if_new(this), if_primitive(this), done(this),
       if_slow_constructor(this, Label::kDeferred);
 
   // We do the `PromiseResolve(%Promise%,value)` avoiding to unnecessarily
@@ -210,9 +235,10 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   // intrinsics %Promise% constructor as its "constructor", we don't need
   // to allocate the wrapper promise and can just use the `AwaitOptimized`
   // logic.
-  GotoIf(TaggedIsSmi(value), &if_old);
+  GotoIf(TaggedIsSmi(value), &if_primitive);
   TNode<HeapObject> value_object = CAST(value);
   const TNode<Map> value_map = LoadMap(value_object);
+  GotoIfNot(IsJSReceiverMap(value_map), &if_primitive);
   GotoIfNot(IsJSPromiseMap(value_map), &if_old);
   // We can skip the "constructor" lookup on {value} if it's [[Prototype]]
   // is the (initial) Promise.prototype and the @@species protector is
@@ -237,6 +263,22 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     Branch(TaggedEqual(value_constructor, promise_function), &if_new, &if_old);
   }
 
+  // Values that are not JSReceivers cannot be thenables, so the wrapper
+  // promise would be fulfilled right away. Unless promise hooks or the
+  // debugger need to see it, skip the wrapper and enqueue its reaction job.
+  BIND(&if_primitive);
+  {
+    GotoIf(NeedsAnyPromiseHooks(), &if_old);
+    TVARIABLE(JSFunction, var_on_resolve);
+    TVARIABLE(JSFunction, var_on_reject);
+    LoadOrAllocateAwaitClosures(LoadNativeContext(context), generator,
+                                on_resolve_sfi, on_reject_sfi, &var_on_resolve,
+                                &var_on_reject);
+    result = CallBuiltin(Builtin::kEnqueueAwaitFulfillReactionJob, context,
+                         value, var_on_resolve.value());
+    Goto(&done);
+  }
+
   BIND(&if_old);
   result = AwaitOld(context, generator, value, outer_promise, on_resolve_sfi,
                     on_reject_sfi, is_predicted_as_caught);
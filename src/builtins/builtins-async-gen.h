@@ -49,6 +49,17 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
   TNode<Context> AllocateAsyncIteratorValueUnwrapContext(
       TNode<NativeContext> native_context, TNode<Oddball> done);
 
+  // Returns the closures that resume {generator} after an await in
+  // {var_on_resolve} and {var_on_reject}. They only depend on the
+  // {generator}, so async function objects keep them for later awaits,
+  // unless the debugger or promise hooks are active, which may tag them.
+  void LoadOrAllocateAwaitClosures(
+      TNode<NativeContext> native_context, TNode<JSGeneratorObject> generator,
+      TNode<SharedFunctionInfo> on_resolve_sfi,
+      TNode<SharedFunctionInfo> on_reject_sfi,
+      TVariable<JSFunction>* var_on_resolve,
+      TVariable<JSFunction>* var_on_reject);
+
   TNode<Object> AwaitOld(TNode<Context> context,
                          TNode<JSGeneratorObject> generator,
                          TNode<Object> value, TNode<JSPromise> outer_promise,
@@ -672,7 +672,9 @@ class CollectionsBuiltinsAssembler : public BaseCollectionsAssembler {
                                              Label* entry_found,
                                              Label* not_found);
   TNode<IntPtrT> ComputeStringHash(TNode<String> string_key);
-  void SameValueZeroString(TNode<String> key_string,
+  // {key_hash} is the hash of {key_string}, as computed by
+  // ComputeStringHash.
+  void SameValueZeroString(TNode<String> key_string, TNode<IntPtrT> key_hash,
                            TNode<Object> candidate_key, Label* if_same,
                            Label* if_not_same);
 
@@ -1292,7 +1294,8 @@ void CollectionsBuiltinsAssembler::FindOrderedHashTableEntryForStringKey(
   FindOrderedHashTableEntry<CollectionType>(
       table, hash,
       [&](TNode<Object> other_key, Label* if_same, Label* if_not_same) {
-        SameValueZeroString(key_tagged, other_key, if_same, if_not_same);
+        SameValueZeroString(key_tagged, hash, other_key, if_same,
+                            if_not_same);
       },
       result, entry_found, not_found);
 }
@@ -1362,12 +1365,27 @@ TNode<IntPtrT> CollectionsBuiltinsAssembler::ComputeStringHash(
 }
 
 void CollectionsBuiltinsAssembler::SameValueZeroString(
-    TNode<String> key_string, TNode<Object> candidate_key, Label* if_same,
-    Label* if_not_same) {
+    TNode<String> key_string, TNode<IntPtrT> key_hash,
+    TNode<Object> candidate_key, Label* if_same, Label* if_not_same) {
+  // Identical strings are equal, which avoids the call to StringEqual for
+  // the common case of internalized keys.
+  GotoIf(TaggedEqual(key_string, candidate_key), if_same);
+
   // If the candidate is not a string, the keys are not equal.
   GotoIf(TaggedIsSmi(candidate_key), if_not_same);
   GotoIfNot(IsString(CAST(candidate_key)), if_not_same);
 
+  // Strings with different hashes are not equal. The hash of keys in the
+  // table has been computed when they were added, so this rejects other
+  // keys in the same bucket chain without comparing their contents.
+  Label compare_contents(this);
+  const TNode<Uint32T> candidate_hash =
+      LoadNameHash(CAST(candidate_key), &compare_contents);
+  GotoIf(Word32NotEqual(candidate_hash, TruncateIntPtrToInt32(key_hash)),
+         if_not_same);
+  Goto(&compare_contents);
+
+  BIND(&compare_contents);
   Branch(TaggedEqual(CallBuiltin(Builtin::kStringEqual, NoContextConstant(),
                                  key_string, candidate_key),
                      TrueConstant()),
@@ -53,6 +53,7 @@ class ObjectBuiltinsAssembler : public CodeStubAssembler {
                                           TNode<BoolT> configurable);
   TNode<HeapObject> GetAccessorOrUndefined(TNode<HeapObject> accessor,
                                            Label* if_bailout);
+  void ObjectAssignFast(TNode<JSReceiver> to, TNode<Object> from, Label* slow);
 };
 
 class ObjectEntriesValuesBuiltinsAssembler : public ObjectBuiltinsAssembler {
@@ -422,6 +423,175 @@ TF_BUILTIN(ObjectPrototypeHasOwnProperty, ObjectBuiltinsAssembler) {
   Return(CallRuntime(Runtime::kObjectHasOwnProperty, context, object, key));
 }
 
+void ObjectBuiltinsAssembler::ObjectAssignFast(TNode<JSReceiver> to,
+                                               TNode<Object> from,
+                                               Label* slow) {
+  // If {to} is an empty ordinary object with the same layout and prototype
+  // as {from}, and {from} only has plain enumerable data properties, then
+  // Object.assign ends up with an object that has exactly the map of
+  // {from}. Copy the fields and switch {to} to that map instead of adding
+  // the properties one by one.
+  GotoIf(TaggedIsSmi(from), slow);
+  TNode<Map> from_map = LoadMap(CAST(from));
+  GotoIfNot(InstanceTypeEqual(LoadMapInstanceType(from_map), JS_OBJECT_TYPE),
+            slow);
+  TNode<JSObject> from_object = CAST(from);
+  TNode<Map> to_map = LoadMap(to);
+  GotoIf(TaggedEqual(to_map, from_map), slow);
+  GotoIfNot(InstanceTypeEqual(LoadMapInstanceType(to_map), JS_OBJECT_TYPE),
+            slow);
+  GotoIfNot(IsExtensibleNonPrototypeMap(to_map), slow);
+  GotoIfNot(IsExtensibleNonPrototypeMap(from_map), slow);
+  GotoIf(IsDictionaryMap(from_map), slow);
+  GotoIf(IsDeprecatedMap(from_map), slow);
+  TNode<Uint32T> from_bit_field3 = LoadMapBitField3(from_map);
+  GotoIf(IsSetWord32<Map::Bits3::ConstructionCounterBits>(from_bit_field3),
+         slow);
+  GotoIfNot(IsFastElementsKind(LoadMapElementsKind(from_map)), slow);
+  GotoIfNot(TaggedEqual(LoadMapPrototype(to_map), LoadMapPrototype(from_map)),
+            slow);
+  TNode<IntPtrT> instance_size = LoadMapInstanceSizeInWords(from_map);
+  GotoIfNot(IntPtrEqual(LoadMapInstanceSizeInWords(to_map), instance_size),
+            slow);
+  TNode<IntPtrT> inobject_start =
+      LoadMapInobjectPropertiesStartInWords(from_map);
+  GotoIfNot(IntPtrEqual(LoadMapInobjectPropertiesStartInWords(to_map),
+                        inobject_start),
+            slow);
+  GotoIfNot(Word32Equal(LoadNumberOfOwnDescriptors(to_map), Int32Constant(0)),
+            slow);
+  GotoIfNot(IsEmptyFixedArray(LoadElements(CAST(to))), slow);
+  GotoIfNot(IsEmptyFixedArray(LoadElements(from_object)), slow);
+  GotoIfNot(IsEmptyFixedArray(
+                LoadObjectField(to, JSObject::kPropertiesOrHashOffset)),
+            slow);
+
+  // Every property of {from} must be an enumerable, writable and
+  // configurable data field, and storing it into {to} must not hit a setter
+  // or a read-only property on the prototype chain. Since {to} adopts the map
+  // of {from}, the fields must also already have the most general
+  // representation (like CloneObjectIC, which generalizes them in its target
+  // map), so that neither object can later change a field in place in a way
+  // that invalidates the other.
+  TNode<DescriptorArray> descriptors = LoadMapDescriptors(from_map);
+  TNode<IntPtrT> nof_descriptors = Signed(ChangeUint32ToWord(
+      DecodeWord32<Map::Bits3::NumberOfOwnDescriptorsBits>(from_bit_field3)));
+  BuildFastLoop<IntPtrT>(
+      IntPtrConstant(0), nof_descriptors,
+      [=](TNode<IntPtrT> descriptor) {
+        TNode<IntPtrT> key_index = DescriptorEntryToIndex(descriptor);
+        TNode<Name> key = LoadKeyByKeyIndex(descriptors, key_index);
+        TNode<Uint32T> details = LoadDetailsByKeyIndex(descriptors, key_index);
+        GotoIfNot(Word32Equal(DecodeWord32<PropertyDetails::KindField>(details),
+                              Int32Constant(kData)),
+                  slow);
+        GotoIfNot(
+            Word32Equal(DecodeWord32<PropertyDetails::LocationField>(details),
+                        Int32Constant(kField)),
+            slow);
+        GotoIfNot(
+            Word32Equal(DecodeWord32<PropertyDetails::AttributesField>(details),
+                        Int32Constant(NONE)),
+            slow);
+        GotoIfNot(IsEqualInWord32<PropertyDetails::RepresentationField>(
+                      details, Representation::kTagged),
+                  slow);
+        GotoIf(IsPrivateSymbol(key), slow);
+
+        TVARIABLE(HeapObject, var_holder, LoadMapPrototype(to_map));
+        Label loop(this, &var_holder), next_holder(this), done(this);
+        Goto(&loop);
+        BIND(&loop);
+        {
+          GotoIf(IsNull(var_holder.value()), &done);
+          TNode<HeapObject> holder = var_holder.value();
+          TNode<Map> holder_map = LoadMap(holder);
+          TNode<Uint16T> holder_instance_type =
+              LoadMapInstanceType(holder_map);
+          GotoIf(IsSpecialReceiverInstanceType(holder_instance_type), slow);
+          GotoIf(InstanceTypeEqual(holder_instance_type, JS_TYPED_ARRAY_TYPE),
+                 slow);
+
+          TVARIABLE(HeapObject, var_meta_storage);
+          TVARIABLE(IntPtrT, var_entry);
+          TVARIABLE(Uint32T, var_details);
+          TVARIABLE(Object, var_value);
+          Label if_found_fast(this), if_found_dict(this),
+              if_found(this, &var_details);
+          TryLookupProperty(holder, holder_map, holder_instance_type, key,
+                            &if_found_fast, &if_found_dict, slow,
+                            &var_meta_storage, &var_entry, &next_holder, slow);
+
+          BIND(&if_found_fast);
+          {
+            TNode<DescriptorArray> holder_descriptors =
+                CAST(var_meta_storage.value());
+            var_details =
+                LoadDetailsByKeyIndex(holder_descriptors, var_entry.value());
+            Goto(&if_found);
+          }
+
+          BIND(&if_found_dict);
+          LoadPropertyFromDictionary<PropertyDictionary>(
+              CAST(var_meta_storage.value()), var_entry.value(), &var_details,
+              &var_value);
+          Goto(&if_found);
+
+          // A writable data property on the prototype chain is shadowed.
+          BIND(&if_found);
+          GotoIfNot(
+              Word32Equal(
+                  DecodeWord32<PropertyDetails::KindField>(var_details.value()),
+                  Int32Constant(kData)),
+              slow);
+          Branch(IsSetWord32(var_details.value(),
+                             PropertyDetails::kAttributesReadOnlyMask),
+                 slow, &done);
+
+          BIND(&next_holder);
+          var_holder = LoadMapPrototype(holder_map);
+          Goto(&loop);
+        }
+        BIND(&done);
+      },
+      1, IndexAdvanceMode::kPost);
+
+  // Copy the out-of-object properties.
+  TVARIABLE(HeapObject, var_properties, EmptyFixedArrayConstant());
+  TNode<Object> from_properties =
+      LoadObjectField(from_object, JSObject::kPropertiesOrHashOffset);
+  Label properties_done(this);
+  GotoIf(TaggedIsSmi(from_properties), &properties_done);
+  GotoIf(IsEmptyFixedArray(from_properties), &properties_done);
+  {
+    TNode<PropertyArray> from_property_array = CAST(from_properties);
+    TNode<IntPtrT> length = LoadPropertyArrayLength(from_property_array);
+    GotoIf(IntPtrEqual(length, IntPtrConstant(0)), &properties_done);
+    TNode<PropertyArray> property_array = AllocatePropertyArray(length);
+    FillPropertyArrayWithUndefined(property_array, IntPtrConstant(0), length);
+    CopyPropertyArrayValues(from_property_array, property_array, length,
+                            SKIP_WRITE_BARRIER, DestroySource::kNo);
+    var_properties = property_array;
+    Goto(&properties_done);
+  }
+  BIND(&properties_done);
+
+  // Copy the in-object properties, including the unused ones, which hold
+  // undefined in both objects. All fields are tagged, so there are no
+  // mutable HeapNumbers that must not be shared.
+  BuildFastLoop<IntPtrT>(
+      inobject_start, instance_size,
+      [=](TNode<IntPtrT> field_index) {
+        TNode<IntPtrT> field_offset = TimesTaggedSize(field_index);
+        StoreObjectField(to, field_offset,
+                         LoadObjectField(from_object, field_offset));
+      },
+      1, IndexAdvanceMode::kPost);
+  StoreObjectField(to, JSObject::kPropertiesOrHashOffset,
+                   var_properties.value());
+  StoreMap(to, from_map);
+}
+
 // ES #sec-object.assign
 TF_BUILTIN(ObjectAssign, ObjectBuiltinsAssembler) {
   TNode<IntPtrT> argc = ChangeInt32ToIntPtr(
@@ -441,11 +611,23 @@ TF_BUILTIN(ObjectAssign, ObjectBuiltinsAssembler) {
   // 3. Let sources be the List of argument values starting with the
   //    second argument.
   // 4. For each element nextSource of sources, in ascending index order,
+  {
+    Label slow(this), next(this);
+    TNode<Object> first_source = args.AtIndex(1);
+    ObjectAssignFast(to, first_source, &slow);
+    Goto(&next);
+
+    BIND(&slow);
+    CallBuiltin(Builtin::kSetDataProperties, context, to, first_source);
+    Goto(&next);
+
+    BIND(&next);
+  }
   args.ForEach(
       [=](TNode<Object> next_source) {
         CallBuiltin(Builtin::kSetDataProperties, context, to, next_source);
       },
-      IntPtrConstant(1));
+      IntPtrConstant(2));
   Goto(&done);
 
   // 5. Return to.
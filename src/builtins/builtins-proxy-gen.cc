@@ -209,6 +209,73 @@ TF_BUILTIN(ConstructProxy, ProxiesCodeStubAssembler) {
   { ThrowTypeError(context, MessageTemplate::kProxyRevoked, "construct"); }
 }
 
+TNode<Object> ProxiesCodeStubAssembler::LoadProxyTrap(
+    TNode<Context> context, TNode<JSReceiver> handler, TNode<String> name,
+    JSProxy::TrapCacheEntry cache_entry) {
+  TVARIABLE(Object, var_value);
+  TVARIABLE(IntPtrT, var_name_index);
+  Label if_found(this), if_miss(this), if_generic(this), done(this);
+
+  // Only own data properties of fast-mode handlers are cached; everything
+  // else takes the generic lookup.
+  TNode<Map> map = LoadMap(handler);
+  GotoIfNot(IsJSObjectMap(map), &if_generic);
+  GotoIf(IsSpecialReceiverMap(map), &if_generic);
+  GotoIf(IsDictionaryMap(map), &if_generic);
+
+  TNode<WeakFixedArray> cache = CAST(LoadContextElement(
+      LoadNativeContext(context), Context::PROXY_TRAP_CACHE_INDEX));
+  const int map_index = cache_entry * JSProxy::kTrapCacheEntrySize;
+  TNode<DescriptorArray> descriptors = LoadMapDescriptors(map);
+  GotoIfNot(IsWeakReferenceTo(
+                LoadWeakFixedArrayElement(cache, IntPtrConstant(map_index)),
+                map),
+            &if_miss);
+  // The descriptor of an own property stays at the same index as long as the
+  // map is the same.
+  var_name_index = SmiUntag(CAST(LoadWeakFixedArrayElement(
+      cache, IntPtrConstant(map_index), kTaggedSize)));
+  Goto(&if_found);
+
+  BIND(&if_miss);
+  {
+    Label if_own(this);
+    DescriptorLookup(name, descriptors, LoadMapBitField3(map), &if_own,
+                     &var_name_index, &if_generic);
+
+    BIND(&if_own);
+    TNode<Uint32T> details =
+        LoadDetailsByKeyIndex(descriptors, var_name_index.value());
+    GotoIfNot(Word32Equal(DecodeWord32<PropertyDetails::KindField>(details),
+                          Int32Constant(kData)),
+              &if_generic);
+    const int offset =
+        WeakFixedArray::OffsetOfElementAt(map_index) - kHeapObjectTag;
+    Store(cache, IntPtrConstant(offset), MakeWeak(map));
+    Store(cache, IntPtrConstant(offset + kTaggedSize),
+          SmiTag(var_name_index.value()));
+    Goto(&if_found);
+  }
+
+  BIND(&if_found);
+  {
+    TNode<Uint32T> details =
+        LoadDetailsByKeyIndex(descriptors, var_name_index.value());
+    LoadPropertyFromFastObject(handler, map, descriptors,
+                               var_name_index.value(), details, &var_value);
+    Goto(&done);
+  }
+
+  BIND(&if_generic);
+  {
+    var_value = GetProperty(context, handler, name);
+    Goto(&done);
+  }
+
+  BIND(&done);
+  return var_value.value();
+}
+
 void ProxiesCodeStubAssembler::CheckGetSetTrapResult(
     TNode<Context> context, TNode<JSReceiver> target, TNode<JSProxy> proxy,
     TNode<Name> name, TNode<Object> trap_result,
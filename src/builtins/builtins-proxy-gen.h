@@ -21,6 +21,13 @@ class ProxiesCodeStubAssembler : public CodeStubAssembler {
   TNode<JSFunction> AllocateProxyRevokeFunction(TNode<Context> context,
                                                 TNode<JSProxy> proxy);
 
+  // Loads the {name} trap from {handler}. The native context remembers, for
+  // the get, has and set traps, where the last fast-mode handler map holds
+  // the trap as an own data property, which saves the descriptor lookup.
+  TNode<Object> LoadProxyTrap(TNode<Context> context,
+                              TNode<JSReceiver> handler, TNode<String> name,
+                              JSProxy::TrapCacheEntry cache_entry);
+
   void CheckGetSetTrapResult(TNode<Context> context, TNode<JSReceiver> target,
                              TNode<JSProxy> proxy, TNode<Name> name,
                              TNode<Object> trap_result,
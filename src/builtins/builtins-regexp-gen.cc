@@ -456,6 +456,17 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
 
   GotoIf(UintPtrGreaterThan(int_last_index, int_string_length), &if_failure);
 
+  // Per-pattern execution stats are collected in the runtime.
+  {
+    TNode<Word32T> stats_flag = UncheckedCast<Word32T>(
+        Load(MachineType::Uint8(),
+             ExternalConstant(
+                 ExternalReference::address_of_regexp_execution_stats_flag())));
+    GotoIfNot(Word32Equal(Word32And(stats_flag, Int32Constant(0xFF)),
+                          Int32Constant(0)),
+              &runtime);
+  }
+
   // Since the RegExp has been compiled, data contains a fixed array.
   TNode<FixedArray> data = CAST(LoadObjectField(regexp, JSRegExp::kDataOffset));
   {
@@ -932,7 +943,8 @@ void RegExpBuiltinsAssembler::BranchIfRegExpResult(const TNode<Context> context,
 }
 
 // Fast path stub for ATOM regexps. String matching is done by StringIndexOf,
-// and {match_info} is updated on success.
+// or by comparing at {last_index} for sticky regexps, and {match_info} is
+// updated on success.
 // The slow path is implemented in RegExp::AtomExec.
 TF_BUILTIN(RegExpExecAtom, RegExpBuiltinsAssembler) {
   auto regexp = Parameter<JSRegExp>(Descriptor::kRegExp);
@@ -965,15 +977,36 @@ TF_BUILTIN(RegExpExecAtom, RegExpBuiltinsAssembler) {
   CSA_ASSERT(this, IntPtrGreaterThan(LoadStringLengthAsWord(needle_string),
                                      IntPtrConstant(0)));
 
-  const TNode<Smi> match_from =
-      CAST(CallBuiltin(Builtin::kStringIndexOf, context, subject_string,
-                       needle_string, last_index));
+  TVARIABLE(Smi, var_match_from);
+  Label if_failure(this), if_success(this, &var_match_from), if_sticky(this),
+      if_notsticky(this);
+  const TNode<Smi> flags =
+      CAST(LoadObjectField(regexp, JSRegExp::kFlagsOffset));
+  Branch(IsSetSmi(flags, JSRegExp::kSticky), &if_sticky, &if_notsticky);
+
+  BIND(&if_sticky);
+  {
+    // A sticky atom can only match at {last_index}, there is no need to search
+    // the rest of the subject.
+    const TNode<Oddball> matches =
+        CAST(CallBuiltin(Builtin::kRegExpAtomMatchesAt, context,
+                         subject_string, needle_string, last_index));
+    var_match_from = last_index;
+    Branch(TaggedEqual(matches, TrueConstant()), &if_success, &if_failure);
+  }
 
-  Label if_failure(this), if_success(this);
-  Branch(SmiEqual(match_from, SmiConstant(-1)), &if_failure, &if_success);
+  BIND(&if_notsticky);
+  {
+    var_match_from =
+        CAST(CallBuiltin(Builtin::kStringIndexOf, context, subject_string,
+                         needle_string, last_index));
+    Branch(SmiEqual(var_match_from.value(), SmiConstant(-1)), &if_failure,
+           &if_success);
+  }
 
   BIND(&if_success);
   {
+    const TNode<Smi> match_from = var_match_from.value();
     CSA_ASSERT(this, TaggedIsPositiveSmi(match_from));
     CSA_ASSERT(this, UintPtrLessThan(SmiUntag(match_from),
                                      LoadStringLengthAsWord(subject_string)));
@@ -28,7 +28,6 @@ using v8::tracing::TracedValue;
 class MaybeUtf8 {
  public:
   explicit MaybeUtf8(Isolate* isolate, Handle<String> string) : buf_(data_) {
-    string = String::Flatten(isolate, string);
     int len;
     if (string->IsOneByteRepresentation()) {
       // Technically this allows unescaped latin1 characters but the trace
@@ -40,12 +39,13 @@ class MaybeUtf8 {
       if (len > 0) {
         // Why copy? Well, the trace event mechanism requires null-terminated
         // strings, the bytes we get from SeqOneByteString are not. buf_ is
-        // guaranteed to be null terminated.
+        // guaranteed to be null terminated. Copying directly also avoids
+        // flattening cons strings first.
         DisallowGarbageCollection no_gc;
-        memcpy(buf_, Handle<SeqOneByteString>::cast(string)->GetChars(no_gc),
-               len);
+        String::WriteToFlat(*string, buf_, 0, len);
       }
     } else {
+      string = String::Flatten(isolate, string);
       Local<v8::String> local = Utils::ToLocal(string);
       auto* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate);
       len = local->Utf8Length(v8_isolate);
@@ -14101,6 +14101,12 @@ TNode<BoolT> CodeStubAssembler::IsDebugActive() {
   return Word32NotEqual(is_debug_active, Int32Constant(0));
 }
 
+TNode<BoolT> CodeStubAssembler::IsBlockCountingPaused() {
+  TNode<Uint8T> is_paused = Load<Uint8T>(ExternalConstant(
+      ExternalReference::debug_block_counting_paused_address(isolate())));
+  return Word32NotEqual(is_paused, Int32Constant(0));
+}
+
 TNode<BoolT> CodeStubAssembler::IsSideEffectFreeDebuggingActive() {
   TNode<Uint8T> debug_execution_mode = Load<Uint8T>(ExternalConstant(
       ExternalReference::debug_execution_mode_address(isolate())));
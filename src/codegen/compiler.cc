@@ -993,7 +993,10 @@ bool GetOptimizedCodeLater(std::unique_ptr<OptimizedCompilationJob> job,
                            Isolate* isolate,
                            OptimizedCompilationInfo* compilation_info,
                            CodeKind code_kind, Handle<JSFunction> function) {
-  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable()) {
+  OptimizingCompileDispatcher* dispatcher =
+      isolate->optimizing_compile_dispatcher();
+  // Make room for the new job by dropping queued jobs that became useless.
+  if (!dispatcher->IsQueueAvailable() && dispatcher->CancelStaleJobs() == 0) {
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** Compilation queue full, will retry optimizing ");
       compilation_info->closure()->ShortPrint();
@@ -1021,7 +1024,7 @@ bool GetOptimizedCodeLater(std::unique_ptr<OptimizedCompilationJob> job,
   }
 
   // The background recompile will own this job.
-  isolate->optimizing_compile_dispatcher()->QueueForOptimization(job.get());
+  dispatcher->QueueForOptimization(job.get());
   job.release();
 
   if (FLAG_trace_concurrent_recompilation) {
@@ -1619,6 +1622,7 @@ void BackgroundCompileTask::Run() {
 
     {
       LocalIsolate isolate(isolate_for_local_isolate_, ThreadKind::kBackground);
+      isolate.heap()->set_thread_name("BackgroundCompile");
       UnparkedScope unparked_scope(&isolate);
       LocalHandleScope handle_scope(&isolate);
 
@@ -1795,6 +1799,10 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileCode");
   AggregatedHistogramTimerScope timer(isolate->counters()->compile_lazy());
 
+  if (shared_info->has_flushed_bytecode()) {
+    isolate->counters()->bytecode_flush_recompiles()->Increment();
+  }
+
   Handle<Script> script(Script::cast(shared_info->script()), isolate);
 
   // Set up parse info.
@@ -3180,6 +3188,21 @@ MaybeHandle<Code> Compiler::GetOptimizedCodeForOSR(Isolate* isolate,
                           CodeKindForOSR(), osr_offset, osr_frame);
 }
 
+namespace {
+
+// The debugger does not abort concurrent jobs when it prepares a function for
+// break points, so jobs that compiled or inlined such a function must not be
+// installed.
+bool HasBreakInfoInCompilation(OptimizedCompilationInfo* compilation_info) {
+  if (compilation_info->shared_info()->HasBreakInfo()) return true;
+  for (const auto& inlined : compilation_info->inlined_functions()) {
+    if (inlined.shared_info->HasBreakInfo()) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
 // static
 bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
                                                Isolate* isolate) {
@@ -3201,16 +3224,18 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
     compilation_info->closure()->feedback_vector().set_profiler_ticks(0);
   }
 
-  DCHECK(!shared->HasBreakInfo());
-
   // 1) Optimization on the concurrent thread may have failed.
   // 2) The function may have already been optimized by OSR.  Simply continue.
   //    Except when OSR already disabled optimization for some reason.
   // 3) The code may have already been invalidated due to dependency change.
   // 4) Code generation may have failed.
+  // 5) A break point may have been set in the function or in one of the
+  //    functions it inlines while the job was running.
   if (job->state() == CompilationJob::State::kReadyToFinalize) {
     if (shared->optimization_disabled()) {
       job->RetryOptimization(BailoutReason::kOptimizationDisabled);
+    } else if (HasBreakInfoInCompilation(compilation_info)) {
+      job->RetryOptimization(BailoutReason::kFunctionBeingDebugged);
     } else if (job->FinalizeJob(isolate) == CompilationJob::SUCCEEDED) {
       job->RecordCompilationStats(OptimizedCompilationJob::kConcurrent,
                                   isolate);
@@ -39,7 +39,7 @@ class ExternalReferenceTable {
   static constexpr int kAccessorReferenceCount =
       Accessors::kAccessorInfoCount + Accessors::kAccessorSetterCount;
   // The number of stub cache external references, see AddStubCache.
-  static constexpr int kStubCacheReferenceCount = 12;
+  static constexpr int kStubCacheReferenceCount = 16;
   static constexpr int kStatsCountersReferenceCount =
 #define SC(...) +1
       STATS_COUNTER_NATIVE_CODE_LIST(SC);
@@ -82,6 +82,8 @@ class ExternalReferenceTable {
   ExternalReferenceTable(const ExternalReferenceTable&) = delete;
   ExternalReferenceTable& operator=(const ExternalReferenceTable&) = delete;
   void Init(Isolate* isolate);
+  // Re-registers the stub cache tables after they have been reallocated.
+  void UpdateStubCacheReferences(Isolate* isolate);
 
  private:
   static void AddIsolateIndependent(Address address, int* index);
@@ -516,6 +516,11 @@ ExternalReference::address_of_harmony_regexp_match_indices_flag() {
   return ExternalReference(&FLAG_harmony_regexp_match_indices);
 }
 
+ExternalReference
+ExternalReference::address_of_regexp_execution_stats_flag() {
+  return ExternalReference(&FLAG_regexp_execution_stats);
+}
+
 ExternalReference ExternalReference::address_of_runtime_stats_flag() {
   return ExternalReference(&TracingFlags::runtime_stats);
 }
@@ -1004,6 +1009,11 @@ ExternalReference ExternalReference::debug_hook_on_function_call_address(
   return ExternalReference(isolate->debug()->hook_on_function_call_address());
 }
 
+ExternalReference ExternalReference::debug_block_counting_paused_address(
+    Isolate* isolate) {
+  return ExternalReference(isolate->debug()->block_counting_paused_address());
+}
+
 ExternalReference ExternalReference::runtime_function_table_address(
     Isolate* isolate) {
   return ExternalReference(
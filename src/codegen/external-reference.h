@@ -57,6 +57,8 @@ class StatsCounter;
   V(debug_is_active_address, "Debug::is_active_address()")                     \
   V(debug_hook_on_function_call_address,                                       \
     "Debug::hook_on_function_call_address()")                                  \
+  V(debug_block_counting_paused_address,                                       \
+    "Debug::block_counting_paused_address()")                                  \
   V(runtime_function_table_address,                                            \
     "Runtime::runtime_function_table_address()")                               \
   V(is_profiling_address, "Isolate::is_profiling")                             \
@@ -109,6 +111,8 @@ class StatsCounter;
   V(address_of_mock_arraybuffer_allocator_flag,                                \
     "FLAG_mock_arraybuffer_allocator")                                         \
   V(address_of_one_half, "LDoubleConstant::one_half")                          \
+  V(address_of_regexp_execution_stats_flag,                                    \
+    "FLAG_regexp_execution_stats")                                             \
   V(address_of_runtime_stats_flag, "TracingFlags::runtime_stats")              \
   V(address_of_the_hole_nan, "the_hole_nan")                                   \
   V(address_of_uint32_bias, "uint32_bias")                                     \
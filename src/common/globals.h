@@ -873,6 +873,9 @@ enum Executability { NOT_EXECUTABLE, EXECUTABLE };
 enum class BytecodeFlushMode {
   kDoNotFlushBytecode,
   kFlushBytecode,
+  // Used for memory-reducing GCs: bytecode that has not run since the previous
+  // full GC is flushed instead of waiting for it to become old.
+  kAggressiveFlushBytecode,
   kStressFlushBytecode,
 };
 
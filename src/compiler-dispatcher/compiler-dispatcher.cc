@@ -21,8 +21,13 @@
 namespace v8 {
 namespace internal {
 
-CompilerDispatcher::Job::Job(BackgroundCompileTask* task_arg)
-    : task(task_arg), has_run(false), aborted(false) {}
+CompilerDispatcher::Job::Job(BackgroundCompileTask* task_arg,
+                             bool is_likely_called_arg)
+    : task(task_arg),
+      is_likely_called(is_likely_called_arg),
+      id(0),
+      has_run(false),
+      aborted(false) {}
 
 CompilerDispatcher::Job::~Job() = default;
 
@@ -58,19 +63,23 @@ CompilerDispatcher::~CompilerDispatcher() {
 
 base::Optional<CompilerDispatcher::JobId> CompilerDispatcher::Enqueue(
     const ParseInfo* outer_parse_info, const AstRawString* function_name,
-    const FunctionLiteral* function_literal) {
+    const FunctionLiteral* function_literal, bool is_likely_called) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.CompilerDispatcherEnqueue");
   RCS_SCOPE(isolate_, RuntimeCallCounterId::kCompileEnqueueOnDispatcher);
 
   if (!IsEnabled()) return base::nullopt;
 
-  std::unique_ptr<Job> job = std::make_unique<Job>(new BackgroundCompileTask(
-      outer_parse_info, function_name, function_literal,
-      worker_thread_runtime_call_stats_, background_compile_timer_,
-      static_cast<int>(max_stack_size_)));
+  std::unique_ptr<Job> job = std::make_unique<Job>(
+      new BackgroundCompileTask(outer_parse_info, function_name,
+                                function_literal,
+                                worker_thread_runtime_call_stats_,
+                                background_compile_timer_,
+                                static_cast<int>(max_stack_size_)),
+      is_likely_called);
   JobMap::const_iterator it = InsertJob(std::move(job));
   JobId id = it->first;
+  it->second->id = id;
   if (trace_compiler_dispatcher_) {
     PrintF("CompilerDispatcher: enqueued job %zu for function literal id %d\n",
            id, function_literal->function_literal_id());
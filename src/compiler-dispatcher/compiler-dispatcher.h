@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <set>
 #include <unordered_set>
 #include <utility>
 
@@ -85,9 +86,12 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   // Returns true if the compiler dispatcher is enabled.
   bool IsEnabled() const;
 
+  // Enqueues a background compile of |function_literal|. Jobs for functions
+  // that are |is_likely_called| are run before the other pending jobs.
   base::Optional<JobId> Enqueue(const ParseInfo* outer_parse_info,
                                 const AstRawString* function_name,
-                                const FunctionLiteral* function_literal);
+                                const FunctionLiteral* function_literal,
+                                bool is_likely_called = false);
 
   // Registers the given |function| with the compilation job |job_id|.
   void RegisterSharedFunctionInfo(JobId job_id, SharedFunctionInfo function);
@@ -111,6 +115,7 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
  private:
   FRIEND_TEST(CompilerDispatcherTest, IdleTaskNoIdleTime);
   FRIEND_TEST(CompilerDispatcherTest, IdleTaskSmallIdleTime);
+  FRIEND_TEST(CompilerDispatcherTest, LikelyCalledJobsRunFirst);
   FRIEND_TEST(CompilerDispatcherTest, FinishNowWithWorkerTask);
   FRIEND_TEST(CompilerDispatcherTest, AbortJobNotStarted);
   FRIEND_TEST(CompilerDispatcherTest, AbortJobAlreadyStarted);
@@ -119,7 +124,7 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   FRIEND_TEST(CompilerDispatcherTest, CompileMultipleOnBackgroundThread);
 
   struct Job {
-    explicit Job(BackgroundCompileTask* task_arg);
+    Job(BackgroundCompileTask* task_arg, bool is_likely_called_arg);
     ~Job();
 
     bool IsReadyToFinalize(const base::MutexGuard&) {
@@ -133,10 +138,26 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
 
     std::unique_ptr<BackgroundCompileTask> task;
     MaybeHandle<SharedFunctionInfo> function;
+    // Set for functions the parser expects to be called right away (e.g.
+    // parenthesized function expressions). These are compiled first.
+    const bool is_likely_called;
+    // Enqueuing order, which follows source order within a script.
+    JobId id;
     bool has_run;
     bool aborted;
   };
 
+  // Orders pending jobs so that likely called functions are compiled first,
+  // and otherwise in the order they were enqueued.
+  struct PendingJobOrder {
+    bool operator()(const Job* a, const Job* b) const {
+      if (a->is_likely_called != b->is_likely_called) {
+        return a->is_likely_called;
+      }
+      return a->id < b->id;
+    }
+  };
+
   using JobMap = std::map<JobId, std::unique_ptr<Job>>;
   using SharedToJobIdMap = IdentityMap<JobId, FreeStoreAllocationPolicy>;
 
@@ -184,7 +205,7 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   int num_worker_tasks_;
 
   // The set of jobs that can be run on a background thread.
-  std::unordered_set<Job*> pending_background_jobs_;
+  std::set<Job*, PendingJobOrder> pending_background_jobs_;
 
   // The set of jobs currently being run on background threads.
   std::unordered_set<Job*> running_background_jobs_;
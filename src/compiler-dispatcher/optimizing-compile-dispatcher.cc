@@ -4,6 +4,8 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <algorithm>
+
 #include "src/base/atomicops.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/optimized-compilation-info.h"
@@ -36,6 +38,15 @@ void DisposeCompilationJob(OptimizedCompilationJob* job,
   delete job;
 }
 
+// A queued job is stale if compiling it can no longer produce code that will
+// be installed.
+bool IsStaleCompilationJob(OptimizedCompilationJob* job) {
+  OptimizedCompilationInfo* info = job->compilation_info();
+  JSFunction function = *info->closure();
+  if (function.shared().optimization_disabled()) return true;
+  return !info->is_osr() && function.HasAvailableCodeKind(info->code_kind());
+}
+
 }  // namespace
 
 class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
@@ -67,6 +78,7 @@ class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
     LocalIsolate local_isolate(isolate_, ThreadKind::kBackground);
 #endif  // V8_RUNTIME_CALL_STATS
     DCHECK(local_isolate.heap()->IsParked());
+    local_isolate.heap()->set_thread_name("ConcurrentOptimization");
 
     {
       RCS_SCOPE(runtime_call_stats_scope.Get(),
@@ -107,13 +119,40 @@ OptimizedCompilationJob* OptimizingCompileDispatcher::NextInput(
     LocalIsolate* local_isolate) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
   if (input_queue_length_ == 0) return nullptr;
-  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
+  // Find the hottest job. The queue is short, so a linear scan is cheaper than
+  // maintaining a heap.
+  int hottest = 0;
+  for (int i = 1; i < input_queue_length_; i++) {
+    if (input_queue_[InputQueueIndex(i)].priority >
+        input_queue_[InputQueueIndex(hottest)].priority) {
+      hottest = i;
+    }
+  }
+  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(hottest)].job;
   DCHECK_NOT_NULL(job);
+  // Close the gap so that the remaining jobs keep their FIFO order.
+  for (int i = hottest; i > 0; i--) {
+    input_queue_[InputQueueIndex(i)] = input_queue_[InputQueueIndex(i - 1)];
+  }
   input_queue_shift_ = InputQueueIndex(1);
   input_queue_length_--;
   return job;
 }
 
+// static
+int OptimizingCompileDispatcher::ComputePriority(
+    OptimizedCompilationJob* job) {
+  OptimizedCompilationInfo* info = job->compilation_info();
+  // OSR is requested by a loop that is currently running, so these jobs go
+  // first.
+  if (info->is_osr()) return kMaxInt;
+  JSFunction function = *info->closure();
+  if (!function.has_feedback_vector()) return 0;
+  // The interrupt budget is reset on every tiering decision and thus carries
+  // no information at this point; the invocation count does.
+  return std::max(0, function.feedback_vector().invocation_count());
+}
+
 void OptimizingCompileDispatcher::CompileNext(OptimizedCompilationJob* job,
                                               LocalIsolate* local_isolate) {
   if (!job) return;
@@ -151,7 +190,7 @@ void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
 void OptimizingCompileDispatcher::FlushInputQueue() {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
   while (input_queue_length_ > 0) {
-    OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
+    OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)].job;
     DCHECK_NOT_NULL(job);
     input_queue_shift_ = InputQueueIndex(1);
     input_queue_length_--;
@@ -188,9 +227,41 @@ void OptimizingCompileDispatcher::Stop() {
   DCHECK_EQ(input_queue_length_, 0);
 }
 
+int OptimizingCompileDispatcher::CancelStaleJobs() {
+  DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
+  HandleScope handle_scope(isolate_);
+  base::MutexGuard access_input_queue(&input_queue_mutex_);
+  int kept = 0;
+  for (int i = 0; i < input_queue_length_; i++) {
+    InputQueueEntry entry = input_queue_[InputQueueIndex(i)];
+    if (!IsStaleCompilationJob(entry.job)) {
+      input_queue_[InputQueueIndex(kept++)] = entry;
+      continue;
+    }
+    Handle<JSFunction> function = entry.job->compilation_info()->closure();
+    if (FLAG_trace_concurrent_recompilation) {
+      PrintF("  ** Cancelling stale compilation for ");
+      function->ShortPrint();
+      PrintF(".\n");
+    }
+    if (function->IsInOptimizationQueue()) {
+      function->ClearOptimizationMarker();
+    }
+    // Compile tasks that were already posted for this job simply find one job
+    // less in the queue.
+    DisposeCompilationJob(entry.job, false);
+  }
+  int cancelled = input_queue_length_ - kept;
+  input_queue_length_ = kept;
+  return cancelled;
+}
+
 void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   HandleScope handle_scope(isolate_);
 
+  // All jobs that are ready get installed within a single interrupt. Jobs are
+  // popped one at a time, so that a flush triggered during finalization (e.g.
+  // by a GC or by deoptimization) still sees the remaining jobs.
   for (;;) {
     OptimizedCompilationJob* job = nullptr;
     {
@@ -225,11 +296,12 @@ bool OptimizingCompileDispatcher::HasJobs() {
 void OptimizingCompileDispatcher::QueueForOptimization(
     OptimizedCompilationJob* job) {
   DCHECK(IsQueueAvailable());
+  const int priority = ComputePriority(job);
   {
     // Add job to the back of the input queue.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
     DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
+    input_queue_[InputQueueIndex(input_queue_length_)] = {job, priority};
     input_queue_length_++;
   }
   if (FLAG_block_concurrent_recompilation) {
@@ -14,6 +14,7 @@
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/utils/allocation.h"
+#include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
 
 namespace v8 {
 namespace internal {
@@ -33,7 +34,7 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
         blocked_jobs_(0),
         ref_count_(0),
         recompilation_delay_(FLAG_concurrent_recompilation_delay) {
-    input_queue_ = NewArray<OptimizedCompilationJob*>(input_queue_capacity_);
+    input_queue_ = NewArray<InputQueueEntry>(input_queue_capacity_);
   }
 
   ~OptimizingCompileDispatcher();
@@ -44,6 +45,11 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void QueueForOptimization(OptimizedCompilationJob* job);
   void Unblock();
   void InstallOptimizedFunctions();
+  // Disposes of queued jobs that are no longer worth compiling, either because
+  // the function got optimized in the meantime or because optimization was
+  // disabled for it. Returns the number of cancelled jobs. This method must be
+  // called on the main thread.
+  int CancelStaleJobs();
 
   inline bool IsQueueAvailable() {
     base::MutexGuard access_input_queue(&input_queue_mutex_);
@@ -58,6 +64,14 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
  private:
   class CompileTask;
 
+  // Jobs in the input queue are annotated with a hotness priority that is
+  // computed on the main thread when the job is queued. Background threads
+  // pick the hottest job first, ties are resolved in FIFO order.
+  struct InputQueueEntry {
+    OptimizedCompilationJob* job;
+    int priority;
+  };
+
   enum ModeFlag { COMPILE, FLUSH };
 
   void FlushQueues(BlockingBehavior blocking_behavior,
@@ -67,6 +81,8 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void CompileNext(OptimizedCompilationJob* job, LocalIsolate* local_isolate);
   OptimizedCompilationJob* NextInput(LocalIsolate* local_isolate);
 
+  static int ComputePriority(OptimizedCompilationJob* job);
+
   inline int InputQueueIndex(int i) {
     int result = (i + input_queue_shift_) % input_queue_capacity_;
     DCHECK_LE(0, result);
@@ -77,7 +93,7 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   Isolate* isolate_;
 
   // Circular queue of incoming recompilation tasks (including OSR).
-  OptimizedCompilationJob** input_queue_;
+  InputQueueEntry* input_queue_;
   int input_queue_capacity_;
   int input_queue_length_;
   int input_queue_shift_;
@@ -101,6 +117,9 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // Since flags might get modified while the background thread is running, it
   // is not safe to access them directly.
   int recompilation_delay_;
+
+  FRIEND_TEST(OptimizingCompileDispatcherTest, HotterJobsAreCompiledFirst);
+  FRIEND_TEST(OptimizingCompileDispatcherTest, CancelStaleJobs);
 };
 }  // namespace internal
 }  // namespace v8
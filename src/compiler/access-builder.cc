@@ -309,6 +309,26 @@ FieldAccess AccessBuilder::ForJSAsyncFunctionObjectPromise() {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForJSAsyncFunctionObjectAwaitResolveClosure() {
+  FieldAccess access = {
+      kTaggedBase,    JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+      Handle<Name>(), MaybeHandle<Map>(),
+      Type::Any(),    MachineType::AnyTagged(),
+      kFullWriteBarrier};
+  return access;
+}
+
+// static
+FieldAccess AccessBuilder::ForJSAsyncFunctionObjectAwaitRejectClosure() {
+  FieldAccess access = {
+      kTaggedBase,    JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+      Handle<Name>(), MaybeHandle<Map>(),
+      Type::Any(),    MachineType::AnyTagged(),
+      kFullWriteBarrier};
+  return access;
+}
+
 // static
 FieldAccess AccessBuilder::ForJSAsyncGeneratorObjectQueue() {
   FieldAccess access = {
@@ -434,6 +454,15 @@ FieldAccess AccessBuilder::ForJSTypedArrayExternalPointer() {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForJSTypedArrayBitField() {
+  FieldAccess access = {
+      kTaggedBase,        JSTypedArray::kBitFieldOffset, MaybeHandle<Name>(),
+      MaybeHandle<Map>(), TypeCache::Get()->kUint8,      MachineType::Uint32(),
+      kNoWriteBarrier};
+  return access;
+}
+
 // static
 FieldAccess AccessBuilder::ForJSDataViewDataPointer() {
   FieldAccess access = {
@@ -121,6 +121,12 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   // Provides access to JSAsyncFunctionObject::promise() field.
   static FieldAccess ForJSAsyncFunctionObjectPromise();
 
+  // Provides access to JSAsyncFunctionObject::await_resolve_closure() field.
+  static FieldAccess ForJSAsyncFunctionObjectAwaitResolveClosure();
+
+  // Provides access to JSAsyncFunctionObject::await_reject_closure() field.
+  static FieldAccess ForJSAsyncFunctionObjectAwaitRejectClosure();
+
   // Provides access to JSAsyncGeneratorObject::queue() field.
   static FieldAccess ForJSAsyncGeneratorObjectQueue();
 
@@ -151,6 +157,9 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   // Provides access to JSTypedArray::external_pointer() field.
   static FieldAccess ForJSTypedArrayExternalPointer();
 
+  // Provides access to JSTypedArray::bit_field() field.
+  static FieldAccess ForJSTypedArrayBitField();
+
   // Provides access to JSDataView::data_pointer() field.
   static FieldAccess ForJSDataViewDataPointer();
 
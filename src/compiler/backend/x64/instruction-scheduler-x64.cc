@@ -2,12 +2,53 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cstring>
+
+#include "src/base/cpu.h"
 #include "src/compiler/backend/instruction-scheduler.h"
+#include "src/flags/flags.h"
 
 namespace v8 {
 namespace internal {
 namespace compiler {
 
+namespace {
+
+// Starting with Ice Lake (Intel) and Zen 3 (AMD), integer division takes
+// roughly a third of the cycles it takes on the cores the generic latencies
+// below were measured on.
+bool HostHasFastIntegerDivider() {
+  static const bool has_fast_divider = [] {
+    base::CPU cpu;
+    if (strcmp(cpu.vendor(), "GenuineIntel") == 0) {
+      if (cpu.family() != 6) return false;
+      switch (cpu.model()) {
+        case 0x6A:  // Ice Lake server
+        case 0x6C:
+        case 0x7D:  // Ice Lake client
+        case 0x7E:
+        case 0x8C:  // Tiger Lake
+        case 0x8D:
+        case 0x8F:  // Sapphire Rapids
+        case 0x97:  // Alder Lake
+        case 0x9A:
+        case 0xA7:  // Rocket Lake
+          return true;
+        default:
+          return false;
+      }
+    }
+    if (strcmp(cpu.vendor(), "AuthenticAMD") == 0) {
+      return cpu.family() + cpu.ext_family() >= 0x19;
+    }
+    return false;
+  }();
+  // Code generated for the snapshot must not depend on the build machine.
+  return has_fast_divider && !FLAG_predictable;
+}
+
+}  // namespace
+
 bool InstructionScheduler::SchedulerSupported() { return true; }
 
 int InstructionScheduler::GetTargetInstructionFlags(
@@ -496,13 +537,13 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64ToUint32:
       return 4;
     case kX64Idiv:
-      return 49;
+      return HostHasFastIntegerDivider() ? 15 : 49;
     case kX64Idiv32:
-      return 35;
+      return HostHasFastIntegerDivider() ? 12 : 35;
     case kX64Udiv:
-      return 38;
+      return HostHasFastIntegerDivider() ? 15 : 38;
     case kX64Udiv32:
-      return 26;
+      return HostHasFastIntegerDivider() ? 12 : 26;
     case kSSEFloat32Div:
     case kSSEFloat64Div:
     case kSSEFloat32Sqrt:
@@ -49,6 +49,9 @@ Reduction CsaLoadElimination::Reduce(Node* node) {
     case IrOpcode::kAbortCSAAssert:
       // Avoid changing optimizations in the presence of debug instructions.
       return PropagateInputState(node);
+    case IrOpcode::kStore:
+    case IrOpcode::kUnalignedStore:
+      return ReduceStore(node);
     case IrOpcode::kCall:
       return ReduceCall(node);
     case IrOpcode::kEffectPhi:
@@ -246,6 +249,15 @@ Reduction CsaLoadElimination::ReduceStart(Node* node) {
   return UpdateState(node, empty_state());
 }
 
+Reduction CsaLoadElimination::ReduceStore(Node* node) {
+  // Raw stores to off-heap memory, like the bump of the allocation top in the
+  // inline allocation fast path, cannot alias any object field.
+  Node* base = NodeProperties::GetValueInput(node, 0);
+  ExternalReferenceMatcher m(base);
+  if (m.HasResolvedValue()) return PropagateInputState(node);
+  return ReduceOtherNode(node);
+}
+
 Reduction CsaLoadElimination::ReduceCall(Node* node) {
   Node* value = NodeProperties::GetValueInput(node, 0);
   ExternalReferenceMatcher m(value);
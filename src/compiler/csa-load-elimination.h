@@ -89,6 +89,7 @@ class V8_EXPORT_PRIVATE CsaLoadElimination final
   Reduction ReduceStoreToObject(Node* node, ObjectAccess const& access);
   Reduction ReduceEffectPhi(Node* node);
   Reduction ReduceStart(Node* node);
+  Reduction ReduceStore(Node* node);
   Reduction ReduceCall(Node* node);
   Reduction ReduceOtherNode(Node* node);
 
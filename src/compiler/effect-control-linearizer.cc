@@ -27,6 +27,7 @@
 #include "src/execution/frames.h"
 #include "src/heap/factory-inl.h"
 #include "src/objects/heap-number.h"
+#include "src/objects/js-array-buffer.h"
 #include "src/objects/oddball.h"
 #include "src/objects/ordered-hash-table.h"
 
@@ -196,7 +197,11 @@ class EffectControlLinearizer {
   void LowerTransitionElementsKind(Node* node);
   Node* LowerLoadFieldByIndex(Node* node);
   Node* LowerLoadMessage(Node* node);
-  Node* AdaptFastCallArgument(Node* node, CTypeInfo::Type arg_type);
+  Node* AdaptFastCallArgument(Node* node, CTypeInfo arg_type,
+                              GraphAssemblerLabel<0>* if_error);
+  Node* AdaptFastCallTypedArrayArgument(Node* node,
+                                        ElementsKind expected_elements_kind,
+                                        GraphAssemblerLabel<0>* bailout);
   Node* LowerFastApiCall(Node* node);
   Node* LowerLoadTypedElement(Node* node);
   Node* LowerLoadDataViewElement(Node* node);
@@ -4981,11 +4986,46 @@ MachineType MachineTypeFor(CTypeInfo::Type type) {
       return MachineType::AnyTagged();
   }
 }
+
+MachineType MachineTypeForArgument(CTypeInfo arg_type) {
+  // Typed arrays are passed as a pointer to a FastApiTypedArray on the stack.
+  if (arg_type.GetSequenceType() == CTypeInfo::SequenceType::kIsTypedArray) {
+    return MachineType::Pointer();
+  }
+  return MachineTypeFor(arg_type.GetType());
+}
+
+ElementsKind TypedArrayElementsKindFor(CTypeInfo::Type type) {
+  switch (type) {
+    case CTypeInfo::Type::kInt32:
+      return INT32_ELEMENTS;
+    case CTypeInfo::Type::kUint32:
+      return UINT32_ELEMENTS;
+    case CTypeInfo::Type::kInt64:
+      return BIGINT64_ELEMENTS;
+    case CTypeInfo::Type::kUint64:
+      return BIGUINT64_ELEMENTS;
+    case CTypeInfo::Type::kFloat32:
+      return FLOAT32_ELEMENTS;
+    case CTypeInfo::Type::kFloat64:
+      return FLOAT64_ELEMENTS;
+    case CTypeInfo::Type::kVoid:
+    case CTypeInfo::Type::kBool:
+    case CTypeInfo::Type::kV8Value:
+    case CTypeInfo::Type::kApiObject:
+      UNREACHABLE();
+  }
+}
 }  // namespace
 
-Node* EffectControlLinearizer::AdaptFastCallArgument(Node* node,
-                                                     CTypeInfo::Type arg_type) {
-  switch (arg_type) {
+Node* EffectControlLinearizer::AdaptFastCallArgument(
+    Node* node, CTypeInfo arg_type, GraphAssemblerLabel<0>* if_error) {
+  if (arg_type.GetSequenceType() == CTypeInfo::SequenceType::kIsTypedArray) {
+    return AdaptFastCallTypedArrayArgument(
+        node, TypedArrayElementsKindFor(arg_type.GetType()), if_error);
+  }
+  DCHECK_EQ(arg_type.GetSequenceType(), CTypeInfo::SequenceType::kScalar);
+  switch (arg_type.GetType()) {
     case CTypeInfo::Type::kV8Value: {
       int kAlign = alignof(uintptr_t);
       int kSize = sizeof(uintptr_t);
@@ -5006,6 +5046,75 @@ Node* EffectControlLinearizer::AdaptFastCallArgument(Node* node,
   }
 }
 
+Node* EffectControlLinearizer::AdaptFastCallTypedArrayArgument(
+    Node* node, ElementsKind expected_elements_kind,
+    GraphAssemblerLabel<0>* bailout) {
+  // Anything but a non-detached, fixed-length JSTypedArray of the expected
+  // elements kind takes the slow call.
+  __ GotoIf(ObjectIsSmi(node), bailout);
+  Node* value_map = __ LoadField(AccessBuilder::ForMap(), node);
+  Node* value_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+  __ GotoIfNot(__ Word32Equal(value_instance_type,
+                              __ Int32Constant(JS_TYPED_ARRAY_TYPE)),
+               bailout);
+
+  Node* value_bit_field2 =
+      __ LoadField(AccessBuilder::ForMapBitField2(), value_map);
+  Node* value_elements_kind = __ Word32Shr(
+      __ Word32And(value_bit_field2,
+                   __ Int32Constant(Map::Bits2::ElementsKindBits::kMask)),
+      __ Int32Constant(Map::Bits2::ElementsKindBits::kShift));
+  __ GotoIfNot(__ Word32Equal(value_elements_kind,
+                              __ Int32Constant(expected_elements_kind)),
+               bailout);
+
+  Node* value_bit_field =
+      __ LoadField(AccessBuilder::ForJSTypedArrayBitField(), node);
+  __ GotoIfNot(
+      __ Word32Equal(
+          __ Word32And(value_bit_field,
+                       __ Int32Constant(
+                           JSTypedArray::IsLengthTrackingBit::kMask |
+                           JSTypedArray::IsBackedByRabBit::kMask)),
+          __ Int32Constant(0)),
+      bailout);
+
+  Node* buffer =
+      __ LoadField(AccessBuilder::ForJSArrayBufferViewBuffer(), node);
+  Node* buffer_bit_field =
+      __ LoadField(AccessBuilder::ForJSArrayBufferBitField(), buffer);
+  __ GotoIfNot(
+      __ Word32Equal(
+          __ Word32And(buffer_bit_field,
+                       __ Int32Constant(JSArrayBuffer::WasDetachedBit::kMask)),
+          __ Int32Constant(0)),
+      bailout);
+
+  // The C function sees the backing store directly. It must not trigger a
+  // GC, so the pointer stays valid even for on-heap typed arrays.
+  Node* base = __ LoadField(AccessBuilder::ForJSTypedArrayBasePointer(), node);
+  Node* external =
+      __ LoadField(AccessBuilder::ForJSTypedArrayExternalPointer(), node);
+  Node* data_ptr = BuildTypedArrayDataPointer(base, external);
+  Node* length = __ LoadField(AccessBuilder::ForJSTypedArrayLength(), node);
+
+  using TypedArrayStruct = v8::FastApiTypedArray<void>;
+  int kAlign = alignof(TypedArrayStruct);
+  int kSize = sizeof(TypedArrayStruct);
+  STATIC_ASSERT(sizeof(TypedArrayStruct) == 2 * sizeof(uintptr_t));
+  Node* stack_slot = __ StackSlot(kSize, kAlign);
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           stack_slot, static_cast<int>(offsetof(TypedArrayStruct, data)),
+           data_ptr);
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           stack_slot, static_cast<int>(offsetof(TypedArrayStruct, length)),
+           length);
+  return stack_slot;
+}
+
 Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
   FastApiCallNode n(node);
   FastApiCallParameters const& params = n.Parameters();
@@ -5045,7 +5154,7 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
   builder.AddReturn(return_type);
   for (int i = 0; i < c_arg_count; ++i) {
     MachineType machine_type =
-        MachineTypeFor(c_signature->ArgumentInfo(i).GetType());
+        MachineTypeForArgument(c_signature->ArgumentInfo(i));
     builder.AddParam(machine_type);
   }
   if (c_signature->HasOptions()) {
@@ -5057,21 +5166,22 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
 
   call_descriptor->SetCFunctionInfo(c_signature);
 
-  // CPU profiler support
-  Node* target_address = __ ExternalConstant(
-      ExternalReference::fast_api_call_target_address(isolate()));
-  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
-                               kNoWriteBarrier),
-           target_address, 0, n.target());
+  // Arguments that the fast call cannot take (e.g. a typed array of the wrong
+  // kind) jump to the slow call instead.
+  auto if_error = __ MakeDeferredLabel();
+  bool needs_slow_call = c_signature->HasOptions();
 
   Node** const inputs = graph()->zone()->NewArray<Node*>(
       c_arg_count + n.FastCallExtraInputCount());
   inputs[0] = n.target();
   for (int i = FastApiCallNode::kFastTargetInputCount;
        i < c_arg_count + FastApiCallNode::kFastTargetInputCount; ++i) {
-    inputs[i] =
-        AdaptFastCallArgument(NodeProperties::GetValueInput(node, i),
-                              c_signature->ArgumentInfo(i - 1).GetType());
+    CTypeInfo arg_type = c_signature->ArgumentInfo(i - 1);
+    if (arg_type.GetSequenceType() == CTypeInfo::SequenceType::kIsTypedArray) {
+      needs_slow_call = true;
+    }
+    inputs[i] = AdaptFastCallArgument(NodeProperties::GetValueInput(node, i),
+                                      arg_type, &if_error);
   }
   if (c_signature->HasOptions()) {
     inputs[c_arg_count + 1] = stack_slot;
@@ -5082,6 +5192,13 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
     inputs[c_arg_count + 2] = __ control();
   }
 
+  // CPU profiler support
+  Node* target_address = __ ExternalConstant(
+      ExternalReference::fast_api_call_target_address(isolate()));
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           target_address, 0, n.target());
+
   Node* c_call_result = __ Call(
       call_descriptor, c_arg_count + n.FastCallExtraInputCount(), inputs);
 
@@ -5122,21 +5239,22 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
       UNREACHABLE();
   }
 
-  if (!c_signature->HasOptions()) return fast_call_result;
+  if (!needs_slow_call) return fast_call_result;
 
-  DCHECK_NOT_NULL(stack_slot);
-  Node* load =
-      __ Load(MachineType::Int32(), stack_slot,
-              static_cast<int>(offsetof(v8::FastApiCallbackOptions, fallback)));
-
-  Node* is_zero = __ Word32Equal(load, __ Int32Constant(0));
-  // Hint to true.
-  auto if_success = __ MakeLabel();
-  auto if_error = __ MakeDeferredLabel();
   auto merge = __ MakeLabel(MachineRepresentation::kTagged);
-  __ Branch(is_zero, &if_success, &if_error);
+  if (c_signature->HasOptions()) {
+    DCHECK_NOT_NULL(stack_slot);
+    Node* load = __ Load(
+        MachineType::Int32(), stack_slot,
+        static_cast<int>(offsetof(v8::FastApiCallbackOptions, fallback)));
+
+    Node* is_zero = __ Word32Equal(load, __ Int32Constant(0));
+    // Hint to true.
+    auto if_success = __ MakeLabel();
+    __ Branch(is_zero, &if_success, &if_error);
 
-  __ Bind(&if_success);
+    __ Bind(&if_success);
+  }
   __ Goto(&merge, fast_call_result);
 
   // Generate direct slow call.
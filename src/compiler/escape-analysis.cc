@@ -4,6 +4,9 @@
 
 #include "src/compiler/escape-analysis.h"
 
+#include <algorithm>
+
+#include "src/base/small-vector.h"
 #include "src/codegen/tick-counter.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/node-matchers.h"
@@ -518,6 +521,10 @@ int OffsetOfElementAt(ElementAccess const& access, int index) {
          (index << ElementSizeLog2Of(access.machine_type.representation()));
 }
 
+// Loads from small non-escaping arrays with an unknown index are replaced by
+// a chain of Selects over all elements, up to this many elements.
+constexpr int kMaxElementsForSelectReplacement = 4;
+
 Maybe<int> OffsetOfElementsAccess(const Operator* op, Node* index_node) {
   DCHECK(op->opcode() == IrOpcode::kLoadElement ||
          op->opcode() == IrOpcode::kStoreElement);
@@ -640,50 +647,56 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
         int const length =
             (vobject->size() - access.header_size) >>
             ElementSizeLog2Of(access.machine_type.representation());
-        Variable var0, var1;
-        Node* value0;
-        Node* value1;
-        if (length == 1 &&
-            vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var) &&
-            current->Get(var).To(&value) &&
-            (value == nullptr ||
-             NodeProperties::GetType(value).Is(access.type))) {
-          // The {object} has no elements, and we know that the LoadElement
-          // {index} must be within bounds, thus it must always yield this
-          // one element of {object}.
-          current->SetReplacement(value);
-          break;
-        } else if (length == 2 &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var0) &&
-                   current->Get(var0).To(&value0) &&
-                   (value0 == nullptr ||
-                    NodeProperties::GetType(value0).Is(access.type)) &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 1)).To(&var1) &&
-                   current->Get(var1).To(&value1) &&
-                   (value1 == nullptr ||
-                    NodeProperties::GetType(value1).Is(access.type))) {
-          if (value0 && value1) {
-            // The {object} has exactly two elements, so the LoadElement
-            // must return one of them (i.e. either the element at index
-            // 0 or the one at index 1). So we can turn the LoadElement
-            // into a Select operation instead (still allowing the {object}
-            // to be scalar replaced). We must however mark the elements
-            // of the {object} itself as escaping.
-            Node* check =
-                jsgraph->graph()->NewNode(jsgraph->simplified()->NumberEqual(),
-                                          index, jsgraph->ZeroConstant());
-            NodeProperties::SetType(check, Type::Boolean());
-            Node* select = jsgraph->graph()->NewNode(
-                jsgraph->common()->Select(access.machine_type.representation()),
-                check, value0, value1);
-            NodeProperties::SetType(select, access.type);
+        if (length >= 1 && length <= kMaxElementsForSelectReplacement) {
+          base::SmallVector<Node*, kMaxElementsForSelectReplacement> values;
+          bool all_known = true;
+          for (int i = 0; i < length; ++i) {
+            if (!vobject->FieldAt(OffsetOfElementAt(access, i)).To(&var) ||
+                !current->Get(var).To(&value) ||
+                (value != nullptr &&
+                 !NodeProperties::GetType(value).Is(access.type))) {
+              all_known = false;
+              break;
+            }
+            values.push_back(value);
+          }
+          if (all_known) {
+            if (std::find(values.begin(), values.end(), nullptr) !=
+                values.end()) {
+              // If the variables have no values, we have
+              // not reached the fixed-point yet.
+              break;
+            }
+            if (length == 1) {
+              // The {object} has exactly one element, and we know that the
+              // LoadElement {index} must be within bounds, thus it must
+              // always yield this one element of {object}.
+              current->SetReplacement(values[0]);
+              break;
+            }
+            // The {object} has only a few elements, so the LoadElement must
+            // return one of them. We can turn the LoadElement into a chain
+            // of Select operations instead (still allowing the {object} to
+            // be scalar replaced). We must however mark the elements of the
+            // {object} itself as escaping.
+            Node* select = values[length - 1];
+            for (int i = length - 2; i >= 0; --i) {
+              Node* constant = jsgraph->Constant(i);
+              if (!NodeProperties::IsTyped(constant)) {
+                NodeProperties::SetType(
+                    constant, Type::Constant(i, jsgraph->graph()->zone()));
+              }
+              Node* check = jsgraph->graph()->NewNode(
+                  jsgraph->simplified()->NumberEqual(), index, constant);
+              NodeProperties::SetType(check, Type::Boolean());
+              select = jsgraph->graph()->NewNode(
+                  jsgraph->common()->Select(
+                      access.machine_type.representation()),
+                  check, values[i], select);
+              NodeProperties::SetType(select, access.type);
+            }
             current->SetReplacement(select);
-            current->SetEscaped(value0);
-            current->SetEscaped(value1);
-            break;
-          } else {
-            // If the variables have no values, we have
-            // not reached the fixed-point yet.
+            for (Node* element : values) current->SetEscaped(element);
             break;
           }
         }
@@ -7,6 +7,8 @@
 #ifdef ENABLE_SLOW_DCHECKS
 #include <algorithm>
 #endif
+#include <string>
+#include <vector>
 
 #include "src/api/api-inl.h"
 #include "src/ast/modules.h"
@@ -23,7 +25,9 @@
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/literal-objects-inl.h"
 #include "src/objects/property-cell.h"
+#include "src/objects/string-inl.h"
 #include "src/objects/template-objects-inl.h"
+#include "src/strings/unicode-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -3265,6 +3269,40 @@ base::Optional<double> StringRef::ToNumber() {
   return data()->AsString()->to_number();
 }
 
+base::Optional<std::string> StringRef::ToStdString() const {
+  if (data_->should_access_heap() &&
+      data_->kind() == kNeverSerializedHeapObject && !SupportedStringKind()) {
+    TRACE_BROKER_MISSING(
+        broker(),
+        "contents for kNeverSerialized unsupported string kind " << *this);
+    return base::nullopt;
+  }
+
+  std::vector<uint16_t> chars;
+  {
+    SharedStringAccessGuardIfNeeded access_guard(
+        broker()->local_isolate_or_isolate());
+    String string = *object();
+    chars.resize(string.length(kAcquireLoad));
+    String::WriteToFlat(string, chars.data(), 0, static_cast<int>(chars.size()),
+                        access_guard);
+  }
+
+  std::string result;
+  for (size_t i = 0; i < chars.size(); i++) {
+    unibrow::uchar c = chars[i];
+    if (i + 1 < chars.size() &&
+        unibrow::Utf16::IsSurrogatePair(chars[i], chars[i + 1])) {
+      c = unibrow::Utf16::CombineSurrogatePair(chars[i], chars[i + 1]);
+      i++;
+    }
+    char buffer[unibrow::Utf8::kMaxEncodedSize];
+    result.append(buffer, unibrow::Utf8::Encode(
+                              buffer, c, unibrow::Utf16::kNoPreviousCharacter));
+  }
+  return result;
+}
+
 int ArrayBoilerplateDescriptionRef::constants_elements_length() const {
   if (data_->should_access_heap()) {
     return object()->constant_elements().length();
@@ -3596,6 +3634,24 @@ BytecodeArrayRef SharedFunctionInfoRef::GetBytecodeArray() const {
   BIMODAL_ACCESSOR_WITH_FLAG_C(SharedFunctionInfo, type, name)
 BROKER_SFI_FIELDS(DEF_SFI_ACCESSOR)
 #undef DEF_SFI_ACCESSOR
+
+base::Optional<std::string> SharedFunctionInfoRef::DebugName() const {
+  if (broker()->IsMainThread()) {
+    return std::string(object()->DebugNameCStr().get());
+  }
+  // The inferred name is usually a cons string, which can't be read
+  // concurrently; in that case no name is returned.
+  base::Optional<StringRef> name = TryMakeRef(broker(), object()->Name());
+  if (!name.has_value()) return base::nullopt;
+  base::Optional<int> length = name->length();
+  if (!length.has_value()) return base::nullopt;
+  if (*length == 0) {
+    name = TryMakeRef(broker(), object()->inferred_name());
+    if (!name.has_value()) return base::nullopt;
+  }
+  return name->ToStdString();
+}
+
 SharedFunctionInfo::Inlineability SharedFunctionInfoRef::GetInlineability()
     const {
   if (data_->should_access_heap()) {
@@ -4307,6 +4363,12 @@ bool NameRef::IsUniqueName() const {
   return IsInternalizedString() || IsSymbol();
 }
 
+bool NameRef::IsPrivateBrand() const {
+  // The private brand bit is set when the symbol is created and never
+  // changes afterwards, so it is safe to read from the background thread.
+  return IsSymbol() && AsSymbol().object()->is_private_brand();
+}
+
 void RegExpBoilerplateDescriptionRef::Serialize() {
   // TODO(jgruber,v8:7790): Remove once member types are also never serialized.
   // Until then, we have to call these functions once on the main thread to
@@ -5,6 +5,8 @@
 #ifndef V8_COMPILER_HEAP_REFS_H_
 #define V8_COMPILER_HEAP_REFS_H_
 
+#include <string>
+
 #include "src/base/optional.h"
 #include "src/ic/call-optimization.h"
 #include "src/objects/elements-kind.h"
@@ -568,6 +570,7 @@ class NameRef : public HeapObjectRef {
   Handle<Name> object() const;
 
   bool IsUniqueName() const;
+  bool IsPrivateBrand() const;
 };
 
 class DescriptorArrayRef : public HeapObjectRef {
@@ -922,6 +925,10 @@ class V8_EXPORT_PRIVATE SharedFunctionInfoRef : public HeapObjectRef {
   BytecodeArrayRef GetBytecodeArray() const;
   SharedFunctionInfo::Inlineability GetInlineability() const;
 
+  // Like SharedFunctionInfo::DebugNameCStr, but safe to call from background
+  // threads. Returns base::nullopt if the name can't be read concurrently.
+  base::Optional<std::string> DebugName() const;
+
 #define DECL_ACCESSOR(type, name) type name() const;
   BROKER_SFI_FIELDS(DECL_ACCESSOR)
 #undef DECL_ACCESSOR
@@ -954,6 +961,8 @@ class StringRef : public NameRef {
   base::Optional<int> length() const;
   base::Optional<uint16_t> GetFirstChar();
   base::Optional<double> ToNumber();
+  // Returns the contents in UTF-8.
+  base::Optional<std::string> ToStdString() const;
 
   bool IsSeqString() const;
   bool IsExternalString() const;
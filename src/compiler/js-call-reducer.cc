@@ -38,6 +38,10 @@
 #include "src/objects/objects-inl.h"
 #include "src/objects/ordered-hash-table.h"
 
+#if V8_ENABLE_WEBASSEMBLY
+#include "src/wasm/wasm-module.h"
+#endif  // V8_ENABLE_WEBASSEMBLY
+
 namespace v8 {
 namespace internal {
 namespace compiler {
@@ -3436,7 +3440,12 @@ Reduction JSCallReducer::ReduceArraySome(Node* node,
 
 namespace {
 
-bool CanInlineJSToWasmCall(const wasm::FunctionSig* wasm_signature) {
+bool CanInlineJSToWasmCall(const wasm::WasmModule* wasm_module,
+                           const wasm::FunctionSig* wasm_signature) {
+  // asm.js modules are translated from JS and rarely benefit from inlining;
+  // keep them on the generic wrapper.
+  if (wasm::is_asmjs_module(wasm_module)) return false;
+
   if (wasm_signature->return_count() > 1) {
     return false;
   }
@@ -3468,15 +3477,15 @@ Reduction JSCallReducer::ReduceCallWasmFunction(
     return NoChange();
   }
 
+  const wasm::WasmModule* wasm_module = shared.wasm_module();
   const wasm::FunctionSig* wasm_signature = shared.wasm_function_signature();
-  if (!CanInlineJSToWasmCall(wasm_signature)) {
+  if (!CanInlineJSToWasmCall(wasm_module, wasm_signature)) {
     return NoChange();
   }
 
   // Signal TurboFan that it should run the 'wasm-inlining' phase.
   has_wasm_calls_ = true;
 
-  const wasm::WasmModule* wasm_module = shared.wasm_module();
   const Operator* op =
       javascript()->CallWasm(wasm_module, wasm_signature, p.feedback());
 
@@ -3516,6 +3525,11 @@ bool HasFPParamsInSignature(const CFunctionInfo* c_signature) {
     return true;
   }
   for (unsigned int i = 0; i < c_signature->ArgumentCount(); ++i) {
+    // Typed arrays are passed by pointer.
+    if (c_signature->ArgumentInfo(i).GetSequenceType() !=
+        CTypeInfo::SequenceType::kScalar) {
+      continue;
+    }
     if (c_signature->ArgumentInfo(i).GetType() == CTypeInfo::Type::kFloat32 ||
         c_signature->ArgumentInfo(i).GetType() == CTypeInfo::Type::kFloat64) {
       return true;
@@ -3534,6 +3548,11 @@ bool Has64BitIntegerParamsInSignature(const CFunctionInfo* c_signature) {
     return true;
   }
   for (unsigned int i = 0; i < c_signature->ArgumentCount(); ++i) {
+    // Typed arrays are passed by pointer.
+    if (c_signature->ArgumentInfo(i).GetSequenceType() !=
+        CTypeInfo::SequenceType::kScalar) {
+      continue;
+    }
     if (c_signature->ArgumentInfo(i).GetType() == CTypeInfo::Type::kInt64 ||
         c_signature->ArgumentInfo(i).GetType() == CTypeInfo::Type::kUint64) {
       return true;
@@ -3544,6 +3563,31 @@ bool Has64BitIntegerParamsInSignature(const CFunctionInfo* c_signature) {
 }  // namespace
 #endif
 
+namespace {
+// Returns whether the lowering supports all argument types of {c_signature}.
+// Sequences and ArrayBuffers are not supported yet, and typed arrays only
+// with a specific element type.
+bool HasSupportedArgumentTypes(const CFunctionInfo* c_signature) {
+  for (unsigned int i = 0; i < c_signature->ArgumentCount(); ++i) {
+    const CTypeInfo& arg_type = c_signature->ArgumentInfo(i);
+    switch (arg_type.GetSequenceType()) {
+      case CTypeInfo::SequenceType::kScalar:
+        break;
+      case CTypeInfo::SequenceType::kIsTypedArray:
+        if (!CTypeInfo::IsPrimitive(arg_type.GetType()) ||
+            arg_type.GetType() == CTypeInfo::Type::kBool) {
+          return false;
+        }
+        break;
+      case CTypeInfo::SequenceType::kIsSequence:
+      case CTypeInfo::SequenceType::kIsArrayBuffer:
+        return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
 // Given a FunctionTemplateInfo, checks whether the fast API call can be
 // optimized, applying the initial step of the overload resolution algorithm:
 // Given an overload set function_template_info.c_signatures, and a list of
@@ -3586,7 +3630,8 @@ ZoneVector<std::pair<Address, const CFunctionInfo*>> CanOptimizeFastCall(
   for (size_t i = 0; i < overloads_count; i++) {
     const CFunctionInfo* c_signature = signatures[i];
     const size_t len = c_signature->ArgumentCount() - kReceiver;
-    bool optimize_to_fast_call = (len == arg_count);
+    bool optimize_to_fast_call =
+        (len == arg_count) && HasSupportedArgumentTypes(c_signature);
 
 #ifndef V8_ENABLE_FP_PARAMS_IN_C_LINKAGE
     optimize_to_fast_call =
@@ -8,6 +8,7 @@
 #include "src/compiler/common-operator.h"
 #include "src/compiler/compiler-source-position-table.h"
 #include "src/compiler/js-heap-broker.h"
+#include "src/compiler/js-inlining-profile.h"
 #include "src/compiler/node-matchers.h"
 #include "src/compiler/simplified-operator.h"
 #include "src/objects/objects-inl.h"
@@ -249,6 +250,21 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     return InlineCandidate(candidate, true);
   }
 
+  // Call sites whose callees were hot in previous runs get the remaining
+  // budget first.
+  if (const InliningProfile* profile = InliningProfile::Get()) {
+    for (int i = 0; i < candidate.num_functions; ++i) {
+      if (!candidate.can_inline_function[i]) continue;
+      SharedFunctionInfoRef shared =
+          candidate.functions[i].has_value()
+              ? candidate.functions[i].value().shared()
+              : candidate.shared_info.value();
+      base::Optional<std::string> name = shared.DebugName();
+      if (!name.has_value()) continue;
+      candidate.profile_count += profile->GetInvocationCount(*name);
+    }
+  }
+
   // In the general case we remember the candidate for later.
   candidates_.insert(candidate);
   return NoChange();
@@ -767,6 +783,9 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
 
 bool JSInliningHeuristic::CandidateCompare::operator()(
     const Candidate& left, const Candidate& right) const {
+  if (left.profile_count != right.profile_count) {
+    return left.profile_count > right.profile_count;
+  }
   if (right.frequency.IsUnknown()) {
     if (left.frequency.IsUnknown()) {
       // If left and right are both unknown then the ordering is indeterminate,
@@ -791,8 +810,11 @@ void JSInliningHeuristic::PrintCandidates() {
   os << candidates_.size() << " candidate(s) for inlining:" << std::endl;
   for (const Candidate& candidate : candidates_) {
     os << "- candidate: " << candidate.node->op()->mnemonic() << " node #"
-       << candidate.node->id() << " with frequency " << candidate.frequency
-       << ", " << candidate.num_functions << " target(s):" << std::endl;
+       << candidate.node->id() << " with frequency " << candidate.frequency;
+    if (candidate.profile_count > 0) {
+      os << ", profile count " << candidate.profile_count;
+    }
+    os << ", " << candidate.num_functions << " target(s):" << std::endl;
     for (int i = 0; i < candidate.num_functions; ++i) {
       SharedFunctionInfoRef shared = candidate.functions[i].has_value()
                                          ? candidate.functions[i]->shared()
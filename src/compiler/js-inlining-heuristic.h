@@ -62,6 +62,8 @@ class JSInliningHeuristic final : public AdvancedReducer {
     Node* node = nullptr;     // The call site at which to inline.
     CallFrequency frequency;  // Relative frequency of this call site.
     int total_size = 0;
+    // How often the callees were entered according to the InliningProfile.
+    double profile_count = 0;
   };
 
   // Comparator for candidates.
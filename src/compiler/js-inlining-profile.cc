@@ -0,0 +1,83 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/js-inlining-profile.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "src/builtins/profile-data-reader.h"
+#include "src/flags/flags.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+// The entry block of every instrumented function has ID 0, so its counter is
+// the number of times the function was entered.
+constexpr uint32_t kEntryBlockId = 0;
+
+}  // namespace
+
+InliningProfile::InliningProfile(std::istream& stream) {
+  for (std::string line; std::getline(stream, line);) {
+    std::string token;
+    std::istringstream line_stream(line);
+    if (!std::getline(line_stream, token, ',')) continue;
+    if (token != ProfileDataFromFileConstants::kBlockCounterMarker) continue;
+    // As defined by Logger::BasicBlockCounterEvent, the format is:
+    //   literal kBlockCounterMarker , function_name , block_id , usage_count
+    // Malformed lines are skipped, since the log may contain unrelated or
+    // truncated records.
+    std::string function_name;
+    if (!std::getline(line_stream, function_name, ',')) continue;
+    if (!std::getline(line_stream, token, ',')) continue;
+    char* end = nullptr;
+    uint32_t id = static_cast<uint32_t>(strtoul(token.c_str(), &end, 0));
+    if (end == token.c_str() || id != kEntryBlockId) continue;
+    if (!std::getline(line_stream, token, ',')) continue;
+    double count = strtod(token.c_str(), &end);
+    if (end == token.c_str()) continue;
+    // Functions are identified by name only, so functions of the same name and
+    // repeated compilations of the same function are summed up.
+    invocation_counts_[function_name] += count;
+  }
+}
+
+// static
+const InliningProfile* InliningProfile::Get() {
+  // The profile is intentionally leaked, it lives as long as the process.
+  static const InliningProfile* const profile = ReadFromFlag();
+  return profile;
+}
+
+// static
+const InliningProfile* InliningProfile::ReadFromFlag() {
+  const char* filename = FLAG_turbo_inlining_profile;
+  if (filename == nullptr) return nullptr;
+  std::ifstream file(filename);
+  if (!file.good()) {
+    PrintF("Can't read inlining profile %s, ignoring it.\n", filename);
+    return nullptr;
+  }
+  InliningProfile* profile = new InliningProfile(file);
+  if (FLAG_trace_turbo_inlining) {
+    PrintF("Read inlining profile for %zu functions from %s\n",
+           profile->size(), filename);
+  }
+  return profile;
+}
+
+double InliningProfile::GetInvocationCount(
+    const std::string& function_name) const {
+  auto it = invocation_counts_.find(function_name);
+  return it == invocation_counts_.end() ? 0 : it->second;
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,51 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_JS_INLINING_PROFILE_H_
+#define V8_COMPILER_JS_INLINING_PROFILE_H_
+
+#include <istream>
+#include <string>
+#include <unordered_map>
+
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Invocation counts of JavaScript functions, taken from the basic block
+// counters that a --turbo-profiling-log-functions run writes to v8.log. Logs
+// of several runs (or several machines) can simply be concatenated. The
+// inlining heuristic uses the counts to spend its cumulative budget on call
+// sites whose callee was hot in previous runs.
+class V8_EXPORT_PRIVATE InliningProfile final {
+ public:
+  // Parses all basic block counter records from {stream}.
+  explicit InliningProfile(std::istream& stream);
+  InliningProfile(const InliningProfile&) = delete;
+  InliningProfile& operator=(const InliningProfile&) = delete;
+
+  // Returns the profile given by --turbo-inlining-profile, or nullptr if no
+  // profile was passed. The file is read once per process; this is safe to
+  // call from background threads.
+  static const InliningProfile* Get();
+
+  // Returns how many times the optimized code of the function with the given
+  // debug name was entered while profiling, or 0 if the function is unknown.
+  double GetInvocationCount(const std::string& function_name) const;
+
+  size_t size() const { return invocation_counts_.size(); }
+
+ private:
+  static const InliningProfile* ReadFromFlag();
+
+  std::unordered_map<std::string, double> invocation_counts_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_JS_INLINING_PROFILE_H_
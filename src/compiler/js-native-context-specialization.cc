@@ -2402,6 +2402,13 @@ JSNativeContextSpecialization::BuildPropertyLoad(
           access_builder.FoldLoadDictPrototypeConstant(access_info);
       if (!maybe_value) return {};
       value = maybe_value.value();
+    } else if (name.IsPrivateBrand() && access_info.holder().is_null()) {
+      // Loading a private brand is only ever done as a brand check for a
+      // private method or accessor, and the bytecode discards the loaded
+      // value. The map checks on the {lookup_start_object} already prove
+      // the presence of the brand, so the field does not need to be read.
+      DCHECK_EQ(receiver, lookup_start_object);
+      value = jsgraph()->UndefinedConstant();
     } else {
       value = access_builder.BuildLoadDataField(
           name, access_info, lookup_start_object, &effect, &control);
@@ -211,6 +211,18 @@ void LoopVariableOptimizer::TakeConditionsFromFirstControl(Node* node) {
   limits_.Set(node, limits_.Get(NodeProperties::GetControlInput(node, 0)));
 }
 
+bool LoopVariableOptimizer::IsKnownStrictlyLessThan(Node* control, Node* left,
+                                                    Node* right) {
+  DCHECK_GT(control->op()->ControlOutputCount(), 0);
+  for (Constraint constraint : limits_.Get(control)) {
+    if (constraint.left == left && constraint.right == right &&
+        constraint.kind == InductionVariable::kStrict) {
+      return true;
+    }
+  }
+  return false;
+}
+
 const InductionVariable* LoopVariableOptimizer::FindInductionVariable(
     Node* node) {
   auto var = induction_vars_.find(node->id());
@@ -81,6 +81,12 @@ class LoopVariableOptimizer {
   void ChangeToInductionVariablePhis();
   void ChangeToPhisAndInsertGuards();
 
+  // Returns true if {left} < {right} is known to hold whenever control reaches
+  // {control}, because a branch on that comparison dominates {control}. Only
+  // comparisons that involve an induction variable are tracked. Must be called
+  // after Run().
+  bool IsKnownStrictlyLessThan(Node* control, Node* left, Node* right);
+
  private:
   const int kAssumedLoopEntryIndex = 0;
   const int kFirstBackedge = 1;
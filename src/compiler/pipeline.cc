@@ -1007,6 +1007,24 @@ void AddReducer(PipelineData* data, GraphReducer* graph_reducer,
   graph_reducer->AddReducer(reducer);
 }
 
+// Optional phases buy little on huge graphs compared to the compile time they
+// cost there, so they are skipped above --turbo-optional-phase-node-limit.
+bool ExceedsOptionalPhaseBudget(PipelineData* data, const char* phase_name) {
+  if (FLAG_turbo_optional_phase_node_limit <= 0) return false;
+  size_t const node_count = data->graph()->NodeCount();
+  if (node_count <=
+      static_cast<size_t>(FLAG_turbo_optional_phase_node_limit)) {
+    return false;
+  }
+  if (data->info()->trace_turbo_graph()) {
+    CodeTracer::StreamScope tracing_scope(data->GetCodeTracer());
+    tracing_scope.stream() << "---- Skipping " << phase_name << ": graph has "
+                           << node_count << " nodes, limit is "
+                           << FLAG_turbo_optional_phase_node_limit << "\n";
+  }
+  return true;
+}
+
 PipelineStatistics* CreatePipelineStatistics(Handle<Script> script,
                                              OptimizedCompilationInfo* info,
                                              Isolate* isolate,
@@ -1279,6 +1297,10 @@ PipelineCompilationJob::Status PipelineCompilationJob::FinalizeJobImpl(
   Handle<NativeContext> context(compilation_info()->native_context(), isolate);
   if (CodeKindCanDeoptimize(code->kind())) context->AddOptimizedCode(*code);
   RegisterWeakObjectsInOptimizedCode(isolate, context, code);
+  // The peak is sampled whenever a zone is returned, which includes the
+  // temporary zone of every phase.
+  isolate->counters()->turbofan_optimize_peak_memory_bytes()->AddSample(
+      static_cast<int>(zone_stats_.GetMaxAllocatedBytes()));
   return SUCCEEDED;
 }
 
@@ -2252,7 +2274,8 @@ struct InstructionSelectionPhase {
             ? InstructionSelector::kAllSourcePositions
             : InstructionSelector::kCallSourcePositions,
         InstructionSelector::SupportedFeatures(),
-        FLAG_turbo_instruction_scheduling
+        FLAG_turbo_instruction_scheduling &&
+                !ExceedsOptionalPhaseBudget(data, "V8.TFInstructionScheduling")
             ? InstructionSelector::kEnableScheduling
             : InstructionSelector::kDisableScheduling,
         data->roots_relative_addressing_enabled()
@@ -2765,7 +2788,8 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   Run<TypedLoweringPhase>();
   RunPrintAndVerify(TypedLoweringPhase::phase_name());
 
-  if (data->info()->loop_peeling()) {
+  if (data->info()->loop_peeling() &&
+      !ExceedsOptionalPhaseBudget(data, LoopPeelingPhase::phase_name())) {
     Run<LoopPeelingPhase>();
     RunPrintAndVerify(LoopPeelingPhase::phase_name(), true);
   } else {
@@ -2836,7 +2860,9 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   Run<EffectControlLinearizationPhase>();
   RunPrintAndVerify(EffectControlLinearizationPhase::phase_name(), true);
 
-  if (FLAG_turbo_store_elimination) {
+  if (FLAG_turbo_store_elimination &&
+      !ExceedsOptionalPhaseBudget(data,
+                                  StoreStoreEliminationPhase::phase_name())) {
     Run<StoreStoreEliminationPhase>();
     RunPrintAndVerify(StoreStoreEliminationPhase::phase_name(), true);
   }
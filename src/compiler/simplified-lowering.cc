@@ -17,6 +17,7 @@
 #include "src/compiler/compiler-source-position-table.h"
 #include "src/compiler/diamond.h"
 #include "src/compiler/linkage.h"
+#include "src/compiler/loop-variable-optimizer.h"
 #include "src/compiler/node-matchers.h"
 #include "src/compiler/node-observer.h"
 #include "src/compiler/node-origin-table.h"
@@ -1721,6 +1722,9 @@ class RepresentationSelector {
     FeedbackSource const& feedback = p.check_parameters().feedback();
     Type const index_type = TypeOf(node->InputAt(0));
     Type const length_type = TypeOf(node->InputAt(1));
+    // This has to look at the inputs before VisitBinop inserts conversions.
+    bool const bounded_by_loop_condition =
+        lower<T>() && lowering->IsBoundedByLoopCondition(node);
 
     // Conversions, if requested and needed, will be handled by the
     // representation changer, not by the lower-level Checked*Bounds operators.
@@ -1741,9 +1745,11 @@ class RepresentationSelector {
                   PoisoningMitigationLevel::kDontPoison &&
               (index_type.IsNone() || length_type.IsNone() ||
                (index_type.Min() >= 0.0 &&
-                index_type.Max() < length_type.Min()))) {
+                (index_type.Max() < length_type.Min() ||
+                 bounded_by_loop_condition)))) {
             // The bounds check is redundant if we already know that
-            // the index is within the bounds of [0.0, length[.
+            // the index is within the bounds of [0.0, length[, either from
+            // the types or from a dominating loop condition.
             // TODO(neis): Move this into TypedOptimization?
             new_flags |= CheckBoundsFlag::kAbortOnOutOfBounds;
           }
@@ -1786,9 +1792,14 @@ class RepresentationSelector {
     }
   }
 
-  UseInfo UseInfoForFastApiCallArgument(CTypeInfo::Type type,
+  UseInfo UseInfoForFastApiCallArgument(CTypeInfo type,
                                         FeedbackSource const& feedback) {
-    switch (type) {
+    // Typed arrays are checked and unpacked by the EffectControlLinearizer.
+    if (type.GetSequenceType() == CTypeInfo::SequenceType::kIsTypedArray) {
+      return UseInfo::AnyTagged();
+    }
+    DCHECK_EQ(type.GetSequenceType(), CTypeInfo::SequenceType::kScalar);
+    switch (type.GetType()) {
       case CTypeInfo::Type::kVoid:
         UNREACHABLE();
       case CTypeInfo::Type::kBool:
@@ -1831,7 +1842,7 @@ class RepresentationSelector {
     // Propagate representation information from TypeInfo.
     for (int i = 0; i < c_arg_count; i++) {
       arg_use_info[i] = UseInfoForFastApiCallArgument(
-          c_signature->ArgumentInfo(i).GetType(), op_params.feedback());
+          c_signature->ArgumentInfo(i), op_params.feedback());
       ProcessInput<T>(node, i + FastApiCallNode::kFastTargetInputCount,
                       arg_use_info[i]);
     }
@@ -4220,11 +4231,28 @@ SimplifiedLowering::SimplifiedLowering(
       observe_node_manager_(observe_node_manager) {}
 
 void SimplifiedLowering::LowerAllNodes() {
+  // Collect the loop conditions before any node is lowered, so that they can
+  // be matched against the inputs of CheckBounds nodes.
+  LoopVariableOptimizer loop_variables(graph(), common(), zone_);
+  if (FLAG_turbo_loop_bounds_check_elimination) {
+    loop_variables.Run();
+    loop_variables_ = &loop_variables;
+  }
   RepresentationChanger changer(jsgraph(), broker_);
   RepresentationSelector selector(
       jsgraph(), broker_, zone_, &changer, source_positions_, node_origins_,
       tick_counter_, linkage_, observe_node_manager_);
   selector.Run(this);
+  loop_variables_ = nullptr;
+}
+
+bool SimplifiedLowering::IsBoundedByLoopCondition(Node* node) {
+  DCHECK_EQ(IrOpcode::kCheckBounds, node->opcode());
+  if (loop_variables_ == nullptr) return false;
+  Node* index = node->InputAt(0);
+  Node* length = node->InputAt(1);
+  Node* control = NodeProperties::GetControlInput(node);
+  return loop_variables_->IsKnownStrictlyLessThan(control, index, length);
 }
 
 void SimplifiedLowering::DoJSToNumberOrNumericTruncatesToFloat64(
@@ -19,6 +19,7 @@ class TickCounter;
 namespace compiler {
 
 // Forward declarations.
+class LoopVariableOptimizer;
 class NodeOriginTable;
 class ObserveNodeManager;
 class RepresentationChanger;
@@ -52,6 +53,11 @@ class V8_EXPORT_PRIVATE SimplifiedLowering final {
   void DoSigned32ToUint8Clamped(Node* node);
   void DoUnsigned32ToUint8Clamped(Node* node);
 
+  // Returns true if the index of the CheckBounds {node} is known to be less
+  // than its length, because a loop condition comparing the index (an
+  // induction variable) with the very same length node dominates {node}.
+  bool IsBoundedByLoopCondition(Node* node);
+
  private:
   // The purpose of this nested class is to hide method
   // v8::internal::compiler::NodeProperties::ChangeOp which should not be
@@ -90,6 +96,9 @@ class V8_EXPORT_PRIVATE SimplifiedLowering final {
 
   ObserveNodeManager* const observe_node_manager_;
 
+  // Dominating loop conditions, only available during LowerAllNodes.
+  LoopVariableOptimizer* loop_variables_ = nullptr;
+
   Node* Float64Round(Node* const node);
   Node* Float64Sign(Node* const node);
   Node* Int32Abs(Node* const node);
@@ -3810,6 +3810,14 @@ WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
   }
 
   if (use_trap_handler() && enforce_check == kCanOmitBoundsCheck) {
+    if (env_->module->is_memory64) {
+      // The guard regions only cover 32-bit indexes (plus offset), so
+      // explicitly check that the upper half of a memory64 index is zero.
+      DCHECK_EQ(kSystemPointerSize, kInt64Size);
+      Node* high_word = gasm_->TruncateInt64ToInt32(
+          gasm_->Word64Shr(index, Int32Constant(32)));
+      TrapIfTrue(wasm::kTrapMemOutOfBounds, high_word, position);
+    }
     return {index, kTrapHandler};
   }
 
@@ -5464,8 +5472,107 @@ Node* WasmGraphBuilder::StoreArgsInStackSlot(
   return stack_slot;
 }
 
+namespace {
+
+// memory.copy and memory.fill with a constant size of at most this many bytes
+// are emitted as inline loads and stores instead of a call to C.
+constexpr uint32_t kMaxInlineBulkMemorySize = 64;
+
+// Returns the size of the largest chunk to use for inline bulk memory
+// operations on {remaining} bytes.
+uint32_t InlineBulkMemoryChunkSize(uint32_t remaining) {
+  uint32_t chunk = kSystemPointerSize;
+  while (chunk > remaining) chunk >>= 1;
+  return chunk;
+}
+
+MachineType InlineBulkMemoryChunkType(uint32_t chunk_size) {
+  switch (chunk_size) {
+    case 8:
+      return MachineType::Uint64();
+    case 4:
+      return MachineType::Uint32();
+    case 2:
+      return MachineType::Uint16();
+    case 1:
+      return MachineType::Uint8();
+  }
+  UNREACHABLE();
+}
+
+}  // namespace
+
+bool WasmGraphBuilder::IsInlineBulkMemorySize(Node* size,
+                                              uint32_t* constant_size) {
+  if (env_->module->is_memory64) return false;
+  Int32Matcher match(size);
+  if (!match.HasResolvedValue()) return false;
+  uint32_t value = static_cast<uint32_t>(match.ResolvedValue());
+  // A size of zero still needs the bounds checks of the C function.
+  if (value == 0 || value > kMaxInlineBulkMemorySize) return false;
+  *constant_size = value;
+  return true;
+}
+
+void WasmGraphBuilder::BuildInlineMemoryCopy(Node* dst, Node* src,
+                                             uint32_t size,
+                                             wasm::WasmCodePosition position) {
+  // Check both ranges before accessing memory, so that an out-of-bounds copy
+  // traps without having written anything.
+  dst = BoundsCheckMem(size, dst, 0, position, kNeedsBoundsCheck).first;
+  src = BoundsCheckMem(size, src, 0, position, kNeedsBoundsCheck).first;
+
+  // Load all chunks before storing any of them; this gives {memmove}
+  // semantics for overlapping ranges.
+  base::SmallVector<Node*, kMaxInlineBulkMemorySize / kSystemPointerSize + 3>
+      chunks;
+  for (uint32_t offset = 0; offset < size;) {
+    uint32_t chunk_size = InlineBulkMemoryChunkSize(size - offset);
+    chunks.push_back(gasm_->LoadUnaligned(InlineBulkMemoryChunkType(chunk_size),
+                                          MemBuffer(offset), src));
+    offset += chunk_size;
+  }
+  size_t chunk_index = 0;
+  for (uint32_t offset = 0; offset < size;) {
+    uint32_t chunk_size = InlineBulkMemoryChunkSize(size - offset);
+    MachineRepresentation rep =
+        InlineBulkMemoryChunkType(chunk_size).representation();
+    gasm_->StoreUnaligned(UnalignedStoreRepresentation{rep}, MemBuffer(offset),
+                          dst, chunks[chunk_index++]);
+    offset += chunk_size;
+  }
+}
+
+void WasmGraphBuilder::BuildInlineMemoryFill(Node* dst, Node* value,
+                                             uint32_t size,
+                                             wasm::WasmCodePosition position) {
+  dst = BoundsCheckMem(size, dst, 0, position, kNeedsBoundsCheck).first;
+
+  // Replicate the low byte of {value} into every byte of a word.
+  Node* low_byte = gasm_->Word32And(value, Int32Constant(0xFF));
+  Node* pattern32 = gasm_->Int32Mul(low_byte, Int32Constant(0x01010101));
+  Node* pattern64 = nullptr;
+  if (kSystemPointerSize == 8 && size >= 8) {
+    Node* low = gasm_->ChangeUint32ToUint64(pattern32);
+    pattern64 = gasm_->Word64Or(low, gasm_->Word64Shl(low, Int32Constant(32)));
+  }
+  for (uint32_t offset = 0; offset < size;) {
+    uint32_t chunk_size = InlineBulkMemoryChunkSize(size - offset);
+    MachineRepresentation rep =
+        InlineBulkMemoryChunkType(chunk_size).representation();
+    gasm_->StoreUnaligned(UnalignedStoreRepresentation{rep}, MemBuffer(offset),
+                          dst, chunk_size == 8 ? pattern64 : pattern32);
+    offset += chunk_size;
+  }
+}
+
 void WasmGraphBuilder::MemoryCopy(Node* dst, Node* src, Node* size,
                                   wasm::WasmCodePosition position) {
+  uint32_t constant_size;
+  if (IsInlineBulkMemorySize(size, &constant_size)) {
+    return BuildInlineMemoryCopy(dst, src, constant_size, position);
+  }
+
   Node* function =
       gasm_->ExternalConstant(ExternalReference::wasm_memory_copy());
 
@@ -5483,6 +5590,11 @@ void WasmGraphBuilder::MemoryCopy(Node* dst, Node* src, Node* size,
 
 void WasmGraphBuilder::MemoryFill(Node* dst, Node* value, Node* size,
                                   wasm::WasmCodePosition position) {
+  uint32_t constant_size;
+  if (IsInlineBulkMemorySize(size, &constant_size)) {
+    return BuildInlineMemoryFill(dst, value, constant_size, position);
+  }
+
   Node* function =
       gasm_->ExternalConstant(ExternalReference::wasm_memory_fill());
 
@@ -5558,12 +5670,62 @@ void WasmGraphBuilder::TableFill(uint32_t table_index, Node* start, Node* value,
       count, value);
 }
 
+Node* WasmGraphBuilder::BuildAllocateStruct(const wasm::StructType* type,
+                                            Node* rtt) {
+  // The size of the struct is known statically, so the common case can bump
+  // the young generation's allocation top inline and only fall back to the
+  // allocation builtin when the linear allocation area is exhausted.
+  int size = WasmStruct::Size(type);
+  if (!FLAG_wasm_inline_allocation || !FLAG_inline_new ||
+      FLAG_single_generation || FLAG_gc_interval != 0 ||
+      size > kMaxRegularHeapObjectSize || !IsAligned(size, kObjectAlignment)) {
+    return gasm_->CallBuiltin(Builtin::kWasmAllocateStructWithRtt,
+                              Operator::kEliminatable, rtt);
+  }
+
+  auto slow_path = gasm_->MakeDeferredLabel();
+  auto done = gasm_->MakeLabel(MachineRepresentation::kTaggedPointer);
+
+  Node* top_address =
+      LOAD_INSTANCE_FIELD(NewAllocationTopAddress, MachineType::Pointer());
+  Node* limit_address =
+      LOAD_INSTANCE_FIELD(NewAllocationLimitAddress, MachineType::Pointer());
+  Node* top = gasm_->Load(MachineType::Pointer(), top_address, 0);
+  Node* limit = gasm_->Load(MachineType::Pointer(), limit_address, 0);
+  Node* new_top = gasm_->IntAdd(top, gasm_->IntPtrConstant(size));
+  gasm_->GotoIf(gasm_->UintLessThan(limit, new_top), &slow_path);
+
+  gasm_->Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                                   kNoWriteBarrier),
+               top_address, 0, new_top);
+  Node* object = gasm_->BitcastWordToTagged(
+      gasm_->IntAdd(top, gasm_->IntPtrConstant(kHeapObjectTag)));
+  // The object is freshly allocated in the young generation, so initializing
+  // its header does not need write barriers.
+  gasm_->StoreToObject(
+      ObjectAccess(MachineType::TaggedPointer(), kNoWriteBarrier), object,
+      wasm::ObjectAccess::ToTagged(HeapObject::kMapOffset), rtt);
+  gasm_->StoreToObject(
+      ObjectAccess(MachineType::TaggedPointer(), kNoWriteBarrier), object,
+      wasm::ObjectAccess::ToTagged(JSReceiver::kPropertiesOrHashOffset),
+      LOAD_ROOT(EmptyFixedArray, empty_fixed_array));
+  gasm_->Goto(&done, object);
+
+  gasm_->Bind(&slow_path);
+  // The builtin moves the allocation top loaded above, so it must not be
+  // marked as eliminatable here.
+  gasm_->Goto(&done, gasm_->CallBuiltin(Builtin::kWasmAllocateStructWithRtt,
+                                        Operator::kNoThrow, rtt));
+
+  gasm_->Bind(&done);
+  return done.PhiAt(0);
+}
+
 Node* WasmGraphBuilder::StructNewWithRtt(uint32_t struct_index,
                                          const wasm::StructType* type,
                                          Node* rtt,
                                          base::Vector<Node*> fields) {
-  Node* s = gasm_->CallBuiltin(Builtin::kWasmAllocateStructWithRtt,
-                               Operator::kEliminatable, rtt);
+  Node* s = BuildAllocateStruct(type, rtt);
   for (uint32_t i = 0; i < type->field_count(); i++) {
     gasm_->StoreStructField(s, type, i, fields[i]);
   }
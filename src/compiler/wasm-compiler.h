@@ -535,6 +535,8 @@ class WasmGraphBuilder {
   Node* GetInstance();
   Node* BuildLoadIsolateRoot();
 
+  Node* BuildAllocateStruct(const wasm::StructType* type, Node* rtt);
+
   // MemBuffer is only called with valid offsets (after bounds checking), so the
   // offset fits in a platform-dependent uintptr_t.
   Node* MemBuffer(uintptr_t offset);
@@ -752,6 +754,14 @@ class WasmGraphBuilder {
   Node* StoreArgsInStackSlot(
       std::initializer_list<std::pair<MachineRepresentation, Node*>> args);
 
+  // Returns whether {size} is a small constant for which bulk memory
+  // operations are emitted inline, and stores it in {constant_size} if so.
+  bool IsInlineBulkMemorySize(Node* size, uint32_t* constant_size);
+  void BuildInlineMemoryCopy(Node* dst, Node* src, uint32_t size,
+                             wasm::WasmCodePosition position);
+  void BuildInlineMemoryFill(Node* dst, Node* value, uint32_t size,
+                             wasm::WasmCodePosition position);
+
   std::unique_ptr<WasmGraphAssembler> gasm_;
   Zone* const zone_;
   MachineGraph* const mcgraph_;
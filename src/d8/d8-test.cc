@@ -126,6 +126,54 @@ class FastCApiObject {
     args.GetReturnValue().Set(Number::New(isolate, sum));
   }
 
+  static int32_t AddAllInt32TypedArrayFastCallback(
+      Local<Object> receiver, bool should_fallback,
+      const FastApiTypedArray<int32_t>& typed_array_arg,
+      FastApiCallbackOptions& options) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_SELF_OR_FALLBACK(0);
+    self->fast_call_count_++;
+
+    if (should_fallback) {
+      options.fallback = 1;
+      return 0;
+    }
+
+    int32_t sum = 0;
+    for (size_t i = 0; i < typed_array_arg.length; ++i) {
+      sum += typed_array_arg.data[i];
+    }
+    return sum;
+  }
+  static void AddAllInt32TypedArraySlowCallback(
+      const FunctionCallbackInfo<Value>& args) {
+    Isolate* isolate = args.GetIsolate();
+
+    FastCApiObject* self = UnwrapObject(args.This());
+    CHECK_SELF_OR_THROW();
+    self->slow_call_count_++;
+
+    HandleScope handle_scope(isolate);
+
+    if (args.Length() < 2 || !args[1]->IsInt32Array()) {
+      isolate->ThrowError(
+          "This method expects an Int32Array as its second argument.");
+      return;
+    }
+    Local<Int32Array> typed_array = args[1].As<Int32Array>();
+    int32_t sum = 0;
+    if (typed_array->Length() > 0) {
+      const int32_t* data = reinterpret_cast<const int32_t*>(
+          static_cast<const uint8_t*>(
+              typed_array->Buffer()->GetBackingStore()->Data()) +
+          typed_array->ByteOffset());
+      for (size_t i = 0; i < typed_array->Length(); ++i) {
+        sum += data[i];
+      }
+    }
+    args.GetReturnValue().Set(Number::New(isolate, sum));
+  }
+
   static int AddAll32BitIntFastCallback_6Args(
       Local<Object> receiver, bool should_fallback, int32_t arg1_i32,
       int32_t arg2_i32, int32_t arg3_i32, uint32_t arg4_u32, uint32_t arg5_u32,
@@ -351,6 +399,15 @@ Local<FunctionTemplate> Shell::CreateTestFastCApiTemplate(Isolate* isolate) {
             signature, 1, ConstructorBehavior::kThrow,
             SideEffectType::kHasSideEffect, {c_function_overloads, 2}));
 
+    CFunction add_all_int32_typed_array_c_func =
+        CFunction::Make(FastCApiObject::AddAllInt32TypedArrayFastCallback);
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_all_int32_typed_array",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::AddAllInt32TypedArraySlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &add_all_int32_typed_array_c_func));
+
     CFunction add_32bit_int_c_func =
         CFunction::Make(FastCApiObject::Add32BitIntFastCallback);
     api_obj_ctor->PrototypeTemplate()->Set(
@@ -460,6 +460,7 @@ Global<Function> Shell::stringify_function_;
 base::LazyMutex Shell::workers_mutex_;
 bool Shell::allow_new_workers_ = true;
 std::unordered_set<std::shared_ptr<Worker>> Shell::running_workers_;
+IsolatePool* Shell::isolate_pool_ = nullptr;
 std::atomic<bool> Shell::script_executed_{false};
 std::atomic<bool> Shell::valid_fuzz_script_{false};
 base::LazyMutex Shell::isolate_status_lock_;
@@ -987,6 +988,15 @@ MaybeLocal<Module> Shell::FetchModuleTree(Local<Module> referrer,
              .ToLocal(&module)) {
       return MaybeLocal<Module>();
     }
+    if (options.code_cache_options ==
+        ShellOptions::CodeCacheOptions::kProduceCache) {
+      // Store the code cache for every module of the graph, so that the
+      // consuming run can restore the whole graph from the cache.
+      ScriptCompiler::CachedData* cached_data =
+          ScriptCompiler::CreateCodeCache(module->GetUnboundModuleScript());
+      StoreInCodeCache(isolate, source_text, cached_data);
+      delete cached_data;
+    }
   } else if (module_type == ModuleType::kJSON) {
     Local<Value> parsed_json;
     if (!v8::JSON::Parse(context, source_text).ToLocal(&parsed_json)) {
@@ -3262,6 +3272,8 @@ void Shell::WriteLcovData(v8::Isolate* isolate, const char* file) {
 }
 
 void Shell::OnExit(v8::Isolate* isolate) {
+  delete isolate_pool_;
+  isolate_pool_ = nullptr;
   isolate->Dispose();
 
   if (i::FLAG_dump_counters || i::FLAG_dump_counters_nvp) {
@@ -4067,9 +4079,17 @@ void Worker::ProcessMessages() {
 }
 
 void Worker::ExecuteInThread() {
-  Isolate::CreateParams create_params;
-  create_params.array_buffer_allocator = Shell::array_buffer_allocator;
-  isolate_ = Isolate::New(create_params);
+  if (IsolatePool* pool = Shell::isolate_pool()) isolate_ = pool->Take();
+  if (isolate_ != nullptr) {
+    // The isolate was created on the pool's thread; move its stack limit to
+    // this thread's stack.
+    isolate_->SetStackLimit(i::GetCurrentStackPosition() -
+                            i::FLAG_stack_size * i::KB);
+  } else {
+    Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+    isolate_ = Isolate::New(create_params);
+  }
   {
     base::MutexGuard lock_guard(&worker_mutex_);
     task_runner_ = g_default_platform->GetForegroundTaskRunner(isolate_);
@@ -4151,6 +4171,50 @@ void Worker::ExecuteInThread() {
   out_semaphore_.Signal();
 }
 
+IsolatePool::IsolatePool(size_t size) : size_(size) {
+  isolates_.reserve(size);
+  thread_ = std::make_unique<RefillThread>(this);
+  CHECK(thread_->Start());
+}
+
+IsolatePool::~IsolatePool() {
+  {
+    base::MutexGuard lock_guard(&mutex_);
+    stopped_ = true;
+    refill_cv_.NotifyOne();
+  }
+  thread_->Join();
+  for (Isolate* isolate : isolates_) {
+    platform::NotifyIsolateShutdown(g_default_platform, isolate);
+    isolate->Dispose();
+  }
+}
+
+Isolate* IsolatePool::Take() {
+  base::MutexGuard lock_guard(&mutex_);
+  if (isolates_.empty()) return nullptr;
+  Isolate* isolate = isolates_.back();
+  isolates_.pop_back();
+  refill_cv_.NotifyOne();
+  return isolate;
+}
+
+void IsolatePool::Refill() {
+  Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+  while (true) {
+    {
+      base::MutexGuard lock_guard(&mutex_);
+      while (!stopped_ && isolates_.size() >= size_) refill_cv_.Wait(&mutex_);
+      if (stopped_) return;
+    }
+    // Create the isolate outside the lock so that Take() never waits for it.
+    Isolate* isolate = Isolate::New(create_params);
+    base::MutexGuard lock_guard(&mutex_);
+    isolates_.push_back(isolate);
+  }
+}
+
 void Worker::PostMessageOut(const v8::FunctionCallbackInfo<v8::Value>& args) {
   Isolate* isolate = args.GetIsolate();
   HandleScope handle_scope(isolate);
@@ -4322,6 +4386,12 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--thread-pool-size=", 19) == 0) {
       options.thread_pool_size = atoi(argv[i] + 19);
       argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--numa-pin-worker-threads") == 0) {
+      options.numa_pin_worker_threads = true;
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--worker-isolate-pool-size=", 27) == 0) {
+      options.worker_isolate_pool_size = atoi(argv[i] + 27);
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--stress-delay-tasks") == 0) {
       // Delay execution of tasks by 0-100ms randomly (based on --random-seed).
       options.stress_delay_tasks = true;
@@ -5003,7 +5073,9 @@ int Shell::Main(int argc, char* argv[]) {
   platform::tracing::TracingController* tracing_controller = tracing.get();
   g_platform = v8::platform::NewDefaultPlatform(
       options.thread_pool_size, v8::platform::IdleTaskSupport::kEnabled,
-      in_process_stack_dumping, std::move(tracing));
+      in_process_stack_dumping, std::move(tracing),
+      options.numa_pin_worker_threads ? v8::platform::NumaPinning::kEnabled
+                                      : v8::platform::NumaPinning::kDisabled);
   g_default_platform = g_platform.get();
   if (i::FLAG_verify_predictable) {
     g_platform = MakePredictablePlatform(std::move(g_platform));
@@ -5080,6 +5152,10 @@ int Shell::Main(int argc, char* argv[]) {
   }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+  if (options.worker_isolate_pool_size > 0) {
+    isolate_pool_ = new IsolatePool(options.worker_isolate_pool_size);
+  }
+
   Isolate* isolate = Isolate::New(create_params);
 
   {
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "src/base/once.h"
+#include "src/base/platform/condition-variable.h"
 #include "src/base/platform/time.h"
 #include "src/base/platform/wrappers.h"
 #include "src/d8/async-hooks-wrapper.h"
@@ -166,6 +167,42 @@ class SerializationDataQueue {
   std::vector<std::unique_ptr<SerializationData>> data_;
 };
 
+// Creates isolates ahead of time on a background thread, so that starting a
+// Worker does not have to wait for heap setup and snapshot deserialization.
+// Isolates are not reused; the pool is refilled as they are taken.
+class IsolatePool {
+ public:
+  explicit IsolatePool(size_t size);
+  ~IsolatePool();
+
+  // Returns a pre-created isolate, or nullptr if none is ready yet. The
+  // isolate's stack limit belongs to the background thread, so the caller has
+  // to reset it before entering the isolate on its own thread.
+  Isolate* Take();
+
+ private:
+  class RefillThread : public base::Thread {
+   public:
+    explicit RefillThread(IsolatePool* pool)
+        : base::Thread(base::Thread::Options("IsolatePoolThread")),
+          pool_(pool) {}
+
+    void Run() override { pool_->Refill(); }
+
+   private:
+    IsolatePool* pool_;
+  };
+
+  void Refill();
+
+  const size_t size_;
+  base::Mutex mutex_;  // Guards the following members.
+  base::ConditionVariable refill_cv_;
+  std::vector<Isolate*> isolates_;
+  bool stopped_ = false;
+  std::unique_ptr<RefillThread> thread_;
+};
+
 class Worker : public std::enable_shared_from_this<Worker> {
  public:
   explicit Worker(const char* script);
@@ -415,6 +452,10 @@ class ShellOptions {
   DisallowReassignment<bool> enable_os_system = {"enable-os-system", false};
   DisallowReassignment<bool> quiet_load = {"quiet-load", false};
   DisallowReassignment<int> thread_pool_size = {"thread-pool-size", 0};
+  DisallowReassignment<bool> numa_pin_worker_threads = {
+      "numa-pin-worker-threads", false};
+  DisallowReassignment<int> worker_isolate_pool_size = {
+      "worker-isolate-pool-size", 0};
   DisallowReassignment<bool> stress_delay_tasks = {"stress-delay-tasks", false};
   std::vector<const char*> arguments;
   DisallowReassignment<bool> include_arguments = {"arguments", true};
@@ -635,6 +676,7 @@ class Shell : public i::AllStatic {
   static bool is_valid_fuzz_script() { return valid_fuzz_script_.load(); }
 
   static void WaitForRunningWorkers();
+  static IsolatePool* isolate_pool() { return isolate_pool_; }
   static void AddRunningWorker(std::shared_ptr<Worker> worker);
   static void RemoveRunningWorker(const std::shared_ptr<Worker>& worker);
 
@@ -662,6 +704,7 @@ class Shell : public i::AllStatic {
   static base::LazyMutex workers_mutex_;  // Guards the following members.
   static bool allow_new_workers_;
   static std::unordered_set<std::shared_ptr<Worker>> running_workers_;
+  static IsolatePool* isolate_pool_;
 
   // Multiple isolates may update these flags concurrently.
   static std::atomic<bool> script_executed_;
@@ -4,6 +4,8 @@
 
 #include "src/date/date.h"
 
+#include <utility>
+
 #include "src/base/overflowing-math.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/objects-inl.h"
@@ -26,6 +28,9 @@ static const char kDaysInMonths[] = {31, 28, 31, 30, 31, 30,
 
 DateCache::DateCache()
     : stamp_(kNullAddress),
+      utc_offset_cache_(OffsetKind::kLocalOffsetOfUTC),
+      local_offset_cache_(OffsetKind::kLocalOffsetOfLocal),
+      dst_cache_(OffsetKind::kDaylightSavingsOffset),
       tz_cache_(
 #ifdef V8_INTL_SUPPORT
           Intl::CreateTimeZoneCache()
@@ -44,12 +49,9 @@ void DateCache::ResetDateCache(
     stamp_ = Smi::FromInt(stamp_.value() + 1);
   }
   DCHECK(stamp_ != Smi::FromInt(kInvalidStamp));
-  for (int i = 0; i < kDSTSize; ++i) {
-    ClearSegment(&dst_[i]);
-  }
-  dst_usage_counter_ = 0;
-  before_ = &dst_[0];
-  after_ = &dst_[1];
+  ClearCache(&utc_offset_cache_);
+  ClearCache(&local_offset_cache_);
+  ClearCache(&dst_cache_);
   ymd_valid_ = false;
 #ifdef V8_INTL_SUPPORT
   if (!FLAG_icu_timezone_data) {
@@ -71,13 +73,22 @@ double DateCache::TimeClip(double time) {
   return std::numeric_limits<double>::quiet_NaN();
 }
 
-void DateCache::ClearSegment(DST* segment) {
-  segment->start_sec = kMaxEpochTimeInSec;
-  segment->end_sec = -kMaxEpochTimeInSec;
+void DateCache::ClearSegment(CacheItem* segment) {
+  segment->start_ms = kMaxCachedTimeInMs;
+  segment->end_ms = -kMaxCachedTimeInMs;
   segment->offset_ms = 0;
   segment->last_used = 0;
 }
 
+void DateCache::ClearCache(OffsetCache* cache) {
+  for (int i = 0; i < kCacheSize; ++i) {
+    ClearSegment(&cache->items[i]);
+  }
+  cache->usage_counter = 0;
+  cache->before = &cache->items[0];
+  cache->after = &cache->items[1];
+}
+
 void DateCache::YearMonthDayFromDays(int days, int* year, int* month,
                                      int* day) {
   if (ymd_valid_) {
@@ -274,128 +285,152 @@ int DateCache::GetLocalOffsetFromOS(int64_t time_ms, bool is_utc) {
   return static_cast<int>(offset);
 }
 
-void DateCache::ExtendTheAfterSegment(int time_sec, int offset_ms) {
-  if (after_->offset_ms == offset_ms &&
-      after_->start_sec - kDefaultDSTDeltaInSec <= time_sec &&
-      time_sec <= after_->end_sec) {
-    // Extend the after_ segment.
-    after_->start_sec = time_sec;
-  } else {
-    // The after_ segment is either invalid or starts too late.
-    if (!InvalidSegment(after_)) {
-      // If the after_ segment is valid, replace it with a new segment.
-      after_ = LeastRecentlyUsedDST(before_);
-    }
-    after_->start_sec = time_sec;
-    after_->end_sec = time_sec;
-    after_->offset_ms = offset_ms;
-    after_->last_used = ++dst_usage_counter_;
-  }
+int DateCache::LocalOffsetInMs(int64_t time_ms, bool is_utc) {
+  return CachedOffsetInMs(is_utc ? &utc_offset_cache_ : &local_offset_cache_,
+                          time_ms);
 }
 
 int DateCache::DaylightSavingsOffsetInMs(int64_t time_ms) {
   int time_sec = (time_ms >= 0 && time_ms <= kMaxEpochTimeInMs)
                      ? static_cast<int>(time_ms / 1000)
                      : static_cast<int>(EquivalentTime(time_ms) / 1000);
+  return CachedOffsetInMs(&dst_cache_, static_cast<int64_t>(time_sec) * 1000);
+}
+
+int DateCache::GetOffsetFromOS(OffsetKind kind, int64_t time_ms) {
+  switch (kind) {
+    case OffsetKind::kLocalOffsetOfUTC:
+      return GetLocalOffsetFromOS(time_ms, true);
+    case OffsetKind::kLocalOffsetOfLocal:
+      return GetLocalOffsetFromOS(time_ms, false);
+    case OffsetKind::kDaylightSavingsOffset:
+      return GetDaylightSavingsOffsetFromOS(time_ms / 1000);
+  }
+  UNREACHABLE();
+}
+
+void DateCache::ExtendTheAfterSegment(OffsetCache* cache, int64_t time_ms,
+                                      int offset_ms) {
+  CacheItem* after = cache->after;
+  if (after->offset_ms == offset_ms &&
+      after->start_ms - kDefaultOffsetDeltaInMs <= time_ms &&
+      time_ms <= after->end_ms) {
+    // Extend the after segment.
+    after->start_ms = time_ms;
+  } else {
+    // The after segment is either invalid or starts too late.
+    if (!InvalidSegment(after)) {
+      // If the after segment is valid, replace it with a new segment.
+      after = cache->after = LeastRecentlyUsedCacheItem(cache, cache->before);
+    }
+    after->start_ms = time_ms;
+    after->end_ms = time_ms;
+    after->offset_ms = offset_ms;
+    after->last_used = ++cache->usage_counter;
+  }
+}
+
+int DateCache::CachedOffsetInMs(OffsetCache* cache, int64_t time_ms) {
+  DCHECK(-kMaxCachedTimeInMs < time_ms && time_ms < kMaxCachedTimeInMs);
+  // The daylight savings offset can only be computed for times that fit
+  // into OS date-time library functions.
+  const int64_t max_time_ms = cache->kind == OffsetKind::kDaylightSavingsOffset
+                                  ? kMaxEpochTimeInMs
+                                  : kMaxCachedTimeInMs;
 
   // Invalidate cache if the usage counter is close to overflow.
-  // Note that dst_usage_counter is incremented less than ten times
+  // Note that the usage counter is incremented less than ten times
   // in this function.
-  if (dst_usage_counter_ >= kMaxInt - 10) {
-    dst_usage_counter_ = 0;
-    for (int i = 0; i < kDSTSize; ++i) {
-      ClearSegment(&dst_[i]);
-    }
+  if (cache->usage_counter >= kMaxInt - 10) {
+    ClearCache(cache);
   }
 
   // Optimistic fast check.
-  if (before_->start_sec <= time_sec && time_sec <= before_->end_sec) {
+  if (cache->before->start_ms <= time_ms && time_ms <= cache->before->end_ms) {
     // Cache hit.
-    before_->last_used = ++dst_usage_counter_;
-    return before_->offset_ms;
+    cache->before->last_used = ++cache->usage_counter;
+    return cache->before->offset_ms;
   }
 
-  ProbeDST(time_sec);
+  ProbeCache(cache, time_ms);
+  CacheItem* before = cache->before;
 
-  DCHECK(InvalidSegment(before_) || before_->start_sec <= time_sec);
-  DCHECK(InvalidSegment(after_) || time_sec < after_->start_sec);
+  DCHECK(InvalidSegment(before) || before->start_ms <= time_ms);
+  DCHECK(InvalidSegment(cache->after) || time_ms < cache->after->start_ms);
 
-  if (InvalidSegment(before_)) {
+  if (InvalidSegment(before)) {
     // Cache miss.
-    before_->start_sec = time_sec;
-    before_->end_sec = time_sec;
-    before_->offset_ms = GetDaylightSavingsOffsetFromOS(time_sec);
-    before_->last_used = ++dst_usage_counter_;
-    return before_->offset_ms;
+    before->start_ms = time_ms;
+    before->end_ms = time_ms;
+    before->offset_ms = GetOffsetFromOS(cache->kind, time_ms);
+    before->last_used = ++cache->usage_counter;
+    return before->offset_ms;
   }
 
-  if (time_sec <= before_->end_sec) {
+  if (time_ms <= before->end_ms) {
     // Cache hit.
-    before_->last_used = ++dst_usage_counter_;
-    return before_->offset_ms;
+    before->last_used = ++cache->usage_counter;
+    return before->offset_ms;
   }
 
-  if (time_sec - kDefaultDSTDeltaInSec > before_->end_sec) {
-    // If the before_ segment ends too early, then just
-    // query for the offset of the time_sec
-    int offset_ms = GetDaylightSavingsOffsetFromOS(time_sec);
-    ExtendTheAfterSegment(time_sec, offset_ms);
+  if (time_ms - kDefaultOffsetDeltaInMs > before->end_ms) {
+    // If the before segment ends too early, then just
+    // query for the offset of the time_ms
+    int offset_ms = GetOffsetFromOS(cache->kind, time_ms);
+    ExtendTheAfterSegment(cache, time_ms, offset_ms);
     // This swap helps the optimistic fast check in subsequent invocations.
-    DST* temp = before_;
-    before_ = after_;
-    after_ = temp;
+    std::swap(cache->before, cache->after);
     return offset_ms;
   }
 
-  // Now the time_sec is between
-  // before_->end_sec and before_->end_sec + default DST delta.
-  // Update the usage counter of before_ since it is going to be used.
-  before_->last_used = ++dst_usage_counter_;
-
-  // Check if after_ segment is invalid or starts too late.
-  // Note that start_sec of invalid segments is kMaxEpochTimeInSec.
-  int new_after_start_sec =
-      before_->end_sec < kMaxEpochTimeInSec - kDefaultDSTDeltaInSec
-          ? before_->end_sec + kDefaultDSTDeltaInSec
-          : kMaxEpochTimeInSec;
-  if (new_after_start_sec <= after_->start_sec) {
-    int new_offset_ms = GetDaylightSavingsOffsetFromOS(new_after_start_sec);
-    ExtendTheAfterSegment(new_after_start_sec, new_offset_ms);
+  // Now the time_ms is between
+  // before->end_ms and before->end_ms + default offset delta.
+  // Update the usage counter of before since it is going to be used.
+  before->last_used = ++cache->usage_counter;
+
+  // Check if after segment is invalid or starts too late.
+  // Note that start_ms of invalid segments is kMaxCachedTimeInMs.
+  int64_t new_after_start_ms =
+      before->end_ms < max_time_ms - kDefaultOffsetDeltaInMs
+          ? before->end_ms + kDefaultOffsetDeltaInMs
+          : max_time_ms;
+  if (new_after_start_ms <= cache->after->start_ms) {
+    int new_offset_ms = GetOffsetFromOS(cache->kind, new_after_start_ms);
+    ExtendTheAfterSegment(cache, new_after_start_ms, new_offset_ms);
   } else {
-    DCHECK(!InvalidSegment(after_));
-    // Update the usage counter of after_ since it is going to be used.
-    after_->last_used = ++dst_usage_counter_;
+    DCHECK(!InvalidSegment(cache->after));
+    // Update the usage counter of after since it is going to be used.
+    cache->after->last_used = ++cache->usage_counter;
   }
+  CacheItem* after = cache->after;
 
-  // Now the time_sec is between before_->end_sec and after_->start_sec.
-  // Only one daylight savings offset change can occur in this interval.
+  // Now the time_ms is between before->end_ms and after->start_ms.
+  // Only one offset change can occur in this interval.
 
-  if (before_->offset_ms == after_->offset_ms) {
+  if (before->offset_ms == after->offset_ms) {
     // Merge two segments if they have the same offset.
-    before_->end_sec = after_->end_sec;
-    ClearSegment(after_);
-    return before_->offset_ms;
+    before->end_ms = after->end_ms;
+    ClearSegment(after);
+    return before->offset_ms;
   }
 
-  // Binary search for daylight savings offset change point,
+  // Binary search for offset change point,
   // but give up if we don't find it in five iterations.
   for (int i = 4; i >= 0; --i) {
-    int delta = after_->start_sec - before_->end_sec;
-    int middle_sec = (i == 0) ? time_sec : before_->end_sec + delta / 2;
-    int offset_ms = GetDaylightSavingsOffsetFromOS(middle_sec);
-    if (before_->offset_ms == offset_ms) {
-      before_->end_sec = middle_sec;
-      if (time_sec <= before_->end_sec) {
+    int64_t delta = after->start_ms - before->end_ms;
+    int64_t middle_ms = (i == 0) ? time_ms : before->end_ms + delta / 2;
+    int offset_ms = GetOffsetFromOS(cache->kind, middle_ms);
+    if (before->offset_ms == offset_ms) {
+      before->end_ms = middle_ms;
+      if (time_ms <= before->end_ms) {
         return offset_ms;
       }
     } else {
-      DCHECK(after_->offset_ms == offset_ms);
-      after_->start_sec = middle_sec;
-      if (time_sec >= after_->start_sec) {
+      DCHECK(after->offset_ms == offset_ms);
+      after->start_ms = middle_ms;
+      if (time_ms >= after->start_ms) {
         // This swap helps the optimistic fast check in subsequent invocations.
-        DST* temp = before_;
-        before_ = after_;
-        after_ = temp;
+        std::swap(cache->before, cache->after);
         return offset_ms;
       }
     }
@@ -403,19 +438,20 @@ int DateCache::DaylightSavingsOffsetInMs(int64_t time_ms) {
   return 0;
 }
 
-void DateCache::ProbeDST(int time_sec) {
-  DST* before = nullptr;
-  DST* after = nullptr;
-  DCHECK(before_ != after_);
+void DateCache::ProbeCache(OffsetCache* cache, int64_t time_ms) {
+  CacheItem* before = nullptr;
+  CacheItem* after = nullptr;
+  DCHECK(cache->before != cache->after);
 
-  for (int i = 0; i < kDSTSize; ++i) {
-    if (dst_[i].start_sec <= time_sec) {
-      if (before == nullptr || before->start_sec < dst_[i].start_sec) {
-        before = &dst_[i];
+  for (int i = 0; i < kCacheSize; ++i) {
+    CacheItem* item = &cache->items[i];
+    if (item->start_ms <= time_ms) {
+      if (before == nullptr || before->start_ms < item->start_ms) {
+        before = item;
       }
-    } else if (time_sec < dst_[i].end_sec) {
-      if (after == nullptr || after->end_sec > dst_[i].end_sec) {
-        after = &dst_[i];
+    } else if (time_ms < item->end_ms) {
+      if (after == nullptr || after->end_ms > item->end_ms) {
+        after = item;
       }
     }
   }
@@ -423,32 +459,36 @@ void DateCache::ProbeDST(int time_sec) {
   // If before or after segments were not found,
   // then set them to any invalid segment.
   if (before == nullptr) {
-    before = InvalidSegment(before_) ? before_ : LeastRecentlyUsedDST(after);
+    before = InvalidSegment(cache->before)
+                 ? cache->before
+                 : LeastRecentlyUsedCacheItem(cache, after);
   }
   if (after == nullptr) {
-    after = InvalidSegment(after_) && before != after_
-                ? after_
-                : LeastRecentlyUsedDST(before);
+    after = InvalidSegment(cache->after) && before != cache->after
+                ? cache->after
+                : LeastRecentlyUsedCacheItem(cache, before);
   }
 
   DCHECK_NOT_NULL(before);
   DCHECK_NOT_NULL(after);
   DCHECK(before != after);
-  DCHECK(InvalidSegment(before) || before->start_sec <= time_sec);
-  DCHECK(InvalidSegment(after) || time_sec < after->start_sec);
+  DCHECK(InvalidSegment(before) || before->start_ms <= time_ms);
+  DCHECK(InvalidSegment(after) || time_ms < after->start_ms);
   DCHECK(InvalidSegment(before) || InvalidSegment(after) ||
-         before->end_sec < after->start_sec);
+         before->end_ms < after->start_ms);
 
-  before_ = before;
-  after_ = after;
+  cache->before = before;
+  cache->after = after;
 }
 
-DateCache::DST* DateCache::LeastRecentlyUsedDST(DST* skip) {
-  DST* result = nullptr;
-  for (int i = 0; i < kDSTSize; ++i) {
-    if (&dst_[i] == skip) continue;
-    if (result == nullptr || result->last_used > dst_[i].last_used) {
-      result = &dst_[i];
+DateCache::CacheItem* DateCache::LeastRecentlyUsedCacheItem(OffsetCache* cache,
+                                                            CacheItem* skip) {
+  CacheItem* result = nullptr;
+  for (int i = 0; i < kCacheSize; ++i) {
+    CacheItem* item = &cache->items[i];
+    if (item == skip) continue;
+    if (result == nullptr || result->last_used > item->last_used) {
+      result = item;
     }
   }
   ClearSegment(result);
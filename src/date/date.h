@@ -75,9 +75,7 @@ class V8_EXPORT_PRIVATE DateCache {
   }
 
   // ECMA 262 - ES#sec-local-time-zone-adjustment
-  int LocalOffsetInMs(int64_t time, bool is_utc) {
-    return GetLocalOffsetFromOS(time, is_utc);
-  }
+  int LocalOffsetInMs(int64_t time_ms, bool is_utc);
 
   const char* LocalTimezone(int64_t time_ms) {
     if (time_ms < 0 || time_ms > kMaxEpochTimeInMs) {
@@ -167,58 +165,98 @@ class V8_EXPORT_PRIVATE DateCache {
   virtual int GetLocalOffsetFromOS(int64_t time_ms, bool is_utc);
 
  private:
-  // The implementation relies on the fact that no time zones have
-  // more than one daylight savings offset change per 19 days.
+  // The offset caches rely on the fact that no time zones have more than
+  // one offset change per 19 days.
   // In Egypt in 2010 they decided to suspend DST during Ramadan. This
   // led to a short interval where DST is in effect from September 10 to
   // September 30.
-  static const int kDefaultDSTDeltaInSec = 19 * kSecPerDay;
+  static const int64_t kDefaultOffsetDeltaInMs = 19 * kMsPerDay;
+
+  // Bound on the times that are stored in the offset caches, which includes
+  // local times before UTC conversion.
+  static const int64_t kMaxCachedTimeInMs = 2 * kMaxTimeBeforeUTCInMs;
 
-  // Size of the Daylight Savings Time cache.
-  static const int kDSTSize = 32;
+  // Size of each offset cache. Dates across many years need two segments
+  // per year in time zones with daylight savings time.
+  static const int kCacheSize = 128;
 
-  // Daylight Savings Time segment stores a segment of time where
-  // daylight savings offset does not change.
-  struct DST {
-    int start_sec;
-    int end_sec;
+  // Stores a segment of time in which the offset does not change.
+  struct CacheItem {
+    int64_t start_ms;
+    int64_t end_ms;
     int offset_ms;
     int last_used;
   };
 
+  // The offsets that are cached, and what GetOffsetFromOS computes for them.
+  enum class OffsetKind {
+    // LocalTZA(t, true), for UTC times.
+    kLocalOffsetOfUTC,
+    // LocalTZA(t, false), for local times.
+    kLocalOffsetOfLocal,
+    // The daylight savings offset, for UTC times in
+    // [0, kMaxEpochTimeInMs], rounded down to seconds.
+    kDaylightSavingsOffset,
+  };
+
+  // A cache of segments of time with a constant offset. The before segment
+  // starts at or before the last queried time, and the after segment starts
+  // after it.
+  struct OffsetCache {
+    explicit OffsetCache(OffsetKind kind) : kind(kind) {}
+
+    const OffsetKind kind;
+    CacheItem items[kCacheSize];
+    int usage_counter;
+    CacheItem* before;
+    CacheItem* after;
+  };
+
   // Computes the daylight savings offset for the given time.
   // ECMA 262 - 15.9.1.8
   int DaylightSavingsOffsetInMs(int64_t time_ms);
 
-  // Sets the before_ and the after_ segments from the DST cache such that
-  // the before_ segment starts earlier than the given time and
-  // the after_ segment start later than the given time.
+  // Calls the OS (or ICU) function for the given kind of offset.
+  int GetOffsetFromOS(OffsetKind kind, int64_t time_ms);
+
+  // Returns the offset for the given time, as computed by GetOffsetFromOS,
+  // but calls the OS only for times not covered by the cache.
+  int CachedOffsetInMs(OffsetCache* cache, int64_t time_ms);
+
+  // Makes all segments of the cache invalid.
+  void ClearCache(OffsetCache* cache);
+
+  // Sets the before and the after segments of the cache such that
+  // the before segment starts earlier than the given time and
+  // the after segment start later than the given time.
   // Both segments might be invalid.
-  // The last_used counters of the before_ and after_ are updated.
-  void ProbeDST(int time_sec);
+  // The last_used counters of the before and after are updated.
+  void ProbeCache(OffsetCache* cache, int64_t time_ms);
 
-  // Finds the least recently used segment from the DST cache that is not
+  // Finds the least recently used segment from the cache that is not
   // equal to the given 'skip' segment.
-  DST* LeastRecentlyUsedDST(DST* skip);
+  CacheItem* LeastRecentlyUsedCacheItem(OffsetCache* cache, CacheItem* skip);
 
-  // Extends the after_ segment with the given point or resets it
-  // if it starts later than the given time + kDefaultDSTDeltaInSec.
-  inline void ExtendTheAfterSegment(int time_sec, int offset_ms);
+  // Extends the after segment with the given point or resets it
+  // if it starts later than the given time + kDefaultOffsetDeltaInMs.
+  inline void ExtendTheAfterSegment(OffsetCache* cache, int64_t time_ms,
+                                    int offset_ms);
 
   // Makes the given segment invalid.
-  inline void ClearSegment(DST* segment);
+  inline void ClearSegment(CacheItem* segment);
 
-  bool InvalidSegment(DST* segment) {
-    return segment->start_sec > segment->end_sec;
+  bool InvalidSegment(CacheItem* segment) {
+    return segment->start_ms > segment->end_ms;
   }
 
   Smi stamp_;
 
+  // Local offset caches, for conversions in both directions.
+  OffsetCache utc_offset_cache_;
+  OffsetCache local_offset_cache_;
+
   // Daylight Saving Time cache.
-  DST dst_[kDSTSize];
-  int dst_usage_counter_;
-  DST* before_;
-  DST* after_;
+  OffsetCache dst_cache_;
 
   int local_offset_ms_;
 
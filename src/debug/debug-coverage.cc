@@ -4,6 +4,8 @@
 
 #include "src/debug/debug-coverage.h"
 
+#include <unordered_set>
+
 #include "src/ast/ast-source-ranges.h"
 #include "src/ast/ast.h"
 #include "src/base/hashmap.h"
@@ -619,6 +621,23 @@ std::unique_ptr<Coverage> Coverage::Collect(
   SharedToCounterMap counter_map;
   CollectAndMaybeResetCounts(isolate, &counter_map, collectionMode);
 
+  // Without block coverage, a function is only reported if it or its parent
+  // has a non-zero count, so scripts without any counted function would be
+  // dropped from the result below. Skip them up front, instead of walking and
+  // sorting all of their functions. With count modes the counters are reset
+  // on every collection, so in a large app that is idle between collections
+  // this skips almost all scripts.
+  const bool skip_uncounted_scripts = !IsBlockMode(collectionMode);
+  std::unordered_set<int> counted_scripts;
+  if (skip_uncounted_scripts) {
+    for (SharedToCounterMap::Entry* entry = counter_map.Start();
+         entry != nullptr; entry = counter_map.Next(entry)) {
+      if (entry->value == 0) continue;
+      Object script = entry->key.script();
+      if (script.IsScript()) counted_scripts.insert(Script::cast(script).id());
+    }
+  }
+
   // Iterate shared function infos of every script and build a mapping
   // between source ranges and invocation counts.
   std::unique_ptr<Coverage> result(new Coverage());
@@ -627,7 +646,11 @@ std::unique_ptr<Coverage> Coverage::Collect(
   Script::Iterator scriptIt(isolate);
   for (Script script = scriptIt.Next(); !script.is_null();
        script = scriptIt.Next()) {
-    if (script.IsUserJavaScript()) scripts.push_back(handle(script, isolate));
+    if (!script.IsUserJavaScript()) continue;
+    if (skip_uncounted_scripts && counted_scripts.count(script.id()) == 0) {
+      continue;
+    }
+    scripts.push_back(handle(script, isolate));
   }
 
   for (Handle<Script> script : scripts) {
@@ -740,6 +763,10 @@ std::unique_ptr<Coverage> Coverage::Collect(
   return result;
 }
 
+void Coverage::SetBlockCountingPaused(Isolate* isolate, bool paused) {
+  isolate->debug()->set_block_counting_paused(paused);
+}
+
 void Coverage::SelectMode(Isolate* isolate, debug::CoverageMode mode) {
   if (mode != isolate->code_coverage_mode()) {
     // Changing the coverage mode can change the bytecode that would be
@@ -66,6 +66,9 @@ class Coverage : public std::vector<CoverageScript> {
   // Select code coverage mode.
   static void SelectMode(Isolate* isolate, debug::CoverageMode mode);
 
+  // Pause or resume updates of block coverage counters.
+  static void SetBlockCountingPaused(Isolate* isolate, bool paused);
+
  private:
   static std::unique_ptr<Coverage> Collect(
       Isolate* isolate, v8::debug::CoverageMode collectionMode);
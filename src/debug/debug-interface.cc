@@ -1120,6 +1120,11 @@ void Coverage::SelectMode(Isolate* isolate, CoverageMode mode) {
   i::Coverage::SelectMode(reinterpret_cast<i::Isolate*>(isolate), mode);
 }
 
+void Coverage::SetBlockCountingPaused(Isolate* isolate, bool paused) {
+  i::Coverage::SetBlockCountingPaused(reinterpret_cast<i::Isolate*>(isolate),
+                                      paused);
+}
+
 int TypeProfile::Entry::SourcePosition() const { return entry_->position; }
 
 std::vector<MaybeLocal<String>> TypeProfile::Entry::Types() const {
@@ -360,6 +360,12 @@ class V8_EXPORT_PRIVATE Coverage {
 
   static void SelectMode(Isolate* isolate, CoverageMode mode);
 
+  // While block counting is paused, IncBlockCounter leaves block coverage
+  // counters untouched and the interpreter skips the counting call. Pausing
+  // and resuming periodically samples block counts in short windows at a
+  // fraction of the cost of full block count coverage.
+  static void SetBlockCountingPaused(Isolate* isolate, bool paused);
+
   size_t ScriptCount() const;
   ScriptData GetScriptData(size_t i) const;
   bool IsEmpty() const { return coverage_ == nullptr; }
@@ -1329,7 +1329,10 @@ void Debug::DeoptimizeFunction(Handle<SharedFunctionInfo> shared) {
   // Deoptimize all code compiled from this shared function info including
   // inlining.
   isolate_->AbortConcurrentOptimization(BlockingBehavior::kBlock);
+  DeoptimizeCodeInlining(shared);
+}
 
+void Debug::DeoptimizeCodeInlining(Handle<SharedFunctionInfo> shared) {
   if (shared->HasBaselineData()) {
     DiscardBaselineCode(*shared);
   }
@@ -1372,7 +1375,11 @@ void Debug::PrepareFunctionForDebugExecution(
     DiscardAllBaselineCode();
     InstallDebugBreakTrampoline();
   } else {
-    DeoptimizeFunction(shared);
+    // Concurrent optimization jobs that inline {shared} or compile it are
+    // discarded when they are finalized (see
+    // Compiler::FinalizeOptimizedCompilationJob), so there is no need to
+    // abort the jobs of unrelated functions here.
+    DeoptimizeCodeInlining(shared);
     // Update PCs on the stack to point to recompiled code.
     RedirectActiveFunctions redirect_visitor(
         *shared, RedirectActiveFunctions::Mode::kUseDebugBytecode);
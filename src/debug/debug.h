@@ -379,6 +379,13 @@ class V8_EXPORT_PRIVATE Debug {
     return reinterpret_cast<Address>(&hook_on_function_call_);
   }
 
+  Address block_counting_paused_address() {
+    return reinterpret_cast<Address>(&block_counting_paused_);
+  }
+  void set_block_counting_paused(bool paused) {
+    block_counting_paused_ = paused;
+  }
+
   Address suspended_generator_address() {
     return reinterpret_cast<Address>(&thread_local_.suspended_generator_);
   }
@@ -440,6 +447,9 @@ class V8_EXPORT_PRIVATE Debug {
   void ClearBreakPoints(Handle<DebugInfo> debug_info);
   // Clear all code from instrumentation.
   void ClearAllBreakPoints();
+  // Marks and deoptimizes all optimized code that inlines {shared}, without
+  // aborting pending concurrent optimization jobs.
+  void DeoptimizeCodeInlining(Handle<SharedFunctionInfo> shared);
   // Instrument a function with one-shots.
   void FloodWithOneShot(Handle<SharedFunctionInfo> function,
                         bool returns_only = false);
@@ -487,6 +497,8 @@ class V8_EXPORT_PRIVATE Debug {
   bool is_suppressed_;
   // Running liveedit.
   bool running_live_edit_ = false;
+  // IncBlockCounter does not update block coverage counters.
+  bool block_counting_paused_ = false;
   // Do not trigger debug break events.
   bool break_disabled_;
   // Do not break on break points.
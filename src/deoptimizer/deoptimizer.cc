@@ -613,6 +613,12 @@ bool Deoptimizer::should_reuse_code() const {
          count < FLAG_reuse_opt_code_count;
 }
 
+BytecodeOffset Deoptimizer::bytecode_offset() const {
+  DeoptimizationData deopt_data =
+      DeoptimizationData::cast(compiled_code_.deoptimization_data());
+  return deopt_data.GetBytecodeOffset(deopt_exit_index_);
+}
+
 Deoptimizer::~Deoptimizer() {
   DCHECK(input_ == nullptr && output_ == nullptr);
   DCHECK_NULL(disallow_garbage_collection_);
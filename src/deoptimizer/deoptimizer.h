@@ -53,6 +53,10 @@ class Deoptimizer : public Malloced {
 
   bool should_reuse_code() const;
 
+  // Information about the deopt exit that was taken, for tracing and metrics.
+  DeoptInfo deopt_info() const { return GetDeoptInfo(compiled_code_, from_); }
+  BytecodeOffset bytecode_offset() const;
+
   static Deoptimizer* New(Address raw_function, DeoptimizeKind kind,
                           unsigned deopt_exit_index, Address from,
                           int fp_to_sp_delta, Isolate* isolate);
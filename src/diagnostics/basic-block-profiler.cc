@@ -146,6 +146,7 @@ void BasicBlockProfiler::Print(std::ostream& os, Isolate* isolate) {
   os << "---- Start Profiling Data ----" << std::endl;
   for (const auto& data : data_list_) {
     os << *data;
+    if (FLAG_turbo_profiling_log_functions) data->Log(isolate);
   }
   HandleScope scope(isolate);
   Handle<ArrayList> list(isolate->heap()->basic_block_profiling_data(),
@@ -158,7 +159,7 @@ void BasicBlockProfiler::Print(std::ostream& os, Isolate* isolate) {
     // Print data for builtins to both stdout and the log file, if logging is
     // enabled.
     os << data;
-    data.Log(isolate);
+    if (FLAG_turbo_profiling_log_builtins) data.Log(isolate);
     // Ensure that all builtin names are unique; otherwise profile-guided
     // optimization might get confused.
     CHECK(builtin_names.insert(data.function_name_).second);
@@ -36,9 +36,17 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+#include <deque>
 #include <memory>
+#include <vector>
 
+#include "src/base/optional.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
 #include "src/base/platform/wrappers.h"
+#include "src/baseline/bytecode-offset-iterator.h"
 #include "src/codegen/assembler.h"
 #include "src/codegen/source-position-table.h"
 #include "src/diagnostics/eh-frame.h"
@@ -118,12 +126,131 @@ const int PerfJitLogger::kFilenameBufferPadding = 16;
 
 static const char kStringTerminator[] = "\0";
 
+// Writes the records to the perf file on a background thread. Records are
+// collected in a buffer that is handed over to the thread when it is full,
+// or when the last hand-over is older than kSubmitIntervalMs, so that code
+// creation does not wait for file I/O. If no buffer is handed over for
+// kSubmitIntervalMs, the thread takes the records collected so far itself, so
+// that they reach the file even when no more code is created. Only if the
+// thread falls behind by kMaxPendingBuffers buffers do producers wait for it.
+class PerfJitLogger::AsyncWriter final : public base::Thread {
+ public:
+  explicit AsyncWriter(FILE* file)
+      : base::Thread(base::Thread::Options("V8 PerfJitWriter")),
+        file_(file),
+        last_submit_(base::TimeTicks::Now()) {
+    current_.reserve(kLogBufferSize);
+  }
+
+  // The following methods are called with PerfJitLogger::file_mutex_ held.
+
+  void Write(const char* bytes, int size) {
+    current_.insert(current_.end(), bytes, bytes + size);
+  }
+
+  // Called after each complete record.
+  void MaybeSubmit() {
+    if (current_.size() >= static_cast<size_t>(kLogBufferSize) ||
+        base::TimeTicks::Now() - last_submit_ >=
+            base::TimeDelta::FromMilliseconds(kSubmitIntervalMs)) {
+      Submit();
+    }
+  }
+
+  // Writes all records that are still pending and stops the thread.
+  void StopSynchronously() {
+    Submit();
+    {
+      base::MutexGuard guard(&mutex_);
+      stopping_ = true;
+      pending_cond_.NotifyOne();
+    }
+    Join();
+  }
+
+  void Run() override {
+    const base::TimeDelta submit_interval =
+        base::TimeDelta::FromMilliseconds(kSubmitIntervalMs);
+    while (true) {
+      std::vector<char> buffer;
+      {
+        base::MutexGuard guard(&mutex_);
+        while (pending_.empty() && !stopping_) {
+          if (!pending_cond_.WaitFor(&mutex_, submit_interval)) break;
+        }
+        if (!pending_.empty()) {
+          buffer = std::move(pending_.front());
+          pending_.pop_front();
+          done_cond_.NotifyOne();
+        } else if (stopping_) {
+          return;
+        }
+      }
+      if (buffer.empty() && !TakeIdleRecords(&buffer)) continue;
+      size_t rv = fwrite(buffer.data(), 1, buffer.size(), file_);
+      DCHECK_EQ(buffer.size(), rv);
+      USE(rv);
+      fflush(file_);
+    }
+  }
+
+ private:
+  static constexpr size_t kMaxPendingBuffers = 4;
+  static const int kSubmitIntervalMs = 100;
+
+  // Takes the records of the current buffer if none were handed over for
+  // kSubmitIntervalMs. The producer lock is only tried: it is held by
+  // StopSynchronously() while it waits for this thread, and producers that
+  // hold it submit their records themselves.
+  bool TakeIdleRecords(std::vector<char>* buffer) {
+    base::RecursiveMutex* file_mutex = PerfJitLogger::file_mutex_.Pointer();
+    if (!file_mutex->TryLock()) return false;
+    {
+      base::MutexGuard guard(&mutex_);
+      // Earlier buffers must be written first.
+      if (pending_.empty() && !current_.empty() &&
+          base::TimeTicks::Now() - last_submit_ >=
+              base::TimeDelta::FromMilliseconds(kSubmitIntervalMs)) {
+        buffer->swap(current_);
+        current_.reserve(kLogBufferSize);
+        last_submit_ = base::TimeTicks::Now();
+      }
+    }
+    file_mutex->Unlock();
+    return !buffer->empty();
+  }
+
+  void Submit() {
+    last_submit_ = base::TimeTicks::Now();
+    if (current_.empty()) return;
+    base::MutexGuard guard(&mutex_);
+    while (pending_.size() >= kMaxPendingBuffers) done_cond_.Wait(&mutex_);
+    pending_.push_back(std::move(current_));
+    current_ = std::vector<char>();
+    current_.reserve(kLogBufferSize);
+    pending_cond_.NotifyOne();
+  }
+
+  FILE* const file_;
+  // Only accessed with PerfJitLogger::file_mutex_ held, by producers or by
+  // TakeIdleRecords().
+  std::vector<char> current_;
+  base::TimeTicks last_submit_;
+  // Protected by {mutex_}.
+  base::Mutex mutex_;
+  base::ConditionVariable pending_cond_;
+  base::ConditionVariable done_cond_;
+  std::deque<std::vector<char>> pending_;
+  bool stopping_ = false;
+};
+
 base::LazyRecursiveMutex PerfJitLogger::file_mutex_;
 // The following static variables are protected by PerfJitLogger::file_mutex_.
 uint64_t PerfJitLogger::reference_count_ = 0;
 void* PerfJitLogger::marker_address_ = nullptr;
 uint64_t PerfJitLogger::code_index_ = 0;
 FILE* PerfJitLogger::perf_output_handle_ = nullptr;
+PerfJitLogger::AsyncWriter* PerfJitLogger::async_writer_ = nullptr;
 
 void PerfJitLogger::OpenJitDumpFile() {
   // Open the perf JIT dump file.
@@ -186,6 +313,10 @@ PerfJitLogger::PerfJitLogger(Isolate* isolate) : CodeEventLogger(isolate) {
     OpenJitDumpFile();
     if (perf_output_handle_ == nullptr) return;
     LogWriteHeader();
+    if (FLAG_perf_prof_async_write) {
+      async_writer_ = new AsyncWriter(perf_output_handle_);
+      CHECK(async_writer_->Start());
+    }
   }
 }
 
@@ -195,6 +326,11 @@ PerfJitLogger::~PerfJitLogger() {
   reference_count_--;
   // If this was the last logger, close the file.
   if (reference_count_ == 0) {
+    if (async_writer_ != nullptr) {
+      async_writer_->StopSynchronously();
+      delete async_writer_;
+      async_writer_ = nullptr;
+    }
     CloseJitDumpFile();
   }
 }
@@ -286,6 +422,7 @@ void PerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
   LogWriteBytes(name, name_length);
   LogWriteBytes(kStringTerminator, 1);
   LogWriteBytes(reinterpret_cast<const char*>(code_pointer), code_size);
+  if (async_writer_ != nullptr) async_writer_->MaybeSubmit();
 }
 
 namespace {
@@ -343,7 +480,6 @@ SourcePositionInfo GetSourcePositionInfo(Handle<Code> code,
 void PerfJitLogger::LogWriteDebugInfo(Handle<Code> code,
                                       Handle<SharedFunctionInfo> shared) {
   DisallowGarbageCollection no_gc;
-  // TODO(v8:11429,cbruni): add proper baseline source position iterator
   ByteArray source_position_table = code->SourcePositionTable(*shared);
   // Compute the entry count and get the name of the script.
   uint32_t entry_count = 0;
@@ -380,16 +516,29 @@ void PerfJitLogger::LogWriteDebugInfo(Handle<Code> code,
   LogWriteBytes(reinterpret_cast<const char*>(&debug_info), sizeof(debug_info));
 
   Address code_start = code->InstructionStart();
+  // Baseline code shares the source position table of its bytecode, whose
+  // offsets are bytecode offsets. Map them to the start of the machine code
+  // generated for the respective bytecode.
+  base::Optional<baseline::BytecodeOffsetIterator> baseline_iterator;
+  if (code->kind() == CodeKind::BASELINE) {
+    baseline_iterator.emplace(code->bytecode_offset_table(),
+                              shared->GetBytecodeArray(isolate_));
+  }
 
   for (SourcePositionTableIterator iterator(source_position_table);
        !iterator.done(); iterator.Advance()) {
     SourcePositionInfo info(
         GetSourcePositionInfo(code, shared, iterator.source_position()));
+    Address code_offset = iterator.code_offset();
+    if (baseline_iterator) {
+      baseline_iterator->AdvanceToBytecodeOffset(iterator.code_offset());
+      code_offset = baseline_iterator->current_pc_start_offset();
+    }
     PerfJitDebugEntry entry;
     // The entry point of the function will be placed straight after the ELF
     // header when processed by "perf inject". Adjust the position addresses
     // accordingly.
-    entry.address_ = code_start + iterator.code_offset() + kElfHeaderSize;
+    entry.address_ = code_start + code_offset + kElfHeaderSize;
     entry.line_number_ = info.line + 1;
     entry.column_ = info.column + 1;
     LogWriteBytes(reinterpret_cast<const char*>(&entry), sizeof(entry));
@@ -517,6 +666,10 @@ void PerfJitLogger::CodeMoveEvent(AbstractCode from, AbstractCode to) {
 }
 
 void PerfJitLogger::LogWriteBytes(const char* bytes, int size) {
+  if (async_writer_ != nullptr) {
+    async_writer_->Write(bytes, size);
+    return;
+  }
   size_t rv = fwrite(bytes, 1, size, perf_output_handle_);
   DCHECK(static_cast<size_t>(size) == rv);
   USE(rv);
@@ -125,10 +125,14 @@ class PerfJitLogger : public CodeEventLogger {
 #error Unknown target architecture pointer size
 #endif
 
+  class AsyncWriter;
+
   // Per-process singleton file. We assume that there is one main isolate;
   // to determine when it goes away, we keep reference count.
   static base::LazyRecursiveMutex file_mutex_;
   static FILE* perf_output_handle_;
+  // Only used with --perf-prof-async-write.
+  static AsyncWriter* async_writer_;
   static uint64_t reference_count_;
   static void* marker_address_;
   static uint64_t code_index_;
@@ -84,6 +84,7 @@
 #include "src/profiler/heap-profiler.h"
 #include "src/profiler/tracing-cpu-profiler.h"
 #include "src/regexp/regexp-stack.h"
+#include "src/regexp/regexp.h"
 #include "src/snapshot/embedded/embedded-data.h"
 #include "src/snapshot/embedded/embedded-file-writer-interface.h"
 #include "src/snapshot/read-only-deserializer.h"
@@ -2318,6 +2319,14 @@ std::vector<MemoryRange>* Isolate::GetCodePages() const {
 
 void Isolate::SetCodePages(std::vector<MemoryRange>* new_code_pages) {
   code_pages_.store(new_code_pages, std::memory_order_release);
+  code_pages_version_.fetch_add(1, std::memory_order_release);
+}
+
+void Isolate::BeginCodePagesUpdate() {
+  // Readers may still be copying the inactive buffer if they loaded it
+  // before the previous update, so bump the version before it is modified.
+  code_pages_version_.fetch_add(1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
 }
 
 void Isolate::ReportPendingMessages() {
@@ -2888,7 +2897,9 @@ class TracingAccountingAllocator : public AccountingAllocator {
     }
     out << "\"allocated\": " << total_segment_bytes_allocated << ", "
         << "\"used\": " << total_zone_allocation_size << ", "
-        << "\"freed\": " << total_zone_freed_size << "}";
+        << "\"freed\": " << total_zone_freed_size << ", "
+        << "\"segment_pool_hits\": " << GetSegmentPoolHits() << ", "
+        << "\"segment_pool_misses\": " << GetSegmentPoolMisses() << "}";
   }
 
   Isolate* const isolate_;
@@ -3097,6 +3108,10 @@ void Isolate::Deinit() {
   TRACE_ISOLATE(deinit);
 
   tracing_cpu_profiler_.reset();
+#ifdef V8_RUNTIME_CALL_STATS
+  // Report the last samples before the embedder is notified of the disposal.
+  runtime_call_stats_sampler_.reset();
+#endif  // V8_RUNTIME_CALL_STATS
   if (FLAG_stress_sampling_allocation_profiler > 0) {
     heap_profiler()->StopSamplingHeapProfiler();
   }
@@ -3710,6 +3725,18 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   // because it makes use of interrupts.
   tracing_cpu_profiler_.reset(new TracingCpuProfilerImpl(this));
 
+#ifdef V8_RUNTIME_CALL_STATS
+  if (FLAG_runtime_call_stats_sampling) {
+    runtime_call_stats_sampler_ = std::make_unique<RuntimeCallStatsSampler>(
+        this,
+        base::TimeDelta::FromMicroseconds(
+            FLAG_runtime_call_stats_sampling_interval),
+        base::TimeDelta::FromMilliseconds(
+            FLAG_runtime_call_stats_sampling_report_interval));
+    CHECK(runtime_call_stats_sampler_->Start());
+  }
+#endif  // V8_RUNTIME_CALL_STATS
+
   bootstrapper_->Initialize(create_heap_objects);
 
   if (create_heap_objects) {
@@ -3946,6 +3973,11 @@ void Isolate::DumpAndResetStats() {
       stack_access_count_map = nullptr;
     }
   }
+  if (regexp_execution_stats_) {
+    StdoutStream os;
+    regexp_execution_stats_->Print(os);
+    regexp_execution_stats_.reset();
+  }
   if (turbo_statistics() != nullptr) {
     DCHECK(FLAG_turbo_stats || FLAG_turbo_stats_nvp);
     StdoutStream os;
@@ -3996,6 +4028,14 @@ CompilationStatistics* Isolate::GetTurboStatistics() {
   return turbo_statistics();
 }
 
+RegExpExecutionStats* Isolate::GetRegExpExecutionStats() {
+  DCHECK(FLAG_regexp_execution_stats);
+  if (!regexp_execution_stats_) {
+    regexp_execution_stats_ = std::make_unique<RegExpExecutionStats>();
+  }
+  return regexp_execution_stats_.get();
+}
+
 CodeTracer* Isolate::GetCodeTracer() {
   if (code_tracer() == nullptr) set_code_tracer(new CodeTracer(id()));
   return code_tracer();
@@ -4949,6 +4989,7 @@ void Isolate::AddCodeMemoryRange(MemoryRange range) {
   } else {
     new_code_pages = &code_pages_buffer1_;
   }
+  BeginCodePagesUpdate();
 
   // Copy all existing data from the old vector to the new vector and insert the
   // new page.
@@ -5066,6 +5107,7 @@ void Isolate::RemoveCodeMemoryChunk(MemoryChunk* chunk) {
   } else {
     new_code_pages = &code_pages_buffer1_;
   }
+  BeginCodePagesUpdate();
 
   // Copy all existing data from the old vector to the new vector except the
   // removed page.
@@ -5116,10 +5158,17 @@ void Isolate::AttachToSharedIsolate(Isolate* shared) {
   shared->AppendAsClientIsolate(this);
   shared_isolate_ = shared;
   heap()->InitSharedSpaces();
+
+  if (FLAG_shared_string_table) {
+    // Strings are hashed with the seed of the isolate doing the lookup.
+    CHECK_EQ(HashSeed(this), HashSeed(shared));
+    string_table()->set_shared_table(shared->string_table());
+  }
 }
 
 void Isolate::DetachFromSharedIsolate() {
   DCHECK_NOT_NULL(shared_isolate_);
+  if (string_table_) string_table_->set_shared_table(nullptr);
   shared_isolate_->RemoveAsClientIsolate(this);
   shared_isolate_ = nullptr;
   heap()->DeinitSharedSpaces();
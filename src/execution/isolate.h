@@ -102,8 +102,10 @@ class OptimizingCompileDispatcher;
 class PersistentHandles;
 class PersistentHandlesList;
 class ReadOnlyArtifacts;
+class RegExpExecutionStats;
 class RegExpStack;
 class RootVisitor;
+class RuntimeCallStatsSampler;
 class RuntimeProfiler;
 class SetupIsolateDelegate;
 class Simulator;
@@ -804,6 +806,12 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   void SetCodePages(std::vector<MemoryRange>* new_code_pages);
 
+  // Changes whenever the code pages change, including while the inactive
+  // buffer is being rewritten, so readers can detect stale or torn copies.
+  size_t code_pages_version() const {
+    return code_pages_version_.load(std::memory_order_acquire);
+  }
+
   // Returns the global object of the current context. It could be
   // a builtin object, or a JS global object.
   inline Handle<JSGlobalObject> global_object();
@@ -1400,6 +1408,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   int id() const { return id_; }
 
   CompilationStatistics* GetTurboStatistics();
+  RegExpExecutionStats* GetRegExpExecutionStats();
   CodeTracer* GetCodeTracer();
 
   void DumpAndResetStats();
@@ -1814,6 +1823,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   void InitializeCodeRanges();
   void AddCodeMemoryRange(MemoryRange range);
+  // Announces that the inactive code pages buffer is about to be rewritten.
+  void BeginCodePagesUpdate();
 
   // Common method to create an Isolate used by Isolate::New() and
   // Isolate::NewShared().
@@ -2100,6 +2111,9 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   std::unique_ptr<PersistentHandlesList> persistent_handles_list_;
 
+  // Collected with --regexp-execution-stats.
+  std::unique_ptr<RegExpExecutionStats> regexp_execution_stats_;
+
   // Counts deopt points if deopt_every_n_times is enabled.
   unsigned int stress_deopt_count_ = 0;
 
@@ -2185,6 +2199,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   std::unique_ptr<TracingCpuProfilerImpl> tracing_cpu_profiler_;
 
+#ifdef V8_RUNTIME_CALL_STATS
+  std::unique_ptr<RuntimeCallStatsSampler> runtime_call_stats_sampler_;
+#endif  // V8_RUNTIME_CALL_STATS
+
   EmbeddedFileWriterInterface* embedded_file_writer_ = nullptr;
 
   // The top entry of the v8::Context::BackupIncumbentScope stack.
@@ -2221,6 +2239,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   std::atomic<std::vector<MemoryRange>*> code_pages_{nullptr};
   std::vector<MemoryRange> code_pages_buffer1_;
   std::vector<MemoryRange> code_pages_buffer2_;
+  std::atomic<size_t> code_pages_version_{0};
 
   // Enables the host application to provide a mechanism for recording a
   // predefined set of data as crash keys to be used in postmortem debugging
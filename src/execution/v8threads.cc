@@ -117,6 +117,13 @@ bool ThreadManager::RestoreThread() {
   if (lazily_archived_thread_.IsValid()) {
     EagerlyArchiveThread();
   }
+  // Without any archived thread there is no state to restore, so the per-thread
+  // data table does not need to be consulted. This is the common case when an
+  // embedder moves an isolate between threads using top-level Lockers only.
+  if (FirstThreadStateInUse() == nullptr) {
+    InitThread(access);
+    return false;
+  }
   Isolate::PerIsolateThreadData* per_thread =
       isolate_->FindPerThreadDataForThisThread();
   if (per_thread == nullptr || per_thread->thread_state() == nullptr) {
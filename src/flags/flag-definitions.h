@@ -482,7 +482,6 @@ DEFINE_BOOL(future, FUTURE_BOOL,
 
 DEFINE_WEAK_IMPLICATION(future, finalize_streaming_on_background)
 DEFINE_WEAK_IMPLICATION(future, super_ic)
-DEFINE_WEAK_IMPLICATION(future, turbo_inline_js_wasm_calls)
 #if ENABLE_SPARKPLUG
 DEFINE_WEAK_IMPLICATION(future, sparkplug)
 #endif
@@ -557,6 +556,9 @@ DEFINE_BOOL(trace_block_coverage, false,
 DEFINE_BOOL(trace_protector_invalidation, false,
             "trace protector cell invalidations")
 DEFINE_BOOL(trace_web_snapshot, false, "trace web snapshot deserialization")
+DEFINE_BOOL(value_serializer_object_shapes, false,
+            "write the keys of plain objects with the same map only once in "
+            "ValueSerializer output")
 
 DEFINE_BOOL(feedback_normalization, false,
             "feed back normalization to constructors")
@@ -574,9 +576,29 @@ DEFINE_BOOL_READONLY(string_slices, true, "use string slices")
 
 DEFINE_INT(interrupt_budget, 132 * KB,
            "interrupt budget which should be used for the profiler counter")
+DEFINE_INT(ticks_before_optimization, 3,
+           "the number of times we have to go through the interrupt budget "
+           "before considering this function for optimization")
+DEFINE_INT(bytecode_size_allowance_per_tick, 1100,
+           "increases the number of ticks required for optimization by "
+           "bytecode.length/X")
+DEFINE_INT(max_bytecode_size_for_early_opt, 81,
+           "Maximum bytecode length for a function to be optimized on the "
+           "first tick")
 
 // Flags for inline caching and feedback vectors.
 DEFINE_BOOL(use_ic, true, "use inline caching")
+DEFINE_BOOL(stub_cache_growth, true,
+            "grow the megamorphic stub caches once if they miss often")
+DEFINE_INT(stub_cache_growth_threshold, 4,
+           "grow a stub cache at a full GC if it missed more often since the "
+           "previous full GC than this many times its primary table size")
+DEFINE_INT(cliff_metrics_batch_size, 100,
+           "number of megamorphic IC transitions and deoptimizations that are "
+           "reported to the embedder's metrics recorder together")
+DEFINE_INT(cliff_metrics_batch_interval, 10000,
+           "report megamorphic IC transitions and deoptimizations to the "
+           "metrics recorder with the first one after this many ms")
 DEFINE_INT(budget_for_feedback_vector_allocation, 940,
            "The budget in amount of bytecode executed by a function before we "
            "decide to allocate feedback vectors")
@@ -587,11 +609,17 @@ DEFINE_BOOL(feedback_allocation_on_bytecode_size, true,
             "scale it based in the bytecode size.")
 DEFINE_IMPLICATION(sparkplug, feedback_allocation_on_bytecode_size)
 DEFINE_BOOL(lazy_feedback_allocation, true, "Allocate feedback vectors lazily")
+DEFINE_BOOL(lazy_feedback_allocation_per_sfi, false,
+            "Allocate feedback vectors eagerly for new closures once any "
+            "closure of the same function has allocated one")
 
 // Flags for Ignition.
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
             "elide bytecodes which won't have any external effect")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
+DEFINE_BOOL(ignition_elide_redundant_context_loads, false,
+            "replace repeated loads of immutable context slots within a basic "
+            "block by register transfers")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
 DEFINE_BOOL(ignition_share_named_property_feedback, true,
@@ -641,6 +669,10 @@ DEFINE_BOOL(
     turboprop_as_toptier, false,
     "enable experimental turboprop compiler without further tierup to turbofan")
 DEFINE_IMPLICATION(turboprop_as_toptier, turboprop)
+DEFINE_INT(turboprop_max_bytecode_size, 0,
+           "maximum bytecode size of functions that tier up to turboprop "
+           "before turbofan, larger functions tier up to turbofan directly "
+           "(0 means no limit)")
 DEFINE_UINT_READONLY(max_minimorphic_map_checks, 4,
                      "max number of map checks to perform in minimorphic state")
 // The scale factor determines the interrupt budget when tiering up from
@@ -811,6 +843,9 @@ DEFINE_VALUE_IMPLICATION(stress_inline, max_inlined_bytecode_size_absolute,
 DEFINE_VALUE_IMPLICATION(stress_inline, min_inlining_frequency, 0)
 DEFINE_IMPLICATION(stress_inline, polymorphic_inlining)
 DEFINE_BOOL(trace_turbo_inlining, false, "trace TurboFan inlining")
+DEFINE_STRING(turbo_inlining_profile, nullptr,
+              "path of a v8.log written with --turbo-profiling-log-functions, "
+              "used to prefer inlining callees that were hot while profiling")
 DEFINE_BOOL(turbo_inline_array_builtins, true,
             "inline array builtins in TurboFan code")
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
@@ -830,12 +865,19 @@ DEFINE_IMPLICATION(turbo_profiling_verbose, turbo_profiling)
 DEFINE_BOOL(turbo_profiling_log_builtins, false,
             "emit data about basic block usage in builtins to v8.log (requires "
             "that V8 was built with v8_enable_builtins_profiling=true)")
+DEFINE_BOOL(turbo_profiling_log_functions, false,
+            "emit data about basic block usage in optimized JavaScript "
+            "functions to v8.log, e.g. for --turbo-inlining-profile")
+DEFINE_IMPLICATION(turbo_profiling_log_functions, turbo_profiling)
 DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "Turbofan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "Turbofan loop variable optimization")
+DEFINE_BOOL(turbo_loop_bounds_check_elimination, true,
+            "eliminate bounds checks on induction variables that are "
+            "dominated by a loop condition against the same length")
 DEFINE_BOOL(turbo_loop_rotation, true, "Turbofan loop rotation")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
@@ -849,6 +891,9 @@ DEFINE_IMPLICATION(turbo_stress_instruction_scheduling,
 DEFINE_BOOL(turbo_store_elimination, true,
             "enable store-store elimination in TurboFan")
 DEFINE_BOOL(trace_store_elimination, false, "trace store elimination")
+DEFINE_INT(turbo_optional_phase_node_limit, 0,
+           "skip loop peeling, store-store elimination and instruction "
+           "scheduling for graphs with more nodes than this (0 means no limit)")
 DEFINE_BOOL(turbo_rewrite_far_jumps, true,
             "rewrite far to near jumps (ia32,x64)")
 DEFINE_BOOL(
@@ -862,7 +907,7 @@ DEFINE_BOOL(turbo_dynamic_map_checks, true,
             "if all handlers in an IC are the same for turboprop")
 DEFINE_BOOL(turbo_compress_translation_arrays, false,
             "compress translation arrays (experimental)")
-DEFINE_BOOL(turbo_inline_js_wasm_calls, false, "inline JS->Wasm calls")
+DEFINE_BOOL(turbo_inline_js_wasm_calls, true, "inline JS->Wasm calls")
 
 DEFINE_BOOL(turbo_optimize_apply, false, "optimize Function.prototype.apply")
 DEFINE_WEAK_IMPLICATION(future, turbo_optimize_apply)
@@ -930,7 +975,11 @@ DEFINE_BOOL(wasm_tier_up, true,
             "enable tier up to the optimizing compiler (requires --liftoff to "
             "have an effect)")
 DEFINE_BOOL(wasm_dynamic_tiering, false,
-            "enable dynamic tier up to the optimizing compiler")
+            "enable dynamic tier up to the optimizing compiler: only functions "
+            "that get hot by calls or loop iterations are tiered up")
+DEFINE_INT(wasm_caching_threshold, 1000000,
+           "the amount of wasm top tier code that triggers the next caching "
+           "event when using dynamic tiering")
 DEFINE_DEBUG_BOOL(trace_wasm_decoder, false, "trace decoding of wasm code")
 DEFINE_DEBUG_BOOL(trace_wasm_compiler, false, "trace compiling of wasm code")
 DEFINE_DEBUG_BOOL(trace_wasm_interpreter, false,
@@ -947,6 +996,9 @@ DEFINE_BOOL(liftoff_only, false,
 DEFINE_IMPLICATION(liftoff_only, liftoff)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_tier_up)
 DEFINE_NEG_IMPLICATION(fuzzing, liftoff_only)
+DEFINE_BOOL(wasm_loop_locals_in_registers, false,
+            "keep locals in registers at Liftoff loop headers instead of "
+            "spilling them")
 DEFINE_BOOL(experimental_liftoff_extern_ref, true,
             "enable support for externref in Liftoff")
 DEFINE_DEBUG_BOOL(
@@ -1000,6 +1052,9 @@ DEFINE_IMPLICATION(experimental_wasm_gc, experimental_wasm_typed_funcref)
 DEFINE_IMPLICATION(experimental_wasm_typed_funcref, experimental_wasm_reftypes)
 
 DEFINE_BOOL(wasm_gc_js_interop, false, "experimental WasmGC-JS interop")
+DEFINE_BOOL(wasm_inline_allocation, false,
+            "allocate wasm structs inline in the young generation in "
+            "optimized code")
 
 DEFINE_BOOL(wasm_staging, false, "enable staged wasm features")
 
@@ -1040,6 +1095,11 @@ DEFINE_DEBUG_BOOL(trace_wasm_lazy_compilation, false,
                   "trace lazy compilation of wasm functions")
 DEFINE_BOOL(wasm_lazy_validation, false,
             "enable lazy validation for lazily compiled wasm functions")
+DEFINE_BOOL(wasm_lazy_precompile, false,
+            "when lazily compiling a wasm function, compile its direct "
+            "callees in the background")
+DEFINE_BOOL(wasm_parallel_data_segments, false,
+            "copy large wasm data segments into memory using worker threads")
 DEFINE_BOOL(wasm_simd_ssse3_codegen, false, "allow wasm SIMD SSSE3 codegen")
 
 DEFINE_BOOL(wasm_code_gc, true, "enable garbage collection of wasm code")
@@ -1087,6 +1147,9 @@ DEFINE_SIZE_T(max_semi_space_size, 0,
               "max size of a semi-space (in MBytes), the new space consists of "
               "two semi-spaces")
 DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
+DEFINE_SIZE_T(young_generation_target_gc_interval, 0,
+              "target interval between young generation GCs (in ms) used for "
+              "sizing the semi-spaces, 0 uses the default growing heuristics")
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_SIZE_T(
     max_heap_size, 0,
@@ -1121,6 +1184,12 @@ DEFINE_BOOL(trace_idle_notification_verbose, false,
 DEFINE_BOOL(trace_gc_verbose, false,
             "print more details following each garbage collection")
 DEFINE_IMPLICATION(trace_gc_verbose, trace_gc)
+DEFINE_BOOL(trace_safepoint, false,
+            "print the time it takes background threads to reach a safepoint "
+            "and the slowest thread")
+DEFINE_INT(gc_phase_histograms_interval, 0,
+           "report histograms of the garbage collection phase durations to "
+           "the metrics recorder every this many collections (0 disables)")
 DEFINE_BOOL(trace_gc_freelists, false,
             "prints details of each freelist before and after "
             "each major garbage collection")
@@ -1128,6 +1197,9 @@ DEFINE_BOOL(trace_gc_freelists_verbose, false,
             "prints details of freelists of each page before and after "
             "each major garbage collection")
 DEFINE_IMPLICATION(trace_gc_freelists_verbose, trace_gc_freelists)
+DEFINE_BOOL(gc_freelist_bitmap, false,
+            "use a free list that finds the best-fitting non-empty category "
+            "through a bitmap of non-empty categories")
 DEFINE_BOOL(trace_evacuation_candidates, false,
             "Show statistics about the pages evacuation by the compaction")
 DEFINE_BOOL(
@@ -1159,6 +1231,9 @@ DEFINE_INT(incremental_marking_hard_trigger, 0,
            "threshold for starting incremental marking immediately in percent "
            "of available space: limit - size")
 DEFINE_BOOL(trace_unmapper, false, "Trace the unmapping")
+DEFINE_BOOL(shared_string_table, false,
+            "internalize strings of client isolates into the string table "
+            "of their shared isolate (experimental)")
 DEFINE_BOOL(parallel_scavenge, true, "parallel scavenge")
 DEFINE_BOOL(scavenge_task, true, "schedule scavenge tasks")
 DEFINE_INT(scavenge_task_trigger, 80,
@@ -1166,6 +1241,12 @@ DEFINE_INT(scavenge_task_trigger, 80,
 DEFINE_BOOL(scavenge_separate_stack_scanning, false,
             "use a separate phase for stack scanning in scavenge")
 DEFINE_BOOL(trace_parallel_scavenge, false, "trace parallel scavenge")
+DEFINE_INT(finalization_registry_cleanup_slice, 64,
+           "maximum number of cleared cells processed per slice of a "
+           "FinalizationRegistry cleanup task")
+DEFINE_FLOAT(finalization_registry_cleanup_budget, 1.0,
+             "time budget in ms after which a FinalizationRegistry cleanup "
+             "task leaves the remaining cells to a later task")
 DEFINE_BOOL(write_protect_code_memory, true, "write protect code memory")
 #if defined(V8_ATOMIC_MARKING_STATE) && defined(V8_ATOMIC_OBJECT_FIELD_WRITES)
 #define V8_CONCURRENT_MARKING_BOOL true
@@ -1176,6 +1257,12 @@ DEFINE_BOOL(concurrent_marking, V8_CONCURRENT_MARKING_BOOL,
             "use concurrent marking")
 DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
+DEFINE_BOOL(array_buffer_pool, false,
+            "recycle small array buffer backing stores through a pool")
+DEFINE_INT(array_buffer_pool_max_cached_kb, 4 * MB / KB,
+           "maximum amount of memory cached by the array buffer pool")
+DEFINE_BOOL(trace_array_buffer_pool, false,
+            "print array buffer pool statistics after each GC")
 DEFINE_BOOL(stress_concurrent_allocation, false,
             "start background threads that allocate memory")
 DEFINE_BOOL(parallel_marking, V8_CONCURRENT_MARKING_BOOL,
@@ -1184,6 +1271,10 @@ DEFINE_INT(ephemeron_fixpoint_iterations, 10,
            "number of fixpoint iterations it takes to switch to linear "
            "ephemeron algorithm")
 DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
+DEFINE_INT(marking_prefetch_distance, 0,
+           "number of objects popped from the marking worklist ahead of "
+           "visiting them so that their memory can be prefetched (0 disables, "
+           "at most 16)")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
@@ -1198,6 +1289,12 @@ DEFINE_BOOL(track_gc_object_stats, false,
             "track object counts and memory usage")
 DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
+DEFINE_INT(object_stats_sampling_rate, 0,
+           "sample one in this many objects visited by the marker and report "
+           "the heap composition to the metrics recorder (0 disables)")
+DEFINE_SIZE_T(zone_segment_pool_size, 0,
+              "keep up to this many KBytes of freed zone segments for reuse "
+              "by later zones, e.g. of the next compile task")
 DEFINE_BOOL(trace_zone_stats, false, "trace zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_stats,
@@ -1249,10 +1346,19 @@ DEFINE_BOOL(always_compact, false, "Perform compaction on every full GC")
 DEFINE_BOOL(never_compact, false,
             "Never perform compaction on full GC - testing only")
 DEFINE_BOOL(compact_code_space, true, "Compact code space on full collections")
+DEFINE_BOOL(advise_huge_pages, false,
+            "advise the OS to back the pointer compression cage and the code "
+            "range with huge pages (transparent huge pages on Linux)")
+DEFINE_SIZE_T(max_code_space_evacuation_kb, 1024,
+              "max live code (in KBytes) evacuated by a full GC that does not "
+              "reduce memory")
 DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
 DEFINE_BOOL(stress_flush_bytecode, false, "stress bytecode flushing")
 DEFINE_BOOL(trace_flush_bytecode, false, "trace bytecode flushing")
+DEFINE_BOOL(flush_bytecode_on_memory_pressure, false,
+            "flush bytecode that has not been executed since the previous "
+            "full GC during memory-reducing GCs")
 DEFINE_IMPLICATION(stress_flush_bytecode, flush_bytecode)
 DEFINE_BOOL(use_marking_progress_bar, true,
             "Use a progress bar to scan large objects in increments when "
@@ -1456,6 +1562,8 @@ DEFINE_BOOL(always_osr, false, "always try to OSR functions")
 DEFINE_BOOL(prepare_always_opt, false, "prepare for turning on always opt")
 
 DEFINE_BOOL(trace_serializer, false, "print code serializer trace")
+DEFINE_BOOL(serialize_pretenuring_feedback, true,
+            "record allocation site pretenuring decisions in the code cache")
 #ifdef DEBUG
 DEFINE_BOOL(external_reference_stats, false,
             "print statistics on external references used during serialization")
@@ -1470,12 +1578,27 @@ DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 DEFINE_BOOL(parallel_compile_tasks, false, "enable parallel compile tasks")
 DEFINE_BOOL(compiler_dispatcher, false, "enable compiler dispatcher")
 DEFINE_IMPLICATION(parallel_compile_tasks, compiler_dispatcher)
+DEFINE_BOOL(parallel_compile_tasks_for_lazy, false,
+            "also compile lazy top-level functions in parallel compile tasks")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, parallel_compile_tasks)
 DEFINE_BOOL(trace_compiler_dispatcher, false,
             "trace compiler dispatcher activity")
+DEFINE_BOOL(scope_lookup_cache, false,
+            "cache variable lookups that leave a function scope during scope "
+            "analysis")
 
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
            "CPU profiler sampling interval in microseconds")
+DEFINE_STRING(cpu_profiler_pprof_file, nullptr,
+              "aggregate the stacks sampled by the CPU profiler and "
+              "periodically write them to this file in pprof format")
+DEFINE_INT(cpu_profiler_pprof_interval, 60000,
+           "interval in milliseconds between writes of "
+           "--cpu-profiler-pprof-file")
+DEFINE_INT(cpu_profiler_pprof_stacks, 4096,
+           "maximum number of distinct stacks aggregated for "
+           "--cpu-profiler-pprof-file")
 
 // debugger
 DEFINE_BOOL(
@@ -1657,26 +1780,65 @@ DEFINE_BOOL(rcs_cpu_time, false,
             "report runtime times in cpu time (the default is wall time)")
 DEFINE_IMPLICATION(rcs_cpu_time, rcs)
 
+DEFINE_BOOL(runtime_call_stats_sampling, false,
+            "periodically sample the active runtime call counters instead of "
+            "timing them, and report them through v8::metrics")
+DEFINE_GENERIC_IMPLICATION(
+    runtime_call_stats_sampling,
+    TracingFlags::runtime_stats.fetch_or(
+        v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING))
+DEFINE_INT(runtime_call_stats_sampling_interval, 1000,
+           "interval between runtime call stats samples in microseconds")
+DEFINE_INT(runtime_call_stats_sampling_report_interval, 10000,
+           "interval between runtime call stats sample reports in ms")
+
 // snapshot-common.cc
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
+DEFINE_BOOL(verify_snapshot_checksum, true,
+            "verify the checksums of the startup snapshot and of code caches "
+            "when deserializing them")
+DEFINE_BOOL(parallel_snapshot_decompression, false,
+            "decompress the read-only snapshot on a separate thread while "
+            "the startup snapshot is decompressed")
+DEFINE_BOOL(snapshot_keep_feedback, false,
+            "keep the feedback vectors of compiled functions in snapshots "
+            "created with FunctionCodeHandling::kKeep")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_mode_modifiers, false, "enable inline flags in regexp.")
 DEFINE_BOOL(regexp_interpret_all, false, "interpret all regexp code")
+DEFINE_BOOL(regexp_shared_bytecode_cache, false,
+            "share regexp bytecode between isolates")
+DEFINE_BOOL(regexp_simd_skip, false,
+            "use SIMD instructions to skip to possible match starts in "
+            "one-byte subjects")
 #ifdef V8_TARGET_BIG_ENDIAN
 #define REGEXP_PEEPHOLE_OPTIMIZATION_BOOL false
 #else
 #define REGEXP_PEEPHOLE_OPTIMIZATION_BOOL true
 #endif
+DEFINE_BOOL(regexp_sticky_atoms, false,
+            "match non-global sticky regexps for plain strings by comparing "
+            "at lastIndex instead of compiling them")
 DEFINE_BOOL(regexp_tier_up, true,
             "enable regexp interpreter and tier up to the compiler after the "
             "number of executions set by the tier up ticks flag")
 DEFINE_INT(regexp_tier_up_ticks, 1,
            "set the number of executions for the regexp interpreter before "
            "tiering-up to the compiler")
+DEFINE_SIZE_T(regexp_retained_stack_size, 0,
+              "keep a grown regexp backtrack stack of up to this size (in "
+              "KBytes) for later executions instead of freeing it")
+DEFINE_BOOL(regexp_optimize_hot, false,
+            "keep regexps in the interpreter for at least the number of "
+            "executions set by the hot tier up ticks flag, then compile them "
+            "with more aggressive loop unrolling")
+DEFINE_INT(regexp_hot_tier_up_ticks, 10,
+           "set the number of executions for the regexp interpreter before "
+           "tiering-up with --regexp-optimize-hot")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
@@ -1687,6 +1849,10 @@ DEFINE_BOOL(trace_regexp_assembler, false,
 DEFINE_BOOL(trace_regexp_parser, false, "trace regexp parsing")
 DEFINE_BOOL(trace_regexp_tier_up, false, "trace regexp tiering up execution")
 DEFINE_BOOL(trace_regexp_graph, false, "trace the regexp graph")
+DEFINE_BOOL(regexp_execution_stats, false,
+            "collect per-pattern regexp execution counts and times, and print "
+            "them when the isolate is torn down (regexps are always executed "
+            "through the runtime)")
 
 DEFINE_BOOL(enable_experimental_regexp_engine, false,
             "recognize regexps with 'l' flag, run them on experimental engine")
@@ -1694,6 +1860,9 @@ DEFINE_BOOL(default_to_experimental_regexp_engine, false,
             "run regexps with the experimental engine where possible")
 DEFINE_IMPLICATION(default_to_experimental_regexp_engine,
                    enable_experimental_regexp_engine)
+DEFINE_BOOL(experimental_regexp_engine_skip, false,
+            "let the experimental regexp engine skip input positions at which "
+            "no match can start")
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
 
@@ -1757,6 +1926,9 @@ DEFINE_NEG_NEG_IMPLICATION(text_is_readable, partial_constant_pool)
 DEFINE_BOOL(trace_minor_mc_parallel_marking, false,
             "trace parallel marking for the young generation")
 DEFINE_BOOL(minor_mc, false, "perform young generation mark compact GCs")
+DEFINE_INT(minor_mc_high_survival_threshold, 30,
+           "average young generation survival rate (in percent) above which "
+           "the minor mark compactor promotes live pages in place (0 disables)")
 #else
 DEFINE_BOOL_READONLY(minor_mc, false,
                      "perform young generation mark compact GCs")
@@ -1875,6 +2047,9 @@ DEFINE_STRING(logfile, "v8.log",
               "Specify the name of the log file, use '-' for console, '+' for "
               "a temporary file.")
 DEFINE_BOOL(logfile_per_isolate, true, "Separate log files for each isolate.")
+DEFINE_BOOL(log_async_write, false,
+            "Write the log file on a background thread instead of the threads "
+            "that log the events.")
 
 DEFINE_BOOL(log, false,
             "Minimal logging (no API, code, GC, suspect, or handles samples).")
@@ -1942,6 +2117,10 @@ DEFINE_PERF_PROF_BOOL(
 DEFINE_PERF_PROF_BOOL(
     perf_prof_delete_file,
     "Remove the perf file right after creating it (for testing only).")
+DEFINE_PERF_PROF_BOOL(
+    perf_prof_async_write,
+    "Used with --perf-prof, collect the records in memory and write them to "
+    "the perf file on a background thread.")
 DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
 // TODO(v8:8462) Remove implication once perf supports remapping.
 DEFINE_NEG_IMPLICATION(perf_prof, write_protect_code_memory)
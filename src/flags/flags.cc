@@ -792,9 +792,11 @@ void ComputeFlagListHash() {
   }
   for (size_t i = 0; i < num_flags; ++i) {
     Flag* current = &flags[i];
-    if (current->PointsTo(&FLAG_profile_deserialization)) {
-      // We want to be able to flip --profile-deserialization without
-      // causing the code cache to get invalidated by this hash.
+    if (current->PointsTo(&FLAG_profile_deserialization) ||
+        current->PointsTo(&FLAG_verify_snapshot_checksum)) {
+      // We want to be able to flip --profile-deserialization and
+      // --verify-snapshot-checksum without causing the code cache to get
+      // invalidated by this hash.
       continue;
     }
     if (!current->IsDefault()) {
@@ -0,0 +1,94 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/array-buffer-pool.h"
+
+#include <cstring>
+
+namespace v8 {
+namespace internal {
+
+ArrayBufferPool::ArrayBufferPool(
+    v8::ArrayBuffer::Allocator* allocator,
+    std::shared_ptr<v8::ArrayBuffer::Allocator> allocator_shared,
+    size_t max_cached_bytes)
+    : allocator_(allocator),
+      allocator_shared_(std::move(allocator_shared)),
+      max_cached_bytes_(max_cached_bytes) {
+  DCHECK_IMPLIES(allocator_shared_, allocator_shared_.get() == allocator_);
+  CHECK_NOT_NULL(allocator_);
+}
+
+ArrayBufferPool::~ArrayBufferPool() { Flush(); }
+
+void* ArrayBufferPool::Allocate(size_t byte_length,
+                                InitializedFlag initialized) {
+  const size_t index = SizeClassIndex(byte_length);
+  const size_t size = SizeClassSize(index);
+  {
+    base::MutexGuard guard(&mutex_);
+    FreeEntry* entry = free_lists_[index];
+    if (entry) {
+      free_lists_[index] = entry->next;
+      stats_.cached_bytes -= size;
+      stats_.hits++;
+      if (initialized == InitializedFlag::kZeroInitialized) {
+        stats_.zero_fill_avoided_bytes += size;
+      }
+      // Only the free list link is left to clear; the rest of the buffer was
+      // zeroed in Release().
+      entry->next = nullptr;
+      return entry;
+    }
+    stats_.misses++;
+  }
+  if (initialized == InitializedFlag::kUninitialized) {
+    return allocator_->AllocateUninitialized(size);
+  }
+  return allocator_->Allocate(size);
+}
+
+void ArrayBufferPool::Release(void* buffer, size_t byte_length) {
+  DCHECK_NOT_NULL(buffer);
+  const size_t index = SizeClassIndex(byte_length);
+  const size_t size = SizeClassSize(index);
+  {
+    base::MutexGuard guard(&mutex_);
+    if (stats_.cached_bytes + size > max_cached_bytes_) {
+      allocator_->Free(buffer, size);
+      return;
+    }
+    // Reserve the space right away so that concurrent releases respect the
+    // limit while the buffer is zeroed outside of the lock.
+    stats_.cached_bytes += size;
+  }
+  memset(buffer, 0, size);
+  FreeEntry* entry = static_cast<FreeEntry*>(buffer);
+  base::MutexGuard guard(&mutex_);
+  entry->next = free_lists_[index];
+  free_lists_[index] = entry;
+}
+
+void ArrayBufferPool::Flush() {
+  base::MutexGuard guard(&mutex_);
+  for (size_t index = 0; index < kNumberOfSizeClasses; index++) {
+    const size_t size = SizeClassSize(index);
+    FreeEntry* entry = free_lists_[index];
+    while (entry) {
+      FreeEntry* next = entry->next;
+      allocator_->Free(entry, size);
+      stats_.cached_bytes -= size;
+      entry = next;
+    }
+    free_lists_[index] = nullptr;
+  }
+}
+
+ArrayBufferPool::Stats ArrayBufferPool::GetStats() {
+  base::MutexGuard guard(&mutex_);
+  return stats_;
+}
+
+}  // namespace internal
+}  // namespace v8
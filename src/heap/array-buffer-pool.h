@@ -0,0 +1,92 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_ARRAY_BUFFER_POOL_H_
+#define V8_HEAP_ARRAY_BUFFER_POOL_H_
+
+#include <memory>
+
+#include "include/v8.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+#include "src/objects/backing-store.h"
+
+namespace v8 {
+namespace internal {
+
+// Recycles small array buffer backing stores of an isolate. Buffers are
+// grouped into size classes of kGranularity bytes up to kMaxPooledSize and
+// kept on intrusive free lists, so that the embedder's ArrayBuffer::Allocator
+// is only called when a size class runs dry or the pool is full.
+//
+// Buffers are zeroed when they are returned to the pool. This usually happens
+// on the concurrent array buffer sweeper thread, which lets zero-initialized
+// allocations on the main thread skip the zero fill.
+//
+// The pool is shared between the heap and all backing stores allocated from
+// it, as backing stores may outlive the heap they were allocated in.
+class V8_EXPORT_PRIVATE ArrayBufferPool final {
+ public:
+  static constexpr size_t kGranularity = 4 * KB;
+  static constexpr size_t kMaxPooledSize = 64 * KB;
+  static constexpr size_t kNumberOfSizeClasses = kMaxPooledSize / kGranularity;
+
+  struct Stats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t zero_fill_avoided_bytes = 0;
+    size_t cached_bytes = 0;
+  };
+
+  ArrayBufferPool(v8::ArrayBuffer::Allocator* allocator,
+                  std::shared_ptr<v8::ArrayBuffer::Allocator> allocator_shared,
+                  size_t max_cached_bytes);
+  ~ArrayBufferPool();
+  ArrayBufferPool(const ArrayBufferPool&) = delete;
+  ArrayBufferPool& operator=(const ArrayBufferPool&) = delete;
+
+  static bool CanPool(size_t byte_length) {
+    return byte_length > 0 && byte_length <= kMaxPooledSize;
+  }
+
+  // Returns a buffer of at least {byte_length} bytes, or nullptr if the
+  // embedder's allocator failed.
+  void* Allocate(size_t byte_length, InitializedFlag initialized);
+
+  // Hands a buffer obtained from Allocate() for {byte_length} back to the
+  // pool. Can be called from any thread.
+  void Release(void* buffer, size_t byte_length);
+
+  // Returns all cached buffers to the embedder's allocator.
+  void Flush();
+
+  Stats GetStats();
+
+ private:
+  struct FreeEntry {
+    FreeEntry* next;
+  };
+
+  static size_t SizeClassIndex(size_t byte_length) {
+    DCHECK(CanPool(byte_length));
+    return (byte_length - 1) / kGranularity;
+  }
+  static size_t SizeClassSize(size_t index) {
+    return (index + 1) * kGranularity;
+  }
+
+  v8::ArrayBuffer::Allocator* const allocator_;
+  // Keeps {allocator_} alive if the embedder handed it out as a shared_ptr.
+  const std::shared_ptr<v8::ArrayBuffer::Allocator> allocator_shared_;
+  const size_t max_cached_bytes_;
+
+  base::Mutex mutex_;
+  FreeEntry* free_lists_[kNumberOfSizeClasses] = {};
+  Stats stats_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_ARRAY_BUFFER_POOL_H_
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_BASE_WORKLIST_H_
 #define V8_HEAP_BASE_WORKLIST_H_
 
+#include <algorithm>
 #include <cstddef>
 #include <utility>
 
@@ -285,6 +286,13 @@ class Worklist<EntryType, SegmentSize>::Local {
   void Publish();
   void Merge(Worklist<EntryType, SegmentSize>::Local* other);
 
+  // Moves half of the entries of the fuller local segment into a fresh
+  // segment on the global pool if the pool is currently empty. Called
+  // periodically by the owning thread so that idle threads can pick up work
+  // without waiting for a local segment to fill up. The local segments are
+  // never touched by other threads. Returns true if work was shared.
+  bool ShareWorkIfGlobalPoolIsEmpty();
+
   bool IsEmpty() const;
   void Clear();
 
@@ -422,6 +430,30 @@ void Worklist<EntryType, SegmentSize>::Local::Merge(
   worklist_->Merge(other->worklist_);
 }
 
+template <typename EntryType, uint16_t SegmentSize>
+bool Worklist<EntryType, SegmentSize>::Local::ShareWorkIfGlobalPoolIsEmpty() {
+  if (!worklist_->IsEmpty()) return false;
+  // The sentinel segment is always empty, so it is never selected below.
+  internal::SegmentBase* source = push_segment_->Size() >= pop_segment_->Size()
+                                      ? push_segment_
+                                      : pop_segment_;
+  const size_t size = source->Size();
+  if (size < 2) return false;
+  Segment* segment = static_cast<Segment*>(source);
+  Segment* shared = NewSegment();
+  // Share the oldest entries. Entries are popped in LIFO order, so these are
+  // the ones the owner would reach last.
+  const size_t shared_size = size / 2;
+  std::copy(segment->entries_, segment->entries_ + shared_size,
+            shared->entries_);
+  shared->index_ = static_cast<uint16_t>(shared_size);
+  std::move(segment->entries_ + shared_size, segment->entries_ + size,
+            segment->entries_);
+  segment->index_ = static_cast<uint16_t>(size - shared_size);
+  worklist_->Push(shared);
+  return true;
+}
+
 template <typename EntryType, uint16_t SegmentSize>
 void Worklist<EntryType, SegmentSize>::Local::PublishPushSegment() {
   if (push_segment_ != internal::SegmentBase::GetSentinelSegmentAddress())
@@ -83,6 +83,9 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
     }
   }
 
+  // Huge pages reduce iTLB misses when executing JIT code.
+  if (FLAG_advise_huge_pages) AdviseHugePages();
+
   return true;
 }
 
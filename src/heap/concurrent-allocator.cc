@@ -21,6 +21,7 @@ namespace internal {
 void StressConcurrentAllocatorTask::RunInternal() {
   Heap* heap = isolate_->heap();
   LocalHeap local_heap(heap, ThreadKind::kBackground);
+  local_heap.set_thread_name("StressConcurrentAllocator");
   UnparkedScope unparked_scope(&local_heap);
 
   const int kNumIterations = 2000;
@@ -82,6 +83,21 @@ void StressConcurrentAllocatorTask::Schedule(Isolate* isolate) {
 
 void ConcurrentAllocator::FreeLinearAllocationArea() {
   lab_.CloseAndMakeIterable();
+  max_lab_size_ = kMaxLabSize;
+}
+
+void ConcurrentAllocator::ReturnLinearAllocationArea() {
+  Address top = lab_.top();
+  Address limit = lab_.limit();
+  FreeLinearAllocationArea();
+  if (top == kNullAddress || top == limit) return;
+
+  if (local_heap_->heap()->incremental_marking()->black_allocation()) {
+    Page::FromAllocationAreaAddress(top)->DestroyBlackAreaBackground(top,
+                                                                     limit);
+  }
+  base::MutexGuard guard(space_->mutex());
+  space_->Free(top, limit - top, SpaceAccountingMode::kSpaceAccounted);
 }
 
 void ConcurrentAllocator::MakeLinearAllocationAreaIterable() {
@@ -121,8 +137,10 @@ AllocationResult ConcurrentAllocator::AllocateInLabSlow(
 
 bool ConcurrentAllocator::EnsureLab(AllocationOrigin origin) {
   auto result = space_->RawRefillLabBackground(
-      local_heap_, kLabSize, kMaxLabSize, kWordAligned, origin);
+      local_heap_, kLabSize, max_lab_size_, kWordAligned, origin);
   if (!result) return false;
+  max_lab_size_ =
+      std::min(2 * max_lab_size_, static_cast<size_t>(kMaxAdaptiveLabSize));
 
   if (local_heap_->heap()->incremental_marking()->black_allocation()) {
     Address top = result->first;
@@ -30,11 +30,14 @@ class StressConcurrentAllocatorTask : public CancelableTask {
 };
 
 // Concurrent allocator for allocation from background threads/tasks.
-// Allocations are served from a TLAB if possible.
+// Allocations are served from a TLAB if possible. The maximum size of the TLAB
+// doubles with every refill, so that threads allocating a lot take the space
+// mutex less often.
 class ConcurrentAllocator {
  public:
   static const int kLabSize = 4 * KB;
   static const int kMaxLabSize = 32 * KB;
+  static const int kMaxAdaptiveLabSize = 128 * KB;
   static const int kMaxLabObjectSize = 2 * KB;
 
   explicit ConcurrentAllocator(LocalHeap* local_heap, PagedSpace* space)
@@ -47,6 +50,10 @@ class ConcurrentAllocator {
                                       AllocationOrigin origin);
 
   void FreeLinearAllocationArea();
+  // Like FreeLinearAllocationArea() but returns the unused part of the TLAB to
+  // the free list of the space. Must not be used during mark-compact, when free
+  // lists are rebuilt by the sweeper.
+  void ReturnLinearAllocationArea();
   void MakeLinearAllocationAreaIterable();
   void MarkLinearAllocationAreaBlack();
   void UnmarkLinearAllocationArea();
@@ -66,6 +73,7 @@ class ConcurrentAllocator {
   LocalHeap* const local_heap_;
   PagedSpace* const space_;
   LocalAllocationBuffer lab_;
+  size_t max_lab_size_ = kMaxLabSize;
 };
 
 }  // namespace internal
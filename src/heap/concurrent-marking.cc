@@ -427,6 +427,8 @@ void ConcurrentMarking::Run(JobDelegate* delegate,
   NativeContextInferrer& native_context_inferrer =
       task_state->native_context_inferrer;
   NativeContextStats& native_context_stats = task_state->native_context_stats;
+  SampledObjectStats& sampled_object_stats = task_state->sampled_object_stats;
+  const bool sample_object_stats = SampledObjectStats::IsEnabled();
   double time_ms;
   size_t marked_bytes = 0;
   Isolate* isolate = heap_->isolate();
@@ -449,6 +451,11 @@ void ConcurrentMarking::Run(JobDelegate* delegate,
       }
     }
     bool is_per_context_mode = local_marking_worklists.IsPerContextMode();
+    MarkingPrefetchBuffer prefetch_buffer(
+        is_per_context_mode ? 0 : FLAG_marking_prefetch_distance);
+    auto pop = [&local_marking_worklists](HeapObject* object) {
+      return local_marking_worklists.Pop(object);
+    };
     bool done = false;
     while (!done) {
       size_t current_marked_bytes = 0;
@@ -456,7 +463,7 @@ void ConcurrentMarking::Run(JobDelegate* delegate,
       while (current_marked_bytes < kBytesUntilInterruptCheck &&
              objects_processed < kObjectsUntilInterrupCheck) {
         HeapObject object;
-        if (!local_marking_worklists.Pop(&object)) {
+        if (!prefetch_buffer.Pop(pop, &object)) {
           done = true;
           break;
         }
@@ -494,12 +501,18 @@ void ConcurrentMarking::Run(JobDelegate* delegate,
             native_context_stats.IncrementSize(
                 local_marking_worklists.Context(), map, object, visited_size);
           }
+          if (sample_object_stats) {
+            sampled_object_stats.Sample(map, visited_size);
+          }
           current_marked_bytes += visited_size;
         }
       }
       marked_bytes += current_marked_bytes;
       base::AsAtomicWord::Relaxed_Store<size_t>(&task_state->marked_bytes,
                                                 marked_bytes);
+      if (!done && local_marking_worklists.SplitWork()) {
+        delegate->NotifyConcurrencyIncrease();
+      }
       if (delegate->ShouldYield()) {
         TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
                      "ConcurrentMarking::Run Preempted");
@@ -507,6 +520,10 @@ void ConcurrentMarking::Run(JobDelegate* delegate,
       }
     }
 
+    prefetch_buffer.Flush([&local_marking_worklists](HeapObject object) {
+      local_marking_worklists.Push(object);
+    });
+
     if (done) {
       Ephemeron ephemeron;
 
@@ -614,6 +631,15 @@ void ConcurrentMarking::FlushNativeContexts(NativeContextStats* main_stats) {
   }
 }
 
+void ConcurrentMarking::FlushSampledObjectStats(
+    SampledObjectStats* main_stats) {
+  DCHECK(!job_handle_ || !job_handle_->IsValid());
+  for (int i = 1; i <= kMaxTasks; i++) {
+    main_stats->Merge(task_state_[i].sampled_object_stats);
+    task_state_[i].sampled_object_stats.Clear();
+  }
+}
+
 void ConcurrentMarking::FlushMemoryChunkData(
     MajorNonAtomicMarkingState* marking_state) {
   DCHECK(!job_handle_ || !job_handle_->IsValid());
@@ -14,6 +14,7 @@
 #include "src/heap/marking-visitor.h"
 #include "src/heap/marking-worklist.h"
 #include "src/heap/memory-measurement.h"
+#include "src/heap/object-stats.h"
 #include "src/heap/slot-set.h"
 #include "src/heap/spaces.h"
 #include "src/heap/worklist.h"
@@ -80,6 +81,9 @@ class V8_EXPORT_PRIVATE ConcurrentMarking {
       TaskPriority priority = TaskPriority::kUserVisible);
   // Flushes native context sizes to the given table of the main thread.
   void FlushNativeContexts(NativeContextStats* main_stats);
+  // Merges the object stats sampled by the tasks into {main_stats} and
+  // clears them.
+  void FlushSampledObjectStats(SampledObjectStats* main_stats);
   // Flushes memory chunk data using the given marking state.
   void FlushMemoryChunkData(MajorNonAtomicMarkingState* marking_state);
   // This function is called for a new space page that was cleared after
@@ -102,6 +106,7 @@ class V8_EXPORT_PRIVATE ConcurrentMarking {
     MemoryChunkDataMap memory_chunk_data;
     NativeContextInferrer native_context_inferrer;
     NativeContextStats native_context_stats;
+    SampledObjectStats sampled_object_stats;
     char cache_line_padding[64];
   };
   class JobTask;
@@ -27,6 +27,11 @@ namespace {
 // Freelist size threshold that must be exceeded before compaction
 // should be considered.
 static constexpr size_t kFreeListSizeThreshold = 512 * kKB;
+// A space is only compacted if its free list could release at least this many
+// pages...
+static constexpr size_t kMinFreePagesToCompactSpace = 2;
+// ...and at least this fraction of its pages is on the free list.
+static constexpr double kMinFragmentationToCompactSpace = 0.25;
 
 // The real worker behind heap compaction, recording references to movable
 // objects ("slots".) When the objects end up being compacted and moved,
@@ -102,8 +107,8 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
 
   // The following cases are not compacted and do not require recording:
   // - Compactable object on large pages.
-  // - Compactable object on non-compactable spaces.
-  if (value_page->is_large() || !value_page->space().is_compactable()) return;
+  // - Compactable object on spaces that are not compacted in this cycle.
+  if (value_page->is_large() || !value_page->space().is_compacted()) return;
 
   // Slots must reside in and values must point to live objects at this
   // point. |value| usually points to a separate object but can also point
@@ -124,7 +129,7 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
   movable_references_.emplace(value, slot);
 
   // Check whether the slot itself resides on a page that is compacted.
-  if (V8_LIKELY(!slot_page->space().is_compactable())) return;
+  if (V8_LIKELY(!slot_page->space().is_compacted())) return;
 
   CHECK_EQ(interior_movable_references_.end(),
            interior_movable_references_.find(slot));
@@ -423,6 +428,15 @@ void CompactSpace(NormalPageSpace* space,
   // Sweeping will verify object start bitmap of compacted space.
 }
 
+bool IsFragmented(const NormalPageSpace* space) {
+  DCHECK(space->is_compactable());
+  const size_t space_size = space->size() * kPageSize;
+  if (!space_size) return false;
+  const size_t free_list_size = space->free_list().Size();
+  return free_list_size >= kMinFreePagesToCompactSpace * kPageSize &&
+         free_list_size >= kMinFragmentationToCompactSpace * space_size;
+}
+
 size_t UpdateHeapResidency(const std::vector<NormalPageSpace*>& spaces) {
   return std::accumulate(spaces.cbegin(), spaces.cend(), 0u,
                          [](size_t acc, const NormalPageSpace* space) {
@@ -495,23 +509,33 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
   StatsCollector::EnabledScope stats_scope(heap_.heap()->stats_collector(),
                                            StatsCollector::kAtomicCompact);
 
+  // Only the fragmented spaces are compacted, the others are swept as usual.
+  bool any_space_compacted = false;
+  for (NormalPageSpace* space : compactable_spaces_) {
+    const bool compact =
+        enable_for_next_gc_for_testing_ || IsFragmented(space);
+    space->set_compacted(compact);
+    any_space_compacted |= compact;
+  }
+
   MovableReferences movable_references(*heap_.heap());
 
   CompactionWorklists::MovableReferencesWorklist::Local local(
       compaction_worklists_->movable_slots_worklist());
   CompactionWorklists::MovableReference* slot;
   while (local.Pop(&slot)) {
-    movable_references.AddOrFilter(slot);
+    if (any_space_compacted) movable_references.AddOrFilter(slot);
   }
   compaction_worklists_.reset();
 
   for (NormalPageSpace* space : compactable_spaces_) {
-    CompactSpace(space, movable_references);
+    if (space->is_compacted()) CompactSpace(space, movable_references);
   }
 
   enable_for_next_gc_for_testing_ = false;
   is_enabled_ = false;
-  return CompactableSpaceHandling::kIgnore;
+  return any_space_compacted ? CompactableSpaceHandling::kIgnore
+                             : CompactableSpaceHandling::kSweep;
 }
 
 void Compactor::EnableForNextGCForTesting() {
@@ -29,9 +29,14 @@ bool DrainWorklistWithYielding(
     IncrementalMarkingSchedule& incremental_marking_schedule,
     WorklistLocal& worklist_local, Callback callback) {
   return DrainWorklistWithPredicate<kDeadlineCheckInterval>(
-      [&incremental_marking_schedule, &marking_state, job_delegate]() {
+      [&incremental_marking_schedule, &marking_state, &worklist_local,
+       job_delegate]() {
         incremental_marking_schedule.AddConcurrentlyMarkedBytes(
             marking_state.RecentlyMarkedBytes());
+        // Give idle markers a chance to pick up work while this one is busy.
+        if (worklist_local.ShareWorkIfGlobalPoolIsEmpty()) {
+          job_delegate->NotifyConcurrencyIncrease();
+        }
         return job_delegate->ShouldYield();
       },
       worklist_local, callback);
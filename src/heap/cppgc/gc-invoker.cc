@@ -83,10 +83,16 @@ GCInvoker::GCInvokerImpl::~GCInvokerImpl() {
 
 void GCInvoker::GCInvokerImpl::CollectGarbage(GarbageCollector::Config config) {
   DCHECK_EQ(config.marking_type, cppgc::Heap::MarkingType::kAtomic);
+  // Minor GCs do not support scanning the stack and always require a
+  // precise GC.
+  const bool can_scan_stack =
+      (stack_support_ ==
+       cppgc::Heap::StackSupport::kSupportsConservativeStackScan) &&
+      (config.collection_type ==
+       GarbageCollector::Config::CollectionType::kMajor);
   if ((config.stack_state ==
        GarbageCollector::Config::StackState::kNoHeapPointers) ||
-      (stack_support_ ==
-       cppgc::Heap::StackSupport::kSupportsConservativeStackScan)) {
+      can_scan_stack) {
     collector_->CollectGarbage(config);
   } else if (platform_->GetForegroundTaskRunner() &&
              platform_->GetForegroundTaskRunner()->NonNestableTasksEnabled()) {
@@ -45,6 +45,9 @@ class HeapGrowing::HeapGrowingImpl final
 
   size_t limit_for_atomic_gc() const { return limit_for_atomic_gc_; }
   size_t limit_for_incremental_gc() const { return limit_for_incremental_gc_; }
+#if defined(CPPGC_YOUNG_GENERATION)
+  size_t limit_for_minor_gc() const { return limit_for_minor_gc_; }
+#endif  // CPPGC_YOUNG_GENERATION
 
   void DisableForTesting();
 
@@ -57,6 +60,9 @@ class HeapGrowing::HeapGrowingImpl final
   size_t initial_heap_size_ = 1 * kMB;
   size_t limit_for_atomic_gc_ = 0;       // See ConfigureLimit().
   size_t limit_for_incremental_gc_ = 0;  // See ConfigureLimit().
+#if defined(CPPGC_YOUNG_GENERATION)
+  size_t limit_for_minor_gc_ = 0;  // See ConfigureLimit().
+#endif  // CPPGC_YOUNG_GENERATION
 
   SingleThreadedHandle gc_task_handle_;
 
@@ -103,6 +109,16 @@ void HeapGrowing::HeapGrowingImpl::AllocatedObjectSizeIncreased(size_t) {
          GarbageCollector::Config::StackState::kMayContainHeapPointers,
          marking_support_, sweeping_support_});
   }
+#if defined(CPPGC_YOUNG_GENERATION)
+  else if (allocated_object_size > limit_for_minor_gc_) {
+    // Minor GCs cannot scan the stack, GCInvoker defers them to a
+    // non-nestable task.
+    collector_->CollectGarbage(
+        {GarbageCollector::Config::CollectionType::kMinor,
+         GarbageCollector::Config::StackState::kMayContainHeapPointers,
+         GarbageCollector::Config::MarkingType::kAtomic, sweeping_support_});
+  }
+#endif  // CPPGC_YOUNG_GENERATION
 }
 
 void HeapGrowing::HeapGrowingImpl::ResetAllocatedObjectSize(
@@ -138,6 +154,13 @@ void HeapGrowing::HeapGrowingImpl::ConfigureLimit(
       std::max(minimum_limit_incremental_gc,
                std::min(maximum_limit_incremental_gc,
                         limit_incremental_gc_based_on_allocation_rate));
+#if defined(CPPGC_YOUNG_GENERATION)
+  // Young objects only survive a minor GC if they are reachable from roots or
+  // from the remembered set, so minor GCs run at a fixed allocation volume
+  // independent of the heap size.
+  limit_for_minor_gc_ =
+      allocated_object_size + HeapGrowing::kYoungGenerationAllocationLimit;
+#endif  // CPPGC_YOUNG_GENERATION
 }
 
 void HeapGrowing::HeapGrowingImpl::DisableForTesting() {
@@ -161,6 +184,11 @@ size_t HeapGrowing::limit_for_atomic_gc() const {
 size_t HeapGrowing::limit_for_incremental_gc() const {
   return impl_->limit_for_incremental_gc();
 }
+#if defined(CPPGC_YOUNG_GENERATION)
+size_t HeapGrowing::limit_for_minor_gc() const {
+  return impl_->limit_for_minor_gc();
+}
+#endif  // CPPGC_YOUNG_GENERATION
 
 void HeapGrowing::DisableForTesting() { impl_->DisableForTesting(); }
 
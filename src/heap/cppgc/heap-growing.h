@@ -32,6 +32,11 @@ class V8_EXPORT_PRIVATE HeapGrowing final {
   // before triggering GC again.
   static constexpr size_t kMinLimitIncrease =
       kPageSize * RawHeap::kNumberOfRegularSpaces;
+#if defined(CPPGC_YOUNG_GENERATION)
+  // Bytes that may be allocated after a garbage collection before a minor
+  // garbage collection is triggered.
+  static constexpr size_t kYoungGenerationAllocationLimit = 1 * kMB;
+#endif  // CPPGC_YOUNG_GENERATION
 
   HeapGrowing(GarbageCollector*, StatsCollector*,
               cppgc::Heap::ResourceConstraints, cppgc::Heap::MarkingType,
@@ -43,6 +48,9 @@ class V8_EXPORT_PRIVATE HeapGrowing final {
 
   size_t limit_for_atomic_gc() const;
   size_t limit_for_incremental_gc() const;
+#if defined(CPPGC_YOUNG_GENERATION)
+  size_t limit_for_minor_gc() const;
+#endif  // CPPGC_YOUNG_GENERATION
 
   void DisableForTesting();
 
@@ -49,6 +49,14 @@ class V8_EXPORT_PRIVATE BaseSpace {
 
   bool is_compactable() const { return is_compactable_; }
 
+  // Set by the compactor for the spaces it compacts in the current garbage
+  // collection. Such spaces are not swept.
+  bool is_compacted() const { return is_compacted_; }
+  void set_compacted(bool compacted) {
+    DCHECK_IMPLIES(compacted, is_compactable_);
+    is_compacted_ = compacted;
+  }
+
  protected:
   enum class PageType { kNormal, kLarge };
   explicit BaseSpace(RawHeap* heap, size_t index, PageType type,
@@ -61,6 +69,7 @@ class V8_EXPORT_PRIVATE BaseSpace {
   const size_t index_;
   const PageType type_;
   const bool is_compactable_;
+  bool is_compacted_ = false;
 };
 
 class V8_EXPORT_PRIVATE NormalPageSpace final : public BaseSpace {
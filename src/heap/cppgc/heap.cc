@@ -112,6 +112,12 @@ void Heap::CollectGarbage(Config config) {
 
   if (in_no_gc_scope()) return;
 
+#if defined(CPPGC_YOUNG_GENERATION)
+  // A minor GC must not finalize an already running major marking cycle.
+  if (config.collection_type == Config::CollectionType::kMinor && IsMarking())
+    return;
+#endif
+
   config_ = config;
 
   if (!IsMarking()) {
@@ -116,6 +116,11 @@ void StatsCollector::NotifyMarkingStarted(CollectionType collection_type,
 void StatsCollector::NotifyMarkingCompleted(size_t marked_bytes) {
   DCHECK_EQ(GarbageCollectionState::kMarking, gc_state_);
   gc_state_ = GarbageCollectionState::kSweeping;
+  if (current_.collection_type == CollectionType::kMinor) {
+    // Minor GCs only mark young objects; old objects are kept alive by sticky
+    // mark bits and were accounted for by the previous cycle.
+    marked_bytes += previous_.marked_bytes;
+  }
   current_.marked_bytes = marked_bytes;
   current_.object_size_before_sweep_bytes =
       previous_.marked_bytes + allocated_bytes_since_end_of_marking_ +
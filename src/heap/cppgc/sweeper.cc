@@ -495,7 +495,7 @@ class PrepareForSweepVisitor final
 
   bool VisitNormalPageSpace(NormalPageSpace& space) {
     if ((compactable_space_handling_ == CompactableSpaceHandling::kIgnore) &&
-        space.is_compactable())
+        space.is_compacted())
       return true;
     DCHECK(!space.linear_allocation_buffer().size());
     space.free_list().Clear();
@@ -61,6 +61,7 @@
 #include "src/objects/scope-info.h"
 #include "src/objects/stack-frame-info-inl.h"
 #include "src/objects/string-set-inl.h"
+#include "src/objects/string-table.h"
 #include "src/objects/struct-inl.h"
 #include "src/objects/synthetic-module-inl.h"
 #include "src/objects/template-objects-inl.h"
@@ -790,12 +791,12 @@ Handle<String> Factory::AllocateInternalizedStringImpl(T t, int chars,
     size = SeqTwoByteString::SizeFor(chars);
   }
 
-  String result = String::cast(
-      AllocateRawWithImmortalMap(size,
-                                 isolate()->heap()->CanAllocateInReadOnlySpace()
-                                     ? AllocationType::kReadOnly
-                                     : AllocationType::kOld,
-                                 map));
+  String result = String::cast(AllocateRawWithImmortalMap(
+      size,
+      isolate()->heap()->CanAllocateInReadOnlySpace()
+          ? AllocationType::kReadOnly
+          : AllocationTypeForInternalizedString(size),
+      map));
   DisallowGarbageCollection no_gc;
   result.set_length(chars);
   result.set_raw_hash_field(hash_field);
@@ -842,6 +843,9 @@ MaybeHandle<Map> Factory::InternalizedStringMapForString(
   // Do not internalize young strings: This allows us to ignore both string
   // table and stub cache on scavenges.
   if (Heap::InYoungGeneration(*string)) return MaybeHandle<Map>();
+  // With a shared string table, internalized strings are copied to the
+  // shared heap instead.
+  if (isolate()->string_table()->HasSharedTable()) return MaybeHandle<Map>();
   return GetInternalizedStringMap(this, string);
 }
 
@@ -1088,6 +1092,8 @@ Context Factory::NewContextInternal(Handle<Map> map, int size,
 
 Handle<NativeContext> Factory::NewNativeContext() {
   Handle<Map> map = NewMap(NATIVE_CONTEXT_TYPE, kVariableSizeSentinel);
+  Handle<WeakFixedArray> proxy_trap_cache =
+      NewWeakFixedArray(JSProxy::kTrapCacheLength, AllocationType::kOld);
   NativeContext context = NativeContext::cast(NewContextInternal(
       map, NativeContext::kSize, NativeContext::NATIVE_CONTEXT_SLOTS,
       AllocationType::kOld));
@@ -1105,6 +1111,7 @@ Handle<NativeContext> Factory::NewNativeContext() {
   context.set_microtask_queue(isolate(), nullptr);
   context.set_osr_code_cache(*empty_weak_fixed_array());
   context.set_retained_maps(*empty_weak_array_list());
+  context.set_proxy_trap_cache(*proxy_trap_cache);
   return handle(context, isolate());
 }
 
@@ -3350,9 +3357,12 @@ void Factory::SetRegExpIrregexpData(Handle<JSRegExp> regexp,
       *NewFixedArray(JSRegExp::kIrregexpDataSize, AllocationType::kYoung);
   DisallowGarbageCollection no_gc;
   Smi uninitialized = Smi::FromInt(JSRegExp::kUninitializedValue);
-  Smi ticks_until_tier_up = FLAG_regexp_tier_up
-                                ? Smi::FromInt(FLAG_regexp_tier_up_ticks)
-                                : uninitialized;
+  int tier_up_ticks = FLAG_regexp_optimize_hot
+                          ? std::max(FLAG_regexp_tier_up_ticks,
+                                     FLAG_regexp_hot_tier_up_ticks)
+                          : FLAG_regexp_tier_up_ticks;
+  Smi ticks_until_tier_up =
+      FLAG_regexp_tier_up ? Smi::FromInt(tier_up_ticks) : uninitialized;
   store.set(JSRegExp::kTagIndex, Smi::FromInt(JSRegExp::IRREGEXP));
   store.set(JSRegExp::kSourceIndex, *source, SKIP_WRITE_BARRIER);
   store.set(JSRegExp::kFlagsIndex, Smi::FromInt(flags));
@@ -3667,6 +3677,15 @@ Handle<CallHandlerInfo> Factory::NewCallHandlerInfo(bool has_no_side_effect) {
   return handle(info, isolate());
 }
 
+AllocationType Factory::AllocationTypeForInternalizedString(int size) {
+  if (isolate()->string_table()->HasSharedTable() &&
+      size <= isolate()->heap()->MaxRegularHeapObjectSize(
+                  AllocationType::kSharedOld)) {
+    return AllocationType::kSharedOld;
+  }
+  return AllocationType::kOld;
+}
+
 bool Factory::CanAllocateInReadOnlySpace() {
   return isolate()->heap()->CanAllocateInReadOnlySpace();
 }
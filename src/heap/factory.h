@@ -963,6 +963,9 @@ class V8_EXPORT_PRIVATE Factory : public FactoryBase<Factory> {
   }
   bool CanAllocateInReadOnlySpace();
   bool EmptyStringRootIsInitialized();
+  // Internalized strings are allocated in the shared heap when the string
+  // table is shared with other isolates; see StringTable::set_shared_table().
+  AllocationType AllocationTypeForInternalizedString(int size);
 
   void AddToScriptList(Handle<Script> shared);
   // ------
@@ -4,6 +4,8 @@
 
 #include "src/heap/finalization-registry-cleanup-task.h"
 
+#include <algorithm>
+
 #include "src/execution/frames.h"
 #include "src/execution/interrupts-scope.h"
 #include "src/execution/stack-guard.h"
@@ -81,12 +83,18 @@ void FinalizationRegistryCleanupTask::RunInternal() {
   // Cleanup is interrupted if there is an exception. The HTML spec calls for a
   // microtask checkpoint after each cleanup task, so the task should return
   // after an exception so the host can perform a microtask checkpoint. In case
-  // of exception, check if the FinalizationRegistry still needs cleanup
-  // and should be requeued.
-  //
-  // TODO(syg): Implement better scheduling for finalizers.
-  InvokeFinalizationRegistryCleanupFromTask(context, finalization_registry,
-                                            callback);
+  // of exception, or if the time budget ran out, check if the
+  // FinalizationRegistry still needs cleanup and should be requeued.
+  const double deadline_in_ms = heap_->MonotonicallyIncreasingTimeInMs() +
+                                FLAG_finalization_registry_cleanup_budget;
+  do {
+    if (!InvokeFinalizationRegistryCleanupFromTask(
+            context, finalization_registry, callback,
+            std::max(1, FLAG_finalization_registry_cleanup_slice))) {
+      break;
+    }
+  } while (finalization_registry->NeedsCleanup() &&
+           heap_->MonotonicallyIncreasingTimeInMs() < deadline_in_ms);
   if (finalization_registry->NeedsCleanup() &&
       !finalization_registry->scheduled_for_cleanup()) {
     auto nop = [](HeapObject, ObjectSlot, Object) {};
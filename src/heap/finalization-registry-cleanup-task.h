@@ -14,6 +14,10 @@ namespace internal {
 // The GC schedules a cleanup task when the dirty FinalizationRegistry list is
 // non-empty. The task processes a single FinalizationRegistry and posts another
 // cleanup task if there are remaining dirty FinalizationRegistries on the list.
+// Cleared cells are processed in slices of at most
+// --finalization-registry-cleanup-slice cells until the registry is clean or
+// the task ran for --finalization-registry-cleanup-budget ms, in which case
+// the registry is requeued and the rest is left to a later task.
 class FinalizationRegistryCleanupTask : public CancelableTask {
  public:
   explicit FinalizationRegistryCleanupTask(Heap* heap);
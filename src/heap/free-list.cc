@@ -4,6 +4,7 @@
 
 #include "src/heap/free-list.h"
 
+#include "src/base/bits.h"
 #include "src/base/macros.h"
 #include "src/common/globals.h"
 #include "src/heap/free-list-inl.h"
@@ -108,7 +109,10 @@ void FreeListCategory::Relink(FreeList* owner) {
 // ------------------------------------------------
 // Generic FreeList methods (alloc/free related)
 
-FreeList* FreeList::CreateFreeList() { return new FreeListManyCachedOrigin(); }
+FreeList* FreeList::CreateFreeList() {
+  if (FLAG_gc_freelist_bitmap) return new FreeListManyBitmap();
+  return new FreeListManyCachedOrigin();
+}
 
 FreeSpace FreeList::TryFindNodeIn(FreeListCategoryType type,
                                   size_t minimum_size, size_t* node_size) {
@@ -225,6 +229,7 @@ FreeSpace FreeListMany::Allocate(size_t size_in_bytes, size_t* node_size,
 
   if (!node.is_null()) {
     Page::FromHeapObject(node)->IncreaseAllocatedBytes(*node_size);
+    RecordAllocation(size_in_bytes, *node_size);
   }
 
   DCHECK(IsVeryLong() || Available() == SumFreeLists());
@@ -331,6 +336,7 @@ FreeSpace FreeListManyCached::Allocate(size_t size_in_bytes, size_t* node_size,
 
   if (!node.is_null()) {
     Page::FromHeapObject(node)->IncreaseAllocatedBytes(*node_size);
+    RecordAllocation(size_in_bytes, *node_size);
   }
 
   DCHECK(IsVeryLong() || Available() == SumFreeLists());
@@ -397,6 +403,95 @@ FreeSpace FreeListManyCachedFastPath::Allocate(size_t size_in_bytes,
 
   if (!node.is_null()) {
     Page::FromHeapObject(node)->IncreaseAllocatedBytes(*node_size);
+    RecordAllocation(size_in_bytes, *node_size);
+  }
+
+  DCHECK(IsVeryLong() || Available() == SumFreeLists());
+  return node;
+}
+
+// ------------------------------------------------
+// FreeListManyBitmap implementation
+
+void FreeListManyBitmap::Reset() {
+  nonempty_categories_ = 0;
+  FreeListMany::Reset();
+}
+
+bool FreeListManyBitmap::AddCategory(FreeListCategory* category) {
+  bool was_added = FreeList::AddCategory(category);
+  if (was_added) {
+    nonempty_categories_ |= uint32_t{1} << category->type_;
+  }
+
+#ifdef DEBUG
+  CheckBitmapIntegrity();
+#endif
+
+  return was_added;
+}
+
+void FreeListManyBitmap::RemoveCategory(FreeListCategory* category) {
+  FreeList::RemoveCategory(category);
+  int type = category->type_;
+  if (categories_[type] == nullptr) {
+    nonempty_categories_ &= ~(uint32_t{1} << type);
+  }
+
+#ifdef DEBUG
+  CheckBitmapIntegrity();
+#endif
+}
+
+FreeSpace FreeListManyBitmap::TryFindNodeInCategories(uint32_t candidates,
+                                                      size_t size_in_bytes,
+                                                      size_t* node_size) {
+  FreeSpace node;
+  while (candidates != 0 && node.is_null()) {
+    FreeListCategoryType type = static_cast<FreeListCategoryType>(
+        base::bits::CountTrailingZeros32(candidates));
+    // Clears the lowest set bit. TryFindNodeIn() updates the bitmap through
+    // RemoveCategory() if the category becomes empty.
+    candidates &= candidates - 1;
+    node = TryFindNodeIn(type, size_in_bytes, node_size);
+  }
+  return node;
+}
+
+FreeSpace FreeListManyBitmap::Allocate(size_t size_in_bytes, size_t* node_size,
+                                       AllocationOrigin origin) {
+  DCHECK_GE(kMaxBlockSize, size_in_bytes);
+  FreeSpace node;
+
+  if (origin != AllocationOrigin::kGC) {
+    // Fast path: prefer nodes that leave a large linear allocation area.
+    FreeListCategoryType first_category =
+        SelectFreeListCategoryType(size_in_bytes + kFastPathOffset);
+    if (first_category < last_category_) {
+      node = TryFindNodeInCategories(CategoriesFrom(first_category + 1),
+                                     size_in_bytes, node_size);
+    }
+  }
+
+  if (node.is_null()) {
+    // Best fit.
+    node = TryFindNodeInCategories(
+        CategoriesFrom(SelectFreeListCategoryType(size_in_bytes)),
+        size_in_bytes, node_size);
+  }
+
+  if (node.is_null()) {
+    // Searching each element of the last category.
+    node = SearchForNodeInList(last_category_, size_in_bytes, node_size);
+  }
+
+#ifdef DEBUG
+  CheckBitmapIntegrity();
+#endif
+
+  if (!node.is_null()) {
+    Page::FromHeapObject(node)->IncreaseAllocatedBytes(*node_size);
+    RecordAllocation(size_in_bytes, *node_size);
   }
 
   DCHECK(IsVeryLong() || Available() == SumFreeLists());
@@ -430,6 +525,14 @@ void FreeList::Reset() {
   available_ = 0;
 }
 
+void FreeList::RecordAllocationSlow(size_t size_in_bytes, size_t node_size) {
+  if (allocations_per_category_.empty()) {
+    allocations_per_category_.resize(number_of_categories_);
+  }
+  allocations_per_category_[SelectFreeListCategoryType(node_size)]++;
+  overallocated_bytes_ += node_size - size_in_bytes;
+}
+
 size_t FreeList::EvictFreeListItems(Page* page) {
   size_t sum = 0;
   page->ForAllFreeListCategories([this, &sum](FreeListCategory* category) {
@@ -5,8 +5,11 @@
 #ifndef V8_HEAP_FREE_LIST_H_
 #define V8_HEAP_FREE_LIST_H_
 
+#include <vector>
+
 #include "src/base/macros.h"
 #include "src/common/globals.h"
+#include "src/flags/flags.h"
 #include "src/heap/memory-chunk.h"
 #include "src/objects/free-space.h"
 #include "src/objects/map.h"
@@ -108,6 +111,7 @@ class FreeListCategory {
 
   friend class FreeList;
   friend class FreeListManyCached;
+  friend class FreeListManyBitmap;
   friend class PagedSpace;
   friend class MapSpace;
 };
@@ -179,6 +183,16 @@ class FreeList {
 
   size_t wasted_bytes() { return wasted_bytes_; }
 
+  // Allocation statistics for comparing strategies, only collected with
+  // --trace-gc-freelists: how many nodes were taken from each category and
+  // how many bytes the nodes exceeded the requested sizes by.
+  size_t allocations_from_category(FreeListCategoryType type) const {
+    return type < static_cast<int>(allocations_per_category_.size())
+               ? allocations_per_category_[type]
+               : 0;
+  }
+  size_t overallocated_bytes() const { return overallocated_bytes_; }
+
   template <typename Callback>
   void ForAllFreeListCategories(FreeListCategoryType type, Callback callback) {
     FreeListCategory* current = categories_[type];
@@ -245,6 +259,13 @@ class FreeList {
 
   inline Page* GetPageForCategoryType(FreeListCategoryType type);
 
+  void RecordAllocation(size_t size_in_bytes, size_t node_size) {
+    if (V8_LIKELY(!FLAG_trace_gc_freelists)) return;
+    RecordAllocationSlow(size_in_bytes, node_size);
+  }
+  V8_NOINLINE void RecordAllocationSlow(size_t size_in_bytes,
+                                        size_t node_size);
+
   int number_of_categories_ = 0;
   FreeListCategoryType last_category_ = 0;
   size_t min_block_size_ = 0;
@@ -255,6 +276,9 @@ class FreeList {
   // |available_|: The number of bytes in this freelist.
   size_t available_ = 0;
 
+  std::vector<size_t> allocations_per_category_;
+  size_t overallocated_bytes_ = 0;
+
   friend class FreeListCategory;
   friend class Page;
   friend class MemoryChunk;
@@ -472,6 +496,54 @@ class V8_EXPORT_PRIVATE FreeListManyCachedFastPath : public FreeListManyCached {
       FreeListManyCachedFastPathSelectFastAllocationFreeListCategoryType);
 };
 
+// Same categories as FreeListMany, but keeps a bitmap of the non-empty
+// categories, so that the best-fitting non-empty category is found with a
+// single count-trailing-zeros and maintaining the bitmap is constant time.
+// Like FreeListManyCachedOrigin, allocations by the GC are best-fit, while
+// other allocations first look for a node at least kFastPathOffset bytes
+// larger than requested, to get larger linear allocation areas.
+// Enabled with --gc-freelist-bitmap.
+class V8_EXPORT_PRIVATE FreeListManyBitmap : public FreeListMany {
+ public:
+  V8_WARN_UNUSED_RESULT FreeSpace Allocate(size_t size_in_bytes,
+                                           size_t* node_size,
+                                           AllocationOrigin origin) override;
+
+  void Reset() override;
+
+  bool AddCategory(FreeListCategory* category) override;
+  void RemoveCategory(FreeListCategory* category) override;
+
+ protected:
+  static const size_t kFastPathOffset = 2048 - 128;
+  STATIC_ASSERT(kNumberOfCategories <= 32);
+
+  // Returns the mask of categories that are at least {type}, excluding the
+  // last category, which has to be searched for a fitting node.
+  uint32_t CategoriesFrom(FreeListCategoryType type) const {
+    return nonempty_categories_ & ~((uint32_t{1} << type) - 1) &
+           ~(uint32_t{1} << last_category_);
+  }
+
+  // Takes the first node of the lowest non-empty category in {candidates}.
+  FreeSpace TryFindNodeInCategories(uint32_t candidates, size_t size_in_bytes,
+                                    size_t* node_size);
+
+#ifdef DEBUG
+  void CheckBitmapIntegrity() {
+    for (int i = 0; i <= last_category_; i++) {
+      DCHECK_EQ(categories_[i] != nullptr,
+                (nonempty_categories_ & (uint32_t{1} << i)) != 0);
+    }
+  }
+#endif
+
+  uint32_t nonempty_categories_ = 0;
+
+  FRIEND_TEST(SpacesTest, FreeListManyBitmapCategoriesFrom);
+  FRIEND_TEST(SpacesTest, FreeListManyBitmapTracksCategories);
+};
+
 // Uses FreeListManyCached if in the GC; FreeListManyCachedFastPath otherwise.
 // The reasonning behind this FreeList is the following: the GC runs in
 // parallel, and therefore, more expensive allocations there are less
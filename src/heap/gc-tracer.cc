@@ -4,10 +4,12 @@
 
 #include "src/heap/gc-tracer.h"
 
+#include <algorithm>
 #include <cstdarg>
 
 #include "include/v8-metrics.h"
 #include "src/base/atomic-utils.h"
+#include "src/base/bits.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/execution/thread-id.h"
@@ -15,6 +17,7 @@
 #include "src/heap/cppgc/metric-recorder.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/incremental-marking.h"
+#include "src/heap/object-stats.h"
 #include "src/heap/spaces.h"
 #include "src/logging/counters.h"
 #include "src/logging/metrics.h"
@@ -236,6 +239,7 @@ void GCTracer::ResetForTesting() {
   average_mark_compact_duration_ = 0;
   current_mark_compact_mutator_utilization_ = 1.0;
   previous_mark_compact_end_time_ = 0;
+  ResetPhaseHistograms();
   base::MutexGuard guard(&background_counter_mutex_);
   for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
     background_counter_[i].total_duration_ms = 0;
@@ -411,6 +415,10 @@ void GCTracer::Stop(GarbageCollector collector) {
 
   heap_->UpdateTotalGCTime(duration);
 
+  if (V8_UNLIKELY(FLAG_gc_phase_histograms_interval > 0)) {
+    RecordPhaseHistograms(duration);
+  }
+
   if ((current_.type == Event::SCAVENGER ||
        current_.type == Event::MINOR_MARK_COMPACTOR) &&
       FLAG_trace_gc_ignore_scavenger)
@@ -634,6 +642,7 @@ void GCTracer::PrintNVP() const {
           "nodes_died_in_new=%d "
           "nodes_copied_in_new=%d "
           "nodes_promoted=%d "
+          "flattened_string_bytes=%zu "
           "promotion_ratio=%.1f%% "
           "average_survival_ratio=%.1f%% "
           "promotion_rate=%.1f%% "
@@ -673,7 +682,8 @@ void GCTracer::PrintNVP() const {
           heap_->promoted_objects_size(),
           heap_->semi_space_copied_object_size(),
           heap_->nodes_died_in_new_space_, heap_->nodes_copied_in_new_space_,
-          heap_->nodes_promoted_, heap_->promotion_ratio_,
+          heap_->nodes_promoted_, heap_->flattened_string_bytes(),
+          heap_->promotion_ratio_,
           AverageSurvivalRatio(), heap_->promotion_rate_,
           heap_->semi_space_copied_rate_,
           NewSpaceAllocationThroughputInBytesPerMillisecond(),
@@ -823,6 +833,7 @@ void GCTracer::PrintNVP() const {
           "nodes_died_in_new=%d "
           "nodes_copied_in_new=%d "
           "nodes_promoted=%d "
+          "flattened_string_bytes=%zu "
           "promotion_ratio=%.1f%% "
           "average_survival_ratio=%.1f%% "
           "promotion_rate=%.1f%% "
@@ -915,7 +926,8 @@ void GCTracer::PrintNVP() const {
           heap_->promoted_objects_size(),
           heap_->semi_space_copied_object_size(),
           heap_->nodes_died_in_new_space_, heap_->nodes_copied_in_new_space_,
-          heap_->nodes_promoted_, heap_->promotion_ratio_,
+          heap_->nodes_promoted_, heap_->flattened_string_bytes(),
+          heap_->promotion_ratio_,
           AverageSurvivalRatio(), heap_->promotion_rate_,
           heap_->semi_space_copied_rate_,
           NewSpaceAllocationThroughputInBytesPerMillisecond(),
@@ -1300,6 +1312,14 @@ void GCTracer::RecordGCSumCounters(double atomic_pause_duration) {
                        "V8.GCMarkCompactorMarkingSummary",
                        TRACE_EVENT_SCOPE_THREAD, "duration", marking_duration,
                        "background_duration", marking_background_duration);
+  const double total_marking_duration =
+      marking_duration + marking_background_duration;
+  if (total_marking_duration > 0) {
+    TRACE_EVENT_INSTANT1(
+        TRACE_DISABLED_BY_DEFAULT("v8.gc"), "V8.GCMarkCompactorMarkingSpeed",
+        TRACE_EVENT_SCOPE_THREAD, "bytes_per_ms",
+        static_cast<double>(current_.end_object_size) / total_marking_duration);
+  }
 }
 
 void GCTracer::NotifyGCCompleted() {
@@ -1420,5 +1440,100 @@ void GCTracer::ReportIncrementalMarkingStepToRecorder() {
   recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
 }
 
+void GCTracer::ReportObjectStatsSampleToRecorder(
+    const SampledObjectStats& stats) {
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      heap_->isolate()->metrics_recorder();
+  DCHECK_NOT_NULL(recorder);
+  if (!recorder->HasEmbedderRecorder()) return;
+  ::v8::metrics::GarbageCollectionObjectStatsSample event;
+  event.sampling_rate = stats.sampling_rate();
+  for (int type = 0; type < SampledObjectStats::kNumberOfTypes; type++) {
+    if (stats.count(type) == 0) continue;
+    ::v8::metrics::ObjectStatsSampleEntry entry;
+    entry.instance_type = SampledObjectStats::InstanceTypeName(type);
+    entry.sampled_objects = stats.count(type);
+    entry.sampled_bytes = stats.size(type);
+    event.entries.push_back(entry);
+  }
+  // This runs in the middle of the atomic pause, so the embedder is notified
+  // from a task.
+  recorder->DelayMainThreadEvent(event, GetContextId(heap_->isolate()));
+}
+
+// static
+int GCTracer::PhaseHistogramBucket(double duration_ms) {
+  const uint64_t duration_us = static_cast<uint64_t>(
+      duration_ms * base::Time::kMicrosecondsPerMillisecond);
+  if (duration_us <= 1) return 0;
+  const int bucket = 63 - base::bits::CountLeadingZeros64(duration_us);
+  return std::min(bucket, kPhaseHistogramBuckets - 1);
+}
+
+void GCTracer::RecordPhaseHistograms(double duration) {
+  if (!phase_histograms_) {
+    phase_histograms_.reset(new PhaseHistogram[Scope::NUMBER_OF_SCOPES]());
+  }
+  for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
+    const double scope_duration = current_.scopes[i];
+    if (scope_duration <= 0) continue;
+    PhaseHistogram& histogram = phase_histograms_[i];
+    histogram.sample_count++;
+    histogram.total_duration_ms += scope_duration;
+    histogram.buckets[PhaseHistogramBucket(scope_duration)]++;
+    if (i >= Scope::FIRST_BACKGROUND_SCOPE) {
+      phase_histograms_background_ms_ += scope_duration;
+    }
+  }
+  phase_histograms_main_thread_ms_ += duration;
+  if (++phase_histograms_gc_count_ < FLAG_gc_phase_histograms_interval) {
+    return;
+  }
+  ReportPhaseHistogramsToRecorder();
+  ResetPhaseHistograms();
+}
+
+void GCTracer::ReportPhaseHistogramsToRecorder() {
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      heap_->isolate()->metrics_recorder();
+  DCHECK_NOT_NULL(recorder);
+  if (!recorder->HasEmbedderRecorder()) return;
+  auto ToMicroseconds = [](double ms) {
+    return static_cast<int64_t>(ms * base::Time::kMicrosecondsPerMillisecond);
+  };
+  ::v8::metrics::GarbageCollectionPhaseHistograms event;
+  event.gc_count = phase_histograms_gc_count_;
+  event.main_thread_busy_time_in_us =
+      ToMicroseconds(phase_histograms_main_thread_ms_);
+  event.background_threads_busy_time_in_us =
+      ToMicroseconds(phase_histograms_background_ms_);
+  for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
+    const PhaseHistogram& histogram = phase_histograms_[i];
+    if (histogram.sample_count == 0) continue;
+    ::v8::metrics::GarbageCollectionPhaseHistogram phase;
+    phase.scope = Scope::Name(static_cast<Scope::ScopeId>(i));
+    phase.background = i >= Scope::FIRST_BACKGROUND_SCOPE;
+    phase.sample_count = histogram.sample_count;
+    phase.total_duration_in_us = ToMicroseconds(histogram.total_duration_ms);
+    phase.buckets.assign(histogram.buckets,
+                         histogram.buckets + kPhaseHistogramBuckets);
+    event.phases.push_back(std::move(phase));
+  }
+  // The tracer is stopped inside the garbage collection, so the embedder is
+  // notified from a task.
+  recorder->DelayMainThreadEvent(event, GetContextId(heap_->isolate()));
+}
+
+void GCTracer::ResetPhaseHistograms() {
+  if (phase_histograms_) {
+    std::fill(phase_histograms_.get(),
+              phase_histograms_.get() + Scope::NUMBER_OF_SCOPES,
+              PhaseHistogram());
+  }
+  phase_histograms_gc_count_ = 0;
+  phase_histograms_main_thread_ms_ = 0.0;
+  phase_histograms_background_ms_ = 0.0;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -19,6 +19,8 @@
 namespace v8 {
 namespace internal {
 
+class SampledObjectStats;
+
 using BytesAndDuration = std::pair<uint64_t, double>;
 
 inline BytesAndDuration MakeBytesAndDuration(uint64_t bytes, double duration) {
@@ -216,6 +218,15 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void NotifyGCCompleted();
 
+  // Reports the heap composition sampled while marking to the embedder's
+  // metrics recorder.
+  void ReportObjectStatsSampleToRecorder(const SampledObjectStats& stats);
+
+  // Number of buckets of the per-scope duration histograms collected with
+  // --gc-phase-histograms-interval.
+  static constexpr int kPhaseHistogramBuckets = 24;
+  static int PhaseHistogramBucket(double duration_ms);
+
   void NotifyYoungGenerationHandling(
       YoungGenerationHandling young_generation_handling);
 
@@ -366,11 +377,18 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, RecordGCSumHistograms);
   FRIEND_TEST(GCTracerTest, RecordMarkCompactHistograms);
   FRIEND_TEST(GCTracerTest, RecordScavengerHistograms);
+  FRIEND_TEST(GCTracerTest, PhaseHistograms);
 
   struct BackgroundCounter {
     double total_duration_ms;
   };
 
+  struct PhaseHistogram {
+    int64_t sample_count;
+    double total_duration_ms;
+    int64_t buckets[kPhaseHistogramBuckets];
+  };
+
   // Returns the average speed of the events in the buffer.
   // If the buffer is empty, the result is 0.
   // Otherwise, the result is between 1 byte/ms and 1 GB/ms.
@@ -419,6 +437,12 @@ class V8_EXPORT_PRIVATE GCTracer {
   void ReportFullCycleToRecorder();
   void ReportIncrementalMarkingStepToRecorder();
 
+  // Adds the scope durations of the current event to the phase histograms
+  // and reports them once enough garbage collections have been batched.
+  void RecordPhaseHistograms(double duration);
+  void ReportPhaseHistogramsToRecorder();
+  void ResetPhaseHistograms();
+
   // Pointer to the heap that owns this tracer.
   Heap* heap_;
 
@@ -488,6 +512,12 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   base::Mutex background_counter_mutex_;
   BackgroundCounter background_counter_[Scope::NUMBER_OF_SCOPES];
+
+  // Only allocated with --gc-phase-histograms-interval.
+  std::unique_ptr<PhaseHistogram[]> phase_histograms_;
+  int phase_histograms_gc_count_ = 0;
+  double phase_histograms_main_thread_ms_ = 0.0;
+  double phase_histograms_background_ms_ = 0.0;
 };
 
 }  // namespace internal
@@ -169,6 +169,22 @@ size_t MemoryController<Trait>::CalculateAllocationLimit(
   return result;
 }
 
+// static
+size_t NewSpaceController::TargetCapacity(
+    double allocation_throughput_in_bytes_per_ms, double target_interval_in_ms,
+    size_t survived_bytes, size_t min_capacity, size_t max_capacity) {
+  DCHECK_LE(min_capacity, max_capacity);
+  // Survivors stay in new space and occupy part of the capacity, the rest has
+  // to fit the allocations until the next GC.
+  const double target =
+      static_cast<double>(survived_bytes) +
+      allocation_throughput_in_bytes_per_ms * target_interval_in_ms;
+  if (target >= static_cast<double>(max_capacity)) return max_capacity;
+  const size_t capacity =
+      ::RoundUp(static_cast<size_t>(target), Page::kPageSize);
+  return std::max(min_capacity, std::min(capacity, max_capacity));
+}
+
 template class V8_EXPORT_PRIVATE MemoryController<V8HeapTrait>;
 template class V8_EXPORT_PRIVATE MemoryController<GlobalMemoryTrait>;
 
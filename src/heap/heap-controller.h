@@ -56,6 +56,16 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
   FRIEND_TEST(MemoryControllerTest, MaxHeapGrowingFactor);
 };
 
+// Computes the new space capacity for which young generation GCs happen
+// roughly every |target_interval_in_ms| at the given allocation throughput.
+class V8_EXPORT_PRIVATE NewSpaceController : public AllStatic {
+ public:
+  static size_t TargetCapacity(double allocation_throughput_in_bytes_per_ms,
+                               double target_interval_in_ms,
+                               size_t survived_bytes, size_t min_capacity,
+                               size_t max_capacity);
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -88,8 +88,13 @@ BytecodeFlushMode Heap::GetBytecodeFlushMode(Isolate* isolate) {
   if (isolate->disable_bytecode_flushing()) {
     return BytecodeFlushMode::kDoNotFlushBytecode;
   }
-  if (FLAG_stress_flush_bytecode) {
+  if (FLAG_stress_flush_bytecode ||
+      (FLAG_flush_bytecode &&
+       isolate->heap()->ShouldFlushBytecodeForMemoryBudget())) {
     return BytecodeFlushMode::kStressFlushBytecode;
+  } else if (FLAG_flush_bytecode && FLAG_flush_bytecode_on_memory_pressure &&
+             isolate->heap()->ShouldReduceMemory()) {
+    return BytecodeFlushMode::kAggressiveFlushBytecode;
   } else if (FLAG_flush_bytecode) {
     return BytecodeFlushMode::kFlushBytecode;
   }
@@ -514,7 +519,9 @@ bool Heap::ShouldBePromoted(Address old_address) {
 
 void Heap::CopyBlock(Address dst, Address src, int byte_size) {
   DCHECK(IsAligned(byte_size, kTaggedSize));
-  CopyTagged(dst, src, static_cast<size_t>(byte_size / kTaggedSize));
+  DCHECK(IsAligned(dst, kTaggedSize));
+  DCHECK(IsAligned(src, kTaggedSize));
+  CopyBlockBytes(dst, src, static_cast<size_t>(byte_size));
 }
 
 template <Heap::FindMementoMode mode>
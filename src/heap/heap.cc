@@ -32,6 +32,7 @@
 #include "src/execution/v8threads.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/global-handles.h"
+#include "src/heap/array-buffer-pool.h"
 #include "src/heap/array-buffer-sweeper.h"
 #include "src/heap/barrier.h"
 #include "src/heap/base/stack.h"
@@ -58,6 +59,7 @@
 #include "src/heap/mark-compact.h"
 #include "src/heap/marking-barrier-inl.h"
 #include "src/heap/marking-barrier.h"
+#include "src/heap/memory-budget.h"
 #include "src/heap/memory-chunk-inl.h"
 #include "src/heap/memory-chunk-layout.h"
 #include "src/heap/memory-measurement.h"
@@ -88,6 +90,7 @@
 #include "src/objects/shared-function-info.h"
 #include "src/objects/slots-atomic-inl.h"
 #include "src/objects/slots-inl.h"
+#include "src/regexp/regexp-stack.h"
 #include "src/regexp/regexp.h"
 #include "src/snapshot/embedded/embedded-data.h"
 #include "src/snapshot/serializer-deserializer.h"
@@ -98,11 +101,16 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/accounting-allocator.h"
 
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
 #include "src/heap/conservative-stack-visitor.h"
 #endif
 
+#if V8_ENABLE_WEBASSEMBLY
+#include "src/wasm/wasm-engine.h"
+#endif  // V8_ENABLE_WEBASSEMBLY
+
 #include "src/base/platform/wrappers.h"
 // Has to be the last include (doesn't have include guards):
 #include "src/objects/object-macros.h"
@@ -643,6 +651,22 @@ void Heap::PrintFreeListsStats() {
             << (cat == old_space()->free_list()->last_category() ? "\n" : ", ");
   }
   PrintIsolate(isolate_, "%s", out_str.str().c_str());
+
+  // Print how allocations were served by each FreeListCategory since the
+  // isolate was created.
+  FreeList* free_list = old_space()->free_list();
+  PrintIsolate(isolate_,
+               "FreeLists allocations (overallocated: %.1f KB): "
+               "[category: allocations]\n",
+               static_cast<double>(free_list->overallocated_bytes()) / KB);
+  std::ostringstream alloc_str;
+  for (int cat = kFirstCategory; cat <= free_list->last_category(); cat++) {
+    alloc_str << "[" << cat << ": "
+              << free_list->allocations_from_category(
+                     static_cast<FreeListCategoryType>(cat))
+              << "]" << (cat == free_list->last_category() ? "\n" : ", ");
+  }
+  PrintIsolate(isolate_, "%s", alloc_str.str().c_str());
 }
 
 void Heap::DumpJSONHeapStatistics(std::stringstream& stream) {
@@ -915,6 +939,8 @@ void Heap::GarbageCollectionPrologue() {
   nodes_died_in_new_space_ = 0;
   nodes_copied_in_new_space_ = 0;
   nodes_promoted_ = 0;
+  flattened_string_bytes_ = flattened_string_bytes_since_gc_;
+  flattened_string_bytes_since_gc_ = 0;
 
   UpdateMaximumCommitted();
 
@@ -1364,7 +1390,21 @@ void Heap::GarbageCollectionEpilogue() {
   ReportStatisticsAfterGC();
 #endif  // DEBUG
 
+  if (array_buffer_pool_) {
+    if (ShouldReduceMemory()) array_buffer_pool_->Flush();
+    if (FLAG_trace_array_buffer_pool) {
+      ArrayBufferPool::Stats stats = array_buffer_pool_->GetStats();
+      isolate()->PrintWithTimestamp(
+          "Array buffer pool: hits=%zu misses=%zu cached=%zuKB "
+          "zero_fill_avoided=%zuKB\n",
+          stats.hits, stats.misses, stats.cached_bytes / KB,
+          stats.zero_fill_avoided_bytes / KB);
+    }
+  }
+
   last_gc_time_ = MonotonicallyIncreasingTimeInMs();
+
+  UpdateMemoryBudget();
 }
 
 class V8_NODISCARD GCCallbacksScope {
@@ -1545,6 +1585,8 @@ void Heap::CollectAllAvailableGarbage(GarbageCollectionReason gc_reason) {
   // The optimizing compiler may be unnecessarily holding on to memory.
   isolate()->AbortConcurrentOptimization(BlockingBehavior::kDontBlock);
   isolate()->ClearSerializerData();
+  isolate()->regexp_stack()->ReleaseRetainedMemory();
+  isolate()->allocator()->ReleasePooledSegments();
   set_current_gc_flags(
       kReduceMemoryFootprintMask |
       (gc_reason == GarbageCollectionReason::kLowMemoryNotification ? kForcedGC
@@ -2318,6 +2360,10 @@ void Heap::RecomputeLimits(GarbageCollector collector) {
       tracer()->CurrentOldGenerationAllocationThroughputInBytesPerMillisecond();
   double v8_growing_factor = MemoryController<V8HeapTrait>::GrowingFactor(
       this, max_old_generation_size(), v8_gc_speed, v8_mutator_speed);
+  if (memory_budget_) {
+    v8_growing_factor = memory_budget_->ScaleGrowingFactor(
+        v8_growing_factor, V8HeapTrait::kMinGrowingFactor);
+  }
   double global_growing_factor = 0;
   if (UseGlobalMemoryScheduling()) {
     DCHECK_NOT_NULL(local_embedder_heap_tracer());
@@ -2484,9 +2530,28 @@ void Heap::MarkCompactPrologue() {
   FlushNumberStringCache();
 }
 
+size_t Heap::NewSpaceTargetCapacity() {
+  DCHECK_LT(0, young_generation_target_gc_interval_ms_);
+  const double throughput =
+      tracer()->NewSpaceAllocationThroughputInBytesPerMillisecond(
+          GCTracer::kThroughputTimeFrameMs);
+  // Without throughput information the current capacity is as good as any.
+  if (throughput == 0) return new_space_->TotalCapacity();
+  return NewSpaceController::TargetCapacity(
+      throughput, static_cast<double>(young_generation_target_gc_interval_ms_),
+      survived_last_scavenge_, new_space_->InitialTotalCapacity(),
+      new_space_->MaximumCapacity());
+}
+
 void Heap::CheckNewSpaceExpansionCriteria() {
-  if (new_space_->TotalCapacity() < new_space_->MaximumCapacity() &&
-      survived_since_last_expansion_ > new_space_->TotalCapacity()) {
+  if (young_generation_target_gc_interval_ms_ > 0) {
+    if (new_space_->TotalCapacity() < new_space_->MaximumCapacity() &&
+        NewSpaceTargetCapacity() > new_space_->TotalCapacity()) {
+      new_space_->Grow();
+      survived_since_last_expansion_ = 0;
+    }
+  } else if (new_space_->TotalCapacity() < new_space_->MaximumCapacity() &&
+             survived_since_last_expansion_ > new_space_->TotalCapacity()) {
     // Grow the size of new space if there is room to grow, and enough data
     // has survived scavenge since the last expansion.
     new_space_->Grow();
@@ -3628,6 +3693,17 @@ void Heap::ReduceNewSpaceSize() {
 
   if (FLAG_predictable) return;
 
+  if (young_generation_target_gc_interval_ms_ > 0 && !ShouldReduceMemory()) {
+    // Only shrink when the target is well below the current capacity to avoid
+    // oscillating between growing and shrinking.
+    if (NewSpaceTargetCapacity() < new_space_->TotalCapacity() / 2) {
+      new_space_->Shrink();
+      new_lo_space_->SetCapacity(new_space_->Capacity());
+      UncommitFromSpace();
+    }
+    return;
+  }
+
   if (ShouldReduceMemory() ||
       ((allocation_throughput != 0) &&
        (allocation_throughput < kLowAllocationThroughput))) {
@@ -3637,6 +3713,46 @@ void Heap::ReduceNewSpaceSize() {
   }
 }
 
+void Heap::UpdateMemoryBudget() {
+  if (!memory_budget_) return;
+  const size_t committed = CommittedMemory();
+  memory_budget_->Update(memory_budget_contribution_, committed);
+  memory_budget_contribution_ = committed;
+
+  const MemoryBudget::PressureLevel level =
+      memory_budget_->CurrentPressureLevel();
+  // Only act when the pressure escalates, otherwise every GC above the soft
+  // limit would trigger the next one.
+  if (static_cast<int>(level) <= memory_budget_handled_level_) {
+    memory_budget_handled_level_ = static_cast<int>(level);
+    return;
+  }
+  memory_budget_handled_level_ = static_cast<int>(level);
+  if (FLAG_trace_gc_verbose) {
+    isolate()->PrintWithTimestamp(
+        "Memory budget pressure level %d (used %zu KB, soft limit %zu KB, "
+        "hard limit %zu KB)\n",
+        memory_budget_handled_level_, memory_budget_->used_in_bytes() / KB,
+        memory_budget_->soft_limit_in_bytes() / KB,
+        memory_budget_->hard_limit_in_bytes() / KB);
+  }
+  if (level == MemoryBudget::PressureLevel::kEvictCompilationCache) {
+    isolate()->compilation_cache()->Clear();
+  }
+  // Bytecode flushing is picked up by the next full GC through
+  // GetBytecodeFlushMode().
+  MemoryPressureNotification(
+      level >= MemoryBudget::PressureLevel::kFlushBytecode
+          ? MemoryPressureLevel::kCritical
+          : MemoryPressureLevel::kModerate,
+      false);
+}
+
+bool Heap::ShouldFlushBytecodeForMemoryBudget() const {
+  return memory_budget_handled_level_ >=
+         static_cast<int>(MemoryBudget::PressureLevel::kFlushBytecode);
+}
+
 size_t Heap::NewSpaceSize() { return new_space() ? new_space()->Size() : 0; }
 
 size_t Heap::NewSpaceCapacity() {
@@ -3821,6 +3937,7 @@ bool Heap::PerformIdleTimeAction(GCIdleTimeAction action,
   bool result = false;
   switch (action) {
     case GCIdleTimeAction::kDone:
+      FreeEmptyRememberedSetBuckets(deadline_in_ms);
       result = true;
       break;
     case GCIdleTimeAction::kIncrementalStep: {
@@ -3837,6 +3954,20 @@ bool Heap::PerformIdleTimeAction(GCIdleTimeAction action,
   return result;
 }
 
+void Heap::FreeEmptyRememberedSetBuckets(double deadline_in_ms) {
+  // The sweeper removes old-to-new slots concurrently.
+  if (mark_compact_collector()->sweeping_in_progress()) return;
+  if (MonotonicallyIncreasingTimeInMs() >= deadline_in_ms) return;
+  // Background threads may record slots while buckets are released.
+  SafepointScope safepoint_scope(this);
+  OldGenerationMemoryChunkIterator it(this);
+  MemoryChunk* chunk;
+  while ((chunk = it.next()) != nullptr) {
+    RememberedSet<OLD_TO_NEW>::FreeEmptyBuckets(chunk);
+    if (MonotonicallyIncreasingTimeInMs() >= deadline_in_ms) break;
+  }
+}
+
 void Heap::IdleNotificationEpilogue(GCIdleTimeAction action,
                                     GCIdleTimeHeapState heap_state,
                                     double start_ms, double deadline_in_ms) {
@@ -3909,6 +4040,52 @@ bool Heap::IdleNotification(double deadline_in_seconds) {
   return result;
 }
 
+void Heap::NotifyLatencyCriticalWorkStarted() {
+  latency_critical_work_depth_++;
+  // Latency-critical work ends any idle window the embedder reported before.
+  idle_window_deadline_in_ms_ = 0.0;
+}
+
+void Heap::NotifyLatencyCriticalWorkFinished() {
+  DCHECK_GT(latency_critical_work_depth_, 0);
+  if (--latency_critical_work_depth_ > 0) return;
+  // Pick up the work that was deferred while the embedder was busy.
+  if (!incremental_marking()->IsStopped()) {
+    incremental_marking()->incremental_marking_job()->ScheduleTask(this);
+  }
+  ScheduleScavengeTaskIfNeeded();
+}
+
+void Heap::NotifyExpectedIdleWindow(double deadline_in_seconds) {
+  CHECK(HasBeenSetUp());
+  if (IsLatencyCriticalWorkInProgress()) return;
+  idle_window_deadline_in_ms_ =
+      deadline_in_seconds *
+      static_cast<double>(base::Time::kMillisecondsPerSecond);
+  if (RemainingIdleWindowInMs() <= 0) return;
+
+  // Finalizing sweeping is cheap once the sweeper tasks are done and saves
+  // the next GC or allocation from doing it.
+  if (mark_compact_collector()->sweeping_in_progress() &&
+      !mark_compact_collector()->sweeper()->AreSweeperTasksRunning()) {
+    mark_compact_collector()->EnsureSweepingCompleted();
+  }
+  if (!incremental_marking()->IsStopped() ||
+      IncrementalMarkingLimitReached() != IncrementalMarkingLimit::kNoLimit) {
+    incremental_marking()->incremental_marking_job()->ScheduleTask(this);
+  }
+  ScheduleScavengeTaskIfNeeded();
+}
+
+double Heap::RemainingIdleWindowInMs() {
+  if (idle_window_deadline_in_ms_ == 0.0) return 0.0;
+  double remaining =
+      idle_window_deadline_in_ms_ - MonotonicallyIncreasingTimeInMs();
+  if (remaining > 0) return remaining;
+  idle_window_deadline_in_ms_ = 0.0;
+  return 0.0;
+}
+
 bool Heap::RecentIdleNotificationHappened() {
   return (last_idle_notification_time_ +
           GCIdleTimeHandler::kMaxScheduledIdleTime) >
@@ -3945,6 +4122,13 @@ void Heap::CheckMemoryPressure() {
   if (memory_pressure_level == MemoryPressureLevel::kCritical) {
     TRACE_EVENT0("devtools.timeline,v8", "V8.CheckMemoryPressure");
     CollectGarbageOnMemoryPressure();
+    isolate()->regexp_stack()->ReleaseRetainedMemory();
+    isolate()->allocator()->ReleasePooledSegments();
+#if V8_ENABLE_WEBASSEMBLY
+    // Replaced wasm code (e.g. Liftoff code after tier-up) is only released
+    // by a wasm code GC; do not wait for its usual threshold.
+    isolate()->wasm_engine()->FreeDeadCodeOnMemoryPressure();
+#endif  // V8_ENABLE_WEBASSEMBLY
   } else if (memory_pressure_level == MemoryPressureLevel::kModerate) {
     if (FLAG_incremental_marking && incremental_marking()->IsStopped()) {
       TRACE_EVENT0("devtools.timeline,v8", "V8.CheckMemoryPressure");
@@ -4889,6 +5073,17 @@ void Heap::ConfigureHeap(const v8::ResourceConstraints& constraints) {
     initial_semispace_size_ = max_semi_space_size_;
   }
 
+  if (constraints.shared_memory_budget()) {
+    memory_budget_ = constraints.shared_memory_budget()->budget_;
+  }
+
+  young_generation_target_gc_interval_ms_ =
+      constraints.young_generation_target_gc_interval_in_ms();
+  if (FLAG_young_generation_target_gc_interval > 0) {
+    young_generation_target_gc_interval_ms_ =
+        FLAG_young_generation_target_gc_interval;
+  }
+
   // Initialize initial_old_space_size_.
   {
     initial_old_generation_size_ = kMaxInitialOldGenerationSize;
@@ -5496,6 +5691,12 @@ void Heap::SetUpSpaces() {
   minor_mark_compact_collector_ = nullptr;
 #endif  // ENABLE_MINOR_MC
   array_buffer_sweeper_.reset(new ArrayBufferSweeper(this));
+  if (FLAG_array_buffer_pool) {
+    array_buffer_pool_ = std::make_shared<ArrayBufferPool>(
+        isolate()->array_buffer_allocator(),
+        isolate()->array_buffer_allocator_shared(),
+        static_cast<size_t>(FLAG_array_buffer_pool_max_cached_kb) * KB);
+  }
   gc_idle_time_handler_.reset(new GCIdleTimeHandler());
   memory_measurement_.reset(new MemoryMeasurement(isolate()));
   memory_reducer_.reset(new MemoryReducer(this));
@@ -5729,6 +5930,12 @@ void Heap::StartTearDown() {
 void Heap::TearDown() {
   DCHECK_EQ(gc_state(), TEAR_DOWN);
 
+  if (memory_budget_) {
+    memory_budget_->Update(memory_budget_contribution_, 0);
+    memory_budget_contribution_ = 0;
+    memory_budget_.reset();
+  }
+
   if (FLAG_concurrent_marking || FLAG_parallel_marking)
     concurrent_marking_->Pause();
 
@@ -5791,6 +5998,8 @@ void Heap::TearDown() {
 
   scavenger_collector_.reset();
   array_buffer_sweeper_.reset();
+  // Backing stores that are still alive keep the pool alive, too.
+  array_buffer_pool_.reset();
   incremental_marking_.reset();
   concurrent_marking_.reset();
 
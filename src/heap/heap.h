@@ -64,6 +64,7 @@ class NativeContext;
 using v8::MemoryPressureLevel;
 
 class ArrayBufferCollector;
+class ArrayBufferPool;
 class ArrayBufferSweeper;
 class BasicMemoryChunk;
 class CodeLargeObjectSpace;
@@ -88,6 +89,7 @@ class LocalHeap;
 class MarkingBarrier;
 class MemoryAllocator;
 class MemoryChunk;
+class MemoryBudget;
 class MemoryMeasurement;
 class MemoryReducer;
 class MinorMarkCompactCollector;
@@ -712,6 +714,21 @@ class Heap {
   bool IdleNotification(double deadline_in_seconds);
   bool IdleNotification(int idle_time_in_ms);
 
+  // Implement the corresponding V8 API functions. While latency-critical work
+  // is in progress, GC tasks are deferred. An expected idle window makes
+  // GC tasks run early and lets them use the window for their work.
+  void NotifyLatencyCriticalWorkStarted();
+  void NotifyLatencyCriticalWorkFinished();
+  void NotifyExpectedIdleWindow(double deadline_in_seconds);
+
+  bool IsLatencyCriticalWorkInProgress() const {
+    return latency_critical_work_depth_ > 0;
+  }
+
+  // Returns the time left in the idle window reported through
+  // NotifyExpectedIdleWindow(), or 0 outside of such a window.
+  double RemainingIdleWindowInMs();
+
   V8_EXPORT_PRIVATE void MemoryPressureNotification(MemoryPressureLevel level,
                                                     bool is_isolate_locked);
   void CheckMemoryPressure();
@@ -746,6 +763,10 @@ class Heap {
   // Check new space expansion criteria and expand semispaces if it was hit.
   void CheckNewSpaceExpansionCriteria();
 
+  // Returns the new space capacity that achieves the configured target
+  // interval between young generation GCs.
+  size_t NewSpaceTargetCapacity();
+
   void VisitExternalResources(v8::ExternalResourceVisitor* visitor);
 
   // An object should be promoted if the object has survived a
@@ -915,6 +936,12 @@ class Heap {
     return array_buffer_sweeper_.get();
   }
 
+  // Returns the pool for small array buffer backing stores, or nullptr if
+  // --array-buffer-pool is off.
+  const std::shared_ptr<ArrayBufferPool>& array_buffer_pool() {
+    return array_buffer_pool_;
+  }
+
   const base::AddressRegion& code_region();
 
   CodeRange* code_range() { return code_range_.get(); }
@@ -1391,6 +1418,13 @@ class Heap {
     return semi_space_copied_object_size_;
   }
 
+  // Bytes copied by flattening cons strings in the mutator phase before the
+  // current (or last) GC.
+  inline void IncrementFlattenedStringBytes(size_t bytes) {
+    flattened_string_bytes_since_gc_ += bytes;
+  }
+  inline size_t flattened_string_bytes() { return flattened_string_bytes_; }
+
   inline size_t SurvivedYoungObjectSize() {
     return promoted_objects_size_ + semi_space_copied_object_size_;
   }
@@ -1848,6 +1882,13 @@ class Heap {
 
   void ReduceNewSpaceSize();
 
+  // Reports the committed memory of this heap to the shared memory budget and
+  // reduces memory if the budget is under pressure.
+  void UpdateMemoryBudget();
+
+  // Returns true if the shared memory budget asks for bytecode flushing.
+  bool ShouldFlushBytecodeForMemoryBudget() const;
+
   GCIdleTimeHeapState ComputeHeapState();
 
   bool PerformIdleTimeAction(GCIdleTimeAction action,
@@ -1858,6 +1899,10 @@ class Heap {
                                 GCIdleTimeHeapState heap_state, double start_ms,
                                 double deadline_in_ms);
 
+  // Releases old-to-new remembered set buckets that became empty since the
+  // last scavenge, stopping early when the deadline is reached.
+  void FreeEmptyRememberedSetBuckets(double deadline_in_ms);
+
   int NextAllocationTimeout(int current_timeout = 0);
   inline void UpdateAllocationsHash(HeapObject object);
   inline void UpdateAllocationsHash(uint32_t value);
@@ -2173,6 +2218,10 @@ class Heap {
   // ... and since the last scavenge.
   size_t survived_last_scavenge_ = 0;
 
+  // Desired interval between young generation GCs. Zero if new space should
+  // be sized based on survival since the last expansion.
+  size_t young_generation_target_gc_interval_ms_ = 0;
+
   // This is not the depth of nested AlwaysAllocateScope's but rather a single
   // count, as scopes can be acquired from multiple tasks (read: threads).
   std::atomic<size_t> always_allocate_scope_count_{0};
@@ -2303,6 +2352,8 @@ class Heap {
   int nodes_died_in_new_space_ = 0;
   int nodes_copied_in_new_space_ = 0;
   int nodes_promoted_ = 0;
+  size_t flattened_string_bytes_since_gc_ = 0;
+  size_t flattened_string_bytes_ = 0;
 
   // This is the pretenuring trigger for allocation sites that are in maybe
   // tenure state. When we switched to the maximum new space size we deoptimize
@@ -2324,6 +2375,7 @@ class Heap {
   MinorMarkCompactCollector* minor_mark_compact_collector_ = nullptr;
   std::unique_ptr<ScavengerCollector> scavenger_collector_;
   std::unique_ptr<ArrayBufferSweeper> array_buffer_sweeper_;
+  std::shared_ptr<ArrayBufferPool> array_buffer_pool_;
 
   std::unique_ptr<MemoryAllocator> memory_allocator_;
   std::unique_ptr<IncrementalMarking> incremental_marking_;
@@ -2331,6 +2383,14 @@ class Heap {
   std::unique_ptr<GCIdleTimeHandler> gc_idle_time_handler_;
   std::unique_ptr<MemoryMeasurement> memory_measurement_;
   std::unique_ptr<MemoryReducer> memory_reducer_;
+
+  // Memory budget shared with other isolates, if any, and the committed
+  // memory last reported to it by this heap.
+  std::shared_ptr<MemoryBudget> memory_budget_;
+  size_t memory_budget_contribution_ = 0;
+  // Highest budget pressure level that has been acted upon. Reset once the
+  // pressure drops again.
+  int memory_budget_handled_level_ = 0;
   std::unique_ptr<ObjectStats> live_object_stats_;
   std::unique_ptr<ObjectStats> dead_object_stats_;
   std::unique_ptr<ScavengeJob> scavenge_job_;
@@ -2409,6 +2469,9 @@ class Heap {
 
   bool is_current_gc_forced_ = false;
 
+  int latency_critical_work_depth_ = 0;
+  double idle_window_deadline_in_ms_ = 0.0;
+
   ExternalStringTable external_string_table_;
 
   base::Mutex relocation_mutex_;
@@ -4,6 +4,8 @@
 
 #include "src/heap/incremental-marking-job.h"
 
+#include <algorithm>
+
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/time.h"
 #include "src/execution/isolate.h"
@@ -82,8 +84,12 @@ void IncrementalMarkingJob::ScheduleTask(Heap* heap, TaskType task_type) {
 
 StepResult IncrementalMarkingJob::Task::Step(Heap* heap) {
   const int kIncrementalMarkingDelayMs = 1;
+  // Inside an idle window reported by the embedder the step may use the
+  // remaining window.
   double deadline =
-      heap->MonotonicallyIncreasingTimeInMs() + kIncrementalMarkingDelayMs;
+      heap->MonotonicallyIncreasingTimeInMs() +
+      std::max<double>(kIncrementalMarkingDelayMs,
+                       heap->RemainingIdleWindowInMs());
   StepResult result = heap->incremental_marking()->AdvanceWithDeadline(
       deadline, i::IncrementalMarking::NO_GC_VIA_STACK_GUARD,
       i::StepOrigin::kTask);
@@ -104,6 +110,12 @@ void IncrementalMarkingJob::Task::RunInternal() {
         heap->MonotonicallyIncreasingTimeInMs() - job_->scheduled_time_);
     job_->scheduled_time_ = 0.0;
   }
+  if (heap->IsLatencyCriticalWorkInProgress()) {
+    // Heap::NotifyLatencyCriticalWorkFinished() reschedules the job.
+    base::MutexGuard guard(&job_->mutex_);
+    job_->SetTaskPending(task_type_, false);
+    return;
+  }
   IncrementalMarking* incremental_marking = heap->incremental_marking();
   if (incremental_marking->IsStopped()) {
     if (heap->IncrementalMarkingLimitReached() !=
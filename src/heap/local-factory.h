@@ -68,6 +68,10 @@ class V8_EXPORT_PRIVATE LocalFactory : public FactoryBase<LocalFactory> {
   }
   inline bool CanAllocateInReadOnlySpace() { return false; }
   inline bool EmptyStringRootIsInitialized() { return true; }
+  // Background threads cannot allocate in the shared heap.
+  inline AllocationType AllocationTypeForInternalizedString(int size) {
+    return AllocationType::kOld;
+  }
   // ------
 
   void AddToScriptList(Handle<Script> shared);
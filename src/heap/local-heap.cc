@@ -45,6 +45,7 @@ LocalHeap::LocalHeap(Heap* heap, ThreadKind kind,
                      std::unique_ptr<PersistentHandles> persistent_handles)
     : heap_(heap),
       is_main_thread_(kind == ThreadKind::kMain),
+      thread_name_(kind == ThreadKind::kMain ? "main" : "background"),
       state_(kParked),
       allocation_failed_(false),
       main_thread_parked_(false),
@@ -76,7 +77,13 @@ LocalHeap::~LocalHeap() {
   EnsureParkedBeforeDestruction();
 
   heap_->safepoint()->RemoveLocalHeap(this, [this] {
-    old_space_allocator_.FreeLinearAllocationArea();
+    if (is_main_thread()) {
+      old_space_allocator_.FreeLinearAllocationArea();
+    } else {
+      // Short-lived background heaps, e.g. of compile jobs, would otherwise
+      // leave their unused TLAB unavailable until the next full GC.
+      old_space_allocator_.ReturnLinearAllocationArea();
+    }
 
     if (!is_main_thread()) {
       marking_barrier_->Publish();
@@ -153,7 +160,7 @@ void LocalHeap::ParkSlowPath(ThreadState current_state) {
     CHECK_EQ(current_state, kSafepointRequested);
     CHECK(state_.compare_exchange_strong(current_state,
                                          kParkedSafepointRequested));
-    heap_->safepoint()->NotifyPark();
+    heap_->safepoint()->NotifyPark(this);
   }
 }
 
@@ -190,7 +197,7 @@ void LocalHeap::SafepointSlowPath() {
               ThreadKind::kBackground);
     ThreadState expected = kSafepointRequested;
     CHECK(state_.compare_exchange_strong(expected, kSafepoint));
-    heap_->safepoint()->WaitInSafepoint();
+    heap_->safepoint()->WaitInSafepoint(this);
     // This might be a bit surprising, GlobalSafepoint transitions the state
     // from Safepoint (--> Running) --> Parked when returning from the
     // safepoint.
@@ -132,6 +132,12 @@ class V8_EXPORT_PRIVATE LocalHeap {
 
   bool is_main_thread() const { return is_main_thread_; }
 
+  // Names the kind of work the thread does, e.g. "ConcurrentOptimization".
+  // Used to attribute time-to-safepoint to the slowest thread. Must be a
+  // string literal.
+  const char* thread_name() const { return thread_name_; }
+  void set_thread_name(const char* name) { thread_name_ = name; }
+
   // Requests GC and blocks until the collection finishes.
   bool TryPerformCollection();
 
@@ -198,6 +204,7 @@ class V8_EXPORT_PRIVATE LocalHeap {
 
   Heap* heap_;
   bool is_main_thread_;
+  const char* thread_name_;
 
   std::atomic<ThreadState> state_;
 
@@ -542,6 +542,10 @@ void MarkCompactCollector::CollectGarbage() {
   VerifyMarking();
   heap()->memory_measurement()->FinishProcessing(native_context_stats_);
   RecordObjectStats();
+  if (SampledObjectStats::IsEnabled()) {
+    heap()->tracer()->ReportObjectStatsSampleToRecorder(sampled_object_stats_);
+    sampled_object_stats_.Clear();
+  }
 
   StartSweepSpaces();
   Evacuate();
@@ -632,7 +636,7 @@ void MarkCompactCollector::DrainSweepingWorklistForSpace(
 }
 
 void MarkCompactCollector::ComputeEvacuationHeuristics(
-    size_t area_size, int* target_fragmentation_percent,
+    AllocationSpace space, size_t area_size, int* target_fragmentation_percent,
     size_t* max_evacuated_bytes) {
   // For memory reducing and optimize for memory mode we directly define both
   // constants.
@@ -676,6 +680,13 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
       *target_fragmentation_percent = kTargetFragmentationPercent;
     }
     *max_evacuated_bytes = kMaxEvacuatedBytes;
+    if (space == CODE_SPACE) {
+      // Evacuated code objects additionally require patching of all references
+      // in relocation info. Keep the latency-critical pause short and leave
+      // the bulk of code space defragmentation to memory-reducing GCs.
+      *max_evacuated_bytes = std::min(*max_evacuated_bytes,
+                                      FLAG_max_code_space_evacuation_kb * KB);
+    }
   }
 }
 
@@ -701,7 +712,8 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     //   between live bytes and capacity of this page (= area).
     // * Evacuation quota: A global quota determining how much bytes should be
     //   compacted.
-    ComputeEvacuationHeuristics(area_size, &target_fragmentation_percent,
+    ComputeEvacuationHeuristics(space->identity(), area_size,
+                                &target_fragmentation_percent,
                                 &max_evacuated_bytes);
     free_bytes_threshold = target_fragmentation_percent * (area_size / 100);
   }
@@ -904,6 +916,8 @@ void MarkCompactCollector::FinishConcurrentMarking() {
     heap()->concurrent_marking()->FlushMemoryChunkData(
         non_atomic_marking_state());
     heap()->concurrent_marking()->FlushNativeContexts(&native_context_stats_);
+    heap()->concurrent_marking()->FlushSampledObjectStats(
+        &sampled_object_stats_);
   }
 }
 
@@ -1662,11 +1676,24 @@ void MarkCompactCollector::ProcessEphemeronsUntilFixpoint() {
     PerformWrapperTracing();
 
     if (iterations >= max_iterations) {
-      // Give up fixpoint iteration and switch to linear algorithm.
+      // Give up fixpoint iteration and switch to linear algorithm. Unlike the
+      // fixpoint rounds, it runs on the main thread only: its key-to-values
+      // wakeup map and the tracking of newly discovered objects are not
+      // shared with the concurrent markers. The counters below show how often
+      // this happens.
+      isolate()->counters()->gc_ephemeron_linear_fallbacks()->Increment();
+      if (FLAG_trace_gc_verbose) {
+        PrintIsolate(isolate(),
+                     "Ephemeron fixpoint not reached after %d iterations, "
+                     "switching to linear algorithm\n",
+                     iterations);
+      }
       ProcessEphemeronsLinear();
       break;
     }
 
+    isolate()->counters()->gc_ephemeron_fixpoint_iterations()->Increment();
+
     // Move ephemerons from next_ephemerons into current_ephemerons to
     // drain them in this iteration.
     weak_objects_.current_ephemerons.Swap(weak_objects_.next_ephemerons);
@@ -1840,9 +1867,17 @@ size_t MarkCompactCollector::ProcessMarkingWorklist(size_t bytes_to_process) {
   HeapObject object;
   size_t bytes_processed = 0;
   bool is_per_context_mode = local_marking_worklists()->IsPerContextMode();
+  const bool sample_object_stats = SampledObjectStats::IsEnabled();
   Isolate* isolate = heap()->isolate();
-  while (local_marking_worklists()->Pop(&object) ||
-         local_marking_worklists()->PopOnHold(&object)) {
+  // Prefetching reorders objects across contexts, which would skew the
+  // per-context attribution.
+  MarkingPrefetchBuffer prefetch_buffer(
+      is_per_context_mode ? 0 : FLAG_marking_prefetch_distance);
+  auto pop = [this](HeapObject* object) {
+    return local_marking_worklists()->Pop(object) ||
+           local_marking_worklists()->PopOnHold(object);
+  };
+  while (prefetch_buffer.Pop(pop, &object)) {
     // Left trimming may result in grey or black filler objects on the marking
     // worklist. Ignore these objects.
     if (object.IsFreeSpaceOrFiller()) {
@@ -1877,11 +1912,14 @@ size_t MarkCompactCollector::ProcessMarkingWorklist(size_t bytes_to_process) {
       native_context_stats_.IncrementSize(local_marking_worklists()->Context(),
                                           map, object, visited_size);
     }
+    if (sample_object_stats) sampled_object_stats_.Sample(map, visited_size);
     bytes_processed += visited_size;
     if (bytes_to_process && bytes_processed >= bytes_to_process) {
       break;
     }
   }
+  prefetch_buffer.Flush(
+      [this](HeapObject object) { local_marking_worklists()->Push(object); });
   return bytes_processed;
 }
 
@@ -2260,19 +2298,24 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
   // Use the raw function data setter to avoid validity checks, since we're
   // performing the unusual task of decompiling.
   shared_info.set_function_data(uncompiled_data, kReleaseStore);
+  shared_info.set_has_flushed_bytecode(true);
   DCHECK(!shared_info.is_compiled());
 }
 
 void MarkCompactCollector::ClearOldBytecodeCandidates() {
   DCHECK(FLAG_flush_bytecode ||
          weak_objects_.bytecode_flushing_candidates.IsEmpty());
+  int flushed_functions = 0;
+  size_t flushed_bytes = 0;
   SharedFunctionInfo flushing_candidate;
   while (weak_objects_.bytecode_flushing_candidates.Pop(kMainThreadTask,
                                                         &flushing_candidate)) {
     // If the BytecodeArray is dead, flush it, which will replace the field with
     // an uncompiled data object.
-    if (!non_atomic_marking_state()->IsBlackOrGrey(
-            flushing_candidate.GetBytecodeArray(isolate()))) {
+    BytecodeArray bytecode = flushing_candidate.GetBytecodeArray(isolate());
+    if (!non_atomic_marking_state()->IsBlackOrGrey(bytecode)) {
+      flushed_functions++;
+      flushed_bytes += bytecode.Size();
       FlushBytecodeFromSFI(flushing_candidate);
     }
 
@@ -2282,6 +2325,21 @@ void MarkCompactCollector::ClearOldBytecodeCandidates() {
         flushing_candidate.RawField(SharedFunctionInfo::kFunctionDataOffset);
     RecordSlot(flushing_candidate, slot, HeapObject::cast(*slot));
   }
+
+  if (flushed_functions == 0) return;
+  isolate()->counters()->bytecode_flushed_functions()->Increment(
+      flushed_functions);
+  isolate()->counters()->bytecode_flushed_bytes()->Increment(
+      static_cast<int>(flushed_bytes));
+  if (FLAG_trace_flush_bytecode) {
+    PrintIsolate(isolate(),
+                 "Flushed bytecode of %d functions (%zu bytes)%s\n",
+                 flushed_functions, flushed_bytes,
+                 bytecode_flush_mode_ ==
+                         BytecodeFlushMode::kAggressiveFlushBytecode
+                     ? " for memory reduction"
+                     : "");
+  }
 }
 
 void MarkCompactCollector::ClearFlushedJsFunctions() {
@@ -2369,6 +2427,13 @@ bool MarkCompactCollector::CompactTransitionArray(Map map,
   DCHECK(!map.is_prototype_map());
   int num_transitions = transitions.number_of_entries();
   if (!TransitionArrayNeedsCompaction(transitions, num_transitions)) {
+    // Deprecated maps don't get new transitions: objects are migrated to the
+    // updated map first. Release the slack of their transition arrays without
+    // waiting for one of the targets to die.
+    if (map.is_deprecated() && !isolate()->has_active_deserializer() &&
+        non_atomic_marking_state()->IsBlackOrGrey(map)) {
+      TrimTransitionArray(transitions, num_transitions);
+    }
     return false;
   }
   bool descriptors_owner_died = false;
@@ -2403,17 +2468,22 @@ bool MarkCompactCollector::CompactTransitionArray(Map map,
     DCHECK(!descriptors_owner_died);
     return false;
   }
+  TrimTransitionArray(transitions, transition_index);
+  return descriptors_owner_died;
+}
+
+void MarkCompactCollector::TrimTransitionArray(TransitionArray transitions,
+                                               int number_of_transitions) {
   // Note that we never eliminate a transition array, though we might right-trim
   // such that number_of_transitions() == 0. If this assumption changes,
   // TransitionArray::Insert() will need to deal with the case that a transition
   // array disappeared during GC.
-  int trim = transitions.Capacity() - transition_index;
+  int trim = transitions.Capacity() - number_of_transitions;
   if (trim > 0) {
     heap_->RightTrimWeakFixedArray(transitions,
                                    trim * TransitionArray::kEntrySize);
-    transitions.SetNumberOfTransitions(transition_index);
+    transitions.SetNumberOfTransitions(number_of_transitions);
   }
-  return descriptors_owner_died;
 }
 
 void MarkCompactCollector::RightTrimDescriptorArray(DescriptorArray array,
@@ -5249,16 +5319,30 @@ void YoungGenerationEvacuator::RawEvacuatePage(MemoryChunk* chunk,
 
 }  // namespace
 
+bool MinorMarkCompactCollector::ShouldPromoteYoungPagesInPlace() {
+  if (FLAG_minor_mc_high_survival_threshold <= 0) return false;
+  GCTracer* tracer = heap()->tracer();
+  if (!tracer->SurvivalEventsRecorded()) return false;
+  return tracer->AverageSurvivalRatio() >=
+         FLAG_minor_mc_high_survival_threshold;
+}
+
 void MinorMarkCompactCollector::EvacuatePagesInParallel() {
   std::vector<std::pair<ParallelWorkItem, MemoryChunk*>> evacuation_items;
   intptr_t live_bytes = 0;
 
+  // With high survival rates most objects that are copied within new space
+  // would survive the next cycle as well and get copied a second time. Move
+  // such pages straight to old space instead.
+  const bool promote_in_place = ShouldPromoteYoungPagesInPlace();
+
   for (Page* page : new_space_evacuation_pages_) {
     intptr_t live_bytes_on_page = non_atomic_marking_state()->live_bytes(page);
     if (live_bytes_on_page == 0) continue;
     live_bytes += live_bytes_on_page;
-    if (ShouldMovePage(page, live_bytes_on_page, false)) {
-      if (page->IsFlagSet(MemoryChunk::NEW_SPACE_BELOW_AGE_MARK)) {
+    if (ShouldMovePage(page, live_bytes_on_page, promote_in_place)) {
+      if (page->IsFlagSet(MemoryChunk::NEW_SPACE_BELOW_AGE_MARK) ||
+          promote_in_place) {
         EvacuateNewSpacePageVisitor<NEW_TO_OLD>::Move(page);
       } else {
         EvacuateNewSpacePageVisitor<NEW_TO_NEW>::Move(page);
@@ -13,6 +13,7 @@
 #include "src/heap/marking-worklist.h"
 #include "src/heap/marking.h"
 #include "src/heap/memory-measurement.h"
+#include "src/heap/object-stats.h"
 #include "src/heap/parallel-work-item.h"
 #include "src/heap/spaces.h"
 #include "src/heap/sweeper.h"
@@ -594,7 +595,7 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   size_t ProcessMarkingWorklist(size_t bytes_to_process);
 
  private:
-  void ComputeEvacuationHeuristics(size_t area_size,
+  void ComputeEvacuationHeuristics(AllocationSpace space, size_t area_size,
                                    int* target_fragmentation_percent,
                                    size_t* max_evacuated_bytes);
 
@@ -684,6 +685,9 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
                               DescriptorArray descriptors);
   bool TransitionArrayNeedsCompaction(TransitionArray transitions,
                                       int num_transitions);
+  // Right-trims {transitions} to hold exactly {number_of_transitions}.
+  void TrimTransitionArray(TransitionArray transitions,
+                           int number_of_transitions);
 
   // After all reachable objects have been marked those weak map entries
   // with an unreachable key are removed from all encountered weak maps.
@@ -769,6 +773,7 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   std::unique_ptr<MarkingWorklists::Local> local_marking_worklists_;
   NativeContextInferrer native_context_inferrer_;
   NativeContextStats native_context_stats_;
+  SampledObjectStats sampled_object_stats_;
 
   // Candidates for pages that should be evacuated.
   std::vector<Page*> evacuation_candidates_;
@@ -863,6 +868,11 @@ class MinorMarkCompactCollector final : public MarkCompactCollectorBase {
   void EvacuatePagesInParallel() override;
   void UpdatePointersAfterEvacuation() override;
 
+  // Returns true if recent young generation survival is high enough that
+  // surviving pages should be promoted to old space in place instead of being
+  // moved within new space first.
+  bool ShouldPromoteYoungPagesInPlace();
+
   std::unique_ptr<UpdatingItem> CreateToSpaceUpdatingItem(MemoryChunk* chunk,
                                                           Address start,
                                                           Address end) override;
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_MARKING_BARRIER_INL_H_
 #define V8_HEAP_MARKING_BARRIER_INL_H_
 
+#include "src/heap/basic-memory-chunk.h"
 #include "src/heap/incremental-marking-inl.h"
 #include "src/heap/incremental-marking.h"
 #include "src/heap/marking-barrier.h"
@@ -23,6 +24,11 @@ bool MarkingBarrier::MarkValue(HeapObject host, HeapObject value) {
   // filler map.
   DCHECK(!marking_state_.IsImpossible(host) ||
          value == ReadOnlyRoots(heap_->isolate()).one_pointer_filler_map());
+  // Objects in the shared heap are only marked by the shared isolate.
+  if (!is_shared_heap_ &&
+      BasicMemoryChunk::FromHeapObject(value)->InSharedHeap()) {
+    return false;
+  }
   if (!V8_CONCURRENT_MARKING_BOOL && !marking_state_.IsBlack(host)) {
     // The value will be marked and the slot will be recorded when the marker
     // visits the host object.
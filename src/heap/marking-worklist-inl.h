@@ -72,6 +72,42 @@ void MarkingWorklists::Local::SwitchToContext(
   active_context_ = context;
 }
 
+template <typename PopCallback>
+bool MarkingPrefetchBuffer::Pop(PopCallback pop, HeapObject* object) {
+  if (distance_ == 0) return pop(object);
+  while (size_ < distance_) {
+    HeapObject next;
+    if (!pop(&next)) break;
+    Prefetch(next);
+    entries_[(head_ + size_) % kMaxDistance] = next;
+    size_++;
+  }
+  if (size_ == 0) return false;
+  *object = entries_[head_];
+  head_ = (head_ + 1) % kMaxDistance;
+  size_--;
+  return true;
+}
+
+template <typename PushCallback>
+void MarkingPrefetchBuffer::Flush(PushCallback push) {
+  for (; size_ > 0; size_--) {
+    push(entries_[head_]);
+    head_ = (head_ + 1) % kMaxDistance;
+  }
+}
+
+// static
+void MarkingPrefetchBuffer::Prefetch(HeapObject object) {
+#if V8_CC_GNU
+  // The map word and the first slots are read right away by the visitor.
+  // Fetch the following cache line too as most objects span more than one.
+  const char* address = reinterpret_cast<const char*>(object.address());
+  __builtin_prefetch(address);
+  __builtin_prefetch(address + PROCESSOR_CACHE_LINE_SIZE);
+#endif  // V8_CC_GNU
+}
+
 }  // namespace internal
 }  // namespace v8
 
@@ -179,6 +179,15 @@ void MarkingWorklists::Local::ShareWork() {
   }
 }
 
+bool MarkingWorklists::Local::SplitWork() {
+  bool shared = active_.ShareWorkIfGlobalPoolIsEmpty();
+  if (is_per_context_mode_ && active_context_ != kSharedContext) {
+    shared |=
+        worklist_by_context_[kSharedContext]->ShareWorkIfGlobalPoolIsEmpty();
+  }
+  return shared;
+}
+
 void MarkingWorklists::Local::MergeOnHold() {
   MarkingWorklist::Local* shared =
       active_context_ == kSharedContext
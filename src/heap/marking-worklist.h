@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_MARKING_WORKLIST_H_
 #define V8_HEAP_MARKING_WORKLIST_H_
 
+#include <algorithm>
 #include <unordered_map>
 #include <vector>
 
@@ -159,6 +160,11 @@ class V8_EXPORT_PRIVATE MarkingWorklists::Local {
   // empty. In the per-context marking mode it also publishes the shared
   // worklist.
   void ShareWork();
+  // Like ShareWork() but keeps half of the local work. Used by concurrent
+  // markers so that idle tasks find work on the global pool while the owner
+  // continues marking with a warm local segment. Returns true if work was
+  // moved to the global pool.
+  bool SplitWork();
   // Merges the on-hold worklist to the shared worklist.
   void MergeOnHold();
 
@@ -183,6 +189,44 @@ class V8_EXPORT_PRIVATE MarkingWorklists::Local {
       worklist_by_context_;
 };
 
+// A small FIFO buffer in front of a marking visitor. Objects are popped from
+// the marking worklist |distance| objects ahead of being visited and a
+// prefetch of their first cache lines (map word and leading slots) is issued
+// when they enter the buffer. This hides part of the memory latency of
+// pointer-chasing heavy object graphs. Objects left in the buffer when the
+// marker stops early have to be handed back via Flush().
+class MarkingPrefetchBuffer final {
+ public:
+  static constexpr int kMaxDistance = 16;
+
+  explicit MarkingPrefetchBuffer(int distance)
+      : distance_(std::min(std::max(distance, 0), kMaxDistance)) {}
+  ~MarkingPrefetchBuffer() { DCHECK(IsEmpty()); }
+
+  MarkingPrefetchBuffer(const MarkingPrefetchBuffer&) = delete;
+  MarkingPrefetchBuffer& operator=(const MarkingPrefetchBuffer&) = delete;
+
+  // Refills the buffer using |pop| (a callable with the signature
+  // bool(HeapObject*)) and returns the oldest buffered object.
+  template <typename PopCallback>
+  inline bool Pop(PopCallback pop, HeapObject* object);
+
+  // Hands all buffered objects back using |push| (a callable with the
+  // signature void(HeapObject)).
+  template <typename PushCallback>
+  inline void Flush(PushCallback push);
+
+  bool IsEmpty() const { return size_ == 0; }
+
+ private:
+  static inline void Prefetch(HeapObject object);
+
+  const int distance_;
+  int head_ = 0;
+  int size_ = 0;
+  HeapObject entries_[kMaxDistance];
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -125,7 +125,13 @@ void MemoryAllocator::Unmapper::CancelAndWaitForPendingTasks() {
 }
 
 void MemoryAllocator::Unmapper::PrepareForGC() {
-  // Free non-regular chunks because they cannot be re-used.
+  // Free non-regular chunks because they cannot be re-used. With concurrent
+  // unmapping they are released in the background so that unmapping large
+  // pages does not add to the GC pause.
+  if (FLAG_concurrent_sweeping && !heap_->IsTearingDown()) {
+    if (NumberOfCommittedChunks() > 0) FreeQueuedChunks();
+    return;
+  }
   PerformFreeMemoryOnQueuedNonRegularChunks();
 }
 
@@ -153,6 +159,10 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks(
         "Unmapper::PerformFreeMemoryOnQueuedChunks: %d queued chunks\n",
         NumberOfChunks());
   }
+  // Large and executable chunks cannot be re-used and usually hold most of the
+  // queued memory, so release them first.
+  PerformFreeMemoryOnQueuedNonRegularChunks(delegate);
+  if (delegate && delegate->ShouldYield()) return;
   // Regular chunks.
   while ((chunk = GetMemoryChunkSafe<kRegular>()) != nullptr) {
     bool pooled = chunk->IsFlagSet(MemoryChunk::POOLED);
@@ -169,7 +179,8 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks(
       if (delegate && delegate->ShouldYield()) return;
     }
   }
-  PerformFreeMemoryOnQueuedNonRegularChunks();
+  // Pick up chunks that were queued in the meantime.
+  PerformFreeMemoryOnQueuedNonRegularChunks(delegate);
 }
 
 void MemoryAllocator::Unmapper::TearDown() {
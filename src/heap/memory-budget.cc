@@ -0,0 +1,49 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/memory-budget.h"
+
+#include <algorithm>
+
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace internal {
+
+MemoryBudget::MemoryBudget(size_t soft_limit_in_bytes,
+                           size_t hard_limit_in_bytes)
+    : soft_limit_(soft_limit_in_bytes), hard_limit_(hard_limit_in_bytes) {
+  CHECK_LE(soft_limit_, hard_limit_);
+}
+
+void MemoryBudget::Update(size_t previous, size_t current) {
+  if (current >= previous) {
+    used_.fetch_add(current - previous, std::memory_order_relaxed);
+  } else {
+    DCHECK_GE(used_.load(std::memory_order_relaxed), previous - current);
+    used_.fetch_sub(previous - current, std::memory_order_relaxed);
+  }
+}
+
+double MemoryBudget::ScaleGrowingFactor(double factor,
+                                        double min_factor) const {
+  const size_t used = used_in_bytes();
+  if (used <= soft_limit_ || factor <= min_factor) return factor;
+  if (used >= hard_limit_) return min_factor;
+  const double fill = static_cast<double>(used - soft_limit_) /
+                      static_cast<double>(hard_limit_ - soft_limit_);
+  return std::max(min_factor, factor - (factor - min_factor) * fill);
+}
+
+MemoryBudget::PressureLevel MemoryBudget::CurrentPressureLevel() const {
+  const size_t used = used_in_bytes();
+  if (used <= soft_limit_) return PressureLevel::kNone;
+  if (used >= hard_limit_) return PressureLevel::kEvictCompilationCache;
+  const size_t headroom = hard_limit_ - soft_limit_;
+  if (used - soft_limit_ < headroom / 2) return PressureLevel::kReduceMemory;
+  return PressureLevel::kFlushBytecode;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,62 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_MEMORY_BUDGET_H_
+#define V8_HEAP_MEMORY_BUDGET_H_
+
+#include <atomic>
+#include <cstddef>
+
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+
+// A memory budget shared by the heaps of several isolates. Each heap reports
+// its committed memory after garbage collections. Once the total exceeds the
+// soft limit, heaps scale down their growing factors and degrade gracefully by
+// reducing memory in increasingly aggressive steps before reaching the hard
+// limit.
+// Embedders get hold of it through the opaque v8::SharedHeapMemoryBudget.
+class V8_EXPORT_PRIVATE MemoryBudget final {
+ public:
+  // Steps taken by heaps, in order, as the budget fills up between the soft
+  // and the hard limit.
+  enum class PressureLevel {
+    kNone,
+    kReduceMemory,
+    kFlushBytecode,
+    kEvictCompilationCache,
+  };
+
+  MemoryBudget(size_t soft_limit_in_bytes, size_t hard_limit_in_bytes);
+  MemoryBudget(const MemoryBudget&) = delete;
+  MemoryBudget& operator=(const MemoryBudget&) = delete;
+
+  size_t soft_limit_in_bytes() const { return soft_limit_; }
+  size_t hard_limit_in_bytes() const { return hard_limit_; }
+  size_t used_in_bytes() const {
+    return used_.load(std::memory_order_relaxed);
+  }
+
+  // Replaces the |previous| contribution of a heap to the budget with
+  // |current|.
+  void Update(size_t previous, size_t current);
+
+  // Scales |factor| down towards |min_factor| as usage moves from the soft to
+  // the hard limit.
+  double ScaleGrowingFactor(double factor, double min_factor) const;
+
+  PressureLevel CurrentPressureLevel() const;
+
+ private:
+  const size_t soft_limit_;
+  const size_t hard_limit_;
+  std::atomic<size_t> used_{0};
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_MEMORY_BUDGET_H_
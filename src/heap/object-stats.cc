@@ -5,6 +5,7 @@
 
 #include "src/heap/object-stats.h"
 
+#include <algorithm>
 #include <unordered_set>
 
 #include "src/base/bits.h"
@@ -23,6 +24,7 @@
 #include "src/objects/literal-objects-inl.h"
 #include "src/objects/slots.h"
 #include "src/objects/templates.h"
+#include "src/objects/transitions-inl.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/ostreams.h"
 
@@ -153,6 +155,51 @@ FieldStatsCollector::GetInobjectFieldStats(Map map) {
   return stats;
 }
 
+// static
+bool SampledObjectStats::IsEnabled() {
+  return FLAG_object_stats_sampling_rate > 0;
+}
+
+void SampledObjectStats::Clear() {
+  sampling_rate_ = std::max(FLAG_object_stats_sampling_rate, 1);
+  countdown_ = sampling_rate_;
+  if (entries_) memset(entries_.get(), 0, sizeof(Entry) * kNumberOfTypes);
+}
+
+void SampledObjectStats::EnsureEntries() {
+  if (!entries_) entries_.reset(new Entry[kNumberOfTypes]());
+}
+
+void SampledObjectStats::SampleSlow(Map map, size_t size) {
+  countdown_ = sampling_rate_;
+  EnsureEntries();
+  Entry& entry = entries_[map.instance_type()];
+  entry.count++;
+  entry.size += size;
+}
+
+void SampledObjectStats::Merge(const SampledObjectStats& other) {
+  DCHECK_EQ(sampling_rate_, other.sampling_rate_);
+  if (!other.entries_) return;
+  EnsureEntries();
+  for (int i = 0; i < kNumberOfTypes; i++) {
+    entries_[i].count += other.entries_[i].count;
+    entries_[i].size += other.entries_[i].size;
+  }
+}
+
+// static
+const char* SampledObjectStats::InstanceTypeName(int type) {
+  switch (type) {
+#define INSTANCE_TYPE_NAME_CASE(name) \
+  case name:                          \
+    return #name;
+    INSTANCE_TYPE_LIST(INSTANCE_TYPE_NAME_CASE)
+#undef INSTANCE_TYPE_NAME_CASE
+  }
+  return "UNKNOWN_TYPE";
+}
+
 void ObjectStats::ClearObjectStats(bool clear_last_time_stats) {
   memset(object_counts_, 0, sizeof(object_counts_));
   memset(object_sizes_, 0, sizeof(object_sizes_));
@@ -882,6 +929,28 @@ void ObjectStatsCollectorImpl::RecordVirtualMapDetails(Map map) {
                                    ObjectStats::ENUM_INDICES_CACHE_TYPE);
   }
 
+  // Full transition arrays are split by whether their map is deprecated;
+  // their unused capacity is accounted as over-allocation.
+  HeapObject raw_transitions;
+  if (map.raw_transitions()->GetHeapObjectIfStrong(&raw_transitions) &&
+      raw_transitions.IsTransitionArray()) {
+    TransitionArray transitions = TransitionArray::cast(raw_transitions);
+    size_t over_allocated =
+        (transitions.length() -
+         TransitionArray::ToKeyIndex(transitions.number_of_entries())) *
+        kTaggedSize;
+    RecordVirtualObjectStats(
+        map, transitions,
+        map.is_deprecated() ? ObjectStats::DEPRECATED_MAP_TRANSITIONS_TYPE
+                            : ObjectStats::MAP_TRANSITIONS_TYPE,
+        transitions.Size(), over_allocated);
+    if (transitions.HasPrototypeTransitions()) {
+      RecordSimpleVirtualObjectStats(transitions,
+                                     transitions.GetPrototypeTransitions(),
+                                     ObjectStats::PROTOTYPE_TRANSITIONS_TYPE);
+    }
+  }
+
   if (map.is_prototype_map()) {
     if (map.prototype_info().IsPrototypeInfo()) {
       PrototypeInfo info = PrototypeInfo::cast(map.prototype_info());
@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_OBJECT_STATS_H_
 #define V8_HEAP_OBJECT_STATS_H_
 
+#include <memory>
+
 #include "src/objects/code.h"
 #include "src/objects/objects.h"
 
@@ -28,6 +30,7 @@
   V(DEOPTIMIZATION_DATA_TYPE)                    \
   V(DEPENDENT_CODE_TYPE)                         \
   V(DEPRECATED_DESCRIPTOR_ARRAY_TYPE)            \
+  V(DEPRECATED_MAP_TRANSITIONS_TYPE)             \
   V(EMBEDDED_OBJECT_TYPE)                        \
   V(ENUM_KEYS_CACHE_TYPE)                        \
   V(ENUM_INDICES_CACHE_TYPE)                     \
@@ -54,6 +57,7 @@
   V(MAP_PROTOTYPE_DICTIONARY_TYPE)               \
   V(MAP_PROTOTYPE_TYPE)                          \
   V(MAP_STABLE_TYPE)                             \
+  V(MAP_TRANSITIONS_TYPE)                        \
   V(NUMBER_STRING_CACHE_TYPE)                    \
   V(OBJECT_DICTIONARY_ELEMENTS_TYPE)             \
   V(OBJECT_ELEMENTS_TYPE)                        \
@@ -65,6 +69,7 @@
   V(PROTOTYPE_DESCRIPTOR_ARRAY_TYPE)             \
   V(PROTOTYPE_PROPERTY_ARRAY_TYPE)               \
   V(PROTOTYPE_PROPERTY_DICTIONARY_TYPE)          \
+  V(PROTOTYPE_TRANSITIONS_TYPE)                  \
   V(PROTOTYPE_USERS_TYPE)                        \
   V(REGEXP_MULTIPLE_CACHE_TYPE)                  \
   V(RELOC_INFO_TYPE)                             \
@@ -174,6 +179,48 @@ class ObjectStats {
   friend class ObjectStatsCollectorImpl;
 };
 
+// Counts one in every --object-stats-sampling-rate objects visited by the
+// marker, by instance type. Unlike ObjectStats this does not walk the heap, so
+// it is cheap enough to stay enabled in production. Each marking task has its
+// own instance and they are merged when marking finishes. The per-type
+// counters are only allocated once the first object is sampled.
+class SampledObjectStats final {
+ public:
+  SampledObjectStats() { Clear(); }
+
+  static bool IsEnabled();
+
+  void Sample(Map map, size_t size) {
+    if (V8_LIKELY(--countdown_ > 0)) return;
+    SampleSlow(map, size);
+  }
+
+  void Merge(const SampledObjectStats& other);
+  void Clear();
+
+  // Number of visited objects per sampled object.
+  int sampling_rate() const { return sampling_rate_; }
+  size_t count(int type) const { return entries_ ? entries_[type].count : 0; }
+  size_t size(int type) const { return entries_ ? entries_[type].size : 0; }
+
+  static const char* InstanceTypeName(int type);
+
+  static constexpr int kNumberOfTypes = LAST_TYPE + 1;
+
+ private:
+  struct Entry {
+    size_t count;
+    size_t size;
+  };
+
+  V8_NOINLINE void SampleSlow(Map map, size_t size);
+  void EnsureEntries();
+
+  int sampling_rate_;
+  int countdown_;
+  std::unique_ptr<Entry[]> entries_;
+};
+
 class ObjectStatsCollector {
  public:
   ObjectStatsCollector(Heap* heap, ObjectStats* live, ObjectStats* dead)
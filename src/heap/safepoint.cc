@@ -27,6 +27,7 @@ void GlobalSafepoint::EnterSafepointScope() {
   TimedHistogramScope timer(
       heap_->isolate()->counters()->gc_time_to_safepoint());
   TRACE_GC(heap_->tracer(), GCTracer::Scope::TIME_TO_SAFEPOINT);
+  base::TimeTicks start = base::TimeTicks::Now();
 
   local_heaps_mutex_.Lock();
 
@@ -62,6 +63,25 @@ void GlobalSafepoint::EnterSafepointScope() {
   }
 
   barrier_.WaitUntilRunningThreadsInSafepoint(running);
+  if (running > 0) {
+    ReportTimeToSafepoint(running, base::TimeTicks::Now() - start);
+  }
+}
+
+void GlobalSafepoint::ReportTimeToSafepoint(int running,
+                                            base::TimeDelta total) {
+  const char* slowest_thread = barrier_.slowest_thread();
+  const double slowest_ms = barrier_.slowest_time().InMillisecondsF();
+  TRACE_EVENT_INSTANT2(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+                       "V8.GCSafepointSlowestThread", TRACE_EVENT_SCOPE_THREAD,
+                       "thread", TRACE_STR_COPY(slowest_thread),
+                       "time_to_safepoint_ms", slowest_ms);
+  if (FLAG_trace_safepoint) {
+    heap_->isolate()->PrintWithTimestamp(
+        "Safepoint reached in %.3f ms, %d running thread(s), slowest: %s "
+        "(%.3f ms)\n",
+        total.InMillisecondsF(), running, slowest_thread, slowest_ms);
+  }
 }
 
 void GlobalSafepoint::LeaveSafepointScope() {
@@ -94,17 +114,24 @@ void GlobalSafepoint::LeaveSafepointScope() {
   local_heaps_mutex_.Unlock();
 }
 
-void GlobalSafepoint::WaitInSafepoint() { barrier_.WaitInSafepoint(); }
+void GlobalSafepoint::WaitInSafepoint(LocalHeap* local_heap) {
+  barrier_.WaitInSafepoint(local_heap);
+}
 
 void GlobalSafepoint::WaitInUnpark() { barrier_.WaitInUnpark(); }
 
-void GlobalSafepoint::NotifyPark() { barrier_.NotifyPark(); }
+void GlobalSafepoint::NotifyPark(LocalHeap* local_heap) {
+  barrier_.NotifyPark(local_heap);
+}
 
 void GlobalSafepoint::Barrier::Arm() {
   base::MutexGuard guard(&mutex_);
   DCHECK(!IsArmed());
   armed_ = true;
   stopped_ = 0;
+  armed_time_ = base::TimeTicks::Now();
+  slowest_time_ = base::TimeDelta();
+  slowest_thread_ = nullptr;
 }
 
 void GlobalSafepoint::Barrier::Disarm() {
@@ -124,17 +151,25 @@ void GlobalSafepoint::Barrier::WaitUntilRunningThreadsInSafepoint(int running) {
   DCHECK_EQ(stopped_, running);
 }
 
-void GlobalSafepoint::Barrier::NotifyPark() {
+void GlobalSafepoint::Barrier::RecordStopped(LocalHeap* local_heap) {
+  // Threads stop in order, so the last one to stop is the slowest.
+  slowest_time_ = base::TimeTicks::Now() - armed_time_;
+  slowest_thread_ = local_heap->thread_name();
+}
+
+void GlobalSafepoint::Barrier::NotifyPark(LocalHeap* local_heap) {
   base::MutexGuard guard(&mutex_);
   CHECK(IsArmed());
   stopped_++;
+  RecordStopped(local_heap);
   cv_stopped_.NotifyOne();
 }
 
-void GlobalSafepoint::Barrier::WaitInSafepoint() {
+void GlobalSafepoint::Barrier::WaitInSafepoint(LocalHeap* local_heap) {
   base::MutexGuard guard(&mutex_);
   CHECK(IsArmed());
   stopped_++;
+  RecordStopped(local_heap);
   cv_stopped_.NotifyOne();
 
   while (IsArmed()) {
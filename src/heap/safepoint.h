@@ -7,6 +7,7 @@
 
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
 #include "src/handles/persistent-handles.h"
 #include "src/heap/local-heap.h"
 #include "src/objects/visitors.h"
@@ -28,10 +29,10 @@ class GlobalSafepoint {
   void WaitInUnpark();
 
   // Enter the safepoint from a running thread
-  void WaitInSafepoint();
+  void WaitInSafepoint(LocalHeap* local_heap);
 
   // Running thread reached a safepoint by parking itself.
-  void NotifyPark();
+  void NotifyPark(LocalHeap* local_heap);
 
   V8_EXPORT_PRIVATE bool ContainsLocalHeap(LocalHeap* local_heap);
   V8_EXPORT_PRIVATE bool ContainsAnyLocalHeap();
@@ -51,6 +52,13 @@ class GlobalSafepoint {
 
   bool IsActive() { return active_safepoint_scopes_ > 0; }
 
+  // Name of the running thread that reached the active safepoint last, or
+  // nullptr if no thread was running.
+  const char* SlowestThreadForTesting() {
+    DCHECK(IsActive());
+    return barrier_.slowest_thread();
+  }
+
  private:
   class Barrier {
     base::Mutex mutex_;
@@ -60,7 +68,14 @@ class GlobalSafepoint {
 
     int stopped_ = 0;
 
+    // Time-to-safepoint of the running thread that reached the safepoint
+    // last since the barrier was armed.
+    base::TimeTicks armed_time_;
+    base::TimeDelta slowest_time_;
+    const char* slowest_thread_ = nullptr;
+
     bool IsArmed() { return armed_; }
+    void RecordStopped(LocalHeap* local_heap);
 
    public:
     Barrier() : armed_(false), stopped_(0) {}
@@ -69,14 +84,23 @@ class GlobalSafepoint {
     void Disarm();
     void WaitUntilRunningThreadsInSafepoint(int running);
 
-    void WaitInSafepoint();
+    void WaitInSafepoint(LocalHeap* local_heap);
     void WaitInUnpark();
-    void NotifyPark();
+    void NotifyPark(LocalHeap* local_heap);
+
+    // Only valid after WaitUntilRunningThreadsInSafepoint() and before
+    // Disarm().
+    base::TimeDelta slowest_time() const { return slowest_time_; }
+    const char* slowest_thread() const { return slowest_thread_; }
   };
 
   void EnterSafepointScope();
   void LeaveSafepointScope();
 
+  // Reports the time the slowest of the |running| threads took to reach the
+  // safepoint.
+  void ReportTimeToSafepoint(int running, base::TimeDelta total);
+
   template <typename Callback>
   void AddLocalHeap(LocalHeap* local_heap, Callback callback) {
     // Safepoint holds this lock in order to stop threads from starting or
@@ -34,11 +34,16 @@ size_t ScavengeJob::YoungGenerationTaskTriggerSize(Heap* heap) {
 }
 
 bool ScavengeJob::YoungGenerationSizeTaskTriggerReached(Heap* heap) {
-  return heap->new_space()->Size() >= YoungGenerationTaskTriggerSize(heap);
+  size_t trigger_size = YoungGenerationTaskTriggerSize(heap);
+  // Scavenge earlier when the embedder reported an idle window, so that the
+  // following busy period is less likely to need a scavenge.
+  if (heap->RemainingIdleWindowInMs() > 0) trigger_size /= 2;
+  return heap->new_space()->Size() >= trigger_size;
 }
 
 void ScavengeJob::ScheduleTaskIfNeeded(Heap* heap) {
   if (FLAG_scavenge_task && !task_pending_ && !heap->IsTearingDown() &&
+      !heap->IsLatencyCriticalWorkInProgress() &&
       YoungGenerationSizeTaskTriggerReached(heap)) {
     v8::Isolate* isolate = reinterpret_cast<v8::Isolate*>(heap->isolate());
     auto taskrunner =
@@ -52,7 +57,10 @@ void ScavengeJob::Task::RunInternal() {
   VMState<GC> state(isolate());
   TRACE_EVENT_CALL_STATS_SCOPED(isolate(), "v8", "V8.Task");
 
-  if (ScavengeJob::YoungGenerationSizeTaskTriggerReached(isolate()->heap())) {
+  // Allocation still triggers scavenges when the new space is full, so the
+  // task can be skipped during latency-critical work.
+  if (!isolate()->heap()->IsLatencyCriticalWorkInProgress() &&
+      ScavengeJob::YoungGenerationSizeTaskTriggerReached(isolate()->heap())) {
     isolate()->heap()->CollectGarbage(NEW_SPACE,
                                       GarbageCollectionReason::kTask);
   }
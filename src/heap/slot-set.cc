@@ -20,6 +20,14 @@ TypedSlots::~TypedSlots() {
 
 void TypedSlots::Insert(SlotType type, uint32_t offset) {
   TypedSlot slot = {TypeField::encode(type) | OffsetField::encode(offset)};
+  // Hot code slots tend to be recorded over and over again. Filter out
+  // the common case of recording the same slot twice in a row. The slot
+  // may be cleared concurrently by the sweeper, hence the atomic load.
+  if (head_ != nullptr && !head_->buffer.empty() &&
+      base::AsAtomic32::Relaxed_Load(&head_->buffer.back().type_and_offset) ==
+          slot.type_and_offset) {
+    return;
+  }
   Chunk* chunk = EnsureChunk();
   DCHECK_LT(chunk->buffer.size(), chunk->buffer.capacity());
   chunk->buffer.push_back(slot);
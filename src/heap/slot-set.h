@@ -618,8 +618,9 @@ enum SlotType {
 // the maximum possible offset is limited by the LargePage::kMaxCodePageSize.
 // The implementation is a chain of chunks, where each chunk is an array of
 // encoded (slot type, slot offset) pairs.
-// There is no duplicate detection and we do not expect many duplicates because
-// typed slots contain V8 internal pointers that are not directly exposed to JS.
+// Only consecutive duplicates are detected. We do not expect many other
+// duplicates because typed slots contain V8 internal pointers that are not
+// directly exposed to JS.
 class V8_EXPORT_PRIVATE TypedSlots {
  public:
   static const int kMaxOffset = 1 << 29;
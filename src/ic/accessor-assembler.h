@@ -71,13 +71,15 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
                          Label* if_handler, TVariable<MaybeObject>* var_handler,
                          Label* if_miss);
 
-  TNode<IntPtrT> StubCachePrimaryOffsetForTesting(TNode<Name> name,
+  TNode<IntPtrT> StubCachePrimaryOffsetForTesting(StubCache* stub_cache,
+                                                  TNode<Name> name,
                                                   TNode<Map> map) {
-    return StubCachePrimaryOffset(name, map);
+    return StubCachePrimaryOffset(stub_cache, name, map);
   }
-  TNode<IntPtrT> StubCacheSecondaryOffsetForTesting(TNode<Name> name,
+  TNode<IntPtrT> StubCacheSecondaryOffsetForTesting(StubCache* stub_cache,
+                                                    TNode<Name> name,
                                                     TNode<IntPtrT> seed) {
-    return StubCacheSecondaryOffset(name, seed);
+    return StubCacheSecondaryOffset(stub_cache, name, seed);
   }
 
   struct LoadICParameters {
@@ -491,9 +493,15 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
   // including stub cache header.
   enum StubCacheTable : int;
 
-  TNode<IntPtrT> StubCachePrimaryOffset(TNode<Name> name, TNode<Map> map);
-  TNode<IntPtrT> StubCacheSecondaryOffset(TNode<Name> name,
+  TNode<IntPtrT> StubCachePrimaryOffset(StubCache* stub_cache,
+                                        TNode<Name> name, TNode<Map> map);
+  TNode<IntPtrT> StubCacheSecondaryOffset(StubCache* stub_cache,
+                                          TNode<Name> name,
                                           TNode<IntPtrT> seed);
+  // Loads the current mask of {table}, which changes when the stub cache is
+  // grown.
+  TNode<Uint32T> LoadStubCacheMask(StubCache* stub_cache,
+                                   StubCacheTable table_id);
 
   void TryProbeStubCacheTable(StubCache* stub_cache, StubCacheTable table_id,
                               TNode<IntPtrT> entry_offset, TNode<Object> name,
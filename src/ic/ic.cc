@@ -24,6 +24,7 @@
 #include "src/ic/ic-inl.h"
 #include "src/ic/ic-stats.h"
 #include "src/ic/stub-cache.h"
+#include "src/logging/metrics.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/api-callbacks.h"
 #include "src/objects/data-handler-inl.h"
@@ -341,15 +342,52 @@ bool MigrateDeprecated(Isolate* isolate, Handle<Object> object) {
 
 }  // namespace
 
+void IC::RecordMegamorphicTransition(Handle<Object> key, int map_count) {
+  const char* ic_type;
+  if (IsKeyedLoadIC()) {
+    ic_type = "KeyedLoadIC";
+  } else if (IsKeyedHasIC()) {
+    ic_type = "KeyedHasIC";
+  } else if (IsKeyedStoreIC()) {
+    ic_type = "KeyedStoreIC";
+  } else if (IsStoreInArrayLiteralICKind(kind())) {
+    ic_type = "StoreInArrayLiteralIC";
+  } else if (IsAnyStore()) {
+    ic_type = "StoreIC";
+  } else {
+    ic_type = "LoadIC";
+  }
+  std::string property_name;
+  if (key->IsString()) {
+    static const int kMaxPropertyNameLength = 64;
+    Handle<String> string = Handle<String>::cast(key);
+    int length = std::min(string->length(), kMaxPropertyNameLength);
+    property_name =
+        string->ToCString(DISALLOW_NULLS, ROBUST_STRING_TRAVERSAL, 0, length)
+            .get();
+  } else if (key->IsSymbol()) {
+    property_name = "<symbol>";
+  }
+  isolate()->metrics_recorder()->AddMegamorphicTransition(
+      ic_type, std::move(property_name), map_count);
+}
+
 bool IC::ConfigureVectorState(IC::State new_state, Handle<Object> key) {
   DCHECK_EQ(MEGAMORPHIC, new_state);
   DCHECK_IMPLIES(!is_keyed(), key->IsName());
+  int map_count = -1;
+  if (V8_UNLIKELY(isolate()->metrics_recorder()->HasEmbedderRecorder()) &&
+      state() != MEGAMORPHIC) {
+    MapHandles maps;
+    map_count = nexus()->ExtractMaps(&maps);
+  }
   // Even though we don't change the feedback data, we still want to reset the
   // profiler ticks. Real-world observations suggest that optimizing these
   // functions doesn't improve performance.
   bool changed =
       nexus()->ConfigureMegamorphic(key->IsName() ? PROPERTY : ELEMENT);
   OnFeedbackChanged("Megamorphic");
+  if (changed && map_count >= 0) RecordMegamorphicTransition(key, map_count);
   return changed;
 }
 
@@ -94,6 +94,9 @@ class IC {
   void TraceIC(const char* type, Handle<Object> name);
   void TraceIC(const char* type, Handle<Object> name, State old_state,
                State new_state);
+  // Reports the transition to the metrics recorder, see
+  // metrics::Recorder::AddMegamorphicTransition.
+  void RecordMegamorphicTransition(Handle<Object> key, int map_count);
 
   MaybeHandle<Object> TypeError(MessageTemplate, Handle<Object> object,
                                 Handle<Object> key);
@@ -6,6 +6,7 @@
 
 #include "src/ast/ast.h"
 #include "src/base/bits.h"
+#include "src/codegen/external-reference-table.h"
 #include "src/heap/heap-inl.h"  // For InYoungGeneration().
 #include "src/ic/ic-inl.h"
 #include "src/logging/counters.h"
@@ -18,6 +19,14 @@ StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
   // Ensure the nullptr (aka Smi::zero()) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(MaybeObject()));
+  // The tables have to exist before the external reference table, which
+  // points into them, is initialized.
+  AllocateTables(kPrimaryTableSize, kSecondaryTableSize);
+}
+
+StubCache::~StubCache() {
+  delete[] primary_;
+  delete[] secondary_;
 }
 
 void StubCache::Initialize() {
@@ -26,6 +35,29 @@ void StubCache::Initialize() {
   Clear();
 }
 
+void StubCache::AllocateTables(int primary_table_size,
+                               int secondary_table_size) {
+  DCHECK(base::bits::IsPowerOfTwo(primary_table_size));
+  DCHECK(base::bits::IsPowerOfTwo(secondary_table_size));
+  delete[] primary_;
+  delete[] secondary_;
+  primary_ = new Entry[primary_table_size];
+  secondary_ = new Entry[secondary_table_size];
+  primary_table_size_ = primary_table_size;
+  secondary_table_size_ = secondary_table_size;
+  primary_mask_ = (primary_table_size - 1) << kCacheIndexShift;
+  secondary_mask_ = (secondary_table_size - 1) << kCacheIndexShift;
+}
+
+bool StubCache::ShouldGrow() const {
+  if (!FLAG_stub_cache_growth || has_grown()) return false;
+  // The tables are referenced by address from the external reference table,
+  // keep them where they are while a snapshot may be created.
+  if (isolate_->serializer_enabled()) return false;
+  return misses_since_clear_ >
+         int64_t{FLAG_stub_cache_growth_threshold} * primary_table_size_;
+}
+
 // Hash algorithm for the primary table. This algorithm is replicated in
 // the AccessorAssembler.  Returns an index into the table that
 // is scaled by 1 << kCacheIndexShift.
@@ -40,7 +72,7 @@ int StubCache::PrimaryOffset(Name name, Map map) {
       static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kMapKeyShift));
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & primary_mask_;
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
@@ -50,7 +82,7 @@ int StubCache::SecondaryOffset(Name name, int seed) {
   // Use the seed from the primary cache in the secondary cache.
   uint32_t name_low32bits = static_cast<uint32_t>(name.ptr());
   uint32_t key = (seed - name_low32bits) + kSecondaryMagic;
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & secondary_mask_;
 }
 
 int StubCache::PrimaryOffsetForTesting(Name name, Map map) {
@@ -106,6 +138,8 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
   primary->key = StrongTaggedValue(name);
   primary->value = TaggedValue(handler);
   primary->map = StrongTaggedValue(map);
+  misses_since_clear_++;
+  miss_count_++;
   isolate()->counters()->megamorphic_stub_cache_updates()->Increment();
 }
 
@@ -125,15 +159,24 @@ MaybeObject StubCache::Get(Name name, Map map) {
 }
 
 void StubCache::Clear() {
+  if (ShouldGrow()) {
+    AllocateTables(primary_table_size_ << kGrowthBits,
+                   secondary_table_size_ << kGrowthBits);
+    // Generated code finds the tables and masks through the external
+    // reference table.
+    isolate_->external_reference_table()->UpdateStubCacheReferences(isolate_);
+  }
+  misses_since_clear_ = 0;
+
   MaybeObject empty =
       MaybeObject::FromObject(isolate_->builtins()->code(Builtin::kIllegal));
   Name empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_table_size_; i++) {
     primary_[i].key = StrongTaggedValue(empty_string);
     primary_[i].map = StrongTaggedValue(Smi::zero());
     primary_[i].value = TaggedValue(empty);
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_table_size_; j++) {
     secondary_[j].key = StrongTaggedValue(empty_string);
     secondary_[j].map = StrongTaggedValue(Smi::zero());
     secondary_[j].value = TaggedValue(empty);
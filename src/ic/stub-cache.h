@@ -46,7 +46,8 @@ class V8_EXPORT_PRIVATE StubCache {
   // Access cache for entry hash(name, map).
   void Set(Name name, Map map, MaybeObject handler);
   MaybeObject Get(Name name, Map map);
-  // Clear the lookup table (@ mark compact collection).
+  // Clear the lookup table (@ mark compact collection). If the cache missed
+  // too often since it was last cleared, the tables are grown first (once).
   void Clear();
 
   enum Table { kPrimary, kSecondary };
@@ -66,6 +67,13 @@ class V8_EXPORT_PRIVATE StubCache {
         reinterpret_cast<Address>(&first_entry(table)->value));
   }
 
+  // The address of the uint32 mask that is applied to the hash to compute
+  // offsets into {table}. It changes when the cache is grown.
+  SCTableReference mask_reference(StubCache::Table table) {
+    return SCTableReference(reinterpret_cast<Address>(
+        table == kPrimary ? &primary_mask_ : &secondary_mask_));
+  }
+
   StubCache::Entry* first_entry(StubCache::Table table) {
     switch (table) {
       case StubCache::kPrimary:
@@ -78,6 +86,14 @@ class V8_EXPORT_PRIVATE StubCache {
 
   Isolate* isolate() { return isolate_; }
 
+  int primary_table_size() const { return primary_table_size_; }
+  int secondary_table_size() const { return secondary_table_size_; }
+  bool has_grown() const { return primary_table_size_ != kPrimaryTableSize; }
+
+  // The number of lookups that missed, i.e. that went to the runtime and
+  // updated the cache, over the lifetime of the cache.
+  int64_t miss_count() const { return miss_count_; }
+
   // Setting kCacheIndexShift to Name::kHashShift is convenient because it
   // causes the bit field inside the hash field to get shifted out implicitly.
   // Note that kCacheIndexShift must not get too large, because
@@ -85,11 +101,15 @@ class V8_EXPORT_PRIVATE StubCache {
   // the STATIC_ASSERT below, in {entry(...)}).
   static const int kCacheIndexShift = Name::kHashShift;
 
+  // The initial table sizes.
   static const int kPrimaryTableBits = 11;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
   static const int kSecondaryTableBits = 9;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
 
+  // When the cache is grown, both tables grow by this many bits.
+  static const int kGrowthBits = 2;
+
   // We compute the hash code for a map as follows:
   //   <code> = <address> ^ (<address> >> kMapKeyShift)
   static const int kMapKeyShift = kPrimaryTableBits + kCacheIndexShift;
@@ -97,11 +117,12 @@ class V8_EXPORT_PRIVATE StubCache {
   // Some magic number used in the secondary hash computation.
   static const int kSecondaryMagic = 0xb16ca6e5;
 
-  static int PrimaryOffsetForTesting(Name name, Map map);
-  static int SecondaryOffsetForTesting(Name name, int seed);
+  int PrimaryOffsetForTesting(Name name, Map map);
+  int SecondaryOffsetForTesting(Name name, int seed);
 
   // The constructor is made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
+  ~StubCache();
   StubCache(const StubCache&) = delete;
   StubCache& operator=(const StubCache&) = delete;
 
@@ -116,12 +137,17 @@ class V8_EXPORT_PRIVATE StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Name name, Map map);
+  int PrimaryOffset(Name name, Map map);
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Name name, int seed);
+  int SecondaryOffset(Name name, int seed);
+
+  // (Re)allocates both tables with the given number of entries, which have
+  // to be cleared before the cache is used.
+  void AllocateTables(int primary_table_size, int secondary_table_size);
+  bool ShouldGrow() const;
 
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
@@ -138,8 +164,16 @@ class V8_EXPORT_PRIVATE StubCache {
   }
 
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  Entry* primary_ = nullptr;
+  Entry* secondary_ = nullptr;
+  int primary_table_size_ = 0;
+  int secondary_table_size_ = 0;
+  // (table size - 1) << kCacheIndexShift, loaded by generated code.
+  uint32_t primary_mask_ = 0;
+  uint32_t secondary_mask_ = 0;
+  // Misses since the last Clear(), and in total.
+  int64_t misses_since_clear_ = 0;
+  int64_t miss_count_ = 0;
   Isolate* isolate_;
 
   friend class Isolate;
@@ -3916,14 +3916,21 @@ void Genesis::InitializeGlobal(Handle<JSGlobalObject> global_object,
                           "unregister",
                           Builtin::kFinalizationRegistryUnregister, 1, false);
 
-    // The cleanupSome function is created but not exposed, as it is used
-    // internally by InvokeFinalizationRegistryCleanupFromTask.
+    // The cleanupSome function is created but not exposed.
     //
     // It is exposed by FLAG_harmony_weak_refs_with_cleanup_some.
     Handle<JSFunction> cleanup_some_fun = SimpleCreateFunction(
         isolate_, factory->InternalizeUtf8String("cleanupSome"),
         Builtin::kFinalizationRegistryPrototypeCleanupSome, 0, false);
     native_context()->set_finalization_registry_cleanup_some(*cleanup_some_fun);
+
+    // Never exposed, used internally by
+    // InvokeFinalizationRegistryCleanupFromTask.
+    Handle<JSFunction> cleanup_slice_fun = SimpleCreateFunction(
+        isolate_, factory->InternalizeUtf8String("cleanupSlice"),
+        Builtin::kFinalizationRegistryCleanupSlice, 0, false);
+    native_context()->set_finalization_registry_cleanup_slice(
+        *cleanup_slice_fun);
   }
 
   {  // -- W e a k R e f
@@ -5236,6 +5243,29 @@ void Genesis::TransferNamedProperties(Handle<JSObject> from,
   // Merging those two global objects is impossible.
   // The global template must not create properties that already exist
   // in the snapshotted global object.
+  if (to->IsJSGlobalObject()) {
+    // Grow the global dictionary once for all of the template's properties.
+    int number_of_properties;
+    if (from->HasFastProperties()) {
+      number_of_properties = from->map().NumberOfOwnDescriptors();
+    } else if (from->IsJSGlobalObject()) {
+      number_of_properties = JSGlobalObject::cast(*from)
+                                 .global_dictionary(kAcquireLoad)
+                                 .NumberOfElements();
+    } else if (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
+      number_of_properties =
+          from->property_dictionary_swiss().NumberOfElements();
+    } else {
+      number_of_properties = from->property_dictionary().NumberOfElements();
+    }
+    Handle<JSGlobalObject> global = Handle<JSGlobalObject>::cast(to);
+    Handle<GlobalDictionary> dictionary(global->global_dictionary(kAcquireLoad),
+                                        isolate());
+    dictionary = GlobalDictionary::EnsureCapacity(
+        isolate(), dictionary, number_of_properties, AllocationType::kOld);
+    global->set_global_dictionary(*dictionary, kReleaseStore);
+  }
+
   if (from->HasFastProperties()) {
     Handle<DescriptorArray> descs = Handle<DescriptorArray>(
         from->map().instance_descriptors(isolate()), isolate());
@@ -80,6 +80,7 @@ void IsolateAllocator::InitializeOncePerProcess() {
         "Failed to reserve virtual memory for process-wide V8 "
         "pointer compression cage");
   }
+  if (FLAG_advise_huge_pages) GetProcessWidePtrComprCage()->AdviseHugePages();
 #endif
 }
 
@@ -91,6 +92,7 @@ IsolateAllocator::IsolateAllocator() {
         nullptr,
         "Failed to reserve memory for Isolate V8 pointer compression cage");
   }
+  if (FLAG_advise_huge_pages) isolate_ptr_compr_cage_.AdviseHugePages();
   page_allocator_ = isolate_ptr_compr_cage_.page_allocator();
   CommitPagesForIsolate();
 #elif defined(V8_COMPRESS_POINTERS_IN_SHARED_CAGE)
@@ -75,6 +75,7 @@ void V8::TearDown() {
 void V8::InitializeOncePerProcessImpl() {
   // Update logging information before enforcing flag implications.
   bool* log_all_flags[] = {&FLAG_turbo_profiling_log_builtins,
+                           &FLAG_turbo_profiling_log_functions,
                            &FLAG_log_all,
                            &FLAG_log_api,
                            &FLAG_log_code,
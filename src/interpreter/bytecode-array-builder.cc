@@ -746,6 +746,19 @@ BytecodeArrayBuilder& BytecodeArrayBuilder::StoreGlobal(
 BytecodeArrayBuilder& BytecodeArrayBuilder::LoadContextSlot(
     Register context, int slot_index, int depth,
     ContextSlotMutability mutability) {
+  const bool track_load = mutability == kImmutableSlot && register_optimizer_ &&
+                          FLAG_ignition_elide_redundant_context_loads;
+  if (track_load) {
+    Register equivalent;
+    if (register_optimizer_->FindImmutableContextSlotLoad(context, slot_index,
+                                                          depth, &equivalent)) {
+      if (equivalent != Register::virtual_accumulator()) {
+        LoadAccumulatorWithRegister(equivalent);
+      }
+      return *this;
+    }
+  }
+
   if (context.is_current_context() && depth == 0) {
     if (mutability == kImmutableSlot) {
       OutputLdaImmutableCurrentContextSlot(slot_index);
@@ -759,12 +772,19 @@ BytecodeArrayBuilder& BytecodeArrayBuilder::LoadContextSlot(
     DCHECK_EQ(mutability, kMutableSlot);
     OutputLdaContextSlot(context, slot_index, depth);
   }
+  if (track_load) {
+    register_optimizer_->RecordImmutableContextSlotLoad(context, slot_index,
+                                                        depth);
+  }
   return *this;
 }
 
 BytecodeArrayBuilder& BytecodeArrayBuilder::StoreContextSlot(Register context,
                                                              int slot_index,
                                                              int depth) {
+  if (register_optimizer_) {
+    register_optimizer_->InvalidateContextSlotLoads(slot_index);
+  }
   if (context.is_current_context() && depth == 0) {
     OutputStaCurrentContextSlot(slot_index);
   } else {
@@ -1117,6 +1137,7 @@ BytecodeArrayBuilder& BytecodeArrayBuilder::MarkHandler(
   // let control fall through into it.
   DCHECK_IMPLIES(register_optimizer_,
                  register_optimizer_->EnsureAllRegistersAreFlushed());
+  if (register_optimizer_) register_optimizer_->InvalidateContextSlotLoads();
   bytecode_array_writer_.BindHandlerTarget(handler_table_builder(), handler_id);
   handler_table_builder()->SetPrediction(handler_id, catch_prediction);
   return *this;
@@ -4,6 +4,8 @@
 
 #include "src/interpreter/bytecode-register-optimizer.h"
 
+#include <algorithm>
+
 namespace v8 {
 namespace internal {
 namespace interpreter {
@@ -223,6 +225,7 @@ BytecodeRegisterOptimizer::BytecodeRegisterOptimizer(
       max_register_index_(fixed_registers_count - 1),
       register_info_table_(zone),
       registers_needing_flushed_(zone),
+      context_slot_loads_(zone),
       equivalence_id_(0),
       bytecode_writer_(bytecode_writer),
       flush_required_(false),
@@ -272,6 +275,7 @@ bool BytecodeRegisterOptimizer::EnsureAllRegistersAreFlushed() const {
 }
 
 void BytecodeRegisterOptimizer::Flush() {
+  InvalidateContextSlotLoads();
   if (!flush_required_) {
     return;
   }
@@ -415,6 +419,7 @@ void BytecodeRegisterOptimizer::RegisterTransfer(RegisterInfo* input_info,
 }
 
 void BytecodeRegisterOptimizer::PrepareOutputRegister(Register reg) {
+  InvalidateContextSlotLoadsFrom(reg);
   RegisterInfo* reg_info = GetRegisterInfo(reg);
   if (reg_info->materialized()) {
     CreateMaterializedEquivalent(reg_info);
@@ -461,6 +466,62 @@ RegisterList BytecodeRegisterOptimizer::GetInputRegisterList(
   }
 }
 
+void BytecodeRegisterOptimizer::RecordImmutableContextSlotLoad(
+    Register context, int slot_index, int depth) {
+  InvalidateContextSlotLoads(slot_index);
+  if (context_slot_loads_.size() == kMaxContextSlotLoads) {
+    context_slot_loads_.erase(context_slot_loads_.begin());
+  }
+  context_slot_loads_.push_back(
+      {context, slot_index, depth, accumulator_info_->equivalence_id()});
+}
+
+bool BytecodeRegisterOptimizer::FindImmutableContextSlotLoad(
+    Register context, int slot_index, int depth, Register* equivalent) {
+  for (const ContextSlotLoad& load : context_slot_loads_) {
+    if (load.context != context || load.slot_index != slot_index ||
+        load.depth != depth) {
+      continue;
+    }
+    if (accumulator_info_->equivalence_id() == load.equivalence_id) {
+      *equivalent = accumulator_;
+      return true;
+    }
+    // Any allocated register still in the equivalence set of the load holds
+    // its value, since leaving the set is the only way to be overwritten.
+    for (RegisterInfo* reg_info : register_info_table_) {
+      if (reg_info->allocated() &&
+          reg_info->equivalence_id() == load.equivalence_id) {
+        *equivalent = reg_info->register_value();
+        return true;
+      }
+    }
+    return false;
+  }
+  return false;
+}
+
+void BytecodeRegisterOptimizer::InvalidateContextSlotLoads(int slot_index) {
+  // Different context registers and depths may alias the same context, so
+  // loads are invalidated by slot index alone.
+  context_slot_loads_.erase(
+      std::remove_if(context_slot_loads_.begin(), context_slot_loads_.end(),
+                     [=](const ContextSlotLoad& load) {
+                       return load.slot_index == slot_index;
+                     }),
+      context_slot_loads_.end());
+}
+
+void BytecodeRegisterOptimizer::InvalidateContextSlotLoadsFromSlow(
+    Register reg) {
+  context_slot_loads_.erase(
+      std::remove_if(context_slot_loads_.begin(), context_slot_loads_.end(),
+                     [=](const ContextSlotLoad& load) {
+                       return load.context == reg;
+                     }),
+      context_slot_loads_.end());
+}
+
 void BytecodeRegisterOptimizer::GrowRegisterMap(Register reg) {
   DCHECK(RegisterIsTemporary(reg));
   size_t index = GetRegisterInfoTableIndex(reg);
@@ -51,16 +51,35 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
     RegisterTransfer(input_info, accumulator_info_);
   }
   void DoStar(Register output) {
+    InvalidateContextSlotLoadsFrom(output);
     RegisterInfo* output_info = GetRegisterInfo(output);
     RegisterTransfer(accumulator_info_, output_info);
   }
   void DoMov(Register input, Register output) {
+    InvalidateContextSlotLoadsFrom(output);
     RegisterInfo* input_info = GetRegisterInfo(input);
     RegisterInfo* output_info = GetRegisterInfo(output);
     RegisterTransfer(input_info, output_info);
   }
 
-  // Materialize all live registers and flush equivalence sets.
+  // Immutable context slots keep their value once initialized, so a repeated
+  // load of the same slot within a basic block can be replaced by a transfer
+  // from a register that still holds the value of the previous load.
+  // RecordImmutableContextSlotLoad is called right after the load has been
+  // emitted into the accumulator. FindImmutableContextSlotLoad returns true
+  // and sets |equivalent| (possibly to the accumulator) if such a register
+  // exists.
+  void RecordImmutableContextSlotLoad(Register context, int slot_index,
+                                      int depth);
+  bool FindImmutableContextSlotLoad(Register context, int slot_index, int depth,
+                                    Register* equivalent);
+  // Forgets recorded loads of |slot_index| in any context, or of all slots.
+  void InvalidateContextSlotLoads(int slot_index);
+  void InvalidateContextSlotLoads() { context_slot_loads_.clear(); }
+
+  // Materialize all live registers and flush equivalence sets. This also
+  // forgets recorded context slot loads, as it is called at every basic block
+  // boundary.
   void Flush();
   bool EnsureAllRegistersAreFlushed() const;
 
@@ -82,6 +101,14 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
       Flush();
     }
 
+    // Changing the current context or storing through a dynamic lookup
+    // invalidates any recorded context slot load.
+    if (bytecode == Bytecode::kPushContext ||
+        bytecode == Bytecode::kPopContext ||
+        bytecode == Bytecode::kStaLookupSlot) {
+      InvalidateContextSlotLoads();
+    }
+
     // Materialize the accumulator if it is read by the bytecode. The
     // accumulator is special and no other register can be materialized
     // in it's place.
@@ -113,9 +140,24 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
 
  private:
   static const uint32_t kInvalidEquivalenceId;
+  static const size_t kMaxContextSlotLoads = 8;
 
   class RegisterInfo;
 
+  struct ContextSlotLoad {
+    Register context;
+    int slot_index;
+    int depth;
+    uint32_t equivalence_id;
+  };
+
+  // Forgets recorded loads that go through |context| when it is overwritten.
+  void InvalidateContextSlotLoadsFrom(Register reg) {
+    if (context_slot_loads_.empty()) return;
+    InvalidateContextSlotLoadsFromSlow(reg);
+  }
+  void InvalidateContextSlotLoadsFromSlow(Register reg);
+
   // BytecodeRegisterAllocator::Observer interface.
   void RegisterAllocateEvent(Register reg) override;
   void RegisterListAllocateEvent(RegisterList reg_list) override;
@@ -197,6 +239,8 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
 
   ZoneDeque<RegisterInfo*> registers_needing_flushed_;
 
+  ZoneVector<ContextSlotLoad> context_slot_loads_;
+
   // Counter for equivalence sets identifiers.
   int equivalence_id_;
 
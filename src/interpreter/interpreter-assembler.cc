@@ -1414,9 +1414,11 @@ TNode<FixedArray> InterpreterAssembler::ExportParametersAndRegisterFile(
   if (FLAG_debug_code) {
     CSA_ASSERT(this, IntPtrEqual(registers.base_reg_location(),
                                  RegisterLocation(Register(0))));
-    AbortIfRegisterCountInvalid(array, formal_parameter_count_intptr,
-                                register_count);
   }
+  // Check the bounds once for the whole range, so that the accesses in the
+  // loops below don't have to.
+  AbortIfRegisterCountInvalid(array, formal_parameter_count_intptr,
+                              register_count);
 
   {
     TVARIABLE(IntPtrT, var_index);
@@ -1438,7 +1440,8 @@ TNode<FixedArray> InterpreterAssembler::ExportParametersAndRegisterFile(
       TNode<IntPtrT> reg_index = IntPtrAdd(reg_base, index);
       TNode<Object> value = LoadRegister(reg_index);
 
-      StoreFixedArrayElement(array, index, value);
+      StoreFixedArrayElement(array, index, value, UPDATE_WRITE_BARRIER, 0,
+                             CheckBounds::kDebugOnly);
 
       var_index = IntPtrAdd(index, IntPtrConstant(1));
       Goto(&loop);
@@ -1466,7 +1469,8 @@ TNode<FixedArray> InterpreterAssembler::ExportParametersAndRegisterFile(
 
       TNode<IntPtrT> array_index =
           IntPtrAdd(formal_parameter_count_intptr, index);
-      StoreFixedArrayElement(array, array_index, value);
+      StoreFixedArrayElement(array, array_index, value, UPDATE_WRITE_BARRIER,
+                             0, CheckBounds::kDebugOnly);
 
       var_index = IntPtrAdd(index, IntPtrConstant(1));
       Goto(&loop);
@@ -1486,9 +1490,11 @@ TNode<FixedArray> InterpreterAssembler::ImportRegisterFile(
   if (FLAG_debug_code) {
     CSA_ASSERT(this, IntPtrEqual(registers.base_reg_location(),
                                  RegisterLocation(Register(0))));
-    AbortIfRegisterCountInvalid(array, formal_parameter_count_intptr,
-                                register_count);
   }
+  // Check the bounds once for the whole range, so that the accesses in the
+  // loops below don't have to.
+  AbortIfRegisterCountInvalid(array, formal_parameter_count_intptr,
+                              register_count);
 
   TVARIABLE(IntPtrT, var_index, IntPtrConstant(0));
 
@@ -1503,13 +1509,17 @@ TNode<FixedArray> InterpreterAssembler::ImportRegisterFile(
 
     TNode<IntPtrT> array_index =
         IntPtrAdd(formal_parameter_count_intptr, index);
-    TNode<Object> value = LoadFixedArrayElement(array, array_index);
+    TNode<Object> value =
+        LoadFixedArrayElement(array, array_index, 0, LoadSensitivity::kSafe,
+                              CheckBounds::kDebugOnly);
 
     TNode<IntPtrT> reg_index =
         IntPtrSub(IntPtrConstant(Register(0).ToOperand()), index);
     StoreRegister(value, reg_index);
 
-    StoreFixedArrayElement(array, array_index, StaleRegisterConstant());
+    // The stale register marker is an immortal immovable root.
+    StoreFixedArrayElement(array, array_index, StaleRegisterConstant(),
+                           SKIP_WRITE_BARRIER, 0, CheckBounds::kDebugOnly);
 
     var_index = IntPtrAdd(index, IntPtrConstant(1));
     Goto(&loop);
@@ -2769,12 +2769,18 @@ DEBUG_BREAK_BYTECODE_LIST(DEBUG_BREAK)
 // Increment the execution count for the given slot. Used for block code
 // coverage.
 IGNITION_HANDLER(IncBlockCounter, InterpreterAssembler) {
+  // Skip the builtin call entirely while block counting is paused.
+  Label done(this);
+  GotoIf(IsBlockCountingPaused(), &done);
+
   TNode<Object> closure = LoadRegister(Register::function_closure());
   TNode<Smi> coverage_array_slot = BytecodeOperandIdxSmi(0);
   TNode<Context> context = GetContext();
 
   CallBuiltin(Builtin::kIncBlockCounter, context, closure, coverage_array_slot);
+  Goto(&done);
 
+  BIND(&done);
   Dispatch();
 }
 
@@ -399,6 +399,16 @@ Handle<Map> ParentOfDescriptorOwner(Isolate* isolate, Handle<Map> maybe_root,
 }
 }  // namespace
 
+template <typename Char>
+Handle<Map> JsonParser<Char>::FeedbackFromMap(Map map) {
+  // Don't consume feedback from objects with a map that's detached from the
+  // transition tree.
+  if (map.IsDetached(isolate_)) return Handle<Map>();
+  Handle<Map> feedback = handle(map, isolate_);
+  if (feedback->is_deprecated()) feedback = Map::Update(isolate_, feedback);
+  return feedback;
+}
+
 template <typename Char>
 Handle<Object> JsonParser<Char>::BuildJsonObject(
     const JsonContinuation& cont,
@@ -697,6 +707,8 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
   SmallVector<Handle<Object>> element_stack;
 
   cont_stack.reserve(16);
+  // Allocated outside of the continuation scopes below.
+  object_map_cache_ = factory()->NewFixedArray(kObjectMapCacheSize);
 
   JsonContinuation cont(isolate_, JsonContinuation::kReturn, 0);
 
@@ -822,22 +834,31 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
             break;
           }
 
+          // Objects with the same number of named properties are likely to
+          // have the same shape, so fall back to the map of the last such
+          // object when there is no previous array element to learn from.
+          const size_t named_length =
+              property_stack.size() - cont.index - cont.elements;
+          const bool use_map_cache = named_length < kObjectMapCacheSize;
           Handle<Map> feedback;
           if (cont_stack.size() > 0 &&
               cont_stack.back().type() == JsonContinuation::kArrayElement &&
               cont_stack.back().index < element_stack.size() &&
               element_stack.back()->IsJSObject()) {
-            Map maybe_feedback = JSObject::cast(*element_stack.back()).map();
-            // Don't consume feedback from objects with a map that's detached
-            // from the transition tree.
-            if (!maybe_feedback.IsDetached(isolate_)) {
-              feedback = handle(maybe_feedback, isolate_);
-              if (feedback->is_deprecated()) {
-                feedback = Map::Update(isolate_, feedback);
-              }
-            }
+            feedback = FeedbackFromMap(
+                JSObject::cast(*element_stack.back()).map());
+          } else if (use_map_cache) {
+            Object cached = object_map_cache_->get(
+                static_cast<int>(named_length));
+            if (cached.IsMap()) feedback = FeedbackFromMap(Map::cast(cached));
           }
           value = BuildJsonObject(cont, property_stack, feedback);
+          if (use_map_cache && value->IsJSObject()) {
+            Map map = JSObject::cast(*value).map();
+            if (!map.is_dictionary_map()) {
+              object_map_cache_->set(static_cast<int>(named_length), map);
+            }
+          }
           property_stack.resize_no_init(cont.index);
           Expect(JsonToken::RBRACE);
 
@@ -1101,6 +1122,39 @@ void JsonParser<Char>::DecodeString(SinkChar* sink, int start, int length) {
   }
 }
 
+namespace {
+
+// Skips one-byte characters a machine word at a time, as long as the word
+// contains no character that may terminate a JSON string: a quote, a
+// backslash or a control character. Returns a position at or before the
+// first such character; the scalar scan finishes from there.
+const uint8_t* SkipNonTerminatingJsonStringChars(const uint8_t* cursor,
+                                                 const uint8_t* end) {
+  constexpr uintptr_t kOnes = ~uintptr_t{0} / 0xFF;
+  constexpr uintptr_t kHighBits = kOnes * 0x80;
+  while (static_cast<size_t>(end - cursor) >= sizeof(uintptr_t)) {
+    uintptr_t word;
+    memcpy(&word, cursor, sizeof(word));
+    // A byte of (x - kOnes) & ~x has its high bit set only if some byte of x
+    // is zero; (x - kOnes * n) & ~x does the same for bytes below n.
+    const uintptr_t quote = word ^ (kOnes * '"');
+    const uintptr_t backslash = word ^ (kOnes * '\\');
+    const uintptr_t terminators = ((quote - kOnes) & ~quote) |
+                                  ((backslash - kOnes) & ~backslash) |
+                                  ((word - kOnes * 0x20) & ~word);
+    if (terminators & kHighBits) break;
+    cursor += sizeof(word);
+  }
+  return cursor;
+}
+
+const uint16_t* SkipNonTerminatingJsonStringChars(const uint16_t* cursor,
+                                                  const uint16_t* end) {
+  return cursor;
+}
+
+}  // namespace
+
 template <typename Char>
 JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   DisallowGarbageCollection no_gc;
@@ -1110,6 +1164,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   uc32 bits = 0;
 
   while (true) {
+    cursor_ = SkipNonTerminatingJsonStringChars(cursor_, end_);
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
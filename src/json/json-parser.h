@@ -288,6 +288,9 @@ class JsonParser final {
   // one of "true", "false", or "null", or an object or array literal.
   MaybeHandle<Object> ParseJsonValue();
 
+  // Returns {map} to use as feedback for the shape of the next object, or an
+  // empty handle if it cannot be used.
+  Handle<Map> FeedbackFromMap(Map map);
   Handle<Object> BuildJsonObject(
       const JsonContinuation& cont,
       const SmallVector<JsonProperty>& property_stack, Handle<Map> feedback);
@@ -339,6 +342,10 @@ class JsonParser final {
   // Indicates whether the bytes underneath source_ can relocate during GC.
   bool chars_may_relocate_;
   Handle<JSFunction> object_constructor_;
+  // Map of the last object built, by number of named properties. Used as
+  // feedback for objects that are not array elements.
+  static constexpr size_t kObjectMapCacheSize = 16;
+  Handle<FixedArray> object_map_cache_;
   const Handle<String> original_source_;
   Handle<String> source_;
 
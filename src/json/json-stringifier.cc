@@ -4,6 +4,8 @@
 
 #include "src/json/json-stringifier.h"
 
+#include <vector>
+
 #include "src/common/message-template.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/heap-number-inl.h"
@@ -21,7 +23,8 @@ namespace internal {
 
 class JsonStringifier {
  public:
-  explicit JsonStringifier(Isolate* isolate);
+  explicit JsonStringifier(Isolate* isolate,
+                           JsonStringifyOutput* output = nullptr);
 
   ~JsonStringifier() { DeleteArray(gap_); }
 
@@ -88,6 +91,7 @@ class JsonStringifier {
                                 uint32_t length);
 
   void SerializeString(Handle<String> object);
+  bool SerializeConsString(Handle<ConsString> object);
 
   template <typename SrcChar, typename DestChar>
   V8_INLINE static void SerializeStringUnchecked_(
@@ -97,6 +101,12 @@ class JsonStringifier {
   template <typename SrcChar, typename DestChar>
   V8_INLINE void SerializeString_(Handle<String> string);
 
+  template <typename SrcChar, typename DestChar>
+  V8_INLINE void SerializeStringContents_(Handle<String> string);
+
+  template <typename DestChar>
+  void SerializeSegments_(const std::vector<Handle<String>>& segments);
+
   template <typename Char>
   V8_INLINE static bool DoNotEscape(Char c);
 
@@ -120,9 +130,20 @@ class JsonStringifier {
   static const int kCircularErrorMessagePrefixCount = 2;
   static const int kCircularErrorMessagePostfixCount = 1;
 
+  // Passes the completed parts of the builder to output_ once they add up
+  // to kOutputPartLength characters.
+  V8_INLINE void MaybeWriteOutput() {
+    if (output_ == nullptr) return;
+    if (builder_.AccumulatedLength() < kOutputPartLength) return;
+    output_->WritePart(builder_.TakeAccumulatedParts());
+  }
+
   Factory* factory() { return isolate_->factory(); }
 
+  static const int kOutputPartLength = 64 * KB;
+
   Isolate* isolate_;
+  JsonStringifyOutput* const output_;
   IncrementalStringBuilder builder_;
   Handle<String> tojson_string_;
   Handle<FixedArray> property_list_;
@@ -138,8 +159,9 @@ class JsonStringifier {
 };
 
 MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
-                                  Handle<Object> replacer, Handle<Object> gap) {
-  JsonStringifier stringifier(isolate);
+                                  Handle<Object> replacer, Handle<Object> gap,
+                                  JsonStringifyOutput* output) {
+  JsonStringifier stringifier(isolate, output);
   return stringifier.Stringify(object, replacer, gap);
 }
 
@@ -211,8 +233,10 @@ const char* const JsonStringifier::JsonEscapeTable =
     "\xF8\0      \xF9\0      \xFA\0      \xFB\0      "
     "\xFC\0      \xFD\0      \xFE\0      \xFF\0      ";
 
-JsonStringifier::JsonStringifier(Isolate* isolate)
+JsonStringifier::JsonStringifier(Isolate* isolate,
+                                 JsonStringifyOutput* output)
     : isolate_(isolate),
+      output_(output),
       builder_(isolate),
       gap_(nullptr),
       indent_(0),
@@ -229,7 +253,13 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
   }
   Result result = SerializeObject(object);
   if (result == UNCHANGED) return factory()->undefined_value();
-  if (result == SUCCESS) return builder_.Finish();
+  if (result == SUCCESS) {
+    if (output_ == nullptr) return builder_.Finish();
+    Handle<String> rest;
+    if (!builder_.Finish().ToHandle(&rest)) return MaybeHandle<Object>();
+    if (rest->length() > 0) output_->WritePart(rest);
+    return factory()->empty_string();
+  }
   DCHECK(result == EXCEPTION);
   return MaybeHandle<Object>();
 }
@@ -515,6 +545,7 @@ template <bool deferred_string_key>
 JsonStringifier::Result JsonStringifier::Serialize_(Handle<Object> object,
                                                     bool comma,
                                                     Handle<Object> key) {
+  MaybeWriteOutput();
   StackLimitCheck interrupt_check(isolate_);
   Handle<Object> initial_value = object;
   if (interrupt_check.InterruptRequested() &&
@@ -873,6 +904,36 @@ JsonStringifier::Result JsonStringifier::SerializeJSProxy(
   return SUCCESS;
 }
 
+namespace {
+
+// Returns the length of the longest prefix of {chars}, in whole machine
+// words, that contains no characters escaped by JSON (control characters,
+// the quote and the backslash).
+int UnescapedOneByteWordsLength(const uint8_t* chars, int length) {
+  constexpr uintptr_t kOnes = ~uintptr_t{0} / 0xFF;
+  constexpr uintptr_t kHighBits = kOnes * 0x80;
+  int i = 0;
+  for (; length - i >= static_cast<int>(sizeof(uintptr_t));
+       i += sizeof(uintptr_t)) {
+    uintptr_t word;
+    memcpy(&word, chars + i, sizeof(word));
+    const uintptr_t quote = word ^ (kOnes * '"');
+    const uintptr_t backslash = word ^ (kOnes * '\\');
+    // Detects bytes below 0x20, quotes and backslashes.
+    const uintptr_t escapes = ((word - kOnes * 0x20) & ~word) |
+                              ((quote - kOnes) & ~quote) |
+                              ((backslash - kOnes) & ~backslash);
+    if (escapes & kHighBits) break;
+  }
+  return i;
+}
+
+int UnescapedOneByteWordsLength(const uint16_t* chars, int length) {
+  return 0;
+}
+
+}  // namespace
+
 template <typename SrcChar, typename DestChar>
 void JsonStringifier::SerializeStringUnchecked_(
     base::Vector<const SrcChar> src,
@@ -881,6 +942,13 @@ void JsonStringifier::SerializeStringUnchecked_(
   // The <uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
   for (int i = 0; i < src.length(); i++) {
+    // Copy runs of one-byte characters that need no escaping in bulk.
+    int run = UnescapedOneByteWordsLength(src.begin() + i, src.length() - i);
+    if (run > 0) {
+      dest->AppendChars(src.begin() + i, run);
+      i += run;
+      if (i == src.length()) break;
+    }
     SrcChar c = src[i];
     if (DoNotEscape(c)) {
       dest->Append(c);
@@ -931,8 +999,24 @@ void JsonStringifier::SerializeStringUnchecked_(
 
 template <typename SrcChar, typename DestChar>
 void JsonStringifier::SerializeString_(Handle<String> string) {
-  int length = string->length();
   builder_.Append<uint8_t, DestChar>('"');
+  SerializeStringContents_<SrcChar, DestChar>(string);
+  builder_.Append<uint8_t, DestChar>('"');
+}
+
+template <typename DestChar>
+void JsonStringifier::SerializeSegments_(
+    const std::vector<Handle<String>>& segments) {
+  builder_.Append<uint8_t, DestChar>('"');
+  for (Handle<String> segment : segments) {
+    SerializeStringContents_<uint8_t, DestChar>(segment);
+  }
+  builder_.Append<uint8_t, DestChar>('"');
+}
+
+template <typename SrcChar, typename DestChar>
+void JsonStringifier::SerializeStringContents_(Handle<String> string) {
+  int length = string->length();
   // We might be able to fit the whole escaped string in the current string
   // part, or we might need to allocate.
   if (int worst_case_length = builder_.EscapedLengthIfCurrentPartFits(length)) {
@@ -991,7 +1075,6 @@ void JsonStringifier::SerializeString_(Handle<String> string) {
       }
     }
   }
-  builder_.Append<uint8_t, DestChar>('"');
 }
 
 template <>
@@ -1025,7 +1108,46 @@ void JsonStringifier::SerializeDeferredKey(bool deferred_comma,
   if (gap_ != nullptr) builder_.AppendCharacter(' ');
 }
 
+// Serializes a one-byte cons string segment by segment, which avoids
+// flattening (i.e. copying) it. One-byte strings can't contain surrogate
+// pairs, which would need to be escaped across segment boundaries. Returns
+// false if the string is too fragmented for this to pay off.
+bool JsonStringifier::SerializeConsString(Handle<ConsString> object) {
+  static const int kMinAverageSegmentLength = 64;
+  HandleScope scope(isolate_);
+  std::vector<Handle<String>> segments;
+  {
+    DisallowGarbageCollection no_gc;
+    const int max_segments = object->length() / kMinAverageSegmentLength;
+    int num_segments = 0;
+    int offset;
+    ConsStringIterator counter(*object);
+    for (String segment = counter.Next(&offset); !segment.is_null();
+         segment = counter.Next(&offset)) {
+      if (++num_segments > max_segments) return false;
+      if (!String::IsOneByteRepresentationUnderneath(segment)) return false;
+    }
+    segments.reserve(num_segments);
+    ConsStringIterator iter(*object);
+    for (String segment = iter.Next(&offset); !segment.is_null();
+         segment = iter.Next(&offset)) {
+      segments.push_back(handle(segment, isolate_));
+    }
+  }
+  if (builder_.CurrentEncoding() == String::ONE_BYTE_ENCODING) {
+    SerializeSegments_<uint8_t>(segments);
+  } else {
+    SerializeSegments_<uc16>(segments);
+  }
+  return true;
+}
+
 void JsonStringifier::SerializeString(Handle<String> object) {
+  if (object->IsConsString() && !object->IsFlat() &&
+      object->IsOneByteRepresentation() &&
+      SerializeConsString(Handle<ConsString>::cast(object))) {
+    return;
+  }
   object = String::Flatten(isolate_, object);
   if (builder_.CurrentEncoding() == String::ONE_BYTE_ENCODING) {
     if (String::IsOneByteRepresentationUnderneath(*object)) {
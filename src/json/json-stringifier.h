@@ -10,10 +10,20 @@
 namespace v8 {
 namespace internal {
 
-V8_WARN_UNUSED_RESULT MaybeHandle<Object> JsonStringify(Isolate* isolate,
-                                                        Handle<Object> object,
-                                                        Handle<Object> replacer,
-                                                        Handle<Object> gap);
+// Receives the output of JsonStringify in consecutive parts, instead of as
+// one string.
+class JsonStringifyOutput {
+ public:
+  virtual ~JsonStringifyOutput() = default;
+  virtual void WritePart(Handle<String> part) = 0;
+};
+
+// Returns the JSON string for {object}, or undefined if it has none. With an
+// {output}, the string is written to it in parts instead, and the empty
+// string is returned on success.
+V8_WARN_UNUSED_RESULT MaybeHandle<Object> JsonStringify(
+    Isolate* isolate, Handle<Object> object, Handle<Object> replacer,
+    Handle<Object> gap, JsonStringifyOutput* output = nullptr);
 }  // namespace internal
 }  // namespace v8
 
@@ -37,28 +37,34 @@ DefaultJobState::DefaultJobState(Platform* platform,
       priority_(priority),
       num_worker_threads_(std::min(num_worker_threads, kMaxWorkersPerJob)) {}
 
-DefaultJobState::~DefaultJobState() { DCHECK_EQ(0U, active_workers_); }
+DefaultJobState::~DefaultJobState() {
+  DCHECK_EQ(0U, active_workers(state_.load(std::memory_order_relaxed)));
+}
 
 void DefaultJobState::NotifyConcurrencyIncrease() {
   if (is_canceled_.load(std::memory_order_relaxed)) return;
 
-  size_t num_tasks_to_post = 0;
-  TaskPriority priority;
-  {
-    base::MutexGuard guard(&mutex_);
-    const size_t max_concurrency = CappedMaxConcurrency(active_workers_);
-    // Consider |pending_tasks_| to avoid posting too many tasks.
-    if (max_concurrency > (active_workers_ + pending_tasks_)) {
-      num_tasks_to_post = max_concurrency - active_workers_ - pending_tasks_;
-      pending_tasks_ += num_tasks_to_post;
-    }
-    priority = priority_;
-  }
+  // Bumping the generation makes concurrent state updates of workers fail, so
+  // that they call GetMaxConcurrency() again and see the new work.
+  constexpr uint64_t kGenerationIncrement = GenerationField::encode(1);
+  uint64_t state =
+      state_.fetch_add(kGenerationIncrement, std::memory_order_acq_rel) +
+      kGenerationIncrement;
+  size_t num_tasks_to_post;
+  do {
+    const size_t active = active_workers(state);
+    const size_t pending = pending_tasks(state);
+    const size_t max_concurrency = CappedMaxConcurrency(active);
+    // Consider |pending| to avoid posting too many tasks.
+    if (max_concurrency <= active + pending) return;
+    num_tasks_to_post = max_concurrency - active - pending;
+  } while (!state_.compare_exchange_weak(
+      state,
+      PendingTasksField::update(state,
+                                pending_tasks(state) + num_tasks_to_post),
+      std::memory_order_acq_rel, std::memory_order_acquire));
   // Post additional worker tasks to reach |max_concurrency|.
-  for (size_t i = 0; i < num_tasks_to_post; ++i) {
-    CallOnWorkerThread(priority, std::make_unique<DefaultJobWorker>(
-                                     shared_from_this(), job_task_.get()));
-  }
+  PostWorkers(num_tasks_to_post);
 }
 
 uint8_t DefaultJobState::AcquireTaskId() {
@@ -93,32 +99,26 @@ void DefaultJobState::ReleaseTaskId(uint8_t task_id) {
 }
 
 void DefaultJobState::Join() {
-  bool can_run = false;
-  {
-    base::MutexGuard guard(&mutex_);
-    priority_ = TaskPriority::kUserBlocking;
-    // Reserve a worker for the joining thread. GetMaxConcurrency() is ignored
-    // here, but WaitForParticipationOpportunityLockRequired() waits for
-    // workers to return if necessary so we don't exceed GetMaxConcurrency().
-    num_worker_threads_ = platform_->NumberOfWorkerThreads() + 1;
-    ++active_workers_;
-    can_run = WaitForParticipationOpportunityLockRequired();
-  }
+  priority_.store(TaskPriority::kUserBlocking, std::memory_order_relaxed);
+  // Reserve a worker for the joining thread. GetMaxConcurrency() is ignored
+  // here, but WaitForParticipationOpportunity() waits for workers to return if
+  // necessary so we don't exceed GetMaxConcurrency().
+  num_worker_threads_.store(platform_->NumberOfWorkerThreads() + 1,
+                            std::memory_order_relaxed);
+  state_.fetch_add(ActiveWorkersField::encode(1), std::memory_order_acq_rel);
+  bool can_run = WaitForParticipationOpportunity();
   DefaultJobState::JobDelegate delegate(this, true);
   while (can_run) {
     job_task_->Run(&delegate);
-    base::MutexGuard guard(&mutex_);
-    can_run = WaitForParticipationOpportunityLockRequired();
+    can_run = WaitForParticipationOpportunity();
   }
 }
 
 void DefaultJobState::CancelAndWait() {
-  {
-    base::MutexGuard guard(&mutex_);
-    is_canceled_.store(true, std::memory_order_relaxed);
-    while (active_workers_ > 0) {
-      worker_released_condition_.Wait(&mutex_);
-    }
+  is_canceled_.store(true, std::memory_order_relaxed);
+  base::MutexGuard guard(&mutex_);
+  while (active_workers(state_.load(std::memory_order_acquire)) > 0) {
+    worker_released_condition_.Wait(&mutex_);
   }
 }
 
@@ -127,73 +127,103 @@ void DefaultJobState::CancelAndDetach() {
 }
 
 bool DefaultJobState::IsActive() {
-  base::MutexGuard guard(&mutex_);
-  return job_task_->GetMaxConcurrency(active_workers_) != 0 ||
-         active_workers_ != 0;
+  const size_t active = active_workers(state_.load(std::memory_order_acquire));
+  return job_task_->GetMaxConcurrency(active) != 0 || active != 0;
 }
 
 bool DefaultJobState::CanRunFirstTask() {
-  base::MutexGuard guard(&mutex_);
-  --pending_tasks_;
-  if (is_canceled_.load(std::memory_order_relaxed)) return false;
-  if (active_workers_ >= std::min(job_task_->GetMaxConcurrency(active_workers_),
-                                  num_worker_threads_)) {
-    return false;
-  }
-  // Acquire current worker.
-  ++active_workers_;
-  return true;
+  uint64_t state = state_.load(std::memory_order_acquire);
+  bool can_run;
+  uint64_t new_state;
+  do {
+    const size_t active = active_workers(state);
+    DCHECK_LT(0U, pending_tasks(state));
+    new_state = PendingTasksField::update(state, pending_tasks(state) - 1);
+    can_run = !is_canceled_.load(std::memory_order_relaxed) &&
+              active < CappedMaxConcurrency(active);
+    // Acquire current worker.
+    if (can_run) new_state = ActiveWorkersField::update(new_state, active + 1);
+  } while (!state_.compare_exchange_weak(state, new_state,
+                                         std::memory_order_acq_rel,
+                                         std::memory_order_acquire));
+  return can_run;
 }
 
 bool DefaultJobState::DidRunTask() {
-  size_t num_tasks_to_post = 0;
-  TaskPriority priority;
-  {
-    base::MutexGuard guard(&mutex_);
-    const size_t max_concurrency = CappedMaxConcurrency(active_workers_ - 1);
+  uint64_t state = state_.load(std::memory_order_acquire);
+  while (true) {
+    const size_t active = active_workers(state);
+    const size_t pending = pending_tasks(state);
+    const size_t max_concurrency = CappedMaxConcurrency(active - 1);
     if (is_canceled_.load(std::memory_order_relaxed) ||
-        active_workers_ > max_concurrency) {
+        active > max_concurrency) {
       // Release current worker and notify.
-      --active_workers_;
-      worker_released_condition_.NotifyOne();
-      return false;
+      if (state_.compare_exchange_weak(
+              state, ActiveWorkersField::update(state, active - 1),
+              std::memory_order_acq_rel, std::memory_order_acquire)) {
+        NotifyWorkerReleased();
+        return false;
+      }
+      continue;
     }
-    // Consider |pending_tasks_| to avoid posting too many tasks.
-    if (max_concurrency > active_workers_ + pending_tasks_) {
-      num_tasks_to_post = max_concurrency - active_workers_ - pending_tasks_;
-      pending_tasks_ += num_tasks_to_post;
+    // Consider |pending| to avoid posting too many tasks.
+    if (max_concurrency <= active + pending) return true;
+    const size_t num_tasks_to_post = max_concurrency - active - pending;
+    if (state_.compare_exchange_weak(
+            state,
+            PendingTasksField::update(state, pending + num_tasks_to_post),
+            std::memory_order_acq_rel, std::memory_order_acquire)) {
+      // Post additional worker tasks to reach |max_concurrency| in the case
+      // that max concurrency increased. This is not strictly necessary, since
+      // NotifyConcurrencyIncrease() should eventually be invoked. However,
+      // some users of PostJob() batch work and tend to call
+      // NotifyConcurrencyIncrease() late. Posting here allows us to spawn new
+      // workers sooner.
+      PostWorkers(num_tasks_to_post);
+      return true;
     }
-    priority = priority_;
   }
-  // Post additional worker tasks to reach |max_concurrency| in the case that
-  // max concurrency increased. This is not strictly necessary, since
-  // NotifyConcurrencyIncrease() should eventually be invoked. However, some
-  // users of PostJob() batch work and tend to call NotifyConcurrencyIncrease()
-  // late. Posting here allows us to spawn new workers sooner.
-  for (size_t i = 0; i < num_tasks_to_post; ++i) {
-    CallOnWorkerThread(priority, std::make_unique<DefaultJobWorker>(
-                                     shared_from_this(), job_task_.get()));
-  }
-  return true;
 }
 
-bool DefaultJobState::WaitForParticipationOpportunityLockRequired() {
-  size_t max_concurrency = CappedMaxConcurrency(active_workers_ - 1);
-  while (active_workers_ > max_concurrency && active_workers_ > 1) {
-    worker_released_condition_.Wait(&mutex_);
-    max_concurrency = CappedMaxConcurrency(active_workers_ - 1);
+bool DefaultJobState::WaitForParticipationOpportunity() {
+  uint64_t state = state_.load(std::memory_order_acquire);
+  while (true) {
+    const size_t active = active_workers(state);
+    const size_t max_concurrency = CappedMaxConcurrency(active - 1);
+    if (active <= max_concurrency) return true;
+    if (active > 1) {
+      // Wait for another worker to return, unless the state changed since
+      // the concurrency was computed.
+      base::MutexGuard guard(&mutex_);
+      if (state_.load(std::memory_order_acquire) == state) {
+        worker_released_condition_.Wait(&mutex_);
+      }
+      state = state_.load(std::memory_order_acquire);
+      continue;
+    }
+    DCHECK_EQ(1U, active);
+    DCHECK_EQ(0U, max_concurrency);
+    if (state_.compare_exchange_weak(state,
+                                     ActiveWorkersField::update(state, 0),
+                                     std::memory_order_acq_rel,
+                                     std::memory_order_acquire)) {
+      is_canceled_.store(true, std::memory_order_relaxed);
+      return false;
+    }
   }
-  if (active_workers_ <= max_concurrency) return true;
-  DCHECK_EQ(1U, active_workers_);
-  DCHECK_EQ(0U, max_concurrency);
-  active_workers_ = 0;
-  is_canceled_.store(true, std::memory_order_relaxed);
-  return false;
 }
 
 size_t DefaultJobState::CappedMaxConcurrency(size_t worker_count) const {
   return std::min(job_task_->GetMaxConcurrency(worker_count),
-                  num_worker_threads_);
+                  num_worker_threads_.load(std::memory_order_relaxed));
+}
+
+void DefaultJobState::PostWorkers(size_t num_tasks) {
+  const TaskPriority priority = priority_.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < num_tasks; ++i) {
+    CallOnWorkerThread(priority, std::make_unique<DefaultJobWorker>(
+                                     shared_from_this(), job_task_.get()));
+  }
 }
 
 void DefaultJobState::CallOnWorkerThread(TaskPriority priority,
@@ -208,9 +238,13 @@ void DefaultJobState::CallOnWorkerThread(TaskPriority priority,
   }
 }
 
-void DefaultJobState::UpdatePriority(TaskPriority priority) {
+void DefaultJobState::NotifyWorkerReleased() {
   base::MutexGuard guard(&mutex_);
-  priority_ = priority;
+  worker_released_condition_.NotifyOne();
+}
+
+void DefaultJobState::UpdatePriority(TaskPriority priority) {
+  priority_.store(priority, std::memory_order_relaxed);
 }
 
 DefaultJobHandle::DefaultJobHandle(std::shared_ptr<DefaultJobState> state)
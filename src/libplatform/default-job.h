@@ -10,6 +10,7 @@
 
 #include "include/libplatform/libplatform-export.h"
 #include "include/v8-platform.h"
+#include "src/base/bit-field.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 
@@ -68,34 +69,52 @@ class V8_PLATFORM_EXPORT DefaultJobState
   void UpdatePriority(TaskPriority);
 
  private:
+  // |state_| packs the number of workers running this job, the number of
+  // posted tasks that aren't running it yet, and a generation that
+  // NotifyConcurrencyIncrease() bumps. All of them are updated with
+  // compare-and-swap after calling GetMaxConcurrency(), so that a worker that
+  // computed the concurrency before work was added fails to update the state
+  // and re-evaluates instead of returning.
+  using ActiveWorkersField = base::BitField64<size_t, 0, 16>;
+  using PendingTasksField = ActiveWorkersField::Next<size_t, 16>;
+  using GenerationField = PendingTasksField::Next<uint32_t, 32>;
+
+  static size_t active_workers(uint64_t state) {
+    return ActiveWorkersField::decode(state);
+  }
+  static size_t pending_tasks(uint64_t state) {
+    return PendingTasksField::decode(state);
+  }
+
   // Called from the joining thread. Waits for the worker count to be below or
   // equal to max concurrency (will happen when a worker calls
   // DidRunTask()). Returns true if the joining thread should run a task, or
   // false if joining was completed and all other workers returned because
   // there's no work remaining.
-  bool WaitForParticipationOpportunityLockRequired();
+  bool WaitForParticipationOpportunity();
 
   // Returns GetMaxConcurrency() capped by the number of threads used by this
   // job.
   size_t CappedMaxConcurrency(size_t worker_count) const;
 
+  // Posts |num_tasks| worker tasks with the current priority.
+  void PostWorkers(size_t num_tasks);
   void CallOnWorkerThread(TaskPriority priority, std::unique_ptr<Task> task);
+  // Called after a worker stopped running this job.
+  void NotifyWorkerReleased();
 
   Platform* const platform_;
   std::unique_ptr<JobTask> job_task_;
 
-  // All members below are protected by |mutex_|.
-  base::Mutex mutex_;
-  TaskPriority priority_;
-  // Number of workers running this job.
-  size_t active_workers_ = 0;
-  // Number of posted tasks that aren't running this job yet.
-  size_t pending_tasks_ = 0;
+  std::atomic<TaskPriority> priority_;
+  std::atomic<uint64_t> state_{0};
   // Indicates if the job is canceled.
   std::atomic_bool is_canceled_{false};
   // Number of worker threads available to schedule the worker task.
-  size_t num_worker_threads_;
-  // Signaled when a worker returns.
+  std::atomic<size_t> num_worker_threads_;
+  // Only used to wait for workers to return. |worker_released_condition_| is
+  // signaled with |mutex_| held when a worker returns.
+  base::Mutex mutex_;
   base::ConditionVariable worker_released_condition_;
 
   std::atomic<uint32_t> assigned_task_ids_{0};
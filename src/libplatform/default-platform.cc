@@ -45,13 +45,15 @@ int GetActualThreadPoolSize(int thread_pool_size) {
 std::unique_ptr<v8::Platform> NewDefaultPlatform(
     int thread_pool_size, IdleTaskSupport idle_task_support,
     InProcessStackDumping in_process_stack_dumping,
-    std::unique_ptr<v8::TracingController> tracing_controller) {
+    std::unique_ptr<v8::TracingController> tracing_controller,
+    NumaPinning numa_pinning) {
   if (in_process_stack_dumping == InProcessStackDumping::kEnabled) {
     v8::base::debug::EnableInProcessStackDumping();
   }
   thread_pool_size = GetActualThreadPoolSize(thread_pool_size);
   auto platform = std::make_unique<DefaultPlatform>(
-      thread_pool_size, idle_task_support, std::move(tracing_controller));
+      thread_pool_size, idle_task_support, std::move(tracing_controller),
+      numa_pinning);
   return platform;
 }
 
@@ -99,9 +101,11 @@ void NotifyIsolateShutdown(v8::Platform* platform, Isolate* isolate) {
 
 DefaultPlatform::DefaultPlatform(
     int thread_pool_size, IdleTaskSupport idle_task_support,
-    std::unique_ptr<v8::TracingController> tracing_controller)
+    std::unique_ptr<v8::TracingController> tracing_controller,
+    NumaPinning numa_pinning)
     : thread_pool_size_(thread_pool_size),
       idle_task_support_(idle_task_support),
+      numa_pinning_(numa_pinning),
       tracing_controller_(std::move(tracing_controller)),
       page_allocator_(std::make_unique<v8::base::PageAllocator>()) {
   if (!tracing_controller_) {
@@ -139,7 +143,8 @@ void DefaultPlatform::EnsureBackgroundTaskRunnerInitialized() {
       std::make_shared<DefaultWorkerThreadsTaskRunner>(
           thread_pool_size_, time_function_for_testing_
                                  ? time_function_for_testing_
-                                 : DefaultTimeFunction);
+                                 : DefaultTimeFunction,
+          numa_pinning_);
   DCHECK_NOT_NULL(worker_threads_task_runner_);
 }
 
@@ -214,7 +219,22 @@ void DefaultPlatform::CallOnWorkerThread(std::unique_ptr<Task> task) {
   // - or some component in V8 is ignoring --single-threaded
   //   and posting a background task.
   DCHECK_NOT_NULL(worker_threads_task_runner_);
-  worker_threads_task_runner_->PostTask(std::move(task));
+  worker_threads_task_runner_->PostTask(TaskPriority::kUserVisible,
+                                        std::move(task));
+}
+
+void DefaultPlatform::CallBlockingTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  DCHECK_NOT_NULL(worker_threads_task_runner_);
+  worker_threads_task_runner_->PostTask(TaskPriority::kUserBlocking,
+                                        std::move(task));
+}
+
+void DefaultPlatform::CallLowPriorityTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  DCHECK_NOT_NULL(worker_threads_task_runner_);
+  worker_threads_task_runner_->PostTask(TaskPriority::kBestEffort,
+                                        std::move(task));
 }
 
 void DefaultPlatform::CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
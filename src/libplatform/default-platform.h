@@ -31,7 +31,8 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
   explicit DefaultPlatform(
       int thread_pool_size = 0,
       IdleTaskSupport idle_task_support = IdleTaskSupport::kDisabled,
-      std::unique_ptr<v8::TracingController> tracing_controller = {});
+      std::unique_ptr<v8::TracingController> tracing_controller = {},
+      NumaPinning numa_pinning = NumaPinning::kDisabled);
 
   ~DefaultPlatform() override;
 
@@ -58,6 +59,8 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
   std::shared_ptr<TaskRunner> GetForegroundTaskRunner(
       v8::Isolate* isolate) override;
   void CallOnWorkerThread(std::unique_ptr<Task> task) override;
+  void CallBlockingTaskOnWorkerThread(std::unique_ptr<Task> task) override;
+  void CallLowPriorityTaskOnWorkerThread(std::unique_ptr<Task> task) override;
   void CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                  double delay_in_seconds) override;
   bool IdleTasksEnabled(Isolate* isolate) override;
@@ -75,6 +78,7 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
   base::Mutex lock_;
   const int thread_pool_size_;
   IdleTaskSupport idle_task_support_;
+  const NumaPinning numa_pinning_;
   std::shared_ptr<DefaultWorkerThreadsTaskRunner> worker_threads_task_runner_;
   std::map<v8::Isolate*, std::shared_ptr<DefaultForegroundTaskRunner>>
       foreground_task_runner_map_;
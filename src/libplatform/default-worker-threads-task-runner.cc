@@ -4,16 +4,26 @@
 
 #include "src/libplatform/default-worker-threads-task-runner.h"
 
+#include "src/base/sys-info.h"
 #include "src/libplatform/delayed-task-queue.h"
 
 namespace v8 {
 namespace platform {
 
 DefaultWorkerThreadsTaskRunner::DefaultWorkerThreadsTaskRunner(
-    uint32_t thread_pool_size, TimeFunction time_function)
+    uint32_t thread_pool_size, TimeFunction time_function,
+    NumaPinning numa_pinning)
     : queue_(time_function), time_function_(time_function) {
+  // Pinning only pays off if there is more than one node to spread over.
+  // Online node ids may have gaps (e.g. "0,2"), so map onto the actual ids.
+  std::vector<int> numa_nodes;
+  if (numa_pinning == NumaPinning::kEnabled) {
+    numa_nodes = base::SysInfo::OnlineNumaNodes();
+  }
   for (uint32_t i = 0; i < thread_pool_size; ++i) {
-    thread_pool_.push_back(std::make_unique<WorkerThread>(this));
+    const int numa_node =
+        numa_nodes.size() > 1 ? numa_nodes[i % numa_nodes.size()] : -1;
+    thread_pool_.push_back(std::make_unique<WorkerThread>(this, numa_node));
   }
 }
 
@@ -31,10 +41,15 @@ void DefaultWorkerThreadsTaskRunner::Terminate() {
   thread_pool_.clear();
 }
 
-void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
+void DefaultWorkerThreadsTaskRunner::PostTask(TaskPriority priority,
+                                              std::unique_ptr<Task> task) {
   base::MutexGuard guard(&lock_);
   if (terminated_) return;
-  queue_.Append(std::move(task));
+  queue_.Append(std::move(task), priority);
+}
+
+void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
+  PostTask(TaskPriority::kUserVisible, std::move(task));
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
@@ -60,15 +75,18 @@ std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext() {
 }
 
 DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
-    DefaultWorkerThreadsTaskRunner* runner)
+    DefaultWorkerThreadsTaskRunner* runner, int numa_node)
     : Thread(Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread")),
-      runner_(runner) {
+      runner_(runner),
+      numa_node_(numa_node) {
   CHECK(Start());
 }
 
 DefaultWorkerThreadsTaskRunner::WorkerThread::~WorkerThread() { Join(); }
 
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
+  // Failing to pin is harmless; the thread just keeps its default affinity.
+  if (numa_node_ >= 0) base::SysInfo::SetCurrentThreadNumaNode(numa_node_);
   while (std::unique_ptr<Task> task = runner_->GetNext()) {
     task->Run();
   }
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "include/libplatform/libplatform-export.h"
+#include "include/libplatform/libplatform.h"
 #include "include/v8-platform.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
@@ -22,8 +23,9 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
  public:
   using TimeFunction = double (*)();
 
-  DefaultWorkerThreadsTaskRunner(uint32_t thread_pool_size,
-                                 TimeFunction time_function);
+  DefaultWorkerThreadsTaskRunner(
+      uint32_t thread_pool_size, TimeFunction time_function,
+      NumaPinning numa_pinning = NumaPinning::kDisabled);
 
   ~DefaultWorkerThreadsTaskRunner() override;
 
@@ -31,6 +33,10 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
   double MonotonicallyIncreasingTime();
 
+  // Posts a task that is run before all tasks of a lower priority, and after
+  // the tasks of the same priority that were posted before it.
+  void PostTask(TaskPriority priority, std::unique_ptr<Task> task);
+
   // v8::TaskRunner implementation.
   void PostTask(std::unique_ptr<Task> task) override;
 
@@ -44,7 +50,9 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
  private:
   class WorkerThread : public base::Thread {
    public:
-    explicit WorkerThread(DefaultWorkerThreadsTaskRunner* runner);
+    // |numa_node| is the NUMA node the thread is pinned to, or -1 if it may
+    // run on any CPU.
+    WorkerThread(DefaultWorkerThreadsTaskRunner* runner, int numa_node);
     ~WorkerThread() override;
 
     WorkerThread(const WorkerThread&) = delete;
@@ -55,6 +63,7 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
    private:
     DefaultWorkerThreadsTaskRunner* runner_;
+    const int numa_node_;
   };
 
   // Called by the WorkerThread. Gets the next take (delayed or immediate) to be
@@ -4,6 +4,8 @@
 
 #include "src/libplatform/delayed-task-queue.h"
 
+#include <algorithm>
+
 #include "include/v8-platform.h"
 #include "src/base/logging.h"
 #include "src/base/platform/time.h"
@@ -17,18 +19,26 @@ DelayedTaskQueue::DelayedTaskQueue(TimeFunction time_function)
 DelayedTaskQueue::~DelayedTaskQueue() {
   base::MutexGuard guard(&lock_);
   DCHECK(terminated_);
-  DCHECK(task_queue_.empty());
+#ifdef DEBUG
+  for (auto& task_queue : task_queues_) DCHECK(task_queue.empty());
+#endif  // DEBUG
 }
 
 double DelayedTaskQueue::MonotonicallyIncreasingTime() {
   return time_function_();
 }
 
-void DelayedTaskQueue::Append(std::unique_ptr<Task> task) {
+void DelayedTaskQueue::Append(std::unique_ptr<Task> task,
+                              TaskPriority priority) {
   base::MutexGuard guard(&lock_);
   DCHECK(!terminated_);
-  task_queue_.push(std::move(task));
-  queues_condition_var_.NotifyOne();
+  queue(priority).push(std::move(task));
+  if (idle_threads_ > 0) queues_condition_var_.NotifyOne();
+  // Also use the thread waiting for delayed tasks if there are more tasks
+  // than idle threads.
+  if (has_delayed_task_waiter_ && ImmediateTaskCount() > idle_threads_) {
+    delayed_task_condition_var_.NotifyOne();
+  }
 }
 
 void DelayedTaskQueue::AppendDelayed(std::unique_ptr<Task> task,
@@ -39,48 +49,92 @@ void DelayedTaskQueue::AppendDelayed(std::unique_ptr<Task> task,
     base::MutexGuard guard(&lock_);
     DCHECK(!terminated_);
     delayed_task_queue_.emplace(deadline, std::move(task));
-    queues_condition_var_.NotifyOne();
+    if (has_delayed_task_waiter_) {
+      if (deadline < delayed_task_waiter_deadline_) {
+        delayed_task_waiter_deadline_ = deadline;
+        delayed_task_condition_var_.NotifyOne();
+      }
+    } else if (idle_threads_ > 0) {
+      // Let an idle thread wait for the task.
+      queues_condition_var_.NotifyOne();
+    }
   }
 }
 
 std::unique_ptr<Task> DelayedTaskQueue::GetNext() {
   base::MutexGuard guard(&lock_);
+  bool notify_idle_threads = false;
   for (;;) {
     // Move delayed tasks that have hit their deadline to the main queue.
     double now = MonotonicallyIncreasingTime();
     std::unique_ptr<Task> task = PopTaskFromDelayedQueue(now);
     while (task) {
-      task_queue_.push(std::move(task));
+      queue(TaskPriority::kUserVisible).push(std::move(task));
       task = PopTaskFromDelayedQueue(now);
+      notify_idle_threads = true;
     }
-    if (!task_queue_.empty()) {
-      std::unique_ptr<Task> result = std::move(task_queue_.front());
-      task_queue_.pop();
+    if (std::unique_ptr<Task> result = PopTaskFromQueues()) {
+      // Hand over the remaining due tasks, and waiting for the next delayed
+      // task if this thread did that.
+      if (notify_idle_threads) NotifyIdleThreads();
       return result;
     }
 
     if (terminated_) {
       queues_condition_var_.NotifyAll();
+      delayed_task_condition_var_.NotifyAll();
       return nullptr;
     }
 
-    if (task_queue_.empty() && !delayed_task_queue_.empty()) {
+    if (!delayed_task_queue_.empty() && !has_delayed_task_waiter_) {
       // Wait for the next delayed task or a newly posted task.
-      double wait_in_seconds = delayed_task_queue_.begin()->first - now;
+      delayed_task_waiter_deadline_ = delayed_task_queue_.begin()->first;
+      double wait_in_seconds = delayed_task_waiter_deadline_ - now;
       base::TimeDelta wait_delta = base::TimeDelta::FromMicroseconds(
           base::TimeConstants::kMicrosecondsPerSecond * wait_in_seconds);
 
       // WaitFor unfortunately doesn't care about our fake time and will wait
       // the 'real' amount of time, based on whatever clock the system call
       // uses.
-      bool notified = queues_condition_var_.WaitFor(&lock_, wait_delta);
+      has_delayed_task_waiter_ = true;
+      bool notified = delayed_task_condition_var_.WaitFor(&lock_, wait_delta);
       USE(notified);
+      has_delayed_task_waiter_ = false;
+      notify_idle_threads = true;
     } else {
+      idle_threads_++;
       queues_condition_var_.Wait(&lock_);
+      idle_threads_--;
     }
   }
 }
 
+size_t DelayedTaskQueue::ImmediateTaskCount() const {
+  size_t count = 0;
+  for (auto& task_queue : task_queues_) count += task_queue.size();
+  return count;
+}
+
+void DelayedTaskQueue::NotifyIdleThreads() {
+  size_t needed_threads = ImmediateTaskCount();
+  if (!delayed_task_queue_.empty() && !has_delayed_task_waiter_) {
+    needed_threads++;
+  }
+  for (size_t i = 0; i < std::min(needed_threads, idle_threads_); i++) {
+    queues_condition_var_.NotifyOne();
+  }
+}
+
+std::unique_ptr<Task> DelayedTaskQueue::PopTaskFromQueues() {
+  for (auto it = task_queues_.rbegin(); it != task_queues_.rend(); ++it) {
+    if (it->empty()) continue;
+    std::unique_ptr<Task> result = std::move(it->front());
+    it->pop();
+    return result;
+  }
+  return nullptr;
+}
+
 // Gets the next task from the delayed queue for which the deadline has passed
 // according to |now|. Returns nullptr if no such task exists.
 std::unique_ptr<Task> DelayedTaskQueue::PopTaskFromDelayedQueue(double now) {
@@ -99,6 +153,7 @@ void DelayedTaskQueue::Terminate() {
   DCHECK(!terminated_);
   terminated_ = true;
   queues_condition_var_.NotifyAll();
+  delayed_task_condition_var_.NotifyAll();
 }
 
 }  // namespace platform
@@ -5,19 +5,19 @@
 #ifndef V8_LIBPLATFORM_DELAYED_TASK_QUEUE_H_
 #define V8_LIBPLATFORM_DELAYED_TASK_QUEUE_H_
 
+#include <array>
 #include <map>
 #include <memory>
 #include <queue>
 
 #include "include/libplatform/libplatform-export.h"
+#include "include/v8-platform.h"
 #include "src/base/macros.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 
 namespace v8 {
 
-class Task;
-
 namespace platform {
 
 // DelayedTaskQueue provides queueing for immediate and delayed tasks. It does
@@ -36,8 +36,11 @@ class V8_PLATFORM_EXPORT DelayedTaskQueue {
   double MonotonicallyIncreasingTime();
 
   // Appends an immediate task to the queue. The queue takes ownership of
-  // |task|. Tasks appended via this method will be run in order. Thread-safe.
-  void Append(std::unique_ptr<Task> task);
+  // |task|. Tasks appended via this method with the same |priority| will be
+  // run in order, and tasks of a higher priority are run before those of a
+  // lower priority. Thread-safe.
+  void Append(std::unique_ptr<Task> task,
+              TaskPriority priority = TaskPriority::kUserVisible);
 
   // Appends a delayed task to the queue. There is no ordering guarantee
   // provided regarding delayed tasks, both with respect to other delayed tasks
@@ -47,18 +50,42 @@ class V8_PLATFORM_EXPORT DelayedTaskQueue {
   // Returns the next task to process. Blocks if no task is available.
   // Returns nullptr if the queue is terminated. Will return either an immediate
   // task posted using Append() or a delayed task where the deadline has passed,
-  // according to the |time_function| provided in the constructor. Thread-safe.
+  // according to the |time_function| provided in the constructor. Delayed
+  // tasks are run with TaskPriority::kUserVisible once due. Thread-safe.
   std::unique_ptr<Task> GetNext();
 
   // Terminate the queue.
   void Terminate();
 
  private:
+  static constexpr size_t kNumPriorities =
+      static_cast<size_t>(TaskPriority::kUserBlocking) + 1;
+
   std::unique_ptr<Task> PopTaskFromDelayedQueue(double now);
+  // Returns the oldest task of the highest priority, or nullptr.
+  std::unique_ptr<Task> PopTaskFromQueues();
+  std::queue<std::unique_ptr<Task>>& queue(TaskPriority priority) {
+    return task_queues_[static_cast<size_t>(priority)];
+  }
+  size_t ImmediateTaskCount() const;
+  // Wakes up as many idle threads as there are immediate tasks, plus one to
+  // wait for the next delayed task if no thread is waiting for it.
+  void NotifyIdleThreads();
+
+  // Threads that find no task to run wait on |queues_condition_var_|, except
+  // for at most one thread that waits for the earliest delayed task on
+  // |delayed_task_condition_var_|. Posting a delayed task therefore only wakes
+  // up a thread if the task is due before the current earliest deadline, and
+  // idle threads don't all wake up whenever a delayed task is due.
+  base::ConditionVariable delayed_task_condition_var_;
+  bool has_delayed_task_waiter_ = false;
+  double delayed_task_waiter_deadline_ = 0;
+  size_t idle_threads_ = 0;
 
   base::ConditionVariable queues_condition_var_;
   base::Mutex lock_;
-  std::queue<std::unique_ptr<Task>> task_queue_;
+  // One queue of immediate tasks per TaskPriority, indexed by priority.
+  std::array<std::queue<std::unique_ptr<Task>>, kNumPriorities> task_queues_;
   std::multimap<double, std::unique_ptr<Task>> delayed_task_queue_;
   bool terminated_ = false;
   TimeFunction time_function_;
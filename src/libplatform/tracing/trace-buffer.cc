@@ -4,41 +4,114 @@
 
 #include "src/libplatform/tracing/trace-buffer.h"
 
+#include <algorithm>
+
 namespace v8 {
 namespace platform {
 namespace tracing {
 
 TraceBufferRingBuffer::TraceBufferRingBuffer(size_t max_chunks,
                                              TraceWriter* trace_writer)
-    : max_chunks_(max_chunks) {
+    : max_chunks_(max_chunks),
+      use_thread_chunks_(max_chunks >= kMinChunksForThreadChunks),
+      thread_writer_key_(base::Thread::CreateThreadLocalKey()) {
   trace_writer_.reset(trace_writer);
   chunks_.resize(max_chunks);
+  writers_.resize(max_chunks);
+}
+
+TraceBufferRingBuffer::~TraceBufferRingBuffer() {
+  base::Thread::DeleteThreadLocalKey(thread_writer_key_);
+}
+
+TraceBufferRingBuffer::ChunkWriter*
+TraceBufferRingBuffer::GetThreadChunkWriter() const {
+  return static_cast<ChunkWriter*>(
+      base::Thread::GetThreadLocal(thread_writer_key_));
+}
+
+bool TraceBufferRingBuffer::CanAddTo(const ChunkWriter* writer) const {
+  return writer != nullptr && writer->chunk != nullptr &&
+         writer->generation == generation_.load(std::memory_order_acquire) &&
+         !writer->chunk->IsFull();
 }
 
 TraceObject* TraceBufferRingBuffer::AddTraceEvent(uint64_t* handle) {
+  if (!use_thread_chunks_) {
+    base::MutexGuard guard(&mutex_);
+    return AddTraceEventLocked(&shared_writer_, handle);
+  }
+  ChunkWriter* writer = GetThreadChunkWriter();
+  if (V8_LIKELY(CanAddTo(writer))) {
+    // Only this thread adds events to its chunk.
+    TraceBufferChunk* chunk = writer->chunk;
+    size_t event_index;
+    TraceObject* trace_object = chunk->AddTraceEvent(&event_index);
+    *handle = MakeHandle(chunk->seq() % max_chunks_, chunk->seq(),
+                         event_index);
+    return trace_object;
+  }
   base::MutexGuard guard(&mutex_);
-  if (is_empty_ || chunks_[chunk_index_]->IsFull()) {
-    chunk_index_ = is_empty_ ? 0 : NextChunkIndex(chunk_index_);
-    is_empty_ = false;
-    auto& chunk = chunks_[chunk_index_];
-    if (chunk) {
-      chunk->Reset(current_chunk_seq_++);
-    } else {
-      chunk.reset(new TraceBufferChunk(current_chunk_seq_++));
-    }
+  if (writer == nullptr) {
+    thread_writers_.push_back(std::make_unique<ChunkWriter>());
+    writer = thread_writers_.back().get();
+    base::Thread::SetThreadLocal(thread_writer_key_, writer);
   }
-  auto& chunk = chunks_[chunk_index_];
+  return AddTraceEventLocked(writer, handle);
+}
+
+TraceObject* TraceBufferRingBuffer::AddTraceEventLocked(ChunkWriter* writer,
+                                                        uint64_t* handle) {
+  if (!CanAddTo(writer)) ClaimChunkLocked(writer);
+  TraceBufferChunk* chunk = writer->chunk;
   size_t event_index;
   TraceObject* trace_object = chunk->AddTraceEvent(&event_index);
-  *handle = MakeHandle(chunk_index_, chunk->seq(), event_index);
+  *handle = MakeHandle(chunk->seq() % max_chunks_, chunk->seq(), event_index);
   return trace_object;
 }
 
+void TraceBufferRingBuffer::ClaimChunkLocked(ChunkWriter* writer) {
+  uint32_t generation = generation_.load(std::memory_order_relaxed);
+  // Release the previous chunk, unless the ring has already moved on.
+  if (writer->chunk && writer->generation == generation && !writer->evicted) {
+    size_t index = writer->chunk->seq() % max_chunks_;
+    DCHECK_EQ(writer, writers_[index]);
+    writers_[index] = nullptr;
+  }
+  writer->evicted.reset();
+
+  uint32_t seq = current_chunk_seq_++;
+  size_t index = seq % max_chunks_;
+  auto& chunk = chunks_[index];
+  if (ChunkWriter* previous_writer = writers_[index]) {
+    DCHECK(!previous_writer->evicted);
+    previous_writer->evicted = std::move(chunk);
+  }
+  if (chunk) {
+    chunk->Reset(seq);
+  } else {
+    chunk.reset(new TraceBufferChunk(seq));
+  }
+  writers_[index] = writer;
+  writer->chunk = chunk.get();
+  writer->generation = generation;
+}
+
 TraceObject* TraceBufferRingBuffer::GetEventByHandle(uint64_t handle) {
-  base::MutexGuard guard(&mutex_);
   size_t chunk_index, event_index;
   uint32_t chunk_seq;
   ExtractHandle(handle, &chunk_index, &chunk_seq, &event_index);
+  if (use_thread_chunks_) {
+    // Events are usually completed on the thread that added them, while it
+    // still adds events to the same chunk.
+    ChunkWriter* writer = GetThreadChunkWriter();
+    if (writer && writer->chunk &&
+        writer->generation == generation_.load(std::memory_order_acquire) &&
+        writer->chunk->seq() == chunk_seq) {
+      return writer->chunk->GetEventAt(event_index);
+    }
+  }
+  base::MutexGuard guard(&mutex_);
   if (chunk_index >= chunks_.size()) return nullptr;
   auto& chunk = chunks_[chunk_index];
   if (!chunk || chunk->seq() != chunk_seq) return nullptr;
@@ -47,20 +120,32 @@ TraceObject* TraceBufferRingBuffer::GetEventByHandle(uint64_t handle) {
 
 bool TraceBufferRingBuffer::Flush() {
   base::MutexGuard guard(&mutex_);
-  // This flushes all the traces stored in the buffer.
-  if (!is_empty_) {
-    for (size_t i = NextChunkIndex(chunk_index_);; i = NextChunkIndex(i)) {
-      if (auto& chunk = chunks_[i]) {
-        for (size_t j = 0; j < chunk->size(); ++j) {
-          trace_writer_->AppendTraceEvent(chunk->GetEventAt(j));
-        }
-      }
-      if (i == chunk_index_) break;
+  // This flushes all the traces stored in the buffer, oldest chunk first.
+  std::vector<TraceBufferChunk*> chunks;
+  auto add_chunk = [&](TraceBufferChunk* chunk) {
+    if (chunk && chunk->seq() >= first_unflushed_chunk_seq_) {
+      chunks.push_back(chunk);
+    }
+  };
+  for (auto& chunk : chunks_) add_chunk(chunk.get());
+  // Chunks that were evicted from the ring while still in use are older than
+  // the chunks that replaced them, but may have received events since.
+  add_chunk(shared_writer_.evicted.get());
+  for (auto& writer : thread_writers_) add_chunk(writer->evicted.get());
+  std::sort(chunks.begin(), chunks.end(),
+            [](TraceBufferChunk* a, TraceBufferChunk* b) {
+              return a->seq() < b->seq();
+            });
+  for (TraceBufferChunk* chunk : chunks) {
+    for (size_t j = 0; j < chunk->size(); ++j) {
+      trace_writer_->AppendTraceEvent(chunk->GetEventAt(j));
     }
   }
   trace_writer_->Flush();
   // This resets the trace buffer.
-  is_empty_ = true;
+  first_unflushed_chunk_seq_ = current_chunk_seq_;
+  std::fill(writers_.begin(), writers_.end(), nullptr);
+  generation_.fetch_add(1, std::memory_order_release);
   return true;
 }
 
@@ -80,11 +165,6 @@ void TraceBufferRingBuffer::ExtractHandle(uint64_t handle, size_t* chunk_index,
   *event_index = indices % TraceBufferChunk::kChunkSize;
 }
 
-size_t TraceBufferRingBuffer::NextChunkIndex(size_t index) const {
-  if (++index >= max_chunks_) index = 0;
-  return index;
-}
-
 TraceBufferChunk::TraceBufferChunk(uint32_t seq) : seq_(seq) {}
 
 void TraceBufferChunk::Reset(uint32_t new_seq) {
@@ -5,40 +5,71 @@
 #ifndef V8_LIBPLATFORM_TRACING_TRACE_BUFFER_H_
 #define V8_LIBPLATFORM_TRACING_TRACE_BUFFER_H_
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
 #include "include/libplatform/v8-tracing.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 
 namespace v8 {
 namespace platform {
 namespace tracing {
 
+// Events are added to chunks, which are stored in a ring of |max_chunks|
+// slots; the oldest chunks are overwritten when the ring wraps around. In large
+// rings, each thread adds its events to a chunk of its own without taking the
+// lock, which is only taken to claim the next chunk. Small rings share a single
+// chunk between all threads instead, so that they still keep the latest events
+// of every thread.
 class TraceBufferRingBuffer : public TraceBuffer {
  public:
   // Takes ownership of |trace_writer|.
   TraceBufferRingBuffer(size_t max_chunks, TraceWriter* trace_writer);
-  ~TraceBufferRingBuffer() override = default;
+  ~TraceBufferRingBuffer() override;
 
   TraceObject* AddTraceEvent(uint64_t* handle) override;
   TraceObject* GetEventByHandle(uint64_t handle) override;
   bool Flush() override;
 
+  static const size_t kMinChunksForThreadChunks = 16;
+
  private:
+  // The chunk that one thread (or all threads, for small rings) add events
+  // to. If the ring wraps around while the chunk is still in use, the chunk is
+  // moved to |evicted|, so that the thread can keep adding events to it until
+  // it claims the next one. Flush() writes out evicted chunks too.
+  struct ChunkWriter {
+    TraceBufferChunk* chunk = nullptr;
+    std::unique_ptr<TraceBufferChunk> evicted;
+    uint32_t generation = 0;
+  };
+
+  ChunkWriter* GetThreadChunkWriter() const;
+  bool CanAddTo(const ChunkWriter* writer) const;
+  TraceObject* AddTraceEventLocked(ChunkWriter* writer, uint64_t* handle);
+  void ClaimChunkLocked(ChunkWriter* writer);
   uint64_t MakeHandle(size_t chunk_index, uint32_t chunk_seq,
                       size_t event_index) const;
   void ExtractHandle(uint64_t handle, size_t* chunk_index, uint32_t* chunk_seq,
                      size_t* event_index) const;
   size_t Capacity() const { return max_chunks_ * TraceBufferChunk::kChunkSize; }
-  size_t NextChunkIndex(size_t index) const;
 
   mutable base::Mutex mutex_;
   size_t max_chunks_;
+  const bool use_thread_chunks_;
   std::unique_ptr<TraceWriter> trace_writer_;
   std::vector<std::unique_ptr<TraceBufferChunk>> chunks_;
-  size_t chunk_index_;
-  bool is_empty_ = true;
+  // The writer that is adding events to the chunk in the same slot, if any.
+  std::vector<ChunkWriter*> writers_;
+  ChunkWriter shared_writer_;
+  std::vector<std::unique_ptr<ChunkWriter>> thread_writers_;
+  base::Thread::LocalStorageKey thread_writer_key_;
+  // Incremented by Flush(), after which all writers claim new chunks.
+  std::atomic<uint32_t> generation_{0};
+  // Chunks with lower sequence numbers were written out by Flush().
+  uint32_t first_unflushed_chunk_seq_ = 1;
   uint32_t current_chunk_seq_ = 1;
 };
 
@@ -70,7 +70,12 @@ const int g_num_builtin_categories = 3;
 v8::base::AtomicWord g_category_index = g_num_builtin_categories;
 #endif  // !defined(V8_USE_PERFETTO)
 
-TracingController::TracingController() { mutex_.reset(new base::Mutex()); }
+TracingController::TracingController() {
+  mutex_.reset(new base::Mutex());
+#if !defined(V8_USE_PERFETTO)
+  trace_buffer_mutex_.reset(new base::SharedMutex());
+#endif  // !defined(V8_USE_PERFETTO)
+}
 
 TracingController::~TracingController() {
   StopTracing();
@@ -138,15 +143,14 @@ uint64_t TracingController::AddTraceEventWithTimestamp(
 
   uint64_t handle = 0;
   if (recording_.load(std::memory_order_acquire)) {
+    // Threads add events concurrently; only flushing excludes them.
+    base::SharedMutexGuard<base::kShared> lock(trace_buffer_mutex_.get());
     TraceObject* trace_object = trace_buffer_->AddTraceEvent(&handle);
     if (trace_object) {
-      {
-        base::MutexGuard lock(mutex_.get());
-        trace_object->Initialize(phase, category_enabled_flag, name, scope, id,
-                                 bind_id, num_args, arg_names, arg_types,
-                                 arg_values, arg_convertables, flags, timestamp,
-                                 cpu_now_us);
-      }
+      trace_object->Initialize(phase, category_enabled_flag, name, scope, id,
+                               bind_id, num_args, arg_names, arg_types,
+                               arg_values, arg_convertables, flags, timestamp,
+                               cpu_now_us);
     }
   }
   return handle;
@@ -257,6 +261,8 @@ void TracingController::StopTracing() {
 
   {
     base::MutexGuard lock(mutex_.get());
+    base::SharedMutexGuard<base::kExclusive> buffer_lock(
+        trace_buffer_mutex_.get());
     DCHECK(trace_buffer_);
     trace_buffer_->Flush();
   }
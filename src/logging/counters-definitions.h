@@ -57,6 +57,8 @@ namespace internal {
      51)                                                                       \
   HR(wasm_compile_function_peak_memory_bytes,                                  \
      V8.WasmCompileFunctionPeakMemoryBytes, 1, GB, 51)                         \
+  HR(turbofan_optimize_peak_memory_bytes,                                      \
+     V8.TurboFanOptimizePeakMemoryBytes, 1, GB, 51)                            \
   HR(asm_module_size_bytes, V8.AsmModuleSizeBytes, 1, GB, 51)                  \
   HR(compile_script_cache_behaviour, V8.CompileScript.CacheBehaviour, 0, 20,   \
      21)                                                                       \
@@ -186,6 +188,10 @@ namespace internal {
      V8.WasmCompileModuleStreamingMicroSeconds, 100000000, MICROSECOND)        \
   HT(wasm_streaming_finish_wasm_module_time,                                   \
      V8.WasmFinishModuleStreamingMicroSeconds, 100000000, MICROSECOND)         \
+  /* Time the main thread waits for background validation of lazily */         \
+  /* compiled functions at the end of the stream. */                           \
+  HT(wasm_streaming_validation_wait_time,                                      \
+     V8.WasmStreamingValidationWaitMicroSeconds, 100000000, MICROSECOND)       \
   HT(wasm_deserialization_time, V8.WasmDeserializationTimeMicroSeconds,        \
      100000000, MICROSECOND)                                                   \
   HT(wasm_tier_up_module_time, V8.WasmTierUpModuleMicroSeconds, 100000000,     \
@@ -299,7 +305,11 @@ namespace internal {
      V8.GCCompactorCausedByOldspaceExhaustion)                                 \
   SC(gc_last_resort_from_js, V8.GCLastResortFromJS)                            \
   SC(gc_last_resort_from_handles, V8.GCLastResortFromHandles)                  \
+  SC(gc_ephemeron_fixpoint_iterations, V8.GCEphemeronFixpointIterations)       \
+  SC(gc_ephemeron_linear_fallbacks, V8.GCEphemeronLinearFallbacks)             \
   SC(cow_arrays_converted, V8.COWArraysConverted)                              \
+  /* Array.prototype.concat calls that copy element by element. */             \
+  SC(array_concat_slow, V8.ArrayConcatSlow)                                    \
   SC(constructed_objects_runtime, V8.ConstructedObjectsRuntime)                \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
@@ -328,12 +338,18 @@ namespace internal {
   /* Total code size (including metadata) of baseline code or bytecode. */     \
   SC(total_baseline_code_size, V8.TotalBaselineCodeSize)                       \
   /* Total count of functions compiled using the baseline compiler. */         \
-  SC(total_baseline_compile_count, V8.TotalBaselineCompileCount)
+  SC(total_baseline_compile_count, V8.TotalBaselineCompileCount)               \
+  /* Functions and bytes of bytecode dropped by bytecode flushing. */          \
+  SC(bytecode_flushed_functions, V8.BytecodeFlushedFunctions)                  \
+  SC(bytecode_flushed_bytes, V8.BytecodeFlushedBytes)                          \
+  /* Lazy compiles of functions whose bytecode was flushed before. */          \
+  SC(bytecode_flush_recompiles, V8.BytecodeFlushRecompiles)
 
-#define STATS_COUNTER_TS_LIST(SC)                         \
-  SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes) \
-  SC(wasm_reloc_size, V8.WasmRelocBytes)                  \
-  SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions)
+#define STATS_COUNTER_TS_LIST(SC)                                          \
+  SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)                  \
+  SC(wasm_reloc_size, V8.WasmRelocBytes)                                   \
+  SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions)       \
+  SC(wasm_dynamically_tiered_functions, V8.WasmDynamicallyTieredFunctions)
 
 // List of counters that can be incremented from generated code. We need them in
 // a separate list to be able to relocate them.
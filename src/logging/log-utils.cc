@@ -5,10 +5,15 @@
 #include "src/logging/log-utils.h"
 
 #include <atomic>
+#include <deque>
 #include <memory>
+#include <streambuf>
+#include <vector>
 
+#include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
 #include "src/base/vector.h"
 #include "src/common/assert-scope.h"
 #include "src/objects/objects-inl.h"
@@ -22,6 +27,111 @@ namespace internal {
 const char* const Log::kLogToTemporaryFile = "+";
 const char* const Log::kLogToConsole = "-";
 
+// Writes the log to the output file on a background thread. Formatted log
+// lines are collected in a buffer that is handed over to the thread when it
+// is full, or when the last hand-over is older than kSubmitIntervalMs, so
+// that logging does not wait for file I/O. Only if the thread falls behind by
+// kMaxPendingBuffers buffers do the logging threads wait for it.
+class Log::AsyncWriter final : public std::streambuf {
+ public:
+  explicit AsyncWriter(FILE* file)
+      : file_(file), thread_(this), last_submit_(base::TimeTicks::Now()) {
+    current_.reserve(kBufferSize);
+    CHECK(thread_.Start());
+  }
+
+  // Writes all lines that are still pending and stops the thread.
+  ~AsyncWriter() override {
+    Submit();
+    {
+      base::MutexGuard guard(&mutex_);
+      stopping_ = true;
+      pending_cond_.NotifyOne();
+    }
+    thread_.Join();
+  }
+
+ private:
+  class WriterThread final : public base::Thread {
+   public:
+    explicit WriterThread(AsyncWriter* writer)
+        : base::Thread(base::Thread::Options("V8 LogWriter")),
+          writer_(writer) {}
+
+    void Run() override { writer_->Run(); }
+
+   private:
+    AsyncWriter* const writer_;
+  };
+
+  static constexpr size_t kBufferSize = 64 * KB;
+  static constexpr size_t kMaxPendingBuffers = 16;
+  static constexpr int kSubmitIntervalMs = 100;
+
+  // The stream buffer methods are called with Log::mutex_ held.
+
+  int_type overflow(int_type c) override {
+    if (c != traits_type::eof()) current_.push_back(static_cast<char>(c));
+    return traits_type::not_eof(c);
+  }
+
+  std::streamsize xsputn(const char* s, std::streamsize n) override {
+    current_.insert(current_.end(), s, s + n);
+    return n;
+  }
+
+  // Called at the end of each log line.
+  int sync() override {
+    if (current_.size() >= kBufferSize ||
+        base::TimeTicks::Now() - last_submit_ >=
+            base::TimeDelta::FromMilliseconds(kSubmitIntervalMs)) {
+      Submit();
+    }
+    return 0;
+  }
+
+  void Submit() {
+    last_submit_ = base::TimeTicks::Now();
+    if (current_.empty()) return;
+    base::MutexGuard guard(&mutex_);
+    while (pending_.size() >= kMaxPendingBuffers) done_cond_.Wait(&mutex_);
+    pending_.push_back(std::move(current_));
+    current_ = std::vector<char>();
+    current_.reserve(kBufferSize);
+    pending_cond_.NotifyOne();
+  }
+
+  void Run() {
+    while (true) {
+      std::vector<char> buffer;
+      {
+        base::MutexGuard guard(&mutex_);
+        while (pending_.empty() && !stopping_) pending_cond_.Wait(&mutex_);
+        if (pending_.empty()) return;
+        buffer = std::move(pending_.front());
+        pending_.pop_front();
+        done_cond_.NotifyOne();
+      }
+      size_t rv = fwrite(buffer.data(), 1, buffer.size(), file_);
+      DCHECK_EQ(buffer.size(), rv);
+      USE(rv);
+      fflush(file_);
+    }
+  }
+
+  FILE* const file_;
+  WriterThread thread_;
+  // Only accessed with Log::mutex_ held.
+  std::vector<char> current_;
+  base::TimeTicks last_submit_;
+  // Protected by {mutex_}.
+  base::Mutex mutex_;
+  base::ConditionVariable pending_cond_;
+  base::ConditionVariable done_cond_;
+  std::deque<std::vector<char>> pending_;
+  bool stopping_ = false;
+};
+
 // static
 FILE* Log::CreateOutputHandle(std::string file_name) {
   // If we're logging anything, we need to open the log file.
@@ -52,9 +162,16 @@ Log::Log(Logger* logger, std::string file_name)
       output_handle_(Log::CreateOutputHandle(file_name)),
       os_(output_handle_ == nullptr ? stdout : output_handle_),
       format_buffer_(NewArray<char>(kMessageBufferSize)) {
-  if (output_handle_) WriteLogHeader();
+  if (output_handle_ == nullptr) return;
+  if (FLAG_log_async_write) {
+    async_writer_ = std::make_unique<AsyncWriter>(output_handle_);
+    file_buffer_ = os_.rdbuf(async_writer_.get());
+  }
+  WriteLogHeader();
 }
 
+Log::~Log() = default;
+
 void Log::WriteLogHeader() {
   Log::MessageBuilder msg(this);
   LogSeparator kNext = LogSeparator::kSeparator;
@@ -86,6 +203,13 @@ std::unique_ptr<Log::MessageBuilder> Log::NewMessageBuilder() {
 
 FILE* Log::Close() {
   FILE* result = nullptr;
+  if (async_writer_) {
+    // Switch back to the buffer writing to the file directly, and drain the
+    // lines that have not been written yet.
+    base::MutexGuard guard(&mutex_);
+    os_.rdbuf(file_buffer_);
+    async_writer_.reset();
+  }
   if (output_handle_ != nullptr) {
     fflush(output_handle_);
     result = output_handle_;
@@ -185,7 +309,7 @@ void Log::MessageBuilder::AppendCharacter(char c) {
 
 void Log::MessageBuilder::AppendSymbolName(Symbol symbol) {
   DCHECK(!symbol.is_null());
-  OFStream& os = log_->os_;
+  std::ostream& os = log_->os_;
   os << "symbol(";
   if (!symbol.description().IsUndefined()) {
     os << "\"";
@@ -200,7 +324,7 @@ void Log::MessageBuilder::AppendSymbolNameDetails(String str,
   if (str.is_null()) return;
 
   DisallowGarbageCollection no_gc;  // Ensure string stays valid.
-  OFStream& os = log_->os_;
+  std::ostream& os = log_->os_;
   int limit = str.length();
   if (limit > 0x1000) limit = 0x1000;
   if (show_impl_info) {
@@ -249,7 +373,7 @@ Log::MessageBuilder& Log::MessageBuilder::operator<<<const char*>(
 
 template <>
 Log::MessageBuilder& Log::MessageBuilder::operator<<<void*>(void* pointer) {
-  OFStream& os = log_->os_;
+  std::ostream& os = log_->os_;
   // Manually format the pointer since on Windows we do not consistently
   // get a "0x" prefix.
   os << "0x" << std::hex << reinterpret_cast<intptr_t>(pointer) << std::dec;
@@ -36,6 +36,7 @@ enum class LogSeparator { kSeparator };
 class Log {
  public:
   explicit Log(Logger* logger, std::string log_file_name);
+  ~Log();
 
   V8_EXPORT_PRIVATE static bool IsLoggingToConsole(std::string file_name);
   V8_EXPORT_PRIVATE static bool IsLoggingToTemporaryFile(std::string file_name);
@@ -108,6 +109,8 @@ class Log {
   std::unique_ptr<Log::MessageBuilder> NewMessageBuilder();
 
  private:
+  class AsyncWriter;
+
   static FILE* CreateOutputHandle(std::string file_name);
   base::Mutex* mutex() { return &mutex_; }
 
@@ -123,6 +126,11 @@ class Log {
 
   OFStream os_;
 
+  // Only used with --log-async-write. Replaces the stream buffer of {os_}
+  // and thus must only be used with mutex_ held.
+  std::unique_ptr<AsyncWriter> async_writer_;
+  std::streambuf* file_buffer_ = nullptr;
+
   // mutex_ is a Mutex used for enforcing exclusive
   // access to the formatting buffer and the log file or log memory buffer.
   base::Mutex mutex_;
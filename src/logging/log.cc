@@ -1120,7 +1120,10 @@ void Logger::TimerEvent(Logger::StartEnd se, const char* name) {
 
 void Logger::BasicBlockCounterEvent(const char* name, int block_id,
                                     uint32_t count) {
-  if (!FLAG_turbo_profiling_log_builtins) return;
+  if (!FLAG_turbo_profiling_log_builtins &&
+      !FLAG_turbo_profiling_log_functions) {
+    return;
+  }
   MSG_BUILDER();
   msg << ProfileDataFromFileConstants::kBlockCounterMarker << kNext << name
       << kNext << block_id << kNext << count;
@@ -1128,7 +1131,10 @@ void Logger::BasicBlockCounterEvent(const char* name, int block_id,
 }
 
 void Logger::BuiltinHashEvent(const char* name, int hash) {
-  if (!FLAG_turbo_profiling_log_builtins) return;
+  if (!FLAG_turbo_profiling_log_builtins &&
+      !FLAG_turbo_profiling_log_functions) {
+    return;
+  }
   MSG_BUILDER();
   msg << ProfileDataFromFileConstants::kBuiltinHashMarker << kNext << name
       << kNext << hash;
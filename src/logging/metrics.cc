@@ -5,6 +5,7 @@
 #include "src/logging/metrics.h"
 
 #include "include/v8-platform.h"
+#include "src/flags/flags.h"
 
 namespace v8 {
 namespace internal {
@@ -44,10 +45,128 @@ bool Recorder::HasEmbedderRecorder() const { return embedder_recorder_.get(); }
 
 void Recorder::NotifyIsolateDisposal() {
   if (embedder_recorder_) {
+    // Tasks no longer run, so report the remaining counts right away.
+    ReportCliffs(CliffReportMode::kImmediately);
     embedder_recorder_->NotifyIsolateDisposal();
   }
 }
 
+namespace {
+// Bounds the memory of the counts if there are many distinct cliffs.
+constexpr size_t kMaxCliffEntries = 1024;
+}  // namespace
+
+void Recorder::AddMegamorphicTransition(const char* ic_type,
+                                        std::string property_name,
+                                        int map_count) {
+  if (!embedder_recorder_) return;
+  bool batch_complete;
+  {
+    base::MutexGuard lock_scope(&cliffs_lock_);
+    MegamorphicTransitionKey key(ic_type, std::move(property_name), map_count);
+    auto it = megamorphic_transitions_.find(key);
+    if (it != megamorphic_transitions_.end()) {
+      it->second++;
+    } else if (megamorphic_transitions_.size() < kMaxCliffEntries) {
+      megamorphic_transitions_.emplace(std::move(key), 1);
+    } else {
+      dropped_megamorphic_transitions_++;
+    }
+    batch_complete = RecordCliffLocked();
+  }
+  if (batch_complete) ReportCliffs(CliffReportMode::kDelayed);
+}
+
+void Recorder::AddDeoptimization(const v8::metrics::JSDeoptimization& event,
+                                 int function_position,
+                                 std::string function_name) {
+  if (!embedder_recorder_) return;
+  bool batch_complete;
+  {
+    base::MutexGuard lock_scope(&cliffs_lock_);
+    DeoptimizationKey key(event.reason, event.script_id, function_position);
+    auto it = deoptimizations_.find(key);
+    if (it == deoptimizations_.end()) {
+      if (deoptimizations_.size() < kMaxCliffEntries) {
+        it = deoptimizations_.emplace(key, DeoptimizationCounts()).first;
+        it->second.function_name = std::move(function_name);
+      } else {
+        dropped_deoptimizations_++;
+      }
+    }
+    if (it != deoptimizations_.end()) {
+      if (event.lazy) {
+        it->second.lazy_count++;
+      } else {
+        it->second.eager_count++;
+      }
+    }
+    batch_complete = RecordCliffLocked();
+  }
+  if (batch_complete) ReportCliffs(CliffReportMode::kDelayed);
+}
+
+void Recorder::ReportCliffsForTesting() {
+  ReportCliffs(CliffReportMode::kImmediately);
+}
+
+bool Recorder::RecordCliffLocked() {
+  base::TimeTicks now = base::TimeTicks::Now();
+  if (last_cliff_report_.IsNull()) last_cliff_report_ = now;
+  return ++cliffs_since_report_ >= FLAG_cliff_metrics_batch_size ||
+         (now - last_cliff_report_).InMilliseconds() >=
+             FLAG_cliff_metrics_batch_interval;
+}
+
+void Recorder::ReportCliffs(CliffReportMode mode) {
+  v8::metrics::JSMegamorphicTransitions transitions;
+  v8::metrics::JSDeoptimizationCounts deoptimizations;
+  {
+    base::MutexGuard lock_scope(&cliffs_lock_);
+    for (auto& entry : megamorphic_transitions_) {
+      v8::metrics::JSMegamorphicTransition transition;
+      transition.ic_type = std::get<0>(entry.first);
+      transition.property_name = std::get<1>(entry.first);
+      transition.map_count = std::get<2>(entry.first);
+      transition.count = entry.second;
+      transitions.transitions.push_back(std::move(transition));
+    }
+    transitions.dropped_count = dropped_megamorphic_transitions_;
+    for (auto& entry : deoptimizations_) {
+      v8::metrics::JSDeoptimizationCount deoptimization;
+      deoptimization.reason = std::get<0>(entry.first);
+      deoptimization.script_id = std::get<1>(entry.first);
+      deoptimization.function_position = std::get<2>(entry.first);
+      deoptimization.function_name = std::move(entry.second.function_name);
+      deoptimization.eager_count = entry.second.eager_count;
+      deoptimization.lazy_count = entry.second.lazy_count;
+      deoptimizations.deoptimizations.push_back(std::move(deoptimization));
+    }
+    deoptimizations.dropped_count = dropped_deoptimizations_;
+    megamorphic_transitions_.clear();
+    dropped_megamorphic_transitions_ = 0;
+    deoptimizations_.clear();
+    dropped_deoptimizations_ = 0;
+    cliffs_since_report_ = 0;
+    last_cliff_report_ = base::TimeTicks::Now();
+  }
+  // The counts are aggregated over all contexts of the isolate.
+  auto context_id = v8::metrics::Recorder::ContextId::Empty();
+  bool has_transitions = !transitions.transitions.empty() ||
+                         transitions.dropped_count != 0;
+  bool has_deoptimizations = !deoptimizations.deoptimizations.empty() ||
+                             deoptimizations.dropped_count != 0;
+  if (mode == CliffReportMode::kImmediately) {
+    if (has_transitions) AddMainThreadEvent(transitions, context_id);
+    if (has_deoptimizations) AddMainThreadEvent(deoptimizations, context_id);
+  } else {
+    // Cliffs are recorded in the middle of IC misses and deoptimizations,
+    // so the embedder is notified from a task.
+    if (has_transitions) DelayMainThreadEvent(transitions, context_id);
+    if (has_deoptimizations) DelayMainThreadEvent(deoptimizations, context_id);
+  }
+}
+
 void Recorder::Delay(std::unique_ptr<Recorder::DelayedEventBase>&& event) {
   base::MutexGuard lock_scope(&lock_);
   bool was_empty = delayed_events_.empty();
@@ -5,8 +5,11 @@
 #ifndef V8_LOGGING_METRICS_H_
 #define V8_LOGGING_METRICS_H_
 
+#include <map>
 #include <memory>
 #include <queue>
+#include <string>
+#include <tuple>
 
 #include "include/v8-metrics.h"
 #include "src/base/platform/mutex.h"
@@ -49,6 +52,19 @@ class Recorder : public std::enable_shared_from_this<Recorder> {
     if (embedder_recorder_) embedder_recorder_->AddThreadSafeEvent(event);
   }
 
+  // Megamorphic inline cache transitions and deoptimizations are counted in
+  // memory and reported together every --cliff-metrics-batch-size events, or
+  // with the first event after --cliff-metrics-batch-interval. This keeps the
+  // overhead low enough to find these performance cliffs in production.
+  V8_EXPORT_PRIVATE void AddMegamorphicTransition(const char* ic_type,
+                                                  std::string property_name,
+                                                  int map_count);
+  V8_EXPORT_PRIVATE void AddDeoptimization(
+      const v8::metrics::JSDeoptimization& event, int function_position,
+      std::string function_name);
+  // Reports the counts since the last report right away.
+  V8_EXPORT_PRIVATE void ReportCliffsForTesting();
+
  private:
   class DelayedEventBase {
    public:
@@ -77,6 +93,27 @@ class Recorder : public std::enable_shared_from_this<Recorder> {
   V8_EXPORT_PRIVATE void Delay(
       std::unique_ptr<Recorder::DelayedEventBase>&& event);
 
+  enum class CliffReportMode { kDelayed, kImmediately };
+  // Returns whether the current batch is complete.
+  bool RecordCliffLocked();
+  void ReportCliffs(CliffReportMode mode);
+
+  using MegamorphicTransitionKey = std::tuple<const char*, std::string, int>;
+  using DeoptimizationKey = std::tuple<const char*, int, int>;
+  struct DeoptimizationCounts {
+    std::string function_name;
+    int64_t eager_count = 0;
+    int64_t lazy_count = 0;
+  };
+
+  base::Mutex cliffs_lock_;
+  std::map<MegamorphicTransitionKey, int64_t> megamorphic_transitions_;
+  int64_t dropped_megamorphic_transitions_ = 0;
+  std::map<DeoptimizationKey, DeoptimizationCounts> deoptimizations_;
+  int64_t dropped_deoptimizations_ = 0;
+  int cliffs_since_report_ = 0;
+  base::TimeTicks last_cliff_report_;
+
   base::Mutex lock_;
   std::shared_ptr<v8::TaskRunner> foreground_task_runner_;
   std::shared_ptr<v8::metrics::Recorder> embedder_recorder_;
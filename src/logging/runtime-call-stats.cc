@@ -8,6 +8,9 @@
 
 #include <iomanip>
 
+#include "src/execution/isolate.h"
+#include "src/logging/counters.h"
+#include "src/logging/metrics.h"
 #include "src/tracing/tracing-category-observer.h"
 #include "src/utils/ostreams.h"
 
@@ -364,6 +367,129 @@ WorkerThreadRuntimeCallStatsScope::~WorkerThreadRuntimeCallStatsScope() {
   }
 }
 
+class RuntimeCallStatsSampler::SamplerThread final : public base::Thread {
+ public:
+  explicit SamplerThread(RuntimeCallStatsSampler* sampler)
+      : Thread(Options("v8:RuntimeCallStatsSampler")), sampler_(sampler) {}
+
+  void Run() override {
+    base::TimeTicks next_report =
+        base::TimeTicks::Now() + sampler_->report_interval_;
+    while (true) {
+      v8::metrics::RuntimeCallStatsSample event;
+      {
+        base::MutexGuard guard(&sampler_->mutex_);
+        if (sampler_->stopping_) return;
+        // Spurious wake-ups only cause an early sample.
+        if (sampler_->stop_cond_.WaitFor(&sampler_->mutex_,
+                                         sampler_->interval_) ||
+            sampler_->stopping_) {
+          return;
+        }
+        sampler_->SampleLocked();
+        base::TimeTicks now = base::TimeTicks::Now();
+        if (now < next_report) continue;
+        next_report = now + sampler_->report_interval_;
+        event = sampler_->TakeSamplesLocked();
+      }
+      sampler_->Report(event);
+    }
+  }
+
+ private:
+  RuntimeCallStatsSampler* const sampler_;
+};
+
+RuntimeCallStatsSampler::RuntimeCallStatsSampler(
+    Isolate* isolate, base::TimeDelta interval,
+    base::TimeDelta report_interval)
+    : isolate_(isolate),
+      interval_(interval),
+      report_interval_(report_interval),
+      main_thread_samples_(RuntimeCallStats::kNumberOfCounters),
+      background_samples_(RuntimeCallStats::kNumberOfCounters) {}
+
+RuntimeCallStatsSampler::~RuntimeCallStatsSampler() { Stop(); }
+
+bool RuntimeCallStatsSampler::Start() {
+  DCHECK(!thread_);
+  thread_ = std::make_unique<SamplerThread>(this);
+  return thread_->Start();
+}
+
+void RuntimeCallStatsSampler::Stop() {
+  if (!thread_) return;
+  v8::metrics::RuntimeCallStatsSample event;
+  {
+    base::MutexGuard guard(&mutex_);
+    stopping_ = true;
+    stop_cond_.NotifyOne();
+  }
+  thread_->Join();
+  thread_.reset();
+  {
+    base::MutexGuard guard(&mutex_);
+    event = TakeSamplesLocked();
+  }
+  Report(event);
+}
+
+void RuntimeCallStatsSampler::SampleForTesting() {
+  base::MutexGuard guard(&mutex_);
+  SampleLocked();
+}
+
+void RuntimeCallStatsSampler::ReportForTesting() {
+  v8::metrics::RuntimeCallStatsSample event;
+  {
+    base::MutexGuard guard(&mutex_);
+    event = TakeSamplesLocked();
+  }
+  Report(event);
+}
+
+void RuntimeCallStatsSampler::SampleLocked() {
+  RuntimeCallStats* main_stats = isolate_->counters()->runtime_call_stats();
+  main_thread_sample_count_++;
+  if (RuntimeCallCounter* counter = main_stats->current_counter()) {
+    main_thread_samples_[main_stats->GetCounterId(counter)]++;
+  }
+  // Idle worker threads have no active counter, so only busy ones are
+  // sampled.
+  isolate_->counters()->worker_thread_runtime_call_stats()->ForEachTable(
+      [this](RuntimeCallStats* worker_stats) {
+        if (RuntimeCallCounter* counter = worker_stats->current_counter()) {
+          background_samples_[worker_stats->GetCounterId(counter)]++;
+        }
+      });
+}
+
+v8::metrics::RuntimeCallStatsSample
+RuntimeCallStatsSampler::TakeSamplesLocked() {
+  RuntimeCallStats* main_stats = isolate_->counters()->runtime_call_stats();
+  v8::metrics::RuntimeCallStatsSample event;
+  event.sampling_interval_in_us = interval_.InMicroseconds();
+  event.main_thread_sample_count = main_thread_sample_count_;
+  main_thread_sample_count_ = 0;
+  for (int i = 0; i < RuntimeCallStats::kNumberOfCounters; i++) {
+    if (main_thread_samples_[i] == 0 && background_samples_[i] == 0) continue;
+    v8::metrics::RuntimeCallStatsSampleEntry entry;
+    entry.name = main_stats->GetCounter(i)->name();
+    entry.main_thread_samples = main_thread_samples_[i];
+    entry.background_samples = background_samples_[i];
+    event.entries.push_back(entry);
+    main_thread_samples_[i] = 0;
+    background_samples_[i] = 0;
+  }
+  return event;
+}
+
+void RuntimeCallStatsSampler::Report(
+    const v8::metrics::RuntimeCallStatsSample& event) {
+  if (event.main_thread_sample_count == 0 && event.entries.empty()) return;
+  isolate_->metrics_recorder()->AddThreadSafeEvent(event);
+}
+
 }  // namespace internal
 }  // namespace v8
 
@@ -9,9 +9,13 @@
 
 #ifdef V8_RUNTIME_CALL_STATS
 
+#include "include/v8-metrics.h"
 #include "src/base/atomic-utils.h"
 #include "src/base/optional.h"
+#include "src/base/platform/condition-variable.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
 #include "src/builtins/builtins-definitions.h"
 #include "src/debug/debug-interface.h"
@@ -29,6 +33,8 @@ namespace internal {
 
 #ifdef V8_RUNTIME_CALL_STATS
 
+class Isolate;
+
 class RuntimeCallCounter final {
  public:
   RuntimeCallCounter() : RuntimeCallCounter(nullptr) {}
@@ -259,6 +265,7 @@ class RuntimeCallTimer final {
   V(SharedArrayBuffer_New)                                 \
   V(SharedArrayBuffer_NewBackingStore)                     \
   V(String_Concat)                                         \
+  V(String_NewExternalFromUtf8)                            \
   V(String_NewExternalOneByte)                             \
   V(String_NewExternalTwoByte)                             \
   V(String_NewFromOneByte)                                 \
@@ -637,6 +644,10 @@ class RuntimeCallStats final {
   RuntimeCallCounter* GetCounter(int counter_id) {
     return &counters_[counter_id];
   }
+  int GetCounterId(RuntimeCallCounter* counter) {
+    DCHECK(counter >= counters_ && counter < counters_ + kNumberOfCounters);
+    return static_cast<int>(counter - counters_);
+  }
 
  private:
   // Top of a stack of active timers.
@@ -665,6 +676,14 @@ class WorkerThreadRuntimeCallStats final {
   // Adds the counters from the worker thread tables to |main_call_stats|.
   void AddToMainTable(RuntimeCallStats* main_call_stats);
 
+  // Calls |callback| for each worker thread table. The tables may be in use
+  // on their threads, so only their atomic fields may be read.
+  template <typename Callback>
+  void ForEachTable(Callback callback) {
+    base::MutexGuard lock(&mutex_);
+    for (auto& worker_stats : tables_) callback(worker_stats.get());
+  }
+
  private:
   base::Mutex mutex_;
   std::vector<std::unique_ptr<RuntimeCallStats>> tables_;
@@ -690,6 +709,50 @@ class V8_NODISCARD WorkerThreadRuntimeCallStatsScope final {
   RuntimeCallStats* table_;
 };
 
+// Samples the counters that are active on the isolate's main thread and on
+// its worker threads at a fixed interval from a separate thread, like a stack
+// sampler does for the stack. With --runtime-call-stats-sampling the timer
+// scopes only maintain the active counter and never read the clock, which
+// keeps the overhead low enough for production. The samples are aggregated
+// per isolate and reported as v8::metrics::RuntimeCallStatsSample events.
+class RuntimeCallStatsSampler final {
+ public:
+  RuntimeCallStatsSampler(Isolate* isolate, base::TimeDelta interval,
+                          base::TimeDelta report_interval);
+  ~RuntimeCallStatsSampler();
+  RuntimeCallStatsSampler(const RuntimeCallStatsSampler&) = delete;
+  RuntimeCallStatsSampler& operator=(const RuntimeCallStatsSampler&) = delete;
+
+  V8_EXPORT_PRIVATE bool Start();
+  // Stops the sampler thread and reports the remaining samples.
+  V8_EXPORT_PRIVATE void Stop();
+
+  // Takes a sample of all threads right away.
+  V8_EXPORT_PRIVATE void SampleForTesting();
+  // Reports the samples taken since the last report right away.
+  V8_EXPORT_PRIVATE void ReportForTesting();
+
+ private:
+  class SamplerThread;
+
+  void SampleLocked();
+  v8::metrics::RuntimeCallStatsSample TakeSamplesLocked();
+  void Report(const v8::metrics::RuntimeCallStatsSample& event);
+
+  Isolate* const isolate_;
+  const base::TimeDelta interval_;
+  const base::TimeDelta report_interval_;
+  std::unique_ptr<SamplerThread> thread_;
+
+  // Guards all fields below.
+  base::Mutex mutex_;
+  base::ConditionVariable stop_cond_;
+  bool stopping_ = false;
+  int64_t main_thread_sample_count_ = 0;
+  std::vector<int64_t> main_thread_samples_;
+  std::vector<int64_t> background_samples_;
+};
+
 #define CHANGE_CURRENT_RUNTIME_COUNTER(runtime_call_stats, counter_id) \
   do {                                                                 \
     if (V8_UNLIKELY(TracingFlags::is_runtime_stats_enabled()) &&       \
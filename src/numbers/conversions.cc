@@ -7,7 +7,9 @@
 #include <limits.h>
 #include <stdarg.h>
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "src/base/platform/wrappers.h"
 #include "src/common/assert-scope.h"
@@ -903,6 +905,7 @@ class StringToBigIntHelper : public StringToIntHelper<IsolateT> {
       case State::kZero:
         return BigInt::Zero(this->isolate(), allocation_type());
       case State::kDone:
+        if (!parts_.empty() && !CombineParts()) return MaybeHandle<BigInt>();
         return BigInt::Finalize<Isolate>(result_, this->negative());
       case State::kEmpty:
       case State::kRunning:
@@ -924,15 +927,30 @@ class StringToBigIntHelper : public StringToIntHelper<IsolateT> {
     if (!maybe.ToHandle(&result_)) {
       this->set_state(State::kError);
     }
+    collect_parts_ = ShouldCollectParts(charcount);
   }
 
   void ResultMultiplyAdd(uint32_t multiplier, uint32_t part) override {
+    if (collect_parts_) {
+      // All parts except the last one have the same multiplier.
+      DCHECK(parts_.empty() || last_multiplier_ == part_multiplier_);
+      if (parts_.empty()) part_multiplier_ = multiplier;
+      parts_.push_back(part);
+      last_multiplier_ = multiplier;
+      return;
+    }
     BigInt::InplaceMultiplyAdd(*result_, static_cast<uintptr_t>(multiplier),
                                static_cast<uintptr_t>(part));
   }
 
   bool CheckTermination() override;
 
+  // Multiply-adding each part into the result takes quadratic time. For long
+  // strings, the parts are collected first and then combined with the
+  // bigint::Processor's divide-and-conquer algorithm.
+  bool ShouldCollectParts(int charcount);
+  bool CombineParts();
+
   AllocationType allocation_type() {
     // For literals, we pretenure the allocated BigInt, since it's about
     // to be stored in the interpreter's constants array.
@@ -943,6 +961,11 @@ class StringToBigIntHelper : public StringToIntHelper<IsolateT> {
  private:
   Handle<FreshlyAllocatedBigInt> result_;
   Behavior behavior_;
+  bool collect_parts_ = false;
+  // The parts, most significant first.
+  std::vector<uintptr_t> parts_;
+  uint32_t part_multiplier_ = 0;
+  uint32_t last_multiplier_ = 0;
 };
 
 template <typename IsolateT>
@@ -950,6 +973,37 @@ bool StringToBigIntHelper<IsolateT>::CheckTermination() {
   return false;
 }
 
+template <typename IsolateT>
+bool StringToBigIntHelper<IsolateT>::ShouldCollectParts(int charcount) {
+  return false;
+}
+
+template <>
+bool StringToBigIntHelper<Isolate>::ShouldCollectParts(int charcount) {
+  static constexpr int kCollectPartsThreshold = 1000;
+  return charcount >= kCollectPartsThreshold;
+}
+
+template <typename IsolateT>
+bool StringToBigIntHelper<IsolateT>::CombineParts() {
+  UNREACHABLE();
+}
+
+template <>
+bool StringToBigIntHelper<Isolate>::CombineParts() {
+  // The last part can be shorter than the others, so add it separately.
+  uintptr_t last_part = parts_.back();
+  parts_.pop_back();
+  std::reverse(parts_.begin(), parts_.end());
+  if (!BigInt::InplaceFromParts(isolate(), *result_, parts_.data(),
+                                static_cast<int>(parts_.size()),
+                                part_multiplier_)) {
+    return false;
+  }
+  BigInt::InplaceMultiplyAdd(*result_, last_multiplier_, last_part);
+  return true;
+}
+
 template <>
 bool StringToBigIntHelper<Isolate>::CheckTermination() {
   StackLimitCheck interrupt_check(isolate());
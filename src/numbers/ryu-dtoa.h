@@ -0,0 +1,38 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_NUMBERS_RYU_DTOA_H_
+#define V8_NUMBERS_RYU_DTOA_H_
+
+#include "src/base/vector.h"
+
+namespace v8 {
+namespace internal {
+
+// RyuDtoa will produce at most kRyuDtoaMaximalLength digits. This does not
+// include the terminating '\0' character.
+const int kRyuDtoaMaximalLength = 17;
+
+// Computes the shortest decimal representation of v with Ulf Adams' Ryu
+// algorithm ("Ryu: fast float-to-string conversion", PLDI 2018).
+// The result should be interpreted as buffer * 10^(point - length).
+//
+// Precondition:
+//   * v must be a strictly positive finite double.
+//
+// Unlike FastDtoa, this always succeeds: the result satisfies
+//     v == (double) (buffer * 10^(point - length)),
+// the digits in the buffer are the shortest representation possible, and of
+// all representations of that length, the buffer holds the one closest to v
+// (the one with an even last digit if two are equally close).
+// There will be *length digits inside the buffer followed by a null
+// terminator. The buffer must have room for kRyuDtoaMaximalLength + 1
+// characters.
+V8_EXPORT_PRIVATE void RyuDtoa(double v, base::Vector<char> buffer,
+                               int* length, int* decimal_point);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_NUMBERS_RYU_DTOA_H_
@@ -4,11 +4,13 @@
 
 #include "src/objects/backing-store.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "src/base/platform/wrappers.h"
 #include "src/execution/isolate.h"
 #include "src/handles/global-handles.h"
+#include "src/heap/array-buffer-pool.h"
 #include "src/logging/counters.h"
 
 #if V8_ENABLE_WEBASSEMBLY
@@ -216,7 +218,12 @@ BackingStore::~BackingStore() {
     auto allocator = get_v8_api_array_buffer_allocator();
     TRACE_BS("BS:free   bs=%p mem=%p (length=%zu, capacity=%zu)\n", this,
              buffer_start_, byte_length(), byte_capacity_);
-    allocator->Free(buffer_start_, byte_length_);
+    if (pool_) {
+      pool_->Release(buffer_start_, byte_length_);
+      pool_.reset();
+    } else {
+      allocator->Free(buffer_start_, byte_length_);
+    }
   }
   Clear();
 }
@@ -226,6 +233,7 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
     Isolate* isolate, size_t byte_length, SharedFlag shared,
     InitializedFlag initialized) {
   void* buffer_start = nullptr;
+  std::shared_ptr<ArrayBufferPool> pool_for_result;
   auto allocator = isolate->array_buffer_allocator();
   CHECK_NOT_NULL(allocator);
   if (byte_length != 0) {
@@ -237,7 +245,13 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
     if (shared == SharedFlag::kShared) {
       counters->shared_array_allocations()->AddSample(mb_length);
     }
-    auto allocate_buffer = [allocator, initialized](size_t byte_length) {
+    std::shared_ptr<ArrayBufferPool> pool =
+        ArrayBufferPool::CanPool(byte_length)
+            ? isolate->heap()->array_buffer_pool()
+            : nullptr;
+    auto allocate_buffer = [allocator, initialized,
+                            &pool](size_t byte_length) {
+      if (pool) return pool->Allocate(byte_length, initialized);
       if (initialized == InitializedFlag::kUninitialized) {
         return allocator->AllocateUninitialized(byte_length);
       }
@@ -263,6 +277,7 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
       counters->array_buffer_new_size_failures()->AddSample(mb_length);
       return {};
     }
+    pool_for_result = std::move(pool);
   }
 
   auto result = new BackingStore(buffer_start,                  // start
@@ -279,6 +294,7 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
   TRACE_BS("BS:alloc  bs=%p mem=%p (length=%zu)\n", result,
            result->buffer_start(), byte_length);
   result->SetAllocatorFromIsolate(isolate);
+  result->pool_ = std::move(pool_for_result);
   return std::unique_ptr<BackingStore>(result);
 }
 
@@ -497,13 +513,17 @@ std::unique_ptr<BackingStore> BackingStore::AllocateWasmMemory(
 }
 
 std::unique_ptr<BackingStore> BackingStore::CopyWasmMemory(Isolate* isolate,
-                                                           size_t new_pages) {
+                                                           size_t new_pages,
+                                                           size_t max_pages) {
+  DCHECK_LE(new_pages, max_pages);
   // Note that we could allocate uninitialized to save initialization cost here,
   // but since Wasm memories are allocated by the page allocator, the zeroing
   // cost is already built-in.
-  // TODO(titzer): should we use a suitable maximum here?
+  // Reserve up to {max_pages}, so that subsequent grows do not need to copy
+  // again. {AllocateWasmMemory} falls back to smaller reservations if the
+  // address space is not available.
   auto new_backing_store = BackingStore::AllocateWasmMemory(
-      isolate, new_pages, new_pages,
+      isolate, new_pages, max_pages,
       is_shared() ? SharedFlag::kShared : SharedFlag::kNotShared);
 
   if (!new_backing_store ||
@@ -764,8 +784,23 @@ bool BackingStore::Reallocate(Isolate* isolate, size_t new_byte_length) {
   auto allocator = get_v8_api_array_buffer_allocator();
   CHECK_EQ(isolate->array_buffer_allocator(), allocator);
   CHECK_EQ(byte_length_, byte_capacity_);
-  void* new_start =
-      allocator->Reallocate(buffer_start_, byte_length_, new_byte_length);
+  void* new_start;
+  if (pool_) {
+    // Pooled buffers are not owned by the embedder's allocator, so the
+    // contents have to be moved to a fresh allocation.
+    new_start = allocator->AllocateUninitialized(new_byte_length);
+    if (!new_start) return false;
+    memcpy(new_start, buffer_start_, std::min(byte_length(), new_byte_length));
+    if (new_byte_length > byte_length()) {
+      memset(static_cast<uint8_t*>(new_start) + byte_length(), 0,
+             new_byte_length - byte_length());
+    }
+    pool_->Release(buffer_start_, byte_length_);
+    pool_.reset();
+  } else {
+    new_start =
+        allocator->Reallocate(buffer_start_, byte_length_, new_byte_length);
+  }
   if (!new_start) return false;
   buffer_start_ = new_start;
   byte_capacity_ = new_byte_length;
@@ -15,6 +15,7 @@
 namespace v8 {
 namespace internal {
 
+class ArrayBufferPool;
 class Isolate;
 class WasmMemoryObject;
 
@@ -114,9 +115,11 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
                                                size_t max_pages);
 
   // Allocate a new, larger, backing store for this Wasm memory and copy the
-  // contents of this backing store into it.
+  // contents of this backing store into it. The new backing store reserves up
+  // to {max_pages}, such that it can later grow in place.
   std::unique_ptr<BackingStore> CopyWasmMemory(Isolate* isolate,
-                                               size_t new_pages);
+                                               size_t new_pages,
+                                               size_t max_pages);
 
   // Attach the given memory object to this backing store. The memory object
   // will be updated if this backing store is grown.
@@ -223,6 +226,10 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
     DeleterInfo deleter;
   } type_specific_data_;
 
+  // Set if the memory was handed out by the heap's ArrayBufferPool, which it
+  // is returned to on destruction instead of the embedder's allocator.
+  std::shared_ptr<ArrayBufferPool> pool_;
+
   bool is_shared_ : 1;
   // Backing stores for (Resizable|GrowableShared)ArrayBuffer
   bool is_resizable_ : 1;
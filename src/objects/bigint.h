@@ -257,6 +257,12 @@ class BigInt : public BigIntBase {
       AllocationType allocation);
   static void InplaceMultiplyAdd(FreshlyAllocatedBigInt x, uintptr_t factor,
                                  uintptr_t summand);
+  // Sets {x} to sum(parts[i] * multiplier^i). This is faster than calling
+  // {InplaceMultiplyAdd} for each part when there are many of them.
+  // Returns false if execution is being terminated.
+  static bool InplaceFromParts(Isolate* isolate, FreshlyAllocatedBigInt x,
+                               uintptr_t* parts, int num_parts,
+                               uintptr_t multiplier);
   template <typename IsolateT>
   static Handle<BigInt> Finalize(Handle<FreshlyAllocatedBigInt> x, bool sign);
 
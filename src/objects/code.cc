@@ -721,6 +721,10 @@ bool BytecodeArray::IsOld() const {
   return bytecode_age() >= kIsOldBytecodeAge;
 }
 
+bool BytecodeArray::IsOldForMemoryReduction() const {
+  return bytecode_age() >= kIsOldBytecodeAgeForMemoryReduction;
+}
+
 DependentCode DependentCode::GetDependentCode(Handle<HeapObject> object) {
   if (object->IsMap()) {
     return Handle<Map>::cast(object)->dependent_code();
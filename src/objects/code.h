@@ -828,7 +828,8 @@ class BytecodeArray : public FixedArrayBase {
     kFirstBytecodeAge = kNoAgeBytecodeAge,
     kLastBytecodeAge = kAfterLastBytecodeAge - 1,
     kBytecodeAgeCount = kAfterLastBytecodeAge - kFirstBytecodeAge - 1,
-    kIsOldBytecodeAge = kSexagenarianBytecodeAge
+    kIsOldBytecodeAge = kSexagenarianBytecodeAge,
+    kIsOldBytecodeAgeForMemoryReduction = kQuadragenarianBytecodeAge
   };
 
   static constexpr int SizeFor(int length) {
@@ -916,6 +917,8 @@ class BytecodeArray : public FixedArrayBase {
 
   // Bytecode aging
   V8_EXPORT_PRIVATE bool IsOld() const;
+  // Like IsOld(), but with the lower age threshold of memory-reducing GCs.
+  V8_EXPORT_PRIVATE bool IsOldForMemoryReduction() const;
   V8_EXPORT_PRIVATE void MakeOlder();
 
   // Clear uninitialized padding space. This ensures that the snapshot content
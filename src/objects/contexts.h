@@ -317,6 +317,8 @@ enum ContextLookupFlags {
   V(MAP_GET_INDEX, JSFunction, map_get)                                        \
   V(MAP_HAS_INDEX, JSFunction, map_has)                                        \
   V(MAP_SET_INDEX, JSFunction, map_set)                                        \
+  V(FINALIZATION_REGISTRY_CLEANUP_SLICE, JSFunction,                           \
+    finalization_registry_cleanup_slice)                                       \
   V(FINALIZATION_REGISTRY_CLEANUP_SOME, JSFunction,                            \
     finalization_registry_cleanup_some)                                        \
   V(FUNCTION_HAS_INSTANCE_INDEX, JSFunction, function_has_instance)            \
@@ -344,7 +346,8 @@ enum ContextLookupFlags {
   V(WEAKMAP_DELETE_INDEX, JSFunction, weakmap_delete)                          \
   V(WEAKSET_ADD_INDEX, JSFunction, weakset_add)                                \
   V(RETAINED_MAPS, WeakArrayList, retained_maps)                               \
-  V(OSR_CODE_CACHE_INDEX, WeakFixedArray, osr_code_cache)
+  V(OSR_CODE_CACHE_INDEX, WeakFixedArray, osr_code_cache)                     \
+  V(PROXY_TRAP_CACHE_INDEX, WeakFixedArray, proxy_trap_cache)
 
 #include "torque-generated/src/objects/contexts-tq.inc"
 
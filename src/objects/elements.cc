@@ -347,6 +347,25 @@ void CopyDoubleToDoubleElements(FixedArrayBase from_base, uint32_t from_start,
 #endif
 }
 
+// Converts {count} Smis or holes starting at {from_start} into doubles or
+// double holes. This works on the raw tagged values, without the checks of
+// FixedArray::get and FixedDoubleArray::set, so that the loop is simple enough
+// for the compiler to vectorize.
+void ConvertSmiToDoubleElements(FixedArray from, uint32_t from_start,
+                                FixedDoubleArray to, uint32_t to_start,
+                                uint32_t count) {
+  const Tagged_t* source = from.RawFieldOfElementAt(from_start).location();
+  Address destination =
+      to.address() + FixedDoubleArray::OffsetOfElementAt(to_start);
+  for (uint32_t i = 0; i < count; i++) {
+    Tagged_t raw = source[i];
+    double value = Internals::SmiValue(static_cast<Address>(raw));
+    uint64_t bits =
+        HAS_SMI_TAG(raw) ? bit_cast<uint64_t>(value) : kHoleNanInt64;
+    base::WriteUnalignedValue<uint64_t>(destination + kDoubleSize * i, bits);
+  }
+}
+
 void CopySmiToDoubleElements(FixedArrayBase from_base, uint32_t from_start,
                              FixedArrayBase to_base, uint32_t to_start,
                              int raw_copy_size) {
@@ -362,18 +381,9 @@ void CopySmiToDoubleElements(FixedArrayBase from_base, uint32_t from_start,
   DCHECK((copy_size + static_cast<int>(to_start)) <= to_base.length() &&
          (copy_size + static_cast<int>(from_start)) <= from_base.length());
   if (copy_size == 0) return;
-  FixedArray from = FixedArray::cast(from_base);
-  FixedDoubleArray to = FixedDoubleArray::cast(to_base);
-  Object the_hole = from.GetReadOnlyRoots().the_hole_value();
-  for (uint32_t from_end = from_start + static_cast<uint32_t>(copy_size);
-       from_start < from_end; from_start++, to_start++) {
-    Object hole_or_smi = from.get(from_start);
-    if (hole_or_smi == the_hole) {
-      to.set_the_hole(to_start);
-    } else {
-      to.set(to_start, Smi::ToInt(hole_or_smi));
-    }
-  }
+  ConvertSmiToDoubleElements(FixedArray::cast(from_base), from_start,
+                             FixedDoubleArray::cast(to_base), to_start,
+                             static_cast<uint32_t>(copy_size));
 }
 
 void CopyPackedSmiToDoubleElements(FixedArrayBase from_base,
@@ -398,14 +408,9 @@ void CopyPackedSmiToDoubleElements(FixedArrayBase from_base,
   DCHECK((copy_size + static_cast<int>(to_start)) <= to_base.length() &&
          (copy_size + static_cast<int>(from_start)) <= from_base.length());
   if (copy_size == 0) return;
-  FixedArray from = FixedArray::cast(from_base);
-  FixedDoubleArray to = FixedDoubleArray::cast(to_base);
-  for (uint32_t from_end = from_start + static_cast<uint32_t>(packed_size);
-       from_start < from_end; from_start++, to_start++) {
-    Object smi = from.get(from_start);
-    DCHECK(!smi.IsTheHole());
-    to.set(to_start, Smi::ToInt(smi));
-  }
+  ConvertSmiToDoubleElements(FixedArray::cast(from_base), from_start,
+                             FixedDoubleArray::cast(to_base), to_start,
+                             static_cast<uint32_t>(packed_size));
 }
 
 void CopyObjectToDoubleElements(FixedArrayBase from_base, uint32_t from_start,
@@ -152,6 +152,37 @@ void ToUpperWithSharpS(const base::Vector<const Char>& src,
   }
 }
 
+// Upper-cases a Latin-1 string that contains U+00B5 or U+00FF, whose upper
+// case forms (U+039C and U+0178) are beyond the Latin-1 range, into a
+// two-byte string without going through ICU.
+template <typename Char>
+void ToUpperLatin1ToTwoByte(const base::Vector<const Char>& src,
+                            Handle<SeqTwoByteString> result) {
+  int32_t dest_index = 0;
+  for (auto it = src.begin(); it != src.end(); ++it) {
+    uint16_t ch = static_cast<uint16_t>(*it);
+    if (ch == sharp_s) {
+      result->SeqTwoByteStringSet(dest_index++, 'S');
+      result->SeqTwoByteStringSet(dest_index++, 'S');
+    } else if (ch == 0xB5) {
+      result->SeqTwoByteStringSet(dest_index++, 0x39C);
+    } else if (ch == 0xFF) {
+      result->SeqTwoByteStringSet(dest_index++, 0x178);
+    } else {
+      result->SeqTwoByteStringSet(dest_index++, ToLatin1Upper(ch));
+    }
+  }
+}
+
+template <typename Char>
+int CountSharpS(const base::Vector<const Char>& src) {
+  int count = 0;
+  for (auto it = src.begin(); it != src.end(); ++it) {
+    if (static_cast<uint16_t>(*it) == sharp_s) ++count;
+  }
+  return count;
+}
+
 inline int FindFirstUpperOrNonAscii(String s, int length) {
   for (int index = 0; index < length; ++index) {
     uint16_t ch = s.Get(index);
@@ -391,10 +422,29 @@ MaybeHandle<String> Intl::ConvertToUpper(Isolate* isolate, Handle<String> s) {
       }
     }
 
-    // Go to the full Unicode path if there are characters whose uppercase
-    // is beyond the Latin-1 range (cannot be represented in OneByteString).
+    // There are characters whose uppercase is beyond the Latin-1 range
+    // (cannot be represented in OneByteString). Their mappings are fixed in
+    // the root locale, so produce a TwoByteString without calling into ICU.
     if (V8_UNLIKELY(!is_result_single_byte)) {
-      return LocaleConvertCase(isolate, s, true, "");
+      {
+        DisallowGarbageCollection no_gc;
+        String::FlatContent flat = s->GetFlatContent(no_gc);
+        sharp_s_count = flat.IsOneByte() ? CountSharpS(flat.ToOneByteVector())
+                                         : CountSharpS(flat.ToUC16Vector());
+      }
+      Handle<SeqTwoByteString> two_byte_result;
+      ASSIGN_RETURN_ON_EXCEPTION(
+          isolate, two_byte_result,
+          isolate->factory()->NewRawTwoByteString(length + sharp_s_count),
+          String);
+      DisallowGarbageCollection no_gc;
+      String::FlatContent flat = s->GetFlatContent(no_gc);
+      if (flat.IsOneByte()) {
+        ToUpperLatin1ToTwoByte(flat.ToOneByteVector(), two_byte_result);
+      } else {
+        ToUpperLatin1ToTwoByte(flat.ToUC16Vector(), two_byte_result);
+      }
+      return two_byte_result;
     }
 
     if (sharp_s_count == 0) return result;
@@ -166,6 +166,15 @@ CodeKind JSFunction::NextTier() const {
     return CodeKind::TURBOFAN;
   } else if (V8_UNLIKELY(FLAG_turboprop)) {
     DCHECK(ActiveTierIsIgnitionOrBaseline());
+    // Only small functions take the cheap mid-tier first. Larger functions
+    // tier up straight to TurboFan with the regular interrupt budget, unless
+    // Turboprop is the only optimizing tier.
+    if (FLAG_turboprop_max_bytecode_size > 0 && !FLAG_turboprop_as_toptier &&
+        shared().HasBytecodeArray() &&
+        shared().GetBytecodeArray(GetIsolate()).length() >
+            FLAG_turboprop_max_bytecode_size) {
+      return CodeKind::TURBOFAN;
+    }
     return CodeKind::TURBOPROP;
   }
   return CodeKind::TURBOFAN;
@@ -330,6 +339,7 @@ void JSFunction::EnsureFeedbackVector(Handle<JSFunction> function,
          isolate->heap()->many_closures_cell());
   function->raw_feedback_cell().set_value(*feedback_vector, kReleaseStore);
   function->SetInterruptBudget();
+  shared->set_has_allocated_feedback_vector(true);
 }
 
 // static
@@ -363,7 +373,11 @@ void JSFunction::InitializeFeedbackCell(
       // We also need a feedback vector for certain log events, collecting type
       // profile and more precise code coverage.
       FLAG_log_function_events || !isolate->is_best_effort_code_coverage() ||
-      isolate->is_collecting_type_profile();
+      isolate->is_collecting_type_profile() ||
+      // Closures of a function whose feedback has already warmed up elsewhere
+      // skip the lazy allocation budget.
+      (FLAG_lazy_feedback_allocation_per_sfi &&
+       function->shared().has_allocated_feedback_vector());
 
   if (needs_feedback_vector) {
     EnsureFeedbackVector(function, is_compiled_scope);
@@ -8,9 +8,14 @@
 
 #include "src/objects/js-number-format.h"
 
+#include <list>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/execution/isolate.h"
 #include "src/objects/intl-objects.h"
 #include "src/objects/js-number-format-inl.h"
@@ -814,6 +819,67 @@ MaybeHandle<JSNumberFormat> JSNumberFormat::UnwrapNumberFormat(
   return Handle<JSNumberFormat>::cast(object);
 }
 
+namespace {
+
+// A process-wide cache of ICU number formatters, keyed by locale and
+// skeleton. LocalizedNumberFormatter is immutable and thread-safe, so the
+// formatters are shared by all JSNumberFormat objects with the same settings
+// in all isolates, and ICU builds the internal data for formatting (which
+// is much more expensive than creating the formatter) only once per entry.
+// The least recently used entry is evicted when the cache is full.
+class NumberFormatterCache {
+ public:
+  using Formatter = icu::number::LocalizedNumberFormatter;
+
+  std::shared_ptr<Formatter> Get(const icu::Locale& icu_locale,
+                                 const Formatter& formatter) {
+    UErrorCode status = U_ZERO_ERROR;
+    icu::UnicodeString skeleton = formatter.toSkeleton(status);
+    // Not all settings can be expressed in a skeleton; formatters with such
+    // settings are not cached.
+    if (U_FAILURE(status)) return std::make_shared<Formatter>(formatter);
+    std::string key;
+    skeleton.toUTF8String<std::string>(key);
+    key += ":";
+    key += icu_locale.getName();
+
+    base::MutexGuard guard(&mutex_);
+    auto it = map_.find(key);
+    if (it != map_.end()) {
+      lru_.splice(lru_.begin(), lru_, it->second.second);
+      return it->second.first;
+    }
+    if (map_.size() >= kMaxSize) {
+      map_.erase(lru_.back());
+      lru_.pop_back();
+    }
+    auto instance = std::make_shared<Formatter>(formatter);
+    lru_.push_front(key);
+    map_.emplace(std::move(key), std::make_pair(instance, lru_.begin()));
+    return instance;
+  }
+
+ private:
+  static constexpr size_t kMaxSize = 64;
+
+  // Keys, most recently used first.
+  std::list<std::string> lru_;
+  std::unordered_map<std::string, std::pair<std::shared_ptr<Formatter>,
+                                            std::list<std::string>::iterator>>
+      map_;
+  base::Mutex mutex_;
+};
+
+std::shared_ptr<icu::number::LocalizedNumberFormatter> GetCachedNumberFormatter(
+    const icu::Locale& icu_locale,
+    const icu::number::LocalizedNumberFormatter& formatter) {
+  static base::LazyInstance<NumberFormatterCache>::type cache =
+      LAZY_INSTANCE_INITIALIZER;
+  return cache.Pointer()->Get(icu_locale, formatter);
+}
+
+}  // namespace
+
 // static
 MaybeHandle<JSNumberFormat> JSNumberFormat::New(Isolate* isolate,
                                                 Handle<Map> map,
@@ -1198,9 +1264,9 @@ MaybeHandle<JSNumberFormat> JSNumberFormat::New(Isolate* isolate,
   //
   Handle<Managed<icu::number::LocalizedNumberFormatter>>
       managed_number_formatter =
-          Managed<icu::number::LocalizedNumberFormatter>::FromRawPtr(
+          Managed<icu::number::LocalizedNumberFormatter>::FromSharedPtr(
               isolate, 0,
-              new icu::number::LocalizedNumberFormatter(icu_number_formatter));
+              GetCachedNumberFormatter(icu_locale, icu_number_formatter));
 
   // Now all properties are ready, so we can allocate the result object.
   Handle<JSNumberFormat> number_format = Handle<JSNumberFormat>::cast(
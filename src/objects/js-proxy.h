@@ -74,6 +74,18 @@ class JSProxy : public TorqueGeneratedJSProxy<JSProxy, JSReceiver> {
 
   enum AccessKind { kGet, kSet };
 
+  // Entries of the native context's proxy_trap_cache. Each entry holds a weak
+  // reference to a handler map and the descriptor index of the trap in it.
+  enum TrapCacheEntry {
+    kGetTrapCacheEntry,
+    kHasTrapCacheEntry,
+    kSetTrapCacheEntry,
+    kTrapCacheEntryCount
+  };
+  static const int kTrapCacheEntrySize = 2;
+  static const int kTrapCacheLength =
+      kTrapCacheEntryCount * kTrapCacheEntrySize;
+
   static MaybeHandle<Object> CheckGetSetTrapResult(Isolate* isolate,
                                                    Handle<Name> name,
                                                    Handle<JSReceiver> target,
@@ -110,11 +110,15 @@ Handle<FixedArray> KeyAccumulator::GetKeys(GetKeysConversion convert) {
   DCHECK(ContainsOnlyValidKeys(result));
 
   if (try_prototype_info_cache_ && !first_prototype_map_.is_null()) {
-    PrototypeInfo::cast(first_prototype_map_->prototype_info())
-        .set_prototype_chain_enum_cache(*result);
+    // Registering the receiver's map with its prototype chain also creates
+    // the PrototypeInfo of a prototype that no IC has seen yet.
     Map::GetOrCreatePrototypeChainValidityCell(
         Handle<Map>(receiver_->map(), isolate_), isolate_);
-    DCHECK(first_prototype_map_->IsPrototypeValidityCellValid());
+    if (first_prototype_map_->prototype_info().IsPrototypeInfo()) {
+      PrototypeInfo::cast(first_prototype_map_->prototype_info())
+          .set_prototype_chain_enum_cache(*result);
+      DCHECK(first_prototype_map_->IsPrototypeValidityCellValid());
+    }
   }
   return result;
 }
@@ -639,14 +643,15 @@ bool FastKeyAccumulator::TryPrototypeInfoCache(Handle<JSReceiver> receiver) {
   }
   HeapObject prototype = receiver->map().prototype();
   if (prototype.is_null()) return false;
-  if (!prototype.map().is_prototype_map() ||
-      !prototype.map().prototype_info().IsPrototypeInfo()) {
-    return false;
-  }
+  // The PrototypeInfo is created when the keys are cached, so prototypes
+  // that have never been used by an IC, like many dictionary-mode ones, can
+  // get a cache too.
+  if (!prototype.map().is_prototype_map()) return false;
   first_prototype_ = handle(JSReceiver::cast(prototype), isolate_);
   Handle<Map> map(prototype.map(), isolate_);
   first_prototype_map_ = map;
   has_prototype_info_cache_ = map->IsPrototypeValidityCellValid() &&
+                              map->prototype_info().IsPrototypeInfo() &&
                               PrototypeInfo::cast(map->prototype_info())
                                   .prototype_chain_enum_cache()
                                   .IsFixedArray();
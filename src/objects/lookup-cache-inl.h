@@ -18,19 +18,27 @@ int DescriptorLookupCache::Hash(Map source, Name name) {
   // Uses only lower 32 bits if pointers are larger.
   uint32_t source_hash = static_cast<uint32_t>(source.ptr()) >> kTaggedSizeLog2;
   uint32_t name_hash = name.hash();
-  return (source_hash ^ name_hash) % kLength;
+  return ((source_hash ^ name_hash) % kSets) * kWays;
 }
 
 int DescriptorLookupCache::Lookup(Map source, Name name) {
   int index = Hash(source, name);
-  Key& key = keys_[index];
-  if ((key.source == source) && (key.name == name)) return results_[index];
+  for (int way = 0; way < kWays; way++) {
+    Key& key = keys_[index + way];
+    if ((key.source == source) && (key.name == name)) {
+      return results_[index + way];
+    }
+  }
   return kAbsent;
 }
 
 void DescriptorLookupCache::Update(Map source, Name name, int result) {
   DCHECK_NE(result, kAbsent);
   int index = Hash(source, name);
+  for (int way = kWays - 1; way > 0; way--) {
+    keys_[index + way] = keys_[index + way - 1];
+    results_[index + way] = results_[index + way - 1];
+  }
   Key& key = keys_[index];
   key.source = source;
   key.name = name;
@@ -41,9 +41,16 @@ class DescriptorLookupCache {
     }
   }
 
+  // Returns the index of the first entry of the set for (source, name).
   static inline int Hash(Map source, Name name);
 
-  static const int kLength = 64;
+  // The cache is set-associative: a (source, name) pair can be found in any
+  // of the kWays entries of its set. Updates insert at the front of the set
+  // and evict its last entry, so that repeated misses on colliding pairs do
+  // not evict each other.
+  static const int kWays = 2;
+  static const int kSets = 128;
+  static const int kLength = kSets * kWays;
   struct Key {
     Map source;
     Name name;
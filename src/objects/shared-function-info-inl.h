@@ -243,6 +243,16 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2,
                     has_static_private_methods_or_accessors,
                     SharedFunctionInfo::HasStaticPrivateMethodsOrAccessorsBit)
 
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2,
+                    pretenure_literal_allocation_sites,
+                    SharedFunctionInfo::PretenureLiteralAllocationSitesBit)
+
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, has_allocated_feedback_vector,
+                    SharedFunctionInfo::HasAllocatedFeedbackVectorBit)
+
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, has_flushed_bytecode,
+                    SharedFunctionInfo::HasFlushedBytecodeBit)
+
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags, syntax_kind,
                     SharedFunctionInfo::FunctionSyntaxKindBits)
 
@@ -589,6 +599,9 @@ bool SharedFunctionInfo::ShouldFlushBytecode(BytecodeFlushMode mode) {
 
   BytecodeArray bytecode = BytecodeArray::cast(data);
 
+  if (mode == BytecodeFlushMode::kAggressiveFlushBytecode) {
+    return bytecode.IsOldForMemoryReduction();
+  }
   return bytecode.IsOld();
 }
 
@@ -422,6 +422,21 @@ class SharedFunctionInfo
   DECL_BOOLEAN_ACCESSORS(class_scope_has_private_brand)
   DECL_BOOLEAN_ACCESSORS(has_static_private_methods_or_accessors)
 
+  // True if literal allocation sites of this function should start out
+  // tenured. Set by the code serializer when the sites of the serialized
+  // function were pretenured, so that the decision survives a code cache
+  // round trip.
+  DECL_BOOLEAN_ACCESSORS(pretenure_literal_allocation_sites)
+
+  // True once any closure of this function has allocated a feedback vector.
+  // With --lazy-feedback-allocation-per-sfi, later closures then allocate
+  // their vector eagerly instead of running the allocation budget again.
+  DECL_BOOLEAN_ACCESSORS(has_allocated_feedback_vector)
+
+  // True if the bytecode of this function has been flushed at least once, so
+  // that a later lazy compile can be accounted as a recompilation.
+  DECL_BOOLEAN_ACCESSORS(has_flushed_bytecode)
+
   // Is this function a top-level function (scripts, evals).
   DECL_BOOLEAN_ACCESSORS(is_toplevel)
 
@@ -12,6 +12,7 @@
 #include "src/common/globals.h"
 #include "src/common/ptr-compr-inl.h"
 #include "src/execution/isolate-utils-inl.h"
+#include "src/heap/basic-memory-chunk.h"
 #include "src/heap/safepoint.h"
 #include "src/objects/internal-index.h"
 #include "src/objects/object-list-macros.h"
@@ -106,25 +107,50 @@ class StringTable::Data {
     slot(index).Release_Store(entry);
   }
 
+  // Writes |entry| to the slot at |index| if that slot is still empty.
+  // Returns false if another thread filled the slot first.
+  bool TrySetEmpty(PtrComprCageBase cage_base, InternalIndex index,
+                   String entry) {
+    slot(index).Release_CompareAndSwap(empty_element(), entry);
+    // Slots only change from empty to a string while insertions run
+    // concurrently, so the slot now holds |entry| iff the swap succeeded.
+    return Get(cage_base, index) == entry;
+  }
+
   void ElementAdded() {
-    DCHECK_LT(number_of_elements_ + 1, capacity());
+    DCHECK_LT(number_of_elements() + 1, capacity());
     DCHECK(StringTableHasSufficientCapacityToAdd(
         capacity(), number_of_elements(), number_of_deleted_elements(), 1));
 
-    number_of_elements_++;
+    number_of_elements_.fetch_add(1, std::memory_order_relaxed);
   }
   void DeletedElementOverwritten() {
-    DCHECK_LT(number_of_elements_ + 1, capacity());
+    DCHECK_LT(number_of_elements() + 1, capacity());
     DCHECK(StringTableHasSufficientCapacityToAdd(
         capacity(), number_of_elements(), number_of_deleted_elements() - 1, 1));
 
-    number_of_elements_++;
-    number_of_deleted_elements_--;
+    number_of_elements_.fetch_add(1, std::memory_order_relaxed);
+    number_of_deleted_elements_.fetch_sub(1, std::memory_order_relaxed);
   }
   void ElementsRemoved(int count) {
-    DCHECK_LE(count, number_of_elements_);
-    number_of_elements_ -= count;
-    number_of_deleted_elements_ += count;
+    DCHECK_LE(count, number_of_elements());
+    number_of_elements_.fetch_sub(count, std::memory_order_relaxed);
+    number_of_deleted_elements_.fetch_add(count, std::memory_order_relaxed);
+  }
+
+  // Concurrent insertion (see StringTable::TryAddConcurrently) first reserves
+  // room for one element. Fails if the table would have to grow for it.
+  bool TryReserveElement() {
+    int nof = number_of_elements_.fetch_add(1, std::memory_order_relaxed);
+    if (StringTableHasSufficientCapacityToAdd(
+            capacity(), nof, number_of_deleted_elements(), 1)) {
+      return true;
+    }
+    number_of_elements_.fetch_sub(1, std::memory_order_relaxed);
+    return false;
+  }
+  void ReleaseReservedElement() {
+    number_of_elements_.fetch_sub(1, std::memory_order_relaxed);
   }
 
   void* operator new(size_t size, int capacity);
@@ -132,8 +158,12 @@ class StringTable::Data {
   void operator delete(void* description);
 
   int capacity() const { return capacity_; }
-  int number_of_elements() const { return number_of_elements_; }
-  int number_of_deleted_elements() const { return number_of_deleted_elements_; }
+  int number_of_elements() const {
+    return number_of_elements_.load(std::memory_order_relaxed);
+  }
+  int number_of_deleted_elements() const {
+    return number_of_deleted_elements_.load(std::memory_order_relaxed);
+  }
 
   template <typename IsolateT, typename StringTableKey>
   InternalIndex FindEntry(IsolateT* isolate, StringTableKey* key,
@@ -147,6 +177,13 @@ class StringTable::Data {
                                           StringTableKey* key,
                                           uint32_t hash) const;
 
+  // Returns the string matching |key|, inserting |new_string| into the first
+  // empty slot of its probe sequence if there is none. Safe to call from
+  // several threads at once, as long as nothing else modifies the table.
+  template <typename IsolateT, typename StringTableKey>
+  String FindOrInsertConcurrently(IsolateT* isolate, StringTableKey* key,
+                                  String new_string);
+
   // Helper method for StringTable::TryStringToIndexOrLookupExisting.
   template <typename Char>
   static Address TryStringToIndexOrLookupExisting(Isolate* isolate,
@@ -176,8 +213,8 @@ class StringTable::Data {
 
  private:
   std::unique_ptr<Data> previous_data_;
-  int number_of_elements_;
-  int number_of_deleted_elements_;
+  std::atomic<int> number_of_elements_;
+  std::atomic<int> number_of_deleted_elements_;
   const int capacity_;
   Tagged_t elements_[1];
 };
@@ -243,7 +280,8 @@ std::unique_ptr<StringTable::Data> StringTable::Data::Resize(
         new_data->FindInsertionEntry(cage_base, hash);
     new_data->Set(insertion_index, string);
   }
-  new_data->number_of_elements_ = data->number_of_elements();
+  new_data->number_of_elements_.store(data->number_of_elements(),
+                                      std::memory_order_relaxed);
 
   new_data->previous_data_ = std::move(data);
   return new_data;
@@ -310,6 +348,30 @@ InternalIndex StringTable::Data::FindEntryOrInsertionEntry(
   }
 }
 
+template <typename IsolateT, typename StringTableKey>
+String StringTable::Data::FindOrInsertConcurrently(IsolateT* isolate,
+                                                   StringTableKey* key,
+                                                   String new_string) {
+  // Deleted slots are never reused here: two threads inserting the same key
+  // must agree on where it goes, and the first empty slot of the probe
+  // sequence is the only position they both see. A slot can only change from
+  // empty to a string while insertions run concurrently.
+  uint32_t hash = key->hash();
+  uint32_t count = 1;
+  for (InternalIndex entry = FirstProbe(hash, capacity_);;
+       entry = NextProbe(entry, count++, capacity_)) {
+    Object element = Get(isolate, entry);
+    if (element == empty_element()) {
+      if (TrySetEmpty(isolate, entry, new_string)) return new_string;
+      // Another thread won the slot; check whether it added the same key.
+      element = Get(isolate, entry);
+    }
+    if (element == deleted_element()) continue;
+    String string = String::cast(element);
+    if (KeyIsMatch(isolate, key, string)) return string;
+  }
+}
+
 void StringTable::Data::IterateElements(RootVisitor* visitor) {
   OffHeapObjectSlot first_slot = slot(InternalIndex(0));
   OffHeapObjectSlot end_slot = slot(InternalIndex(capacity_));
@@ -326,6 +388,35 @@ void StringTable::Data::Print(PtrComprCageBase cage_base) const {
   os << "}" << std::endl;
 }
 
+// Holds the write mutex of a string table exclusively. In debug builds it
+// also records this, so that code which rewrites the table can check it.
+class V8_NODISCARD StringTable::ExclusiveWriteGuard final {
+ public:
+  explicit ExclusiveWriteGuard(StringTable* table)
+      : guard_(&table->write_mutex_)
+#ifdef DEBUG
+        ,
+        table_(table)
+#endif
+  {
+#ifdef DEBUG
+    DCHECK(!table_->write_mutex_held_exclusively_);
+    table_->write_mutex_held_exclusively_ = true;
+#endif
+  }
+  ~ExclusiveWriteGuard() {
+#ifdef DEBUG
+    table_->write_mutex_held_exclusively_ = false;
+#endif
+  }
+
+ private:
+  base::SharedMutexGuard<base::kExclusive> guard_;
+#ifdef DEBUG
+  StringTable* table_;
+#endif
+};
+
 StringTable::StringTable(Isolate* isolate)
     : data_(Data::New(kStringTableMinCapacity).release())
 #ifdef DEBUG
@@ -341,7 +432,7 @@ int StringTable::Capacity() const {
 }
 int StringTable::NumberOfElements() const {
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    base::SharedMutexGuard<base::kExclusive> table_write_guard(&write_mutex_);
     return data_.load(std::memory_order_relaxed)->number_of_elements();
   }
 }
@@ -374,19 +465,22 @@ class InternalizedStringKey final : public StringTableKey {
       return string_;
     }
     // External strings get special treatment, to avoid copying their
-    // contents as long as they are not uncached.
+    // contents as long as they are not uncached. This does not apply to a
+    // shared string table, which must not refer to resources owned by a
+    // single isolate.
     StringShape shape(*string_);
-    if (shape.IsExternalOneByte() && !shape.IsUncachedExternal()) {
-      return isolate->factory()
-          ->InternalizeExternalString<ExternalOneByteString>(string_);
-    } else if (shape.IsExternalTwoByte() && !shape.IsUncachedExternal()) {
-      return isolate->factory()
-          ->InternalizeExternalString<ExternalTwoByteString>(string_);
-    } else {
-      // Otherwise allocate a new internalized string.
-      return isolate->factory()->NewInternalizedStringImpl(
-          string_, string_->length(), string_->raw_hash_field());
+    if (!isolate->string_table()->HasSharedTable()) {
+      if (shape.IsExternalOneByte() && !shape.IsUncachedExternal()) {
+        return isolate->factory()
+            ->InternalizeExternalString<ExternalOneByteString>(string_);
+      } else if (shape.IsExternalTwoByte() && !shape.IsUncachedExternal()) {
+        return isolate->factory()
+            ->InternalizeExternalString<ExternalTwoByteString>(string_);
+      }
     }
+    // Otherwise allocate a new internalized string.
+    return isolate->factory()->NewInternalizedStringImpl(
+        string_, string_->length(), string_->raw_hash_field());
   }
 
  private:
@@ -414,7 +508,8 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   //   - The Heap access is allowed to be concurrent (using LocalHeap or
   //     similar),
   //   - All writes to the string table are guarded by the Isolate string table
-  //     mutex,
+  //     mutex: concurrent insertions into empty slots hold it shared, all
+  //     other writes hold it exclusively,
   //   - Resizes of the string table first copies the old contents to the new
   //     table, and only then sets the new string table pointer to the new
   //     table,
@@ -442,6 +537,10 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   // (without copying values) outside the lock, and potentially discard the
   // allocation if another write also did an allocation. This assumes that
   // writes are rarer than reads.
+  //
+  // Most insertions don't need the table to grow. Those only take the mutex
+  // shared and claim an empty slot with a compare-and-swap, so threads that
+  // internalize different strings don't serialize (see TryAddConcurrently).
 
   // Load the current string table data, in case another thread updates the
   // data while we're reading.
@@ -457,6 +556,18 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
     return handle(String::cast(data->Get(isolate, entry)), isolate);
   }
 
+  // With a shared table, strings are looked up there next. The same
+  // optimistic reasoning applies: the shared table never drops entries while
+  // client isolates are attached.
+  if (shared_table_ != nullptr) {
+    const Data* shared_data =
+        shared_table_->data_.load(std::memory_order_acquire);
+    entry = shared_data->FindEntry(isolate, key, key->hash());
+    if (entry.is_found()) {
+      return handle(String::cast(shared_data->Get(isolate, entry)), isolate);
+    }
+  }
+
   // No entry found, so adding new string.
 
   // Allocate the string before the first insertion attempt, reuse this
@@ -465,33 +576,90 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   // succeed, and this string will be discarded.
   Handle<String> new_string = key->AsHandle(isolate);
 
-  {
-    base::MutexGuard table_write_guard(&write_mutex_);
+  if (shared_table_ == nullptr) {
+    Handle<String> result;
+    if (TryAddConcurrently(isolate, key, new_string).ToHandle(&result)) {
+      return result;
+    }
+  }
+
+  ExclusiveWriteGuard table_write_guard(this);
 
-    Data* data = EnsureCapacity(isolate, 1);
+  if (shared_table_ != nullptr) {
+    // Another thread of this isolate may have added the string to this table
+    // in the meantime.
+    data = data_.load(std::memory_order_relaxed);
+    entry = data->FindEntry(isolate, key, key->hash());
+    if (entry.is_found()) {
+      return handle(String::cast(data->Get(isolate, entry)), isolate);
+    }
 
-    // Check one last time if the key is present in the table, in case it was
-    // added after the check.
-    entry = data->FindEntryOrInsertionEntry(isolate, key, key->hash());
+    if (BasicMemoryChunk::FromHeapObject(*new_string)->InSharedHeap()) {
+      ExclusiveWriteGuard shared_table_write_guard(shared_table_);
+      return shared_table_->AddOrGetLocked(isolate, key, new_string);
+    }
 
-    Object element = data->Get(isolate, entry);
-    if (element == empty_element()) {
-      // This entry is empty, so write it and register that we added an
-      // element.
-      data->Set(entry, *new_string);
-      data->ElementAdded();
-      return new_string;
-    } else if (element == deleted_element()) {
-      // This entry was deleted, so overwrite it and register that we
-      // overwrote a deleted element.
-      data->Set(entry, *new_string);
-      data->DeletedElementOverwritten();
-      return new_string;
-    } else {
-      // Return the existing string as a handle.
-      return handle(String::cast(element), isolate);
+    // The string could not be shared, so it goes to this table. Holding the
+    // local write lock guarantees that this isolate does not add the same
+    // key to the shared table concurrently.
+    const Data* shared_data =
+        shared_table_->data_.load(std::memory_order_acquire);
+    entry = shared_data->FindEntry(isolate, key, key->hash());
+    if (entry.is_found()) {
+      return handle(String::cast(shared_data->Get(isolate, entry)), isolate);
     }
   }
+
+  return AddOrGetLocked(isolate, key, new_string);
+}
+
+template <typename StringTableKey, typename IsolateT>
+MaybeHandle<String> StringTable::TryAddConcurrently(IsolateT* isolate,
+                                                    StringTableKey* key,
+                                                    Handle<String> new_string) {
+  // Holding the mutex shared keeps the table from being resized or otherwise
+  // rewritten while we probe it.
+  base::SharedMutexGuard<base::kShared> table_shared_guard(&write_mutex_);
+  Data* data = data_.load(std::memory_order_relaxed);
+  if (!data->TryReserveElement()) return {};
+  String result = data->FindOrInsertConcurrently(isolate, key, *new_string);
+  if (result != *new_string) {
+    data->ReleaseReservedElement();
+    return handle(result, isolate);
+  }
+  return new_string;
+}
+
+template <typename StringTableKey, typename IsolateT>
+Handle<String> StringTable::AddOrGetLocked(IsolateT* isolate,
+                                           StringTableKey* key,
+                                           Handle<String> new_string) {
+  DCHECK(write_mutex_held_exclusively_);
+
+  Data* data = EnsureCapacity(isolate, 1);
+
+  // Check one last time if the key is present in the table, in case it was
+  // added after the check.
+  InternalIndex entry =
+      data->FindEntryOrInsertionEntry(isolate, key, key->hash());
+
+  Object element = data->Get(isolate, entry);
+  if (element == empty_element()) {
+    // This entry is empty, so write it and register that we added an
+    // element.
+    data->Set(entry, *new_string);
+    data->ElementAdded();
+    return new_string;
+  } else if (element == deleted_element()) {
+    // This entry was deleted, so overwrite it and register that we
+    // overwrote a deleted element.
+    data->Set(entry, *new_string);
+    data->DeletedElementOverwritten();
+    return new_string;
+  } else {
+    // Return the existing string as a handle.
+    return handle(String::cast(element), isolate);
+  }
 }
 
 template Handle<String> StringTable::LookupKey(Isolate* isolate,
@@ -511,10 +679,29 @@ template Handle<String> StringTable::LookupKey(LocalIsolate* isolate,
 template Handle<String> StringTable::LookupKey(Isolate* isolate,
                                                StringTableInsertionKey* key);
 
+void StringTable::InsertForIsolateDeserialization(
+    Isolate* isolate, const std::vector<Handle<String>>& strings) {
+  DCHECK_EQ(NumberOfElements(), 0);
+  DCHECK(!HasSharedTable());
+  const int length = static_cast<int>(strings.size());
+  ExclusiveWriteGuard table_write_guard(this);
+
+  // Size the table for all strings up front, so that it is not grown and
+  // rehashed repeatedly while they are added.
+  Data* const data = EnsureCapacity(isolate, length);
+  for (Handle<String> string : strings) {
+    DCHECK(string->IsInternalizedString());
+    InternalIndex entry =
+        data->FindInsertionEntry(isolate, string->EnsureHash());
+    data->Set(entry, *string);
+    data->ElementAdded();
+  }
+}
+
 StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
                                                int additional_elements) {
-  // This call is only allowed while the write mutex is held.
-  write_mutex_.AssertHeld();
+  // This call is only allowed while the write mutex is held exclusively.
+  DCHECK(write_mutex_held_exclusively_);
 
   // This load can be relaxed as the table pointer can only be modified while
   // the lock is held.
@@ -525,18 +712,19 @@ StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
   // enough space.
   int current_capacity = data->capacity();
   int current_nof = data->number_of_elements();
-  int capacity_after_shrinking =
-      ComputeStringTableCapacityWithShrink(current_capacity, current_nof + 1);
+  int capacity_after_shrinking = ComputeStringTableCapacityWithShrink(
+      current_capacity, current_nof + additional_elements);
 
   int new_capacity = -1;
   if (capacity_after_shrinking < current_capacity) {
-    DCHECK(StringTableHasSufficientCapacityToAdd(capacity_after_shrinking,
-                                                 current_nof, 0, 1));
+    DCHECK(StringTableHasSufficientCapacityToAdd(
+        capacity_after_shrinking, current_nof, 0, additional_elements));
     new_capacity = capacity_after_shrinking;
   } else if (!StringTableHasSufficientCapacityToAdd(
                  current_capacity, current_nof,
-                 data->number_of_deleted_elements(), 1)) {
-    new_capacity = ComputeStringTableCapacity(current_nof + 1);
+                 data->number_of_deleted_elements(), additional_elements)) {
+    new_capacity =
+        ComputeStringTableCapacity(current_nof + additional_elements);
   }
 
   if (new_capacity != -1) {
@@ -596,10 +784,16 @@ Address StringTable::Data::TryStringToIndexOrLookupExisting(Isolate* isolate,
     return Smi::FromInt(ResultSentinel::kUnsupported).ptr();
   }
 
+  StringTable* string_table = isolate->string_table();
   Data* string_table_data =
-      isolate->string_table()->data_.load(std::memory_order_acquire);
+      string_table->data_.load(std::memory_order_acquire);
 
   InternalIndex entry = string_table_data->FindEntry(isolate, &key, key.hash());
+  if (entry.is_not_found() && string_table->shared_table_ != nullptr) {
+    string_table_data =
+        string_table->shared_table_->data_.load(std::memory_order_acquire);
+    entry = string_table_data->FindEntry(isolate, &key, key.hash());
+  }
   if (entry.is_not_found()) {
     // A string that's not an array index, and not in the string table,
     // cannot have been used as a property name before.
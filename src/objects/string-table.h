@@ -5,6 +5,9 @@
 #ifndef V8_OBJECTS_STRING_TABLE_H_
 #define V8_OBJECTS_STRING_TABLE_H_
 
+#include <vector>
+
+#include "src/base/platform/mutex.h"
 #include "src/common/assert-scope.h"
 #include "src/objects/string.h"
 #include "src/roots/roots.h"
@@ -72,9 +75,27 @@ class V8_EXPORT_PRIVATE StringTable {
   static Address TryStringToIndexOrLookupExisting(Isolate* isolate,
                                                   Address raw_string);
 
+  // Adds the given internalized strings to this empty table. The strings must
+  // be distinct, as is the case for the string table of a startup snapshot.
+  void InsertForIsolateDeserialization(
+      Isolate* isolate, const std::vector<Handle<String>>& strings);
+
   void Print(PtrComprCageBase cage_base) const;
   size_t GetCurrentMemoryUsage() const;
 
+  // Makes lookups that miss in this table continue in |shared_table|, the
+  // string table of the shared isolate, and insert new strings there when
+  // they were allocated in the shared heap. Strings that cannot be shared
+  // (e.g. allocated by background threads) are still added to this table,
+  // but only after checking that the shared table does not hold them yet.
+  // Since this table is always consulted first, every string content maps
+  // to a single internalized string per isolate. Must be called before any
+  // background thread uses the table.
+  void set_shared_table(StringTable* shared_table) {
+    shared_table_ = shared_table;
+  }
+  bool HasSharedTable() const { return shared_table_ != nullptr; }
+
   // The following methods must be called either while holding the write lock,
   // or while in a Heap safepoint.
   void IterateElements(RootVisitor* visitor);
@@ -83,14 +104,33 @@ class V8_EXPORT_PRIVATE StringTable {
 
  private:
   class Data;
+  class ExclusiveWriteGuard;
 
   Data* EnsureCapacity(PtrComprCageBase cage_base, int additional_elements);
 
+  // Like AddOrGetLocked, but only holds |write_mutex_| shared, so that
+  // several threads can insert at once. Returns an empty handle if the table
+  // has to grow first; the caller then falls back to AddOrGetLocked.
+  template <typename StringTableKey, typename IsolateT>
+  MaybeHandle<String> TryAddConcurrently(IsolateT* isolate,
+                                         StringTableKey* key,
+                                         Handle<String> new_string);
+
+  // Adds |new_string| for |key| unless the key is already present, in which
+  // case the existing string is returned. Requires |write_mutex_| to be held
+  // exclusively.
+  template <typename StringTableKey, typename IsolateT>
+  Handle<String> AddOrGetLocked(IsolateT* isolate, StringTableKey* key,
+                                Handle<String> new_string);
+
   std::atomic<Data*> data_;
+  StringTable* shared_table_ = nullptr;
   // Write mutex is mutable so that readers of concurrently mutated values (e.g.
   // NumberOfElements) are allowed to lock it while staying const.
-  mutable base::Mutex write_mutex_;
+  mutable base::SharedMutex write_mutex_;
 #ifdef DEBUG
+  // Set while an ExclusiveWriteGuard holds |write_mutex_|.
+  bool write_mutex_held_exclusively_ = false;
   Isolate* isolate_;
 #endif
 };
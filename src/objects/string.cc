@@ -56,6 +56,7 @@ Handle<String> String::SlowFlatten(Isolate* isolate, Handle<ConsString> cons,
             .ToHandleChecked();
     DisallowGarbageCollection no_gc;
     WriteToFlat(*cons, flat->GetChars(no_gc), 0, length);
+    isolate->heap()->IncrementFlattenedStringBytes(length);
     result = flat;
   } else {
     Handle<SeqTwoByteString> flat =
@@ -64,6 +65,7 @@ Handle<String> String::SlowFlatten(Isolate* isolate, Handle<ConsString> cons,
             .ToHandleChecked();
     DisallowGarbageCollection no_gc;
     WriteToFlat(*cons, flat->GetChars(no_gc), 0, length);
+    isolate->heap()->IncrementFlattenedStringBytes(length * kUC16Size);
     result = flat;
   }
   cons->set_first(*result);
@@ -298,6 +300,11 @@ bool String::SupportsExternalization() {
     return false;
   }
 
+  // Shared strings are visible to several isolates and cannot be mutated.
+  if (BasicMemoryChunk::FromHeapObject(*this)->InSharedHeap()) {
+    return false;
+  }
+
   // Already an external string.
   if (StringShape(*this).IsExternal()) {
     return false;
@@ -1431,9 +1438,13 @@ Handle<String> SeqString::Truncate(Handle<SeqString> string, int new_length) {
 
   Heap* heap = Heap::FromWritableHeapObject(*string);
   // Sizes are pointer size aligned, so that we can use filler objects
-  // that are a multiple of pointer size.
-  heap->CreateFillerObjectAt(start_of_string + new_size, delta,
-                             ClearRecordedSlots::kNo);
+  // that are a multiple of pointer size. Like for trimmed arrays, we do not
+  // create a filler in a large object space; the page is shrunk to the
+  // object size by the GC.
+  if (!heap->IsLargeObject(*string)) {
+    heap->CreateFillerObjectAt(start_of_string + new_size, delta,
+                               ClearRecordedSlots::kNo);
+  }
   // We are storing the new length using release store after creating a filler
   // for the left-over space to avoid races with the sweeper thread.
   string->set_length(new_length, kReleaseStore);
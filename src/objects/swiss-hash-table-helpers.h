@@ -56,10 +56,25 @@
 #error "Bad configuration!"
 #endif
 
+// On arm64, NEON is always available. The NEON implementation uses the same
+// group width of 8 and the same byte mask format as the portable one, so
+// unlike for SSE, host and target may freely differ in whether they use it.
+#ifndef SWISS_TABLE_HAVE_NEON
+#if defined(__aarch64__) && defined(__ARM_NEON) && !defined(__ARM_BIG_ENDIAN)
+#define SWISS_TABLE_HAVE_NEON 1
+#else
+#define SWISS_TABLE_HAVE_NEON 0
+#endif
+#endif
+
 #if SWISS_TABLE_HAVE_SSE2
 #include <emmintrin.h>
 #endif
 
+#if SWISS_TABLE_HAVE_NEON
+#include <arm_neon.h>
+#endif
+
 #if SWISS_TABLE_HAVE_SSSE3
 #include <tmmintrin.h>
 #endif
@@ -348,6 +363,61 @@ struct GroupPortableImpl {
   uint64_t ctrl;
 };
 
+#if SWISS_TABLE_HAVE_NEON
+// Counterpart to GroupPortableImpl that compares all 8 control bytes at once
+// with NEON instructions. The comparisons yield 0xFF or 0x00 in every byte,
+// masking that with kMsbs gives the same byte masks as GroupPortableImpl.
+// Unlike GroupPortableImpl::Match, Match has no false positives.
+struct GroupNeonImpl {
+  static constexpr size_t kWidth = 8;  // the number of slots per group
+
+  explicit GroupNeonImpl(const ctrl_t* pos)
+      : ctrl(vld1_u8(reinterpret_cast<const uint8_t*>(pos))) {}
+
+  static constexpr uint64_t kMsbs = 0x8080808080808080ULL;
+
+  // Returns a bitmask representing the positions of slots that match |hash|.
+  BitMask<uint64_t, kWidth, 3> Match(h2_t hash) const {
+    return BitMask<uint64_t, kWidth, 3>(
+        ToUint64(vceq_u8(ctrl, vdup_n_u8(hash))) & kMsbs);
+  }
+
+  // Returns a bitmask representing the positions of empty slots.
+  BitMask<uint64_t, kWidth, 3> MatchEmpty() const {
+    return Match(static_cast<h2_t>(kEmpty));
+  }
+
+  // Returns a bitmask representing the positions of empty or deleted slots.
+  BitMask<uint64_t, kWidth, 3> MatchEmptyOrDeleted() const {
+    return BitMask<uint64_t, kWidth, 3>(
+        ToUint64(vclt_s8(vreinterpret_s8_u8(ctrl), vdup_n_s8(kSentinel))) &
+        kMsbs);
+  }
+
+  // Returns the number of trailing empty or deleted elements in the group.
+  uint32_t CountLeadingEmptyOrDeleted() const {
+    uint64_t full_or_sentinel =
+        ToUint64(vcge_s8(vreinterpret_s8_u8(ctrl), vdup_n_s8(kSentinel)));
+    return base::bits::CountTrailingZeros(full_or_sentinel) >> 3;
+  }
+
+  void ConvertSpecialToEmptyAndFullToDeleted(ctrl_t* dst) const {
+    // All special values have the MSB set, so they become kEmpty, while all
+    // full slots become kDeleted.
+    uint8x8_t special = vclt_s8(vreinterpret_s8_u8(ctrl), vdup_n_s8(0));
+    vst1_u8(reinterpret_cast<uint8_t*>(dst),
+            vbsl_u8(special, vdup_n_u8(static_cast<uint8_t>(kEmpty)),
+                    vdup_n_u8(static_cast<uint8_t>(kDeleted))));
+  }
+
+  static uint64_t ToUint64(uint8x8_t mask) {
+    return vget_lane_u64(vreinterpret_u64_u8(mask), 0);
+  }
+
+  uint8x8_t ctrl;
+};
+#endif  // SWISS_TABLE_HAVE_NEON
+
 // Determine which Group implementation SwissNameDictionary uses.
 #if defined(V8_ENABLE_SWISS_NAME_DICTIONARY) && DEBUG
 // TODO(v8:11388) If v8_enable_swiss_name_dictionary is enabled, we are supposed
@@ -368,12 +438,15 @@ using Group = GroupPortableImpl;
 #else
 #if SWISS_TABLE_HAVE_SSE2
 using Group = GroupSse2Impl;
+#elif SWISS_TABLE_HAVE_NEON
+using Group = GroupNeonImpl;
 #else
 using Group = GroupPortableImpl;
 #endif
 #endif
 
 #undef SWISS_TABLE_HAVE_SSE2
+#undef SWISS_TABLE_HAVE_NEON
 #undef SWISS_TABLE_HAVE_SSE3
 
 }  // namespace swiss_table
@@ -46,6 +46,8 @@ namespace internal {
 // Version 12: regexp and string objects share normal string encoding
 // Version 13: host objects have an explicit tag (rather than handling all
 //             unknown tags)
+// Version 14: plain objects may share a table of keys ("shape")
+// Version 15: external strings may be transferred by the delegate
 //
 // WARNING: Increasing this value is a change which cannot safely be rolled
 // back without breaking compatibility with data stored on disk. It is
@@ -54,7 +56,7 @@ namespace internal {
 //
 // Recent changes are routinely reverted in preparation for branch, and this
 // has been the cause of at least one bug in the past.
-static const uint32_t kLatestVersion = 13;
+static const uint32_t kLatestVersion = 15;
 static_assert(kLatestVersion == v8::CurrentValueSerializerFormatVersion(),
               "Exported format version must match latest version.");
 
@@ -104,6 +106,13 @@ enum class SerializationTag : uint8_t {
   kBeginJSObject = 'o',
   // End of a JS object. numProperties:uint32_t
   kEndJSObject = '{',
+  // A JS object whose keys define a new shape, which gets the next shape ID.
+  // numProperties:uint32_t, then |numProperties| keys, then one value per key.
+  // A value of kTheHole means that the property is absent.
+  kJSObjectWithNewShape = 'O',
+  // A JS object with the keys of an earlier shape. shapeID:uint32_t, then one
+  // value per key, as above.
+  kJSObjectWithShape = 'h',
   // Beginning of a sparse JS array. length:uint32_t
   // Elements and properties are written as key/value pairs, like objects.
   kBeginSparseJSArray = 'a',
@@ -152,6 +161,8 @@ enum class SerializationTag : uint8_t {
   kSharedArrayBuffer = 'u',
   // A wasm module object transfer. next value is its index.
   kWasmModuleTransfer = 'w',
+  // An external string, transferred by the delegate. transferID:uint32_t
+  kExternalStringTransfer = 'X',
   // The delegate is responsible for processing all following data.
   // This "escapes" to whatever wire format the delegate chooses.
   kHostObject = '\\',
@@ -244,7 +255,8 @@ ValueSerializer::ValueSerializer(Isolate* isolate,
       zone_(isolate->allocator(), ZONE_NAME),
       id_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)),
       array_buffer_transfer_map_(isolate->heap(),
-                                 ZoneAllocationPolicy(&zone_)) {}
+                                 ZoneAllocationPolicy(&zone_)),
+      shape_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)) {}
 
 ValueSerializer::~ValueSerializer() {
   if (buffer_) {
@@ -439,7 +451,11 @@ Maybe<bool> ValueSerializer::WriteObject(Handle<Object> object) {
     }
     default:
       if (object->IsString()) {
-        WriteString(Handle<String>::cast(object));
+        Handle<String> string = Handle<String>::cast(object);
+        if (delegate_ != nullptr && string->IsExternalString()) {
+          return WriteExternalString(string);
+        }
+        WriteString(string);
         return ThrowIfOutOfMemory();
       } else if (object->IsJSReceiver()) {
         return WriteJSReceiver(Handle<JSReceiver>::cast(object));
@@ -509,6 +525,21 @@ void ValueSerializer::WriteString(Handle<String> string) {
   }
 }
 
+Maybe<bool> ValueSerializer::WriteExternalString(Handle<String> string) {
+  DCHECK_NOT_NULL(delegate_);
+  Maybe<uint32_t> transfer_id = delegate_->GetExternalStringTransferId(
+      reinterpret_cast<v8::Isolate*>(isolate_), Utils::ToLocal(string));
+  RETURN_VALUE_IF_SCHEDULED_EXCEPTION(isolate_, Nothing<bool>());
+  uint32_t id = 0;
+  if (transfer_id.To(&id)) {
+    WriteTag(SerializationTag::kExternalStringTransfer);
+    WriteVarint<uint32_t>(id);
+  } else {
+    WriteString(string);
+  }
+  return ThrowIfOutOfMemory();
+}
+
 Maybe<bool> ValueSerializer::WriteJSReceiver(Handle<JSReceiver> receiver) {
   // If the object has already been serialized, just write its ID.
   auto find_result = id_map_.FindOrInsert(receiver);
@@ -597,6 +628,21 @@ Maybe<bool> ValueSerializer::WriteJSReceiver(Handle<JSReceiver> receiver) {
   return Nothing<bool>();
 }
 
+// Whether the enumerable string keys of objects with |map| are exactly its
+// own field descriptors, so that the keys can be written once per map.
+static bool HasShareableShape(Map map) {
+  DescriptorArray descriptors = map.instance_descriptors();
+  if (map.NumberOfOwnDescriptors() == 0) return false;
+  for (InternalIndex i : map.IterateOwnDescriptors()) {
+    PropertyDetails details = descriptors.GetDetails(i);
+    if (!descriptors.GetKey(i).IsString() || details.IsDontEnum() ||
+        details.location() != kField) {
+      return false;
+    }
+  }
+  return true;
+}
+
 Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   DCHECK(!object->map().IsCustomElementsReceiverMap());
   const bool can_serialize_fast =
@@ -604,6 +650,9 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   if (!can_serialize_fast) return WriteJSObjectSlow(object);
 
   Handle<Map> map(object->map(), isolate_);
+  if (FLAG_value_serializer_object_shapes && HasShareableShape(*map)) {
+    return WriteJSObjectWithShape(object, map);
+  }
   WriteTag(SerializationTag::kBeginJSObject);
 
   // Write out fast properties as long as they are only data properties and the
@@ -644,6 +693,51 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   return ThrowIfOutOfMemory();
 }
 
+Maybe<bool> ValueSerializer::WriteJSObjectWithShape(Handle<JSObject> object,
+                                                    Handle<Map> map) {
+  auto shape = shape_map_.FindOrInsert(map);
+  if (shape.already_exists) {
+    WriteTag(SerializationTag::kJSObjectWithShape);
+    WriteVarint<uint32_t>(*shape.entry);
+  } else {
+    *shape.entry = next_shape_id_++;
+    WriteTag(SerializationTag::kJSObjectWithNewShape);
+    WriteVarint<uint32_t>(static_cast<uint32_t>(map->NumberOfOwnDescriptors()));
+    for (InternalIndex i : map->IterateOwnDescriptors()) {
+      WriteString(handle(
+          String::cast(map->instance_descriptors(isolate_).GetKey(i)),
+          isolate_));
+    }
+  }
+
+  // Like WriteJSObject, read the fields directly while the map is unchanged.
+  // The number of values is fixed by the shape, so properties deleted while
+  // writing earlier values are written as holes.
+  bool map_changed = false;
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    Handle<Object> value;
+    if (V8_LIKELY(!map_changed)) map_changed = *map != object->map();
+    if (V8_LIKELY(!map_changed)) {
+      PropertyDetails details =
+          map->instance_descriptors(isolate_).GetDetails(i);
+      FieldIndex field_index = FieldIndex::ForDescriptor(*map, i);
+      value = JSObject::FastPropertyAt(object, details.representation(),
+                                       field_index);
+    } else {
+      Handle<Name> key(map->instance_descriptors(isolate_).GetKey(i),
+                       isolate_);
+      LookupIterator it(isolate_, object, key, LookupIterator::OWN);
+      if (!it.IsFound()) {
+        WriteTag(SerializationTag::kTheHole);
+        continue;
+      }
+      if (!Object::GetProperty(&it).ToHandle(&value)) return Nothing<bool>();
+    }
+    if (!WriteObject(value).FromMaybe(false)) return Nothing<bool>();
+  }
+  return ThrowIfOutOfMemory();
+}
+
 Maybe<bool> ValueSerializer::WriteJSObjectSlow(Handle<JSObject> object) {
   WriteTag(SerializationTag::kBeginJSObject);
   Handle<FixedArray> keys;
@@ -1119,6 +1213,8 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate,
       position_(data.begin()),
       end_(data.begin() + data.length()),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      shapes_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
@@ -1128,10 +1224,13 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
       position_(data),
       end_(data + size),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      shapes_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::~ValueDeserializer() {
   GlobalHandles::Destroy(id_map_.location());
+  GlobalHandles::Destroy(shapes_.location());
 
   Handle<Object> transfer_map_handle;
   if (array_buffer_transfer_map_.ToHandle(&transfer_map_handle)) {
@@ -1339,6 +1438,9 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
       return ReadOneByteString();
     case SerializationTag::kTwoByteString:
       return ReadTwoByteString();
+    case SerializationTag::kExternalStringTransfer:
+      if (version_ < 15) break;
+      return ReadTransferredExternalString();
     case SerializationTag::kObjectReference: {
       uint32_t id;
       if (!ReadVarint<uint32_t>().To(&id)) return MaybeHandle<Object>();
@@ -1346,6 +1448,12 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     }
     case SerializationTag::kBeginJSObject:
       return ReadJSObject();
+    case SerializationTag::kJSObjectWithNewShape:
+      if (version_ < 14) break;
+      return ReadJSObjectWithShape(true);
+    case SerializationTag::kJSObjectWithShape:
+      if (version_ < 14) break;
+      return ReadJSObjectWithShape(false);
     case SerializationTag::kBeginSparseJSArray:
       return ReadSparseJSArray();
     case SerializationTag::kBeginDenseJSArray:
@@ -1386,14 +1494,15 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     case SerializationTag::kHostObject:
       return ReadHostObject();
     default:
-      // Before there was an explicit tag for host objects, all unknown tags
-      // were delegated to the host.
-      if (version_ < 13) {
-        position_--;
-        return ReadHostObject();
-      }
-      return MaybeHandle<Object>();
+      break;
   }
+  // Before there was an explicit tag for host objects, all unknown tags
+  // (including those added in later versions) were delegated to the host.
+  if (version_ < 13) {
+    position_--;
+    return ReadHostObject();
+  }
+  return MaybeHandle<Object>();
 }
 
 MaybeHandle<String> ValueDeserializer::ReadString() {
@@ -1405,6 +1514,20 @@ MaybeHandle<String> ValueDeserializer::ReadString() {
   return Handle<String>::cast(object);
 }
 
+MaybeHandle<String> ValueDeserializer::ReadTransferredExternalString() {
+  uint32_t transfer_id = 0;
+  Local<String> string;
+  if (!ReadVarint<uint32_t>().To(&transfer_id) || delegate_ == nullptr ||
+      !delegate_
+           ->GetExternalStringFromId(reinterpret_cast<v8::Isolate*>(isolate_),
+                                     transfer_id)
+           .ToLocal(&string)) {
+    RETURN_EXCEPTION_IF_SCHEDULED_EXCEPTION(isolate_, String);
+    return MaybeHandle<String>();
+  }
+  return Utils::OpenHandle(*string);
+}
+
 MaybeHandle<BigInt> ValueDeserializer::ReadBigInt() {
   uint32_t bitfield;
   if (!ReadVarint<uint32_t>().To(&bitfield)) return MaybeHandle<BigInt>();
@@ -2063,6 +2186,30 @@ static void CommitProperties(Handle<JSObject> object, Handle<Map> map,
   }
 }
 
+// Returns whether |value| fits the representation of the field |descriptor|
+// of |map|, generalizing the field type in place if needed.
+static bool PrepareFieldForValue(Isolate* isolate, Handle<Map> map,
+                                 InternalIndex descriptor,
+                                 Handle<Object> value) {
+  PropertyDetails details =
+      map->instance_descriptors(isolate).GetDetails(descriptor);
+  Representation expected_representation = details.representation();
+  if (!value->FitsRepresentation(expected_representation)) return false;
+  if (expected_representation.IsHeapObject() &&
+      !map->instance_descriptors(isolate)
+           .GetFieldType(descriptor)
+           .NowContains(value)) {
+    Handle<FieldType> value_type =
+        value->OptimalType(isolate, expected_representation);
+    MapUpdater::GeneralizeField(isolate, map, descriptor, details.constness(),
+                                expected_representation, value_type);
+  }
+  DCHECK(map->instance_descriptors(isolate)
+             .GetFieldType(descriptor)
+             .NowContains(value));
+  return true;
+}
+
 static bool IsValidObjectKey(Handle<Object> value) {
   return value->IsName() || value->IsNumber();
 }
@@ -2127,23 +2274,7 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
       // that we can copy them all at once. Otherwise, stop transitioning.
       if (transitioning) {
         InternalIndex descriptor(properties.size());
-        PropertyDetails details =
-            target->instance_descriptors(isolate_).GetDetails(descriptor);
-        Representation expected_representation = details.representation();
-        if (value->FitsRepresentation(expected_representation)) {
-          if (expected_representation.IsHeapObject() &&
-              !target->instance_descriptors(isolate_)
-                   .GetFieldType(descriptor)
-                   .NowContains(value)) {
-            Handle<FieldType> value_type =
-                value->OptimalType(isolate_, expected_representation);
-            MapUpdater::GeneralizeField(isolate_, target, descriptor,
-                                        details.constness(),
-                                        expected_representation, value_type);
-          }
-          DCHECK(target->instance_descriptors(isolate_)
-                     .GetFieldType(descriptor)
-                     .NowContains(value));
+        if (PrepareFieldForValue(isolate_, target, descriptor, value)) {
           properties.push_back(value);
           map = target;
           continue;
@@ -2204,6 +2335,111 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
   }
 }
 
+MaybeHandle<FixedArray> ValueDeserializer::ReadObjectShape() {
+  uint32_t num_properties;
+  // Each key takes at least two bytes.
+  if (!ReadVarint<uint32_t>().To(&num_properties) ||
+      num_properties > static_cast<size_t>(end_ - position_) / 2 ||
+      num_properties > FixedArray::kMaxLength - kShapeKeysStart) {
+    return MaybeHandle<FixedArray>();
+  }
+  Handle<FixedArray> shape = isolate_->factory()->NewFixedArray(
+      kShapeKeysStart + static_cast<int>(num_properties));
+  for (int i = 0; i < static_cast<int>(num_properties); i++) {
+    Handle<Object> key;
+    if (!ReadObject().ToHandle(&key) || !key->IsString()) {
+      return MaybeHandle<FixedArray>();
+    }
+    key = isolate_->factory()->InternalizeString(Handle<String>::cast(key));
+    shape->set(kShapeKeysStart + i, *key);
+  }
+
+  Handle<FixedArray> new_array =
+      FixedArray::SetAndGrow(isolate_, shapes_, num_shapes_++, shape);
+  if (!new_array.is_identical_to(shapes_)) {
+    GlobalHandles::Destroy(shapes_.location());
+    shapes_ = isolate_->global_handles()->Create(*new_array);
+  }
+  return shape;
+}
+
+MaybeHandle<JSObject> ValueDeserializer::ReadJSObjectWithShape(
+    bool new_shape) {
+  // If we are at the end of the stack, abort. This function may recurse.
+  STACK_CHECK(isolate_, MaybeHandle<JSObject>());
+
+  uint32_t id = next_id_++;
+  HandleScope scope(isolate_);
+  Handle<FixedArray> shape;
+  if (new_shape) {
+    if (!ReadObjectShape().ToHandle(&shape)) return MaybeHandle<JSObject>();
+  } else {
+    uint32_t shape_id;
+    if (!ReadVarint<uint32_t>().To(&shape_id) || shape_id >= num_shapes_) {
+      return MaybeHandle<JSObject>();
+    }
+    shape = handle(FixedArray::cast(shapes_->get(shape_id)), isolate_);
+  }
+  Handle<JSObject> object =
+      isolate_->factory()->NewJSObject(isolate_->object_function());
+  AddObjectWithID(id, object);
+
+  int num_properties = shape->length() - kShapeKeysStart;
+  std::vector<Handle<Object>> properties;
+  properties.reserve(num_properties);
+  bool has_holes = false;
+  for (int i = 0; i < num_properties; i++) {
+    SerializationTag tag;
+    if (PeekTag().To(&tag) && tag == SerializationTag::kTheHole) {
+      ConsumeTag(SerializationTag::kTheHole);
+      properties.push_back(isolate_->factory()->the_hole_value());
+      has_holes = true;
+      continue;
+    }
+    Handle<Object> value;
+    if (!ReadObject().ToHandle(&value)) return MaybeHandle<JSObject>();
+    properties.push_back(value);
+  }
+
+  // Reuse the map of an earlier object with this shape if all values fit.
+  Handle<Map> map;
+  if (!has_holes && shape->get(kShapeMapIndex).IsMap() &&
+      Map::TryUpdate(isolate_,
+                     handle(Map::cast(shape->get(kShapeMapIndex)), isolate_))
+          .ToHandle(&map)) {
+    bool fits = true;
+    for (InternalIndex i : InternalIndex::Range(num_properties)) {
+      if (!PrepareFieldForValue(isolate_, map, i, properties[i.raw_value()])) {
+        fits = false;
+        break;
+      }
+    }
+    if (fits) {
+      CommitProperties(object, map, properties);
+      return scope.CloseAndEscape(object);
+    }
+  }
+
+  for (int i = 0; i < num_properties; i++) {
+    if (properties[i]->IsTheHole(isolate_)) continue;
+    LookupIterator::Key lookup_key(
+        isolate_, handle(shape->get(kShapeKeysStart + i), isolate_));
+    LookupIterator it(isolate_, object, lookup_key, LookupIterator::OWN);
+    if (it.state() != LookupIterator::NOT_FOUND ||
+        JSObject::DefineOwnPropertyIgnoreAttributes(&it, properties[i], NONE)
+            .is_null()) {
+      return MaybeHandle<JSObject>();
+    }
+  }
+  if (!has_holes && object->HasFastProperties() &&
+      object->map().NumberOfOwnDescriptors() == num_properties) {
+    shape->set(kShapeMapIndex, object->map());
+  }
+
+  DCHECK(HasObjectWithID(id));
+  return scope.CloseAndEscape(object);
+}
+
 bool ValueDeserializer::HasObjectWithID(uint32_t id) {
   return id < static_cast<unsigned>(id_map_->length()) &&
          !id_map_->get(id).IsTheHole(isolate_);
@@ -116,10 +116,13 @@ class ValueSerializer {
   void WriteHeapNumber(HeapNumber number);
   void WriteBigInt(BigInt bigint);
   void WriteString(Handle<String> string);
+  Maybe<bool> WriteExternalString(Handle<String> string) V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSReceiver(Handle<JSReceiver> receiver)
       V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObject(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObjectSlow(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
+  Maybe<bool> WriteJSObjectWithShape(Handle<JSObject> object,
+                                     Handle<Map> map) V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSArray(Handle<JSArray> array) V8_WARN_UNUSED_RESULT;
   void WriteJSDate(JSDate date);
   Maybe<bool> WriteJSPrimitiveWrapper(Handle<JSPrimitiveWrapper> value)
@@ -174,6 +177,11 @@ class ValueSerializer {
 
   // A similar map, for transferred array buffers.
   IdentityMap<uint32_t, ZoneAllocationPolicy> array_buffer_transfer_map_;
+
+  // Maps the maps of objects written with kJSObjectWithNewShape to their
+  // shape IDs.
+  IdentityMap<uint32_t, ZoneAllocationPolicy> shape_map_;
+  uint32_t next_shape_id_ = 0;
 };
 
 /*
@@ -266,7 +274,11 @@ class ValueDeserializer {
   MaybeHandle<String> ReadUtf8String() V8_WARN_UNUSED_RESULT;
   MaybeHandle<String> ReadOneByteString() V8_WARN_UNUSED_RESULT;
   MaybeHandle<String> ReadTwoByteString() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<String> ReadTransferredExternalString() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadJSObject() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSObject> ReadJSObjectWithShape(bool new_shape)
+      V8_WARN_UNUSED_RESULT;
+  MaybeHandle<FixedArray> ReadObjectShape() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadSparseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadDenseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSDate> ReadJSDate() V8_WARN_UNUSED_RESULT;
@@ -311,6 +323,14 @@ class ValueDeserializer {
   // Always global handles.
   Handle<FixedArray> id_map_;
   MaybeHandle<SimpleNumberDictionary> array_buffer_transfer_map_;
+
+  // Shapes read so far, indexed by shape ID. Each shape is a FixedArray
+  // holding a map that objects with the shape can use (or undefined),
+  // followed by the internalized keys. Always a global handle.
+  static constexpr int kShapeMapIndex = 0;
+  static constexpr int kShapeKeysStart = 1;
+  Handle<FixedArray> shapes_;
+  uint32_t num_shapes_ = 0;
 };
 
 }  // namespace internal
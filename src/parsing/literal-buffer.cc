@@ -4,6 +4,8 @@
 
 #include "src/parsing/literal-buffer.h"
 
+#include <algorithm>
+
 #include "src/execution/isolate.h"
 #include "src/execution/local-isolate.h"
 #include "src/heap/factory.h"
@@ -64,6 +66,25 @@ void LiteralBuffer::ConvertToTwoByte() {
   is_one_byte_ = false;
 }
 
+void LiteralBuffer::AddChars(const uint16_t* begin, const uint16_t* end) {
+  const uint16_t* it = begin;
+  if (is_one_byte()) {
+    const uint16_t* one_byte_end = std::find_if(it, end, [](uint16_t c) {
+      return c > static_cast<uint16_t>(unibrow::Latin1::kMaxChar);
+    });
+    int length = static_cast<int>(one_byte_end - it);
+    if (length > 0) {
+      while (position_ + length > backing_store_.length()) ExpandBuffer();
+      CopyChars(backing_store_.begin() + position_, it, length);
+      position_ += length;
+      it = one_byte_end;
+    }
+    if (it == end) return;
+    ConvertToTwoByte();
+  }
+  for (; it != end; ++it) AddTwoByteChar(*it);
+}
+
 void LiteralBuffer::AddTwoByteChar(uc32 code_unit) {
   DCHECK(!is_one_byte());
   if (position_ >= backing_store_.length()) ExpandBuffer();
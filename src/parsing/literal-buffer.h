@@ -37,6 +37,9 @@ class LiteralBuffer final {
     AddTwoByteChar(code_unit);
   }
 
+  // Adds a run of UTF-16 code units at once.
+  void AddChars(const uint16_t* begin, const uint16_t* end);
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool Equals(base::Vector<const char> keyword) const {
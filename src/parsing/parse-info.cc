@@ -328,9 +328,9 @@ void ParseInfo::CheckFlagsForFunctionFromScript(Script script) {
 
 void UnoptimizedCompileState::ParallelTasks::Enqueue(
     ParseInfo* outer_parse_info, const AstRawString* function_name,
-    FunctionLiteral* literal) {
-  base::Optional<CompilerDispatcher::JobId> job_id =
-      dispatcher_->Enqueue(outer_parse_info, function_name, literal);
+    FunctionLiteral* literal, bool is_likely_called) {
+  base::Optional<CompilerDispatcher::JobId> job_id = dispatcher_->Enqueue(
+      outer_parse_info, function_name, literal, is_likely_called);
   if (job_id) {
     enqueued_jobs_.emplace_front(std::make_pair(literal, *job_id));
   }
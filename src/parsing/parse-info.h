@@ -158,7 +158,7 @@ class V8_EXPORT_PRIVATE UnoptimizedCompileState {
     }
 
     void Enqueue(ParseInfo* outer_parse_info, const AstRawString* function_name,
-                 FunctionLiteral* literal);
+                 FunctionLiteral* literal, bool is_likely_called);
 
     using EnqueuedJobsIterator =
         std::forward_list<std::pair<FunctionLiteral*, uintptr_t>>::iterator;
@@ -2594,9 +2594,14 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
 
   // If parallel compile tasks are enabled, and the function is an eager
   // top level function, then we can pre-parse the function and parse / compile
-  // in a parallel task on a worker thread.
+  // in a parallel task on a worker thread. With
+  // --parallel-compile-tasks-for-lazy, lazy top level functions (which are
+  // pre-parsed anyway) are compiled on worker threads too, so that large
+  // scripts don't need to compile them on the main thread when first called.
   bool should_post_parallel_task =
-      parse_lazily() && is_eager_top_level_function &&
+      parse_lazily() &&
+      (is_eager_top_level_function ||
+       (is_lazy_top_level_function && FLAG_parallel_compile_tasks_for_lazy)) &&
       FLAG_parallel_compile_tasks && info()->parallel_tasks() &&
       scanner()->stream()->can_be_cloned_for_parallel_access();
 
@@ -2696,7 +2701,10 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
 
   if (should_post_parallel_task) {
     // Start a parallel parse / compile task on the compiler dispatcher.
-    info()->parallel_tasks()->Enqueue(info(), function_name, function_literal);
+    // Eager top level functions are expected to be called soon, so compile
+    // them ahead of lazy ones.
+    info()->parallel_tasks()->Enqueue(info(), function_name, function_literal,
+                                      is_eager_top_level_function);
   }
 
   if (should_infer_name) {
@@ -615,6 +615,16 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   }
 
   while (cursor < end && chars < position) {
+    // Fast path for ascii sequences: every byte is one char, so there is no
+    // need to decode them.
+    if (state == unibrow::Utf8::State::kAccept) {
+      size_t max_length = std::min(static_cast<size_t>(end - cursor),
+                                   position - chars);
+      int ascii_length = NonAsciiStart(cursor, static_cast<int>(max_length));
+      cursor += ascii_length;
+      chars += ascii_length;
+      if (cursor == end || chars == position) break;
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (t != unibrow::Utf8::kIncomplete) {
@@ -273,7 +273,8 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // Otherwise we'll fall into the slow path after scanning the identifier.
       DCHECK(!IdentifierNeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
-      AdvanceUntil([this, &scan_flags](uc32 c0) {
+      // The identifier characters are added to the literal a run at a time.
+      AdvanceUntilAddingLiteralChars([&scan_flags](uc32 c0) {
         if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
           // A non-ascii character means we need to drop through to the slow
           // path.
@@ -285,12 +286,7 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
         }
         uint8_t char_flags = character_scan_flags[c0];
         scan_flags |= char_flags;
-        if (TerminatesLiteral(char_flags)) {
-          return true;
-        } else {
-          AddLiteralChar(static_cast<char>(c0));
-          return false;
-        }
+        return TerminatesLiteral(char_flags);
       });
 
       if (V8_LIKELY(!IdentifierNeedsSlowPath(scan_flags))) {
@@ -325,11 +321,15 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
   DCHECK(!IsWhiteSpaceOrLineTerminator(kEndOfInput));
 
   // Advance as long as character is a WhiteSpace or LineTerminator.
-  while (IsWhiteSpaceOrLineTerminator(c0_)) {
-    if (!next().after_line_terminator && unibrow::IsLineTerminator(c0_)) {
-      next().after_line_terminator = true;
-    }
-    Advance();
+  if (IsWhiteSpaceOrLineTerminator(c0_)) {
+    bool after_line_terminator =
+        next().after_line_terminator || unibrow::IsLineTerminator(c0_);
+    AdvanceUntil([&after_line_terminator](uc32 c0) {
+      if (!IsWhiteSpaceOrLineTerminator(c0)) return true;
+      if (unibrow::IsLineTerminator(c0)) after_line_terminator = true;
+      return false;
+    });
+    next().after_line_terminator = after_line_terminator;
   }
 
   // Return whether or not we skipped any characters.
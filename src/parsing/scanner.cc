@@ -455,18 +455,12 @@ Token::Value Scanner::ScanString() {
 
   next().literal_chars.Start();
   while (true) {
-    AdvanceUntil([this](uc32 c0) {
+    // The string's characters are added to the literal a run at a time.
+    AdvanceUntilAddingLiteralChars([](uc32 c0) {
       if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-        if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
-          return true;
-        }
-        AddLiteralChar(c0);
-        return false;
+        return unibrow::IsStringLiteralLineTerminator(c0);
       }
-      uint8_t char_flags = character_scan_flags[c0];
-      if (MayTerminateString(char_flags)) return true;
-      AddLiteralChar(c0);
-      return false;
+      return MayTerminateString(character_scan_flags[c0]);
     });
 
     while (c0_ == '\\') {
@@ -93,6 +93,33 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil, but also passes each run of code units skipped within
+  // a buffered block to {on_run}, so callers can consume it in one go instead
+  // of one code unit at a time.
+  template <typename CheckFunction, typename RunFunction>
+  V8_INLINE uc32 AdvanceUntil(CheckFunction check, RunFunction on_run) {
+    while (true) {
+      const uint16_t* run_start = buffer_cursor_;
+      auto next_cursor_pos =
+          std::find_if(buffer_cursor_, buffer_end_, [&check](uint16_t raw_c0_) {
+            uc32 c0_ = static_cast<uc32>(raw_c0_);
+            return check(c0_);
+          });
+      on_run(run_start, next_cursor_pos);
+
+      if (next_cursor_pos == buffer_end_) {
+        buffer_cursor_ = buffer_end_;
+        if (!ReadBlockChecked()) {
+          buffer_cursor_++;
+          return kEndOfInput;
+        }
+      } else {
+        buffer_cursor_ = next_cursor_pos + 1;
+        return static_cast<uc32>(*next_cursor_pos);
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -529,6 +556,16 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  // Advances until {check} holds, adding all skipped code units to the
+  // current literal.
+  template <typename FunctionType>
+  V8_INLINE void AdvanceUntilAddingLiteralChars(FunctionType check) {
+    c0_ = source_->AdvanceUntil(
+        check, [this](const uint16_t* begin, const uint16_t* end) {
+          next().literal_chars.AddChars(begin, end);
+        });
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
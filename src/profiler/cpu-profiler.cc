@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "src/base/lazy-instance.h"
+#include "src/base/platform/wrappers.h"
 #include "src/base/template-utils.h"
 #include "src/debug/debug.h"
 #include "src/execution/frames-inl.h"
@@ -124,6 +125,13 @@ SamplingEventsProcessor::SamplingEventsProcessor(
       sampler_(new CpuSampler(isolate, this)),
       period_(period),
       use_precise_sampling_(use_precise_sampling) {
+  if (FLAG_cpu_profiler_pprof_file != nullptr) {
+    stack_table_ = std::make_unique<StackAggregationTable>(
+        code_observer->code_entries(), FLAG_cpu_profiler_pprof_stacks);
+    next_pprof_write_ =
+        base::TimeTicks::HighResolutionNow() +
+        base::TimeDelta::FromMilliseconds(FLAG_cpu_profiler_pprof_interval);
+  }
   sampler_->Start();
 }
 
@@ -234,6 +242,17 @@ void SamplingEventsProcessor::SymbolizeAndAddToProfiles(
       record->sample.timestamp, symbolized.stack_trace, symbolized.src_line,
       record->sample.update_stats, record->sample.sampling_interval,
       reinterpret_cast<Address>(record->sample.context));
+  if (stack_table_) {
+    stack_table_->AddStack(symbolized.stack_trace,
+                           record->sample.sampling_interval);
+  }
+}
+
+void SamplingEventsProcessor::WritePprofFile() {
+  FILE* file = base::OS::FOpen(FLAG_cpu_profiler_pprof_file, "wb");
+  if (file == nullptr) return;
+  stack_table_->WritePprof(file, period_);
+  base::Fclose(file);
 }
 
 ProfilerEventsProcessor::SampleProcessingResult
@@ -309,6 +328,15 @@ void SamplingEventsProcessor::Run() {
 
     // Schedule next sample.
     sampler_->DoSample();
+
+    // The aggregated stacks since the start of profiling are written out,
+    // replacing the previous contents of the file.
+    if (stack_table_ && now >= next_pprof_write_) {
+      WritePprofFile();
+      next_pprof_write_ =
+          now +
+          base::TimeDelta::FromMilliseconds(FLAG_cpu_profiler_pprof_interval);
+    }
   }
 
   // Process remaining tick events.
@@ -318,6 +346,8 @@ void SamplingEventsProcessor::Run() {
       result = ProcessOneSample();
     } while (result == OneSampleProcessed);
   } while (ProcessCodeEvent());
+
+  if (stack_table_) WritePprofFile();
 }
 
 void SamplingEventsProcessor::SetSamplingInterval(base::TimeDelta period) {
@@ -27,6 +27,7 @@ class CodeEntry;
 class CodeMap;
 class CpuProfilesCollection;
 class Isolate;
+class StackAggregationTable;
 class Symbolizer;
 
 #define CODE_EVENTS_TYPE_LIST(V)                 \
@@ -244,6 +245,7 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
  private:
   SampleProcessingResult ProcessOneSample() override;
   void SymbolizeAndAddToProfiles(const TickSampleEventRecord* record);
+  void WritePprofFile();
 
   static const size_t kTickSampleBufferSize = 512 * KB;
   static const size_t kTickSampleQueueLength =
@@ -254,6 +256,9 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
   base::TimeDelta period_;           // Samples & code events processing period.
   const bool use_precise_sampling_;  // Whether or not busy-waiting is used for
                                      // low sampling intervals on Windows.
+  // Stacks aggregated for --cpu-profiler-pprof-file, if given.
+  std::unique_ptr<StackAggregationTable> stack_table_;
+  base::TimeTicks next_pprof_write_;
 };
 
 // Builds and maintains a CodeMap tracking code objects on the VM heap. While
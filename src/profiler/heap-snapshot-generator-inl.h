@@ -30,20 +30,16 @@ int HeapEntry::set_children_index(int index) {
   return next_index;
 }
 
-void HeapEntry::add_child(HeapGraphEdge* edge) {
-  snapshot_->children()[children_end_index_++] = edge;
-}
-
-HeapGraphEdge* HeapEntry::child(int i) { return children_begin()[i]; }
+HeapGraphEdge* HeapEntry::child(int i) { return &children_begin()[i]; }
 
-std::vector<HeapGraphEdge*>::iterator HeapEntry::children_begin() const {
-  return index_ == 0 ? snapshot_->children().begin()
+std::deque<HeapGraphEdge>::iterator HeapEntry::children_begin() const {
+  return index_ == 0 ? snapshot_->edges().begin()
                      : snapshot_->entries()[index_ - 1].children_end();
 }
 
-std::vector<HeapGraphEdge*>::iterator HeapEntry::children_end() const {
+std::deque<HeapGraphEdge>::iterator HeapEntry::children_end() const {
   DCHECK_GE(children_end_index_, 0);
-  return snapshot_->children().begin() + children_end_index_;
+  return snapshot_->edges().begin() + children_end_index_;
 }
 
 int HeapEntry::children_count() const {
@@ -124,7 +124,7 @@ void HeapEntry::Print(const char* prefix, const char* edge_name, int max_depth,
   }
   if (--max_depth == 0) return;
   for (auto i = children_begin(); i != children_end(); ++i) {
-    HeapGraphEdge& edge = **i;
+    HeapGraphEdge& edge = *i;
     const char* edge_prefix = "";
     base::EmbeddedVector<char, 64> index;
     const char* edge_name = index.begin();
@@ -258,16 +258,29 @@ HeapEntry* HeapSnapshot::AddEntry(HeapEntry::Type type,
 }
 
 void HeapSnapshot::FillChildren() {
-  DCHECK(children().empty());
+  DCHECK(!is_complete());
+  // Order the edges by their from entry in place, instead of keeping a
+  // separate vector of pointers to them. The children of each entry must
+  // stay in the order in which the edges were added, so first compute the
+  // final position of every edge with a stable counting sort, then apply
+  // that permutation cycle by cycle.
   int children_index = 0;
   for (HeapEntry& entry : entries()) {
     children_index = entry.set_children_index(children_index);
   }
   DCHECK_EQ(edges().size(), static_cast<size_t>(children_index));
-  children().resize(edges().size());
-  for (HeapGraphEdge& edge : edges()) {
-    edge.from()->add_child(&edge);
+  std::vector<int> destinations(edges_.size());
+  for (size_t i = 0; i < edges_.size(); ++i) {
+    destinations[i] = edges_[i].from()->children_end_index_++;
+  }
+  for (int i = 0; i < static_cast<int>(destinations.size()); ++i) {
+    while (destinations[i] != i) {
+      const int destination = destinations[i];
+      std::swap(edges_[i], edges_[destination]);
+      std::swap(destinations[i], destinations[destination]);
+    }
   }
+  is_complete_ = true;
 }
 
 HeapEntry* HeapSnapshot::GetEntryById(SnapshotObjectId id) {
@@ -2510,11 +2523,11 @@ void HeapSnapshotJSONSerializer::SerializeEdge(HeapGraphEdge* edge,
 }
 
 void HeapSnapshotJSONSerializer::SerializeEdges() {
-  std::vector<HeapGraphEdge*>& edges = snapshot_->children();
+  std::deque<HeapGraphEdge>& edges = snapshot_->edges();
   for (size_t i = 0; i < edges.size(); ++i) {
     DCHECK(i == 0 ||
-           edges[i - 1]->from()->index() <= edges[i]->from()->index());
-    SerializeEdge(edges[i], i == 0);
+           edges[i - 1].from()->index() <= edges[i].from()->index());
+    SerializeEdge(&edges[i], i == 0);
     if (writer_->aborted()) return;
   }
 }
@@ -131,7 +131,6 @@ class HeapEntry {
   int index() const { return index_; }
   V8_INLINE int children_count() const;
   V8_INLINE int set_children_index(int index);
-  V8_INLINE void add_child(HeapGraphEdge* edge);
   V8_INLINE HeapGraphEdge* child(int i);
   V8_INLINE Isolate* isolate() const;
 
@@ -156,10 +155,12 @@ class HeapEntry {
                                int max_depth, int indent) const;
 
  private:
-  V8_INLINE std::vector<HeapGraphEdge*>::iterator children_begin() const;
-  V8_INLINE std::vector<HeapGraphEdge*>::iterator children_end() const;
+  V8_INLINE std::deque<HeapGraphEdge>::iterator children_begin() const;
+  V8_INLINE std::deque<HeapGraphEdge>::iterator children_end() const;
   const char* TypeAsString() const;
 
+  friend class HeapSnapshot;
+
   unsigned type_: 4;
   unsigned index_ : 28;  // Supports up to ~250M objects.
   union {
@@ -204,13 +205,12 @@ class HeapSnapshot {
   const std::deque<HeapEntry>& entries() const { return entries_; }
   std::deque<HeapGraphEdge>& edges() { return edges_; }
   const std::deque<HeapGraphEdge>& edges() const { return edges_; }
-  std::vector<HeapGraphEdge*>& children() { return children_; }
   const std::vector<SourceLocation>& locations() const { return locations_; }
   void RememberLastJSObjectId();
   SnapshotObjectId max_snapshot_js_object_id() const {
     return max_snapshot_js_object_id_;
   }
-  bool is_complete() const { return !children_.empty(); }
+  bool is_complete() const { return is_complete_; }
   bool treat_global_objects_as_roots() const {
     return treat_global_objects_as_roots_;
   }
@@ -241,13 +241,15 @@ class HeapSnapshot {
   // backing storage, thus all entry pointers remain valid for the duration
   // of snapshotting.
   std::deque<HeapEntry> entries_;
+  // Once the snapshot is complete, |edges_| is ordered by the entry the
+  // edges start from, so the children of an entry are a range in it.
   std::deque<HeapGraphEdge> edges_;
-  std::vector<HeapGraphEdge*> children_;
   std::unordered_map<SnapshotObjectId, HeapEntry*> entries_by_id_cache_;
   std::vector<SourceLocation> locations_;
   SnapshotObjectId max_snapshot_js_object_id_ = -1;
   bool treat_global_objects_as_roots_;
   bool capture_numeric_value_;
+  bool is_complete_ = false;
 };
 
 
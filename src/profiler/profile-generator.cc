@@ -5,9 +5,13 @@
 #include "src/profiler/profile-generator.h"
 
 #include <algorithm>
+#include <string>
 
 #include "include/v8-profiler.h"
+#include "src/base/bits.h"
+#include "src/base/functional.h"
 #include "src/base/lazy-instance.h"
+#include "src/base/small-vector.h"
 #include "src/codegen/source-position.h"
 #include "src/objects/shared-function-info-inl.h"
 #include "src/profiler/cpu-profiler.h"
@@ -746,6 +750,251 @@ void CpuProfile::Print() const {
   ProfilerStats::Instance()->Clear();
 }
 
+namespace {
+
+// The number of frames per stack that StackAggregationTable reserves room
+// for, on average.
+const int kAverageStackDepth = 32;
+
+// Minimal encoder for the protocol buffer wire format, sufficient for
+// writing pprof profiles.
+class ProtoWriter {
+ public:
+  void WriteVarint(int field, uint64_t value) {
+    WriteTag(field, kVarintWireType);
+    WriteRawVarint(value);
+  }
+
+  void WriteBytes(int field, const char* data, size_t length) {
+    WriteTag(field, kLengthDelimitedWireType);
+    WriteRawVarint(length);
+    buffer_.append(data, length);
+  }
+
+  void WriteString(int field, const std::string& value) {
+    WriteBytes(field, value.data(), value.size());
+  }
+
+  void WriteMessage(int field, const ProtoWriter& message) {
+    WriteString(field, message.buffer_);
+  }
+
+  void WritePacked(int field, const std::vector<uint64_t>& values) {
+    ProtoWriter packed;
+    for (uint64_t value : values) packed.WriteRawVarint(value);
+    WriteMessage(field, packed);
+  }
+
+  const std::string& buffer() const { return buffer_; }
+
+ private:
+  static const int kVarintWireType = 0;
+  static const int kLengthDelimitedWireType = 2;
+
+  void WriteTag(int field, int wire_type) {
+    WriteRawVarint(static_cast<uint64_t>(field) << 3 | wire_type);
+  }
+
+  void WriteRawVarint(uint64_t value) {
+    while (value >= 0x80) {
+      buffer_.push_back(static_cast<char>(value | 0x80));
+      value >>= 7;
+    }
+    buffer_.push_back(static_cast<char>(value));
+  }
+
+  std::string buffer_;
+};
+
+// Field numbers of the messages in pprof's profile.proto.
+enum PprofField {
+  kProfileSampleType = 1,
+  kProfileSample = 2,
+  kProfileLocation = 4,
+  kProfileFunction = 5,
+  kProfileStringTable = 6,
+  kProfileTimeNanos = 9,
+  kProfileDurationNanos = 10,
+  kProfilePeriodType = 11,
+  kProfilePeriod = 12,
+  kValueTypeType = 1,
+  kValueTypeUnit = 2,
+  kSampleLocationId = 1,
+  kSampleValue = 2,
+  kLocationId = 1,
+  kLocationLine = 4,
+  kLineFunctionId = 1,
+  kLineLine = 2,
+  kFunctionId = 1,
+  kFunctionName = 2,
+  kFunctionFilename = 4,
+  kFunctionStartLine = 5,
+};
+
+// Collects the string table of a pprof profile, whose first entry has to be
+// the empty string.
+class PprofStrings {
+ public:
+  PprofStrings() { Get(""); }
+
+  uint64_t Get(const char* string) {
+    auto result =
+        indices_.emplace(string ? string : "", static_cast<int>(table_.size()));
+    if (result.second) table_.push_back(result.first->first);
+    return result.first->second;
+  }
+
+  void WriteTo(ProtoWriter* profile) const {
+    for (const std::string& string : table_) {
+      profile->WriteString(kProfileStringTable, string);
+    }
+  }
+
+ private:
+  std::unordered_map<std::string, int> indices_;
+  std::vector<std::string> table_;
+};
+
+}  // namespace
+
+StackAggregationTable::StackAggregationTable(CodeEntryStorage* code_entries,
+                                             int capacity)
+    : code_entries_(code_entries),
+      capacity_(capacity),
+      entries_(base::bits::RoundUpToPowerOfTwo32(2 * capacity),
+               Entry{0, kEmpty, 0, 0, 0}),
+      frames_(static_cast<size_t>(capacity) * kAverageStackDepth),
+      start_time_(base::Time::Now()) {
+  DCHECK_GT(capacity, 0);
+}
+
+StackAggregationTable::~StackAggregationTable() { Clear(); }
+
+bool StackAggregationTable::AddStack(const ProfileStackTrace& path,
+                                     base::TimeDelta weight) {
+  const int frame_count = path.size() < static_cast<size_t>(kMaxFrames)
+                              ? static_cast<int>(path.size())
+                              : kMaxFrames;
+  size_t hash = 0;
+  for (int i = 0; i < frame_count; i++) {
+    hash = base::hash_combine(
+        hash, reinterpret_cast<size_t>(path[i].code_entry) ^
+                  static_cast<size_t>(path[i].line_number));
+  }
+  const uint32_t hash32 = static_cast<uint32_t>(hash);
+  const size_t mask = entries_.size() - 1;
+  for (size_t index = hash32 & mask;; index = (index + 1) & mask) {
+    Entry& entry = entries_[index];
+    if (entry.first_frame == kEmpty) {
+      // There is always at least one empty entry, as the table has twice
+      // the capacity.
+      if (size_ == capacity_ ||
+          used_frames_ + frame_count > static_cast<int>(frames_.size())) {
+        dropped_samples_++;
+        return false;
+      }
+      entry = Entry{hash32, used_frames_, frame_count, 0, 0};
+      for (int i = 0; i < frame_count; i++) {
+        frames_[used_frames_++] = path[i];
+        code_entries_->AddRef(path[i].code_entry);
+      }
+      size_++;
+    } else if (entry.hash != hash32 || entry.frame_count != frame_count ||
+               !std::equal(path.begin(), path.begin() + frame_count,
+                           frames_.begin() + entry.first_frame,
+                           [](const CodeEntryAndLineNumber& a,
+                              const CodeEntryAndLineNumber& b) {
+                             return a.code_entry == b.code_entry &&
+                                    a.line_number == b.line_number;
+                           })) {
+      continue;
+    }
+    entry.samples++;
+    entry.nanoseconds += weight.InNanoseconds();
+    return true;
+  }
+}
+
+void StackAggregationTable::WritePprof(FILE* file,
+                                       base::TimeDelta period) const {
+  ProtoWriter profile;
+  PprofStrings strings;
+
+  ProtoWriter samples_type;
+  samples_type.WriteVarint(kValueTypeType, strings.Get("samples"));
+  samples_type.WriteVarint(kValueTypeUnit, strings.Get("count"));
+  profile.WriteMessage(kProfileSampleType, samples_type);
+  ProtoWriter cpu_type;
+  cpu_type.WriteVarint(kValueTypeType, strings.Get("cpu"));
+  cpu_type.WriteVarint(kValueTypeUnit, strings.Get("nanoseconds"));
+  profile.WriteMessage(kProfileSampleType, cpu_type);
+
+  // Functions are identified by their code entry, locations by the code
+  // entry and line. Ids are 1-based, as 0 means "absent" in pprof.
+  std::unordered_map<const CodeEntry*, uint64_t> function_ids;
+  std::map<std::pair<const CodeEntry*, int>, uint64_t> location_ids;
+  for (const Entry& entry : entries_) {
+    if (entry.first_frame == kEmpty) continue;
+    std::vector<uint64_t> stack;
+    stack.reserve(entry.frame_count);
+    for (int i = 0; i < entry.frame_count; i++) {
+      const CodeEntryAndLineNumber& frame = frames_[entry.first_frame + i];
+      const CodeEntry* code_entry = frame.code_entry;
+      auto function = function_ids.emplace(code_entry, function_ids.size() + 1);
+      if (function.second) {
+        ProtoWriter message;
+        message.WriteVarint(kFunctionId, function.first->second);
+        message.WriteVarint(kFunctionName, strings.Get(code_entry->name()));
+        message.WriteVarint(kFunctionFilename,
+                            strings.Get(code_entry->resource_name()));
+        message.WriteVarint(kFunctionStartLine, code_entry->line_number());
+        profile.WriteMessage(kProfileFunction, message);
+      }
+      auto location = location_ids.emplace(
+          std::make_pair(code_entry, frame.line_number),
+          location_ids.size() + 1);
+      if (location.second) {
+        ProtoWriter line;
+        line.WriteVarint(kLineFunctionId, function.first->second);
+        line.WriteVarint(kLineLine, frame.line_number);
+        ProtoWriter message;
+        message.WriteVarint(kLocationId, location.first->second);
+        message.WriteMessage(kLocationLine, line);
+        profile.WriteMessage(kProfileLocation, message);
+      }
+      stack.push_back(location.first->second);
+    }
+    ProtoWriter sample;
+    sample.WritePacked(kSampleLocationId, stack);
+    sample.WritePacked(kSampleValue,
+                       {static_cast<uint64_t>(entry.samples),
+                        static_cast<uint64_t>(entry.nanoseconds)});
+    profile.WriteMessage(kProfileSample, sample);
+  }
+  base::Time now = base::Time::Now();
+  profile.WriteVarint(kProfileTimeNanos,
+                      (start_time_ - base::Time::UnixEpoch()).InNanoseconds());
+  profile.WriteVarint(kProfileDurationNanos,
+                      (now - start_time_).InNanoseconds());
+  profile.WriteMessage(kProfilePeriodType, cpu_type);
+  profile.WriteVarint(kProfilePeriod, period.InNanoseconds());
+  strings.WriteTo(&profile);
+
+  const std::string& buffer = profile.buffer();
+  fwrite(buffer.data(), 1, buffer.size(), file);
+}
+
+void StackAggregationTable::Clear() {
+  for (int i = 0; i < used_frames_; i++) {
+    code_entries_->DecRef(frames_[i].code_entry);
+  }
+  std::fill(entries_.begin(), entries_.end(), Entry{0, kEmpty, 0, 0, 0});
+  used_frames_ = 0;
+  size_ = 0;
+  dropped_samples_ = 0;
+  start_time_ = base::Time::Now();
+}
+
 void CodeEntryStorage::AddRef(CodeEntry* entry) {
   if (entry->is_ref_counted()) entry->AddRef();
 }
@@ -762,58 +1011,157 @@ CodeMap::CodeMap(CodeEntryStorage& storage) : code_entries_(storage) {}
 CodeMap::~CodeMap() { Clear(); }
 
 void CodeMap::Clear() {
-  for (auto& slot : code_map_) {
-    if (CodeEntry* entry = slot.second.entry) {
-      code_entries_.DecRef(entry);
-    } else {
+  for (auto& region : regions_) {
+    for (CodeEntrySlot& slot : region.second) {
       // We expect all entries in the code mapping to contain a CodeEntry.
-      UNREACHABLE();
+      CHECK_NOT_NULL(slot.info.entry);
+      code_entries_.DecRef(slot.info.entry);
     }
   }
+  for (auto& slot : large_code_map_) {
+    CHECK_NOT_NULL(slot.second.entry);
+    code_entries_.DecRef(slot.second.entry);
+  }
 
-  code_map_.clear();
+  regions_.clear();
+  large_code_map_.clear();
+  size_ = 0;
+}
+
+void CodeMap::Insert(Address addr, CodeEntryMapInfo info) {
+  size_++;
+  if (info.size > kRegionSize) {
+    large_code_map_.emplace(addr, info);
+    return;
+  }
+  Region& region = regions_[RegionIndex(addr)];
+  // Insert after code with the same start address, like a multimap would.
+  auto it = region.end();
+  if (!region.empty() && region.back().start > addr) {
+    it = std::upper_bound(
+        region.begin(), region.end(), addr,
+        [](Address a, const CodeEntrySlot& slot) { return a < slot.start; });
+  }
+  region.insert(it, CodeEntrySlot{addr, info});
 }
 
 void CodeMap::AddCode(Address addr, CodeEntry* entry, unsigned size) {
-  code_map_.emplace(addr, CodeEntryMapInfo{entry, size});
+  Insert(addr, CodeEntryMapInfo{entry, size});
   entry->set_instruction_start(addr);
 }
 
 bool CodeMap::RemoveCode(CodeEntry* entry) {
-  auto range = code_map_.equal_range(entry->instruction_start());
+  Address addr = entry->instruction_start();
+  auto region_it = regions_.find(RegionIndex(addr));
+  if (region_it != regions_.end()) {
+    Region& region = region_it->second;
+    for (auto i = region.begin(); i != region.end(); ++i) {
+      if (i->start == addr && i->info.entry == entry) {
+        code_entries_.DecRef(entry);
+        region.erase(i);
+        if (region.empty()) regions_.erase(region_it);
+        size_--;
+        return true;
+      }
+    }
+  }
+  auto range = large_code_map_.equal_range(addr);
   for (auto i = range.first; i != range.second; ++i) {
     if (i->second.entry == entry) {
       code_entries_.DecRef(entry);
-      code_map_.erase(i);
+      large_code_map_.erase(i);
+      size_--;
       return true;
     }
   }
   return false;
 }
 
+void CodeMap::ClearCodesInRange(Region* region, Address start, Address end) {
+  auto new_end = std::remove_if(
+      region->begin(), region->end(), [&](const CodeEntrySlot& slot) {
+        if (slot.start >= end || slot.start + slot.info.size <= start) {
+          return false;
+        }
+        code_entries_.DecRef(slot.info.entry);
+        return true;
+      });
+  size_ -= region->end() - new_end;
+  region->erase(new_end, region->end());
+}
+
 void CodeMap::ClearCodesInRange(Address start, Address end) {
-  auto left = code_map_.upper_bound(start);
-  if (left != code_map_.begin()) {
-    --left;
-    if (left->first + left->second.size <= start) ++left;
+  if (start >= end) return;
+  // Code containing {start} may start in the region before it.
+  Address first = RegionIndex(start);
+  if (first > 0) first--;
+  Address last = RegionIndex(end - 1);
+  if (last - first < regions_.size()) {
+    for (Address index = first; index <= last; index++) {
+      auto it = regions_.find(index);
+      if (it == regions_.end()) continue;
+      ClearCodesInRange(&it->second, start, end);
+      if (it->second.empty()) regions_.erase(it);
+    }
+  } else {
+    for (auto it = regions_.begin(); it != regions_.end();) {
+      ClearCodesInRange(&it->second, start, end);
+      if (it->second.empty()) {
+        it = regions_.erase(it);
+      } else {
+        ++it;
+      }
+    }
   }
-  auto right = left;
-  for (; right != code_map_.end() && right->first < end; ++right) {
-    code_entries_.DecRef(right->second.entry);
+  for (auto it = large_code_map_.begin();
+       it != large_code_map_.end() && it->first < end;) {
+    if (it->first + it->second.size > start) {
+      code_entries_.DecRef(it->second.entry);
+      it = large_code_map_.erase(it);
+      size_--;
+    } else {
+      ++it;
+    }
+  }
+}
+
+const CodeMap::CodeEntrySlot* CodeMap::FindSlot(Address addr) const {
+  auto it = regions_.find(RegionIndex(addr));
+  if (it != regions_.end()) {
+    const Region& region = it->second;
+    auto slot = std::upper_bound(
+        region.begin(), region.end(), addr,
+        [](Address a, const CodeEntrySlot& slot) { return a < slot.start; });
+    if (slot != region.begin()) return &*(slot - 1);
   }
-  code_map_.erase(left, right);
+  if (RegionIndex(addr) == 0) return nullptr;
+  it = regions_.find(RegionIndex(addr) - 1);
+  if (it == regions_.end()) return nullptr;
+  return &it->second.back();
 }
 
 CodeEntry* CodeMap::FindEntry(Address addr, Address* out_instruction_start) {
-  // Note that an address may correspond to multiple CodeEntry objects. An
-  // arbitrary selection is made (as per multimap spec) in the event of a
-  // collision.
-  auto it = code_map_.upper_bound(addr);
-  if (it == code_map_.begin()) return nullptr;
-  --it;
-  Address start_address = it->first;
-  Address end_address = start_address + it->second.size;
-  CodeEntry* ret = addr < end_address ? it->second.entry : nullptr;
+  // Note that an address may correspond to multiple CodeEntry objects. The
+  // most recently added one is returned in the event of a collision.
+  Address start_address = kNullAddress;
+  const CodeEntryMapInfo* info = nullptr;
+  if (const CodeEntrySlot* slot = FindSlot(addr)) {
+    start_address = slot->start;
+    info = &slot->info;
+  }
+  if (!large_code_map_.empty()) {
+    auto it = large_code_map_.upper_bound(addr);
+    if (it != large_code_map_.begin()) {
+      --it;
+      if (info == nullptr || it->first > start_address) {
+        start_address = it->first;
+        info = &it->second;
+      }
+    }
+  }
+  if (info == nullptr) return nullptr;
+  Address end_address = start_address + info->size;
+  CodeEntry* ret = addr < end_address ? info->entry : nullptr;
   DCHECK(!ret || (addr >= start_address && addr < end_address));
   if (ret && out_instruction_start) *out_instruction_start = start_address;
   return ret;
@@ -822,28 +1170,52 @@ CodeEntry* CodeMap::FindEntry(Address addr, Address* out_instruction_start) {
 void CodeMap::MoveCode(Address from, Address to) {
   if (from == to) return;
 
-  auto range = code_map_.equal_range(from);
-  // Instead of iterating until |range.second|, iterate the number of elements.
-  // This is because the |range.second| may no longer be the element past the
-  // end of the equal elements range after insertions.
-  size_t distance = std::distance(range.first, range.second);
-  auto it = range.first;
-  while (distance--) {
-    CodeEntryMapInfo& info = it->second;
+  base::SmallVector<CodeEntryMapInfo, 2> moved;
+  auto region_it = regions_.find(RegionIndex(from));
+  if (region_it != regions_.end()) {
+    Region& region = region_it->second;
+    auto range = std::equal_range(
+        region.begin(), region.end(), CodeEntrySlot{from, {}},
+        [](const CodeEntrySlot& a, const CodeEntrySlot& b) {
+          return a.start < b.start;
+        });
+    for (auto it = range.first; it != range.second; ++it) {
+      moved.push_back(it->info);
+    }
+    region.erase(range.first, range.second);
+    if (region.empty()) regions_.erase(region_it);
+  }
+  auto range = large_code_map_.equal_range(from);
+  for (auto it = range.first; it != range.second; ++it) {
+    moved.push_back(it->second);
+  }
+  large_code_map_.erase(range.first, range.second);
+
+  size_ -= moved.size();
+  for (const CodeEntryMapInfo& info : moved) {
     DCHECK(info.entry);
     DCHECK_EQ(info.entry->instruction_start(), from);
     info.entry->set_instruction_start(to);
 
     DCHECK(from + info.size <= to || to + info.size <= from);
-    code_map_.emplace(to, info);
-    it++;
+    Insert(to, info);
   }
-
-  code_map_.erase(range.first, it);
 }
 
 void CodeMap::Print() {
-  for (const auto& pair : code_map_) {
+  std::vector<const CodeEntrySlot*> slots;
+  for (const auto& region : regions_) {
+    for (const CodeEntrySlot& slot : region.second) slots.push_back(&slot);
+  }
+  std::sort(slots.begin(), slots.end(),
+            [](const CodeEntrySlot* a, const CodeEntrySlot* b) {
+              return a->start < b->start;
+            });
+  for (const CodeEntrySlot* slot : slots) {
+    base::OS::Print("%p %5d %s\n", reinterpret_cast<void*>(slot->start),
+                    slot->info.size, slot->info.entry->name());
+  }
+  for (const auto& pair : large_code_map_) {
     base::OS::Print("%p %5d %s\n", reinterpret_cast<void*>(pair.first),
                     pair.second.size, pair.second.entry->name());
   }
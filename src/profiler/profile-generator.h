@@ -6,6 +6,7 @@
 #define V8_PROFILER_PROFILE_GENERATOR_H_
 
 #include <atomic>
+#include <cstdio>
 #include <deque>
 #include <limits>
 #include <map>
@@ -477,6 +478,60 @@ class CpuProfileMaxSamplesCallbackTask : public v8::Task {
   std::unique_ptr<DiscardedSamplesDelegate> delegate_;
 };
 
+class CodeEntryStorage;
+
+// Aggregates sampled stacks into a hash table of fixed capacity which is
+// allocated up front, so that sampling can stay enabled for a long time
+// without building a call tree or allocating per sample. Only accessed from
+// the profiler events processing thread.
+class V8_EXPORT_PRIVATE StackAggregationTable {
+ public:
+  // Deeper stacks are truncated to their innermost frames.
+  static const int kMaxFrames = 128;
+
+  StackAggregationTable(CodeEntryStorage* code_entries, int capacity);
+  ~StackAggregationTable();
+  StackAggregationTable(const StackAggregationTable&) = delete;
+  StackAggregationTable& operator=(const StackAggregationTable&) = delete;
+
+  // Adds a sample of {path} that accounts for {weight} of CPU time. Returns
+  // false if the table has no room left for a new stack and the sample was
+  // dropped.
+  bool AddStack(const ProfileStackTrace& path, base::TimeDelta weight);
+
+  // Writes the aggregated stacks as an uncompressed pprof profile.proto
+  // message.
+  void WritePprof(FILE* file, base::TimeDelta period) const;
+
+  void Clear();
+
+  int size() const { return size_; }
+  int dropped_samples() const { return dropped_samples_; }
+
+ private:
+  struct Entry {
+    uint32_t hash;
+    // Frames of the stack, innermost first, in {frames_}.
+    int first_frame;
+    int frame_count;
+    int64_t samples;
+    int64_t nanoseconds;
+  };
+
+  static const int kEmpty = -1;
+
+  CodeEntryStorage* const code_entries_;
+  const int capacity_;
+  // Open-addressed with linear probing, twice the capacity to keep probe
+  // sequences short.
+  std::vector<Entry> entries_;
+  std::vector<CodeEntryAndLineNumber> frames_;
+  int used_frames_ = 0;
+  int size_ = 0;
+  int dropped_samples_ = 0;
+  base::Time start_time_;
+};
+
 class V8_EXPORT_PRIVATE CodeMap {
  public:
   explicit CodeMap(CodeEntryStorage& storage);
@@ -494,7 +549,7 @@ class V8_EXPORT_PRIVATE CodeMap {
   void ClearCodesInRange(Address start, Address end);
   CodeEntry* FindEntry(Address addr, Address* out_instruction_start = nullptr);
   void Print();
-  size_t size() const { return code_map_.size(); }
+  size_t size() const { return size_; }
 
   CodeEntryStorage& code_entries() { return code_entries_; }
 
@@ -506,7 +561,36 @@ class V8_EXPORT_PRIVATE CodeMap {
     unsigned size;
   };
 
-  std::multimap<Address, CodeEntryMapInfo> code_map_;
+  struct CodeEntrySlot {
+    Address start;
+    CodeEntryMapInfo info;
+  };
+
+  // Code is bucketed by the aligned region of kRegionSize bytes that its start
+  // address lies in, and each region keeps its code sorted by start address.
+  // Finding the code for an address is thus a hash lookup and a binary search
+  // in a small vector, and moving code during compaction, which fills the
+  // target pages in address order, mostly appends to a region. Code that is
+  // larger than a region is kept in {large_code_map_}, so that other code
+  // containing an address starts in the region of the address or the one
+  // before it.
+  using Region = std::vector<CodeEntrySlot>;
+  static constexpr int kRegionSizeLog2 = 18;
+  static constexpr size_t kRegionSize = size_t{1} << kRegionSizeLog2;
+
+  static Address RegionIndex(Address addr) { return addr >> kRegionSizeLog2; }
+
+  void Insert(Address addr, CodeEntryMapInfo info);
+  // Returns the slot of the code that starts last at or before {addr}, if it
+  // is in a region, or nullptr.
+  const CodeEntrySlot* FindSlot(Address addr) const;
+  // Removes the code that starts in [start, end) or contains {start} from
+  // {region}.
+  void ClearCodesInRange(Region* region, Address start, Address end);
+
+  std::unordered_map<Address, Region> regions_;
+  std::multimap<Address, CodeEntryMapInfo> large_code_map_;
+  size_t size_ = 0;
   CodeEntryStorage& code_entries_;
 };
 
@@ -283,11 +283,13 @@ const std::vector<v8::AllocationProfile::Sample>
 SamplingHeapProfiler::BuildSamples() const {
   std::vector<v8::AllocationProfile::Sample> samples;
   samples.reserve(samples_.size());
+  const int gc_count = heap_->gc_count();
   for (const auto& it : samples_) {
     const Sample* sample = it.second.get();
     samples.emplace_back(v8::AllocationProfile::Sample{
         sample->owner->id_, sample->size, ScaleSample(sample->size, 1).count,
-        sample->sample_id});
+        sample->sample_id,
+        static_cast<unsigned int>(gc_count - sample->gc_count)});
   }
   return samples;
 }
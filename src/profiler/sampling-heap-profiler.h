@@ -106,7 +106,8 @@ class SamplingHeapProfiler {
           owner(owner_),
           global(reinterpret_cast<v8::Isolate*>(profiler_->isolate_), local_),
           profiler(profiler_),
-          sample_id(sample_id) {}
+          sample_id(sample_id),
+          gc_count(profiler_->heap_->gc_count()) {}
     Sample(const Sample&) = delete;
     Sample& operator=(const Sample&) = delete;
     const size_t size;
@@ -114,6 +115,8 @@ class SamplingHeapProfiler {
     Global<Value> global;
     SamplingHeapProfiler* const profiler;
     const uint64_t sample_id;
+    // The heap's GC count at allocation time, to derive the survival age.
+    const int gc_count;
   };
 
   SamplingHeapProfiler(Heap* heap, StringsStorage* names, uint64_t rate,
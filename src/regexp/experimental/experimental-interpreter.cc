@@ -6,6 +6,7 @@
 
 #include "src/base/optional.h"
 #include "src/common/assert-scope.h"
+#include "src/flags/flags.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/regexp/experimental/experimental.h"
@@ -151,12 +152,15 @@ class NfaInterpreter {
         blocked_threads_(0, zone),
         register_array_allocator_(zone),
         best_match_registers_(base::nullopt),
-        zone_(zone) {
+        zone_(zone),
+        first_char_ranges_(0, zone) {
     DCHECK(!bytecode_.empty());
     DCHECK_GE(input_index_, 0);
     DCHECK_LE(input_index_, input_.length());
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(), -1);
+    can_skip_ =
+        FLAG_experimental_regexp_engine_skip && ComputeFirstCharRanges();
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -218,6 +222,8 @@ class NfaInterpreter {
     int* register_array_begin;
   };
 
+  static constexpr int kTicksBetweenInterruptHandling = 64;
+
   // Handles pending interrupts if there are any.  Returns
   // RegExp::kInternalRegExpSuccess if execution can continue, and an error
   // code otherwise.
@@ -344,9 +350,13 @@ class NfaInterpreter {
            !(FoundMatch() && blocked_threads_.is_empty())) {
       DCHECK(active_threads_.is_empty());
       uc16 input_char = input_[input_index_];
+      if (can_skip_ && !FoundMatch() && OnlyPreambleConsumes(input_char)) {
+        int err_code = SkipToNextPossibleMatchStart();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+        continue;
+      }
       ++input_index_;
 
-      static constexpr int kTicksBetweenInterruptHandling = 64;
       if (input_index_ % kTicksBetweenInterruptHandling == 0) {
         int err_code = HandleInterrupts();
         if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
@@ -362,6 +372,127 @@ class NfaInterpreter {
     return RegExp::kInternalRegExpSuccess;
   }
 
+  // The bytecode of a regexp that is not anchored at the start begins with a
+  // preamble corresponding to /.*?/ (see `CompileVisitor::Compile`):
+  //
+  //   0: FORK 2
+  //   1: JMP 4
+  //   2: CONSUME_RANGE [0x0000, 0xFFFF]
+  //   3: FORK 2
+  //   4: <body>
+  //
+  // Whenever the preamble thread is the only thread that survives an input
+  // character, the interpreter state at the next input index is exactly the
+  // state of a fresh search starting there.  If additionally the body must
+  // consume a character before it can ACCEPT or check an assertion, all
+  // positions whose character cannot be consumed first by the body can be
+  // skipped without running any threads.
+  static constexpr int kPreambleConsumePc = 2;
+  static constexpr int kBodyStartPc = 4;
+
+  // Collects the ranges of characters the body can consume first into
+  // `first_char_ranges_`.  Returns false if the bytecode has no preamble or
+  // the body does not need to consume a character first.
+  bool ComputeFirstCharRanges() {
+    if (bytecode_.length() <= kBodyStartPc) return false;
+    RegExpInstruction fork = bytecode_[0];
+    RegExpInstruction jmp = bytecode_[1];
+    RegExpInstruction consume = bytecode_[kPreambleConsumePc];
+    RegExpInstruction loop = bytecode_[3];
+    if (fork.opcode != RegExpInstruction::FORK ||
+        fork.payload.pc != kPreambleConsumePc ||
+        jmp.opcode != RegExpInstruction::JMP ||
+        jmp.payload.pc != kBodyStartPc ||
+        consume.opcode != RegExpInstruction::CONSUME_RANGE ||
+        consume.payload.consume_range.min != 0x0000 ||
+        consume.payload.consume_range.max != 0xFFFF ||
+        loop.opcode != RegExpInstruction::FORK ||
+        loop.payload.pc != kPreambleConsumePc) {
+      return false;
+    }
+
+    // Explore all instructions reachable from the body start without
+    // consuming input.
+    ZoneList<int> worklist(1, zone_);
+    base::Vector<bool> visited =
+        base::Vector<bool>(zone_->NewArray<bool>(bytecode_.length()),
+                           bytecode_.length());
+    std::fill(visited.begin(), visited.end(), false);
+    worklist.Add(kBodyStartPc, zone_);
+    while (!worklist.is_empty()) {
+      int pc = worklist.RemoveLast();
+      if (visited[pc]) continue;
+      visited[pc] = true;
+      RegExpInstruction inst = bytecode_[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+          if (pc == kPreambleConsumePc) return false;
+          first_char_ranges_.Add(inst.payload.consume_range, zone_);
+          break;
+        case RegExpInstruction::ACCEPT:
+        case RegExpInstruction::ASSERTION:
+          return false;
+        case RegExpInstruction::FORK:
+          worklist.Add(inst.payload.pc, zone_);
+          worklist.Add(pc + 1, zone_);
+          break;
+        case RegExpInstruction::JMP:
+          worklist.Add(inst.payload.pc, zone_);
+          break;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::CLEAR_REGISTER:
+          worklist.Add(pc + 1, zone_);
+          break;
+      }
+    }
+    return true;
+  }
+
+  // Whether `c` can be the first character consumed by the body.
+  bool MayStartMatch(uc16 c) const {
+    for (const RegExpInstruction::Uc16Range& range : first_char_ranges_) {
+      if (c >= range.min && c <= range.max) return true;
+    }
+    return false;
+  }
+
+  // Whether every blocked thread except the preamble thread fails to consume
+  // `c`.
+  bool OnlyPreambleConsumes(uc16 c) const {
+    for (const InterpreterThread& t : blocked_threads_) {
+      if (t.pc == kPreambleConsumePc) continue;
+      RegExpInstruction::Uc16Range range =
+          bytecode_[t.pc].payload.consume_range;
+      if (c >= range.min && c <= range.max) return false;
+    }
+    return true;
+  }
+
+  // Called if only the preamble thread survives the character at
+  // `input_index_`.  Skips to the next position at which a match can start and
+  // restarts the search there.
+  int SkipToNextPossibleMatchStart() {
+    int index = input_index_ + 1;
+    while (index != input_.length() && !MayStartMatch(input_[index])) {
+      ++index;
+      if (index % kTicksBetweenInterruptHandling == 0) {
+        int err_code = HandleInterrupts();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      }
+    }
+
+    for (InterpreterThread t : blocked_threads_) {
+      DestroyThread(t);
+    }
+    blocked_threads_.DropAndClear();
+
+    SetInputIndex(index);
+    active_threads_.Add(
+        InterpreterThread{0, NewRegisterArray(kUndefinedRegisterValue)}, zone_);
+    RunActiveThreads();
+    return RegExp::kInternalRegExpSuccess;
+  }
+
   // Run an active thread `t` until it executes a CONSUME_RANGE or ACCEPT
   // instruction, or its PC value was already processed.
   // - If processing of `t` can't continue because of CONSUME_RANGE, it is
@@ -550,6 +681,10 @@ class NfaInterpreter {
   base::Optional<base::Vector<int>> best_match_registers_;
 
   Zone* zone_;
+
+  // See `ComputeFirstCharRanges`.
+  ZoneList<RegExpInstruction::Uc16Range> first_char_ranges_;
+  bool can_skip_ = false;
 };
 
 }  // namespace
@@ -1421,19 +1421,24 @@ void CharacterRange::Negate(ZoneList<CharacterRange>* ranges,
 class RegExpExpansionLimiter {
  public:
   static const int kMaxExpansionFactor = 6;
+  // Regexps that are hot enough to be compiled with optimize_hot() may grow
+  // further.
+  static const int kMaxHotExpansionFactor = 16;
   RegExpExpansionLimiter(RegExpCompiler* compiler, int factor)
       : compiler_(compiler),
+        max_factor_(compiler->optimize_hot() ? kMaxHotExpansionFactor
+                                             : kMaxExpansionFactor),
         saved_expansion_factor_(compiler->current_expansion_factor()),
-        ok_to_expand_(saved_expansion_factor_ <= kMaxExpansionFactor) {
+        ok_to_expand_(saved_expansion_factor_ <= max_factor_) {
     DCHECK_LT(0, factor);
     if (ok_to_expand_) {
-      if (factor > kMaxExpansionFactor) {
+      if (factor > max_factor_) {
         // Avoid integer overflow of the current expansion factor.
         ok_to_expand_ = false;
-        compiler->set_current_expansion_factor(kMaxExpansionFactor + 1);
+        compiler->set_current_expansion_factor(max_factor_ + 1);
       } else {
         int new_factor = saved_expansion_factor_ * factor;
-        ok_to_expand_ = (new_factor <= kMaxExpansionFactor);
+        ok_to_expand_ = (new_factor <= max_factor_);
         compiler->set_current_expansion_factor(new_factor);
       }
     }
@@ -1447,6 +1452,7 @@ class RegExpExpansionLimiter {
 
  private:
   RegExpCompiler* compiler_;
+  const int max_factor_;
   int saved_expansion_factor_;
   bool ok_to_expand_;
 
@@ -1479,6 +1485,14 @@ RegExpNode* RegExpQuantifier::ToNode(int min, int max, bool is_greedy,
   // this case.
   static const int kMaxUnrolledMinMatches = 3;  // Unroll (foo)+ and (foo){3,}
   static const int kMaxUnrolledMaxMatches = 3;  // Unroll (foo)? and (foo){x,3}
+  // Hot regexps unroll further, trading code size for fewer loop iterations.
+  static const int kMaxHotUnrolledMatches = 8;
+  const int max_unrolled_min_matches =
+      compiler->optimize_hot() ? kMaxHotUnrolledMatches
+                               : kMaxUnrolledMinMatches;
+  const int max_unrolled_max_matches =
+      compiler->optimize_hot() ? kMaxHotUnrolledMatches
+                               : kMaxUnrolledMaxMatches;
   if (max == 0) return on_success;  // This can happen due to recursion.
   bool body_can_be_empty = (body->min_match() == 0);
   int body_start_reg = RegExpCompiler::kNoRegister;
@@ -1493,7 +1507,8 @@ RegExpNode* RegExpQuantifier::ToNode(int min, int max, bool is_greedy,
     // empty.
     {
       RegExpExpansionLimiter limiter(compiler, min + ((max != min) ? 1 : 0));
-      if (min > 0 && min <= kMaxUnrolledMinMatches && limiter.ok_to_expand()) {
+      if (min > 0 && min <= max_unrolled_min_matches &&
+          limiter.ok_to_expand()) {
         int new_max = (max == kInfinity) ? max : max - min;
         // Recurse once to get the loop or optional matches after the fixed
         // ones.
@@ -1508,7 +1523,7 @@ RegExpNode* RegExpQuantifier::ToNode(int min, int max, bool is_greedy,
         return answer;
       }
     }
-    if (max <= kMaxUnrolledMaxMatches && min == 0) {
+    if (max <= max_unrolled_max_matches && min == 0) {
       DCHECK_LT(0, max);  // Due to the 'if' above.
       RegExpExpansionLimiter limiter(compiler, max);
       if (limiter.ok_to_expand()) {
@@ -250,6 +250,7 @@ RegExpCompiler::RegExpCompiler(Isolate* isolate, Zone* zone, int capture_count,
       reg_exp_too_big_(false),
       limiting_recursion_(false),
       optimize_(FLAG_regexp_optimization),
+      optimize_hot_(false),
       read_backward_(false),
       current_expansion_factor_(1),
       frequency_collator_(),
@@ -2893,6 +2894,11 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
   }
 
   if (found_single_character) {
+    uint32_t mask = max_char_ > kSize ? RegExpMacroAssembler::kTableMask
+                                      : String::kMaxUtf16CodeUnit;
+    if (FLAG_regexp_simd_skip) {
+      masm->SkipUntilCharacterAfterAnd(max_lookahead, single_character, mask);
+    }
     Label cont, again;
     masm->Bind(&again);
     masm->LoadCurrentCharacter(max_lookahead, &cont, true);
@@ -557,6 +557,10 @@ class RegExpCompiler {
   inline bool one_byte() { return one_byte_; }
   inline bool optimize() { return optimize_; }
   inline void set_optimize(bool value) { optimize_ = value; }
+  // Whether to spend more code size on unrolling loops; used for regexps that
+  // have proven to be hot in the interpreter.
+  inline bool optimize_hot() { return optimize_hot_; }
+  inline void set_optimize_hot(bool value) { optimize_hot_ = value; }
   inline bool limiting_recursion() { return limiting_recursion_; }
   inline void set_limiting_recursion(bool value) {
     limiting_recursion_ = value;
@@ -587,6 +591,7 @@ class RegExpCompiler {
   bool reg_exp_too_big_;
   bool limiting_recursion_;
   bool optimize_;
+  bool optimize_hot_;
   bool read_backward_;
   int current_expansion_factor_;
   FrequencyCollator frequency_collator_;
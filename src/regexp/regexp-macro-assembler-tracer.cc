@@ -339,6 +339,14 @@ void RegExpMacroAssemblerTracer::CheckBitInTable(
   assembler_->CheckBitInTable(table, on_bit_set);
 }
 
+void RegExpMacroAssemblerTracer::SkipUntilCharacterAfterAnd(int cp_offset,
+                                                            uint32_t c,
+                                                            uint32_t mask) {
+  PrintF(" SkipUntilCharacterAfterAnd(cp_offset=%d, c=0x%04x, mask=0x%04x);\n",
+         cp_offset, c, mask);
+  assembler_->SkipUntilCharacterAfterAnd(cp_offset, c, mask);
+}
+
 
 void RegExpMacroAssemblerTracer::CheckNotBackReference(int start_reg,
                                                        bool read_backward,
@@ -44,6 +44,8 @@ class RegExpMacroAssemblerTracer: public RegExpMacroAssembler {
   void CheckCharacterNotInRange(uc16 from, uc16 to,
                                 Label* on_not_in_range) override;
   void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set) override;
+  void SkipUntilCharacterAfterAnd(int cp_offset, uint32_t c,
+                                  uint32_t mask) override;
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
   bool CheckSpecialCharacterClass(uc16 type, Label* on_no_match) override;
   void Fail() override;
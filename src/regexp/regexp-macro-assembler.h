@@ -130,6 +130,14 @@ class RegExpMacroAssembler {
   // array, and if the found byte is non-zero, we jump to the on_bit_set label.
   virtual void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set) = 0;
 
+  // Advances the current position past positions at which the character at
+  // {cp_offset} from it, and'ed with {mask}, is not {c}. This is only a fast
+  // prefilter for the skip loop the caller emits right after it, so it may
+  // stop early (e.g. near the end of the input) or do nothing at all.
+  // May clobber the current loaded character.
+  virtual void SkipUntilCharacterAfterAnd(int cp_offset, uint32_t c,
+                                          uint32_t mask) {}
+
   // Checks whether the given offset from the current position is before
   // the end of the string.  May overwrite the current character.
   virtual void CheckPosition(int cp_offset, Label* on_outside_input);
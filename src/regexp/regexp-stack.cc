@@ -52,7 +52,21 @@ char* RegExpStack::RestoreStack(char* from) {
   return from + kThreadLocalSize;
 }
 
-void RegExpStack::Reset() { thread_local_.ResetToStaticStack(this); }
+void RegExpStack::Reset() {
+  // Patterns that backtrack deeply grow the stack on every execution; keep a
+  // moderately sized stack around so they don't have to.
+  if (thread_local_.owns_memory_ &&
+      thread_local_.memory_size_ <= FLAG_regexp_retained_stack_size * KB) {
+    thread_local_.is_in_use_ = false;
+    return;
+  }
+  thread_local_.ResetToStaticStack(this);
+}
+
+void RegExpStack::ReleaseRetainedMemory() {
+  if (is_in_use() || !thread_local_.owns_memory_) return;
+  thread_local_.ResetToStaticStack(this);
+}
 
 void RegExpStack::ThreadLocal::ResetToStaticStack(RegExpStack* regexp_stack) {
   if (owns_memory_) DeleteArray(memory_);
@@ -69,6 +69,10 @@ class RegExpStack {
   // If passing zero, the default/minimum size buffer is allocated.
   Address EnsureCapacity(size_t size);
 
+  // Frees a grown stack that was kept after the last execution, see
+  // --regexp-retained-stack-size. Does nothing while the stack is in use.
+  void ReleaseRetainedMemory();
+
   bool is_in_use() const { return thread_local_.is_in_use_; }
   void set_is_in_use(bool v) { thread_local_.is_in_use_ = v; }
 
@@ -128,9 +132,8 @@ class RegExpStack {
     return reinterpret_cast<Address>(&thread_local_.memory_top_);
   }
 
-  // Resets the buffer if it has grown beyond the default/minimum size.
-  // After this, the buffer is either the default size, or it is empty, so
-  // you have to call EnsureCapacity before using it again.
+  // Resets the buffer if it has grown beyond the default/minimum size, unless
+  // it is small enough to be retained for the next execution.
   void Reset();
 
   // Whether the ThreadLocal storage has been invalidated.
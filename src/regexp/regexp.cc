@@ -4,6 +4,15 @@
 
 #include "src/regexp/regexp.h"
 
+#include <algorithm>
+#include <iomanip>
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+
 #include "src/codegen/compilation-cache.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/interrupts-scope.h"
@@ -149,6 +158,13 @@ static bool HasFewDifferentCharacters(Handle<String> pattern) {
   return true;
 }
 
+// Atoms are matched by plain string search, see AtomExecRaw. Sticky regexps
+// only use them if they are not global, since the global fast paths for atoms
+// search the whole subject.
+static bool CanBeAtom(JSRegExp::Flags flags) {
+  return !IsSticky(flags) || (FLAG_regexp_sticky_atoms && !IsGlobal(flags));
+}
+
 // Generic RegExp methods. Dispatches to implementation specific methods.
 
 // static
@@ -209,12 +225,12 @@ MaybeHandle<Object> RegExp::Compile(Isolate* isolate, Handle<JSRegExp> re,
     ExperimentalRegExp::Initialize(isolate, re, pattern, flags,
                                    parse_result.capture_count);
     has_been_compiled = true;
-  } else if (parse_result.simple && !IgnoreCase(flags) && !IsSticky(flags) &&
+  } else if (parse_result.simple && !IgnoreCase(flags) && CanBeAtom(flags) &&
              !HasFewDifferentCharacters(pattern)) {
     // Parse-tree is a single atom that is equal to the pattern.
     RegExpImpl::AtomCompile(isolate, re, pattern, flags, pattern);
     has_been_compiled = true;
-  } else if (parse_result.tree->IsAtom() && !IsSticky(flags) &&
+  } else if (parse_result.tree->IsAtom() && CanBeAtom(flags) &&
              parse_result.capture_count == 0) {
     RegExpAtom* atom = parse_result.tree->AsAtom();
     // The pattern source might (?) contain escape sequences, but they're
@@ -277,11 +293,12 @@ MaybeHandle<Object> RegExp::ExperimentalOneshotExec(
                                          last_match_info, exec_quirks);
 }
 
-// static
-MaybeHandle<Object> RegExp::Exec(Isolate* isolate, Handle<JSRegExp> regexp,
-                                 Handle<String> subject, int index,
-                                 Handle<RegExpMatchInfo> last_match_info,
-                                 ExecQuirks exec_quirks) {
+namespace {
+
+MaybeHandle<Object> ExecImpl(Isolate* isolate, Handle<JSRegExp> regexp,
+                             Handle<String> subject, int index,
+                             Handle<RegExpMatchInfo> last_match_info,
+                             RegExp::ExecQuirks exec_quirks) {
   switch (regexp->TypeTag()) {
     case JSRegExp::NOT_COMPILED:
       UNREACHABLE();
@@ -297,6 +314,56 @@ MaybeHandle<Object> RegExp::Exec(Isolate* isolate, Handle<JSRegExp> regexp,
   }
 }
 
+}  // namespace
+
+// static
+MaybeHandle<Object> RegExp::Exec(Isolate* isolate, Handle<JSRegExp> regexp,
+                                 Handle<String> subject, int index,
+                                 Handle<RegExpMatchInfo> last_match_info,
+                                 ExecQuirks exec_quirks) {
+  if (V8_LIKELY(!FLAG_regexp_execution_stats)) {
+    return ExecImpl(isolate, regexp, subject, index, last_match_info,
+                    exec_quirks);
+  }
+  base::ElapsedTimer timer;
+  timer.Start();
+  MaybeHandle<Object> result = ExecImpl(isolate, regexp, subject, index,
+                                        last_match_info, exec_quirks);
+  isolate->GetRegExpExecutionStats()->Record(isolate, regexp, timer.Elapsed());
+  return result;
+}
+
+void RegExpExecutionStats::Record(Isolate* isolate, Handle<JSRegExp> regexp,
+                                  base::TimeDelta time) {
+  std::string key = "/";
+  key += regexp->Pattern().ToCString().get();
+  key += "/";
+  key += JSRegExp::StringFromFlags(isolate, regexp->GetFlags())
+             ->ToCString()
+             .get();
+  Entry& entry = entries_[key];
+  entry.count++;
+  entry.time += time;
+}
+
+void RegExpExecutionStats::Print(std::ostream& os) const {
+  std::vector<std::pair<const std::string*, const Entry*>> sorted;
+  sorted.reserve(entries_.size());
+  for (const auto& it : entries_) sorted.emplace_back(&it.first, &it.second);
+  // Most expensive patterns first.
+  std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+    return a.second->time > b.second->time;
+  });
+  os << "=== RegExp execution stats ===" << std::endl;
+  os << std::setw(12) << "count" << std::setw(14) << "time (ms)"
+     << "  pattern" << std::endl;
+  for (const auto& it : sorted) {
+    os << std::setw(12) << it.second->count << std::setw(14) << std::fixed
+       << std::setprecision(3) << it.second->time.InMillisecondsF() << "  "
+       << *it.first << std::endl;
+  }
+}
+
 // RegExp Atom implementation: Simple string search using indexOf.
 
 void RegExpImpl::AtomCompile(Isolate* isolate, Handle<JSRegExp> re,
@@ -316,6 +383,23 @@ static void SetAtomLastCapture(Isolate* isolate,
   last_match_info->SetCapture(1, to);
 }
 
+namespace {
+
+// Sticky atoms can only match at {index}.
+template <typename SubjectChar, typename PatternChar>
+int AtomSearch(Isolate* isolate, base::Vector<const SubjectChar> subject,
+               base::Vector<const PatternChar> pattern, int index,
+               bool sticky) {
+  if (!sticky) return SearchString(isolate, subject, pattern, index);
+  if (index + pattern.length() > subject.length()) return -1;
+  return CompareChars(subject.begin() + index, pattern.begin(),
+                      pattern.length()) == 0
+             ? index
+             : -1;
+}
+
+}  // namespace
+
 int RegExpImpl::AtomExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
                             Handle<String> subject, int index, int32_t* output,
                             int output_size) {
@@ -329,6 +413,7 @@ int RegExpImpl::AtomExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
   int needle_len = needle.length();
   DCHECK(needle.IsFlat());
   DCHECK_LT(0, needle_len);
+  const bool sticky = IsSticky(regexp->GetFlags());
 
   if (index + needle_len > subject->length()) {
     return RegExp::RE_FAILURE;
@@ -343,15 +428,19 @@ int RegExpImpl::AtomExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
     index =
         (needle_content.IsOneByte()
              ? (subject_content.IsOneByte()
-                    ? SearchString(isolate, subject_content.ToOneByteVector(),
-                                   needle_content.ToOneByteVector(), index)
-                    : SearchString(isolate, subject_content.ToUC16Vector(),
-                                   needle_content.ToOneByteVector(), index))
+                    ? AtomSearch(isolate, subject_content.ToOneByteVector(),
+                                 needle_content.ToOneByteVector(), index,
+                                 sticky)
+                    : AtomSearch(isolate, subject_content.ToUC16Vector(),
+                                 needle_content.ToOneByteVector(), index,
+                                 sticky))
              : (subject_content.IsOneByte()
-                    ? SearchString(isolate, subject_content.ToOneByteVector(),
-                                   needle_content.ToUC16Vector(), index)
-                    : SearchString(isolate, subject_content.ToUC16Vector(),
-                                   needle_content.ToUC16Vector(), index)));
+                    ? AtomSearch(isolate, subject_content.ToOneByteVector(),
+                                 needle_content.ToUC16Vector(), index,
+                                 sticky)
+                    : AtomSearch(isolate, subject_content.ToUC16Vector(),
+                                 needle_content.ToUC16Vector(), index,
+                                 sticky)));
     if (index == -1) {
       return i / 2;  // Return number of matches.
     } else {
@@ -451,6 +540,79 @@ bool RegExpCodeIsValidForPreCompilation(Handle<JSRegExp> re, bool is_one_byte) {
 }  // namespace
 #endif
 
+namespace {
+
+// A process-wide cache of irregexp bytecode, shared by all isolates.  Bytecode
+// does not reference any heap objects, so it can be copied into any isolate
+// that compiles the same pattern with the same flags.
+class SharedRegExpBytecodeCache {
+ public:
+  struct Key {
+    std::vector<uc16> source;
+    JSRegExp::Flags flags;
+    bool is_one_byte;
+    uint32_t backtrack_limit;
+
+    bool operator==(const Key& other) const {
+      return source == other.source && flags == other.flags &&
+             is_one_byte == other.is_one_byte &&
+             backtrack_limit == other.backtrack_limit;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      return base::hash_combine(
+          base::hash_range(key.source.begin(), key.source.end()),
+          static_cast<int>(key.flags), key.is_one_byte, key.backtrack_limit);
+    }
+  };
+
+  struct Entry {
+    std::vector<uint8_t> bytecode;
+    int register_count;
+    // The backtrack limit the bytecode was compiled with, which can be lower
+    // than the requested one (see {RegExpImpl::Compile}).
+    uint32_t backtrack_limit;
+  };
+
+  static Key MakeKey(Handle<String> flat_pattern, JSRegExp::Flags flags,
+                     bool is_one_byte, uint32_t backtrack_limit) {
+    DisallowGarbageCollection no_gc;
+    std::vector<uc16> source(flat_pattern->length());
+    String::WriteToFlat(*flat_pattern, source.data(), 0,
+                        flat_pattern->length());
+    return {std::move(source), flags, is_one_byte, backtrack_limit};
+  }
+
+  bool Lookup(const Key& key, Entry* entry) {
+    base::MutexGuard guard(&mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return false;
+    *entry = it->second;
+    return true;
+  }
+
+  void Insert(Key key, Entry entry) {
+    base::MutexGuard guard(&mutex_);
+    // Keep the cache bounded; patterns compiled after it filled up are simply
+    // not shared.
+    if (entries_.size() >= kMaxEntries) return;
+    entries_.emplace(std::move(key), std::move(entry));
+  }
+
+ private:
+  static constexpr size_t kMaxEntries = 1024;
+
+  base::Mutex mutex_;
+  std::unordered_map<Key, Entry, KeyHash> entries_;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(SharedRegExpBytecodeCache,
+                                GetSharedRegExpBytecodeCache)
+
+}  // namespace
+
 bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                                  Handle<String> sample_subject,
                                  bool is_one_byte) {
@@ -481,10 +643,49 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   compile_data.compilation_target = re->ShouldProduceBytecode()
                                         ? RegExpCompilationTarget::kBytecode
                                         : RegExpCompilationTarget::kNative;
+  // With the tier-up strategy, native code is only compiled for regexps that
+  // have already run in the interpreter, so they can afford more expensive
+  // optimizations.
+  compile_data.optimize_hot =
+      FLAG_regexp_optimize_hot && FLAG_regexp_tier_up &&
+      compile_data.compilation_target == RegExpCompilationTarget::kNative;
   uint32_t backtrack_limit = re->BacktrackLimit();
-  const bool compilation_succeeded =
-      Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
-              is_one_byte, backtrack_limit);
+
+  // Bytecode can be shared with other isolates through the process-wide
+  // cache.  Native code is tied to its isolate and is always compiled.
+  const bool use_shared_cache =
+      FLAG_regexp_shared_bytecode_cache &&
+      compile_data.compilation_target == RegExpCompilationTarget::kBytecode;
+  base::Optional<SharedRegExpBytecodeCache::Key> cache_key;
+  SharedRegExpBytecodeCache::Entry cache_entry;
+  bool compilation_succeeded;
+  if (use_shared_cache) {
+    cache_key = SharedRegExpBytecodeCache::MakeKey(pattern, flags, is_one_byte,
+                                                   backtrack_limit);
+  }
+  if (cache_key &&
+      GetSharedRegExpBytecodeCache()->Lookup(*cache_key, &cache_entry)) {
+    Handle<ByteArray> bytecode = isolate->factory()->NewByteArray(
+        static_cast<int>(cache_entry.bytecode.size()), AllocationType::kOld);
+    bytecode->copy_in(0, cache_entry.bytecode.data(), bytecode->length());
+    compile_data.code = bytecode;
+    compile_data.register_count = cache_entry.register_count;
+    backtrack_limit = cache_entry.backtrack_limit;
+    compilation_succeeded = true;
+  } else {
+    compilation_succeeded =
+        Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
+                is_one_byte, backtrack_limit);
+    if (compilation_succeeded && cache_key) {
+      Handle<ByteArray> bytecode = Handle<ByteArray>::cast(compile_data.code);
+      const uint8_t* start = bytecode->GetDataStartAddress();
+      cache_entry.bytecode.assign(start, start + bytecode->length());
+      cache_entry.register_count = compile_data.register_count;
+      cache_entry.backtrack_limit = backtrack_limit;
+      GetSharedRegExpBytecodeCache()->Insert(std::move(*cache_key),
+                                             std::move(cache_entry));
+    }
+  }
   if (!compilation_succeeded) {
     DCHECK(compile_data.error != RegExpError::kNone);
     RegExp::ThrowRegExpException(isolate, re, compile_data.error);
@@ -805,6 +1006,7 @@ bool RegExpImpl::Compile(Isolate* isolate, Zone* zone, RegExpCompileData* data,
 
   if (compiler.optimize()) {
     compiler.set_optimize(!TooMuchRegExpCode(isolate, pattern));
+    compiler.set_optimize_hot(compiler.optimize() && data->optimize_hot);
   }
 
   // Sample some characters from the middle of the string.
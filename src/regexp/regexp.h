@@ -5,6 +5,11 @@
 #ifndef V8_REGEXP_REGEXP_H_
 #define V8_REGEXP_REGEXP_H_
 
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+
+#include "src/base/platform/time.h"
 #include "src/objects/js-regexp.h"
 #include "src/regexp/regexp-error.h"
 
@@ -57,6 +62,10 @@ struct RegExpCompileData {
 
   // The compilation target (bytecode or native code).
   RegExpCompilationTarget compilation_target;
+
+  // Whether the regexp is hot enough to be compiled with more aggressive
+  // optimizations (see --regexp-optimize-hot).
+  bool optimize_hot = false;
 };
 
 class RegExp final : public AllStatic {
@@ -154,6 +163,22 @@ class RegExp final : public AllStatic {
   static bool IsUnmodifiedRegExp(Isolate* isolate, Handle<JSRegExp> regexp);
 };
 
+// Per-pattern execution counts and times of RegExp::Exec, collected with
+// --regexp-execution-stats and printed when the isolate's stats are dumped.
+class RegExpExecutionStats final {
+ public:
+  void Record(Isolate* isolate, Handle<JSRegExp> regexp, base::TimeDelta time);
+  void Print(std::ostream& os) const;
+
+ private:
+  struct Entry {
+    uint64_t count = 0;
+    base::TimeDelta time;
+  };
+  // Keyed by the regexp literal, e.g. "/a+b/gi".
+  std::unordered_map<std::string, Entry> entries_;
+};
+
 // Uses a special global mode of irregexp-generated code to perform a global
 // search and return multiple results at once. As such, this is essentially an
 // iterator over multiple results (retrieved batch-wise in advance).
@@ -546,6 +546,48 @@ void RegExpMacroAssemblerX64::CheckBitInTable(
   BranchOrBacktrack(not_equal, on_bit_set);
 }
 
+void RegExpMacroAssemblerX64::SkipUntilCharacterAfterAnd(int cp_offset,
+                                                         uint32_t c,
+                                                         uint32_t mask) {
+  // Only one-byte subjects are scanned 16 characters at a time.
+  if (mode_ != LATIN1 || c > String::kMaxOneByteCharCode) return;
+  DCHECK_LE(0, cp_offset);
+  constexpr int kBlockSize = kSimd128Size;
+
+  // Broadcast {c} and the low byte of {mask} to all lanes.
+  __ movl(rax, Immediate(c * 0x01010101u));
+  __ Movd(xmm0, rax);
+  __ Pshufd(xmm0, xmm0, 0);
+  const bool needs_mask = (mask & 0xFF) != 0xFF;
+  if (needs_mask) {
+    __ movl(rax, Immediate((mask & 0xFF) * 0x01010101u));
+    __ Movd(xmm1, rax);
+    __ Pshufd(xmm1, xmm1, 0);
+  }
+
+  Label loop, found, done;
+  __ bind(&loop);
+  // Leave the last characters of the input to the caller's skip loop, which
+  // does its own bounds checks.
+  __ leaq(rax, Operand(rdi, cp_offset + kBlockSize));
+  __ testq(rax, rax);
+  __ j(greater, &done);
+  __ Movdqu(xmm2, Operand(rsi, rdi, times_1, cp_offset));
+  if (needs_mask) __ Pand(xmm2, xmm1);
+  __ Pcmpeqb(xmm2, xmm0);
+  __ Pmovmskb(rax, xmm2);
+  __ testl(rax, rax);
+  __ j(not_zero, &found);
+  __ addq(rdi, Immediate(kBlockSize));
+  __ jmp(&loop);
+
+  // Advance to the first position with a matching character.
+  __ bind(&found);
+  __ bsfl(rax, rax);
+  __ addq(rdi, rax);
+  __ bind(&done);
+}
+
 
 bool RegExpMacroAssemblerX64::CheckSpecialCharacterClass(uc16 type,
                                                          Label* on_no_match) {
@@ -48,6 +48,8 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerX64
   void CheckCharacterNotInRange(uc16 from, uc16 to,
                                 Label* on_not_in_range) override;
   void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set) override;
+  void SkipUntilCharacterAfterAnd(int cp_offset, uint32_t c,
+                                  uint32_t mask) override;
 
   // Checks whether the given offset from the current position is before
   // the end of the string.
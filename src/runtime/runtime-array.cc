@@ -2,6 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <vector>
+
 #include "src/debug/debug.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/isolate-inl.h"
@@ -425,5 +428,138 @@ RUNTIME_FUNCTION(Runtime_ArrayIndexOf) {
   return Smi::FromInt(-1);
 }
 
+namespace {
+
+// clang-format off
+const uint64_t kPowersOf10[] = {
+    1,                 10,                 100,         1000,
+    10 * 1000,         100 * 1000,         1000 * 1000, 10 * 1000 * 1000,
+    100 * 1000 * 1000, 1000 * 1000 * 1000, uint64_t{10} * 1000 * 1000 * 1000};
+// clang-format on
+
+// Maps a Smi value to a key whose integer order is the lexicographic order
+// of the value's decimal string: negative values (starting with '-') come
+// first, and the absolute value is scaled to ten digits, with ties broken by
+// the number of digits so that shorter strings sort first. Distinct values
+// get distinct keys.
+uint64_t SmiToLexicographicKey(int value) {
+  uint64_t non_negative = value < 0 ? 0 : 1;
+  uint64_t magnitude = value < 0 ? uint64_t{0} - static_cast<uint64_t>(value)
+                                 : static_cast<uint64_t>(value);
+  int digits = 1;
+  while (digits < 10 && magnitude >= kPowersOf10[digits]) digits++;
+  uint64_t scaled = magnitude * kPowersOf10[10 - digits];
+  return (non_negative << 63) | (scaled << 8) | digits;
+}
+
+int SmiFromLexicographicKey(uint64_t key) {
+  int digits = static_cast<int>(key & 0xFF);
+  uint64_t scaled = (key >> 8) & ((uint64_t{1} << 55) - 1);
+  int64_t magnitude =
+      static_cast<int64_t>(scaled / kPowersOf10[10 - digits]);
+  return static_cast<int>((key >> 63) ? magnitude : -magnitude);
+}
+
+void SortSmiElements(FixedArray elements, int length) {
+  std::vector<uint64_t> keys(length);
+  for (int i = 0; i < length; i++) {
+    keys[i] = SmiToLexicographicKey(Smi::ToInt(elements.get(i)));
+  }
+  std::sort(keys.begin(), keys.end());
+  for (int i = 0; i < length; i++) {
+    elements.set(i, Smi::FromInt(SmiFromLexicographicKey(keys[i])));
+  }
+}
+
+// Converts every element to its string representation once, instead of on
+// each comparison. The sort must be stable, because different values like
+// 0 and -0 have the same string.
+void SortDoubleElements(FixedDoubleArray elements, int length) {
+  std::vector<double> values(length);
+  std::vector<char> chars;
+  std::vector<std::pair<int, int>> strings(length);
+  char buffer[kDoubleToCStringMinBufferSize];
+  for (int i = 0; i < length; i++) {
+    values[i] = elements.get_scalar(i);
+    const char* string = DoubleToCString(values[i], base::ArrayVector(buffer));
+    int string_length = static_cast<int>(strlen(string));
+    strings[i] = {static_cast<int>(chars.size()), string_length};
+    chars.insert(chars.end(), string, string + string_length);
+  }
+  std::vector<int> order(length);
+  for (int i = 0; i < length; i++) order[i] = i;
+  std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+    const char* data = chars.data();
+    return std::lexicographical_compare(
+        data + strings[a].first, data + strings[a].first + strings[a].second,
+        data + strings[b].first, data + strings[b].first + strings[b].second);
+  });
+  for (int i = 0; i < length; i++) elements.set(i, values[order[i]]);
+}
+
+// Returns false if one of the elements is not a flat one-byte string.
+// Strings with the same contents are indistinguishable, so the sort does
+// not need to be stable.
+bool SortOneByteStringElements(FixedArray elements, int length,
+                               const DisallowGarbageCollection& no_gc) {
+  struct Entry {
+    String string;
+    const uint8_t* chars;
+    int length;
+  };
+  std::vector<Entry> entries;
+  entries.reserve(length);
+  for (int i = 0; i < length; i++) {
+    Object element = elements.get(i);
+    if (!element.IsString()) return false;
+    String string = String::cast(element);
+    if (!string.IsFlat()) return false;
+    String::FlatContent content = string.GetFlatContent(no_gc);
+    if (!content.IsOneByte()) return false;
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    entries.push_back({string, chars.begin(), chars.length()});
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry& a, const Entry& b) {
+              int result =
+                  memcmp(a.chars, b.chars, std::min(a.length, b.length));
+              return result != 0 ? result < 0 : a.length < b.length;
+            });
+  for (int i = 0; i < length; i++) elements.set(i, entries[i].string);
+  return true;
+}
+
+}  // namespace
+
+// Sorts a packed fast array of Smis, doubles or one-byte strings with the
+// default comparison function, directly on the elements. Returns false if
+// the array does not qualify, in which case it is left unchanged and the
+// caller falls back to the generic TimSort.
+RUNTIME_FUNCTION(Runtime_ArraySortFast) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSArray, array, 0);
+
+  ElementsKind kind = array->GetElementsKind();
+  if (kind != PACKED_SMI_ELEMENTS && kind != PACKED_DOUBLE_ELEMENTS &&
+      kind != PACKED_ELEMENTS) {
+    return ReadOnlyRoots(isolate).false_value();
+  }
+  JSObject::EnsureWritableFastElements(array);
+
+  DisallowGarbageCollection no_gc;
+  int length = Smi::ToInt(array->length());
+  DCHECK_LE(length, array->elements().length());
+  if (kind == PACKED_SMI_ELEMENTS) {
+    SortSmiElements(FixedArray::cast(array->elements()), length);
+  } else if (kind == PACKED_DOUBLE_ELEMENTS) {
+    SortDoubleElements(FixedDoubleArray::cast(array->elements()), length);
+  } else if (!SortOneByteStringElements(FixedArray::cast(array->elements()),
+                                        length, no_gc)) {
+    return ReadOnlyRoots(isolate).false_value();
+  }
+  return ReadOnlyRoots(isolate).true_value();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "src/asmjs/asm-js.h"
+#include "src/base/optional.h"
 #include "src/baseline/baseline.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
@@ -19,6 +20,7 @@
 #include "src/execution/v8threads.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/heap/parked-scope.h"
+#include "src/logging/metrics.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-array-inl.h"
 #include "src/objects/shared-function-info.h"
@@ -177,6 +179,31 @@ RUNTIME_FUNCTION(Runtime_InstantiateAsmJs) {
   return Smi::zero();
 }
 
+namespace {
+
+v8::metrics::JSDeoptimization ComputeDeoptimizationMetricsEvent(
+    Deoptimizer* deoptimizer, DeoptimizeKind kind) {
+  DisallowGarbageCollection no_gc;
+  Isolate* isolate = deoptimizer->isolate();
+  v8::metrics::JSDeoptimization event;
+  event.reason =
+      DeoptimizeReasonToString(deoptimizer->deopt_info().deopt_reason);
+  event.lazy = kind == DeoptimizeKind::kLazy;
+  SharedFunctionInfo shared = deoptimizer->function()->shared();
+  if (shared.script().IsScript()) {
+    event.script_id = Script::cast(shared.script()).id();
+  }
+  BytecodeOffset bytecode_offset = deoptimizer->bytecode_offset();
+  if (!bytecode_offset.IsNone() && shared.HasBytecodeArray()) {
+    event.bytecode_offset = bytecode_offset.ToInt();
+    event.source_position = Deoptimizer::ComputeSourcePositionFromBytecodeArray(
+        isolate, shared, bytecode_offset);
+  }
+  return event;
+}
+
+}  // namespace
+
 RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   HandleScope scope(isolate);
   DCHECK_EQ(0, args.length());
@@ -201,6 +228,10 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
 
   // Make sure to materialize objects before causing any allocation.
   deoptimizer->MaterializeHeapObjects();
+  base::Optional<v8::metrics::JSDeoptimization> metrics_event;
+  if (isolate->metrics_recorder()->HasEmbedderRecorder()) {
+    metrics_event = ComputeDeoptimizationMetricsEvent(deoptimizer, type);
+  }
   delete deoptimizer;
 
   // Ensure the context register is updated for materialized objects.
@@ -208,6 +239,16 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   JavaScriptFrame* top_frame = top_it.frame();
   isolate->set_context(Context::cast(top_frame->context()));
 
+  if (metrics_event.has_value()) {
+    isolate->metrics_recorder()->AddMainThreadEvent(
+        metrics_event.value(),
+        isolate->GetOrRegisterRecorderContextId(
+            handle(function->native_context(), isolate)));
+    isolate->metrics_recorder()->AddDeoptimization(
+        metrics_event.value(), function->shared().StartPosition(),
+        function->shared().DebugNameCStr().get());
+  }
+
   if (should_reuse_code) {
     optimized_code->increment_deoptimization_count();
     return ReadOnlyRoots(isolate).undefined_value();
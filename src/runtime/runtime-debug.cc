@@ -803,6 +803,13 @@ RUNTIME_FUNCTION(Runtime_DebugToggleBlockCoverage) {
   return ReadOnlyRoots(isolate).undefined_value();
 }
 
+RUNTIME_FUNCTION(Runtime_DebugSetBlockCountingPaused) {
+  SealHandleScope shs(isolate);
+  CONVERT_BOOLEAN_ARG_CHECKED(paused, 0);
+  Coverage::SetBlockCountingPaused(isolate, paused);
+  return ReadOnlyRoots(isolate).undefined_value();
+}
+
 RUNTIME_FUNCTION(Runtime_IncBlockCounter) {
   UNREACHABLE();  // Never called. See the IncBlockCounter builtin instead.
 }
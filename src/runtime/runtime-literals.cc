@@ -34,6 +34,24 @@ void PreInitializeLiteralSite(Handle<FeedbackVector> vector,
   vector->SynchronizedSet(slot, Smi::FromInt(1));
 }
 
+// Starts the sites of a new literal out tenured if the code cache recorded
+// that the literal sites of this function were pretenured before.
+void ApplyRecordedPretenuringFeedback(Handle<FeedbackVector> vector,
+                                      Handle<AllocationSite> site) {
+  if (!FLAG_allocation_site_pretenuring) return;
+  if (!vector->shared_function_info().pretenure_literal_allocation_sites()) {
+    return;
+  }
+  Object current = *site;
+  while (current.IsAllocationSite()) {
+    AllocationSite current_site = AllocationSite::cast(current);
+    if (current_site.pretenure_decision() == AllocationSite::kUndecided) {
+      current_site.set_pretenure_decision(AllocationSite::kTenure);
+    }
+    current = current_site.nested_site();
+  }
+}
+
 enum DeepCopyHints { kNoHints = 0, kObjectIsShallow = 1 };
 
 template <class ContextObject>
@@ -585,6 +603,7 @@ MaybeHandle<JSObject> CreateLiteral(Isolate* isolate,
     RETURN_ON_EXCEPTION(isolate, DeepWalk(boilerplate, &creation_context),
                         JSObject);
     creation_context.ExitScope(site, boilerplate);
+    ApplyRecordedPretenuringFeedback(vector, site);
 
     vector->SynchronizedSet(literals_slot, *site);
   }
@@ -619,6 +619,102 @@ V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalAtomRegExpWithString(
   return *result;
 }
 
+// Replaces all matches of a global regexp with a replacement string that does
+// not contain substitution patterns. The match offsets are collected into the
+// isolate's reusable indices list first, so that the result string can be
+// allocated with its final length and written in a single pass.
+template <typename ResultSeqString>
+V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalRegExpWithSimpleString(
+    Isolate* isolate, Handle<String> subject, Handle<JSRegExp> regexp,
+    Handle<String> replacement, Handle<RegExpMatchInfo> last_match_info) {
+  DCHECK(subject->IsFlat());
+  DCHECK(replacement->IsFlat());
+
+  RegExpGlobalCache global_cache(regexp, subject, isolate);
+  if (global_cache.HasException()) return ReadOnlyRoots(isolate).exception();
+
+  // Start and end offsets of all matches, interleaved.
+  std::vector<int>* indices = GetRewoundRegexpIndicesList(isolate);
+  int64_t matched_length = 0;
+  for (int32_t* current_match = global_cache.FetchNext();
+       current_match != nullptr; current_match = global_cache.FetchNext()) {
+    indices->push_back(current_match[0]);
+    indices->push_back(current_match[1]);
+    matched_length += current_match[1] - current_match[0];
+  }
+  if (global_cache.HasException()) {
+    TruncateRegexpIndicesList(isolate);
+    return ReadOnlyRoots(isolate).exception();
+  }
+  if (indices->empty()) return *subject;
+
+  RegExp::SetLastMatchInfo(isolate, last_match_info, subject,
+                           regexp->CaptureCount(),
+                           global_cache.LastSuccessfulMatch());
+
+  int subject_len = subject->length();
+  int replacement_len = replacement->length();
+  int64_t match_count = static_cast<int64_t>(indices->size() / 2);
+  int64_t result_len_64 = static_cast<int64_t>(subject_len) - matched_length +
+                          static_cast<int64_t>(replacement_len) * match_count;
+  int result_len;
+  if (result_len_64 > static_cast<int64_t>(String::kMaxLength)) {
+    STATIC_ASSERT(String::kMaxLength < kMaxInt);
+    result_len = kMaxInt;  // Provoke exception.
+  } else {
+    result_len = static_cast<int>(result_len_64);
+  }
+  if (result_len == 0) {
+    TruncateRegexpIndicesList(isolate);
+    return ReadOnlyRoots(isolate).empty_string();
+  }
+
+  MaybeHandle<SeqString> maybe_res;
+  if (ResultSeqString::kHasOneByteEncoding) {
+    maybe_res = isolate->factory()->NewRawOneByteString(result_len);
+  } else {
+    maybe_res = isolate->factory()->NewRawTwoByteString(result_len);
+  }
+  Handle<SeqString> untyped_res;
+  if (!maybe_res.ToHandle(&untyped_res)) {
+    TruncateRegexpIndicesList(isolate);
+    return ReadOnlyRoots(isolate).exception();
+  }
+  Handle<ResultSeqString> result = Handle<ResultSeqString>::cast(untyped_res);
+
+  DisallowGarbageCollection no_gc;
+  int subject_pos = 0;
+  int result_pos = 0;
+  for (size_t i = 0; i < indices->size(); i += 2) {
+    int start = (*indices)[i];
+    int end = (*indices)[i + 1];
+    // Copy non-matched subject content.
+    if (subject_pos < start) {
+      String::WriteToFlat(*subject, result->GetChars(no_gc) + result_pos,
+                          subject_pos, start);
+      result_pos += start - subject_pos;
+    }
+    // Replace match.
+    if (replacement_len > 0) {
+      String::WriteToFlat(*replacement, result->GetChars(no_gc) + result_pos, 0,
+                          replacement_len);
+      result_pos += replacement_len;
+    }
+    subject_pos = end;
+  }
+  // Add remaining subject content at the end.
+  if (subject_pos < subject_len) {
+    String::WriteToFlat(*subject, result->GetChars(no_gc) + result_pos,
+                        subject_pos, subject_len);
+    result_pos += subject_len - subject_pos;
+  }
+  DCHECK_EQ(result_len, result_pos);
+
+  TruncateRegexpIndicesList(isolate);
+
+  return *result;
+}
+
 V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalRegExpWithString(
     Isolate* isolate, Handle<String> subject, Handle<JSRegExp> regexp,
     Handle<String> replacement, Handle<RegExpMatchInfo> last_match_info) {
@@ -649,6 +745,18 @@ V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalRegExpWithString(
     }
   }
 
+  // Replacements without substitution patterns are written in one pass.
+  if (simple_replace) {
+    if (subject->IsOneByteRepresentation() &&
+        replacement->IsOneByteRepresentation()) {
+      return StringReplaceGlobalRegExpWithSimpleString<SeqOneByteString>(
+          isolate, subject, regexp, replacement, last_match_info);
+    } else {
+      return StringReplaceGlobalRegExpWithSimpleString<SeqTwoByteString>(
+          isolate, subject, regexp, replacement, last_match_info);
+    }
+  }
+
   RegExpGlobalCache global_cache(regexp, subject, isolate);
   if (global_cache.HasException()) return ReadOnlyRoots(isolate).exception();
 
@@ -674,11 +782,7 @@ V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalRegExpWithString(
       builder.AddSubjectSlice(prev, start);
     }
 
-    if (simple_replace) {
-      builder.AddString(replacement);
-    } else {
-      compiled_replacement.Apply(&builder, start, end, current_match);
-    }
+    compiled_replacement.Apply(&builder, start, end, current_match);
     prev = end;
 
     current_match = global_cache.FetchNext();
@@ -1395,7 +1499,8 @@ V8_WARN_UNUSED_RESULT MaybeHandle<String> RegExpReplace(
       regexp->set_last_index(Smi::FromInt(end_index), SKIP_WRITE_BARRIER);
     }
 
-    IncrementalStringBuilder builder(isolate);
+    // The result is usually about as long as the subject.
+    IncrementalStringBuilder builder(isolate, string->length());
     builder.AppendString(factory->NewSubString(string, 0, start_index));
 
     if (replace->length() > 0) {
@@ -1538,7 +1643,8 @@ RUNTIME_FUNCTION(Runtime_StringReplaceNonGlobalRegExpWithFunction) {
     regexp->set_last_index(Smi::FromInt(end_of_match), SKIP_WRITE_BARRIER);
   }
 
-  IncrementalStringBuilder builder(isolate);
+  // The result is usually about as long as the subject.
+  IncrementalStringBuilder builder(isolate, subject->length());
   builder.AppendString(factory->NewSubString(subject, 0, index));
 
   // Compute the parameter list consisting of the match, captures, index,
@@ -1870,7 +1976,8 @@ RUNTIME_FUNCTION(Runtime_RegExpReplaceRT) {
   }
 
   // TODO(jgruber): Look into ReplacementStringBuilder instead.
-  IncrementalStringBuilder builder(isolate);
+  // The result is usually about as long as the subject.
+  IncrementalStringBuilder builder(isolate, string->length());
   uint32_t next_source_position = 0;
 
   for (const auto& result : results) {
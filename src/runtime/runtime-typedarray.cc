@@ -2,6 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
 #include "src/base/atomicops.h"
 #include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
@@ -84,6 +88,60 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Sorts integers of at most 16 bits by counting how often each value occurs,
+// which takes linear time. {counts} must hold one zeroed entry per value.
+template <typename T>
+void CountingSort(T* data, size_t length, size_t* counts) {
+  using Unsigned = typename std::make_unsigned<T>::type;
+  constexpr size_t kValues = size_t{1} << (8 * sizeof(T));
+  // Flipping the sign bit maps signed values to unsigned indices in the same
+  // order.
+  constexpr Unsigned kBias =
+      std::is_signed<T>::value ? static_cast<Unsigned>(kValues / 2) : 0;
+  for (size_t i = 0; i < length; i++) {
+    counts[static_cast<Unsigned>(data[i]) ^ kBias]++;
+  }
+  T* out = data;
+  for (size_t index = 0; index < kValues; index++) {
+    T value = static_cast<T>(static_cast<Unsigned>(index) ^ kBias);
+    out = std::fill_n(out, counts[index], value);
+  }
+}
+
+// The 256 counts for 8-bit values fit on the stack; only short arrays, for
+// which walking all counts would cost more than std::sort, are left to it.
+template <typename T>
+typename std::enable_if<sizeof(T) == 1>::type SortIntegers(T* data,
+                                                           size_t length) {
+  constexpr size_t kValues = 256;
+  if (length <= kValues / 16) {
+    std::sort(data, data + length);
+    return;
+  }
+  size_t counts[kValues] = {};
+  CountingSort(data, length, counts);
+}
+
+// The 64K counts for 16-bit values take 512KB on 64-bit hosts, so they are
+// only allocated for arrays that are at least as large as the counts.
+template <typename T>
+typename std::enable_if<sizeof(T) == 2>::type SortIntegers(T* data,
+                                                           size_t length) {
+  constexpr size_t kValues = size_t{1} << 16;
+  if (length * sizeof(T) < kValues * sizeof(size_t)) {
+    std::sort(data, data + length);
+    return;
+  }
+  std::vector<size_t> counts(kValues);
+  CountingSort(data, length, counts.data());
+}
+
+template <typename T>
+typename std::enable_if<(sizeof(T) > 2)>::type SortIntegers(T* data,
+                                                            size_t length) {
+  std::sort(data, data + length);
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -152,7 +210,7 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
         std::sort(UnalignedSlot<ctype>(data),                              \
                   UnalignedSlot<ctype>(data + length));                    \
       } else {                                                             \
-        std::sort(data, data + length);                                    \
+        SortIntegers(data, length);                                        \
       }                                                                    \
     }                                                                      \
     break;                                                                 \
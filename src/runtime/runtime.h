@@ -44,6 +44,7 @@ namespace internal {
   F(ArrayIncludes_Slow, 3, 1)          \
   F(ArrayIndexOf, 3, 1)                \
   F(ArrayIsArray, 1, 1)                \
+  F(ArraySortFast, 1, 1)               \
   F(ArraySpeciesConstructor, 1, 1)     \
   F(GrowArrayElements, 2, 1)           \
   F(IsArray, 1, 1)                     \
@@ -133,6 +134,7 @@ namespace internal {
   F(DebugPopPromise, 0, 1)                      \
   F(DebugPrepareStepInSuspendedGenerator, 0, 1) \
   F(DebugPushPromise, 1, 1)                     \
+  F(DebugSetBlockCountingPaused, 1, 1)          \
   F(DebugToggleBlockCoverage, 1, 1)             \
   F(DebugTogglePreciseCoverage, 1, 1)           \
   F(FunctionGetInferredName, 1, 1)              \
@@ -13,6 +13,9 @@
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
+#include "src/objects/allocation-site-inl.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/js-function-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/slots.h"
 #include "src/objects/visitors.h"
@@ -35,13 +38,42 @@ ScriptData::ScriptData(const byte* data, int length)
   }
 }
 
+namespace {
+
+bool HasTenuredAllocationSite(AllocationSite site) {
+  Object current = site;
+  while (current.IsAllocationSite()) {
+    AllocationSite current_site = AllocationSite::cast(current);
+    if (current_site.GetAllocationType() == AllocationType::kOld) return true;
+    current = current_site.nested_site();
+  }
+  return false;
+}
+
+bool HasTenuredLiteralSite(FeedbackVector vector) {
+  FeedbackMetadataIterator slots(vector.metadata());
+  while (slots.HasNext()) {
+    FeedbackSlot slot = slots.Next();
+    if (slots.kind() != FeedbackSlotKind::kLiteral) continue;
+    HeapObject literal_site;
+    if (vector.Get(slot).GetHeapObjectIfStrong(&literal_site) &&
+        literal_site.IsAllocationSite() &&
+        HasTenuredAllocationSite(AllocationSite::cast(literal_site))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
 CodeSerializer::CodeSerializer(Isolate* isolate, uint32_t source_hash)
     : Serializer(isolate, Snapshot::kDefaultSerializerFlags),
       source_hash_(source_hash) {}
 
 // static
 ScriptCompiler::CachedData* CodeSerializer::Serialize(
-    Handle<SharedFunctionInfo> info) {
+    Handle<SharedFunctionInfo> info, MaybeHandle<JSFunction> closure) {
   Isolate* isolate = info->GetIsolate();
   TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.Execute");
   HistogramTimerScope histogram_timer(isolate->counters()->compile_serialize());
@@ -69,6 +101,11 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
                                  source, script->origin_options()));
   DisallowGarbageCollection no_gc;
   cs.reference_map()->AddAttachedReference(*source);
+  Handle<JSFunction> function;
+  if (FLAG_serialize_pretenuring_feedback && FLAG_allocation_site_pretenuring &&
+      closure.ToHandle(&function)) {
+    cs.RecordPretenuringFeedback(*function);
+  }
   ScriptData* script_data = cs.SerializeSharedFunctionInfo(info);
 
   if (FLAG_profile_deserialization) {
@@ -86,6 +123,34 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   return result;
 }
 
+void CodeSerializer::RecordPretenuringFeedback(JSFunction closure) {
+  // Feedback vectors are not part of the code cache, so the pretenuring
+  // decisions of literal allocation sites would be lost on deserialization.
+  // Walk the feedback of {closure} and of the inner closures it created, and
+  // remember the functions whose literal sites are tenured. The decision is
+  // then written out with their SharedFunctionInfos.
+  std::vector<Object> worklist = {closure.raw_feedback_cell().value()};
+  while (!worklist.empty()) {
+    Object value = worklist.back();
+    worklist.pop_back();
+    ClosureFeedbackCellArray cells;
+    if (value.IsFeedbackVector()) {
+      FeedbackVector vector = FeedbackVector::cast(value);
+      if (HasTenuredLiteralSite(vector)) {
+        pretenured_functions_.insert(vector.shared_function_info());
+      }
+      cells = vector.closure_feedback_cell_array();
+    } else if (value.IsClosureFeedbackCellArray()) {
+      cells = ClosureFeedbackCellArray::cast(value);
+    } else {
+      continue;
+    }
+    for (int i = 0; i < cells.length(); ++i) {
+      worklist.push_back(FeedbackCell::cast(cells.get(i)).value());
+    }
+  }
+}
+
 ScriptData* CodeSerializer::SerializeSharedFunctionInfo(
     Handle<SharedFunctionInfo> info) {
   DisallowGarbageCollection no_gc;
@@ -180,8 +245,15 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj) {
     }
     DCHECK(!sfi->HasDebugInfo());
 
+    // Only the serialized copy carries the recorded pretenuring feedback.
+    bool pretenure = !sfi->pretenure_literal_allocation_sites() &&
+                     pretenured_functions_.count(*sfi) != 0;
+    if (pretenure) sfi->set_pretenure_literal_allocation_sites(true);
+
     SerializeGeneric(obj);
 
+    if (pretenure) sfi->set_pretenure_literal_allocation_sites(false);
+
     // Restore debug info
     if (!debug_info.is_null()) {
       sfi->set_script_or_debug_info(debug_info, kReleaseStore);
@@ -277,6 +349,7 @@ class StressOffThreadDeserializeThread final : public base::Thread {
 
   void Run() final {
     LocalIsolate local_isolate(isolate_, ThreadKind::kBackground);
+    local_isolate.heap()->set_thread_name("OffThreadDeserialization");
     MaybeHandle<SharedFunctionInfo> local_maybe_result =
         ObjectDeserializer::DeserializeSharedFunctionInfoOffThread(
             &local_isolate, scd_, local_isolate.factory()->empty_string());
@@ -454,7 +527,11 @@ SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
   if (flags_hash != FlagList::Hash()) return FLAGS_MISMATCH;
   uint32_t max_payload_length = this->size_ - kHeaderSize;
   if (payload_length > max_payload_length) return LENGTH_MISMATCH;
-  if (Checksum(ChecksummedContent()) != c) return CHECKSUM_MISMATCH;
+  // Checksumming touches the whole payload on the main thread; embedders
+  // that already verify the integrity of their caches can skip it.
+  if (FLAG_verify_snapshot_checksum && Checksum(ChecksummedContent()) != c) {
+    return CHECKSUM_MISMATCH;
+  }
   return CHECK_SUCCESS;
 }
 
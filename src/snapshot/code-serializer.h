@@ -5,6 +5,8 @@
 #ifndef V8_SNAPSHOT_CODE_SERIALIZER_H_
 #define V8_SNAPSHOT_CODE_SERIALIZER_H_
 
+#include <unordered_set>
+
 #include "src/base/macros.h"
 #include "src/snapshot/serializer.h"
 #include "src/snapshot/snapshot-data.h"
@@ -48,8 +50,11 @@ class CodeSerializer : public Serializer {
  public:
   CodeSerializer(const CodeSerializer&) = delete;
   CodeSerializer& operator=(const CodeSerializer&) = delete;
+  // If {closure} is given, the pretenuring decisions of the literals in its
+  // feedback are recorded in the cache.
   V8_EXPORT_PRIVATE static ScriptCompiler::CachedData* Serialize(
-      Handle<SharedFunctionInfo> info);
+      Handle<SharedFunctionInfo> info,
+      MaybeHandle<JSFunction> closure = MaybeHandle<JSFunction>());
 
   ScriptData* SerializeSharedFunctionInfo(Handle<SharedFunctionInfo> info);
 
@@ -70,9 +75,12 @@ class CodeSerializer : public Serializer {
   void SerializeObjectImpl(Handle<HeapObject> o) override;
 
   bool SerializeReadOnlyObject(Handle<HeapObject> obj);
+  void RecordPretenuringFeedback(JSFunction closure);
 
   DISALLOW_GARBAGE_COLLECTION(no_gc_)
   uint32_t source_hash_;
+  // Functions whose literal allocation sites were tenured.
+  std::unordered_set<SharedFunctionInfo, Object::Hasher> pretenured_functions_;
 };
 
 // Wrapper around ScriptData to provide code-serializer-specific functionality.
@@ -4,6 +4,8 @@
 
 #include "src/snapshot/context-deserializer.h"
 
+#include <vector>
+
 #include "src/api/api-inl.h"
 #include "src/common/assert-scope.h"
 #include "src/heap/heap-inl.h"
@@ -47,6 +49,7 @@ MaybeHandle<Object> ContextDeserializer::Deserialize(
     DeserializeDeferredObjects();
     DeserializeEmbedderFields(embedder_fields_deserializer);
 
+    LinkAllocationSites();
     LogNewMapEvents();
     WeakenDescriptorArrays();
   }
@@ -77,19 +80,21 @@ void ContextDeserializer::DeserializeEmbedderFields(
   DisallowJavascriptExecution no_js(isolate());
   DisallowCompilation no_compile(isolate());
   DCHECK_NOT_NULL(embedder_fields_deserializer.callback);
+  // The field data is copied into one buffer that is reused for all fields.
+  // The callback only sees the data for the duration of the call.
+  std::vector<byte> data;
   for (int code = source()->Get(); code != kSynchronize;
        code = source()->Get()) {
     HandleScope scope(isolate());
     Handle<JSObject> obj = Handle<JSObject>::cast(GetBackReferencedObject());
     int index = source()->GetInt();
     int size = source()->GetInt();
-    // TODO(yangguo,jgruber): Turn this into a reusable shared buffer.
-    byte* data = new byte[size];
-    source()->CopyRaw(data, size);
-    embedder_fields_deserializer.callback(v8::Utils::ToLocal(obj), index,
-                                          {reinterpret_cast<char*>(data), size},
-                                          embedder_fields_deserializer.data);
-    delete[] data;
+    if (data.size() < static_cast<size_t>(size)) data.resize(size);
+    source()->CopyRaw(data.data(), size);
+    embedder_fields_deserializer.callback(
+        v8::Utils::ToLocal(obj), index,
+        {reinterpret_cast<char*>(data.data()), size},
+        embedder_fields_deserializer.data);
   }
 }
 }  // namespace internal
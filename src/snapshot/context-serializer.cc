@@ -157,8 +157,9 @@ void ContextSerializer::SerializeObjectImpl(Handle<HeapObject> obj) {
   // Function and object templates are not context specific.
   DCHECK(!obj->IsTemplateInfo());
 
-  // Clear literal boilerplates and feedback.
-  if (obj->IsFeedbackVector()) {
+  // Clear literal boilerplates and feedback, unless the feedback was
+  // explicitly kept in Snapshot::ClearReconstructableDataForSerialization.
+  if (obj->IsFeedbackVector() && !FLAG_snapshot_keep_feedback) {
     Handle<FeedbackVector>::cast(obj)->ClearSlots(isolate());
   }
 
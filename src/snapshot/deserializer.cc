@@ -17,6 +17,7 @@
 #include "src/heap/read-only-heap.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/log.h"
+#include "src/objects/allocation-site-inl.h"
 #include "src/objects/api-callbacks.h"
 #include "src/objects/cell-inl.h"
 #include "src/objects/embedder-data-array-inl.h"
@@ -298,6 +299,25 @@ void Deserializer::WeakenDescriptorArrays() {
   }
 }
 
+void Deserializer::LinkAllocationSites() {
+  DisallowGarbageCollection no_gc;
+  Heap* heap = isolate()->heap();
+  // Allocation sites are present in the snapshot, and must be linked into
+  // a list at deserialization time.
+  for (Handle<AllocationSite> site : new_allocation_sites()) {
+    if (!site->HasWeakNext()) continue;
+    // TODO(mvstanton): consider treating the heap()->allocation_sites_list()
+    // as a (weak) root. If this root is relocated correctly, this becomes
+    // unnecessary.
+    if (heap->allocation_sites_list() == Smi::zero()) {
+      site->set_weak_next(ReadOnlyRoots(heap).undefined_value());
+    } else {
+      site->set_weak_next(heap->allocation_sites_list());
+    }
+    heap->set_allocation_sites_list(*site);
+  }
+}
+
 void Deserializer::LogScriptEvents(Script script) {
   DisallowGarbageCollection no_gc;
   LOG(isolate(),
@@ -370,7 +390,7 @@ void Deserializer::PostProcessNewObject(Handle<Map> map, Handle<HeapObject> obj,
       // We should link new allocation sites, but we can't do this immediately
       // because |AllocationSite::HasWeakNext()| internally accesses
       // |Heap::roots_| that may not have been initialized yet. So defer this to
-      // |ObjectDeserializer::CommitPostProcessedObjects()|.
+      // |LinkAllocationSites()|.
       new_allocation_sites_.push_back(Handle<AllocationSite>::cast(obj));
     } else {
       DCHECK(CanBeDeferred(*obj));
@@ -392,6 +412,13 @@ void Deserializer::PostProcessNewObject(Handle<Map> map, Handle<HeapObject> obj,
     code_data_container->AllocateExternalPointerEntries(isolate());
     code_data_container->UpdateCodeEntryPoint(isolate(),
                                               code_data_container->code());
+  } else if (InstanceTypeChecker::IsAllocationSite(instance_type)) {
+    // Allocation sites in user code are already collected above. Context
+    // snapshots only contain them if feedback was kept (see
+    // --snapshot-keep-feedback); ContextDeserializer links them.
+    if (!deserializing_user_code()) {
+      new_allocation_sites_.push_back(Handle<AllocationSite>::cast(obj));
+    }
   } else if (InstanceTypeChecker::IsMap(instance_type)) {
     if (FLAG_log_maps) {
       // Keep track of all seen Maps to log them later since they might be only
@@ -77,6 +77,10 @@ class V8_EXPORT_PRIVATE Deserializer : public SerializerDeserializer {
   // them "weak" again after deserialization completes.
   void WeakenDescriptorArrays();
 
+  // Allocation sites are serialized without their link into the heap's list
+  // of allocation sites. This links the newly deserialized ones again.
+  void LinkAllocationSites();
+
   // This returns the address of an object that has been described in the
   // snapshot by object vector index.
   Handle<HeapObject> GetBackReferencedObject();
@@ -7,7 +7,6 @@
 #include "src/codegen/assembler-inl.h"
 #include "src/execution/isolate.h"
 #include "src/heap/heap-inl.h"
-#include "src/objects/allocation-site-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects.h"
 #include "src/objects/slots.h"
@@ -83,24 +82,5 @@ void ObjectDeserializer::CommitPostProcessedObjects() {
   }
 }
 
-void ObjectDeserializer::LinkAllocationSites() {
-  DisallowGarbageCollection no_gc;
-  Heap* heap = isolate()->heap();
-  // Allocation sites are present in the snapshot, and must be linked into
-  // a list at deserialization time.
-  for (Handle<AllocationSite> site : new_allocation_sites()) {
-    if (!site->HasWeakNext()) continue;
-    // TODO(mvstanton): consider treating the heap()->allocation_sites_list()
-    // as a (weak) root. If this root is relocated correctly, this becomes
-    // unnecessary.
-    if (heap->allocation_sites_list() == Smi::zero()) {
-      site->set_weak_next(ReadOnlyRoots(heap).undefined_value());
-    } else {
-      site->set_weak_next(heap->allocation_sites_list());
-    }
-    heap->set_allocation_sites_list(*site);
-  }
-}
-
 }  // namespace internal
 }  // namespace v8
@@ -28,7 +28,6 @@ class ObjectDeserializer final : public Deserializer {
   // Deserialize an object graph. Fail gracefully.
   MaybeHandle<HeapObject> Deserialize();
 
-  void LinkAllocationSites();
   void CommitPostProcessedObjects();
 };
 
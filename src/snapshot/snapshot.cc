@@ -6,6 +6,7 @@
 
 #include "src/snapshot/snapshot.h"
 
+#include "src/base/optional.h"
 #include "src/base/platform/platform.h"
 #include "src/common/assert-scope.h"
 #include "src/execution/isolate-inl.h"
@@ -118,6 +119,32 @@ SnapshotData MaybeDecompress(const base::Vector<const byte>& snapshot_data) {
 #endif
 }
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+namespace {
+// Decompresses one part of the snapshot blob off the main thread, so that
+// the read-only and startup snapshots can be decompressed concurrently.
+class SnapshotDecompressionThread final : public base::Thread {
+ public:
+  explicit SnapshotDecompressionThread(base::Vector<const byte> compressed)
+      : Thread(base::Thread::Options("SnapshotDecompressionThread")),
+        compressed_(compressed) {}
+
+  void Run() final {
+    result_.emplace(SnapshotCompression::Decompress(compressed_));
+  }
+
+  SnapshotData JoinAndTakeResult() {
+    Join();
+    return std::move(result_.value());
+  }
+
+ private:
+  const base::Vector<const byte> compressed_;
+  base::Optional<SnapshotData> result_;
+};
+}  // namespace
+#endif  // V8_SNAPSHOT_COMPRESSION
+
 #ifdef DEBUG
 bool Snapshot::SnapshotIsValid(const v8::StartupData* snapshot_blob) {
   return SnapshotImpl::ExtractNumContexts(snapshot_blob) > 0;
@@ -154,14 +181,27 @@ bool Snapshot::Initialize(Isolate* isolate) {
 
   const v8::StartupData* blob = isolate->snapshot_blob();
   SnapshotImpl::CheckVersion(blob);
-  CHECK(VerifyChecksum(blob));
+  if (FLAG_verify_snapshot_checksum) CHECK(VerifyChecksum(blob));
   base::Vector<const byte> startup_data =
       SnapshotImpl::ExtractStartupData(blob);
   base::Vector<const byte> read_only_data =
       SnapshotImpl::ExtractReadOnlyData(blob);
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+  std::unique_ptr<SnapshotDecompressionThread> read_only_thread;
+  if (FLAG_parallel_snapshot_decompression) {
+    read_only_thread =
+        std::make_unique<SnapshotDecompressionThread>(read_only_data);
+    CHECK(read_only_thread->Start());
+  }
+  SnapshotData startup_snapshot_data(MaybeDecompress(startup_data));
+  SnapshotData read_only_snapshot_data(
+      read_only_thread ? read_only_thread->JoinAndTakeResult()
+                       : MaybeDecompress(read_only_data));
+#else
   SnapshotData startup_snapshot_data(MaybeDecompress(startup_data));
   SnapshotData read_only_snapshot_data(MaybeDecompress(read_only_data));
+#endif  // V8_SNAPSHOT_COMPRESSION
 
   bool success = isolate->InitWithSnapshot(&startup_snapshot_data,
                                            &read_only_snapshot_data,
@@ -262,7 +302,16 @@ void Snapshot::ClearReconstructableDataForSerialization(
     if (fun.CanDiscardCompiled()) {
       fun.set_code(*BUILTIN_CODE(isolate, CompileLazy));
     }
-    if (!fun.raw_feedback_cell().value().IsUndefined()) {
+    if (!clear_recompilable_data && FLAG_snapshot_keep_feedback &&
+        fun.has_feedback_vector()) {
+      // Keep the feedback so that the restored functions start with warm
+      // ICs, but drop optimized code, which cannot be serialized.
+      i::FeedbackVector vector = fun.feedback_vector();
+      if (vector.has_optimized_code()) {
+        vector.ClearOptimizedCode(fun.raw_feedback_cell());
+      }
+      vector.ClearOptimizationMarker();
+    } else if (!fun.raw_feedback_cell().value().IsUndefined()) {
       fun.raw_feedback_cell().set_value(
           i::ReadOnlyRoots(isolate).undefined_value());
     }
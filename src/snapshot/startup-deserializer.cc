@@ -81,18 +81,29 @@ void StartupDeserializer::DeserializeStringTable() {
   // Get the string table size.
   int string_table_size = source()->GetInt();
 
-  // Add each string to the Isolate's string table.
-  // TODO(leszeks): Consider pre-sizing the string table.
-  for (int i = 0; i < string_table_size; ++i) {
-    Handle<String> string = Handle<String>::cast(ReadObject());
-    StringTableInsertionKey key(string);
-    Handle<String> result =
-        isolate()->string_table()->LookupKey(isolate(), &key);
-    USE(result);
-
-    // This is startup, so there should be no duplicate entries in the string
-    // table, and the lookup should unconditionally add the given string.
-    DCHECK_EQ(*result, *string);
+  StringTable* string_table = isolate()->string_table();
+  if (string_table->HasSharedTable()) {
+    // Lookups have to go through the shared table as well, so add the
+    // strings one by one.
+    for (int i = 0; i < string_table_size; ++i) {
+      Handle<String> string = Handle<String>::cast(ReadObject());
+      StringTableInsertionKey key(string);
+      Handle<String> result = string_table->LookupKey(isolate(), &key);
+      USE(result);
+
+      // This is startup, so there should be no duplicate entries in the
+      // string table, and the lookup should unconditionally add the given
+      // string.
+      DCHECK_EQ(*result, *string);
+    }
+  } else {
+    // Add all strings at once, which sizes the table up front.
+    std::vector<Handle<String>> strings;
+    strings.reserve(string_table_size);
+    for (int i = 0; i < string_table_size; ++i) {
+      strings.push_back(Handle<String>::cast(ReadObject()));
+    }
+    string_table->InsertForIsolateDeserialization(isolate(), strings);
   }
 
   DCHECK_EQ(string_table_size, isolate()->string_table()->NumberOfElements());
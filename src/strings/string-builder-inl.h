@@ -12,6 +12,7 @@
 #include "src/objects/fixed-array.h"
 #include "src/objects/objects.h"
 #include "src/objects/string-inl.h"
+#include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 
 namespace v8 {
@@ -117,6 +118,14 @@ class IncrementalStringBuilder {
  public:
   explicit IncrementalStringBuilder(Isolate* isolate);
 
+  // Creates a builder that keeps the result in a single flat string, as long
+  // as it stays shorter than kMaxFlatLength. The buffer initially holds
+  // {expected_length} characters. It is grown by copying if needed, and
+  // trimmed in place by Finish. Appended strings are copied into the buffer
+  // instead of being concatenated, which avoids deep cons trees that would
+  // be flattened later anyway.
+  IncrementalStringBuilder(Isolate* isolate, int expected_length);
+
   V8_INLINE String::Encoding CurrentEncoding() { return encoding_; }
 
   template <typename SrcChar, typename DestChar>
@@ -175,6 +184,14 @@ class IncrementalStringBuilder {
 
   MaybeHandle<String> Finish();
 
+  // Returns the string built from all completed parts so far and removes it
+  // from the builder, so that the output can be consumed incrementally. The
+  // current part stays in the builder.
+  Handle<String> TakeAccumulatedParts();
+
+  // Length of the string that TakeAccumulatedParts() would return.
+  int AccumulatedLength() { return accumulator()->length(); }
+
   V8_INLINE bool HasOverflowed() const { return overflowed_; }
 
   int Length() const;
@@ -182,6 +199,7 @@ class IncrementalStringBuilder {
   // Change encoding to two-byte.
   void ChangeEncoding() {
     DCHECK_EQ(String::ONE_BYTE_ENCODING, encoding_);
+    if (flat_) return WidenCurrentPart();
     ShrinkCurrentPart();
     encoding_ = String::TWO_BYTE_ENCODING;
     Extend();
@@ -208,6 +226,11 @@ class IncrementalStringBuilder {
       const uint8_t* u = reinterpret_cast<const uint8_t*>(s);
       while (*u != '\0') Append(*(u++));
     }
+    template <typename SrcChar>
+    V8_INLINE void AppendChars(const SrcChar* chars, int length) {
+      CopyChars(cursor_, chars, length);
+      cursor_ += length;
+    }
 
     int written() { return static_cast<int>(cursor_ - start_); }
 
@@ -287,14 +310,22 @@ class IncrementalStringBuilder {
   void AppendStringByCopy(Handle<String> string);
   bool CanAppendByCopy(Handle<String> string);
 
+  // For builders that keep the result flat: replaces the current part by a
+  // longer (or two-byte) copy, and copies strings into it.
+  void GrowCurrentPart(int new_length);
+  void WidenCurrentPart();
+  bool AppendStringToFlatPart(Handle<String> string);
+
   static const int kInitialPartLength = 32;
   static const int kMaxPartLength = 16 * 1024;
   static const int kPartLengthGrowthFactor = 2;
   static const int kIntToCStringBufferSize = 100;
+  static const int kMaxFlatLength = 1024 * 1024;
 
   Isolate* isolate_;
   String::Encoding encoding_;
   bool overflowed_;
+  bool flat_;
   int part_length_;
   int current_index_;
   Handle<String> accumulator_;
@@ -4,6 +4,8 @@
 
 #include "src/strings/string-builder-inl.h"
 
+#include <algorithm>
+
 #include "src/execution/isolate-inl.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/js-array-inl.h"
@@ -232,6 +234,7 @@ IncrementalStringBuilder::IncrementalStringBuilder(Isolate* isolate)
     : isolate_(isolate),
       encoding_(String::ONE_BYTE_ENCODING),
       overflowed_(false),
+      flat_(false),
       part_length_(kInitialPartLength),
       current_index_(0) {
   // Create an accumulator handle starting with the empty string.
@@ -241,6 +244,23 @@ IncrementalStringBuilder::IncrementalStringBuilder(Isolate* isolate)
       factory()->NewRawOneByteString(part_length_).ToHandleChecked();
 }
 
+IncrementalStringBuilder::IncrementalStringBuilder(Isolate* isolate,
+                                                   int expected_length)
+    : isolate_(isolate),
+      encoding_(String::ONE_BYTE_ENCODING),
+      overflowed_(false),
+      flat_(true),
+      // One more character, so that appending exactly {expected_length}
+      // characters doesn't need to grow the part.
+      part_length_(std::max(kInitialPartLength,
+                            std::min(expected_length + 1, kMaxFlatLength))),
+      current_index_(0) {
+  accumulator_ =
+      Handle<String>::New(ReadOnlyRoots(isolate).empty_string(), isolate);
+  current_part_ =
+      factory()->NewRawOneByteString(part_length_).ToHandleChecked();
+}
+
 int IncrementalStringBuilder::Length() const {
   return accumulator_->length() + current_index_;
 }
@@ -260,6 +280,14 @@ void IncrementalStringBuilder::Accumulate(Handle<String> new_part) {
 
 void IncrementalStringBuilder::Extend() {
   DCHECK_EQ(current_index_, current_part()->length());
+  if (flat_) {
+    if (part_length_ <= kMaxFlatLength / kPartLengthGrowthFactor) {
+      GrowCurrentPart(part_length_ * kPartLengthGrowthFactor);
+      return;
+    }
+    // Too long for a single part, continue with the usual parts.
+    flat_ = false;
+  }
   Accumulate(current_part());
   if (part_length_ <= kMaxPartLength / kPartLengthGrowthFactor) {
     part_length_ *= kPartLengthGrowthFactor;
@@ -284,6 +312,12 @@ MaybeHandle<String> IncrementalStringBuilder::Finish() {
   return accumulator();
 }
 
+Handle<String> IncrementalStringBuilder::TakeAccumulatedParts() {
+  Handle<String> result = handle(*accumulator(), isolate_);
+  set_accumulator(factory()->empty_string());
+  return result;
+}
+
 // Short strings can be copied directly to {current_part_}.
 // Requires the IncrementalStringBuilder to either have two byte encoding or
 // the incoming string to have one byte representation "underneath" (The
@@ -313,7 +347,88 @@ void IncrementalStringBuilder::AppendStringByCopy(Handle<String> string) {
   if (current_index_ == part_length_) Extend();
 }
 
+void IncrementalStringBuilder::GrowCurrentPart(int new_length) {
+  DCHECK(flat_);
+  DCHECK_GT(new_length, part_length_);
+  Handle<String> new_part;
+  if (encoding_ == String::ONE_BYTE_ENCODING) {
+    Handle<SeqOneByteString> part =
+        factory()->NewRawOneByteString(new_length).ToHandleChecked();
+    DisallowGarbageCollection no_gc;
+    CopyChars(part->GetChars(no_gc),
+              SeqOneByteString::cast(*current_part()).GetChars(no_gc),
+              current_index_);
+    new_part = part;
+  } else {
+    Handle<SeqTwoByteString> part =
+        factory()->NewRawTwoByteString(new_length).ToHandleChecked();
+    DisallowGarbageCollection no_gc;
+    CopyChars(part->GetChars(no_gc),
+              SeqTwoByteString::cast(*current_part()).GetChars(no_gc),
+              current_index_);
+    new_part = part;
+  }
+  set_current_part(new_part);
+  part_length_ = new_length;
+}
+
+void IncrementalStringBuilder::WidenCurrentPart() {
+  DCHECK(flat_);
+  DCHECK_EQ(String::ONE_BYTE_ENCODING, encoding_);
+  Handle<SeqTwoByteString> part =
+      factory()->NewRawTwoByteString(part_length_).ToHandleChecked();
+  {
+    DisallowGarbageCollection no_gc;
+    CopyChars(part->GetChars(no_gc),
+              SeqOneByteString::cast(*current_part()).GetChars(no_gc),
+              current_index_);
+  }
+  set_current_part(part);
+  encoding_ = String::TWO_BYTE_ENCODING;
+}
+
+// Copies {string} into the current part, growing it as needed. Returns false
+// (and stops keeping the result flat) if it would get too long.
+bool IncrementalStringBuilder::AppendStringToFlatPart(Handle<String> string) {
+  DCHECK(flat_);
+  const int length = string->length();
+  if (length >= kMaxFlatLength - current_index_) {
+    flat_ = false;
+    return false;
+  }
+  if (encoding_ == String::ONE_BYTE_ENCODING) {
+    const bool one_byte =
+        string->IsFlat() ? String::IsOneByteRepresentationUnderneath(*string)
+                         : string->IsOneByteRepresentation();
+    if (!one_byte) WidenCurrentPart();
+  }
+  if (!CurrentPartCanFit(length)) {
+    GrowCurrentPart(std::min(
+        kMaxFlatLength,
+        std::max(part_length_ * kPartLengthGrowthFactor,
+                 current_index_ + length + 1)));
+  }
+  DisallowGarbageCollection no_gc;
+  if (encoding_ == String::ONE_BYTE_ENCODING) {
+    String::WriteToFlat(
+        *string,
+        SeqOneByteString::cast(*current_part()).GetChars(no_gc) +
+            current_index_,
+        0, length);
+  } else {
+    String::WriteToFlat(
+        *string,
+        SeqTwoByteString::cast(*current_part()).GetChars(no_gc) +
+            current_index_,
+        0, length);
+  }
+  current_index_ += length;
+  DCHECK_LT(current_index_, part_length_);
+  return true;
+}
+
 void IncrementalStringBuilder::AppendString(Handle<String> string) {
+  if (flat_ && AppendStringToFlatPart(string)) return;
   if (CanAppendByCopy(string)) {
     AppendStringByCopy(string);
     return;
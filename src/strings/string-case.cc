@@ -9,6 +9,30 @@
 #include "src/common/globals.h"
 #include "src/utils/utils.h"
 
+#ifndef V8_STRING_CASE_HAVE_SSE2
+#if defined(__SSE2__) || \
+    (defined(_MSC_VER) && \
+     (defined(_M_X64) || (defined(_M_IX86) && _M_IX86_FP >= 2)))
+#define V8_STRING_CASE_HAVE_SSE2 1
+#else
+#define V8_STRING_CASE_HAVE_SSE2 0
+#endif
+#endif
+
+#ifndef V8_STRING_CASE_HAVE_NEON
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define V8_STRING_CASE_HAVE_NEON 1
+#else
+#define V8_STRING_CASE_HAVE_NEON 0
+#endif
+#endif
+
+#if V8_STRING_CASE_HAVE_SSE2
+#include <emmintrin.h>
+#elif V8_STRING_CASE_HAVE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -58,6 +82,60 @@ static inline word_t AsciiRangeMask(word_t w, char m, char n) {
   return (tmp1 & tmp2 & (kOneInEveryByte * 0x80));
 }
 
+#if V8_STRING_CASE_HAVE_SSE2 || V8_STRING_CASE_HAVE_NEON
+// Converts 16 characters at a time with unaligned vector loads and stores,
+// as long as all of them are ASCII. Stops at the first block that contains
+// a non-ASCII character and leaves it to the word and byte loops, which
+// find its exact position. Since src is advanced in multiples of 16, its
+// alignment relative to word_t is unchanged.
+template <bool is_lower>
+static inline void FastAsciiConvertBlocks(char** dst_ptr, const char** src_ptr,
+                                          const char* limit, bool* changed) {
+  static const char lo = is_lower ? 'A' - 1 : 'a' - 1;
+  static const char hi = is_lower ? 'Z' + 1 : 'z' + 1;
+  static const int kBlockSize = 16;
+  char* dst = *dst_ptr;
+  const char* src = *src_ptr;
+  bool found = false;
+#if V8_STRING_CASE_HAVE_SSE2
+  const __m128i lo_vec = _mm_set1_epi8(lo);
+  const __m128i hi_vec = _mm_set1_epi8(hi);
+  const __m128i case_bit = _mm_set1_epi8(1 << 5);
+  while (limit - src >= kBlockSize) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    if (_mm_movemask_epi8(v) != 0) break;
+    // Signed comparisons are fine, all bytes are ASCII at this point.
+    const __m128i in_range =
+        _mm_and_si128(_mm_cmpgt_epi8(v, lo_vec), _mm_cmplt_epi8(v, hi_vec));
+    found |= _mm_movemask_epi8(in_range) != 0;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+                     _mm_xor_si128(v, _mm_and_si128(in_range, case_bit)));
+    src += kBlockSize;
+    dst += kBlockSize;
+  }
+#else
+  const uint8x16_t lo_vec = vdupq_n_u8(lo);
+  const uint8x16_t hi_vec = vdupq_n_u8(hi);
+  const uint8x16_t case_bit = vdupq_n_u8(1 << 5);
+  while (limit - src >= kBlockSize) {
+    const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(src));
+    if (vmaxvq_u8(v) >= 0x80) break;
+    const uint8x16_t in_range =
+        vandq_u8(vcgtq_u8(v, lo_vec), vcltq_u8(v, hi_vec));
+    found |= vmaxvq_u8(in_range) != 0;
+    vst1q_u8(reinterpret_cast<uint8_t*>(dst),
+             veorq_u8(v, vandq_u8(in_range, case_bit)));
+    src += kBlockSize;
+    dst += kBlockSize;
+  }
+#endif
+  if (found) *changed = true;
+  *dst_ptr = dst;
+  *src_ptr = src;
+}
+#endif  // V8_STRING_CASE_HAVE_SSE2 || V8_STRING_CASE_HAVE_NEON
+
 template <bool is_lower>
 int FastAsciiConvert(char* dst, const char* src, int length,
                      bool* changed_out) {
@@ -77,6 +155,9 @@ int FastAsciiConvert(char* dst, const char* src, int length,
 
   // dst is newly allocated and always aligned.
   DCHECK(IsAligned(reinterpret_cast<Address>(dst), sizeof(word_t)));
+#if V8_STRING_CASE_HAVE_SSE2 || V8_STRING_CASE_HAVE_NEON
+  FastAsciiConvertBlocks<is_lower>(&dst, &src, limit, &changed);
+#endif
   // Only attempt processing one word at a time if src is also aligned.
   if (IsAligned(reinterpret_cast<Address>(src), sizeof(word_t))) {
     // Process the prefix of the input that requires no conversion one aligned
@@ -46,6 +46,35 @@ uint32_t StringHasher::GetTrivialHash(int length) {
   return (hash << String::kHashShift) | String::kIsNotIntegerIndexMask;
 }
 
+template <typename uchar>
+uint32_t StringHasher::HashBlocks(const uchar* chars, int length,
+                                  uint32_t running_hash) {
+  DCHECK_GE(length, kMinBlockHashLength);
+  // All lanes start from the seed, made distinct so that moving a character
+  // from one lane to the next changes the hash.
+  uint32_t lanes[kBlockHashLanes];
+  for (int j = 0; j < kBlockHashLanes; j++) {
+    lanes[j] = running_hash + j * 0x9E3779B9u;
+  }
+  const uchar* block_end = chars + (length & ~(kBlockHashLanes - 1));
+  for (; chars != block_end; chars += kBlockHashLanes) {
+    for (int j = 0; j < kBlockHashLanes; j++) {
+      lanes[j] = AddCharacterCore(lanes[j], chars[j]);
+    }
+  }
+  // Combine the lanes, then hash the remaining characters and the length
+  // as usual; GetHashCore does the final avalanche.
+  for (int j = 0; j < kBlockHashLanes; j++) {
+    running_hash = AddCharacterCore(running_hash, lanes[j] & 0xFFFF);
+    running_hash = AddCharacterCore(running_hash, lanes[j] >> 16);
+  }
+  const uchar* end = block_end + (length & (kBlockHashLanes - 1));
+  for (; chars != end; chars++) {
+    running_hash = AddCharacterCore(running_hash, *chars);
+  }
+  return AddCharacterCore(running_hash, length & 0xFFFF);
+}
+
 template <typename char_t>
 uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
                                             uint64_t seed) {
@@ -113,6 +142,15 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
 
   // Non-index hash.
   uint32_t running_hash = static_cast<uint32_t>(seed);
+  if (length >= kMinBlockHashLength) {
+    // Long strings can't be indices any more, and are hashed block-wise.
+    // Two-byte strings with only one-byte characters get the same hash as
+    // their one-byte counterparts, since the hash works on character values.
+    STATIC_ASSERT(kMinBlockHashLength > String::kMaxIntegerIndexSize);
+    return (GetHashCore(HashBlocks(chars, length, running_hash))
+            << String::kHashShift) |
+           String::kIsNotIntegerIndexMask;
+  }
   const uchar* end = &chars[length];
   while (chars != end) {
     running_hash = AddCharacterCore(running_hash, *chars++);
@@ -40,6 +40,21 @@ class V8_EXPORT_PRIVATE StringHasher final {
   V8_INLINE static uint32_t GetHashCore(uint32_t running_hash);
 
   static inline uint32_t GetTrivialHash(int length);
+
+  // Strings of at least this many characters, which cannot be indices, are
+  // hashed block-wise, see HashBlocks below.
+  static const int kMinBlockHashLength = 64;
+
+ private:
+  // Number of independent running hashes in the block-wise hash. Each of
+  // them hashes every kBlockHashLanes-th character with the one-at-a-time
+  // algorithm; they are combined at the end. The lanes don't depend on each
+  // other, so the compiler can vectorize the main loop.
+  static const int kBlockHashLanes = 8;
+
+  template <typename uchar>
+  static inline uint32_t HashBlocks(const uchar* chars, int length,
+                                    uint32_t running_hash);
 };
 
 // Useful for std containers that require something ()'able.
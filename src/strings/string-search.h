@@ -5,9 +5,26 @@
 #ifndef V8_STRINGS_STRING_SEARCH_H_
 #define V8_STRINGS_STRING_SEARCH_H_
 
+#include "src/base/bits.h"
 #include "src/base/vector.h"
 #include "src/execution/isolate.h"
 
+// SSE2 is part of the x64 baseline. The search kernels below only run on the
+// host, so unlike e.g. Swiss tables, they don't have to match the target.
+#ifndef V8_STRING_SEARCH_HAVE_SSE2
+#if defined(__SSE2__) || \
+    (defined(_MSC_VER) && \
+     (defined(_M_X64) || (defined(_M_IX86) && _M_IX86_FP >= 2)))
+#define V8_STRING_SEARCH_HAVE_SSE2 1
+#else
+#define V8_STRING_SEARCH_HAVE_SSE2 0
+#endif
+#endif
+
+#if V8_STRING_SEARCH_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -192,6 +209,60 @@ inline uint8_t GetHighestValueByte(uc16 character) {
 
 inline uint8_t GetHighestValueByte(uint8_t character) { return character; }
 
+#if V8_STRING_SEARCH_HAVE_SSE2
+// Compares a vector of characters with a broadcast character at once. The
+// result is a bitmask with kBitsPerChar bits for each matching position.
+template <typename Char>
+struct SimdChars;
+
+template <>
+struct SimdChars<uint8_t> {
+  static const int kWidth = 16;
+  static const int kBitsPerChar = 1;
+  static __m128i Broadcast(uint8_t c) {
+    return _mm_set1_epi8(static_cast<char>(c));
+  }
+  static uint32_t Match(const uint8_t* chars, __m128i c) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, c)));
+  }
+};
+
+template <>
+struct SimdChars<uc16> {
+  static const int kWidth = 8;
+  static const int kBitsPerChar = 2;
+  static __m128i Broadcast(uc16 c) {
+    return _mm_set1_epi16(static_cast<int16_t>(c));
+  }
+  static uint32_t Match(const uc16* chars, __m128i c) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(v, c)));
+  }
+};
+
+// Returns the first position in [index, max_n) where {subject} contains
+// {c}, or -1.
+template <typename SubjectChar>
+inline int FindCharacterSimd(SubjectChar c,
+                             base::Vector<const SubjectChar> subject,
+                             int index, int max_n) {
+  using Simd = SimdChars<SubjectChar>;
+  const __m128i needle = Simd::Broadcast(c);
+  int pos = index;
+  for (; pos + Simd::kWidth <= max_n; pos += Simd::kWidth) {
+    uint32_t mask = Simd::Match(subject.begin() + pos, needle);
+    if (mask != 0) {
+      return pos + base::bits::CountTrailingZeros(mask) / Simd::kBitsPerChar;
+    }
+  }
+  for (; pos < max_n; pos++) {
+    if (subject[pos] == c) return pos;
+  }
+  return -1;
+}
+#endif  // V8_STRING_SEARCH_HAVE_SSE2
+
 template <typename PatternChar, typename SubjectChar>
 inline int FindFirstCharacter(base::Vector<const PatternChar> pattern,
                               base::Vector<const SubjectChar> subject,
@@ -199,6 +270,15 @@ inline int FindFirstCharacter(base::Vector<const PatternChar> pattern,
   const PatternChar pattern_first_char = pattern[0];
   const int max_n = (subject.length() - pattern.length() + 1);
 
+#if V8_STRING_SEARCH_HAVE_SSE2
+  // memchr only finds candidates by their higher byte, which is mostly
+  // useless for two-byte subjects. Compare whole characters instead.
+  if (sizeof(SubjectChar) == 2) {
+    return FindCharacterSimd(static_cast<SubjectChar>(pattern_first_char),
+                             subject, index, max_n);
+  }
+#endif
+
   if (sizeof(SubjectChar) == 2 && pattern_first_char == 0) {
     // Special-case looking for the 0 char in other than one-byte strings.
     // memchr mostly fails in this case due to every other byte being 0 in text
@@ -271,6 +351,34 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   int pattern_length = pattern.length();
   int i = index;
   int n = subject.length() - pattern_length;
+#if V8_STRING_SEARCH_HAVE_SSE2
+  {
+    // Find the positions where both the first and last characters of the
+    // pattern match, for a whole vector of positions at once, and only
+    // compare the rest of the pattern there. This is much more selective
+    // than looking for the first character only.
+    using Simd = SimdChars<SubjectChar>;
+    const __m128i first = Simd::Broadcast(static_cast<SubjectChar>(pattern[0]));
+    const __m128i last =
+        Simd::Broadcast(static_cast<SubjectChar>(pattern[pattern_length - 1]));
+    const uint32_t char_mask = (1u << Simd::kBitsPerChar) - 1;
+    for (; i + Simd::kWidth <= n + 1; i += Simd::kWidth) {
+      const SubjectChar* block = subject.begin() + i;
+      uint32_t mask = Simd::Match(block, first) &
+                      Simd::Match(block + pattern_length - 1, last);
+      while (mask != 0) {
+        int bit = base::bits::CountTrailingZeros(mask);
+        int offset = bit / Simd::kBitsPerChar;
+        if (pattern_length == 2 ||
+            CharCompare(pattern.begin() + 1, block + offset + 1,
+                        pattern_length - 2)) {
+          return i + offset;
+        }
+        mask &= ~(char_mask << bit);
+      }
+    }
+  }
+#endif
   while (i <= n) {
     i = FindFirstCharacter(pattern, subject, i);
     if (i == -1) return -1;
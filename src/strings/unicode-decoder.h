@@ -27,9 +27,19 @@ inline int NonAsciiStart(const uint8_t* chars, int length) {
       }
       ++chars;
     }
-    // Check aligned words.
+    // Check aligned words. Blocks of several words are checked at once
+    // first, which compilers turn into vector code; the word containing the
+    // first non-one-byte character is then found word by word.
     DCHECK_EQ(unibrow::Utf8::kMaxOneByteChar, 0x7F);
     const uintptr_t non_one_byte_mask = kUintptrAllBitsSet / 0xFF * 0x80;
+    constexpr int kWordsPerBlock = 4;
+    while (chars + kWordsPerBlock * sizeof(uintptr_t) <= limit) {
+      const uintptr_t* words = reinterpret_cast<const uintptr_t*>(chars);
+      uintptr_t bits = 0;
+      for (int i = 0; i < kWordsPerBlock; i++) bits |= words[i];
+      if (bits & non_one_byte_mask) break;
+      chars += kWordsPerBlock * sizeof(uintptr_t);
+    }
     while (chars + sizeof(uintptr_t) <= limit) {
       if (*reinterpret_cast<const uintptr_t*>(chars) & non_one_byte_mask) {
         return static_cast<int>(chars - start);
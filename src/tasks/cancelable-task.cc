@@ -20,8 +20,7 @@ Cancelable::~Cancelable() {
   }
 }
 
-CancelableTaskManager::CancelableTaskManager()
-    : task_id_counter_(kInvalidTaskId), canceled_(false) {}
+CancelableTaskManager::CancelableTaskManager() : canceled_(false) {}
 
 CancelableTaskManager::~CancelableTaskManager() {
   // It is required that {CancelAndWait} is called before the manager object is
@@ -39,32 +38,61 @@ CancelableTaskManager::Id CancelableTaskManager::Register(Cancelable* task) {
     task->Cancel();
     return kInvalidTaskId;
   }
-  CancelableTaskManager::Id id = ++task_id_counter_;
-  // Id overflows are not supported.
-  CHECK_NE(kInvalidTaskId, id);
-  CHECK(!canceled_);
-  cancelable_tasks_[id] = task;
-  return id;
+  uint32_t index = first_free_slot_;
+  if (index == kNoFreeSlot) {
+    index = static_cast<uint32_t>(slots_.size());
+    // Id overflows are not supported.
+    CHECK_NE(kNoFreeSlot, index);
+    slots_.push_back({nullptr, 0, kNoFreeSlot});
+  } else {
+    first_free_slot_ = slots_[index].next_free;
+  }
+  Slot& slot = slots_[index];
+  DCHECK_NULL(slot.task);
+  slot.task = task;
+  num_tasks_++;
+  return MakeId(index, slot.generation);
+}
+
+CancelableTaskManager::Slot* CancelableTaskManager::FindSlot(Id id) {
+  DCHECK_NE(kInvalidTaskId, id);
+  Id index = (id & 0xFFFFFFFF) - 1;
+  if (index >= slots_.size()) return nullptr;
+  Slot* slot = &slots_[index];
+  if (slot->task == nullptr || MakeId(static_cast<uint32_t>(index),
+                                      slot->generation) != id) {
+    return nullptr;
+  }
+  return slot;
+}
+
+void CancelableTaskManager::FreeSlot(Slot* slot) {
+  DCHECK_NOT_NULL(slot->task);
+  slot->task = nullptr;
+  num_tasks_--;
+  // Retire the slot instead of reusing ids once its generation is exhausted.
+  if (slot->generation == std::numeric_limits<uint32_t>::max()) return;
+  slot->generation++;
+  slot->next_free = first_free_slot_;
+  first_free_slot_ = static_cast<uint32_t>(slot - slots_.data());
 }
 
 void CancelableTaskManager::RemoveFinishedTask(CancelableTaskManager::Id id) {
   CHECK_NE(kInvalidTaskId, id);
   base::MutexGuard guard(&mutex_);
-  size_t removed = cancelable_tasks_.erase(id);
-  USE(removed);
-  DCHECK_NE(0u, removed);
+  Slot* slot = FindSlot(id);
+  DCHECK_NOT_NULL(slot);
+  if (slot != nullptr) FreeSlot(slot);
   cancelable_tasks_barrier_.NotifyOne();
 }
 
 TryAbortResult CancelableTaskManager::TryAbort(CancelableTaskManager::Id id) {
   CHECK_NE(kInvalidTaskId, id);
   base::MutexGuard guard(&mutex_);
-  auto entry = cancelable_tasks_.find(id);
-  if (entry != cancelable_tasks_.end()) {
-    Cancelable* value = entry->second;
-    if (value->Cancel()) {
+  if (Slot* slot = FindSlot(id)) {
+    if (slot->task->Cancel()) {
       // Cannot call RemoveFinishedTask here because of recursive locking.
-      cancelable_tasks_.erase(entry);
+      FreeSlot(slot);
       cancelable_tasks_barrier_.NotifyOne();
       return TryAbortResult::kTaskAborted;
     } else {
@@ -84,17 +112,12 @@ void CancelableTaskManager::CancelAndWait() {
 
   // Cancelable tasks could be running or could potentially register new
   // tasks, requiring a loop here.
-  while (!cancelable_tasks_.empty()) {
-    for (auto it = cancelable_tasks_.begin(); it != cancelable_tasks_.end();) {
-      auto current = it;
-      // We need to get to the next element before erasing the current.
-      ++it;
-      if (current->second->Cancel()) {
-        cancelable_tasks_.erase(current);
-      }
+  while (num_tasks_ > 0) {
+    for (Slot& slot : slots_) {
+      if (slot.task != nullptr && slot.task->Cancel()) FreeSlot(&slot);
     }
     // Wait for already running background tasks.
-    if (!cancelable_tasks_.empty()) {
+    if (num_tasks_ > 0) {
       cancelable_tasks_barrier_.Wait(&mutex_);
     }
   }
@@ -105,18 +128,14 @@ TryAbortResult CancelableTaskManager::TryAbortAll() {
   // the way if possible, i.e., if they have not started yet.
   base::MutexGuard guard(&mutex_);
 
-  if (cancelable_tasks_.empty()) return TryAbortResult::kTaskRemoved;
+  if (num_tasks_ == 0) return TryAbortResult::kTaskRemoved;
 
-  for (auto it = cancelable_tasks_.begin(); it != cancelable_tasks_.end();) {
-    if (it->second->Cancel()) {
-      it = cancelable_tasks_.erase(it);
-    } else {
-      ++it;
-    }
+  for (Slot& slot : slots_) {
+    if (slot.task != nullptr && slot.task->Cancel()) FreeSlot(&slot);
   }
 
-  return cancelable_tasks_.empty() ? TryAbortResult::kTaskAborted
-                                   : TryAbortResult::kTaskRunning;
+  return num_tasks_ == 0 ? TryAbortResult::kTaskAborted
+                         : TryAbortResult::kTaskRunning;
 }
 
 CancelableTask::CancelableTask(Isolate* isolate)
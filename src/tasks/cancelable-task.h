@@ -6,7 +6,8 @@
 #define V8_TASKS_CANCELABLE_TASK_H_
 
 #include <atomic>
-#include <unordered_map>
+#include <limits>
+#include <vector>
 
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
@@ -75,11 +76,33 @@ class V8_EXPORT_PRIVATE CancelableTaskManager {
   // but needs to be removed.
   void RemoveFinishedTask(Id id);
 
-  // To mitigate the ABA problem, the api refers to tasks through an id.
-  Id task_id_counter_;
-
-  // A set of cancelable tasks that are currently registered.
-  std::unordered_map<Id, Cancelable*> cancelable_tasks_;
+  // Registered tasks are kept in a table of slots that are reused once their
+  // task is removed, so that registering a task doesn't allocate. To mitigate
+  // the ABA problem, the api refers to tasks through an id, which combines
+  // the index of the slot with a generation that is incremented whenever the
+  // slot is freed.
+  struct Slot {
+    // The registered task, or nullptr if the slot is free.
+    Cancelable* task;
+    uint32_t generation;
+    // Index of the next free slot, if this slot is free.
+    uint32_t next_free;
+  };
+
+  static constexpr uint32_t kNoFreeSlot = std::numeric_limits<uint32_t>::max();
+
+  static Id MakeId(uint32_t index, uint32_t generation) {
+    return (Id{generation} << 32) | (Id{index} + 1);
+  }
+  // Returns the slot registered with {id}, or nullptr if the task of {id} was
+  // removed.
+  Slot* FindSlot(Id id);
+  void FreeSlot(Slot* slot);
+
+  std::vector<Slot> slots_;
+  uint32_t first_free_slot_ = kNoFreeSlot;
+  // Number of tasks that are currently registered.
+  size_t num_tasks_ = 0;
 
   // Mutex and condition variable enabling concurrent register and removing, as
   // well as waiting for background tasks on {CancelAndWait}.
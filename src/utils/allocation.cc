@@ -427,5 +427,12 @@ void VirtualMemoryCage::Free() {
   }
 }
 
+void VirtualMemoryCage::AdviseHugePages() {
+  DCHECK(IsReserved());
+  // This is only a hint, the OS may not support huge pages for the region.
+  USE(reservation_.page_allocator()->AdviseHugePages(
+      reinterpret_cast<void*>(reservation_.address()), reservation_.size()));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -355,6 +355,9 @@ class VirtualMemoryCage {
 
   void Free();
 
+  // Hints the OS to back the whole reservation with huge pages.
+  void AdviseHugePages();
+
  protected:
   Address base_ = kNullAddress;
   std::unique_ptr<base::BoundedPageAllocator> page_allocator_;
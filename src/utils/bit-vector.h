@@ -172,9 +172,9 @@ class V8_EXPORT_PRIVATE BitVector : public ZoneObject {
       DCHECK(other.is_inline());
       data_.inline_ |= other.data_.inline_;
     } else {
-      for (int i = 0; i < data_length_; i++) {
-        data_.ptr_[i] |= other.data_.ptr_[i];
-      }
+      uintptr_t* data = data_.ptr_;
+      const uintptr_t* other_data = other.data_.ptr_;
+      for (int i = 0, n = data_length_; i < n; i++) data[i] |= other_data[i];
     }
   }
 
@@ -186,13 +186,15 @@ class V8_EXPORT_PRIVATE BitVector : public ZoneObject {
       data_.inline_ |= other.data_.inline_;
       return data_.inline_ != old_data;
     } else {
-      bool changed = false;
-      for (int i = 0; i < data_length_; i++) {
-        uintptr_t old_data = data_.ptr_[i];
-        data_.ptr_[i] |= other.data_.ptr_[i];
-        if (data_.ptr_[i] != old_data) changed = true;
+      uintptr_t* data = data_.ptr_;
+      const uintptr_t* other_data = other.data_.ptr_;
+      uintptr_t changed = 0;
+      for (int i = 0, n = data_length_; i < n; i++) {
+        uintptr_t new_data = data[i] | other_data[i];
+        changed |= data[i] ^ new_data;
+        data[i] = new_data;
       }
-      return changed;
+      return changed != 0;
     }
   }
 
@@ -202,9 +204,9 @@ class V8_EXPORT_PRIVATE BitVector : public ZoneObject {
       DCHECK(other.is_inline());
       data_.inline_ &= other.data_.inline_;
     } else {
-      for (int i = 0; i < data_length_; i++) {
-        data_.ptr_[i] &= other.data_.ptr_[i];
-      }
+      uintptr_t* data = data_.ptr_;
+      const uintptr_t* other_data = other.data_.ptr_;
+      for (int i = 0, n = data_length_; i < n; i++) data[i] &= other_data[i];
     }
   }
 
@@ -216,13 +218,15 @@ class V8_EXPORT_PRIVATE BitVector : public ZoneObject {
       data_.inline_ &= other.data_.inline_;
       return data_.inline_ != old_data;
     } else {
-      bool changed = false;
-      for (int i = 0; i < data_length_; i++) {
-        uintptr_t old_data = data_.ptr_[i];
-        data_.ptr_[i] &= other.data_.ptr_[i];
-        if (data_.ptr_[i] != old_data) changed = true;
+      uintptr_t* data = data_.ptr_;
+      const uintptr_t* other_data = other.data_.ptr_;
+      uintptr_t changed = 0;
+      for (int i = 0, n = data_length_; i < n; i++) {
+        uintptr_t new_data = data[i] & other_data[i];
+        changed |= data[i] ^ new_data;
+        data[i] = new_data;
       }
-      return changed;
+      return changed != 0;
     }
   }
 
@@ -232,9 +236,9 @@ class V8_EXPORT_PRIVATE BitVector : public ZoneObject {
       DCHECK(other.is_inline());
       data_.inline_ &= ~other.data_.inline_;
     } else {
-      for (int i = 0; i < data_length_; i++) {
-        data_.ptr_[i] &= ~other.data_.ptr_[i];
-      }
+      uintptr_t* data = data_.ptr_;
+      const uintptr_t* other_data = other.data_.ptr_;
+      for (int i = 0, n = data_length_; i < n; i++) data[i] &= ~other_data[i];
     }
   }
 
@@ -242,9 +246,7 @@ class V8_EXPORT_PRIVATE BitVector : public ZoneObject {
     if (is_inline()) {
       data_.inline_ = 0;
     } else {
-      for (int i = 0; i < data_length_; i++) {
-        data_.ptr_[i] = 0;
-      }
+      memset(data_.ptr_, 0, sizeof(uintptr_t) * data_length_);
     }
   }
 
@@ -252,10 +254,10 @@ class V8_EXPORT_PRIVATE BitVector : public ZoneObject {
     if (is_inline()) {
       return data_.inline_ == 0;
     } else {
-      for (int i = 0; i < data_length_; i++) {
-        if (data_.ptr_[i] != 0) return false;
-      }
-      return true;
+      const uintptr_t* data = data_.ptr_;
+      uintptr_t any = 0;
+      for (int i = 0, n = data_length_; i < n; i++) any |= data[i];
+      return any == 0;
     }
   }
 
@@ -265,10 +267,13 @@ class V8_EXPORT_PRIVATE BitVector : public ZoneObject {
       DCHECK(other.is_inline());
       return data_.inline_ == other.data_.inline_;
     } else {
-      for (int i = 0; i < data_length_; i++) {
-        if (data_.ptr_[i] != other.data_.ptr_[i]) return false;
+      const uintptr_t* data = data_.ptr_;
+      const uintptr_t* other_data = other.data_.ptr_;
+      uintptr_t diff = 0;
+      for (int i = 0, n = data_length_; i < n; i++) {
+        diff |= data[i] ^ other_data[i];
       }
-      return true;
+      return diff == 0;
     }
   }
 
@@ -7,14 +7,47 @@
 #include "src/base/functional.h"
 #include "src/base/logging.h"
 #include "src/heap/heap.h"
+#include "src/objects/swiss-hash-table-helpers.h"
 #include "src/roots/roots-inl.h"
 
 namespace v8 {
 namespace internal {
 
+namespace {
+
+using swiss_table::ctrl_t;
+using swiss_table::Group;
+
+constexpr int kGroupWidth = static_cast<int>(Group::kWidth);
 static const int kInitialIdentityMapSize = 4;
 static const int kResizeFactor = 2;
 
+// The control byte of a present entry. The index of an entry is taken from
+// the low bits of its hash, so take the control byte from the high bits to
+// tell apart entries that collide on their index.
+ctrl_t CtrlForHash(uint32_t hash) {
+  return static_cast<ctrl_t>(hash >> (32 - swiss_table::kH2Bits));
+}
+
+// The number of words needed for the control bytes of a map of {capacity}
+// entries, including the mirrored bytes.
+size_t CtrlArrayLength(int capacity) {
+  size_t bytes = capacity + kGroupWidth - 1;
+  return (bytes + sizeof(uintptr_t) - 1) / sizeof(uintptr_t);
+}
+
+void SetCtrl(ctrl_t* ctrl, int capacity, int index, ctrl_t value) {
+  ctrl[index] = value;
+  // Keep the mirrored bytes behind the end in sync, so that a group loaded
+  // close to the end sees the entries it wraps around to.
+  for (int mirror = capacity + index; mirror < capacity + kGroupWidth - 1;
+       mirror += capacity) {
+    ctrl[mirror] = value;
+  }
+}
+
+}  // namespace
+
 IdentityMapBase::~IdentityMapBase() {
   // Clear must be called by the subclass to avoid calling the virtual
   // DeleteArray function from the destructor.
@@ -26,9 +59,9 @@ void IdentityMapBase::Clear() {
     DCHECK(!is_iterable());
     DCHECK_NOT_NULL(strong_roots_entry_);
     heap_->UnregisterStrongRoots(strong_roots_entry_);
-    DeletePointerArray(reinterpret_cast<uintptr_t*>(keys_), capacity_);
-    DeletePointerArray(values_, capacity_);
+    DeleteStorage(keys_, ctrl_, values_, capacity_);
     keys_ = nullptr;
+    ctrl_ = nullptr;
     strong_roots_entry_ = nullptr;
     values_ = nullptr;
     size_ = 0;
@@ -47,16 +80,54 @@ void IdentityMapBase::DisableIteration() {
   is_iterable_ = false;
 }
 
-int IdentityMapBase::ScanKeysFor(Address address, uint32_t hash) const {
-  int start = hash & mask_;
+void IdentityMapBase::AllocateStorage(int capacity) {
+  capacity_ = capacity;
+  mask_ = capacity - 1;
+
+  keys_ = reinterpret_cast<Address*>(NewPointerArray(capacity_));
   Address not_mapped = ReadOnlyRoots(heap_).not_mapped_symbol().ptr();
-  for (int index = start; index < capacity_; index++) {
-    if (keys_[index] == address) return index;  // Found.
-    if (keys_[index] == not_mapped) return -1;  // Not found.
-  }
-  for (int index = 0; index < start; index++) {
-    if (keys_[index] == address) return index;  // Found.
-    if (keys_[index] == not_mapped) return -1;  // Not found.
+  for (int i = 0; i < capacity_; i++) keys_[i] = not_mapped;
+  size_t ctrl_length = CtrlArrayLength(capacity_);
+  ctrl_ = reinterpret_cast<ctrl_t*>(NewPointerArray(ctrl_length));
+  memset(ctrl_, swiss_table::kEmpty, sizeof(uintptr_t) * ctrl_length);
+  values_ = NewPointerArray(capacity_);
+  memset(values_, 0, sizeof(uintptr_t) * capacity_);
+}
+
+void IdentityMapBase::DeleteStorage(Address* keys, ctrl_t* ctrl,
+                                    uintptr_t* values, int capacity) {
+  DeletePointerArray(reinterpret_cast<uintptr_t*>(keys), capacity);
+  DeletePointerArray(reinterpret_cast<uintptr_t*>(ctrl),
+                     CtrlArrayLength(capacity));
+  DeletePointerArray(values, capacity);
+}
+
+bool IdentityMapBase::IsEmptyIndex(int index) const {
+  return ctrl_[index] == swiss_table::kEmpty;
+}
+
+void IdentityMapBase::SetKey(int index, Address key, uint32_t hash) {
+  keys_[index] = key;
+  SetCtrl(ctrl_, capacity_, index, CtrlForHash(hash));
+}
+
+void IdentityMapBase::ClearKey(int index, Address not_mapped) {
+  keys_[index] = not_mapped;
+  SetCtrl(ctrl_, capacity_, index, swiss_table::kEmpty);
+}
+
+int IdentityMapBase::ScanKeysFor(Address address, uint32_t hash) const {
+  // Entries are placed by linear probing, so scan the control bytes from the
+  // start index a group at a time up to the first empty entry.
+  int index = hash & mask_;
+  for (int scanned = 0; scanned < capacity_; scanned += kGroupWidth) {
+    Group group(ctrl_ + index);
+    for (int i : group.Match(CtrlForHash(hash))) {
+      int candidate = (index + i) & mask_;
+      if (keys_[candidate] == address) return candidate;  // Found.
+    }
+    if (group.MatchEmpty()) return -1;  // Not found.
+    index = (index + kGroupWidth) & mask_;
   }
   return -1;
 }
@@ -70,21 +141,24 @@ std::pair<int, bool> IdentityMapBase::InsertKey(Address address,
     Resize(capacity_ * kResizeFactor);
   }
 
-  Address not_mapped = ReadOnlyRoots(heap_).not_mapped_symbol().ptr();
-
   int start = hash & mask_;
   // Guaranteed to terminate since size_ < capacity_, there must be at least
   // one empty slot.
   int index = start;
   while (true) {
-    if (keys_[index] == address) return {index, true};  // Found.
-    if (keys_[index] == not_mapped) {                   // Free entry.
+    Group group(ctrl_ + index);
+    for (int i : group.Match(CtrlForHash(hash))) {
+      int candidate = (index + i) & mask_;
+      if (keys_[candidate] == address) return {candidate, true};  // Found.
+    }
+    if (auto empty = group.MatchEmpty()) {  // Free entry.
+      int free = (index + empty.LowestBitSet()) & mask_;
       size_++;
       DCHECK_LE(size_, capacity_);
-      keys_[index] = address;
-      return {index, false};
+      SetKey(free, address, hash);
+      return {free, false};
     }
-    index = (index + 1) & mask_;
+    index = (index + kGroupWidth) & mask_;
     // We should never loop back to the start.
     DCHECK_NE(index, start);
   }
@@ -93,8 +167,8 @@ std::pair<int, bool> IdentityMapBase::InsertKey(Address address,
 bool IdentityMapBase::DeleteIndex(int index, uintptr_t* deleted_value) {
   if (deleted_value != nullptr) *deleted_value = values_[index];
   Address not_mapped = ReadOnlyRoots(heap_).not_mapped_symbol().ptr();
-  DCHECK_NE(keys_[index], not_mapped);
-  keys_[index] = not_mapped;
+  DCHECK(!IsEmptyIndex(index));
+  ClearKey(index, not_mapped);
   values_[index] = 0;
   size_--;
   DCHECK_GE(size_, 0);
@@ -109,10 +183,11 @@ bool IdentityMapBase::DeleteIndex(int index, uintptr_t* deleted_value) {
   int next_index = index;
   for (;;) {
     next_index = (next_index + 1) & mask_;
+    if (IsEmptyIndex(next_index)) break;
     Address key = keys_[next_index];
-    if (key == not_mapped) break;
 
-    int expected_index = Hash(key) & mask_;
+    uint32_t hash = Hash(key);
+    int expected_index = hash & mask_;
     if (index < next_index) {
       if (index < expected_index && expected_index <= next_index) continue;
     } else {
@@ -120,10 +195,12 @@ bool IdentityMapBase::DeleteIndex(int index, uintptr_t* deleted_value) {
       if (index < expected_index || expected_index <= next_index) continue;
     }
 
-    DCHECK_EQ(not_mapped, keys_[index]);
+    DCHECK(IsEmptyIndex(index));
     DCHECK_EQ(values_[index], 0);
-    std::swap(keys_[index], keys_[next_index]);
-    std::swap(values_[index], values_[next_index]);
+    SetKey(index, key, hash);
+    values_[index] = values_[next_index];
+    ClearKey(next_index, not_mapped);
+    values_[next_index] = 0;
     index = next_index;
   }
 
@@ -195,16 +272,9 @@ IdentityMapBase::RawEntry IdentityMapBase::InsertEntry(Address key) {
   CHECK(!is_iterable());
   if (capacity_ == 0) {
     // Allocate the initial storage for keys and values.
-    capacity_ = kInitialIdentityMapSize;
-    mask_ = kInitialIdentityMapSize - 1;
+    AllocateStorage(kInitialIdentityMapSize);
     gc_counter_ = heap_->gc_count();
 
-    keys_ = reinterpret_cast<Address*>(NewPointerArray(capacity_));
-    Address not_mapped = ReadOnlyRoots(heap_).not_mapped_symbol().ptr();
-    for (int i = 0; i < capacity_; i++) keys_[i] = not_mapped;
-    values_ = NewPointerArray(capacity_);
-    memset(values_, 0, sizeof(uintptr_t) * capacity_);
-
     strong_roots_entry_ =
         heap_->RegisterStrongRoots("IdentityMapBase", FullObjectSlot(keys_),
                                    FullObjectSlot(keys_ + capacity_));
@@ -234,7 +304,7 @@ bool IdentityMapBase::DeleteEntry(Address key, uintptr_t* deleted_value) {
 Address IdentityMapBase::KeyAtIndex(int index) const {
   DCHECK_LE(0, index);
   DCHECK_LT(index, capacity_);
-  DCHECK_NE(keys_[index], ReadOnlyRoots(heap_).not_mapped_symbol().ptr());
+  DCHECK(!IsEmptyIndex(index));
   CHECK(is_iterable());  // Must be iterable to access by index;
   return keys_[index];
 }
@@ -242,7 +312,7 @@ Address IdentityMapBase::KeyAtIndex(int index) const {
 IdentityMapBase::RawEntry IdentityMapBase::EntryAtIndex(int index) const {
   DCHECK_LE(0, index);
   DCHECK_LT(index, capacity_);
-  DCHECK_NE(keys_[index], ReadOnlyRoots(heap_).not_mapped_symbol().ptr());
+  DCHECK(!IsEmptyIndex(index));
   CHECK(is_iterable());  // Must be iterable to access by index;
   return &values_[index];
 }
@@ -251,9 +321,8 @@ int IdentityMapBase::NextIndex(int index) const {
   DCHECK_LE(-1, index);
   DCHECK_LE(index, capacity_);
   CHECK(is_iterable());  // Must be iterable to access by index;
-  Address not_mapped = ReadOnlyRoots(heap_).not_mapped_symbol().ptr();
   for (++index; index < capacity_; ++index) {
-    if (keys_[index] != not_mapped) {
+    if (!IsEmptyIndex(index)) {
       return index;
     }
   }
@@ -271,17 +340,22 @@ void IdentityMapBase::Rehash() {
   int last_empty = -1;
   Address not_mapped = ReadOnlyRoots(heap_).not_mapped_symbol().ptr();
   for (int i = 0; i < capacity_; i++) {
-    if (keys_[i] == not_mapped) {
+    if (IsEmptyIndex(i)) {
       last_empty = i;
     } else {
-      int pos = Hash(keys_[i]) & mask_;
+      uint32_t hash = Hash(keys_[i]);
+      int pos = hash & mask_;
       if (pos <= last_empty || pos > i) {
         // Evacuate an entry that is in the wrong place.
         reinsert.push_back(std::pair<Address, uintptr_t>(keys_[i], values_[i]));
-        keys_[i] = not_mapped;
+        ClearKey(i, not_mapped);
         values_[i] = 0;
         last_empty = i;
         size_--;
+      } else if (ctrl_[i] != CtrlForHash(hash)) {
+        // The key moved but can still be found from its new position; only
+        // its control byte is stale.
+        SetCtrl(ctrl_, capacity_, i, CtrlForHash(hash));
       }
     }
   }
@@ -299,21 +373,15 @@ void IdentityMapBase::Resize(int new_capacity) {
   DCHECK_GT(new_capacity, size_);
   int old_capacity = capacity_;
   Address* old_keys = keys_;
+  ctrl_t* old_ctrl = ctrl_;
   uintptr_t* old_values = values_;
 
-  capacity_ = new_capacity;
-  mask_ = capacity_ - 1;
+  AllocateStorage(new_capacity);
   gc_counter_ = heap_->gc_count();
   size_ = 0;
 
-  keys_ = reinterpret_cast<Address*>(NewPointerArray(capacity_));
-  Address not_mapped = ReadOnlyRoots(heap_).not_mapped_symbol().ptr();
-  for (int i = 0; i < capacity_; i++) keys_[i] = not_mapped;
-  values_ = NewPointerArray(capacity_);
-  memset(values_, 0, sizeof(uintptr_t) * capacity_);
-
   for (int i = 0; i < old_capacity; i++) {
-    if (old_keys[i] == not_mapped) continue;
+    if (old_ctrl[i] == swiss_table::kEmpty) continue;
     int index = InsertKey(old_keys[i], Hash(old_keys[i])).first;
     DCHECK_GE(index, 0);
     values_[index] = old_values[i];
@@ -325,8 +393,7 @@ void IdentityMapBase::Resize(int new_capacity) {
                            FullObjectSlot(keys_ + capacity_));
 
   // Delete old storage;
-  DeletePointerArray(reinterpret_cast<uintptr_t*>(old_keys), old_capacity);
-  DeletePointerArray(old_values, old_capacity);
+  DeleteStorage(old_keys, old_ctrl, old_values, old_capacity);
 }
 
 }  // namespace internal
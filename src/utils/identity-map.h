@@ -49,6 +49,7 @@ class V8_EXPORT_PRIVATE IdentityMapBase {
         capacity_(0),
         mask_(0),
         keys_(nullptr),
+        ctrl_(nullptr),
         strong_roots_entry_(nullptr),
         values_(nullptr),
         is_iterable_(false) {}
@@ -82,6 +83,13 @@ class V8_EXPORT_PRIVATE IdentityMapBase {
   void Resize(int new_capacity);
   uint32_t Hash(Address address) const;
 
+  void AllocateStorage(int capacity);
+  void DeleteStorage(Address* keys, signed char* ctrl, uintptr_t* values,
+                     int capacity);
+  bool IsEmptyIndex(int index) const;
+  void SetKey(int index, Address key, uint32_t hash);
+  void ClearKey(int index, Address not_mapped);
+
   base::hash<uintptr_t> hasher_;
   Heap* heap_;
   int gc_counter_;
@@ -89,6 +97,12 @@ class V8_EXPORT_PRIVATE IdentityMapBase {
   int capacity_;
   int mask_;
   Address* keys_;
+  // One control byte per entry in the style of a Swiss table: either
+  // swiss_table::kEmpty or 7 bits of the key's hash. Lookups compare a group
+  // of control bytes at once before touching {keys_}. The first group's worth
+  // of control bytes is mirrored behind the end so that a group can be loaded
+  // at any index.
+  signed char* ctrl_;
   StrongRootsEntry* strong_roots_entry_;
   uintptr_t* values_;
   bool is_iterable_;
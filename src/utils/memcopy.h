@@ -181,6 +181,48 @@ inline void CopyWords(Address dst, const Address src, size_t num_words) {
                             reinterpret_cast<const Address*>(src), num_words);
 }
 
+// Copies the first and the last N bytes of a block of |size| bytes, where
+// N <= size <= 2 * N. The two ranges overlap unless size == 2 * N. Both halves
+// are read before anything is written, so this is also correct for
+// overlapping source and destination.
+template <size_t N>
+V8_INLINE void CopyHeadAndTail(Address dst, Address src, size_t size) {
+  DCHECK_LE(N, size);
+  DCHECK_LE(size, 2 * N);
+  uint8_t head[N];
+  uint8_t tail[N];
+  memcpy(head, reinterpret_cast<const void*>(src), N);
+  memcpy(tail, reinterpret_cast<const void*>(src + size - N), N);
+  memcpy(reinterpret_cast<void*>(dst), head, N);
+  memcpy(reinterpret_cast<void*>(dst + size - N), tail, N);
+}
+
+// Copies |size| bytes from |src| to |dst|. The data spans must not overlap.
+// Most heap objects are small, so blocks of up to 64 bytes are copied with a
+// pair of fixed-size moves, which the compiler inlines. This avoids both a
+// per-word loop and an out-of-line memcpy call with a variable size, whose
+// branches on the size are hard to predict for mixed object sizes. Larger
+// blocks use MemCopy.
+inline void CopyBlockBytes(Address dst, Address src, size_t size) {
+  DCHECK(((src <= dst) && ((src + size) <= dst)) ||
+         ((dst <= src) && ((dst + size) <= src)));
+  if (size > 64) {
+    MemCopy(reinterpret_cast<void*>(dst), reinterpret_cast<const void*>(src),
+            size);
+  } else if (size > 32) {
+    CopyHeadAndTail<32>(dst, src, size);
+  } else if (size > 16) {
+    CopyHeadAndTail<16>(dst, src, size);
+  } else if (size >= 8) {
+    CopyHeadAndTail<8>(dst, src, size);
+  } else if (size >= 4) {
+    CopyHeadAndTail<4>(dst, src, size);
+  } else if (size > 0) {
+    memcpy(reinterpret_cast<void*>(dst), reinterpret_cast<const void*>(src),
+           size);
+  }
+}
+
 // Copies data from |src| to |dst|.  The data spans must not overlap.
 template <typename T>
 inline void CopyBytes(T* dst, const T* src, size_t num_bytes) {
@@ -346,6 +346,16 @@ inline bool CompareCharsEqualUnsigned(const lchar* lhs, const rchar* rhs,
     // two-byte char comparison is little- or big-endian.
     return memcmp(lhs, rhs, chars * sizeof(*lhs)) == 0;
   }
+  // Compare blocks of characters without early exits, which compilers turn
+  // into vector code that widens the one-byte characters.
+  constexpr size_t kBlockSize = 16;
+  for (; chars >= kBlockSize; chars -= kBlockSize) {
+    uint32_t diff = 0;
+    for (size_t i = 0; i < kBlockSize; i++) diff |= lhs[i] ^ rhs[i];
+    if (diff != 0) return false;
+    lhs += kBlockSize;
+    rhs += kBlockSize;
+  }
   for (const lchar* limit = lhs + chars; lhs < limit; ++lhs, ++rhs) {
     if (*lhs != *rhs) return false;
   }
@@ -814,6 +814,31 @@ void LiftoffAssembler::Spill(VarState* slot) {
   slot->MakeStack();
 }
 
+void LiftoffAssembler::PrepareLoopLocals() {
+  for (uint32_t i = 0; i < num_locals_; ++i) {
+    VarState& slot = cache_state_.stack_state[i];
+    if (slot.is_stack()) continue;
+    // Locals can be modified in the loop body, hence they cannot share a
+    // register with any other value.
+    if (slot.is_reg() && cache_state_.get_use_count(slot.reg()) == 1) continue;
+    RegClass rc = reg_class_for(slot.kind());
+    if (!cache_state_.has_unused_register(rc)) {
+      // Do not spill other values to make room; just spill this local.
+      Spill(&slot);
+      continue;
+    }
+    LiftoffRegister reg = cache_state_.unused_register(rc);
+    if (slot.is_const()) {
+      LoadConstant(reg, slot.constant());
+    } else {
+      Move(reg, slot.reg(), slot.kind());
+      cache_state_.dec_used(slot.reg());
+    }
+    cache_state_.inc_used(reg);
+    slot.MakeRegister(reg);
+  }
+}
+
 void LiftoffAssembler::SpillLocals() {
   for (uint32_t i = 0; i < num_locals_; ++i) {
     Spill(&cache_state_.stack_state[i]);
@@ -463,6 +463,12 @@ class LiftoffAssembler : public TurboAssembler {
   // stack, so that we can merge different values on the back-edge.
   void PrepareLoopArgs(int num);
 
+  // Ensure that each local is either in a register that is not used for any
+  // other value, or spilled to the stack. Constants are moved to free
+  // registers if possible. This allows to keep locals in registers across the
+  // back-edge of a loop.
+  void PrepareLoopLocals();
+
   int NextSpillOffset(ValueKind kind) {
     int offset = TopSpillOffset() + SlotSizeForType(kind);
     if (NeedsAlignment(kind)) {
@@ -4,6 +4,7 @@
 
 #include "src/wasm/baseline/liftoff-compiler.h"
 
+#include "src/base/bits.h"
 #include "src/base/enum-set.h"
 #include "src/base/optional.h"
 #include "src/base/platform/wrappers.h"
@@ -450,6 +451,24 @@ class LiftoffCompiler {
           debug_sidetable_entry_builder  // debug_side_table_entry_builder
       };
     }
+    static OutOfLineCode TierUp(
+        WasmCodePosition pos, LiftoffRegList regs_to_save,
+        Register cached_instance, SpilledRegistersForInspection* spilled_regs,
+        OutOfLineSafepointInfo* safepoint_info,
+        DebugSideTableBuilder::EntryBuilder* debug_sidetable_entry_builder) {
+      return {
+          {},                            // label
+          {},                            // continuation
+          WasmCode::kWasmTriggerTierUp,  // stub
+          pos,                           // position
+          regs_to_save,                  // regs_to_save
+          cached_instance,               // cached_instance
+          safepoint_info,                // safepoint_info
+          0,                             // pc
+          spilled_regs,                  // spilled_registers
+          debug_sidetable_entry_builder  // debug_side_table_entry_builder
+      };
+    }
   };
 
   LiftoffCompiler(compiler::CallDescriptor* call_descriptor,
@@ -693,9 +712,72 @@ class LiftoffCompiler {
     return false;
   }
 
-  void TierUpFunction(FullDecoder* decoder) {
-    __ CallRuntimeStub(WasmCode::kWasmTriggerTierUp);
-    DefineSafepoint();
+  // Increments the function's entry in the call count array and calls the
+  // tier-up runtime stub whenever the count reaches a power of two. This is
+  // emitted in the function prologue and in loop headers, such that a function
+  // becomes hot either by being called often or by running long loops. Live
+  // registers are only saved on the out-of-line path that calls the stub.
+  void TierUpCheck(FullDecoder* decoder, WasmCodePosition position) {
+    DEBUG_CODE_COMMENT("dynamic tiering");
+    // We cannot call the runtime in cctest/test-run-wasm.
+    if (!env_->runtime_exception_support) return;
+
+    // Allocating the scratch registers can change the stack state, hence do
+    // this before storing information about registers.
+    LiftoffRegList pinned;
+    LiftoffRegister array_address =
+        pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+    LiftoffRegister old_number_of_calls =
+        pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+    LiftoffRegister new_number_of_calls =
+        pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+
+    // Get the number of calls array address.
+    LOAD_INSTANCE_FIELD(array_address.gp(), NumLiftoffFunctionCallsArray,
+                        kSystemPointerSize, pinned);
+
+    LiftoffRegList regs_to_save = __ cache_state()->used_registers;
+    // The cached instance will be reloaded separately.
+    if (__ cache_state()->cached_instance != no_reg) {
+      DCHECK(regs_to_save.has(__ cache_state()->cached_instance));
+      regs_to_save.clear(__ cache_state()->cached_instance);
+    }
+    SpilledRegistersForInspection* spilled_regs = nullptr;
+
+    OutOfLineSafepointInfo* safepoint_info =
+        compilation_zone_->New<OutOfLineSafepointInfo>(compilation_zone_);
+    __ cache_state()->GetTaggedSlotsForOOLCode(
+        &safepoint_info->slots, &safepoint_info->spills,
+        for_debugging_
+            ? LiftoffAssembler::CacheState::SpillLocation::kStackSlots
+            : LiftoffAssembler::CacheState::SpillLocation::kTopOfStack);
+    if (V8_UNLIKELY(for_debugging_)) {
+      regs_to_save = {};
+      spilled_regs = GetSpilledRegistersForInspection();
+    }
+    out_of_line_code_.push_back(OutOfLineCode::TierUp(
+        position, regs_to_save, __ cache_state()->cached_instance, spilled_regs,
+        safepoint_info, RegisterOOLDebugSideTableEntry(decoder)));
+    OutOfLineCode& ool = out_of_line_code_.back();
+
+    // Compute the correct offset in the array.
+    uint32_t offset =
+        kInt32Size * declared_function_index(env_->module, func_index_);
+
+    // Get the number of calls and update it.
+    __ Load(old_number_of_calls, array_address.gp(), no_reg, offset,
+            LoadType::kI32Load, pinned);
+    __ emit_i32_addi(new_number_of_calls.gp(), old_number_of_calls.gp(), 1);
+    __ Store(array_address.gp(), no_reg, offset, new_number_of_calls,
+             StoreType::kI32Store, pinned);
+
+    // Call the runtime stub out of line if the number of calls is a power
+    // of 2.
+    __ emit_i32_and(old_number_of_calls.gp(), old_number_of_calls.gp(),
+                    new_number_of_calls.gp());
+    // Unary "equal" means "equals zero".
+    __ emit_cond_jump(kEqual, ool.label.get(), kI32, old_number_of_calls.gp());
+    __ bind(ool.continuation.get());
   }
 
   void TraceFunctionEntry(FullDecoder* decoder) {
@@ -796,47 +878,7 @@ class LiftoffCompiler {
     // is never a position of any instruction in the function.
     StackCheck(decoder, 0);
 
-    if (FLAG_wasm_dynamic_tiering) {
-      // TODO(arobin): Avoid spilling registers unconditionally.
-      __ SpillAllRegisters();
-      DEBUG_CODE_COMMENT("dynamic tiering");
-      LiftoffRegList pinned;
-
-      // Get the number of calls array address.
-      LiftoffRegister array_address =
-          pinned.set(__ GetUnusedRegister(kGpReg, pinned));
-      LOAD_INSTANCE_FIELD(array_address.gp(), NumLiftoffFunctionCallsArray,
-                          kSystemPointerSize, pinned);
-
-      // Compute the correct offset in the array.
-      uint32_t offset =
-          kInt32Size * declared_function_index(env_->module, func_index_);
-
-      // Get the number of calls and update it.
-      LiftoffRegister old_number_of_calls =
-          pinned.set(__ GetUnusedRegister(kGpReg, pinned));
-      LiftoffRegister new_number_of_calls =
-          pinned.set(__ GetUnusedRegister(kGpReg, pinned));
-      __ Load(old_number_of_calls, array_address.gp(), no_reg, offset,
-              LoadType::kI32Load, pinned);
-      __ emit_i32_addi(new_number_of_calls.gp(), old_number_of_calls.gp(), 1);
-      __ Store(array_address.gp(), no_reg, offset, new_number_of_calls,
-               StoreType::kI32Store, pinned);
-
-      // Emit the runtime call if necessary.
-      Label no_tierup;
-      // Check if the number of calls is a power of 2.
-      __ emit_i32_and(old_number_of_calls.gp(), old_number_of_calls.gp(),
-                      new_number_of_calls.gp());
-      // Unary "unequal" means "different from zero".
-      __ emit_cond_jump(kUnequal, &no_tierup, kI32, old_number_of_calls.gp());
-      TierUpFunction(decoder);
-      // After the runtime call, the instance cache register is clobbered (we
-      // reset it already in {SpillAllRegisters} above, but then we still access
-      // the instance afterwards).
-      __ cache_state()->ClearCachedInstanceRegister();
-      __ bind(&no_tierup);
-    }
+    if (FLAG_wasm_dynamic_tiering) TierUpCheck(decoder, 0);
 
     if (FLAG_trace_wasm) TraceFunctionEntry(decoder);
   }
@@ -846,6 +888,10 @@ class LiftoffCompiler {
         (std::string("out of line: ") + GetRuntimeStubName(ool->stub)).c_str());
     __ bind(ool->label.get());
     const bool is_stack_check = ool->stub == WasmCode::kWasmStackGuard;
+    const bool is_tier_up = ool->stub == WasmCode::kWasmTriggerTierUp;
+    // Stack checks and tier-up checks return to their continuation, traps
+    // never return.
+    const bool has_continuation = is_stack_check || is_tier_up;
     const bool is_mem_out_of_bounds =
         ool->stub == WasmCode::kThrowWasmTrapMemOutOfBounds;
 
@@ -859,8 +905,8 @@ class LiftoffCompiler {
     if (!env_->runtime_exception_support) {
       // We cannot test calls to the runtime in cctest/test-run-wasm.
       // Therefore we emit a call to C here instead of a call to the runtime.
-      // In this mode, we never generate stack checks.
-      DCHECK(!is_stack_check);
+      // In this mode, we never generate stack checks or tier-up checks.
+      DCHECK(!has_continuation);
       __ CallTrapCallbackForTesting();
       DEBUG_CODE_COMMENT("leave frame");
       __ LeaveFrame(StackFrame::WASM);
@@ -907,12 +953,12 @@ class LiftoffCompiler {
     if (V8_UNLIKELY(ool->debug_sidetable_entry_builder)) {
       ool->debug_sidetable_entry_builder->set_pc_offset(__ pc_offset());
     }
-    DCHECK_EQ(ool->continuation.get()->is_bound(), is_stack_check);
+    DCHECK_EQ(ool->continuation.get()->is_bound(), has_continuation);
     if (is_stack_check) {
       MaybeOSR();
     }
     if (!ool->regs_to_save.is_empty()) __ PopRegisters(ool->regs_to_save);
-    if (is_stack_check) {
+    if (has_continuation) {
       if (V8_UNLIKELY(ool->spilled_registers != nullptr)) {
         DCHECK(for_debugging_);
         for (auto& entry : ool->spilled_registers->entries) {
@@ -1082,10 +1128,16 @@ class LiftoffCompiler {
   void Loop(FullDecoder* decoder, Control* loop) {
     // Before entering a loop, spill all locals to the stack, in order to free
     // the cache registers, and to avoid unnecessarily reloading stack values
-    // into registers at branches.
+    // into registers at branches. With --wasm-loop-locals-in-registers, keep
+    // locals in registers instead (if they do not share their register with
+    // other values), which avoids reloading them in every iteration.
     // TODO(clemensb): Come up with a better strategy here, involving
     // pre-analysis of the function.
-    __ SpillLocals();
+    if (FLAG_wasm_loop_locals_in_registers && !for_debugging_) {
+      __ PrepareLoopLocals();
+    } else {
+      __ SpillLocals();
+    }
 
     __ PrepareLoopArgs(loop->start_merge.arity);
 
@@ -1099,6 +1151,9 @@ class LiftoffCompiler {
 
     // Execute a stack check in the loop header.
     StackCheck(decoder, decoder->position());
+
+    // Count back edges towards the function's hotness.
+    if (FLAG_wasm_dynamic_tiering) TierUpCheck(decoder, decoder->position());
   }
 
   void Try(FullDecoder* decoder, Control* block) {
@@ -2638,6 +2693,19 @@ class LiftoffCompiler {
       // With trap handlers we should not have a register pair as input (we
       // would only return the lower half).
       DCHECK_IMPLIES(env_->use_trap_handler, index.is_gp());
+      if (env_->module->is_memory64 && FLAG_wasm_bounds_checks) {
+        // The guard regions only cover 32-bit indexes (plus offset), so
+        // explicitly check that the upper half of a memory64 index is zero.
+        DCHECK(env_->use_trap_handler);
+        DEBUG_CODE_COMMENT("bounds check memory64 index upper half");
+        Label* trap_label =
+            AddOutOfLineTrap(decoder, WasmCode::kThrowWasmTrapMemOutOfBounds);
+        pinned.set(index);
+        LiftoffRegister high_word = __ GetUnusedRegister(kGpReg, pinned);
+        __ emit_i64_shri(high_word, index, 32);
+        // Unary "unequal" means "not equals zero".
+        __ emit_cond_jump(kUnequal, trap_label, kI32, high_word.gp());
+      }
       return index_ptrsize;
     }
 
@@ -4701,9 +4769,101 @@ class LiftoffCompiler {
              pinned);
   }
 
+  // memory.fill with a constant size of at most this many bytes is emitted
+  // as inline stores instead of a call to C.
+  static constexpr int32_t kMaxInlineMemoryFillSize = 64;
+
+  // Returns whether the top of the stack holds a constant size in
+  // [1, {max_size}], and stores it in {size} if so.
+  bool PeekInlineBulkMemorySize(int32_t max_size, uint32_t* size) {
+    if (env_->module->is_memory64) return false;
+    auto& size_slot = __ cache_state()->stack_state.back();
+    if (!size_slot.is_const()) return false;
+    int32_t value = size_slot.i32_const();
+    if (value <= 0 || value > max_size) return false;
+    *size = static_cast<uint32_t>(value);
+    return true;
+  }
+
+  // Copies {size} bytes with a single load and store; {size} is a power of
+  // two of at most the system pointer size.
+  void EmitInlineMemoryCopy(FullDecoder* decoder, uint32_t size) {
+    LoadType load_type = size == 1   ? LoadType::kI32Load8U
+                         : size == 2 ? LoadType::kI32Load16U
+                         : size == 4 ? LoadType::kI32Load
+                                     : LoadType::kI64Load;
+    StoreType store_type = size == 1   ? StoreType::kI32Store8
+                           : size == 2 ? StoreType::kI32Store16
+                           : size == 4 ? StoreType::kI32Store
+                                       : StoreType::kI64Store;
+    DCHECK_EQ(size, load_type.size());
+    __ cache_state()->stack_state.pop_back();
+    LiftoffRegList pinned;
+    LiftoffRegister full_src = pinned.set(__ PopToRegister());
+    LiftoffRegister full_dst = pinned.set(__ PopToRegister(pinned));
+    // Check both ranges before accessing memory, so that an out-of-bounds copy
+    // traps without having written anything.
+    Register dst = BoundsCheckMem(decoder, size, 0, full_dst, pinned,
+                                  kDoForceCheck);
+    if (dst == no_reg) return;
+    pinned.set(dst);
+    Register src = BoundsCheckMem(decoder, size, 0, full_src, pinned,
+                                  kDoForceCheck);
+    if (src == no_reg) return;
+    pinned.set(src);
+    uintptr_t dst_offset = 0;
+    uintptr_t src_offset = 0;
+    dst = AddMemoryMasking(dst, &dst_offset, &pinned);
+    src = AddMemoryMasking(src, &src_offset, &pinned);
+    Register mem = pinned.set(GetMemoryStart(pinned));
+    LiftoffRegister value = pinned.set(
+        __ GetUnusedRegister(reg_class_for(load_type.value_type().kind()),
+                             pinned));
+    __ Load(value, mem, src, src_offset, load_type, pinned, nullptr, true);
+    __ Store(mem, dst, dst_offset, value, store_type, pinned, nullptr, true);
+  }
+
+  void EmitInlineMemoryFill(FullDecoder* decoder, uint32_t size) {
+    __ cache_state()->stack_state.pop_back();
+    LiftoffRegList pinned;
+    LiftoffRegister value = pinned.set(__ PopToRegister());
+    LiftoffRegister full_dst = pinned.set(__ PopToRegister(pinned));
+    Register dst = BoundsCheckMem(decoder, size, 0, full_dst, pinned,
+                                  kDoForceCheck);
+    if (dst == no_reg) return;
+    pinned.set(dst);
+    uintptr_t offset = 0;
+    dst = AddMemoryMasking(dst, &offset, &pinned);
+
+    // Replicate the low byte of {value} into every byte of a word.
+    LiftoffRegister pattern = pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+    {
+      LiftoffRegister factor = __ GetUnusedRegister(kGpReg, pinned);
+      __ emit_i32_andi(pattern.gp(), value.gp(), 0xFF);
+      __ LoadConstant(factor, WasmValue(int32_t{0x01010101}));
+      __ emit_i32_mul(pattern.gp(), pattern.gp(), factor.gp());
+    }
+
+    Register mem = pinned.set(GetMemoryStart(pinned));
+    for (uint32_t filled = 0; filled < size;) {
+      uint32_t remaining = size - filled;
+      StoreType type = remaining >= 4   ? StoreType::kI32Store
+                       : remaining >= 2 ? StoreType::kI32Store16
+                                        : StoreType::kI32Store8;
+      __ Store(mem, dst, offset + filled, pattern, type, pinned, nullptr, true);
+      filled += type.size();
+    }
+  }
+
   void MemoryCopy(FullDecoder* decoder,
                   const MemoryCopyImmediate<validate>& imm, const Value&,
                   const Value&, const Value&) {
+    uint32_t inline_size;
+    if (PeekInlineBulkMemorySize(kSystemPointerSize, &inline_size) &&
+        base::bits::IsPowerOfTwo(inline_size)) {
+      EmitInlineMemoryCopy(decoder, inline_size);
+      return;
+    }
     LiftoffRegList pinned;
     LiftoffRegister size = pinned.set(__ PopToRegister());
     LiftoffRegister src = pinned.set(__ PopToRegister(pinned));
@@ -4725,6 +4885,11 @@ class LiftoffCompiler {
   void MemoryFill(FullDecoder* decoder,
                   const MemoryIndexImmediate<validate>& imm, const Value&,
                   const Value&, const Value&) {
+    uint32_t inline_size;
+    if (PeekInlineBulkMemorySize(kMaxInlineMemoryFillSize, &inline_size)) {
+      EmitInlineMemoryFill(decoder, inline_size);
+      return;
+    }
     LiftoffRegList pinned;
     LiftoffRegister size = pinned.set(__ PopToRegister());
     LiftoffRegister value = pinned.set(__ PopToRegister(pinned));
@@ -96,9 +96,13 @@ class WireBytesStorage {
 // Callbacks will receive either {kFailedCompilation} or both
 // {kFinishedBaselineCompilation} and {kFinishedTopTierCompilation}, in that
 // order. If tier up is off, both events are delivered right after each other.
+// With dynamic tiering, {kFinishedCompilationChunk} is delivered (possibly
+// repeatedly) after {kFinishedTopTierCompilation}, whenever enough code has
+// been tiered up since the last event that the module is worth caching again.
 enum class CompilationEvent : uint8_t {
   kFinishedBaselineCompilation,
   kFinishedExportWrappers,
+  kFinishedCompilationChunk,
   kFinishedTopTierCompilation,
   kFailedCompilation,
   kFinishedRecompilation
@@ -124,7 +128,16 @@ class V8_EXPORT_PRIVATE CompilationState {
 
   std::shared_ptr<WireBytesStorage> GetWireBytesStorage() const;
 
-  void AddCallback(callback_t);
+  // With dynamic tiering, callbacks are released once no more initial or
+  // recompilation events are to be delivered. Callbacks added with
+  // {kKeepForCompilationChunks} stay registered and also receive
+  // {kFinishedCompilationChunk} events.
+  enum CallbackLifetime : bool {
+    kReleaseAfterFinalEvent,
+    kKeepForCompilationChunks
+  };
+
+  void AddCallback(callback_t, CallbackLifetime = kReleaseAfterFinalEvent);
 
   void InitializeAfterDeserialization();
 
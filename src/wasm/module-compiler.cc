@@ -24,6 +24,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/trap-handler/trap-handler.h"
 #include "src/utils/identity-map.h"
+#include "src/wasm/function-body-decoder.h"
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-code-manager.h"
@@ -566,7 +567,9 @@ class CompilationStateImpl {
   // Add the callback function to be called on compilation events. Needs to be
   // set before {AddCompilationUnits} is run to ensure that it receives all
   // events. The callback object must support being deleted from any thread.
-  void AddCallback(CompilationState::callback_t);
+  void AddCallback(CompilationState::callback_t,
+                   CompilationState::CallbackLifetime =
+                       CompilationState::kReleaseAfterFinalEvent);
 
   // Inserts new functions to compile and kicks off compilation.
   void AddCompilationUnits(
@@ -577,6 +580,11 @@ class CompilationStateImpl {
   void AddTopTierCompilationUnit(WasmCompilationUnit);
   void AddTopTierPriorityCompilationUnit(WasmCompilationUnit, size_t);
 
+  // Marks the declared function {func_index} as queued for background
+  // compilation ahead of its first call. Returns {false} if it was already
+  // marked before.
+  bool MarkQueuedForPrecompilation(int func_index);
+
   CompilationUnitQueues::Queue* GetQueueForCompileTask(int task_id);
 
   base::Optional<WasmCompilationUnit> GetNextCompilationUnit(
@@ -707,6 +715,10 @@ class CompilationStateImpl {
   // compiling.
   std::shared_ptr<WireBytesStorage> wire_bytes_storage_;
 
+  // Lazy functions which were already queued for background compilation
+  // because one of their callers got compiled ({--wasm-lazy-precompile}).
+  std::vector<bool> queued_for_precompilation_;
+
   // End of fields protected by {mutex_}.
   //////////////////////////////////////////////////////////////////////////////
 
@@ -721,6 +733,10 @@ class CompilationStateImpl {
   // Callback functions to be called on compilation events.
   std::vector<CompilationState::callback_t> callbacks_;
 
+  // With dynamic tiering, callbacks that keep receiving
+  // {kFinishedCompilationChunk} events after all other events were delivered.
+  std::vector<CompilationState::callback_t> chunk_callbacks_;
+
   // Events that already happened.
   base::EnumSet<CompilationEvent> finished_events_;
 
@@ -732,6 +748,10 @@ class CompilationStateImpl {
   int outstanding_recompilation_functions_ = 0;
   TieringState tiering_state_ = kTieredUp;
 
+  // Size of TurboFan code produced by dynamic tiering since the last
+  // {kFinishedCompilationChunk} event.
+  size_t bytes_since_last_chunk_ = 0;
+
   // End of fields protected by {callbacks_mutex_}.
   //////////////////////////////////////////////////////////////////////////////
 
@@ -809,8 +829,9 @@ std::shared_ptr<WireBytesStorage> CompilationState::GetWireBytesStorage()
   return Impl(this)->GetWireBytesStorage();
 }
 
-void CompilationState::AddCallback(CompilationState::callback_t callback) {
-  return Impl(this)->AddCallback(std::move(callback));
+void CompilationState::AddCallback(CompilationState::callback_t callback,
+                                   CallbackLifetime lifetime) {
+  return Impl(this)->AddCallback(std::move(callback), lifetime);
 }
 
 void CompilationState::WaitForTopTierFinished() {
@@ -920,8 +941,11 @@ ExecutionTierPair GetRequestedExecutionTiers(
 
     case CompileMode::kTiering:
 
-      // Default tiering behaviour.
-      result.top_tier = ExecutionTier::kTurbofan;
+      // Default tiering behaviour. With dynamic tiering, no top tier is
+      // requested up front; hot functions are tiered up individually once
+      // their Liftoff code triggers {TriggerTierUp}.
+      result.top_tier = FLAG_wasm_dynamic_tiering ? result.baseline_tier
+                                                  : ExecutionTier::kTurbofan;
 
       // Check if compilation hints override default tiering behaviour.
       if (enabled_features.has_compilation_hints()) {
@@ -1103,6 +1127,55 @@ bool IsLazyModule(const WasmModule* module) {
 
 }  // namespace
 
+namespace {
+// Queues background compilation of the functions called directly from
+// {func_index} which have no code yet, so that they are likely compiled by
+// the time they are first called.
+void PrecompileDirectCallees(Isolate* isolate, NativeModule* native_module,
+                             int func_index) {
+  const WasmModule* module = native_module->module();
+  CompilationStateImpl* compilation_state =
+      Impl(native_module->compilation_state());
+  base::Vector<const uint8_t> code =
+      compilation_state->GetWireBytesStorage()->GetCode(
+          module->functions[func_index].code);
+
+  const bool lazy_module = IsLazyModule(module);
+  std::vector<WasmCompilationUnit> baseline_units;
+  std::vector<WasmCompilationUnit> top_tier_units;
+  Zone zone(isolate->wasm_engine()->allocator(), ZONE_NAME);
+  BodyLocalDecls decls(&zone);
+  // The function was compiled successfully, hence it is valid.
+  BytecodeIterator iterator(code.begin(), code.end(), &decls);
+  for (; iterator.has_next(); iterator.next()) {
+    WasmOpcode opcode = iterator.current();
+    if (opcode != kExprCallFunction && opcode != kExprReturnCall) continue;
+    uint32_t length;
+    uint32_t callee = iterator.read_u32v<Decoder::kNoValidation>(
+        iterator.pc() + 1, &length, "function index");
+    if (callee < module->num_imported_functions) continue;
+    if (native_module->HasCode(callee)) continue;
+    if (!compilation_state->MarkQueuedForPrecompilation(callee)) continue;
+    ExecutionTierPair tiers = GetRequestedExecutionTiers(
+        module, compilation_state->compile_mode(),
+        native_module->enabled_features(), callee);
+    baseline_units.emplace_back(callee, tiers.baseline_tier, kNoDebugging);
+    // As in {CompileLazy}, tier up lazy functions once they have baseline
+    // code; other strategies queued their top tier unit already.
+    if (GetCompileStrategy(module, native_module->enabled_features(), callee,
+                           lazy_module) == CompileStrategy::kLazy &&
+        tiers.baseline_tier < tiers.top_tier) {
+      top_tier_units.emplace_back(callee, tiers.top_tier, kNoDebugging);
+    }
+  }
+  if (baseline_units.empty()) return;
+  TRACE_LAZY("Queueing %zu callees of wasm-function#%d.\n",
+             baseline_units.size(), func_index);
+  compilation_state->AddCompilationUnits(base::VectorOf(baseline_units),
+                                         base::VectorOf(top_tier_units), {});
+}
+}  // namespace
+
 bool CompileLazy(Isolate* isolate, Handle<WasmModuleObject> module_object,
                  int func_index) {
   NativeModule* native_module = module_object->native_module();
@@ -1174,6 +1247,12 @@ bool CompileLazy(Isolate* isolate, Handle<WasmModuleObject> module_object,
     compilation_state->AddTopTierCompilationUnit(tiering_unit);
   }
 
+  // Background compilation reports validation errors for the whole module,
+  // so only precompile callees if they were validated already.
+  if (FLAG_wasm_lazy_precompile && !FLAG_wasm_lazy_validation) {
+    PrecompileDirectCallees(isolate, native_module, func_index);
+  }
+
   return true;
 }
 
@@ -1528,9 +1607,11 @@ class CompilationTimeCallback {
       TimedHistogram* histogram = async_counters_->wasm_tier_up_module_time();
       histogram->AddSample(static_cast<int>(duration.InMicroseconds()));
 
+      size_t committed_code_space = native_module->committed_code_space();
       v8::metrics::WasmModuleTieredUp event{
           FLAG_wasm_lazy_compilation,           // lazy
           native_module->turbofan_code_size(),  // code_size_in_bytes
+          committed_code_space,                 // committed_code_size_in_bytes
           duration.InMicroseconds()             // wall_clock_duration_in_us
       };
       metrics_recorder_->DelayMainThreadEvent(event, context_id_);
@@ -1787,6 +1868,98 @@ void AsyncCompileJob::Abort() {
   isolate_->wasm_engine()->RemoveCompileJob(this);
 }
 
+namespace {
+
+// Function bodies of lazily compiled functions which still need to be
+// validated, shared between the {AsyncStreamingProcessor} (which adds them as
+// they arrive) and the {ValidateFunctionsStreamingJob} (which validates them in
+// the background).
+class ValidateFunctionsStreamingJobData {
+ public:
+  struct Unit {
+    int func_index;
+    base::Vector<const uint8_t> code;
+  };
+
+  // The wire bytes storage keeps the code section (and hence all function
+  // bodies) alive while units are being validated.
+  explicit ValidateFunctionsStreamingJobData(
+      std::shared_ptr<WireBytesStorage> wire_bytes_storage)
+      : wire_bytes_storage_(std::move(wire_bytes_storage)) {}
+
+  void AddUnit(int func_index, base::Vector<const uint8_t> code) {
+    base::MutexGuard guard(&mutex_);
+    units_.push_back({func_index, code});
+  }
+
+  base::Optional<Unit> GetNextUnit() {
+    base::MutexGuard guard(&mutex_);
+    if (next_unit_ == units_.size()) return {};
+    return units_[next_unit_++];
+  }
+
+  size_t NumOutstandingUnits() const {
+    base::MutexGuard guard(&mutex_);
+    return units_.size() - next_unit_;
+  }
+
+  // Only to be called after the validation job finished.
+  const std::vector<Unit>& units() const { return units_; }
+
+  std::atomic<bool> found_error{false};
+
+ private:
+  const std::shared_ptr<WireBytesStorage> wire_bytes_storage_;
+  mutable base::Mutex mutex_;
+  std::vector<Unit> units_;
+  size_t next_unit_ = 0;
+};
+
+class ValidateFunctionsStreamingJob final : public JobTask {
+ public:
+  ValidateFunctionsStreamingJob(
+      std::shared_ptr<const WasmModule> module, WasmFeatures enabled_features,
+      std::shared_ptr<Counters> counters, AccountingAllocator* allocator,
+      std::shared_ptr<ValidateFunctionsStreamingJobData> data)
+      : module_(std::move(module)),
+        enabled_features_(enabled_features),
+        counters_(std::move(counters)),
+        allocator_(allocator),
+        data_(std::move(data)) {}
+
+  void Run(JobDelegate* delegate) override {
+    TRACE_EVENT0("v8.wasm", "wasm.ValidateFunctionsStreaming");
+    while (!delegate->ShouldYield()) {
+      base::Optional<ValidateFunctionsStreamingJobData::Unit> unit =
+          data_->GetNextUnit();
+      if (!unit) return;
+      DecodeResult result = ValidateSingleFunction(
+          module_.get(), unit->func_index, unit->code, counters_.get(),
+          allocator_, enabled_features_);
+      if (result.failed()) {
+        // The error is recomputed on the main thread once the stream finished.
+        data_->found_error.store(true, std::memory_order_relaxed);
+        return;
+      }
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    if (data_->found_error.load(std::memory_order_relaxed)) return 0;
+    return std::min(static_cast<size_t>(FLAG_wasm_num_compilation_tasks),
+                    worker_count + data_->NumOutstandingUnits());
+  }
+
+ private:
+  const std::shared_ptr<const WasmModule> module_;
+  const WasmFeatures enabled_features_;
+  const std::shared_ptr<Counters> counters_;
+  AccountingAllocator* const allocator_;
+  const std::shared_ptr<ValidateFunctionsStreamingJobData> data_;
+};
+
+}  // namespace
+
 class AsyncStreamingProcessor final : public StreamingProcessor {
  public:
   explicit AsyncStreamingProcessor(AsyncCompileJob* job,
@@ -1828,6 +2001,17 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
 
   void CommitCompilationUnits();
 
+  // Validates a lazily compiled function in the background.
+  void ValidateFunctionInBackground(int func_index,
+                                    base::Vector<const uint8_t> bytes);
+
+  // Waits for background validation of lazily compiled functions. Returns the
+  // error of the first invalid function, if any.
+  WasmError FinishValidatingFunctions();
+
+  // Stops background validation without waiting for the results.
+  void CancelValidatingFunctions();
+
   ModuleDecoder decoder_;
   AsyncCompileJob* job_;
   WasmEngine* wasm_engine_;
@@ -1838,6 +2022,12 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
   std::shared_ptr<Counters> async_counters_;
   AccountingAllocator* allocator_;
 
+  // State for validating lazily compiled functions in the background while
+  // the module is still being streamed.
+  std::shared_ptr<WireBytesStorage> wire_bytes_storage_;
+  std::shared_ptr<ValidateFunctionsStreamingJobData> validate_functions_data_;
+  std::unique_ptr<JobHandle> validate_functions_job_handle_;
+
   // Running hash of the wire bytes up to code section size, but excluding the
   // code section itself. Used by the {NativeModuleCache} to detect potential
   // duplicate modules.
@@ -2079,9 +2269,10 @@ class AsyncCompileJob::CompilationStateCallback {
           job_->DoSync<CompileFailed>();
         }
         break;
+      case CompilationEvent::kFinishedCompilationChunk:
       case CompilationEvent::kFinishedRecompilation:
-        // This event can happen either before or after
-        // {kFinishedTopTierCompilation}, hence don't remember this in
+        // These events can happen multiple times or after
+        // {kFinishedTopTierCompilation}, hence don't remember them in
         // {last_event_}.
         return;
     }
@@ -2459,6 +2650,7 @@ AsyncStreamingProcessor::AsyncStreamingProcessor(
       allocator_(allocator) {}
 
 AsyncStreamingProcessor::~AsyncStreamingProcessor() {
+  CancelValidatingFunctions();
   if (job_->native_module_ && job_->native_module_->wire_bytes().empty()) {
     // Clean up the temporary cache entry.
     job_->isolate_->wasm_engine()->StreamingCompilationFailed(prefix_hash_);
@@ -2471,6 +2663,7 @@ void AsyncStreamingProcessor::FinishAsyncCompileJobWithError(
   // Make sure all background tasks stopped executing before we change the state
   // of the AsyncCompileJob to DecodeFail.
   job_->background_task_manager_.CancelAndWait();
+  CancelValidatingFunctions();
 
   // Record event metrics.
   auto duration = base::TimeTicks::Now() - job_->start_time_;
@@ -2574,6 +2767,7 @@ bool AsyncStreamingProcessor::ProcessCodeSectionHeader(
 
   decoder_.set_code_section(code_section_start,
                             static_cast<uint32_t>(code_section_length));
+  wire_bytes_storage_ = wire_bytes_storage;
 
   prefix_hash_ = base::hash_combine(prefix_hash_,
                                     static_cast<uint32_t>(code_section_length));
@@ -2642,14 +2836,7 @@ bool AsyncStreamingProcessor::ProcessFunctionBody(
   if (validate_lazily_compiled_function) {
     // The native module does not own the wire bytes until {SetWireBytes} is
     // called in {OnFinishedStream}. Validation must use {bytes} parameter.
-    DecodeResult result =
-        ValidateSingleFunction(module, func_index, bytes, async_counters_.get(),
-                               allocator_, enabled_features);
-
-    if (result.failed()) {
-      FinishAsyncCompileJobWithError(result.error());
-      return false;
-    }
+    ValidateFunctionInBackground(func_index, bytes);
   }
 
   // Don't compile yet if we might have a cache hit.
@@ -2679,6 +2866,54 @@ void AsyncStreamingProcessor::CommitCompilationUnits() {
   compilation_unit_builder_->Commit();
 }
 
+void AsyncStreamingProcessor::ValidateFunctionInBackground(
+    int func_index, base::Vector<const uint8_t> bytes) {
+  if (!validate_functions_data_) {
+    DCHECK_NOT_NULL(wire_bytes_storage_);
+    validate_functions_data_ =
+        std::make_shared<ValidateFunctionsStreamingJobData>(
+            wire_bytes_storage_);
+  }
+  validate_functions_data_->AddUnit(func_index, bytes);
+  if (validate_functions_job_handle_) {
+    validate_functions_job_handle_->NotifyConcurrencyIncrease();
+    return;
+  }
+  validate_functions_job_handle_ = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserVisible,
+      std::make_unique<ValidateFunctionsStreamingJob>(
+          decoder_.shared_module(), job_->enabled_features_, async_counters_,
+          allocator_, validate_functions_data_));
+}
+
+WasmError AsyncStreamingProcessor::FinishValidatingFunctions() {
+  if (!validate_functions_job_handle_) return {};
+  {
+    TimedHistogramScope wait_time_scope(
+        async_counters_->wasm_streaming_validation_wait_time());
+    validate_functions_job_handle_->Join();
+    validate_functions_job_handle_.reset();
+  }
+  if (!validate_functions_data_->found_error.load(std::memory_order_relaxed)) {
+    return {};
+  }
+  // Report the error of the first invalid function, independent of the order
+  // in which the background threads validated them.
+  for (auto& unit : validate_functions_data_->units()) {
+    DecodeResult result = ValidateSingleFunction(
+        decoder_.module(), unit.func_index, unit.code, async_counters_.get(),
+        allocator_, job_->enabled_features_);
+    if (result.failed()) return std::move(result).error();
+  }
+  UNREACHABLE();
+}
+
+void AsyncStreamingProcessor::CancelValidatingFunctions() {
+  if (!validate_functions_job_handle_) return;
+  validate_functions_job_handle_->Cancel();
+  validate_functions_job_handle_.reset();
+}
+
 void AsyncStreamingProcessor::OnFinishedChunk() {
   TRACE_STREAMING("FinishChunk...\n");
   if (compilation_unit_builder_) CommitCompilationUnits();
@@ -2689,6 +2924,11 @@ void AsyncStreamingProcessor::OnFinishedStream(
     base::OwnedVector<uint8_t> bytes) {
   TRACE_STREAMING("Finish stream...\n");
   DCHECK_EQ(NativeModuleCache::PrefixHash(bytes.as_vector()), prefix_hash_);
+  WasmError validation_error = FinishValidatingFunctions();
+  if (validation_error.has_error()) {
+    FinishAsyncCompileJobWithError(validation_error);
+    return;
+  }
   ModuleResult result = decoder_.FinishDecoding(false);
   if (result.failed()) {
     FinishAsyncCompileJobWithError(result.error());
@@ -2767,6 +3007,7 @@ void AsyncStreamingProcessor::OnError(const WasmError& error) {
 
 void AsyncStreamingProcessor::OnAbort() {
   TRACE_STREAMING("Abort stream...\n");
+  CancelValidatingFunctions();
   job_->Abort();
 }
 
@@ -2851,6 +3092,7 @@ void CompilationStateImpl::CancelCompilation(
 
   // No more callbacks after abort.
   callbacks_.clear();
+  chunk_callbacks_.clear();
 }
 
 bool CompilationStateImpl::cancelled() const {
@@ -3019,7 +3261,9 @@ void CompilationStateImpl::InitializeRecompilation(
   }
 }
 
-void CompilationStateImpl::AddCallback(CompilationState::callback_t callback) {
+void CompilationStateImpl::AddCallback(
+    CompilationState::callback_t callback,
+    CompilationState::CallbackLifetime lifetime) {
   base::MutexGuard callbacks_guard(&callbacks_mutex_);
   // Immediately trigger events that already happened.
   for (auto event : {CompilationEvent::kFinishedExportWrappers,
@@ -3030,6 +3274,15 @@ void CompilationStateImpl::AddCallback(CompilationState::callback_t callback) {
       callback(event);
     }
   }
+  // With dynamic tiering, {kFinishedCompilationChunk} can still be delivered
+  // after {kFinishedTopTierCompilation}.
+  if (FLAG_wasm_dynamic_tiering &&
+      lifetime == CompilationState::kKeepForCompilationChunks) {
+    if (!finished_events_.contains(CompilationEvent::kFailedCompilation)) {
+      chunk_callbacks_.emplace_back(std::move(callback));
+    }
+    return;
+  }
   constexpr base::EnumSet<CompilationEvent> kFinalEvents{
       CompilationEvent::kFinishedTopTierCompilation,
       CompilationEvent::kFailedCompilation};
@@ -3071,6 +3324,18 @@ void CompilationStateImpl::AddTopTierPriorityCompilationUnit(
   compile_job_->NotifyConcurrencyIncrease();
 }
 
+bool CompilationStateImpl::MarkQueuedForPrecompilation(int func_index) {
+  const WasmModule* module = native_module_->module();
+  base::MutexGuard guard(&mutex_);
+  if (queued_for_precompilation_.empty()) {
+    queued_for_precompilation_.resize(module->num_declared_functions);
+  }
+  int declared_index = declared_function_index(module, func_index);
+  if (queued_for_precompilation_[declared_index]) return false;
+  queued_for_precompilation_[declared_index] = true;
+  return true;
+}
+
 std::shared_ptr<JSToWasmWrapperCompilationUnit>
 CompilationStateImpl::GetNextJSToWasmWrapperCompilationUnit() {
   size_t outstanding_units =
@@ -3205,6 +3470,13 @@ void CompilationStateImpl::OnFinishedUnits(
         }
       }
 
+      if (FLAG_wasm_dynamic_tiering && !code->for_debugging() &&
+          code->tier() == ExecutionTier::kTurbofan &&
+          reached_tier < ExecutionTier::kTurbofan) {
+        counters()->wasm_dynamically_tiered_functions()->Increment();
+        bytes_since_last_chunk_ += code->instructions().size();
+      }
+
       // Update function's compilation progress.
       if (code->tier() > reached_tier) {
         compilation_progress_[slot_index] = ReachedTierField::update(
@@ -3239,6 +3511,17 @@ void CompilationStateImpl::TriggerCallbacks(
     }
   }
 
+  // With dynamic tiering, notify embedders about more tiered-up code once the
+  // initial compilation is done, such that they can update their cache.
+  if (FLAG_wasm_dynamic_tiering &&
+      finished_events_.contains(
+          CompilationEvent::kFinishedTopTierCompilation) &&
+      static_cast<size_t>(FLAG_wasm_caching_threshold) <=
+          bytes_since_last_chunk_) {
+    triggered_events.Add(CompilationEvent::kFinishedCompilationChunk);
+    bytes_since_last_chunk_ = 0;
+  }
+
   if (compile_failed_.load(std::memory_order_relaxed)) {
     // *Only* trigger the "failed" event.
     triggered_events =
@@ -3249,9 +3532,11 @@ void CompilationStateImpl::TriggerCallbacks(
 
   // Don't trigger past events again.
   triggered_events -= finished_events_;
-  // Recompilation can happen multiple times, thus do not store this.
-  finished_events_ |=
-      triggered_events - CompilationEvent::kFinishedRecompilation;
+  // Recompilation and compilation chunks can happen multiple times, thus do
+  // not store these.
+  finished_events_ |= triggered_events -
+                      CompilationEvent::kFinishedRecompilation -
+                      CompilationEvent::kFinishedCompilationChunk;
 
   for (auto event :
        {std::make_pair(CompilationEvent::kFailedCompilation,
@@ -3260,6 +3545,8 @@ void CompilationStateImpl::TriggerCallbacks(
                        "wasm.ExportWrappersFinished"),
         std::make_pair(CompilationEvent::kFinishedBaselineCompilation,
                        "wasm.BaselineFinished"),
+        std::make_pair(CompilationEvent::kFinishedCompilationChunk,
+                       "wasm.CompilationChunkFinished"),
         std::make_pair(CompilationEvent::kFinishedTopTierCompilation,
                        "wasm.TopTierFinished"),
         std::make_pair(CompilationEvent::kFinishedRecompilation,
@@ -3270,13 +3557,21 @@ void CompilationStateImpl::TriggerCallbacks(
     for (auto& callback : callbacks_) {
       callback(event.first);
     }
+    for (auto& callback : chunk_callbacks_) {
+      callback(event.first);
+    }
   }
 
   if (outstanding_baseline_units_ == 0 && outstanding_export_wrappers_ == 0 &&
       outstanding_top_tier_functions_ == 0 &&
       outstanding_recompilation_functions_ == 0) {
-    // Clear the callbacks because no more events will be delivered.
+    // Clear the callbacks because no more events will be delivered to them.
+    // With dynamic tiering, code keeps getting tiered up (and reported via
+    // {kFinishedCompilationChunk}) after top tier compilation is finished.
     callbacks_.clear();
+    if (finished_events_.contains(CompilationEvent::kFailedCompilation)) {
+      chunk_callbacks_.clear();
+    }
   }
 }
 
@@ -3379,6 +3674,7 @@ void CompilationStateImpl::SetError() {
   base::MutexGuard callbacks_guard(&callbacks_mutex_);
   TriggerCallbacks();
   callbacks_.clear();
+  chunk_callbacks_.clear();
 }
 
 void CompilationStateImpl::WaitForCompilationEvent(
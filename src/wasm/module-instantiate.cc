@@ -4,6 +4,8 @@
 
 #include "src/wasm/module-instantiate.h"
 
+#include <atomic>
+
 #include "src/api/api.h"
 #include "src/asmjs/asm-js.h"
 #include "src/base/platform/wrappers.h"
@@ -78,6 +80,46 @@ class CompileImportWrapperJob final : public JobTask {
   WasmImportWrapperCache::ModificationScope* const cache_scope_;
 };
 
+// Copies a large data segment into memory in chunks of {kChunkSize} bytes,
+// which are distributed over the main thread and worker threads.
+class CopyDataSegmentJob final : public JobTask {
+ public:
+  static constexpr size_t kChunkSize = 1 * MB;
+
+  CopyDataSegmentJob(byte* dst, const byte* src, size_t size)
+      : dst_(dst),
+        src_(src),
+        size_(size),
+        num_chunks_((size + kChunkSize - 1) / kChunkSize) {}
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t flag_limit =
+        static_cast<size_t>(std::max(1, FLAG_wasm_num_compilation_tasks));
+    size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    size_t unclaimed_chunks =
+        next_chunk >= num_chunks_ ? 0 : num_chunks_ - next_chunk;
+    return std::min(flag_limit, worker_count + unclaimed_chunks);
+  }
+
+  void Run(JobDelegate* delegate) override {
+    while (true) {
+      size_t chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= num_chunks_) return;
+      size_t offset = chunk * kChunkSize;
+      std::memcpy(dst_ + offset, src_ + offset,
+                  std::min(kChunkSize, size_ - offset));
+      if (delegate->ShouldYield()) return;
+    }
+  }
+
+ private:
+  byte* const dst_;
+  const byte* const src_;
+  const size_t size_;
+  const size_t num_chunks_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
 Handle<DescriptorArray> CreateStructDescriptorArray(
     Isolate* isolate, const wasm::StructType* type) {
   if (type->field_count() == 0) {
@@ -881,8 +923,21 @@ void InstanceBuilder::LoadDataSegments(Handle<WasmInstanceObject> instance) {
       return;
     }
 
-    std::memcpy(instance->memory_start() + dest_offset,
-                wire_bytes.begin() + segment.source.offset(), size);
+    byte* dst = instance->memory_start() + dest_offset;
+    const byte* src = wire_bytes.begin() + segment.source.offset();
+    // Segments are still copied one after the other, so that overlapping
+    // segments keep their order; only the chunks of a single large segment
+    // are copied in parallel.
+    if (FLAG_wasm_parallel_data_segments &&
+        size > 2 * CopyDataSegmentJob::kChunkSize) {
+      auto copy_job = V8::GetCurrentPlatform()->PostJob(
+          TaskPriority::kUserBlocking,
+          std::make_unique<CopyDataSegmentJob>(dst, src, size));
+      // Wait for the job to finish, while contributing in this thread.
+      copy_job->Join();
+      continue;
+    }
+    std::memcpy(dst, src, size);
   }
 }
 
@@ -321,15 +321,23 @@ class TopTierCompiledCallback {
         callback_(std::move(callback)) {}
 
   void operator()(CompilationEvent event) const {
-    if (event != CompilationEvent::kFinishedTopTierCompilation) return;
+    // With dynamic tiering, more code gets tiered up after top tier
+    // compilation finished; report that too such that the module can be
+    // cached again.
+    if (event != CompilationEvent::kFinishedTopTierCompilation &&
+        event != CompilationEvent::kFinishedCompilationChunk) {
+      return;
+    }
     // If the native module is still alive, get back a shared ptr and call the
     // callback.
     if (std::shared_ptr<NativeModule> native_module = native_module_.lock()) {
       callback_(native_module);
     }
 #ifdef DEBUG
-    DCHECK(!called_);
-    called_ = true;
+    if (event == CompilationEvent::kFinishedTopTierCompilation) {
+      DCHECK(!called_);
+      called_ = true;
+    }
 #endif
   }
 
@@ -347,8 +355,10 @@ void AsyncStreamingDecoder::NotifyNativeModuleCreated(
     const std::shared_ptr<NativeModule>& native_module) {
   if (!module_compiled_callback_) return;
   auto* comp_state = native_module->compilation_state();
-  comp_state->AddCallback(TopTierCompiledCallback{
-      std::move(native_module), std::move(module_compiled_callback_)});
+  comp_state->AddCallback(
+      TopTierCompiledCallback{std::move(native_module),
+                              std::move(module_compiled_callback_)},
+      CompilationState::kKeepForCompilationChunks);
   module_compiled_callback_ = {};
 }
 
@@ -17,6 +17,7 @@
 #include "src/codegen/macro-assembler.h"
 #include "src/common/globals.h"
 #include "src/diagnostics/disassembler.h"
+#include "src/heap/code-range.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/objects/objects-inl.h"
@@ -1836,13 +1837,35 @@ void WasmCodeManager::AssignRange(base::AddressRegion region,
       region.begin(), std::make_pair(region.end(), native_module)));
 }
 
+namespace {
+// Returns a random page-aligned address at which a code space of {size} bytes
+// stays within near-call distance of the process-wide {CodeRange}, or just a
+// random mmap address if there is no such range. The random mmap address also
+// serves as the source of randomness, since it honours --random-seed.
+void* GetCodeSpaceHint(v8::PageAllocator* page_allocator, size_t size) {
+  void* random_hint = page_allocator->GetRandomMmapAddr();
+  std::shared_ptr<CodeRange> code_range = CodeRange::GetProcessWideCodeRange();
+  if (!code_range) return random_hint;
+  const base::AddressRegion& region = code_range->reservation()->region();
+  constexpr size_t kMaxNearRange = kMaxPCRelativeCodeRangeInMB * MB;
+  if (region.size() + size > kMaxNearRange) return random_hint;
+  const size_t page_size = page_allocator->AllocatePageSize();
+  const size_t num_offsets =
+      (kMaxNearRange - region.size() - size) / page_size + 1;
+  const size_t offset =
+      (reinterpret_cast<uintptr_t>(random_hint) / page_size) % num_offsets *
+      page_size;
+  return reinterpret_cast<void*>(region.end() + offset);
+}
+}  // namespace
+
 VirtualMemory WasmCodeManager::TryAllocate(size_t size, void* hint) {
   v8::PageAllocator* page_allocator = GetPlatformPageAllocator();
   DCHECK_GT(size, 0);
   size_t allocate_page_size = page_allocator->AllocatePageSize();
   size = RoundUp(size, allocate_page_size);
   if (!BackingStore::ReserveAddressSpace(size)) return {};
-  if (hint == nullptr) hint = page_allocator->GetRandomMmapAddr();
+  if (hint == nullptr) hint = GetCodeSpaceHint(page_allocator, size);
 
   // When we start exposing Wasm in jitless mode, then the jitless flag
   // will have to determine whether we set kMapAsJittable or not.
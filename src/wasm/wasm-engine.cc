@@ -1393,6 +1393,27 @@ bool WasmEngine::AddPotentiallyDeadCode(WasmCode* code) {
   return true;
 }
 
+void WasmEngine::FreeDeadCodeOnMemoryPressure() {
+  if (!FLAG_wasm_code_gc) return;
+  base::MutexGuard guard(&mutex_);
+  if (current_gc_info_ != nullptr || new_potentially_dead_code_size_ == 0) {
+    return;
+  }
+  // Account the GC to the first module with potentially dead code.
+  for (auto& entry : native_modules_) {
+    NativeModuleInfo* info = entry.second.get();
+    if (info->potentially_dead_code.empty()) continue;
+    if (info->num_code_gcs_triggered < std::numeric_limits<int8_t>::max()) {
+      ++info->num_code_gcs_triggered;
+    }
+    TRACE_CODE_GC(
+        "Triggering GC on memory pressure (potentially dead: %zu bytes).\n",
+        new_potentially_dead_code_size_);
+    TriggerGC(info->num_code_gcs_triggered);
+    return;
+  }
+}
+
 void WasmEngine::FreeDeadCode(const DeadCodeMap& dead_code) {
   base::MutexGuard guard(&mutex_);
   FreeDeadCodeLocked(dead_code);
@@ -342,6 +342,10 @@ class V8_EXPORT_PRIVATE WasmEngine {
   void FreeDeadCode(const DeadCodeMap&);
   void FreeDeadCodeLocked(const DeadCodeMap&);
 
+  // Trigger a code GC for all potentially dead code, independent of the
+  // amount of it. Called under critical memory pressure.
+  void FreeDeadCodeOnMemoryPressure();
+
   Handle<Script> GetOrCreateScript(Isolate*,
                                    const std::shared_ptr<NativeModule>&,
                                    base::Vector<const char> source_url);
@@ -4,6 +4,7 @@
 
 #include "src/wasm/wasm-import-wrapper-cache.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "src/logging/counters.h"
@@ -15,12 +16,28 @@ namespace wasm {
 
 WasmCode*& WasmImportWrapperCache::ModificationScope::operator[](
     const CacheKey& key) {
-  return cache_->entry_map_[key];
+  return (*cache_)[key];
 }
 
 WasmCode*& WasmImportWrapperCache::operator[](
     const WasmImportWrapperCache::CacheKey& key) {
-  return entry_map_[key];
+  auto it = entry_map_.find(key);
+  if (it != entry_map_.end()) return it->second;
+  // The key might point to a signature owned by the caller; store a copy.
+  CacheKey owned_key(key.kind, CopySignature(key.signature),
+                     key.expected_arity);
+  return entry_map_.emplace(owned_key, nullptr).first->second;
+}
+
+const FunctionSig* WasmImportWrapperCache::CopySignature(
+    const FunctionSig* sig) {
+  size_t num_reps = sig->return_count() + sig->parameter_count();
+  std::unique_ptr<ValueType[]> reps(new ValueType[num_reps]);
+  std::copy(sig->all().begin(), sig->all().end(), reps.get());
+  signatures_.emplace_back(std::make_unique<FunctionSig>(
+      sig->return_count(), sig->parameter_count(), reps.get()));
+  signature_reps_.push_back(std::move(reps));
+  return signatures_.back().get();
 }
 
 WasmCode* WasmImportWrapperCache::Get(compiler::WasmImportCallKind kind,
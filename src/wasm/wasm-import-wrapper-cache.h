@@ -9,6 +9,9 @@
 #ifndef V8_WASM_WASM_IMPORT_WRAPPER_CACHE_H_
 #define V8_WASM_WASM_IMPORT_WRAPPER_CACHE_H_
 
+#include <memory>
+#include <vector>
+
 #include "src/base/platform/mutex.h"
 #include "src/compiler/wasm-compiler.h"
 
@@ -24,7 +27,10 @@ class WasmEngine;
 
 using FunctionSig = Signature<ValueType>;
 
-// Implements a cache for import wrappers.
+// Implements a cache for import wrappers. Keys compare signatures by their
+// contents, so structurally identical signatures of the same module share a
+// wrapper. The cache keeps its own copy of every signature it stores a key
+// for, so callers may look up wrappers with short-lived signatures.
 class WasmImportWrapperCache {
  public:
   struct CacheKey {
@@ -37,7 +43,7 @@ class WasmImportWrapperCache {
                              : _expected_arity) {}
 
     bool operator==(const CacheKey& rhs) const {
-      return kind == rhs.kind && signature == rhs.signature &&
+      return kind == rhs.kind && *signature == *rhs.signature &&
              expected_arity == rhs.expected_arity;
     }
 
@@ -49,8 +55,8 @@ class WasmImportWrapperCache {
   class CacheKeyHash {
    public:
     size_t operator()(const CacheKey& key) const {
-      return base::hash_combine(static_cast<uint8_t>(key.kind), key.signature,
-                                key.expected_arity);
+      return base::hash_combine(static_cast<uint8_t>(key.kind),
+                                hash_value(*key.signature), key.expected_arity);
     }
   };
 
@@ -82,8 +88,13 @@ class WasmImportWrapperCache {
   ~WasmImportWrapperCache();
 
  private:
+  // Returns a copy of {sig} which lives as long as this cache.
+  const FunctionSig* CopySignature(const FunctionSig* sig);
+
   mutable base::Mutex mutex_;
   std::unordered_map<CacheKey, WasmCode*, CacheKeyHash> entry_map_;
+  std::vector<std::unique_ptr<ValueType[]>> signature_reps_;
+  std::vector<std::unique_ptr<FunctionSig>> signatures_;
 };
 
 }  // namespace wasm
@@ -10,6 +10,7 @@
 #include "src/codegen/code-factory.h"
 #include "src/compiler/wasm-compiler.h"
 #include "src/debug/debug-interface.h"
+#include "src/heap/heap-inl.h"
 #include "src/logging/counters.h"
 #include "src/objects/debug-objects-inl.h"
 #include "src/objects/objects-inl.h"
@@ -993,9 +994,18 @@ int32_t WasmMemoryObject::Grow(Isolate* isolate,
 
   size_t new_pages = old_pages + pages;
   DCHECK_LT(old_pages, new_pages);
-  // Try allocating a new backing store and copying.
+  // Try allocating a new backing store and copying. Reserve up to the maximum,
+  // so that later grows can happen in place.
+  size_t reservation_pages = max_pages;
+#ifdef V8_TARGET_ARCH_32_BIT
+  // As in {WasmMemoryObject::New}, reserve at most 1GB (but at least the new
+  // size) on 32-bit platforms to limit address space consumption.
+  constexpr size_t kGBPages = 1024 * 1024 * 1024 / wasm::kWasmPageSize;
+  reservation_pages =
+      std::max(new_pages, std::min(reservation_pages, kGBPages));
+#endif
   std::unique_ptr<BackingStore> new_backing_store =
-      backing_store->CopyWasmMemory(isolate, new_pages);
+      backing_store->CopyWasmMemory(isolate, new_pages, reservation_pages);
   if (!new_backing_store) {
     // Crash on out-of-memory if the correctness fuzzer is running.
     if (FLAG_correctness_fuzzer_suppressions) {
@@ -1295,6 +1305,10 @@ Handle<WasmInstanceObject> WasmInstanceObject::New(
       isolate->stack_guard()->address_of_jslimit());
   instance->set_real_stack_limit_address(
       isolate->stack_guard()->address_of_real_jslimit());
+  instance->set_new_allocation_top_address(
+      isolate->heap()->NewSpaceAllocationTopAddress());
+  instance->set_new_allocation_limit_address(
+      isolate->heap()->NewSpaceAllocationLimitAddress());
   instance->set_globals_start(nullptr);
   instance->set_indirect_function_table_size(0);
   instance->set_indirect_function_table_refs(
@@ -271,6 +271,13 @@ class ExternalReferenceList {
 static_assert(std::is_trivially_destructible<ExternalReferenceList>::value,
               "static destructors not allowed");
 
+// Whether functions without TurboFan code can be serialized as lazy stubs. This
+// is the case if they would be compiled lazily anyway, or if dynamic tiering
+// only ever optimizes a subset of the module's functions.
+bool CanSerializeLazyStubs() {
+  return FLAG_wasm_lazy_compilation || FLAG_wasm_dynamic_tiering;
+}
+
 }  // namespace
 
 class V8_EXPORT_PRIVATE NativeModuleSerializer {
@@ -304,7 +311,7 @@ NativeModuleSerializer::NativeModuleSerializer(
 size_t NativeModuleSerializer::MeasureCode(const WasmCode* code) const {
   if (code == nullptr) return sizeof(bool);
   DCHECK_EQ(WasmCode::kFunction, code->kind());
-  if (FLAG_wasm_lazy_compilation && code->tier() != ExecutionTier::kTurbofan) {
+  if (CanSerializeLazyStubs() && code->tier() != ExecutionTier::kTurbofan) {
     return sizeof(bool);
   }
   return kCodeHeaderSize + code->instructions().size() +
@@ -329,7 +336,7 @@ void NativeModuleSerializer::WriteHeader(Writer* writer,
 }
 
 bool NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
-  DCHECK_IMPLIES(!FLAG_wasm_lazy_compilation, code != nullptr);
+  DCHECK_IMPLIES(!CanSerializeLazyStubs(), code != nullptr);
   if (code == nullptr) {
     writer->Write(false);
     return true;
@@ -338,7 +345,7 @@ bool NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
   // Only serialize TurboFan code, as Liftoff code can contain breakpoints or
   // non-relocatable constants.
   if (code->tier() != ExecutionTier::kTurbofan) {
-    if (FLAG_wasm_lazy_compilation) {
+    if (CanSerializeLazyStubs()) {
       writer->Write(false);
       return true;
     }
@@ -689,7 +696,7 @@ DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
                                                        Reader* reader) {
   bool has_code = reader->Read<bool>();
   if (!has_code) {
-    DCHECK(FLAG_wasm_lazy_compilation ||
+    DCHECK(CanSerializeLazyStubs() ||
            native_module_->enabled_features().has_compilation_hints());
     native_module_->UseLazyStub(fn_index);
     return {};
@@ -551,6 +551,17 @@ void WebSnapshotSerializer::WriteValue(Handle<Object> object,
       serializer.WriteUint32(flags_id);
       break;
     }
+    case JS_DATE_TYPE: {
+      Handle<JSDate> date = Handle<JSDate>::cast(object);
+      if (date->map() != isolate_->date_function()->initial_map()) {
+        Throw("Web snapshot: Unsupported Date map");
+        return;
+      }
+      // TODO(v8:11525): Handle possible endianness mismatch.
+      serializer.WriteUint32(ValueType::DATE);
+      serializer.WriteDouble(date->value().Number());
+      break;
+    }
     default:
       if (object->IsString()) {
         SerializeString(Handle<String>::cast(object), id);
@@ -1172,6 +1183,22 @@ void WebSnapshotDeserializer::ReadValue(
       representation = Representation::Tagged();
       break;
     }
+    case ValueType::DATE: {
+      double time_value;
+      if (!deserializer_->ReadDouble(&time_value)) {
+        Throw("Web snapshot: Malformed Date");
+        return;
+      }
+      Handle<JSFunction> date_function = isolate_->date_function();
+      MaybeHandle<JSDate> maybe_date =
+          JSDate::New(date_function, date_function, time_value);
+      if (!maybe_date.ToHandle(&value)) {
+        Throw("Web snapshot: Malformed Date");
+        return;
+      }
+      representation = Representation::Tagged();
+      break;
+    }
     default:
       // TODO(v8:11525): Handle other value types.
       Throw("Web snapshot: Unsupported value type");
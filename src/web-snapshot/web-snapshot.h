@@ -52,7 +52,8 @@ class WebSnapshotSerializerDeserializer {
     ARRAY_ID,
     OBJECT_ID,
     FUNCTION_ID,
-    REGEXP
+    REGEXP,
+    DATE
   };
 
   uint32_t FunctionKindToFunctionFlags(FunctionKind kind);
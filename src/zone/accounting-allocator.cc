@@ -10,9 +10,11 @@
 #include "src/base/logging.h"
 #include "src/base/macros.h"
 #include "src/base/platform/wrappers.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
+#include "src/zone/zone.h"
 
 namespace v8 {
 namespace internal {
@@ -66,6 +68,8 @@ std::unique_ptr<v8::base::BoundedPageAllocator> CreateBoundedAllocator(
 }  // namespace
 
 AccountingAllocator::AccountingAllocator() {
+  STATIC_ASSERT(Zone::kMinimumSegmentSize << (kNumSegmentSizeClasses - 1) ==
+                Zone::kMaximumSegmentSize);
   if (COMPRESS_ZONES_BOOL) {
     v8::PageAllocator* platform_page_allocator = GetPlatformPageAllocator();
     VirtualMemory memory = ReserveAddressSpace(platform_page_allocator);
@@ -75,7 +79,70 @@ AccountingAllocator::AccountingAllocator() {
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { ReleasePooledSegments(); }
+
+// static
+int AccountingAllocator::SegmentSizeClass(size_t bytes) {
+  if (bytes > Zone::kMaximumSegmentSize) return -1;
+  int size_class = 0;
+  while ((Zone::kMinimumSegmentSize << size_class) < bytes) size_class++;
+  return size_class;
+}
+
+// static
+size_t AccountingAllocator::SegmentSizeClassSize(int size_class) {
+  return Zone::kMinimumSegmentSize << size_class;
+}
+
+void AccountingAllocator::ReleasePooledSegments() {
+  std::array<std::vector<Segment*>, kNumSegmentSizeClasses> segments;
+  {
+    base::MutexGuard guard(&pool_mutex_);
+    segments.swap(pooled_segments_);
+    pooled_bytes_ = 0;
+  }
+  for (std::vector<Segment*>& size_class : segments) {
+    for (Segment* segment : size_class) {
+      segment->ZapHeader();
+      base::Free(segment);
+    }
+  }
+}
+
+Segment* AccountingAllocator::TakePooledSegment(size_t* bytes) {
+  if (FLAG_zone_segment_pool_size == 0) return nullptr;
+  int size_class = SegmentSizeClass(*bytes);
+  if (size_class < 0) return nullptr;
+  // Round up even if the pool is empty, so that the new segment can be
+  // pooled once it is returned.
+  *bytes = SegmentSizeClassSize(size_class);
+  base::MutexGuard guard(&pool_mutex_);
+  std::vector<Segment*>& segments = pooled_segments_[size_class];
+  if (segments.empty()) {
+    segment_pool_misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  segment_pool_hits_.fetch_add(1, std::memory_order_relaxed);
+  Segment* segment = segments.back();
+  segments.pop_back();
+  pooled_bytes_ -= *bytes;
+  return segment;
+}
+
+bool AccountingAllocator::PoolSegment(Segment* segment) {
+  size_t segment_size = segment->total_size();
+  int size_class = SegmentSizeClass(segment_size);
+  if (size_class < 0 || SegmentSizeClassSize(size_class) != segment_size) {
+    return false;
+  }
+  base::MutexGuard guard(&pool_mutex_);
+  if (pooled_bytes_ + segment_size > FLAG_zone_segment_pool_size * KB) {
+    return false;
+  }
+  pooled_segments_[size_class].push_back(segment);
+  pooled_bytes_ += segment_size;
+  return true;
+}
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
@@ -85,6 +152,8 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
     memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
+  } else if (Segment* pooled = TakePooledSegment(&bytes)) {
+    memory = pooled;
   } else {
     memory = AllocWithRetry(bytes);
   }
@@ -106,6 +175,9 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapContents();
   size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
+  if (!(COMPRESS_ZONES_BOOL && supports_compression) && PoolSegment(segment)) {
+    return;
+  }
   segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     CHECK(FreePages(bounded_page_allocator_.get(), segment, segment_size));
@@ -5,10 +5,13 @@
 #ifndef V8_ZONE_ACCOUNTING_ALLOCATOR_H_
 #define V8_ZONE_ACCOUNTING_ALLOCATOR_H_
 
+#include <array>
 #include <atomic>
 #include <memory>
+#include <vector>
 
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -37,6 +40,9 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   // them if the pool is already full or memory pressure is high.
   void ReturnSegment(Segment* memory, bool supports_compression);
 
+  // Frees all segments kept in the pool for reuse.
+  void ReleasePooledSegments();
+
   size_t GetCurrentMemoryUsage() const {
     return current_memory_usage_.load(std::memory_order_relaxed);
   }
@@ -45,6 +51,16 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  // Number of segment allocations served from and missed by the pool. Only
+  // allocations that could have been pooled are counted.
+  size_t GetSegmentPoolHits() const {
+    return segment_pool_hits_.load(std::memory_order_relaxed);
+  }
+
+  size_t GetSegmentPoolMisses() const {
+    return segment_pool_misses_.load(std::memory_order_relaxed);
+  }
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -66,8 +82,28 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  // Pooled segments come in power-of-two size classes from
+  // Zone::kMinimumSegmentSize up to Zone::kMaximumSegmentSize.
+  static constexpr int kNumSegmentSizeClasses = 3;
+
+  // Returns the size class of pooled segments that can hold {bytes}, or -1 if
+  // segments of that size are not pooled.
+  static int SegmentSizeClass(size_t bytes);
+  static size_t SegmentSizeClassSize(int size_class);
+
+  Segment* TakePooledSegment(size_t* bytes);
+  bool PoolSegment(Segment* segment);
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
+  std::atomic<size_t> segment_pool_hits_{0};
+  std::atomic<size_t> segment_pool_misses_{0};
+
+  // Free segments kept for reuse by later zones, one list per size class.
+  // Together they hold at most --zone-segment-pool-size KBytes.
+  base::Mutex pool_mutex_;
+  std::array<std::vector<Segment*>, kNumSegmentSizeClasses> pooled_segments_;
+  size_t pooled_bytes_ = 0;
 
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
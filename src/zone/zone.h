@@ -184,6 +184,8 @@ class V8_EXPORT_PRIVATE Zone final {
 #endif
 
  private:
+  friend class AccountingAllocator;
+
   void* AsanNew(size_t size);
 
   // Deletes all objects and free all memory allocated in the Zone.
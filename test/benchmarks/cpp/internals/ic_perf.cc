@@ -0,0 +1,68 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "include/v8.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/internals/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarks {
+namespace {
+
+using PropertyLoad = BenchmarkWithContext;
+
+constexpr int kLoadsPerCall = 1000;
+
+// Loads one named property from objects of |st.range(0)| different shapes at
+// a single site. One shape keeps the IC monomorphic; more than four make it
+// megamorphic, where handlers are looked up in the stub cache.
+BENCHMARK_DEFINE_F(PropertyLoad, Shapes)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  const std::string source =
+      "(function() {"
+      "  const objects = [];"
+      "  for (let i = 0; i < " +
+      std::to_string(st.range(0)) +
+      "; i++) {"
+      "    const o = {x: i};"
+      "    o['p' + i] = i;"
+      "    objects.push(o);"
+      "  }"
+      "  function load(o) { return o.x; }"
+      "  return function run() {"
+      "    let sum = 0;"
+      "    for (let i = 0; i < " +
+      std::to_string(kLoadsPerCall) +
+      "; i++) {"
+      "      sum += load(objects[i % objects.length]);"
+      "    }"
+      "    return sum;"
+      "  };"
+      "})()";
+  v8::Local<v8::Script> script =
+      v8::Script::Compile(
+          context(),
+          v8::String::NewFromUtf8(v8_isolate(), source.c_str())
+              .ToLocalChecked())
+          .ToLocalChecked();
+  v8::Local<v8::Function> run = v8::Local<v8::Function>::Cast(
+      script->Run(context()).ToLocalChecked());
+  v8::Local<v8::Value> receiver = v8::Undefined(v8_isolate());
+  for (auto _ : st) {
+    USE(_);
+    benchmark::DoNotOptimize(
+        run->Call(context(), receiver, 0, nullptr).ToLocalChecked());
+  }
+  st.SetItemsProcessed(st.iterations() * kLoadsPerCall);
+}
+BENCHMARK_REGISTER_F(PropertyLoad, Shapes)->Arg(1)->Arg(4)->Arg(64);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace internal
+}  // namespace v8
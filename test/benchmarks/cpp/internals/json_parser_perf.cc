@@ -0,0 +1,55 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "src/base/macros.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/json/json-parser.h"
+#include "test/benchmarks/cpp/internals/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarks {
+namespace {
+
+using JsonParse = BenchmarkWithContext;
+
+// An array of |count| small records with the same shape, as typically sent
+// by a server.
+std::string MakeRecords(int count) {
+  std::string json = "[";
+  for (int i = 0; i < count; i++) {
+    if (i > 0) json += ",";
+    json += "{\"id\":" + std::to_string(i) + ",\"name\":\"item" +
+            std::to_string(i) +
+            "\",\"price\":12.5,\"tags\":[\"a\",\"b\"],\"active\":true}";
+  }
+  json += "]";
+  return json;
+}
+
+BENCHMARK_DEFINE_F(JsonParse, Records)(benchmark::State& st) {
+  const std::string json = MakeRecords(static_cast<int>(st.range(0)));
+  HandleScope scope(isolate());
+  Handle<String> source = isolate()->factory()->NewStringFromAsciiChecked(
+      json.c_str(), AllocationType::kOld);
+  Handle<Object> reviver = isolate()->factory()->undefined_value();
+  for (auto _ : st) {
+    USE(_);
+    HandleScope inner_scope(isolate());
+    benchmark::DoNotOptimize(
+        JsonParser<uint8_t>::Parse(isolate(), source, reviver)
+            .ToHandleChecked());
+  }
+  st.SetBytesProcessed(st.iterations() * json.size());
+}
+BENCHMARK_REGISTER_F(JsonParse, Records)->Arg(16)->Arg(1024);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace internal
+}  // namespace v8
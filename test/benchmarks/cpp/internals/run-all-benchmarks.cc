@@ -0,0 +1,28 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  // Flags that google benchmark did not consume are passed on to V8.
+  v8::V8::SetFlagsFromCommandLine(&argc, argv, true);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+
+  v8::V8::InitializeICUDefaultLocation(argv[0]);
+  v8::V8::InitializeExternalStartupData(argv[0]);
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform.get());
+  v8::V8::Initialize();
+
+  benchmark::RunSpecifiedBenchmarks();
+
+  v8::V8::Dispose();
+  v8::V8::ShutdownPlatform();
+  return 0;
+}
@@ -0,0 +1,45 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/macros.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/heap/heap.h"
+#include "src/objects/fixed-array-inl.h"
+#include "test/benchmarks/cpp/internals/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarks {
+namespace {
+
+using Scavenge = BenchmarkWithIsolate;
+
+// Scavenges a young generation of small arrays, |st.range(0)| percent of
+// which are still reachable. Only the scavenge itself is timed.
+BENCHMARK_DEFINE_F(Scavenge, Survivors)(benchmark::State& st) {
+  constexpr int kObjects = 10000;
+  const int survivors = kObjects * static_cast<int>(st.range(0)) / 100;
+  Factory* factory = isolate()->factory();
+  Heap* heap = isolate()->heap();
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    HandleScope scope(isolate());
+    Handle<FixedArray> roots = factory->NewFixedArray(survivors);
+    for (int i = 0; i < kObjects; i++) {
+      Handle<FixedArray> object = factory->NewFixedArray(4);
+      if (i < survivors) roots->set(i, *object);
+    }
+    st.ResumeTiming();
+    heap->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTesting);
+  }
+}
+BENCHMARK_REGISTER_F(Scavenge, Survivors)->Arg(0)->Arg(10)->Arg(100);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,54 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/macros.h"
+#include "src/common/globals.h"
+#include "src/heap/slot-set.h"
+#include "src/heap/spaces.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarks {
+namespace {
+
+// Records every |st.range(0)|-th tagged slot of a regular page.
+void BM_SlotSetInsert(benchmark::State& st) {
+  const int stride = static_cast<int>(st.range(0)) * kTaggedSize;
+  SlotSet* set = SlotSet::Allocate(SlotSet::kBucketsRegularPage);
+  for (auto _ : st) {
+    USE(_);
+    for (int offset = 0; offset < Page::kPageSize; offset += stride) {
+      set->Insert<AccessMode::NON_ATOMIC>(offset);
+    }
+  }
+  SlotSet::Delete(set, SlotSet::kBucketsRegularPage);
+  st.SetItemsProcessed(st.iterations() * (Page::kPageSize / stride));
+}
+BENCHMARK(BM_SlotSetInsert)->Arg(1)->Arg(16);
+
+// Visits the recorded slots of a regular page, keeping all of them.
+void BM_SlotSetIterate(benchmark::State& st) {
+  const int stride = static_cast<int>(st.range(0)) * kTaggedSize;
+  SlotSet* set = SlotSet::Allocate(SlotSet::kBucketsRegularPage);
+  for (int offset = 0; offset < Page::kPageSize; offset += stride) {
+    set->Insert<AccessMode::NON_ATOMIC>(offset);
+  }
+  for (auto _ : st) {
+    USE(_);
+    size_t slots = set->Iterate(
+        kNullAddress, 0, SlotSet::kBucketsRegularPage,
+        [](MaybeObjectSlot slot) { return KEEP_SLOT; },
+        SlotSet::KEEP_EMPTY_BUCKETS);
+    benchmark::DoNotOptimize(slots);
+  }
+  SlotSet::Delete(set, SlotSet::kBucketsRegularPage);
+  st.SetItemsProcessed(st.iterations() * (Page::kPageSize / stride));
+}
+BENCHMARK(BM_SlotSetIterate)->Arg(1)->Arg(16);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,74 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "src/base/macros.h"
+#include "src/base/vector.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory.h"
+#include "test/benchmarks/cpp/internals/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarks {
+namespace {
+
+using StringTableLookup = BenchmarkWithIsolate;
+
+std::vector<std::string> MakeNames(int count) {
+  std::vector<std::string> names;
+  names.reserve(count);
+  for (int i = 0; i < count; i++) {
+    names.push_back("benchmark_property_" + std::to_string(i));
+  }
+  return names;
+}
+
+BENCHMARK_DEFINE_F(StringTableLookup, Hit)(benchmark::State& st) {
+  const std::vector<std::string> names =
+      MakeNames(static_cast<int>(st.range(0)));
+  HandleScope scope(isolate());
+  for (const std::string& name : names) {
+    isolate()->factory()->InternalizeUtf8String(base::VectorOf(name));
+  }
+  size_t i = 0;
+  for (auto _ : st) {
+    USE(_);
+    HandleScope inner_scope(isolate());
+    benchmark::DoNotOptimize(
+        isolate()->factory()->InternalizeUtf8String(base::VectorOf(names[i])));
+    if (++i == names.size()) i = 0;
+  }
+  st.SetItemsProcessed(st.iterations());
+}
+BENCHMARK_REGISTER_F(StringTableLookup, Hit)->Arg(1 << 10)->Arg(1 << 16);
+
+BENCHMARK_DEFINE_F(StringTableLookup, Insert)(benchmark::State& st) {
+  const std::vector<std::string> names =
+      MakeNames(static_cast<int>(st.range(0)));
+  for (auto _ : st) {
+    USE(_);
+    {
+      HandleScope scope(isolate());
+      for (const std::string& name : names) {
+        isolate()->factory()->InternalizeUtf8String(base::VectorOf(name));
+      }
+    }
+    // Drop the strings again so the next iteration inserts them afresh.
+    st.PauseTiming();
+    isolate()->heap()->CollectAllAvailableGarbage(
+        GarbageCollectionReason::kTesting);
+    st.ResumeTiming();
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+BENCHMARK_REGISTER_F(StringTableLookup, Insert)->Arg(1 << 10)->Arg(1 << 16);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace internal
+}  // namespace v8
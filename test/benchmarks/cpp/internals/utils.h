@@ -0,0 +1,77 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TEST_BENCHMARK_CPP_INTERNALS_UTILS_H_
+#define TEST_BENCHMARK_CPP_INTERNALS_UTILS_H_
+
+#include <memory>
+
+#include "include/v8.h"
+#include "src/execution/isolate.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarks {
+
+// Gives each benchmark run a fresh, entered isolate. V8 itself is initialized
+// once per process in run-all-benchmarks.cc.
+class BenchmarkWithIsolate : public benchmark::Fixture {
+ protected:
+  void SetUp(const ::benchmark::State& state) override {
+    allocator_.reset(v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = allocator_.get();
+    v8_isolate_ = v8::Isolate::New(create_params);
+    v8_isolate_->Enter();
+  }
+
+  void TearDown(const ::benchmark::State& state) override {
+    v8_isolate_->Exit();
+    v8_isolate_->Dispose();
+    v8_isolate_ = nullptr;
+    allocator_.reset();
+  }
+
+  v8::Isolate* v8_isolate() const { return v8_isolate_; }
+  Isolate* isolate() const { return reinterpret_cast<Isolate*>(v8_isolate_); }
+
+ private:
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_;
+  v8::Isolate* v8_isolate_ = nullptr;
+};
+
+// Like BenchmarkWithIsolate, with a context entered for the whole run.
+class BenchmarkWithContext : public BenchmarkWithIsolate {
+ protected:
+  void SetUp(const ::benchmark::State& state) override {
+    BenchmarkWithIsolate::SetUp(state);
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+    context->Enter();
+    context_.Reset(v8_isolate(), context);
+  }
+
+  void TearDown(const ::benchmark::State& state) override {
+    {
+      v8::HandleScope handle_scope(v8_isolate());
+      context()->Exit();
+    }
+    context_.Reset();
+    BenchmarkWithIsolate::TearDown(state);
+  }
+
+  v8::Local<v8::Context> context() const {
+    return context_.Get(v8_isolate());
+  }
+
+ private:
+  v8::Global<v8::Context> context_;
+};
+
+}  // namespace benchmarks
+}  // namespace internal
+}  // namespace v8
+
+#endif  // TEST_BENCHMARK_CPP_INTERNALS_UTILS_H_
@@ -0,0 +1,51 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/macros.h"
+#include "src/zone/accounting-allocator.h"
+#include "src/zone/zone.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace benchmarks {
+namespace {
+
+struct ZoneTestObject {
+  void* pointers[4];
+};
+
+// Small allocations into one zone that grows over the whole run.
+void BM_ZoneAllocate(benchmark::State& st) {
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  for (auto _ : st) {
+    USE(_);
+    benchmark::DoNotOptimize(zone.New<ZoneTestObject>());
+  }
+  st.SetBytesProcessed(st.iterations() * sizeof(ZoneTestObject));
+}
+BENCHMARK(BM_ZoneAllocate);
+
+// Short-lived zones with a fixed number of allocations each, as used by the
+// parser and the compiler for temporary data. This also exercises segment
+// reuse in the AccountingAllocator.
+void BM_ZoneCreateAndAllocate(benchmark::State& st) {
+  AccountingAllocator allocator;
+  const int allocations = static_cast<int>(st.range(0));
+  for (auto _ : st) {
+    USE(_);
+    Zone zone(&allocator, ZONE_NAME);
+    for (int i = 0; i < allocations; i++) {
+      benchmark::DoNotOptimize(zone.New<ZoneTestObject>());
+    }
+  }
+  st.SetItemsProcessed(st.iterations());
+}
+BENCHMARK(BM_ZoneCreateAndAllocate)->Arg(16)->Arg(4096);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace internal
+}  // namespace v8
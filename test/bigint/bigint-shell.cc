@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <chrono>
 #include <string>
 
 #include "src/bigint/bigint-internal.h"
@@ -19,6 +20,9 @@ int PrintHelp(char** argv) {
             << "    List supported tests.\n"
             << argv[0] << " <testname>\n"
             << "    Run the specified test (see --list for a list).\n"
+            << argv[0] << " --benchmark\n"
+            << "    Print timings of the multiplication and division "
+               "algorithms.\n"
             << "\nOptions when running tests:\n"
             << "--random-seed R\n"
             << "    Initialize the random number generator with this seed.\n"
@@ -27,9 +31,15 @@ int PrintHelp(char** argv) {
   return 1;
 }
 
-#define TESTS(V) V(kKaratsuba, "karatsuba")
+#define TESTS(V)                \
+  V(kKaratsuba, "karatsuba")    \
+  V(kToom, "toom")              \
+  V(kFFT, "fft")                \
+  V(kBarrett, "barrett")        \
+  V(kToString, "tostring")      \
+  V(kFromString, "fromstring")
 
-enum Operation { kNoOp, kList, kTest };
+enum Operation { kNoOp, kList, kTest, kBenchmark };
 
 enum Test {
 #define TEST(kName, name) kName,
@@ -130,7 +140,9 @@ class Runner {
     if (op_ == kList) {
       ListTests();
     } else if (op_ == kTest) {
-      RunTest();
+      return RunTest();
+    } else if (op_ == kBenchmark) {
+      RunBenchmark();
     } else {
       DCHECK(false);  // Unreachable.
     }
@@ -159,6 +171,26 @@ class Runner {
       for (int i = 0; i < runs_; i++) {
         TestKaratsuba(&count);
       }
+    } else if (test_ == kToom) {
+      for (int i = 0; i < runs_; i++) {
+        TestToom(&count);
+      }
+    } else if (test_ == kFFT) {
+      for (int i = 0; i < runs_; i++) {
+        TestFFT(&count);
+      }
+    } else if (test_ == kBarrett) {
+      for (int i = 0; i < runs_; i++) {
+        TestBarrett(&count);
+      }
+    } else if (test_ == kToString) {
+      for (int i = 0; i < runs_; i++) {
+        TestToString(&count);
+      }
+    } else if (test_ == kFromString) {
+      for (int i = 0; i < runs_; i++) {
+        TestFromString(&count);
+      }
     } else {
       DCHECK(false);  // Unreachable.
     }
@@ -190,10 +222,216 @@ class Runner {
     }
   }
 
+  void TestToom(int* count) {
+    // {MultiplyToomCook} requires left_size >= right_size and
+    // right_size >= kToomThreshold. Compare with Karatsuba, which is tested
+    // against the schoolbook algorithm above.
+    for (int right_size = kToomThreshold;
+         right_size <= kToomThreshold + 20; right_size++) {
+      for (int left_size = right_size; left_size <= 3 * kToomThreshold;
+           left_size += 7) {
+        ScratchDigits A(left_size);
+        ScratchDigits B(right_size);
+        int result_len = MultiplyResultLength(A, B);
+        ScratchDigits result(result_len);
+        ScratchDigits result_karatsuba(result_len);
+        GenerateRandom(A);
+        GenerateRandom(B);
+        processor()->MultiplyToomCook(result, A, B);
+        processor()->MultiplyKaratsuba(result_karatsuba, A, B);
+        AssertEquals(A, B, result_karatsuba, result);
+        if (error_) return;
+        (*count)++;
+      }
+    }
+  }
+
+  void TestFFT(int* count) {
+    // {MultiplyFFT} requires left_size >= right_size and
+    // right_size >= kFftThreshold. Compare with Toom-Cook, with random
+    // sizes and a few squarings, which take a different path.
+    for (int i = 0; i < 20; i++) {
+      int right_size = kFftThreshold + RandomInt(kFftThreshold);
+      int left_size = right_size + RandomInt(2 * kFftThreshold);
+      if (i % 5 == 0) left_size = right_size;
+      ScratchDigits A(left_size);
+      ScratchDigits B(right_size);
+      int result_len = MultiplyResultLength(A, B);
+      ScratchDigits result(result_len);
+      ScratchDigits result_toom(result_len);
+      GenerateRandom(A);
+      GenerateRandom(B);
+      Digits Y = i % 5 == 0 ? Digits(A) : Digits(B);
+      processor()->MultiplyFFT(result, A, Y);
+      processor()->MultiplyToomCook(result_toom, A, Y);
+      AssertEquals(A, Y, result_toom, result);
+      if (error_) return;
+      (*count)++;
+    }
+  }
+
+  void TestBarrett(int* count) {
+    // {DivideBarrett} requires A.len >= B.len >= kBarrettThreshold. Compare
+    // quotients and remainders with the schoolbook algorithm.
+    for (int i = 0; i < 20; i++) {
+      int b_len = kBarrettThreshold + RandomInt(kBarrettThreshold);
+      int a_len = b_len + RandomInt(3 * b_len);
+      ScratchDigits A(a_len);
+      ScratchDigits B(b_len);
+      GenerateRandom(A);
+      GenerateRandom(B);
+      // Make some divisors bit-normalized already.
+      if (i % 4 == 0) {
+        B[b_len - 1] = B[b_len - 1] | (digit_t{1} << (kDigitBits - 1));
+      }
+      int q_len = DivideResultLength(A, B);
+      ScratchDigits quotient(q_len);
+      ScratchDigits remainder(b_len);
+      ScratchDigits quotient_schoolbook(q_len);
+      ScratchDigits remainder_schoolbook(b_len);
+      processor()->DivideBarrett(quotient, remainder, A, B);
+      processor()->DivideSchoolbook(quotient_schoolbook, remainder_schoolbook,
+                                    A, B);
+      AssertEquals(A, B, quotient_schoolbook, quotient);
+      AssertEquals(A, B, remainder_schoolbook, remainder);
+      if (error_) return;
+      (*count)++;
+    }
+  }
+
+  void TestToString(int* count) {
+    // Convert to a string, and back with {FromStringClassic} reading one
+    // character per part, which must restore the original value.
+    static const int kSizes[] = {1, 2, 10, kToStringFastThreshold - 1,
+                                 kToStringFastThreshold, 100, 500, 2000,
+                                 4 * kBarrettBalancedThreshold};
+    for (int size : kSizes) {
+      for (int radix : {10, 3, 7, 36, 16}) {
+        ScratchDigits X(size);
+        GenerateRandom(X);
+        bool sign = RandomInt(2) == 1;
+        int chars = ToStringResultLength(X, radix, sign);
+        std::unique_ptr<char[]> string(new char[chars]);
+        processor()->ToString(string.get(), &chars, X, radix, sign);
+        const char* start = string.get();
+        if (sign) {
+          CHECK(*start == '-');
+          start++;
+          chars--;
+        }
+        CHECK(*start != '0');
+        ScratchDigits parts(chars);
+        for (int i = 0; i < chars; i++) {
+          char c = start[chars - 1 - i];
+          parts[i] = c <= '9' ? c - '0' : c - 'a' + 10;
+          CHECK(parts[i] < static_cast<digit_t>(radix));
+        }
+        ScratchDigits result(size + 1);
+        processor()->FromStringClassic(result, parts, radix);
+        AssertEquals(X, X, X, result);
+        if (error_) return;
+        (*count)++;
+      }
+    }
+  }
+
+  void TestFromString(int* count) {
+    // Compare the recursive algorithm with multiply-adding all parts, for
+    // multipliers like the ones that parsers use.
+    for (int i = 0; i < 20; i++) {
+      digit_t multiplier = i % 2 == 0 ? 1000000000 : 3 * 3 * 3 * 3 * 3;
+      int num_parts = RandomInt(20 * kFromStringFastThreshold) + 1;
+      if (i == 0) num_parts = kFromStringFastThreshold;
+      ScratchDigits parts(num_parts);
+      for (int j = 0; j < num_parts; j++) {
+        parts[j] = static_cast<digit_t>(rng_.NextUint64() % multiplier);
+      }
+      int result_len = FromStringPartsResultLength(parts, multiplier);
+      ScratchDigits result(result_len);
+      ScratchDigits result_classic(result_len);
+      processor()->FromStringParts(result, parts, multiplier);
+      processor()->FromStringClassic(result_classic, parts, multiplier);
+      AssertEquals(parts, parts, result_classic, result);
+      if (error_) return;
+      (*count)++;
+    }
+  }
+
+  // Prints the time per operation, in microseconds, for each algorithm at
+  // a range of sizes around its threshold. Used for tuning the constants in
+  // bigint-internal.h.
+  void RunBenchmark() {
+    std::cout << "Multiplication (digits: schoolbook karatsuba toom fft)\n";
+    for (int len : {24, 34, 50, 100, 150, 193, 250, 400, 700, 1000, 1500,
+                    2500, 4000, 6000, 8000, 16000}) {
+      ScratchDigits A(len);
+      ScratchDigits B(len);
+      ScratchDigits result(2 * len);
+      GenerateRandom(A);
+      GenerateRandom(B);
+      std::cout << len;
+      Time([&] { processor()->MultiplySchoolbook(result, A, B); });
+      if (len >= kKaratsubaThreshold) {
+        Time([&] { processor()->MultiplyKaratsuba(result, A, B); });
+      }
+      if (len >= kToomThreshold) {
+        Time([&] { processor()->MultiplyToomCook(result, A, B); });
+      }
+      if (len >= kFftThreshold) {
+        Time([&] { processor()->MultiplyFFT(result, A, B); });
+      }
+      std::cout << "\n";
+    }
+    std::cout << "Division (dividend/divisor digits: schoolbook barrett)\n";
+    for (int b_len : {kBarrettThreshold / 2, kBarrettThreshold,
+                      2 * kBarrettThreshold, 4 * kBarrettThreshold,
+                      2 * kBarrettBalancedThreshold}) {
+      for (int a_len : {b_len + b_len / 4, b_len + b_len / 2, 2 * b_len,
+                        4 * b_len}) {
+        ScratchDigits A(a_len);
+        ScratchDigits B(b_len);
+        GenerateRandom(A);
+        GenerateRandom(B);
+        ScratchDigits quotient(DivideResultLength(A, B));
+        ScratchDigits remainder(b_len);
+        std::cout << a_len << "/" << b_len;
+        Time([&] {
+          processor()->DivideSchoolbook(quotient, remainder, A, B);
+        });
+        if (b_len >= kBarrettThreshold) {
+          Time([&] { processor()->DivideBarrett(quotient, remainder, A, B); });
+        }
+        std::cout << "\n";
+      }
+    }
+    std::cout << "Decimal conversion (digits: tostring fromstring)\n";
+    for (int len : {10, 43, 100, 1000, 10000, 100000}) {
+      ScratchDigits X(len);
+      GenerateRandom(X);
+      int chars = ToStringResultLength(X, 10, false);
+      std::unique_ptr<char[]> string(new char[chars]);
+      std::cout << len;
+      Time([&] {
+        int length = chars;
+        processor()->ToString(string.get(), &length, X, 10, false);
+      });
+      // Parts of 9 characters, like the parser uses.
+      ScratchDigits parts(DIV_CEIL(chars, 9));
+      for (int i = 0; i < parts.len(); i++) {
+        parts[i] = static_cast<digit_t>(rng_.NextUint64() % 1000000000);
+      }
+      ScratchDigits result(FromStringPartsResultLength(parts, 1000000000));
+      Time([&] { processor()->FromStringParts(result, parts, 1000000000); });
+      std::cout << "\n";
+    }
+  }
+
   int ParseOptions(int argc, char** argv) {
     for (int i = 1; i < argc; i++) {
       if (strcmp(argv[i], "--list") == 0) {
         op_ = kList;
+      } else if (strcmp(argv[i], "--benchmark") == 0) {
+        op_ = kBenchmark;
       } else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
         PrintHelp(argv);
         return 0;
@@ -224,6 +462,28 @@ class Runner {
   }
 
  private:
+  // Runs {f} repeatedly for at least 100ms and prints the average time.
+  template <typename F>
+  void Time(F f) {
+    using Clock = std::chrono::steady_clock;
+    int iterations = 0;
+    Clock::time_point start = Clock::now();
+    Clock::duration elapsed;
+    do {
+      f();
+      iterations++;
+      elapsed = Clock::now() - start;
+    } while (elapsed < std::chrono::milliseconds(100));
+    double us =
+        std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+    std::cout << " " << us;
+  }
+
+  // Returns a random integer in [0, max).
+  int RandomInt(int max) {
+    return static_cast<int>(rng_.NextUint64() % static_cast<uint64_t>(max));
+  }
+
   void GenerateRandom(RWDigits Z) {
     if (Z.len() == 0) return;
     if (sizeof(digit_t) == 8) {
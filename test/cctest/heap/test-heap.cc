@@ -1158,6 +1158,58 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestBytecodeFlushingOnMemoryPressure) {
+#ifndef V8_LITE_MODE
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+#if ENABLE_SPARKPLUG
+  FLAG_always_sparkplug = false;
+#endif  // ENABLE_SPARKPLUG
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_flush_bytecode_on_memory_pressure = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    {
+      v8::HandleScope scope(isolate);
+      CompileRun("function foo() { return 42; }; foo()");
+    }
+
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+    Handle<JSFunction> function = Handle<JSFunction>::cast(
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked());
+    CHECK(function->shared().is_compiled());
+    CHECK(!function->shared().has_flushed_bytecode());
+
+    // Without memory pressure, two full GCs do not make the bytecode old
+    // enough to be flushed.
+    for (int i = 0; i < 2; i++) CcTest::CollectAllGarbage();
+    CHECK(function->shared().is_compiled());
+    CHECK(!function->shared().has_flushed_bytecode());
+
+    // The same number of memory-reducing GCs meets the lower age threshold.
+    CompileRun("foo()");
+    for (int i = 0; i < 2; i++) {
+      i_isolate->heap()->CollectAllGarbage(Heap::kReduceMemoryFootprintMask,
+                                           GarbageCollectionReason::kTesting);
+    }
+    CHECK(!function->shared().is_compiled());
+    CHECK(function->shared().has_flushed_bytecode());
+
+    CompileRun("foo()");
+    CHECK(function->shared().is_compiled());
+  }
+}
+
 HEAP_TEST(Regress10560) {
   i::FLAG_flush_bytecode = true;
   i::FLAG_allow_natives_syntax = true;
@@ -7376,6 +7428,35 @@ TEST(LongTaskStatsYoung) {
       v8::metrics::LongTaskStats::Get(isolate).gc_young_wall_clock_duration_us);
 }
 
+TEST(ExpectedIdleWindowAndLatencyCriticalWork) {
+  if (!FLAG_use_idle_notification) return;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Heap* heap = CcTest::heap();
+  double now_in_seconds =
+      V8::GetCurrentPlatform()->MonotonicallyIncreasingTime();
+
+  CHECK_EQ(0.0, heap->RemainingIdleWindowInMs());
+  isolate->NotifyExpectedIdleWindow(now_in_seconds + 60);
+  CHECK_LT(0.0, heap->RemainingIdleWindowInMs());
+
+  // Latency-critical work ends the idle window and nests.
+  isolate->NotifyLatencyCriticalWorkStarted();
+  isolate->NotifyLatencyCriticalWorkStarted();
+  CHECK_EQ(0.0, heap->RemainingIdleWindowInMs());
+  CHECK(heap->IsLatencyCriticalWorkInProgress());
+  isolate->NotifyExpectedIdleWindow(now_in_seconds + 60);
+  CHECK_EQ(0.0, heap->RemainingIdleWindowInMs());
+  isolate->NotifyLatencyCriticalWorkFinished();
+  CHECK(heap->IsLatencyCriticalWorkInProgress());
+  isolate->NotifyLatencyCriticalWorkFinished();
+  CHECK(!heap->IsLatencyCriticalWorkInProgress());
+
+  // A window in the past is ignored.
+  isolate->NotifyExpectedIdleWindow(now_in_seconds - 1);
+  CHECK_EQ(0.0, heap->RemainingIdleWindowInMs());
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -128,6 +128,45 @@ UNINITIALIZED_TEST(PagePromotion_NewToNew) {
   isolate->Dispose();
 }
 
+#ifdef ENABLE_MINOR_MC
+UNINITIALIZED_TEST(PagePromotion_MinorMCHighSurvivalNewToOld) {
+  if (i::FLAG_single_generation) return;
+  if (!i::FLAG_page_promotion) return;
+  FLAG_minor_mc = true;
+  // Any recorded survival counts as high survival.
+  FLAG_minor_mc_high_survival_threshold = 1;
+  ManualGCScope manual_gc_scope;
+
+  v8::Isolate* isolate = NewIsolateForPagePromotion();
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    Heap* heap = i_isolate->heap();
+
+    // Record a young generation cycle in which everything survives.
+    std::vector<Handle<FixedArray>> warmup_handles;
+    heap::SimulateFullSpace(heap->new_space(), &warmup_handles);
+    heap->CollectGarbage(NEW_SPACE, i::GarbageCollectionReason::kTesting);
+    CHECK(heap->tracer()->SurvivalEventsRecorded());
+
+    std::vector<Handle<FixedArray>> handles;
+    heap::SimulateFullSpace(heap->new_space(), &handles);
+    CHECK_GT(handles.size(), 0u);
+    Page* const to_be_promoted_page = FindLastPageInNewSpace(handles);
+    CHECK_NOT_NULL(to_be_promoted_page);
+    CHECK(heap->new_space()->ContainsSlow(to_be_promoted_page->address()));
+    heap->CollectGarbage(NEW_SPACE, i::GarbageCollectionReason::kTesting);
+    // The page is promoted to old space directly instead of being moved
+    // within new space.
+    CHECK(!heap->new_space()->ContainsSlow(to_be_promoted_page->address()));
+    CHECK(heap->old_space()->ContainsSlow(to_be_promoted_page->address()));
+  }
+  isolate->Dispose();
+}
+#endif  // ENABLE_MINOR_MC
+
 UNINITIALIZED_HEAP_TEST(Regress658718) {
   if (!i::FLAG_page_promotion || FLAG_always_promote_young_mc) return;
 
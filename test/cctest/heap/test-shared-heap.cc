@@ -5,6 +5,7 @@
 #include "include/v8.h"
 #include "src/common/globals.h"
 #include "src/handles/handles-inl.h"
+#include "src/heap/basic-memory-chunk.h"
 #include "src/heap/heap.h"
 #include "src/objects/heap-object.h"
 #include "test/cctest/cctest.h"
@@ -155,5 +156,46 @@ UNINITIALIZED_TEST(SharedCollection) {
   Isolate::Delete(shared_isolate);
 }
 
+UNINITIALIZED_TEST(SharedStringTable) {
+  FLAG_shared_string_table = true;
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = allocator.get();
+  Isolate* shared_isolate = Isolate::NewShared(create_params);
+
+  SetupClientIsolateAndRunCallback(
+      shared_isolate, [shared_isolate](v8::Isolate* client_isolate1,
+                                       Isolate* i_client_isolate1) {
+        HandleScope scope1(i_client_isolate1);
+        Handle<String> string1 =
+            i_client_isolate1->factory()->InternalizeUtf8String(
+                "sharedStringTableTestIdentifier");
+        CHECK(BasicMemoryChunk::FromHeapObject(*string1)->InSharedHeap());
+
+        SetupClientIsolateAndRunCallback(
+            shared_isolate, [string1](v8::Isolate* client_isolate2,
+                                      Isolate* i_client_isolate2) {
+              HandleScope scope2(i_client_isolate2);
+              Handle<String> string2 =
+                  i_client_isolate2->factory()->InternalizeUtf8String(
+                      "sharedStringTableTestIdentifier");
+              CHECK_EQ(string1->ptr(), string2->ptr());
+
+              // Strings of the client heap forward to the shared string.
+              Handle<String> flat =
+                  i_client_isolate2->factory()->NewStringFromAsciiChecked(
+                      "sharedStringTableTestIdentifier", AllocationType::kOld);
+              CHECK_EQ(string2->ptr(),
+                       i_client_isolate2->factory()->InternalizeString(flat)
+                           ->ptr());
+              CHECK(flat->IsThinString());
+            });
+      });
+
+  Isolate::Delete(shared_isolate);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -1,10 +1,12 @@
 // Copyright 2016 the V8 project authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
+#include <algorithm>
 #include <limits>
 
 #include "include/libplatform/v8-tracing.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
 #include "src/libplatform/default-platform.h"
 #include "src/tracing/trace-event.h"
 #include "test/cctest/cctest.h"
@@ -140,6 +142,128 @@ TEST(TestTraceBufferRingBuffer) {
   }
   delete ring_buffer;
 }
+
+namespace {
+
+class TraceBufferThread : public base::Thread {
+ public:
+  TraceBufferThread(TraceBuffer* buffer, const char* name, int count)
+      : Thread(Options("TraceBufferThread")),
+        buffer_(buffer),
+        name_(name),
+        count_(count) {}
+
+  void Run() override {
+    uint8_t category_enabled_flag = 41;
+    for (int i = 0; i < count_; ++i) {
+      uint64_t handle;
+      TraceObject* trace_object = buffer_->AddTraceEvent(&handle);
+      CHECK_NOT_NULL(trace_object);
+      trace_object->Initialize('X', &category_enabled_flag, name_,
+                               "Test.Scope", i, 0, 0, nullptr, nullptr,
+                               nullptr, nullptr, 0, 1729, 4104);
+      CHECK_EQ(trace_object, buffer_->GetEventByHandle(handle));
+    }
+  }
+
+ private:
+  TraceBuffer* buffer_;
+  const char* name_;
+  int count_;
+};
+
+}  // namespace
+
+TEST(TestTraceBufferRingBufferThreads) {
+  // Threads add their events to chunks of their own; all of them are kept
+  // while the ring has room.
+  const int kEventsPerThread = TraceBufferChunk::kChunkSize * 10 + 7;
+  const char* kNames[] = {"Test.Thread0", "Test.Thread1", "Test.Thread2",
+                          "Test.Thread3"};
+  MockTraceWriter* writer = new MockTraceWriter();
+  TraceBuffer* ring_buffer = TraceBuffer::CreateTraceBufferRingBuffer(
+      TraceBuffer::kRingBufferChunks, writer);
+  std::vector<std::unique_ptr<TraceBufferThread>> threads;
+  for (const char* name : kNames) {
+    threads.push_back(std::make_unique<TraceBufferThread>(ring_buffer, name,
+                                                          kEventsPerThread));
+    CHECK(threads.back()->Start());
+  }
+  for (auto& thread : threads) thread->Join();
+
+  ring_buffer->Flush();
+  auto events = writer->events();
+  CHECK_EQ(arraysize(kNames) * kEventsPerThread, events.size());
+  for (const char* name : kNames) {
+    CHECK_EQ(kEventsPerThread,
+             static_cast<int>(std::count(events.begin(), events.end(),
+                                         std::string(name))));
+  }
+  delete ring_buffer;
+}
+
+namespace {
+
+class EvictedChunkThread : public base::Thread {
+ public:
+  EvictedChunkThread(TraceBuffer* buffer, base::Semaphore* added,
+                     base::Semaphore* evicted)
+      : Thread(Options("EvictedChunkThread")),
+        buffer_(buffer),
+        added_(added),
+        evicted_(evicted) {}
+
+  void Run() override {
+    uint8_t category_enabled_flag = 41;
+    uint64_t handle;
+    buffer_->AddTraceEvent(&handle)->Initialize(
+        'X', &category_enabled_flag, "Test.Evicted", "Test.Scope", 1, 0, 0,
+        nullptr, nullptr, nullptr, nullptr, 0, 1729, 4104);
+    added_->Signal();
+    evicted_->Wait();
+    // The ring has wrapped around the chunk of this thread.
+    buffer_->AddTraceEvent(&handle)->Initialize(
+        'X', &category_enabled_flag, "Test.Evicted", "Test.Scope", 2, 0, 0,
+        nullptr, nullptr, nullptr, nullptr, 0, 1729, 4104);
+  }
+
+ private:
+  TraceBuffer* buffer_;
+  base::Semaphore* added_;
+  base::Semaphore* evicted_;
+};
+
+}  // namespace
+
+TEST(TestTraceBufferRingBufferEvictedChunk) {
+  // A chunk that the ring wraps around while its thread still adds events to
+  // it is flushed too.
+  const size_t kMaxChunks = 16;
+  MockTraceWriter* writer = new MockTraceWriter();
+  TraceBuffer* ring_buffer =
+      TraceBuffer::CreateTraceBufferRingBuffer(kMaxChunks, writer);
+  base::Semaphore added(0), evicted(0);
+  EvictedChunkThread thread(ring_buffer, &added, &evicted);
+  CHECK(thread.Start());
+  added.Wait();
+  uint8_t category_enabled_flag = 41;
+  const size_t kEvents = kMaxChunks * TraceBufferChunk::kChunkSize;
+  for (size_t i = 0; i < kEvents; ++i) {
+    uint64_t handle;
+    ring_buffer->AddTraceEvent(&handle)->Initialize(
+        'X', &category_enabled_flag, "Test.Main", "Test.Scope", i, 0, 0,
+        nullptr, nullptr, nullptr, nullptr, 0, 1729, 4104);
+  }
+  evicted.Signal();
+  thread.Join();
+
+  ring_buffer->Flush();
+  auto events = writer->events();
+  CHECK_EQ(kEvents + 2, events.size());
+  CHECK_EQ(2, std::count(events.begin(), events.end(),
+                         std::string("Test.Evicted")));
+  delete ring_buffer;
+}
 #endif  // !defined(V8_USE_PERFETTO)
 
 // Perfetto has an internal JSON exporter.
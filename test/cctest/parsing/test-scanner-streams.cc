@@ -409,6 +409,41 @@ TEST(Utf8SingleByteChunks) {
   }
 }
 
+TEST(Utf8SeekOverAsciiRuns) {
+  // Seeking in a chunk with non-ascii characters decodes it from the chunk
+  // start; check positions within and after long ascii runs.
+  std::string utf8;
+  std::vector<uint16_t> ucs2;
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 100 * i; j++) {
+      utf8 += static_cast<char>('a' + j % 26);
+      ucs2.push_back('a' + j % 26);
+    }
+    utf8 += unicode_utf8;
+    for (size_t j = 0; unicode_ucs2[j]; j++) ucs2.push_back(unicode_ucs2[j]);
+  }
+  const char* chunks[] = {utf8.c_str(), ""};
+
+  for (size_t pos = 0; pos < ucs2.size(); pos++) {
+    // Positions between surrogates can't be sought to.
+    if (unibrow::Utf16::IsTrailSurrogate(ucs2[pos])) continue;
+    ChunkSource chunk_source(chunks);
+    std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+        v8::internal::ScannerStream::For(
+            &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+    // Read the whole stream first, so the seek has to search backwards.
+    while (stream->Advance() !=
+           v8::internal::Utf16CharacterStream::kEndOfInput) {
+    }
+    stream->Seek(pos);
+    for (size_t i = pos; i < ucs2.size(); i++) {
+      CHECK_EQ(ucs2[i], stream->Advance());
+    }
+    CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput,
+             stream->Advance());
+  }
+}
+
 #define CHECK_EQU(v1, v2) CHECK_EQ(static_cast<int>(v1), static_cast<int>(v2))
 
 void TestCharacterStream(const char* reference, i::Utf16CharacterStream* stream,
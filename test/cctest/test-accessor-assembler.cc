@@ -4,6 +4,7 @@
 
 #include "test/cctest/cctest.h"
 
+#include "include/v8-metrics.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/ic/accessor-assembler.h"
 #include "src/ic/stub-cache.h"
@@ -26,18 +27,20 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
   const int kNumParams = 2;
   CodeAssemblerTester data(isolate, kNumParams + 1);  // Include receiver.
   AccessorAssembler m(data.state());
+  StubCache* stub_cache = isolate->load_stub_cache();
 
   {
     auto name = m.Parameter<Name>(1);
     auto map = m.Parameter<Map>(2);
     TNode<IntPtrT> primary_offset =
-        m.StubCachePrimaryOffsetForTesting(name, map);
+        m.StubCachePrimaryOffsetForTesting(stub_cache, name, map);
     TNode<IntPtrT> result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
     } else {
       CHECK_EQ(StubCache::kSecondary, table);
-      result = m.StubCacheSecondaryOffsetForTesting(name, primary_offset);
+      result = m.StubCacheSecondaryOffsetForTesting(stub_cache, name,
+                                                    primary_offset);
     }
     m.Return(m.SmiTag(result));
   }
@@ -79,12 +82,12 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 
       int expected_result;
       {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
+        int primary_offset = stub_cache->PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
         } else {
           expected_result =
-              StubCache::SecondaryOffsetForTesting(*name, primary_offset);
+              stub_cache->SecondaryOffsetForTesting(*name, primary_offset);
         }
       }
       Handle<Object> result = ft.Call(name, map).ToHandleChecked();
@@ -258,5 +261,78 @@ TEST(TryProbeStubCache) {
   CHECK(queried_existing && queried_non_existing);
 }
 
+TEST(StubCacheGrowth) {
+  FLAG_lazy_feedback_allocation = false;
+  FLAG_stub_cache_growth = true;
+  FLAG_stub_cache_growth_threshold = 1;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+  StubCache* stub_cache = isolate->load_stub_cache();
+
+  // Start from a cleared cache with no misses.
+  CcTest::CollectAllGarbage();
+  CHECK(!stub_cache->has_grown());
+
+  // Objects with 3000 different maps overflow the initial 2048 + 512 entries.
+  // The maps form a tree of 50 * 60 transitions, so that no map has too many
+  // transitions to stay fast.
+  const int kCount = 3000;
+  CompileRun(
+      "var objects = [];"
+      "for (var i = 0; i < 3000; i++) {"
+      "  var o = {};"
+      "  o['a' + (i % 50)] = i;"
+      "  o['b' + Math.floor(i / 50)] = i;"
+      "  o.x = i;"
+      "  objects.push(o);"
+      "}"
+      "function load(o) { return o.x; }"
+      "function sum() {"
+      "  var result = 0;"
+      "  for (var i = 0; i < objects.length; i++) result += load(objects[i]);"
+      "  return result;"
+      "}");
+  const int64_t kExpectedSum = int64_t{kCount} * (kCount - 1) / 2;
+  CHECK_EQ(kExpectedSum, CompileRun("sum()")->IntegerValue(
+                             CcTest::isolate()->GetCurrentContext())
+                             .FromJust());
+  CHECK_LT(kCount / 2, stub_cache->miss_count());
+
+  // The next full GC grows the tables.
+  CcTest::CollectAllGarbage();
+  CHECK(stub_cache->has_grown());
+  CHECK_EQ(StubCache::kPrimaryTableSize << StubCache::kGrowthBits,
+           stub_cache->primary_table_size());
+  CHECK_EQ(StubCache::kSecondaryTableSize << StubCache::kGrowthBits,
+           stub_cache->secondary_table_size());
+
+  // Generated code uses the new tables: after one round of misses that fill
+  // them, most lookups hit.
+  for (int round = 0; round < 2; round++) {
+    int64_t misses_before = stub_cache->miss_count();
+    CHECK_EQ(kExpectedSum, CompileRun("sum()")->IntegerValue(
+                               CcTest::isolate()->GetCurrentContext())
+                               .FromJust());
+    if (round == 1) {
+      CHECK_GT(kCount / 2, stub_cache->miss_count() - misses_before);
+    }
+  }
+
+  v8::metrics::MegamorphicCacheStats stats =
+      v8::metrics::MegamorphicCacheStats::Get(CcTest::isolate());
+  CHECK_EQ(stub_cache->miss_count() + isolate->store_stub_cache()->miss_count(),
+           stats.misses);
+  CHECK_EQ(
+      (StubCache::kPrimaryTableSize + StubCache::kSecondaryTableSize)
+          << StubCache::kGrowthBits,
+      stats.load_cache_size);
+
+  // The tables only grow once.
+  CcTest::CollectAllGarbage();
+  CHECK_EQ(StubCache::kPrimaryTableSize << StubCache::kGrowthBits,
+           stub_cache->primary_table_size());
+}
+
 }  // namespace internal
 }  // namespace v8
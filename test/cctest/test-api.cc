@@ -605,6 +605,50 @@ THREADED_TEST(ScriptUsingOneByteStringResource) {
 }
 
 
+THREADED_TEST(NewExternalFromUtf8) {
+  int dispose_count = 0;
+  {
+    LocalContext env;
+    v8::HandleScope scope(env->GetIsolate());
+    // ASCII data is used without copying.
+    const char* ascii = "ascii only, long enough for a few words of data";
+    TestOneByteResource* resource =
+        new TestOneByteResource(i::StrDup(ascii), &dispose_count);
+    Local<String> string =
+        String::NewExternalFromUtf8(env->GetIsolate(), resource)
+            .ToLocalChecked();
+    CHECK(string->IsExternalOneByte());
+    CHECK_EQ(static_cast<const String::ExternalStringResourceBase*>(resource),
+             string->GetExternalOneByteStringResource());
+    CHECK(string->StrictEquals(v8_str(ascii)));
+    CcTest::CollectAllGarbage();
+    CHECK_EQ(0, dispose_count);
+
+    // Other data is transcoded, and the resource disposed right away.
+    const char* utf8 = "ascii, then \xC3\xA4 and \xE2\x82\xAC";
+    Local<String> transcoded =
+        String::NewExternalFromUtf8(
+            env->GetIsolate(),
+            new TestOneByteResource(i::StrDup(utf8), &dispose_count))
+            .ToLocalChecked();
+    CHECK_EQ(1, dispose_count);
+    CHECK(!transcoded->IsExternal());
+    CHECK(transcoded->StrictEquals(
+        String::NewFromUtf8(env->GetIsolate(), utf8).ToLocalChecked()));
+
+    Local<String> empty =
+        String::NewExternalFromUtf8(
+            env->GetIsolate(),
+            new TestOneByteResource(i::StrDup(""), &dispose_count))
+            .ToLocalChecked();
+    CHECK_EQ(2, dispose_count);
+    CHECK_EQ(0, empty->Length());
+  }
+  CcTest::CollectAllAvailableGarbage();
+  CHECK_EQ(3, dispose_count);
+}
+
+
 THREADED_TEST(ScriptMakingExternalString) {
   int dispose_count = 0;
   uint16_t* two_byte_source = AsciiToTwoByteString("1 + 2 * 3");
@@ -5079,6 +5123,30 @@ THREADED_TEST(Array) {
 }
 
 
+// Large backing stores are allocated outside the young generation, where
+// filling them needs write barriers.
+THREADED_TEST(ArrayNewWithManyElements) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+  constexpr int kLength = 100000;
+  std::vector<Local<Value>> elements;
+  elements.reserve(kLength);
+  for (int i = 0; i < kLength; i++) {
+    Local<v8::Object> object = v8::Object::New(isolate);
+    CHECK(object->Set(context.local(), v8_str("i"), v8_num(i)).FromJust());
+    elements.push_back(object);
+  }
+  Local<v8::Array> array =
+      v8::Array::New(isolate, elements.data(), elements.size());
+  CHECK_EQ(static_cast<uint32_t>(kLength), array->Length());
+  elements.clear();
+  CcTest::CollectAllGarbage();
+  CHECK(context->Global()->Set(context.local(), v8_str("a"), array).FromJust());
+  ExpectInt32("a.findIndex((o, i) => o.i !== i)", -1);
+}
+
+
 void HandleF(const v8::FunctionCallbackInfo<v8::Value>& args) {
   v8::EscapableHandleScope scope(args.GetIsolate());
   ApiTestFuzzer::Fuzz();
@@ -7200,6 +7268,45 @@ THREADED_TEST(GlobalObjectTemplate) {
 }
 
 
+static void ManyPropertiesGetter(
+    Local<String> name, const v8::PropertyCallbackInfo<v8::Value>& info) {
+  ApiTestFuzzer::Fuzz();
+  info.GetReturnValue().Set(v8_num(42));
+}
+
+
+// Templates with more properties than fit in a descriptor array are
+// instantiated directly in dictionary mode.
+THREADED_TEST(ObjectTemplateWithManyProperties) {
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope handle_scope(isolate);
+  constexpr int kNumProperties = 2000;
+  Local<ObjectTemplate> templ = ObjectTemplate::New(isolate);
+  for (int i = 0; i < kNumProperties; i++) {
+    v8::base::ScopedVector<char> name(32);
+    i::SNPrintF(name, "data%d", i);
+    templ->Set(isolate, name.begin(), v8_num(i));
+    i::SNPrintF(name, "accessor%d", i);
+    templ->SetAccessor(v8_str(name.begin()), ManyPropertiesGetter);
+  }
+  for (int run = 0; run < 2; run++) {
+    v8::Local<Context> context = Context::New(isolate, nullptr, templ);
+    Context::Scope context_scope(context);
+    ExpectInt32("data0 + data1999", 1999);
+    ExpectInt32("accessor0 + accessor1999", 84);
+    ExpectInt32(
+        "var o = {}; for (var name in this) {"
+        "  if (name.startsWith('data')) o[name] = 1;"
+        "} Object.keys(o).length",
+        kNumProperties);
+    Local<Object> instance = templ->NewInstance(context).ToLocalChecked();
+    CHECK(!v8::Utils::OpenHandle(*instance)->HasFastProperties());
+    context->Global()->Set(context, v8_str("instance"), instance).FromJust();
+    ExpectInt32("instance.data1234 + instance.accessor1234", 1234 + 42);
+  }
+}
+
+
 static const char* kSimpleExtensionSource =
     "function Foo() {"
     "  return 4;"
@@ -21231,6 +21338,112 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+class CollectingJSONSink : public v8::JSON::OutputSink {
+ public:
+  explicit CollectingJSONSink(v8::Isolate* isolate) : isolate_(isolate) {}
+
+  void WriteChunk(Local<String> chunk) override {
+    CHECK_GT(chunk->Length(), 0);
+    v8::String::Utf8Value utf8(isolate_, chunk);
+    output_ += *utf8;
+    chunks_++;
+  }
+
+  const std::string& output() const { return output_; }
+  int chunks() const { return chunks_; }
+
+ private:
+  v8::Isolate* isolate_;
+  std::string output_;
+  int chunks_ = 0;
+};
+}  // namespace
+
+THREADED_TEST(JSONStringifyToSink) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  Local<Value> value = CompileRun(
+      "var big = [];"
+      "for (var i = 0; i < 20000; i++) big.push({index: i, name: 'n' + i});"
+      "big");
+  CollectingJSONSink sink(isolate);
+  CHECK(v8::JSON::Stringify(context.local(), value, &sink).FromJust());
+  CHECK_GT(sink.chunks(), 1);
+  Local<String> expected = CompileRun("JSON.stringify(big)").As<String>();
+  v8::String::Utf8Value utf8(isolate, expected);
+  CHECK_EQ(0, strcmp(*utf8, sink.output().c_str()));
+
+  CollectingJSONSink gap_sink(isolate);
+  CHECK(v8::JSON::Stringify(context.local(), CompileRun("({x: [1]})"),
+                            &gap_sink, v8_str("  "))
+            .FromJust());
+  CHECK_EQ(0, strcmp("{\n  \"x\": [\n    1\n  ]\n}",
+                     gap_sink.output().c_str()));
+
+  CollectingJSONSink undefined_sink(isolate);
+  CHECK(!v8::JSON::Stringify(context.local(), v8::Undefined(isolate),
+                             &undefined_sink)
+             .FromJust());
+  CHECK_EQ(0, undefined_sink.chunks());
+
+  v8::TryCatch try_catch(isolate);
+  CollectingJSONSink throwing_sink(isolate);
+  CHECK(v8::JSON::Stringify(context.local(),
+                            CompileRun("var c = {}; c.c = c; c"),
+                            &throwing_sink)
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+}
+
+namespace {
+class ChunkedJSONSource : public v8::JSON::InputSource {
+ public:
+  explicit ChunkedJSONSource(std::vector<const char*> chunks)
+      : chunks_(std::move(chunks)) {}
+
+  Local<String> ReadChunk() override {
+    if (next_ == chunks_.size()) return Local<String>();
+    return v8_str(chunks_[next_++]);
+  }
+
+ private:
+  std::vector<const char*> chunks_;
+  size_t next_ = 0;
+};
+}  // namespace
+
+THREADED_TEST(JSONParseFromChunks) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+
+  // Chunk boundaries may fall in the middle of tokens.
+  ChunkedJSONSource source(
+      {"{\"a\": [1", "0, 2", "0], \"b\"", ": \"x", "yz\"}"});
+  Local<Value> result =
+      v8::JSON::Parse(context.local(), &source).ToLocalChecked();
+  context->Global()->Set(context.local(), v8_str("parsed"), result).FromJust();
+  ExpectString("JSON.stringify(parsed)", "{\"a\":[10,20],\"b\":\"xyz\"}");
+
+  // A two-byte chunk after one-byte chunks.
+  ChunkedJSONSource two_byte_source({"[\"ab", "\xE2\x82\xAC", "cd\"]"});
+  result = v8::JSON::Parse(context.local(), &two_byte_source).ToLocalChecked();
+  context->Global()->Set(context.local(), v8_str("parsed"), result).FromJust();
+  ExpectString("parsed[0]", "ab\xE2\x82\xAC" "cd");
+
+  v8::TryCatch try_catch(isolate);
+  ChunkedJSONSource empty_source(std::vector<const char*>{});
+  CHECK(v8::JSON::Parse(context.local(), &empty_source).IsEmpty());
+  CHECK(try_catch.HasCaught());
+  try_catch.Reset();
+
+  ChunkedJSONSource invalid_source({"[1, ", "2,", "]"});
+  CHECK(v8::JSON::Parse(context.local(), &invalid_source).IsEmpty());
+  CHECK(try_catch.HasCaught());
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -28734,7 +28947,7 @@ TEST(FastApiCalls) {
 #ifndef V8_LITE_MODE
 namespace {
 void FastCallback1TypedArray(v8::Local<v8::Object> receiver, int arg0,
-                             v8::FastApiTypedArray<double> arg1) {
+                             const v8::FastApiTypedArray<double>& arg1) {
   // TODO(mslekova): Use the TypedArray parameter
 }
 
@@ -28835,6 +29048,66 @@ TEST(FastApiOverloadResolution) {
 #endif  // V8_LITE_MODE
 }
 
+#ifndef V8_LITE_MODE
+namespace {
+int fast_accessor_calls = 0;
+int slow_accessor_calls = 0;
+
+int32_t FastAccessorGetter(v8::Local<v8::Object> receiver) {
+  fast_accessor_calls++;
+  return 42;
+}
+
+void SlowAccessorGetter(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  slow_accessor_calls++;
+  info.GetReturnValue().Set(42);
+}
+}  // namespace
+#endif  // V8_LITE_MODE
+
+TEST(FastApiAccessorGetter) {
+#ifndef V8_LITE_MODE
+  if (i::FLAG_jitless) return;
+
+  v8::internal::FLAG_opt = true;
+  v8::internal::FLAG_turbo_fast_api_calls = true;
+  v8::internal::FLAG_allow_natives_syntax = true;
+  // Disable --always_opt, otherwise we haven't generated the necessary
+  // feedback to go down the "best optimization" path for the fast call.
+  v8::internal::FLAG_always_opt = false;
+  v8::internal::FlagList::EnforceFlagImplications();
+
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  LocalContext env;
+
+  v8::CFunction c_getter = v8::CFunction::Make(FastAccessorGetter);
+  Local<v8::FunctionTemplate> getter = v8::FunctionTemplate::New(
+      isolate, SlowAccessorGetter, Local<Value>(), Local<v8::Signature>(), 0,
+      v8::ConstructorBehavior::kThrow, v8::SideEffectType::kHasSideEffect,
+      &c_getter);
+  Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
+  templ->SetAccessorProperty(v8_str("value"), getter);
+  Local<v8::Object> receiver =
+      templ->NewInstance(env.local()).ToLocalChecked();
+  CHECK(env->Global()
+            ->Set(env.local(), v8_str("receiver"), receiver)
+            .FromJust());
+
+  fast_accessor_calls = 0;
+  slow_accessor_calls = 0;
+  CompileRun(
+      "function load() { return receiver.value; }"
+      "%PrepareFunctionForOptimization(load);"
+      "load(); load();"
+      "%OptimizeFunctionOnNextCall(load);");
+  CHECK_EQ(2, slow_accessor_calls);
+  ExpectInt32("load()", 42);
+  CHECK_EQ(1, fast_accessor_calls);
+  CHECK_EQ(2, slow_accessor_calls);
+#endif  // V8_LITE_MODE
+}
+
 THREADED_TEST(Recorder_GetContext) {
   using v8::Context;
   using v8::Local;
@@ -29024,6 +29297,130 @@ TEST(TriggerThreadSafeMetricsEvent) {
   CHECK_EQ(recorder->module_count_, 42);
 }
 
+namespace {
+
+class DeoptimizationMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  std::vector<v8::metrics::JSDeoptimization> events_;
+
+  void AddMainThreadEvent(const v8::metrics::JSDeoptimization& event,
+                          v8::metrics::Recorder::ContextId id) override {
+    events_.push_back(event);
+  }
+};
+
+}  // namespace
+
+TEST(TriggerDeoptimizationMetricsEvent) {
+  if (!i::FLAG_opt || i::FLAG_always_opt) return;
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::Isolate* iso = env->GetIsolate();
+  v8::HandleScope scope(iso);
+  std::shared_ptr<DeoptimizationMetricsRecorder> recorder =
+      std::make_shared<DeoptimizationMetricsRecorder>();
+  iso->SetMetricsRecorder(recorder);
+
+  v8::Local<v8::Script> script = v8_compile(
+      "function f(o) { return o.x; };"
+      "%PrepareFunctionForOptimization(f);"
+      "f({x: 1}); f({x: 2});"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f({x: 3});");
+  script->Run(env.local()).ToLocalChecked();
+  CHECK(recorder->events_.empty());
+
+  // Passing an object with a different map fails the map check in f.
+  CompileRun("f({y: 1, x: 4});");
+  CHECK_EQ(1, recorder->events_.size());
+  const v8::metrics::JSDeoptimization& event = recorder->events_[0];
+  CHECK_EQ(0, strcmp("wrong map", event.reason));
+  CHECK_EQ(script->GetUnboundScript()->GetId(), event.script_id);
+  CHECK_LE(0, event.bytecode_offset);
+  CHECK_LE(0, event.source_position);
+  CHECK(!event.lazy);
+}
+
+namespace {
+
+class CliffMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  std::vector<v8::metrics::JSMegamorphicTransitions> transitions_;
+  std::vector<v8::metrics::JSDeoptimizationCounts> deoptimizations_;
+
+  void AddMainThreadEvent(const v8::metrics::JSMegamorphicTransitions& event,
+                          v8::metrics::Recorder::ContextId id) override {
+    CHECK(id.IsEmpty());
+    transitions_.push_back(event);
+  }
+  void AddMainThreadEvent(const v8::metrics::JSDeoptimizationCounts& event,
+                          v8::metrics::Recorder::ContextId id) override {
+    CHECK(id.IsEmpty());
+    deoptimizations_.push_back(event);
+  }
+};
+
+}  // namespace
+
+TEST(CliffMetricsEvents) {
+  i::FLAG_allow_natives_syntax = true;
+  // Report only when asked to.
+  i::FLAG_cliff_metrics_batch_size = 1000;
+  i::FLAG_cliff_metrics_batch_interval = 1000000;
+  LocalContext env;
+  v8::Isolate* iso = env->GetIsolate();
+  i::Isolate* i_iso = reinterpret_cast<i::Isolate*>(iso);
+  v8::HandleScope scope(iso);
+  std::shared_ptr<CliffMetricsRecorder> recorder =
+      std::make_shared<CliffMetricsRecorder>();
+  iso->SetMetricsRecorder(recorder);
+
+  CompileRun(
+      "function load(o) { return o.prop; };"
+      "%EnsureFeedbackVectorForFunction(load);"
+      "for (let i = 0; i < 2; i++) {"
+      "  load({prop: 0, a: 1}); load({prop: 0, b: 1}); load({prop: 0, c: 1});"
+      "  load({prop: 0, d: 1}); load({prop: 0, e: 1}); load({prop: 0, f: 1});"
+      "}");
+  i_iso->metrics_recorder()->ReportCliffsForTesting();
+  CHECK_EQ(1, recorder->transitions_.size());
+  CHECK(recorder->deoptimizations_.empty());
+  const v8::metrics::JSMegamorphicTransitions& transitions =
+      recorder->transitions_[0];
+  CHECK_EQ(1, transitions.transitions.size());
+  CHECK_EQ(0, strcmp("LoadIC", transitions.transitions[0].ic_type));
+  CHECK_EQ("prop", transitions.transitions[0].property_name);
+  CHECK_EQ(i::FLAG_max_valid_polymorphic_map_count,
+           transitions.transitions[0].map_count);
+  CHECK_EQ(1, transitions.transitions[0].count);
+  CHECK_EQ(0, transitions.dropped_count);
+
+  // Nothing is reported without new events.
+  i_iso->metrics_recorder()->ReportCliffsForTesting();
+  CHECK_EQ(1, recorder->transitions_.size());
+
+  if (!i::FLAG_opt || i::FLAG_always_opt) return;
+  CompileRun(
+      "function f(o) { return o.x; };"
+      "%PrepareFunctionForOptimization(f);"
+      "f({x: 1}); f({x: 2});"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f({x: 3});"
+      "f({y: 1, x: 4});");
+  i_iso->metrics_recorder()->ReportCliffsForTesting();
+  CHECK_EQ(1, recorder->deoptimizations_.size());
+  const v8::metrics::JSDeoptimizationCounts& deoptimizations =
+      recorder->deoptimizations_[0];
+  CHECK_EQ(1, deoptimizations.deoptimizations.size());
+  const v8::metrics::JSDeoptimizationCount& deoptimization =
+      deoptimizations.deoptimizations[0];
+  CHECK_EQ(0, strcmp("wrong map", deoptimization.reason));
+  CHECK_EQ("f", deoptimization.function_name);
+  CHECK_LE(0, deoptimization.function_position);
+  CHECK_EQ(1, deoptimization.eager_count);
+  CHECK_EQ(0, deoptimization.lazy_count);
+}
+
 void SetupCodeLike(LocalContext* env, const char* name,
                    v8::Local<v8::FunctionTemplate> to_string,
                    bool is_code_like) {
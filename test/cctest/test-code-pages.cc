@@ -326,6 +326,43 @@ TEST(LargeCodeObject) {
   CHECK(!PagesHasExactPage(pages, stale_code_address));
 }
 
+TEST(CodePagesVersion) {
+  // We don't want incremental marking to start which could cause the code to
+  // not be collected on the CollectGarbage() call.
+  ManualGCScope manual_gc_scope;
+
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+
+  size_t version = isolate->GetCodePagesVersion();
+  CHECK_EQ(version, isolate->GetCodePagesVersion());
+  if (!kHaveCodePages) return;
+
+  // Allocating and freeing a large code object changes the code pages, and
+  // thereby their version.
+  const int instruction_size = Page::kPageSize + 1;
+  std::unique_ptr<byte[]> instructions(new byte[instruction_size]);
+  CodeDesc desc;
+  desc.buffer = instructions.get();
+  desc.buffer_size = instruction_size;
+  desc.instr_size = instruction_size;
+  desc.reloc_size = 0;
+  desc.constant_pool_size = 0;
+  desc.unwinding_info = nullptr;
+  desc.unwinding_info_size = 0;
+  desc.origin = nullptr;
+  {
+    HandleScope scope(i_isolate);
+    Factory::CodeBuilder(i_isolate, desc, CodeKind::WASM_FUNCTION).Build();
+  }
+  size_t version_with_code = isolate->GetCodePagesVersion();
+  CHECK_NE(version, version_with_code);
+
+  CcTest::CollectGarbage(CODE_LO_SPACE);
+  CHECK_NE(version_with_code, isolate->GetCodePagesVersion());
+}
+
 static constexpr size_t kBufSize = v8::Isolate::kMinCodePagesBufferSize;
 
 class SignalSender : public sampler::Sampler {
@@ -2,12 +2,15 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <string>
+
 #include "src/api/api.h"
 #include "src/base/platform/semaphore.h"
 #include "src/handles/handles-inl.h"
 #include "src/handles/local-handles-inl.h"
 #include "src/handles/persistent-handles.h"
 #include "src/heap/heap.h"
+#include "src/heap/local-factory-inl.h"
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/local-heap.h"
 #include "src/heap/parked-scope.h"
@@ -422,6 +425,81 @@ TEST(InspectTwoByteExternalizing_ThinString) {
   thread->Join();
 }
 
+constexpr int kInternalizedStrings = 10000;
+
+std::string InternalizedStringContent(int i) {
+  return "concurrently_internalized_" + std::to_string(i);
+}
+
+class ConcurrentInternalizeThread final : public v8::base::Thread {
+ public:
+  explicit ConcurrentInternalizeThread(Isolate* isolate)
+      : v8::base::Thread(base::Thread::Options("ThreadWithLocalHeap")),
+        isolate_(isolate) {}
+
+  void Run() override {
+    LocalIsolate local_isolate(isolate_, ThreadKind::kBackground);
+    UnparkedScope unparked_scope(local_isolate.heap());
+
+    for (int i = 0; i < kInternalizedStrings; i++) {
+      LocalHandleScope handle_scope(&local_isolate);
+      std::string content = InternalizedStringContent(i);
+      Handle<String> string = local_isolate.factory()->InternalizeString(
+          base::OneByteVector(content.c_str(), content.size()));
+      CHECK(string->IsInternalizedString());
+      results_.push_back(local_isolate.heap()->NewPersistentHandle(string));
+    }
+    ph_ = local_isolate.heap()->DetachPersistentHandles();
+  }
+
+  Handle<String> result(int i) const { return results_[i]; }
+
+ private:
+  Isolate* isolate_;
+  std::vector<Handle<String>> results_;
+  std::unique_ptr<PersistentHandles> ph_;
+};
+
+// Several threads internalize the same new strings at once, which grows the
+// string table while other threads insert into it. Each content must still
+// map to a single internalized string.
+UNINITIALIZED_TEST(ConcurrentInternalization) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+
+  {
+    std::vector<std::unique_ptr<ConcurrentInternalizeThread>> threads;
+    const int kThreads = 4;
+
+    {
+      ParkedScope scope(i_isolate->main_thread_local_isolate());
+
+      for (int i = 0; i < kThreads; i++) {
+        auto thread = std::make_unique<ConcurrentInternalizeThread>(i_isolate);
+        CHECK(thread->Start());
+        threads.push_back(std::move(thread));
+      }
+
+      for (auto& thread : threads) {
+        thread->Join();
+      }
+    }
+
+    HandleScope handle_scope(i_isolate);
+    for (int i = 0; i < kInternalizedStrings; i++) {
+      Handle<String> expected = i_isolate->factory()->InternalizeUtf8String(
+          base::VectorOf(InternalizedStringContent(i)));
+      for (auto& thread : threads) {
+        CHECK_EQ(*expected, *thread->result(i));
+      }
+    }
+  }
+
+  isolate->Dispose();
+}
+
 }  // anonymous namespace
 
 }  // namespace internal
@@ -819,6 +819,39 @@ TEST(StoreOwnIC) {
   CHECK_EQ(MONOMORPHIC, nexus.ic_state());
 }
 
+TEST(FeedbackAllocationRememberedPerSharedFunctionInfo) {
+  if (!i::FLAG_lazy_feedback_allocation) return;
+  if (i::FLAG_always_opt) return;
+  FLAG_lazy_feedback_allocation_per_sfi = true;
+
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  // Every binding of a script gets its own feedback cell, so the second
+  // closure does not see the vector allocated for the first one.
+  v8::Local<v8::Script> script =
+      v8::Script::Compile(context.local(),
+                          v8_str("for (var i = 0; i < 100000; i++) {}"))
+          .ToLocalChecked();
+  Handle<JSFunction> first =
+      Handle<JSFunction>::cast(v8::Utils::OpenHandle(*script));
+  CHECK(!first->has_feedback_vector());
+  CHECK(!first->shared().has_allocated_feedback_vector());
+
+  script->Run(context.local()).ToLocalChecked();
+  CHECK(first->has_feedback_vector());
+  CHECK(first->shared().has_allocated_feedback_vector());
+
+  v8::Local<v8::Script> rebound =
+      script->GetUnboundScript()->BindToCurrentContext();
+  Handle<JSFunction> second =
+      Handle<JSFunction>::cast(v8::Utils::OpenHandle(*rebound));
+  CHECK_NE(first->raw_feedback_cell(), second->raw_feedback_cell());
+  CHECK(second->has_feedback_vector());
+}
+
 }  // namespace
 
 }  // namespace internal
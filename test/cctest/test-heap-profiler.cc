@@ -414,6 +414,16 @@ TEST(HeapSnapshotEntryChildren) {
     const v8::HeapGraphEdge* prop = a->GetChild(i);
     CHECK_EQ(a, prop->GetFromNode());
   }
+  // The children of every node are the edges that start from it.
+  int edges_count = 0;
+  for (int i = 0, count = snapshot->GetNodesCount(); i < count; ++i) {
+    const v8::HeapGraphNode* node = snapshot->GetNode(i);
+    for (int j = 0, children = node->GetChildrenCount(); j < children; ++j) {
+      CHECK_EQ(node, node->GetChild(j)->GetFromNode());
+      edges_count++;
+    }
+  }
+  CHECK_LT(0, edges_count);
 }
 
 
@@ -3886,6 +3896,33 @@ TEST(SamplingHeapProfilerApiSamples) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(SamplingHeapProfilerSurvivedGCs) {
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  v8::internal::FLAG_sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(64);
+
+  CompileRun(
+      "var retained = [];\n"
+      "for (var i = 0; i < 1024; ++i) retained.push({i});\n");
+
+  CcTest::CollectAllGarbage();
+  CcTest::CollectAllGarbage();
+
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  CHECK(!profile->GetSamples().empty());
+  for (auto& sample : profile->GetSamples()) {
+    CHECK_LE(2, sample.survived_gcs);
+  }
+
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(SamplingHeapProfilerLeftTrimming) {
   v8::HandleScope scope(CcTest::isolate());
   LocalContext env;
@@ -629,6 +629,53 @@ TEST(LockerUnlocker) {
   isolate->Dispose();
 }
 
+class IsolateMigratingThread : public JoinableThread {
+ public:
+  IsolateMigratingThread(const std::vector<v8::Isolate*>& isolates, int offset)
+      : JoinableThread("IsolateMigratingThread"),
+        isolates_(isolates),
+        offset_(offset) {}
+
+  void Run() override {
+    const size_t count = isolates_.size();
+    for (int round = 0; round < 3; round++) {
+      for (size_t i = 0; i < count; i++) {
+        v8::Isolate* isolate = isolates_[(i + offset_) % count];
+        v8::Locker lock(isolate);
+        v8::Isolate::Scope isolate_scope(isolate);
+        v8::HandleScope handle_scope(isolate);
+        LocalContext local_context(isolate);
+        CalcFibAndCheck(local_context.local());
+      }
+    }
+  }
+
+ private:
+  const std::vector<v8::Isolate*>& isolates_;
+  const int offset_;
+};
+
+// Multiplex several isolates onto a few threads, so that every isolate keeps
+// moving between threads with top-level Lockers.
+TEST(IsolatesMigratingBetweenThreads) {
+  i::FLAG_always_opt = false;
+  const int kNThreads = 4;
+  const int kNIsolates = 8;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  std::vector<v8::Isolate*> isolates;
+  for (int i = 0; i < kNIsolates; i++) {
+    isolates.push_back(v8::Isolate::New(create_params));
+  }
+  std::vector<JoinableThread*> threads;
+  threads.reserve(kNThreads);
+  for (int i = 0; i < kNThreads; i++) {
+    threads.push_back(new IsolateMigratingThread(isolates, i));
+  }
+  StartJoinAndDeleteThreads(threads);
+  for (v8::Isolate* isolate : isolates) isolate->Dispose();
+}
+
 class LockTwiceAndUnlockThread : public JoinableThread {
  public:
   explicit LockTwiceAndUnlockThread(v8::Isolate* isolate)
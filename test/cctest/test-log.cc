@@ -29,6 +29,11 @@
 
 #include <unordered_set>
 #include <vector>
+
+#if V8_OS_LINUX
+#include <unistd.h>
+#endif  // V8_OS_LINUX
+
 #include "src/api/api-inl.h"
 #include "src/builtins/builtins.h"
 #include "src/codegen/compilation-cache.h"
@@ -1088,6 +1093,79 @@ UNINITIALIZED_TEST(ConsoleTimeEvents) {
   isolate->Dispose();
 }
 
+UNINITIALIZED_TEST(LogAsyncWrite) {
+  SETUP_FLAGS();
+  i::FLAG_log_async_write = true;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    ScopedLoggerInitializer logger(isolate);
+    // Log more than what fits into a single buffer of the writer.
+    const char* source_text =
+        "for (let i = 0; i < 5000; i++) {"
+        "  console.timeStamp('asyncTimer' + i);"
+        "}";
+    CompileRun(source_text);
+
+    logger.StopLogging();
+
+    std::vector<std::vector<std::string>> lines;
+    for (int i = 0; i < 5000; i += 1000) {
+      lines.push_back({"timer-event,asyncTimer" + std::to_string(i) + ","});
+    }
+    lines.push_back({"timer-event,asyncTimer4999,"});
+    CHECK(logger.ContainsLinesInOrder(lines));
+  }
+  isolate->Dispose();
+}
+
+#if V8_OS_LINUX
+UNINITIALIZED_TEST(PerfJitAsyncWriteWhenIdle) {
+  // Records collected after the last hand-over to the writer thread reach the
+  // perf file while the isolate is still alive, even if no more code is
+  // created.
+  i::FLAG_perf_prof = true;
+  i::FLAG_perf_prof_async_write = true;
+  i::FLAG_perf_prof_delete_file = false;
+  i::FLAG_regexp_tier_up = false;
+  EmbeddedVector<char, 64> file_name;
+  i::SNPrintF(file_name, "./jit-%d.dump", v8::base::OS::GetCurrentProcessId());
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    // The first regexp hands the records collected so far over, the second
+    // one is only collected.
+    CompileRun(
+        "/warmUp(x)/.exec('warmUpx');"
+        "/perfJitIdleRecord(a|b)*c/.exec('perfJitIdleRecordabc');");
+
+    bool found = false;
+    for (int attempt = 0; attempt < 100 && !found; attempt++) {
+      v8::base::OS::Sleep(v8::base::TimeDelta::FromMilliseconds(50));
+      FILE* file = fopen(file_name.begin(), "rb");
+      CHECK_NOT_NULL(file);
+      std::string contents;
+      char chunk[4096];
+      size_t read;
+      while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        contents.append(chunk, read);
+      }
+      fclose(file);
+      found = contents.find("perfJitIdleRecord") != std::string::npos;
+    }
+    CHECK(found);
+  }
+  isolate->Dispose();
+  unlink(file_name.begin());
+}
+#endif  // V8_OS_LINUX
+
 UNINITIALIZED_TEST(LogFunctionEvents) {
   // Always opt and stress opt will break the fine-grained log order.
   if (i::FLAG_always_opt) return;
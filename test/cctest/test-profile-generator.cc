@@ -29,6 +29,7 @@
 
 #include "include/v8-profiler.h"
 #include "src/api/api-inl.h"
+#include "src/base/platform/wrappers.h"
 #include "src/init/v8.h"
 #include "src/logging/log.h"
 #include "src/objects/objects-inl.h"
@@ -370,6 +371,41 @@ TEST(CodeMapClear) {
   code_map.Clear();
 }
 
+TEST(StackAggregationTable) {
+  CodeEntryStorage storage;
+  CodeEntry entry1(i::CodeEventListener::FUNCTION_TAG, "aaa");
+  CodeEntry entry2(i::CodeEventListener::FUNCTION_TAG, "bbb");
+  CodeEntry entry3(i::CodeEventListener::FUNCTION_TAG, "ccc");
+  StackAggregationTable table(&storage, 2);
+  const base::TimeDelta interval = base::TimeDelta::FromMicroseconds(100);
+
+  ProfileStackTrace path1 = {{&entry2, 0}, {&entry1, 0}};
+  ProfileStackTrace path2 = {{&entry2, 5}, {&entry1, 0}};
+  ProfileStackTrace path3 = {{&entry3, 0}, {&entry1, 0}};
+  CHECK(table.AddStack(path1, interval));
+  CHECK(table.AddStack(path1, interval));
+  CHECK_EQ(1, table.size());
+  // Stacks that differ only in the line number are aggregated separately.
+  CHECK(table.AddStack(path2, interval));
+  CHECK_EQ(2, table.size());
+  // The table is full, so new stacks are dropped, but known ones are not.
+  CHECK(!table.AddStack(path3, interval));
+  CHECK(table.AddStack(path2, interval));
+  CHECK_EQ(2, table.size());
+  CHECK_EQ(1, table.dropped_samples());
+
+  FILE* file = base::OS::OpenTemporaryFile();
+  CHECK_NOT_NULL(file);
+  table.WritePprof(file, interval);
+  CHECK_LT(0, ftell(file));
+  base::Fclose(file);
+
+  table.Clear();
+  CHECK_EQ(0, table.size());
+  CHECK(table.AddStack(path3, interval));
+  CHECK_EQ(1, table.size());
+}
+
 namespace {
 
 class TestSetup {
@@ -1015,6 +1051,51 @@ TEST(CodeMapMoveOverlappingCode) {
   CHECK_EQ(after_entry->instruction_start(), ToAddress(0x1800));
 }
 
+TEST(CodeMapFindCodeAcrossRegions) {
+  CodeEntryStorage storage;
+  CodeMap code_map(storage);
+  CodeEntry* before = storage.Create(i::CodeEventListener::FUNCTION_TAG, "aaa");
+  CodeEntry* spanning =
+      storage.Create(i::CodeEventListener::FUNCTION_TAG, "bbb");
+  CodeEntry* large = storage.Create(i::CodeEventListener::FUNCTION_TAG, "ccc");
+  CodeEntry* after = storage.Create(i::CodeEventListener::FUNCTION_TAG, "ddd");
+
+  // Code that starts shortly before a 256 KB boundary and ends after it, and
+  // code that is larger than a few such regions.
+  code_map.AddCode(ToAddress(0x3FF00), before, 0x80);
+  code_map.AddCode(ToAddress(0x3FF80), spanning, 0x200);
+  code_map.AddCode(ToAddress(0x100000), large, 0x200000);
+  code_map.AddCode(ToAddress(0x300000), after, 0x100);
+  CHECK_EQ(4, code_map.size());
+
+  CHECK_EQ(before, code_map.FindEntry(ToAddress(0x3FF7F)));
+  CHECK_EQ(spanning, code_map.FindEntry(ToAddress(0x3FF80)));
+  CHECK_EQ(spanning, code_map.FindEntry(ToAddress(0x40000)));
+  CHECK_EQ(spanning, code_map.FindEntry(ToAddress(0x4017F)));
+  CHECK(!code_map.FindEntry(ToAddress(0x40180)));
+  CHECK(!code_map.FindEntry(ToAddress(0xFFFFF)));
+  i::Address start = 0;
+  CHECK_EQ(large, code_map.FindEntry(ToAddress(0x2FFFFF), &start));
+  CHECK_EQ(ToAddress(0x100000), start);
+  CHECK_EQ(after, code_map.FindEntry(ToAddress(0x300000)));
+
+  // Move code across regions and out of the large code.
+  code_map.MoveCode(ToAddress(0x3FF80), ToAddress(0x500000));
+  code_map.MoveCode(ToAddress(0x100000), ToAddress(0x600000));
+  CHECK(!code_map.FindEntry(ToAddress(0x40000)));
+  CHECK(!code_map.FindEntry(ToAddress(0x200000)));
+  CHECK_EQ(spanning, code_map.FindEntry(ToAddress(0x500100)));
+  CHECK_EQ(large, code_map.FindEntry(ToAddress(0x7FFFFF)));
+  CHECK_EQ(4, code_map.size());
+
+  code_map.ClearCodesInRange(ToAddress(0x3FF40), ToAddress(0x500001));
+  CHECK(!code_map.FindEntry(ToAddress(0x3FF00)));
+  CHECK(!code_map.FindEntry(ToAddress(0x300000)));
+  CHECK(!code_map.FindEntry(ToAddress(0x500000)));
+  CHECK_EQ(large, code_map.FindEntry(ToAddress(0x600000)));
+  CHECK_EQ(1, code_map.size());
+}
+
 }  // namespace test_profile_generator
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,80 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string.h>
+
+#include "src/base/vector.h"
+#include "src/numbers/double.h"
+#include "src/numbers/ryu-dtoa.h"
+#include "test/cctest/cctest.h"
+#include "test/cctest/gay-shortest.h"
+
+namespace v8 {
+namespace internal {
+namespace test_ryu_dtoa {
+
+static const int kBufferSize = 100;
+
+static void CheckRyu(double v, const char* expected, int expected_point) {
+  char buffer_container[kBufferSize];
+  base::Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  RyuDtoa(v, buffer, &length, &point);
+  CHECK_EQ(0, strcmp(expected, buffer.begin()));
+  CHECK_EQ(static_cast<int>(strlen(expected)), length);
+  CHECK_EQ(expected_point, point);
+}
+
+TEST(RyuDtoaVariousDoubles) {
+  CheckRyu(1.0, "1", 1);
+  CheckRyu(1.5, "15", 1);
+  CheckRyu(0.1, "1", 0);
+  CheckRyu(0.3, "3", 0);
+  CheckRyu(123.456, "123456", 3);
+  CheckRyu(1e21, "1", 22);
+  CheckRyu(1e23, "1", 24);
+  CheckRyu(5e-324, "5", -323);
+  CheckRyu(1.7976931348623157e308, "17976931348623157", 309);
+  CheckRyu(4294967272.0, "4294967272", 10);
+  CheckRyu(4.1855804968213567e298, "4185580496821357", 299);
+  CheckRyu(5.5626846462680035e-309, "5562684646268003", -308);
+  CheckRyu(2147483648.0, "2147483648", 10);
+  // FastDtoa cannot compute these.
+  CheckRyu(3.5844466002796428e+298, "35844466002796428", 299);
+  CheckRyu(Double(uint64_t{0x0010'0000'0000'0000}).value(),
+           "22250738585072014", -307);
+  CheckRyu(Double(uint64_t{0x000F'FFFF'FFFF'FFFF}).value(),
+           "2225073858507201", -307);
+  // Powers of two, whose lower boundary is closer.
+  CheckRyu(9007199254740992.0, "9007199254740992", 16);
+  CheckRyu(Double(uint64_t{0x7220'0000'0000'0000}).value(),
+           "5334411546303884", 242);
+  CheckRyu(Double(uint64_t{0x0660'0000'0000'0000}).value(),
+           "5641232424577593", -277);
+}
+
+TEST(RyuDtoaGayShortest) {
+  char buffer_container[kBufferSize];
+  base::Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  bool needed_max_length = false;
+
+  base::Vector<const PrecomputedShortest> precomputed =
+      PrecomputedShortestRepresentations();
+  for (int i = 0; i < precomputed.length(); ++i) {
+    const PrecomputedShortest current_test = precomputed[i];
+    RyuDtoa(current_test.v, buffer, &length, &point);
+    CHECK_GE(kRyuDtoaMaximalLength, length);
+    if (length == kRyuDtoaMaximalLength) needed_max_length = true;
+    CHECK_EQ(current_test.decimal_point, point);
+    CHECK_EQ(0, strcmp(current_test.representation, buffer.begin()));
+  }
+  CHECK(needed_max_length);
+}
+
+}  // namespace test_ryu_dtoa
+}  // namespace internal
+}  // namespace v8
@@ -43,6 +43,8 @@
 #include "src/init/v8.h"
 #include "src/interpreter/interpreter.h"
 #include "src/numbers/hash-seed-inl.h"
+#include "src/objects/allocation-site-inl.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-array-inl.h"
 #include "src/objects/js-regexp-inl.h"
@@ -2494,6 +2496,140 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_opt = prev_always_opt_value;
 }
 
+TEST(CodeSerializerPreparseData) {
+  // Lazy functions that were never compiled keep their preparse data in the
+  // code cache, so compiling them later does not preparse inner functions
+  // again.
+  if (!FLAG_lazy) return;
+  const char* source =
+      "function f() {"
+      "  var x = 'abc';"
+      "  function g() { return x; }"
+      "  return g;"
+      "}"
+      "'abc' + 'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile(i_isolate2);
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK(!cache->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+
+    Handle<JSFunction> f = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+        *context->Global()->Get(context, v8_str("f")).ToLocalChecked()));
+    CHECK(!f->shared().is_compiled());
+    CHECK(f->shared().HasUncompiledDataWithPreparseData());
+
+    v8::Local<v8::Value> result = CompileRun("f()() + 'def'");
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+}
+
+namespace {
+
+AllocationSite GetFirstLiteralSite(v8::Local<v8::Function> function) {
+  FeedbackVector vector =
+      Handle<JSFunction>::cast(v8::Utils::OpenHandle(*function))
+          ->feedback_vector();
+  FeedbackMetadataIterator iter(vector.metadata());
+  while (iter.HasNext()) {
+    FeedbackSlot slot = iter.Next();
+    if (iter.kind() != FeedbackSlotKind::kLiteral) continue;
+    HeapObject literal_site;
+    if (vector.Get(slot).GetHeapObjectIfStrong(&literal_site) &&
+        literal_site.IsAllocationSite()) {
+      return AllocationSite::cast(literal_site);
+    }
+  }
+  UNREACHABLE();
+}
+
+}  // namespace
+
+TEST(CodeSerializerPretenuringFeedback) {
+  if (!FLAG_allocation_site_pretenuring) return;
+  FLAG_serialize_pretenuring_feedback = true;
+  FLAG_lazy_feedback_allocation = false;
+  FLAG_always_opt = false;
+  const char* source = "return [[1, 2], [3]];";
+
+  v8::ScriptCompiler::CachedData* cache;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source_code(v8_str(source));
+    v8::Local<v8::Function> f =
+        v8::ScriptCompiler::CompileFunctionInContext(context, &source_code, 0,
+                                                     nullptr, 0, nullptr)
+            .ToLocalChecked();
+    f->Call(context, v8::Undefined(isolate1), 0, nullptr).ToLocalChecked();
+    f->Call(context, v8::Undefined(isolate1), 0, nullptr).ToLocalChecked();
+
+    // Pretend the heap has learned that the literal of f() is long-lived.
+    AllocationSite site = GetFirstLiteralSite(f);
+    CHECK_NE(AllocationType::kOld, site.GetAllocationType());
+    site.set_pretenure_decision(AllocationSite::kTenure);
+    cache = ScriptCompiler::CreateCodeCacheForFunction(f);
+    // The live function is left alone.
+    CHECK(!Handle<JSFunction>::cast(v8::Utils::OpenHandle(*f))
+               ->shared()
+               .pretenure_literal_allocation_sites());
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source_code(v8_str(source), cache);
+    v8::Local<v8::Function> f =
+        v8::ScriptCompiler::CompileFunctionInContext(
+            context, &source_code, 0, nullptr, 0, nullptr,
+            v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    f->Call(context, v8::Undefined(isolate2), 0, nullptr).ToLocalChecked();
+    f->Call(context, v8::Undefined(isolate2), 0, nullptr).ToLocalChecked();
+
+    // The new literal site starts out tenured without any feedback.
+    AllocationSite site = GetFirstLiteralSite(f);
+    CHECK_EQ(AllocationType::kOld, site.GetAllocationType());
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
@@ -2550,6 +2686,48 @@ TEST(CodeSerializerBitFlip) {
   isolate2->Dispose();
 }
 
+TEST(CodeSerializerWithoutChecksumVerification) {
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
+
+  // Turning off checksum verification does not change the flag hash, so the
+  // cache produced with verification is still accepted.
+  FLAG_verify_snapshot_checksum = false;
+  FlagList::EnforceFlagImplications();
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK(!cache->rejected);
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+
+  FLAG_verify_snapshot_checksum = true;
+  FlagList::EnforceFlagImplications();
+}
+
 TEST(CodeSerializerWithHarmonyScoping) {
   const char* source1 = "'use strict'; let x = 'X'";
   const char* source2 = "'use strict'; let y = 'Y'";
@@ -3057,6 +3235,114 @@ UNINITIALIZED_TEST(SnapshotCreatorArrayJoinWithKeep) {
   FreeCurrentEmbeddedBlob();
 }
 
+v8::StartupData CreateCustomSnapshotWithFeedback() {
+  v8::SnapshotCreator creator;
+  v8::Isolate* isolate = creator.GetIsolate();
+  {
+    v8::HandleScope handle_scope(isolate);
+    {
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CompileRun(
+          "function g(o) { return o.x; }\n"
+          "for (let i = 0; i < 10; i++) g({x: i});\n");
+      ExpectInt32("g({x: 42})", 42);
+      creator.SetDefaultContext(context);
+    }
+  }
+  return creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kKeep);
+}
+
+UNINITIALIZED_TEST(SnapshotCreatorKeepFeedback) {
+  DisableAlwaysOpt();
+  DisableEmbeddedBlobRefcounting();
+  FLAG_lazy_feedback_allocation = false;
+  FLAG_snapshot_keep_feedback = true;
+  v8::StartupData blob = CreateCustomSnapshotWithFeedback();
+
+  {
+    v8::Isolate::CreateParams params;
+    params.snapshot_blob = &blob;
+    params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    // Test-appropriate equivalent of v8::Isolate::New.
+    v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      Handle<JSFunction> g = Handle<JSFunction>::cast(
+          v8::Utils::OpenHandle(*CompileRun("g")));
+      CHECK(g->has_feedback_vector());
+      CHECK(!g->feedback_vector().has_optimized_code());
+      ExpectInt32("g({x: 7})", 7);
+      ExpectInt32("g({y: 1, x: 8})", 8);
+    }
+    isolate->Dispose();
+  }
+  FLAG_snapshot_keep_feedback = false;
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
+v8::StartupData CreateCustomSnapshotWithLiteralFeedback() {
+  v8::SnapshotCreator creator;
+  v8::Isolate* isolate = creator.GetIsolate();
+  {
+    v8::HandleScope handle_scope(isolate);
+    {
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CompileRun(
+          "function f() { return [1, 2, 3]; }\n"
+          "for (let i = 0; i < 3; i++) f();\n");
+      creator.SetDefaultContext(context);
+    }
+  }
+  return creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kKeep);
+}
+
+UNINITIALIZED_TEST(SnapshotCreatorKeepFeedbackLinksAllocationSites) {
+  DisableAlwaysOpt();
+  DisableEmbeddedBlobRefcounting();
+  FLAG_lazy_feedback_allocation = false;
+  FLAG_snapshot_keep_feedback = true;
+  v8::StartupData blob = CreateCustomSnapshotWithLiteralFeedback();
+
+  {
+    v8::Isolate::CreateParams params;
+    params.snapshot_blob = &blob;
+    params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    // Test-appropriate equivalent of v8::Isolate::New.
+    v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      v8::Local<v8::Function> f = CompileRun("f").As<v8::Function>();
+      CHECK(Handle<JSFunction>::cast(v8::Utils::OpenHandle(*f))
+                ->has_feedback_vector());
+      AllocationSite site = GetFirstLiteralSite(f);
+
+      // The deserialized site must be on the heap's allocation site list.
+      Heap* heap = reinterpret_cast<Isolate*>(isolate)->heap();
+      bool found = false;
+      for (Object current = heap->allocation_sites_list();
+           current.IsAllocationSite();
+           current = AllocationSite::cast(current).weak_next()) {
+        if (current == site) found = true;
+      }
+      CHECK(found);
+      ExpectInt32("f().length", 3);
+    }
+    isolate->Dispose();
+  }
+  FLAG_snapshot_keep_feedback = false;
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
 v8::StartupData CreateCustomSnapshotWithDuplicateFunctions() {
   v8::SnapshotCreator creator;
   v8::Isolate* isolate = creator.GetIsolate();
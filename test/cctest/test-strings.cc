@@ -32,13 +32,20 @@
 
 #include <stdlib.h>
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "src/api/api-inl.h"
 #include "src/base/platform/elapsed-timer.h"
 #include "src/execution/messages.h"
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"
 #include "src/init/v8.h"
+#include "src/numbers/hash-seed-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/strings/string-builder-inl.h"
+#include "src/strings/string-hasher-inl.h"
 #include "src/strings/unicode-decoder.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
@@ -1279,6 +1286,78 @@ TEST(JSONStringifyWellFormed) {
   }
 }
 
+TEST(JSONStringifyConsStringWithoutFlattening) {
+  CcTest::InitializeVM();
+  v8::HandleScope handle_scope(CcTest::isolate());
+  v8::Local<v8::Context> context = CcTest::isolate()->GetCurrentContext();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+
+  std::string piece(1000, 'x');
+  piece[0] = '"';
+  Handle<String> first = factory->NewStringFromAsciiChecked(piece.c_str());
+  Handle<String> second = factory->NewStringFromAsciiChecked(piece.c_str());
+  Handle<String> cons =
+      factory->NewConsString(first, second).ToHandleChecked();
+  CHECK(cons->IsConsString());
+
+  // Flattening is counted per GC cycle.
+  CcTest::CollectGarbage(i::NEW_SPACE);
+  v8::Local<v8::String> json =
+      v8::JSON::Stringify(context, v8::Utils::ToLocal(cons)).ToLocalChecked();
+  CHECK_EQ(2 * piece.length() + 4, json->Length());
+  CHECK(!cons->IsFlat());
+  CcTest::CollectGarbage(i::NEW_SPACE);
+  CHECK_EQ(size_t{0}, isolate->heap()->flattened_string_bytes());
+
+  String::Flatten(isolate, cons);
+  CHECK(cons->IsFlat());
+  CcTest::CollectGarbage(i::NEW_SPACE);
+  CHECK_EQ(2 * piece.length(), isolate->heap()->flattened_string_bytes());
+}
+
+TEST(IncrementalStringBuilderFlat) {
+  CcTest::InitializeVM();
+  v8::HandleScope handle_scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+
+  Handle<String> piece =
+      factory->NewStringFromAsciiChecked("a piece longer than sixteen chars");
+  const uc16 two_byte_chars[] = {0x1234, ' ', 't', 'w', 'o'};
+  Handle<String> two_byte_piece =
+      factory
+          ->NewStringFromTwoByte(base::Vector<const uc16>(
+              two_byte_chars, arraysize(two_byte_chars)))
+          .ToHandleChecked();
+  for (int expected_length : {0, 100, 10000}) {
+    // The result stays flat when growing beyond the expected length, and
+    // when it becomes two-byte.
+    IncrementalStringBuilder builder(isolate, expected_length);
+    std::string expected;
+    for (int i = 0; i < 200; i++) {
+      builder.AppendString(piece);
+      builder.AppendCharacter('x');
+      expected += piece->ToCString().get();
+      expected += 'x';
+    }
+    Handle<String> result = builder.Finish().ToHandleChecked();
+    CHECK(result->IsSeqOneByteString());
+    CHECK(result->IsEqualTo(base::CStrVector(expected.c_str())));
+
+    IncrementalStringBuilder two_byte_builder(isolate, expected_length);
+    two_byte_builder.AppendString(piece);
+    two_byte_builder.AppendString(two_byte_piece);
+    two_byte_builder.AppendString(piece);
+    result = two_byte_builder.Finish().ToHandleChecked();
+    CHECK(result->IsSeqTwoByteString());
+    CHECK_EQ(2 * piece->length() + two_byte_piece->length(),
+             result->length());
+    CHECK_EQ(0x1234, result->Get(piece->length()));
+    CHECK_EQ('a', result->Get(piece->length() + two_byte_piece->length()));
+  }
+}
+
 TEST(CachedHashOverflow) {
   CcTest::InitializeVM();
   // We incorrectly allowed strings to be tagged as array indices even if their
@@ -1885,6 +1964,60 @@ TEST(HashArrayIndexStrings) {
   }
 }
 
+TEST(HashLongStrings) {
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(CcTest::isolate());
+  i::Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  const uint64_t seed = HashSeed(isolate);
+
+  // Around the threshold for block-wise hashing, and with all possible
+  // numbers of trailing characters after the last full block.
+  for (int length = StringHasher::kMinBlockHashLength - 3; length < 200;
+       length++) {
+    std::vector<uint8_t> one_byte(length);
+    std::vector<uint16_t> two_byte(length);
+    for (int i = 0; i < length; i++) {
+      one_byte[i] = static_cast<uint8_t>('0' + (i * 7) % 75);
+      two_byte[i] = one_byte[i];
+    }
+    uint32_t hash = StringHasher::HashSequentialString(one_byte.data(),
+                                                       length, seed);
+    CHECK_NE(0, hash & String::kIsNotIntegerIndexMask);
+    // Equal strings have equal hashes, independent of the representation.
+    CHECK_EQ(hash, StringHasher::HashSequentialString(two_byte.data(),
+                                                      length, seed));
+    Handle<String> string =
+        factory
+            ->NewStringFromOneByte(
+                base::Vector<const uint8_t>(one_byte.data(), length))
+            .ToHandleChecked();
+    CHECK_EQ(hash >> Name::kHashShift, string->EnsureHash());
+    Handle<String> cons =
+        factory
+            ->NewConsString(factory->NewSubString(string, 0, length / 2),
+                            factory->NewSubString(string, length / 2, length))
+            .ToHandleChecked();
+    CHECK_EQ(hash >> Name::kHashShift, cons->EnsureHash());
+
+    // Changing or swapping characters changes the hash.
+    for (int i = 0; i < length - 1; i++) {
+      std::swap(one_byte[i], one_byte[i + 1]);
+      CHECK_NE(hash, StringHasher::HashSequentialString(one_byte.data(),
+                                                        length, seed));
+      std::swap(one_byte[i], one_byte[i + 1]);
+      one_byte[i] ^= 1;
+      CHECK_NE(hash, StringHasher::HashSequentialString(one_byte.data(),
+                                                        length, seed));
+      one_byte[i] ^= 1;
+    }
+    // The seed affects the hash.
+    CHECK_NE(hash, StringHasher::HashSequentialString(one_byte.data(),
+                                                      length, seed + 1));
+  }
+}
+
 TEST(StringEquals) {
   v8::V8::Initialize();
   v8::Isolate* isolate = CcTest::isolate();
@@ -365,6 +365,21 @@ TEST(Strtod) {
                       "48794829220689472168983109969836584681402285424333066033"
                       "98508864458040010349339704275671864433837704860378616227"
                       "71738545623065874679014086723327636718751", -1076));
+
+  // Inputs with up to 20 significant digits are converted with the
+  // Eisel-Lemire fast path; longer ones are truncated to 20 digits first.
+  CHECK_EQ(0.1, StrtodChar("10000000000000000555", -20));
+  CHECK_EQ(12345678901234567890.0, StrtodChar("12345678901234567890", 0));
+  CHECK_EQ(18446744073709551616.0, StrtodChar("18446744073709551615", 0));
+  CHECK_EQ(1.7976931348623157e308, StrtodChar("17976931348623157", 292));
+  CHECK_EQ(2.2250738585072014e-308, StrtodChar("22250738585072014", -324));
+  // Exact half-way cases, which the fast path has to leave to the bignum
+  // comparison, and inputs just above them.
+  CHECK_EQ(9007199254740992.0, StrtodChar("9007199254740993", 0));
+  CHECK_EQ(9007199254740994.0,
+           StrtodChar("90071992547409930000000000001", -13));
+  CHECK_EQ(4503599627370496.0, StrtodChar("45035996273704965", -1));
+  CHECK_EQ(4503599627370497.0, StrtodChar("45035996273704965000000001", -10));
 }
 
 
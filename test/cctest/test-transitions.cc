@@ -7,6 +7,7 @@
 
 #include "src/init/v8.h"
 
+#include "src/api/api-inl.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/execution/execution.h"
 #include "src/handles/global-handles.h"
@@ -304,5 +305,39 @@ TEST(TransitionArray_SameFieldNamesDifferentAttributes) {
   DCHECK(transitions.IsSortedNoDuplicates());
 }
 
+TEST(TransitionArray_DeprecatedMapSlackTrimmed) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+
+  // Five transitions from the map with a Smi field 'a', then deprecate it by
+  // storing a double into 'a' of a fresh object.
+  CompileRun(
+      "var o1 = {}; o1.a = 1; o1.b = 1;"
+      "var o2 = {}; o2.a = 1; o2.c = 1;"
+      "var o3 = {}; o3.a = 1; o3.d = 1;"
+      "var o4 = {}; o4.a = 1; o4.e = 1;"
+      "var o5 = {}; o5.a = 1; o5.f = 1;"
+      "var x = {}; x.a = 1.5;");
+  Handle<JSObject> o1 =
+      Handle<JSObject>::cast(v8::Utils::OpenHandle(*CompileRun("o1")));
+  Handle<Map> map(Map::cast(o1->map().GetBackPointer()), isolate);
+  CHECK(map->is_deprecated());
+  {
+    TestTransitionsAccessor transitions(isolate, map);
+    CHECK(transitions.IsFullTransitionArrayEncoding());
+    CHECK_EQ(5, transitions.NumberOfTransitions());
+  }
+
+  // All targets are alive, but the deprecated map gets no new transitions, so
+  // the GC releases the unused capacity.
+  CcTest::CollectAllGarbage();
+  {
+    TestTransitionsAccessor transitions(isolate, map);
+    CHECK_EQ(5, transitions.NumberOfTransitions());
+    CHECK_EQ(5, transitions.Capacity());
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
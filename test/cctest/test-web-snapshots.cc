@@ -310,6 +310,27 @@ TEST(RegExpNoFlags) {
                            kObjectCount);
 }
 
+TEST(Date) {
+  const char* snapshot_source = "var foo = {'d': new Date(1626352205011)}";
+  const char* test_source = "foo";
+  uint32_t kStringCount = 2;  // 'foo', 'd'
+  uint32_t kMapCount = 1;
+  uint32_t kContextCount = 0;
+  uint32_t kFunctionCount = 0;
+  uint32_t kObjectCount = 1;
+  std::function<void(v8::Isolate*, v8::Local<v8::Context>)> tester =
+      [test_source](v8::Isolate* isolate, v8::Local<v8::Context> new_context) {
+        v8::Local<v8::Object> result = CompileRun(test_source).As<v8::Object>();
+        Local<v8::Value> date =
+            result->Get(new_context, v8_str("d")).ToLocalChecked();
+        CHECK(date->IsDate());
+        CHECK_EQ(1626352205011, date.As<v8::Date>()->ValueOf());
+      };
+  TestWebSnapshotExtensive(snapshot_source, test_source, tester, kStringCount,
+                           kMapCount, kContextCount, kFunctionCount,
+                           kObjectCount);
+}
+
 TEST(SFIDeduplication) {
   CcTest::InitializeVM();
   v8::Isolate* isolate = CcTest::isolate();
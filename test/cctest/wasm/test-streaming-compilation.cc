@@ -1394,6 +1394,52 @@ STREAM_TEST(TierDownWithError) {
   tester.RunCompilerTasks();
 }
 
+// Test that lazily compiled functions are validated in the background while
+// streaming, and that a valid module still compiles.
+STREAM_TEST(TestLazyFunctionsValidatedInBackground) {
+  FlagScope<bool> lazy_compilation(&FLAG_wasm_lazy_compilation, true);
+  FlagScope<bool> lazy_validation(&FLAG_wasm_lazy_validation, false);
+  StreamTester tester(isolate);
+  ZoneBuffer buffer = GetValidModuleBytes(tester.zone());
+
+  tester.OnBytesReceived(buffer.begin(), buffer.end() - buffer.begin());
+  tester.RunCompilerTasks();
+  tester.FinishStream();
+  tester.RunCompilerTasks();
+
+  CHECK(tester.IsPromiseFulfilled());
+}
+
+// Test that a validation error in a lazily compiled function is reported once
+// the stream finished.
+STREAM_TEST(TestLazyFunctionValidationError) {
+  FlagScope<bool> lazy_compilation(&FLAG_wasm_lazy_compilation, true);
+  FlagScope<bool> lazy_validation(&FLAG_wasm_lazy_validation, false);
+  StreamTester tester(isolate);
+  Zone* zone = tester.zone();
+
+  ZoneBuffer buffer(zone);
+  {
+    TestSignatures sigs;
+    WasmModuleBuilder builder(zone);
+    WasmFunctionBuilder* valid = builder.AddFunction(sigs.i_i());
+    uint8_t valid_code[] = {kExprLocalGet, 0, kExprEnd};
+    valid->EmitCode(valid_code, arraysize(valid_code));
+    // Type error: i64 result in an i32 function.
+    WasmFunctionBuilder* invalid = builder.AddFunction(sigs.i_i());
+    uint8_t invalid_code[] = {kExprI64Const, 0, kExprEnd};
+    invalid->EmitCode(invalid_code, arraysize(invalid_code));
+    builder.WriteTo(&buffer);
+  }
+
+  tester.OnBytesReceived(buffer.begin(), buffer.size());
+  tester.RunCompilerTasks();
+  tester.FinishStream();
+  tester.RunCompilerTasks();
+
+  CHECK(tester.IsPromiseRejected());
+}
+
 #undef STREAM_TEST
 
 }  // namespace wasm
@@ -350,6 +350,10 @@ COMPILE_TEST(TestEventMetrics) {
            recorder->module_tiered_up_.back().code_size_in_bytes);
   CHECK_GE(native_module->committed_code_space(),
            recorder->module_tiered_up_.back().code_size_in_bytes);
+  CHECK_LE(recorder->module_tiered_up_.back().code_size_in_bytes,
+           recorder->module_tiered_up_.back().committed_code_size_in_bytes);
+  CHECK_GE(native_module->committed_code_space(),
+           recorder->module_tiered_up_.back().committed_code_size_in_bytes);
   CHECK_LE(0, recorder->module_tiered_up_.back().wall_clock_duration_in_us);
 }
 
@@ -331,6 +331,27 @@ TEST(TierDownAfterDeserialization) {
   CHECK_EQ(ExecutionTier::kLiftoff, liftoff_code->tier());
 }
 
+TEST(SerializeLiftoffModuleWithDynamicTiering) {
+  FlagScope<bool> liftoff(&FLAG_liftoff, true);
+  FlagScope<bool> tier_up(&FLAG_wasm_tier_up, true);
+  FlagScope<bool> dynamic_tiering(&FLAG_wasm_dynamic_tiering, true);
+  WasmSerializationTest test;
+  {
+    HandleScope scope(CcTest::i_isolate());
+    Handle<WasmModuleObject> module_object;
+    CHECK(test.Deserialize().ToHandle(&module_object));
+
+    // The function was never called, hence it had no TurboFan code and got
+    // serialized as a lazy stub.
+    auto* native_module = module_object->native_module();
+    WasmCodeRefScope code_ref_scope;
+    CHECK_NULL(native_module->GetCode(0));
+
+    test.DeserializeAndRun();
+  }
+  test.CollectGarbage();
+}
+
 }  // namespace test_wasm_serialization
 }  // namespace wasm
 }  // namespace internal
@@ -0,0 +1,59 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --concurrent-recompilation --block-concurrent-recompilation
+// Flags: --no-always-opt
+
+if (!%IsConcurrentRecompilationSupported()) {
+  print("Concurrent recompilation is disabled. Skipping this test.");
+  quit();
+}
+
+Debug = debug.Debug;
+
+var break_count = 0;
+function listener(event, exec_state, event_data, data) {
+  if (event == Debug.DebugEvent.Break) break_count++;
+}
+
+function inner(x) {
+  return x + 1;
+}
+
+function outer(x) {
+  return inner(x) * 2;
+}
+
+function unrelated(x) {
+  return x - 1;
+}
+
+%PrepareFunctionForOptimization(outer);
+%PrepareFunctionForOptimization(unrelated);
+outer(1);
+outer(2);
+unrelated(1);
+unrelated(2);
+%OptimizeFunctionOnNextCall(outer, "concurrent");
+outer(3);  // Kick off concurrent recompilation of outer.
+%OptimizeFunctionOnNextCall(unrelated, "concurrent");
+unrelated(3);  // Kick off concurrent recompilation of unrelated.
+
+// Set a break point in the inlined function while both jobs are blocked.
+Debug.setListener(listener);
+Debug.setBreakPoint(inner, 1, 0);
+
+assertUnoptimized(outer, "no sync");
+assertUnoptimized(unrelated, "no sync");
+%UnblockConcurrentRecompilation();
+
+// The job that inlines the function with the break point is discarded, the
+// unrelated one is installed.
+assertUnoptimized(outer, "sync");
+assertOptimized(unrelated, "sync");
+
+assertEquals(8, outer(3));
+assertEquals(1, break_count);
+
+Debug.setListener(null);
@@ -52,10 +52,10 @@ foo();
 %OptimizeFunctionOnNextCall(foo, "concurrent");
 foo();
 
-// Set break points on an unrelated function. This clears both optimized
-// and (shared) unoptimized code on foo, and sets both to lazy-compile builtin.
-// Clear the break point immediately after to deactivate the debugger.
-// Do all of this after compile graph has been created.
+// Set break points on an unrelated function. This does not abort the
+// concurrent recompilation of foo. Clear the break point immediately after to
+// deactivate the debugger. Do all of this after compile graph has been
+// created.
 Debug.setListener(function(){});
 Debug.setBreakPoint(bar, 0, 0);
 Debug.clearAllBreakPoints();
@@ -67,5 +67,4 @@ assertUnoptimized(foo, "no sync");
 %UnblockConcurrentRecompilation();
 
 // Install optimized code when concurrent optimization finishes.
-// This needs to be able to deal with shared code being a builtin.
-assertUnoptimized(foo, "sync");
+assertOptimized(foo, "sync");
@@ -46,6 +46,27 @@ assertEquals("ABCDEFGHIÁ", "ABCDEfGHIá".toUpperCase());
 assertEquals("AŸ", "aÿ".toUpperCase());
 // U+00B5 (µ) is uppercased to U+039C (Μ)
 assertEquals("AΜ", "aµ".toUpperCase());
+// U+00B5 and U+00FF together with sharp-s, in one-byte strings that also
+// have a long ASCII prefix.
+assertEquals("ΜŸSS", "µÿß".toUpperCase());
+assertEquals("ABCDEFGHIJKLMNOPQRSTUVWXYZ ÀΜSSŸ",
+             "abcdefghijklmnopqrstuvwxyz àµßÿ".toUpperCase());
+assertEquals("ABCDEFGHIJKLMNOPQRSTŸ", "abcdefghijklmnopqrstÿ".toUpperCase());
+
+// Long ASCII strings, with changed characters on both sides of every
+// 16-character boundary.
+var asciiLower = "abcdefghijklmnopqrstuvwxyz0123456789-_+=[]{}@`~";
+var asciiUpper = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-_+=[]{}@`~";
+for (var i = 0; i < asciiLower.length; i++) {
+  var lower = asciiLower.substring(i) + asciiLower.substring(0, i);
+  var upper = asciiUpper.substring(i) + asciiUpper.substring(0, i);
+  assertEquals(upper, lower.toUpperCase());
+  assertEquals(lower, upper.toLowerCase());
+  assertEquals(upper, upper.toUpperCase());
+  assertEquals(lower, lower.toLowerCase());
+  assertEquals("X" + upper + "É", ("x" + lower + "é").toUpperCase());
+  assertEquals("x" + lower + "é", ("X" + upper + "É").toLowerCase());
+}
 
 // Buffer size increase
 assertEquals("CSSBẶ", "cßbặ".toUpperCase());
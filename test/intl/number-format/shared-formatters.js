@@ -0,0 +1,53 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Number formats with the same locale and options share their ICU
+// formatter. Check that formats with different settings still format
+// differently, also after more formats than the cache holds were created.
+
+const options = [
+  undefined,
+  {style: 'percent'},
+  {style: 'currency', currency: 'EUR'},
+  {style: 'currency', currency: 'USD'},
+  {style: 'currency', currency: 'USD', currencyDisplay: 'name'},
+  {style: 'unit', unit: 'kilometer-per-hour'},
+  {minimumFractionDigits: 3},
+  {maximumSignificantDigits: 2},
+  {notation: 'compact'},
+  {useGrouping: false},
+  {signDisplay: 'always'},
+];
+const locales = ['en', 'de', 'ar', 'ar-u-nu-latn', 'hi-u-nu-deva', 'ja'];
+const value = 12345.6;
+
+function formatAll() {
+  const result = [];
+  for (const locale of locales) {
+    for (const option of options) {
+      result.push(new Intl.NumberFormat(locale, option).format(value));
+      assertEquals(result[result.length - 1],
+                   value.toLocaleString(locale, option));
+    }
+  }
+  return result;
+}
+
+const first = formatAll();
+assertEquals('12,345.6', first[0]);
+assertEquals('12.345,6', first[options.length]);
+assertTrue(first[2].includes('€'));
+assertTrue(first[3].includes('$'));
+// Formats with different options differ.
+assertEquals(options.length,
+             new Set(first.slice(0, options.length)).size);
+
+// Fill the cache with other formats, then check the results again.
+for (let digits = 0; digits <= 20; digits++) {
+  for (const locale of locales) {
+    new Intl.NumberFormat(locale, {minimumFractionDigits: digits})
+        .format(value);
+  }
+}
+assertEquals(first, formatAll());
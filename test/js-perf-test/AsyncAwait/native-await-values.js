@@ -0,0 +1,40 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('NativeAwaitValues', [1000], [
+  new Benchmark('Primitives', false, false, 0, Primitives, SetupPrimitives),
+  new Benchmark('ResolvedPromises', false, false, 0, ResolvedPromises,
+                SetupResolvedPromises),
+]);
+
+var awaitPrimitives, awaitPromises, resolved;
+
+function SetupPrimitives() {
+  awaitPrimitives = async function awaitPrimitives() {
+    let sum = 0;
+    for (let i = 0; i < 100; i++) sum += await i;
+    return sum;
+  };
+  %PerformMicrotaskCheckpoint();
+}
+
+function Primitives() {
+  awaitPrimitives();
+  %PerformMicrotaskCheckpoint();
+}
+
+function SetupResolvedPromises() {
+  resolved = Promise.resolve(1);
+  awaitPromises = async function awaitPromises() {
+    let sum = 0;
+    for (let i = 0; i < 100; i++) sum += await resolved;
+    return sum;
+  };
+  %PerformMicrotaskCheckpoint();
+}
+
+function ResolvedPromises() {
+  awaitPromises();
+  %PerformMicrotaskCheckpoint();
+}
@@ -0,0 +1,72 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+'use strict';
+
+new BenchmarkSuite('PrivateMembers', [1000], [
+  new Benchmark('PrivateFieldLoad', false, false, 0, PrivateFieldLoad),
+  new Benchmark('PrivateFieldStore', false, false, 0, PrivateFieldStore),
+  new Benchmark('PrivateMethodCall', false, false, 0, PrivateMethodCall),
+  new Benchmark('PrivateAccessor', false, false, 0, PrivateAccessor),
+  new Benchmark('PrivateFieldPolymorphic', false, false, 0,
+                PrivateFieldPolymorphic),
+]);
+
+
+class Counter {
+  #count = 0;
+  #step = 1;
+
+  get #value() { return this.#count; }
+  set #value(value) { this.#count = value; }
+
+  #advance() { this.#count += this.#step; }
+
+  load() { return this.#count + this.#step; }
+  store(value) { this.#count = value; }
+  advance() { this.#advance(); }
+  accessor() { this.#value = this.#value + 1; return this.#value; }
+}
+
+class Base {
+  #x;
+  constructor(x) { this.#x = x; }
+  get x() { return this.#x; }
+}
+
+const instances = [
+  new (class A extends Base { constructor() { super(1); this.a = 1; } }),
+  new (class B extends Base { constructor() { super(2); this.b = 2; } }),
+  new (class C extends Base { constructor() { super(3); this.c = 3; } }),
+  new (class D extends Base { constructor() { super(4); this.d = 4; } }),
+];
+
+const counter = new Counter();
+
+function PrivateFieldLoad() {
+  let result = 0;
+  for (let i = 0; i < 1000; i++) result += counter.load();
+  return result;
+}
+
+function PrivateFieldStore() {
+  for (let i = 0; i < 1000; i++) counter.store(i);
+  return counter;
+}
+
+function PrivateMethodCall() {
+  for (let i = 0; i < 1000; i++) counter.advance();
+  return counter;
+}
+
+function PrivateAccessor() {
+  let result = 0;
+  for (let i = 0; i < 1000; i++) result = counter.accessor();
+  return result;
+}
+
+function PrivateFieldPolymorphic() {
+  let result = 0;
+  for (let i = 0; i < 1000; i++) result += instances[i & 3].x;
+  return result;
+}
@@ -7,6 +7,7 @@ d8.file.execute('../base.js');
 d8.file.execute('super.js');
 d8.file.execute('default-constructor.js');
 d8.file.execute('leaf-constructors.js');
+d8.file.execute('private-members.js');
 
 
 var success = true;
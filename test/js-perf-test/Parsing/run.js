@@ -11,6 +11,7 @@ let code;
 d8.file.execute("comments.js");
 d8.file.execute("strings.js");
 d8.file.execute("arrowfunctions.js")
+d8.file.execute("scopes.js");
 
 var success = true;
 
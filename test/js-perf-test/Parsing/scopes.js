@@ -0,0 +1,40 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Minified bundles are often wrapped in a single giant function with many
+// small, deeply nested modules that reference shared helpers and globals.
+
+new BenchmarkSuite("BundleManyModules", [1000], [
+  new Benchmark("BundleManyModules", false, true, iterations, Run, BundleManyModulesSetup)
+]);
+
+new BenchmarkSuite("BundleDeepNesting", [1000], [
+  new Benchmark("BundleDeepNesting", false, true, iterations, Run, BundleDeepNestingSetup)
+]);
+
+function BundleModule(i) {
+  return "m[" + i + "] = function(e, t, n) { var r = n(" + i + ");" +
+      "e.exports = function(a) { if (a) { for (var o = 0; o < a.length; o++)" +
+      " { r = r + Object.keys(a[o]).length + h(a[o]) + window.x; } }" +
+      " return r + Math.max(o, t.y) + JSON.stringify(a) + u; }; };\n";
+}
+
+function BundleManyModulesSetup() {
+  code = "(function(m) { var h = function(x) { return x; }; var u = 1;\n";
+  for (let i = 0; i < 200; i++) code += BundleModule(i);
+  code += "})([]);\n";
+}
+
+function BundleDeepNestingSetup() {
+  const depth = 40;
+  code = "(function() { var h = 1, u = 2;\n";
+  for (let i = 0; i < depth; i++) {
+    code += "(function(a" + i + ") { let b" + i + " = a" + i + " + h;\n";
+    for (let j = 0; j < 5; j++) {
+      code += "{ const c = () => b" + i + " + u + Math.PI + Object.name; }\n";
+    }
+  }
+  for (let i = 0; i < depth; i++) code += "})(" + i + ");\n";
+  code += "})();\n";
+}
@@ -266,3 +266,20 @@ for (var i = 0; i < 100; i++) {
 var r4 = [0].concat(arr3, arr3);
 assertEquals(1 + arr3.length * 2, r4.length);
 assertEquals(expectedTrace, trace);
+
+// Smi elements, with and without holes, converted to doubles.
+(function() {
+  var smis = [1, -2, 3, 1073741823, -1073741824, 0];
+  var holey_smis = [1, , -3, , 5];
+  var doubles = [0.5, -1.5];
+  var r5 = doubles.concat(smis, holey_smis);
+  assertEquals(13, r5.length);
+  assertEquals([0.5, -1.5, 1, -2, 3, 1073741823, -1073741824, 0, 1],
+               r5.slice(0, 9));
+  assertFalse(9 in r5);
+  assertEquals(-3, r5[10]);
+  assertFalse(11 in r5);
+  assertEquals(5, r5[12]);
+  var r6 = smis.concat(doubles);
+  assertEquals([1, -2, 3, 1073741823, -1073741824, 0, 0.5, -1.5], r6);
+})();
@@ -0,0 +1,61 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Packed Smi, double and one-byte string arrays are sorted directly on their
+// elements by default. Check them against a sort with an explicit comparison
+// function that implements the default order.
+
+function DefaultCompare(a, b) {
+  const x = String(a);
+  const y = String(b);
+  return x < y ? -1 : x > y ? 1 : 0;
+}
+
+function CheckSort(array) {
+  // Sort with the default order first, while non-flat strings are not yet
+  // flattened by the comparisons of the reference sort.
+  const actual = array.slice().sort();
+  const expected = array.slice().sort(DefaultCompare);
+  assertEquals(expected.length, actual.length);
+  for (let i = 0; i < expected.length; i++) {
+    assertTrue(Object.is(expected[i], actual[i]), 'index ' + i);
+  }
+}
+
+let seed = 1;
+function Random() {
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  return seed;
+}
+
+// Smis.
+const smis = [0, -1, 1, 10, 9, -10, -9, 100, 2, 1000000000, -1073741824, 5];
+for (let i = 0; i < 1000; i++) smis.push((Random() % 200001) - 100000);
+CheckSort(smis);
+assertEquals([-1, -10, 1, 10, 100, 2, 9], [9, 100, -1, 2, 1, -10, 10].sort());
+
+// Doubles, including values with the same string.
+const doubles = [0.5, -0, 0, NaN, Infinity, -Infinity, 1e21, 1e-7, 3, -0.25];
+for (let i = 0; i < 1000; i++) doubles.push((Random() % 20001 - 10000) / 7);
+CheckSort(doubles);
+const zeros = [0.5, -0, 0, -0, 0].sort();
+assertTrue(Object.is(-0, zeros[0]));
+assertTrue(Object.is(0, zeros[1]));
+assertTrue(Object.is(-0, zeros[2]));
+assertTrue(Object.is(0, zeros[3]));
+
+// One-byte strings, some of them not flat. Concatenations of at least
+// ConsString::kMinLength (13) characters are cons strings.
+const strings = ['', 'a', 'ab', 'b', 'aa', 'A', 'Z', '\xff', '\x00', '10'];
+for (let i = 0; i < 1000; i++) strings.push('s' + Random());
+const prefix = 'long-prefix-'.repeat(2);
+for (let i = 0; i < 100; i++) {
+  strings.push(prefix + Random());
+  strings.push(strings[10 + i] + prefix);
+}
+CheckSort(strings);
+
+// Mixed and two-byte string arrays take the generic path.
+CheckSort(['b', 'a', '☃', 'c']);
+CheckSort(['b', 1, 'a', 2]);
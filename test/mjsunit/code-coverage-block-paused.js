@@ -0,0 +1,41 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-always-opt --no-stress-flush-bytecode
+
+%DebugToggleBlockCoverage(true);
+
+function GetCoverage(source) {
+  for (var script of %DebugCollectCoverage()) {
+    if (script.script === source) return script;
+  }
+  return undefined;
+}
+
+function nop() {}
+
+function RunAndCollect(source) {
+  eval(source);
+  return GetCoverage(source);
+}
+
+// Every block runs as often as its function, so the counted coverage only
+// contains ranges with a non-zero count.
+const counted = RunAndCollect(`
+function f(x) { if (x) { nop(); } }
+f(true); f(true);
+`);
+assertFalse(counted.some(range => range.count == 0));
+
+// With counting paused, invocation counts still advance, but the block
+// counters stay at zero.
+%DebugSetBlockCountingPaused(true);
+const paused = RunAndCollect(`
+function g(x) { if (x) { nop(); } }
+g(true); g(true);
+`);
+%DebugSetBlockCountingPaused(false);
+assertTrue(paused.some(range => range.count == 0));
+
+%DebugToggleBlockCoverage(false);
@@ -32,3 +32,40 @@
   assertEquals("first", f(0));
   assertEquals("second", f(1));
 })();
+
+// Test variable index access to array with 3 elements.
+(function testThreeElementArrayVariableIndex() {
+  function f(i) {
+    const a = new Array("first", "second", "third");
+    return a[i];
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals("first", f(0));
+  assertEquals("second", f(1));
+  assertEquals("third", f(2));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals("first", f(0));
+  assertEquals("second", f(1));
+  assertEquals("third", f(2));
+})();
+
+// Test variable index access to array with 4 elements inside a loop.
+(function testFourElementArrayVariableIndexInLoop() {
+  function f(n) {
+    let result = 0;
+    for (let i = 0; i < n; ++i) {
+      const a = [1, 2, 3, 4];
+      result += a[i & 3];
+    }
+    return result;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(10, f(4));
+  assertEquals(20, f(8));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(10, f(4));
+  assertEquals(20, f(8));
+  assertEquals(13, f(6));
+})();
@@ -227,3 +227,52 @@ assertEquals(add_all_32bit_int_result_4args, result[0]);
 assertEquals(add_all_32bit_int_result_5args, result[1]);
 assertEquals(add_all_32bit_int_result_6args, result[2]);
 assertEquals(add_all_32bit_int_result_6args, result[3]);
+
+// ----------- add_all_int32_typed_array -----------
+// `add_all_int32_typed_array` has the following signature:
+// int add_all_int32_typed_array(bool /*should_fallback*/,
+//   const FastApiTypedArray<int32_t>&)
+
+const int32_typed_array = new Int32Array([-42, 45, 1e6, 0x1fffffff]);
+const add_all_int32_typed_array_result = -42 + 45 + 1e6 + 0x1fffffff;
+
+function add_all_int32_typed_array(arg, should_fallback = false) {
+  return fast_c_api.add_all_int32_typed_array(should_fallback, arg);
+}
+
+%PrepareFunctionForOptimization(add_all_int32_typed_array);
+assertEquals(add_all_int32_typed_array_result,
+             add_all_int32_typed_array(int32_typed_array));
+%OptimizeFunctionOnNextCall(add_all_int32_typed_array);
+
+// Test that a regular call hits the fast path.
+fast_c_api.reset_counts();
+assertEquals(add_all_int32_typed_array_result,
+             add_all_int32_typed_array(int32_typed_array));
+assertOptimized(add_all_int32_typed_array);
+assertEquals(1, fast_c_api.fast_call_count());
+assertEquals(0, fast_c_api.slow_call_count());
+
+// Test that the fast path sees the typed array offset and length.
+fast_c_api.reset_counts();
+assertEquals(45 + 1e6,
+             add_all_int32_typed_array(int32_typed_array.subarray(1, 3)));
+assertOptimized(add_all_int32_typed_array);
+assertEquals(1, fast_c_api.fast_call_count());
+assertEquals(0, fast_c_api.slow_call_count());
+
+// Test that typed arrays of a different element type take the slow path
+// without deoptimizing.
+fast_c_api.reset_counts();
+assertThrows(() => add_all_int32_typed_array(new Float64Array(4)));
+assertOptimized(add_all_int32_typed_array);
+assertEquals(0, fast_c_api.fast_call_count());
+assertEquals(1, fast_c_api.slow_call_count());
+
+// Test fallback to slow path.
+fast_c_api.reset_counts();
+assertEquals(add_all_int32_typed_array_result,
+             add_all_int32_typed_array(int32_typed_array, true));
+assertOptimized(add_all_int32_typed_array);
+assertEquals(1, fast_c_api.fast_call_count());
+assertEquals(1, fast_c_api.slow_call_count());
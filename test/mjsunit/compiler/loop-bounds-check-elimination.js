@@ -0,0 +1,73 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-loop-bounds-check-elimination
+
+// The bounds check is dominated by the loop condition.
+(function() {
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) s += a[i];
+    return s;
+  }
+
+  const a = new Int32Array([1, 2, 3, 4]);
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(10, sum(a));
+  assertEquals(10, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(10, sum(a));
+  assertEquals(6, sum(new Int32Array([1, 2, 3])));
+  assertEquals(0, sum(new Int32Array(0)));
+})();
+
+// A non-strict loop condition does not prove the access in bounds.
+(function() {
+  function last(a) {
+    let x;
+    for (let i = 0; i <= a.length; i++) x = a[i];
+    return x;
+  }
+
+  const a = new Float64Array([1.5, 2.5]);
+  %PrepareFunctionForOptimization(last);
+  assertEquals(undefined, last(a));
+  assertEquals(undefined, last(a));
+  %OptimizeFunctionOnNextCall(last);
+  assertEquals(undefined, last(a));
+})();
+
+// An access with an offset is not covered by the loop condition.
+(function() {
+  function shifted(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) s += a[i + 1] | 0;
+    return s;
+  }
+
+  const a = [1, 2, 3];
+  %PrepareFunctionForOptimization(shifted);
+  assertEquals(5, shifted(a));
+  assertEquals(5, shifted(a));
+  %OptimizeFunctionOnNextCall(shifted);
+  assertEquals(5, shifted(a));
+})();
+
+// The array may shrink in the loop body, so the length is reloaded.
+(function() {
+  function pop(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) {
+      s += a[i];
+      if (i == 0) a.length = 1;
+    }
+    return s;
+  }
+
+  %PrepareFunctionForOptimization(pop);
+  assertEquals(1, pop([1, 2, 3]));
+  assertEquals(1, pop([1, 2, 3]));
+  %OptimizeFunctionOnNextCall(pop);
+  assertEquals(1, pop([1, 2, 3]));
+})();
@@ -0,0 +1,57 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Brand checks for private methods and accessors in optimized code.
+(function TestPrivateMethod() {
+  class A {
+    #m() { return 42; }
+    call(o) { return o.#m(); }
+  }
+  const a = new A();
+  %PrepareFunctionForOptimization(a.call);
+  assertEquals(42, a.call(a));
+  assertEquals(42, a.call(new A()));
+  %OptimizeFunctionOnNextCall(a.call);
+  assertEquals(42, a.call(a));
+  assertThrows(() => a.call({}), TypeError);
+  assertThrows(() => a.call(1), TypeError);
+})();
+
+(function TestPrivateAccessor() {
+  class A {
+    #x = 1;
+    get #value() { return this.#x; }
+    set #value(v) { this.#x = v; }
+    inc(o) { o.#value = o.#value + 1; return o.#value; }
+  }
+  const a = new A();
+  %PrepareFunctionForOptimization(a.inc);
+  assertEquals(2, a.inc(a));
+  assertEquals(3, a.inc(a));
+  %OptimizeFunctionOnNextCall(a.inc);
+  assertEquals(4, a.inc(a));
+  assertThrows(() => a.inc({}), TypeError);
+})();
+
+(function TestPolymorphicBrandCheck() {
+  class A {
+    #m() { return this.tag; }
+    call(o) { return o.#m(); }
+  }
+  class B extends A { constructor() { super(); this.tag = 'b'; } }
+  class C extends A {
+    constructor() { super(); this.other = 0; this.tag = 'c'; }
+  }
+  const b = new B();
+  const c = new C();
+  %PrepareFunctionForOptimization(b.call);
+  assertEquals('b', b.call(b));
+  assertEquals('c', b.call(c));
+  %OptimizeFunctionOnNextCall(b.call);
+  assertEquals('b', b.call(b));
+  assertEquals('c', b.call(c));
+  assertThrows(() => b.call({tag: 'x'}), TypeError);
+})();
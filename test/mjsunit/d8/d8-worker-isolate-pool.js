@@ -0,0 +1,25 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --worker-isolate-pool-size=2
+
+// Workers take isolates that were created on another thread. Start more of
+// them than the pool holds, and check that stack overflows are still detected
+// on the worker's own stack.
+const workerScript =
+  `function recurse() { return recurse() + 1; }
+   onmessage = function(msg) {
+     try {
+       recurse();
+     } catch (e) {
+       postMessage(msg + (e instanceof RangeError ? 1 : 0));
+     }
+   };`;
+
+for (let i = 0; i < 5; i++) {
+  const w = new Worker(workerScript, {type: 'string'});
+  w.postMessage(i);
+  assertEquals(i + 1, w.getMessage());
+  w.terminate();
+}
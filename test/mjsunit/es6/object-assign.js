@@ -285,3 +285,146 @@ assertSame(Object.assign(o, {}), o);
   }
 
 })();
+
+(function empty_target_same_shape() {
+  // Sources built up from an empty literal have the layout of the empty
+  // target, so the target can take over their map.
+  function make(n) {
+    const o = {};
+    for (let i = 0; i < n; i++) o['p' + i] = i + 0.5;
+    return o;
+  }
+  for (const n of [1, 3, 4, 10]) {
+    const source = make(n);
+    const result = Object.assign({}, source);
+    %HeapObjectVerify(result);
+    if (n <= 4) assertTrue(%HaveSameMap(source, result));
+    assertEquals(Object.keys(source), Object.keys(result));
+    for (let i = 0; i < n; i++) {
+      checkDataProperty(result, 'p' + i, i + 0.5, true, true, true);
+    }
+    // Double fields are not shared between the objects.
+    result.p0 = 42;
+    assertEquals(0.5, source.p0);
+    source.p0 = 7;
+    assertEquals(42, result.p0);
+  }
+
+  // Later sources are still assigned on top.
+  const result = Object.assign({}, make(2), {p1: 'x', q: 1});
+  %HeapObjectVerify(result);
+  assertEquals({p0: 0.5, p1: 'x', q: 1}, result);
+
+  // Symbols keep their place after the strings.
+  const sym = Symbol('s');
+  const mixed = {};
+  mixed.a = 1;
+  mixed[sym] = 2;
+  mixed.b = 3;
+  const mixed_copy = Object.assign({}, mixed);
+  assertEquals(Reflect.ownKeys(mixed), Reflect.ownKeys(mixed_copy));
+  assertEquals(2, mixed_copy[sym]);
+})();
+
+(function empty_target_prototype_setters() {
+  // Own '__proto__' data properties go through the setter.
+  const proto = {marker: 1};
+  const source = {};
+  Object.defineProperty(source, '__proto__',
+      {value: proto, writable: true, enumerable: true, configurable: true});
+  const result = Object.assign({}, source);
+  assertSame(proto, Object.getPrototypeOf(result));
+  assertFalse(Object.prototype.hasOwnProperty.call(result, '__proto__'));
+
+  // Setters and read-only properties on the prototype chain.
+  const log = [];
+  const with_setter = {};
+  with_setter.a = 1;
+  with_setter.intercepted = 2;
+  Object.defineProperty(Object.prototype, 'intercepted',
+      {set(v) { log.push(v); }, configurable: true});
+  const r1 = Object.assign({}, with_setter);
+  assertEquals([2], log);
+  assertFalse(r1.hasOwnProperty('intercepted'));
+  delete Object.prototype.intercepted;
+
+  Object.defineProperty(Object.prototype, 'frozen',
+      {value: 0, writable: false, configurable: true});
+  const with_frozen = {};
+  Object.defineProperty(with_frozen, 'frozen',
+      {value: 1, writable: true, enumerable: true, configurable: true});
+  assertThrows(() => Object.assign({}, with_frozen), TypeError);
+  delete Object.prototype.frozen;
+})();
+
+(function empty_target_non_plain_sources() {
+  // Non-enumerable, read-only and accessor properties are not copied as-is.
+  const source = {};
+  source.a = 1;
+  Object.defineProperty(source, 'hidden', {value: 2, enumerable: false});
+  let result = Object.assign({}, source);
+  assertEquals(['a'], Object.getOwnPropertyNames(result));
+
+  const read_only = {};
+  Object.defineProperty(read_only, 'a',
+      {value: 1, writable: false, enumerable: true, configurable: true});
+  result = Object.assign({}, read_only);
+  checkDataProperty(result, 'a', 1, true, true, true);
+
+  const frozen = Object.freeze({a: 1});
+  result = Object.assign({}, frozen);
+  assertTrue(Object.isExtensible(result));
+  checkDataProperty(result, 'a', 1, true, true, true);
+
+  // Elements and prototypes other than the target's.
+  result = Object.assign({}, {0: 'x', a: 1});
+  assertEquals({0: 'x', a: 1}, result);
+  const other_proto = Object.create({inherited: 1});
+  other_proto.own = 2;
+  result = Object.assign({}, other_proto);
+  assertEquals(undefined, result.inherited);
+  assertEquals(2, result.own);
+
+  // Class instances with private fields.
+  class C {
+    #secret = 1;
+    visible = 2;
+    static secret(o) { return #secret in o; }
+  }
+  result = Object.assign({}, new C());
+  assertFalse(C.secret(result));
+  assertEquals({visible: 2}, result);
+})();
+
+(function empty_target_primitive_sources() {
+  // Primitive sources must not reach the map-adopting path.
+  assertEquals({}, Object.assign({}, null));
+  assertEquals({}, Object.assign({}, undefined));
+  assertEquals({}, Object.assign({}, 1.5));
+  assertEquals({0: 's', 1: 't', 2: 'r'}, Object.assign({}, 'str'));
+  assertEquals({}, Object.assign({}, Symbol()));
+})();
+
+(function empty_target_specialized_fields() {
+  // Sources with Smi, double or heap object fields: the target must stay
+  // independent of the source when either changes the field kind later.
+  function make() {
+    const o = {};
+    o.smi = 1;
+    o.double = 1.5;
+    o.object = {x: 1};
+    return o;
+  }
+  const source = make();
+  const result = Object.assign({}, source);
+  assertEquals(1, result.smi);
+  assertEquals(1.5, result.double);
+  assertEquals({x: 1}, result.object);
+  result.double = 2.5;
+  assertEquals(1.5, source.double);
+  result.smi = 'string';
+  result.object = 42;
+  assertEquals(1, source.smi);
+  assertEquals({x: 1}, source.object);
+  assertEquals(1, make().smi);
+})();
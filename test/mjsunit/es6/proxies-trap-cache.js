@@ -0,0 +1,86 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// The get, has and set traps of fast-mode handlers are cached per handler
+// map; changes to the handler must still be observed.
+
+(function TestSharedHandler() {
+  const log = [];
+  const handler = {
+    get(target, key) { log.push('get ' + key); return target[key]; },
+    has(target, key) { log.push('has ' + key); return key in target; },
+    set(target, key, value) {
+      log.push('set ' + key);
+      target[key] = value;
+      return true;
+    },
+  };
+  const proxies = [];
+  for (let i = 0; i < 10; i++) proxies.push(new Proxy({x: i}, handler));
+  for (let i = 0; i < 10; i++) {
+    const p = proxies[i];
+    assertEquals(i, p.x);
+    assertTrue('x' in p);
+    p.y = i;
+    assertEquals(i, p.y);
+  }
+  assertEquals(40, log.length);
+  assertEquals(['get x', 'has x', 'set y', 'get y'], log.slice(0, 4));
+})();
+
+(function TestTrapReplaced() {
+  const handler = {get() { return 1; }, other: 0};
+  const p = new Proxy({}, handler);
+  assertEquals(1, p.a);
+  // Replacing the value of the trap keeps the handler map.
+  handler.get = function() { return 2; };
+  assertEquals(2, p.a);
+  handler.get = undefined;
+  assertEquals(undefined, p.a);
+  handler.get = null;
+  assertEquals(undefined, p.a);
+  handler.get = 42;
+  assertThrows(() => p.a, TypeError);
+  handler.get = () => 3;
+  assertEquals(3, p.a);
+})();
+
+(function TestTrapRemovedAndAdded() {
+  const handler = {extra: 1, has() { return false; }};
+  const p = new Proxy({a: 1}, handler);
+  assertFalse('a' in p);
+  delete handler.has;
+  assertTrue('a' in p);
+  handler.has = () => false;
+  assertFalse('a' in p);
+  Object.defineProperty(handler, 'has', {get() { return () => true; }});
+  assertTrue('b' in p);
+})();
+
+(function TestDifferentHandlers() {
+  const target = {};
+  const handlers = [
+    {get() { return 'literal'; }},
+    {x: 1, get() { return 'other shape'; }},
+    {get get() { return () => 'accessor'; }},
+    Object.create({get() { return 'prototype'; }}),
+    new Proxy({}, {get() { return () => 'proxy'; }}),
+  ];
+  for (let i = 0; i < 3; i++) {
+    assertEquals(['literal', 'other shape', 'accessor', 'prototype', 'proxy'],
+                 handlers.map(h => new Proxy(target, h).foo));
+  }
+})();
+
+(function TestDictionaryHandler() {
+  const handler = {a: 1, b: 2, set() { return false; }};
+  delete handler.a;
+  assertFalse(%HasFastProperties(handler));
+  const p = new Proxy({}, handler);
+  assertThrows(() => { 'use strict'; p.x = 1; }, TypeError);
+  handler.set = () => true;
+  p.x = 1;
+})();
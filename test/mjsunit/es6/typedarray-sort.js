@@ -149,3 +149,17 @@ for (let constructor of constructorsWithArrays) {
   assertArrayLikeEquals(array, constructor.array.reverse(), constructor.ctor);
   assertEquals(array.length, constructor.array.length);
 }
+
+// Large arrays of small integer types are sorted by counting values; check
+// them against a sort with a comparison function.
+for (let ctor of [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array,
+                  Uint16Array]) {
+  let seed = 7;
+  const array = new ctor(20000);
+  for (let i = 0; i < array.length; i++) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    array[i] = seed >> 8;
+  }
+  const expected = array.slice().sort(cmpfn);
+  assertArrayLikeEquals(array.sort(), expected, ctor);
+}
@@ -0,0 +1,58 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Async functions reuse the closures that resume them for all their awaits;
+// check that repeated awaits of all kinds of values resume correctly.
+
+async function f(n, log) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    sum += await i;
+    sum += await Promise.resolve(i);
+    sum += await {then(resolve) { resolve(i); }};
+    try {
+      await Promise.reject(i);
+    } catch (e) {
+      sum += e;
+    }
+    log.push(i);
+  }
+  return sum;
+}
+
+async function test() {
+  const log = [];
+  const sums = await Promise.all([f(3, log), f(2, log)]);
+  assertEquals([12, 4], sums);
+  assertEquals([0, 0, 1, 1, 2], log);
+}
+
+assertPromiseResult((async () => {
+  %PrepareFunctionForOptimization(f);
+  await test();
+  await test();
+  %OptimizeFunctionOnNextCall(f);
+  await test();
+})());
+
+// Awaiting primitives takes as many microtask ticks as awaiting promises.
+(function() {
+  const log = [];
+  (async () => {
+    await 1;
+    log.push('a1');
+    await 'x';
+    log.push('a2');
+    await undefined;
+    log.push('a3');
+  })();
+  Promise.resolve()
+      .then(() => log.push('p1'))
+      .then(() => log.push('p2'))
+      .then(() => log.push('p3'));
+  %PerformMicrotaskCheckpoint();
+  assertEquals(['a1', 'p1', 'a2', 'p2', 'a3', 'p3'], log);
+})();
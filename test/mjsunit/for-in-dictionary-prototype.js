@@ -0,0 +1,44 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// The keys of a dictionary-mode prototype chain are cached; check that the
+// cache is invalidated when the prototypes change.
+
+function Keys(object) {
+  const keys = [];
+  for (const key in object) keys.push(key);
+  return keys;
+}
+
+const proto = {a: 1, b: 2, c: 3};
+delete proto.b;
+assertFalse(%HasFastProperties(proto));
+const object = Object.create(proto);
+object.x = 1;
+
+assertEquals(['x', 'a', 'c'], Keys(object));
+assertEquals(['x', 'a', 'c'], Keys(object));
+
+proto.d = 4;
+assertEquals(['x', 'a', 'c', 'd'], Keys(object));
+
+delete proto.a;
+assertEquals(['x', 'c', 'd'], Keys(object));
+
+Object.defineProperty(proto, 'c', {enumerable: false});
+assertEquals(['x', 'd'], Keys(object));
+
+// Changes further up the chain.
+const grand_proto = Object.getPrototypeOf(proto);
+Object.setPrototypeOf(proto, {g: 1});
+assertEquals(['x', 'd', 'g'], Keys(object));
+Object.getPrototypeOf(proto).h = 2;
+assertEquals(['x', 'd', 'g', 'h'], Keys(object));
+Object.setPrototypeOf(Object.getPrototypeOf(proto), grand_proto);
+
+// Elements on the prototype.
+proto[0] = 0;
+assertEquals(['x', '0', 'd', 'g', 'h'], Keys(object));
@@ -0,0 +1,55 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Large BigInts are converted to and from strings with divide-and-conquer
+// algorithms; check them against each other and against power-of-two radixes,
+// which use a separate code path.
+
+function check(x) {
+  const hex = x.toString(16);
+  assertEquals(x, BigInt('0x' + hex));
+  for (const radix of [10, 3, 7, 36]) {
+    const string = x.toString(radix);
+    assertNotEquals('0', string[0]);
+    if (radix === 10) {
+      assertEquals(x, BigInt(string));
+      assertEquals(x, BigInt('  ' + string + '\n'));
+      assertEquals(-x, -BigInt(string));
+      assertEquals('-' + string, (-x).toString());
+    }
+    // Parse the string back with a shorter multiply-add loop, one chunk at a
+    // time.
+    let value = 0n;
+    const big_radix = BigInt(radix);
+    for (let i = 0; i < string.length; i += 100) {
+      const chunk = string.substring(i, i + 100);
+      value = value * big_radix ** BigInt(chunk.length) +
+          BigInt(parseChunk(chunk, radix));
+    }
+    assertEquals(x, value);
+  }
+}
+
+function parseChunk(chunk, radix) {
+  let value = 0n;
+  const big_radix = BigInt(radix);
+  for (const c of chunk) value = value * big_radix + BigInt(parseInt(c, radix));
+  return value;
+}
+
+check(10n ** 20000n);
+check(10n ** 20000n - 1n);
+check(7n ** 7000n + 12345678901234567890n);
+check((1n << 70000n) - 1n);
+// Strings with many zeros in the middle, at the boundaries of the chunks the
+// algorithms split the number into.
+check(10n ** 30000n + 1n);
+check(36n ** 5000n * 35n);
+
+// Zeros are preserved, and leading zeros are ignored.
+assertEquals(10n ** 5000n, BigInt('1' + '0'.repeat(5000)));
+assertEquals(10n ** 5000n, BigInt('0'.repeat(3000) + '1' + '0'.repeat(5000)));
+assertEquals(10n ** 5000n + 7n,
+             BigInt('1' + '0'.repeat(4999) + '7'));
+assertThrows(() => BigInt('1'.repeat(5000) + 'x'), SyntaxError);
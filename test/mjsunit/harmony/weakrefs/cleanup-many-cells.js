@@ -0,0 +1,61 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --noincremental-marking
+// Flags: --finalization-registry-cleanup-slice=100
+// Flags: --finalization-registry-cleanup-budget=0
+
+// With a small slice and no time budget, cleanup of many cleared cells is
+// split across several tasks; check that every cell is still cleaned up
+// exactly once, and that cells unregistered in the meantime are skipped.
+
+const kCells = 1000;
+let seen = new Set();
+let unregistered = -1;
+// Callbacks of one cleanup task run without a microtask checkpoint in between,
+// so count the tasks by the number of checkpoints in between callbacks.
+let tasks = 0;
+let in_task = false;
+let cleanup = function(holdings) {
+  if (!in_task) {
+    in_task = true;
+    tasks++;
+    Promise.resolve().then(() => { in_task = false; });
+  }
+  assertFalse(seen.has(holdings));
+  seen.add(holdings);
+  // From the first callback, unregister a cell that has not been processed.
+  if (unregistered == -1) {
+    unregistered = holdings == 0 ? 1 : 0;
+    assertTrue(fg.unregister(tokens[unregistered]));
+  }
+}
+
+let fg = new FinalizationRegistry(cleanup);
+let tokens = [];
+
+(function() {
+  for (let i = 0; i < kCells; ++i) {
+    const token = {};
+    tokens.push(token);
+    fg.register({}, i, token);
+  }
+  // Objects go out of scope.
+})();
+
+gc();
+assertEquals(0, seen.size);
+
+let polls = 0;
+let timeout_func = function() {
+  if (seen.size < kCells - 1 && ++polls < 100) {
+    setTimeout(timeout_func, 0);
+    return;
+  }
+  assertEquals(kCells - 1, seen.size);
+  assertFalse(seen.has(unregistered));
+  assertTrue(tasks >= 2);
+}
+
+setTimeout(timeout_func, 0);
@@ -0,0 +1,37 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition-elide-redundant-context-loads
+
+(function TestRepeatedLoads() {
+  const a = 1;
+  const b = {x: 2};
+  function f(y) {
+    return a + b.x + a * y + b.x * a;
+  }
+  assertEquals(1 + 2 + 3 + 2, f(3));
+})();
+
+(function TestLoadsAcrossNestedContexts() {
+  const a = 10;
+  function f() {
+    let sum = a;
+    for (let i = 0; i < 3; i++) {
+      const c = i;
+      sum += a + c + (() => a + c)();
+    }
+    return sum + a;
+  }
+  assertEquals(10 + 20 + 22 + 24 + 10, f());
+})();
+
+(function TestTemporalDeadZone() {
+  function f() {
+    const g = () => x + x;
+    assertThrows(g, ReferenceError);
+    const x = 3;
+    return g();
+  }
+  assertEquals(6, f());
+})();
@@ -0,0 +1,48 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Objects that are not array elements learn their shape from the last
+// object with the same number of properties.
+
+(function TestSameShape() {
+  const o = JSON.parse(
+      '{"a": {"x": 1, "y": 2}, "b": {"x": 3, "y": 4},' +
+      ' "c": [{"x": 5, "y": 6}]}');
+  assertTrue(%HaveSameMap(o.a, o.b));
+  assertTrue(%HaveSameMap(o.a, o.c[0]));
+  assertEquals({x: 3, y: 4}, o.b);
+})();
+
+(function TestDifferentKeys() {
+  const o = JSON.parse(
+      '{"a": {"x": 1, "y": 2}, "b": {"y": 3, "x": 4}, "c": {"x": 5, "z": 6}}');
+  assertEquals(['x', 'y'], Object.keys(o.a));
+  assertEquals(['y', 'x'], Object.keys(o.b));
+  assertEquals(['x', 'z'], Object.keys(o.c));
+  assertEquals({y: 3, x: 4}, o.b);
+  assertEquals({x: 5, z: 6}, o.c);
+  assertFalse(%HaveSameMap(o.a, o.b));
+})();
+
+(function TestRepresentationChanges() {
+  const o = JSON.parse(
+      '{"a": {"v": 1, "w": "s"}, "b": {"v": 1.5, "w": "t"},' +
+      ' "c": {"v": {"n": null}, "w": 2}, "d": {"v": 7, "w": []}}');
+  assertEquals(1, o.a.v);
+  assertEquals(1.5, o.b.v);
+  assertEquals({n: null}, o.c.v);
+  assertEquals(2, o.c.w);
+  assertEquals(7, o.d.v);
+  assertEquals([], o.d.w);
+})();
+
+(function TestElementsAndNamedProperties() {
+  const o = JSON.parse(
+      '{"a": {"0": 1, "x": 2}, "b": {"x": 3, "1": 4}, "c": {"x": 5}}');
+  assertEquals({0: 1, x: 2}, o.a);
+  assertEquals({1: 4, x: 3}, o.b);
+  assertEquals({x: 5}, o.c);
+})();
@@ -0,0 +1,28 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// One-byte JSON strings are scanned a word at a time; check quotes, escapes
+// and control characters at every position relative to word boundaries.
+
+for (let length = 0; length < 40; length++) {
+  for (let pos = 0; pos <= length; pos++) {
+    const filler = 'x'.repeat(pos) + '\xe9' + 'y'.repeat(length - pos);
+    assertEquals(filler, JSON.parse(JSON.stringify(filler)));
+
+    const escaped = 'a'.repeat(pos) + '\\"\\\\\\n\\u0041' + 'b'.repeat(length);
+    assertEquals('a'.repeat(pos) + '"\\\nA' + 'b'.repeat(length),
+                 JSON.parse('"' + escaped + '"'));
+
+    const control = 'c'.repeat(pos) + '\x1f' + 'd'.repeat(length);
+    assertThrows(() => JSON.parse('"' + control + '"'), SyntaxError);
+
+    const unterminated = '"' + 'e'.repeat(pos + length);
+    assertThrows(() => JSON.parse(unterminated), SyntaxError);
+  }
+}
+
+// Characters just above the terminators must not stop the scan.
+const neighbours = ' !#[]\x7f\x80\xa2\xdc\xff';
+assertEquals(neighbours.repeat(5),
+             JSON.parse(JSON.stringify(neighbours.repeat(5))));
@@ -0,0 +1,47 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// JSON.stringify serializes one-byte cons strings segment by segment instead
+// of flattening them. Escapes must come out the same.
+
+function concat(pieces) {
+  let result = '';
+  for (const piece of pieces) result += piece;
+  return result;
+}
+
+function expected(pieces) {
+  // Array.prototype.join creates a flat string.
+  return JSON.stringify(pieces.join(''));
+}
+
+function test(pieces) {
+  const cons = concat(pieces);
+  assertEquals(expected(pieces), JSON.stringify(cons));
+  // Inside an object, and with the result being two-byte.
+  assertEquals('{"a":' + expected(pieces) + '}', JSON.stringify({a: cons}));
+  assertEquals('["\u1234",' + expected(pieces) + ']',
+               JSON.stringify(['\u1234', cons]));
+  assertEquals('[\n  ' + expected(pieces) + '\n]',
+               JSON.stringify([cons], undefined, 2));
+}
+
+const line = 'log line with "quotes", a \\ backslash\tand\nescapes ';
+const long_pieces = [];
+for (let i = 0; i < 200; i++) long_pieces.push(line + i + '\\');
+test(long_pieces);
+test(long_pieces.map(p => p + '\x7f\xff\x01'));
+
+// Short pieces are flattened first, with the same result.
+const short_pieces = [];
+for (let i = 0; i < 500; i++) short_pieces.push('"\\' + (i % 10));
+test(short_pieces);
+
+// Two-byte cons strings, including surrogate pairs split between segments.
+const two_byte_pieces = [];
+for (let i = 0; i < 100; i++) {
+  two_byte_pieces.push(line + '\ud83d');
+  two_byte_pieces.push('\ude00' + line + '\ud800');
+}
+test(two_byte_pieces);
@@ -0,0 +1,39 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// One-byte strings are copied a word at a time while no character needs
+// escaping; check escapes at every position relative to word boundaries.
+
+function reference(string) {
+  let result = '"';
+  for (const c of string) {
+    const code = c.charCodeAt(0);
+    if (c === '"' || c === '\\') {
+      result += '\\' + c;
+    } else if (code < 0x20) {
+      const escapes = {8: 'b', 9: 't', 10: 'n', 12: 'f', 13: 'r'};
+      result += code in escapes ?
+          '\\' + escapes[code] :
+          '\\u' + code.toString(16).padStart(4, '0');
+    } else {
+      result += c;
+    }
+  }
+  return result + '"';
+}
+
+const specials = ['"', '\\', '\n', '\x00', '\x1f', ' ', '!', '#', '~', '\x7f',
+                  '\x80', '\xe9', '\xff'];
+for (let length = 0; length < 40; length++) {
+  for (let pos = 0; pos <= length; pos++) {
+    for (const special of specials) {
+      const string = 'a'.repeat(pos) + special + 'z'.repeat(length - pos);
+      assertEquals(reference(string), JSON.stringify(string));
+      assertEquals(string, JSON.parse(JSON.stringify(string)));
+    }
+  }
+}
+
+assertEquals('{"key with spaces":"value \\"quoted\\""}',
+             JSON.stringify({'key with spaces': 'value "quoted"'}));
@@ -0,0 +1,50 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --enable-lazy-source-positions --allow-natives-syntax
+
+// Source positions collected lazily for the first stack trace are kept on the
+// bytecode, so later stack traces of the same functions must report the same
+// locations.
+
+function thrower(n) {
+  if (n > 0) return thrower(n - 1);
+  throw new Error('boom');
+}
+
+function outer() {
+  const inner = (function() {
+    return function() { thrower(2); };
+  })();
+  inner();
+}
+
+function captured() {
+  const holder = {};
+  Error.captureStackTrace(holder);
+  return holder.stack;
+}
+
+function stackOf(f) {
+  try {
+    f();
+  } catch (e) {
+    return e.stack;
+  }
+  assertUnreachable();
+}
+
+%PrepareFunctionForOptimization(outer);
+const first = stackOf(outer);
+assertTrue(first.includes('thrower'));
+for (let i = 0; i < 5; i++) {
+  assertEquals(first, stackOf(outer));
+}
+%OptimizeFunctionOnNextCall(outer);
+assertEquals(first, stackOf(outer));
+
+const captured_first = captured();
+for (let i = 0; i < 5; i++) {
+  assertEquals(captured_first, captured());
+}
@@ -0,0 +1,16 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --cache=code
+
+// The second run restores this module and its imports from the code cache.
+
+import life, {a, b, set_a, get_a} from "modules-skip-1.mjs";
+
+assertEquals(42, life);
+assertEquals(1, a);
+assertEquals(1, b);
+set_a(2);
+assertEquals(2, a);
+assertEquals(2, get_a());
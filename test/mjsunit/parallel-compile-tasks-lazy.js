@@ -0,0 +1,48 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-compile-tasks-for-lazy --use-external-strings
+
+// Lazy top-level functions are compiled in parallel tasks; make sure they
+// still behave when called before or after those tasks finish.
+
+var outer_var = 42;
+
+function lazy_simple() {
+  return outer_var;
+}
+
+function lazy_closure(x) {
+  return function(y) { return x + y + outer_var; };
+}
+
+function* lazy_generator() {
+  yield 1;
+  yield outer_var;
+}
+
+async function lazy_async(x) {
+  return await x;
+}
+
+function lazy_recursive(n) {
+  return n <= 1 ? 1 : n * lazy_recursive(n - 1);
+}
+
+function lazy_uncalled() {
+  class foo { bar() { return 1; } }
+  return new foo().bar();
+}
+
+function lazy_strict() {
+  'use strict';
+  return this;
+}
+
+assertEquals(42, lazy_simple());
+assertEquals(45, lazy_closure(1)(2));
+assertEquals([1, 42], [...lazy_generator()]);
+assertEquals(120, lazy_recursive(5));
+assertEquals(undefined, lazy_strict());
+lazy_async(7).then(v => assertEquals(7, v));
@@ -0,0 +1,17 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-snapshot-decompression
+
+// Isolates set up from a (possibly compressed) snapshot must be fully usable.
+
+assertEquals('3,2,1', [1, 2, 3].reverse().join());
+
+if (this.Worker) {
+  const worker = new Worker(
+      'postMessage(Object.keys(Math).length > 0 && typeof Array.from);',
+      {type: 'string'});
+  assertEquals('function', worker.getMessage());
+  worker.terminate();
+}
@@ -0,0 +1,21 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-execution-stats
+
+// Collecting execution stats routes all executions through the runtime; make
+// sure results are unaffected.
+
+const re = /(\d+)-(\d+)/;
+for (let i = 0; i < 10; i++) {
+  assertEquals(['1-2', '1', '2'], Array.from(re.exec('x 1-2 y')));
+}
+const sticky = /ab/y;
+sticky.lastIndex = 1;
+assertTrue(sticky.test('xab'));
+assertEquals(3, sticky.lastIndex);
+assertEquals('a-b-c', 'a b c'.replace(/ /g, '-'));
+assertEquals(['a', 'b'], 'a,b'.split(/,/));
+assertEquals(2, 'xyab'.search(/ab/));
+assertNull(/q/i.exec('xyz'));
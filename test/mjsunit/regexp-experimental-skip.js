@@ -0,0 +1,48 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-skip
+
+function Test(regexp, subject, expectedResult, expectedLastIndex,
+              expectedIndex = subject.indexOf(expectedResult?.[0])) {
+  assertEquals(%RegexpTypeTag(regexp), "EXPERIMENTAL");
+  var result = regexp.exec(subject);
+  if (result instanceof Array && expectedResult instanceof Array) {
+    assertArrayEquals(expectedResult, result);
+    assertEquals(expectedIndex, result.index);
+  } else {
+    assertEquals(expectedResult, result);
+  }
+  assertEquals(expectedLastIndex, regexp.lastIndex);
+}
+
+const filler = "-".repeat(200);
+
+// Plain literals and character classes after long runs of non-matching input.
+Test(/asdf/, filler + "asdf" + filler, ["asdf"], 0);
+Test(/[x-z]\d/, filler + "y" + filler + "z7", ["z7"], 0);
+Test(/asdf/, filler, null, 0);
+Test(/쁰d/, filler + "쁰d", ["쁰d"], 0);
+
+// Partial matches that die in the middle of the input.
+Test(/abc/, filler + "ababab" + filler + "abc", ["abc"], 0);
+Test(/a+b/, "aaax" + filler + "aab", ["aab"], 0);
+
+// Captures and alternatives.
+Test(/(a|b)(c+)/, filler + "bccc" + filler, ["bccc", "b", "ccc"], 0);
+Test(/x(y)?z/, filler + "xz" + filler, ["xz", undefined], 0);
+
+// Patterns that can match the empty string or start with an assertion are
+// not skipped, but still have to work.
+Test(/a*/, filler, [""], 0);
+Test(/\bfoo/, filler + "afoo foo", ["foo"], 0, 205);
+Test(/^a/m, filler + "\na", ["a"], 0);
+
+// Global and sticky regexps.
+var re = /ab/g;
+Test(re, filler + "ab" + filler + "ab", ["ab"], 202, 200);
+Test(re, filler + "ab" + filler + "ab", ["ab"], 404, 402);
+Test(re, filler + "ab" + filler + "ab", null, 0);
+Test(/ab/y, filler + "ab", null, 0);
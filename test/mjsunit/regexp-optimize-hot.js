@@ -0,0 +1,28 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --regexp-tier-up --regexp-optimize-hot
+// Flags: --regexp-hot-tier-up-ticks=5 --no-regexp-interpret-all
+
+// Regexps stay in the interpreter until they are hot, then tier up to native
+// code compiled with more loop unrolling; results must not change.
+
+function check(re, subject, expected) {
+  for (let i = 0; i < 10; i++) {
+    re.lastIndex = 0;
+    const result = re.exec(subject);
+    assertEquals(expected, result === null ? null : Array.from(result));
+    // The tier-up happens after the hot threshold, not the regular one.
+    if (i < 3) assertFalse(%RegexpHasNativeCode(re, true), String(re));
+  }
+  assertTrue(%RegexpHasNativeCode(re, true), String(re));
+}
+
+check(/a{5,7}b/, 'xaaaaaaab', ['aaaaaab']);
+check(/a{5,7}b/, 'xaaaab', null);
+check(/x(?:ab){2,6}y/, 'xababababy', ['xababababy']);
+check(/[a-c]{0,8}d/, 'abcabcabcd', ['bcabcabcd']);
+check(/q\d?\d?\d?\d?\d?z/, 'q1234z', ['q1234z']);
+check(/(?:foo|bar){4}!/, 'foobarbarfoo!', ['foobarbarfoo!']);
+check(/a{3,}?b/, 'aaaaab', ['aaaaab']);
@@ -0,0 +1,40 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Global regexp replacements with a replacement string that contains no
+// substitution patterns.
+
+assertEquals('a-b-c', 'a1b22c'.replace(/\d+/g, '-').replace(/-$/, ''));
+assertEquals('x-y-z-', 'x1y22z333'.replace(/\d+/g, '-'));
+assertEquals('', '123'.replace(/\d/g, ''));
+assertEquals('---', 'abc'.replace(/[a-z]/g, '-'));
+assertEquals('abc', 'abc'.replace(/\d/g, '-'));
+
+// Empty matches.
+assertEquals('-a-b-c-', 'abc'.replace(/x*/g, '-'));
+assertEquals('-', ''.replace(/x*/g, '-'));
+
+// Mixed one-byte and two-byte subjects and replacements.
+assertEquals('aሴbሴc', 'a1b2c'.replace(/\d/g, 'ሴ'));
+assertEquals('ሴ-ሴ-', 'ሴ1ሴ2'.replace(/\d/g, '-'));
+assertEquals('ሴ', 'ሴሴሴ'.replace(/ሴ+/g, 'ሴ'));
+
+// Captures in the regexp do not matter without substitution patterns.
+assertEquals('[] [] []', 'ab cd ef'.replace(/(\w)(\w)/g, '[]'));
+
+// Last match info is still updated.
+'xx 12 yy 345 zz'.replace(/(\d)(\d+)/g, '#');
+assertEquals('345', RegExp.lastMatch);
+assertEquals('3', RegExp.$1);
+assertEquals('45', RegExp.$2);
+
+// Many matches in a large subject.
+const subject = 'ab'.repeat(100000);
+assertEquals('c'.repeat(100000), subject.replace(/ab/g, 'c'));
+assertEquals('xyz'.repeat(200000), subject.replace(/[ab]/g, 'xyz'));
+assertEquals('xyzb'.repeat(100000), subject.replaceAll(/a/g, 'xyz'));
+
+// Results that are too long throw.
+assertThrows(() => 'a'.repeat(1 << 20).replace(/a/g, 'b'.repeat(1 << 20)),
+             RangeError);
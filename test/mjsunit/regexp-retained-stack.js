@@ -0,0 +1,21 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-retained-stack-size=256 --no-regexp-tier-up --expose-gc
+
+// Deeply backtracking regexps keep their grown backtrack stack between
+// executions; interleave them with shallow ones and stacks of different sizes.
+
+const deep = /^(?:a|b)*c$/;
+const shallow = /x(y)z/;
+
+for (let i = 0; i < 5; i++) {
+  for (const length of [10, 1000, 20000, 100000, 300]) {
+    const subject = 'ab'.repeat(length);
+    assertTrue(deep.test(subject + 'c'));
+    assertFalse(deep.test(subject + 'd'));
+    assertEquals(['xyz', 'y'], Array.from(shallow.exec('__xyz__')));
+  }
+  gc();
+}
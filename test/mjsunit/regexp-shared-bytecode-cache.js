@@ -0,0 +1,31 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-shared-bytecode-cache --regexp-interpret-all
+
+// Regexps compiled in a worker (a different isolate) reuse the bytecode
+// compiled in the main isolate, and must behave the same.
+
+function run() {
+  const results = [];
+  results.push(/(\d+)-(\d+)/.exec('range 10-20')?.slice(0));
+  results.push('a1b22c333'.replace(/\d+/g, n => n.length));
+  results.push(/^\/api\/v(\d)\/([a-z]+)$/i.exec('/API/v2/users')?.slice(0));
+  results.push(/(?<year>\d{4})-(?<month>\d{2})/.exec('2021-07')?.groups?.month);
+  results.push(/x+y/.test('xxxx'));
+  results.push('ሴa1ሴ'.match(/\w/g));
+  return JSON.stringify(results);
+}
+
+const expected = run();
+// Compiling again in the same isolate hits the per-isolate cache first; make
+// sure the results are stable.
+assertEquals(expected, run());
+
+if (this.Worker) {
+  const worker = new Worker(
+      run.toString() + 'postMessage(run());', {type: 'string'});
+  assertEquals(expected, worker.getMessage());
+  worker.terminate();
+}
@@ -0,0 +1,35 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-simd-skip --no-regexp-tier-up
+
+// Regexps whose match start is found by skipping to a single character.
+// Check matches at every position relative to the 16-character blocks and
+// close to the end of the subject.
+
+function check(re, needle, filler) {
+  for (let length = 0; length < 70; length++) {
+    for (let pos = 0; pos + needle.length <= length; pos++) {
+      const subject = filler.repeat(pos) + needle +
+          filler.repeat(length - pos - needle.length);
+      re.lastIndex = 0;
+      const match = re.exec(subject);
+      assertNotNull(match, subject);
+      assertEquals(pos, match.index, subject);
+    }
+    re.lastIndex = 0;
+    assertNull(re.exec(filler.repeat(length)));
+  }
+}
+
+check(/xyzzy/, 'xyzzy', 'a');
+check(/qu+x/, 'quux', '.');
+check(/k\d\d/g, 'k42', ' ');
+// The skip compares characters modulo the table size; make sure characters
+// that only differ above it are not mistaken for the needle.
+check(/zebra/, 'zebra', '\xfa');
+check(/\xe9clair/, '\xe9clair', 'i');
+
+// Two-byte subjects use the scalar skip loop.
+check(/xyzzy/, 'xyzzy', 'ሴ');
@@ -0,0 +1,81 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --regexp-sticky-atoms
+
+// Non-global sticky regexps for plain strings are atoms and only match at
+// lastIndex.
+
+const re = /=>/y;
+const subject = 'a => b=>c';
+re.lastIndex = 0;
+assertNull(re.exec(subject));
+assertEquals(0, re.lastIndex);
+re.lastIndex = 2;
+const m = re.exec(subject);
+assertEquals(['=>'], Array.from(m));
+assertEquals(2, m.index);
+assertEquals(4, re.lastIndex);
+assertEquals("ATOM", %RegexpTypeTag(re));
+
+re.lastIndex = 3;
+assertFalse(re.test(subject));
+assertEquals(0, re.lastIndex);
+re.lastIndex = 6;
+assertTrue(re.test(subject));
+assertEquals(8, re.lastIndex);
+// Too close to the end, and past the end.
+re.lastIndex = 8;
+assertFalse(re.test(subject));
+re.lastIndex = 100;
+assertFalse(re.test(subject));
+assertEquals(0, re.lastIndex);
+
+// A tokenizer loop.
+function tokenize(input) {
+  const tokens = [];
+  const word = /[a-z]+/y;
+  const arrow = /=>/y;
+  const space = / /y;
+  let pos = 0;
+  while (pos < input.length) {
+    let matched = false;
+    for (const [name, token] of [['word', word], ['arrow', arrow],
+                                 ['space', space]]) {
+      token.lastIndex = pos;
+      if (token.test(input)) {
+        if (name != 'space') tokens.push(input.slice(pos, token.lastIndex));
+        pos = token.lastIndex;
+        matched = true;
+        break;
+      }
+    }
+    if (!matched) throw new Error('unexpected ' + input[pos]);
+  }
+  return tokens;
+}
+assertEquals(['a', '=>', 'b', '=>', 'c'], tokenize(subject));
+assertEquals(['x', '=>', 'yy'], tokenize('x =>yy'));
+
+// Two-byte subjects and needles.
+const re2 = /ሴ噸/y;
+re2.lastIndex = 1;
+assertTrue(re2.test('aሴ噸'));
+re2.lastIndex = 0;
+assertFalse(re2.test('aሴ噸'));
+
+// Other APIs respect stickiness.
+const rs = /ab/y;
+assertEquals('xab', 'xab'.replace(rs, '_'));
+assertEquals(0, rs.lastIndex);
+assertEquals('_x', 'abx'.replace(rs, '_'));
+assertEquals(-1, 'xab'.search(rs));
+assertEquals(0, 'abx'.search(rs));
+assertEquals(['x', 'c', ''], 'xabcab'.split(rs));
+assertNull('xab'.match(rs));
+
+// Global sticky regexps are unaffected.
+const rg = /ab/gy;
+assertEquals(['ab', 'ab'], 'ababxab'.match(rg));
+assertEquals('__xab', 'ababxab'.replace(rg, '_'));
@@ -0,0 +1,29 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Identifiers, whitespace and string literals are scanned a run of characters
+// at a time; check long runs that cross the scanner's buffer blocks and runs
+// that mix one-byte and two-byte characters.
+
+for (const length of [1, 15, 16, 17, 255, 256, 511, 512, 513, 4096, 10000]) {
+  const ident = 'x'.repeat(length);
+  assertEquals(length, eval(`var ${ident} = ${length}; ${ident}`));
+
+  const spaces = ' \t'.repeat(length);
+  assertEquals(3, eval(`${spaces}1${spaces}+${spaces}2${spaces}`));
+  // A line terminator in a whitespace run still triggers ASI.
+  assertEquals(
+      undefined, eval(`(function() { return${spaces}\n${spaces}1; })()`));
+
+  for (const filler of ['a', '\xe9', 'ሴ', 'aሴ', '\xe9a']) {
+    const content = filler.repeat(length);
+    assertEquals(content, eval(`'${content}'`));
+    assertEquals(content + '\n' + content, eval(`"${content}\\n${content}"`));
+  }
+}
+
+// Unterminated strings and line terminators inside strings.
+assertThrows(() => eval(`'${'a'.repeat(1000)}`), SyntaxError);
+assertThrows(() => eval(`'${'a'.repeat(1000)}\n'`), SyntaxError);
+assertEquals('a b', eval(`'a b'`));
@@ -0,0 +1,67 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --scope-lookup-cache --no-lazy
+
+// Variables resolved outside of function scopes are cached per function scope
+// during scope analysis. Check that lookups from many inner functions still
+// resolve to the right bindings, including shadowing, globals, 'with' and
+// sloppy 'eval'.
+
+var global_value = 'global';
+
+(function bundle() {
+  var shared = 1;
+  let counter = 0;
+  function inc() { return ++counter; }
+  const fns = [
+    () => shared + inc(),
+    function() { return shared + inc(); },
+    function() { var shared = 100; return () => shared + inc(); }(),
+    () => global_value,
+    () => { let global_value = 'local'; return () => global_value; }(),
+    () => typeof undeclared_global,
+  ];
+  assertEquals(2, fns[0]());
+  assertEquals(3, fns[1]());
+  assertEquals(103, fns[2]());
+  assertEquals('global', fns[3]());
+  assertEquals('local', fns[4]());
+  assertEquals('undefined', fns[5]());
+  shared = 10;
+  assertEquals(14, fns[0]());
+  assertEquals(104, fns[2]());
+})();
+
+(function withScopes() {
+  var x = 'outer';
+  var o = {x: 'with'};
+  with (o) {
+    var f = function() { return () => x; };
+  }
+  var g = function() { return () => x; };
+  assertEquals('with', f()());
+  assertEquals('outer', g()());
+  delete o.x;
+  assertEquals('outer', f()());
+})();
+
+(function sloppyEval() {
+  var y = 'outer';
+  function f() {
+    eval('var y = "eval"');
+    return () => y;
+  }
+  function g() { return () => y; }
+  assertEquals('eval', f()());
+  assertEquals('outer', g()());
+})();
+
+(function deepNesting() {
+  var source = 'var value = 42; return ';
+  for (var i = 0; i < 50; i++) source += '(() => { return ';
+  source += 'value + typeof Math';
+  for (var i = 0; i < 50; i++) source += '; })()';
+  assertEquals('42object', new Function(source)());
+})();
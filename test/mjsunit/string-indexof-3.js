@@ -0,0 +1,55 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short patterns are searched for a vector of positions at a time. Check
+// matches at all offsets relative to the vector boundaries, in one-byte and
+// two-byte subjects.
+
+function naiveIndexOf(subject, pattern, start) {
+  for (let i = start; i + pattern.length <= subject.length; i++) {
+    if (subject.substring(i, i + pattern.length) === pattern) return i;
+  }
+  return -1;
+}
+
+function test(filler, two_byte_char) {
+  for (let length = 1; length < 70; length++) {
+    let subject = '';
+    for (let i = 0; i < length; i++) subject += filler[i % filler.length];
+    if (two_byte_char) subject = two_byte_char + subject;
+    for (let pattern_length = 1; pattern_length < 8; pattern_length++) {
+      for (let start = 0; start + pattern_length <= subject.length;
+           start += 3) {
+        const pattern = subject.substring(start, start + pattern_length);
+        for (const from of [0, 1, 17]) {
+          assertEquals(naiveIndexOf(subject, pattern, from),
+                       subject.indexOf(pattern, from));
+        }
+        // A pattern that differs from the subject in the middle only.
+        if (pattern_length > 2) {
+          const other = pattern[0] + 'x'.repeat(pattern_length - 2) +
+                        pattern[pattern_length - 1];
+          assertEquals(naiveIndexOf(subject, other, 0),
+                       subject.indexOf(other));
+        }
+      }
+    }
+  }
+}
+
+test('abcabd', '');
+test('aab', '');
+test('abcabd', '\u1234');
+test(' a b', '\u1234');
+test('ab\u0000', '\u1234');
+
+// Equality of one-byte and two-byte strings with the same contents.
+const one_byte = 'abcdefghijklmnopqrstuvwxyz'.repeat(3);
+const two_byte = ('\u1234' + one_byte).substring(1);
+assertTrue(one_byte === two_byte);
+for (let i = 0; i < one_byte.length; i++) {
+  const changed = ('\u1234' + one_byte.substring(0, i) + '!' +
+                   one_byte.substring(i + 1)).substring(1);
+  assertFalse(one_byte === changed);
+}
@@ -0,0 +1,93 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// memory.copy and memory.fill with small constant sizes are emitted inline;
+// check them against the generic semantics.
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const kSizes = [1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65];
+
+function instantiate() {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1, false);
+  builder.exportMemoryAs('memory');
+  for (const size of kSizes) {
+    builder.addFunction('copy' + size, kSig_v_ii)
+        .addBody([
+          kExprLocalGet, 0,  // Dest.
+          kExprLocalGet, 1,  // Source.
+          ...wasmI32Const(size),
+          kNumericPrefix, kExprMemoryCopy, 0, 0
+        ])
+        .exportFunc();
+    builder.addFunction('fill' + size, kSig_v_ii)
+        .addBody([
+          kExprLocalGet, 0,  // Dest.
+          kExprLocalGet, 1,  // Value.
+          ...wasmI32Const(size),
+          kNumericPrefix, kExprMemoryFill, 0
+        ])
+        .exportFunc();
+  }
+  return builder.instantiate();
+}
+
+const instance = instantiate();
+const exports = instance.exports;
+const memory = new Uint8Array(exports.memory.buffer);
+
+function reset() {
+  for (let i = 0; i < 256; ++i) memory[i] = i;
+}
+
+(function TestInlineMemoryCopy() {
+  print(arguments.callee.name);
+  for (const size of kSizes) {
+    // Disjoint, overlapping forwards and overlapping backwards.
+    for (const [dst, src] of [[128, 0], [10, 3], [3, 10]]) {
+      reset();
+      const expected = memory.slice(0, 256);
+      expected.copyWithin(dst, src, src + size);
+      exports['copy' + size](dst, src);
+      assertEquals(expected, memory.slice(0, 256));
+    }
+  }
+})();
+
+(function TestInlineMemoryFill() {
+  print(arguments.callee.name);
+  for (const size of kSizes) {
+    reset();
+    const expected = memory.slice(0, 256);
+    expected.fill(0xAB, 5, 5 + size);
+    // Only the low byte of the value is used.
+    exports['fill' + size](5, 0x12AB);
+    assertEquals(expected, memory.slice(0, 256));
+  }
+})();
+
+(function TestInlineOutOfBounds() {
+  print(arguments.callee.name);
+  for (const size of kSizes) {
+    const last = kPageSize - size;
+    reset();
+    memory[last] = 42;
+    // In-bounds accesses right at the end of memory.
+    exports['copy' + size](0, last);
+    assertEquals(42, memory[0]);
+    exports['fill' + size](last, 7);
+    assertEquals(7, memory[kPageSize - 1]);
+
+    // Out-of-bounds accesses trap without writing anything.
+    reset();
+    memory[kPageSize - 1] = 0;
+    assertTraps(kTrapMemOutOfBounds, () => exports['copy' + size](0, last + 1));
+    assertTraps(kTrapMemOutOfBounds, () => exports['copy' + size](last + 1, 0));
+    assertTraps(kTrapMemOutOfBounds, () => exports['fill' + size](last + 1, 1));
+    assertTraps(kTrapMemOutOfBounds, () => exports['copy' + size](-1, 0));
+    assertEquals(0, memory[0]);
+    assertEquals(0, memory[kPageSize - 1]);
+  }
+})();
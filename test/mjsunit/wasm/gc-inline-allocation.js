@@ -0,0 +1,59 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-wasm-gc --wasm-inline-allocation --no-liftoff
+// Flags: --expose-gc
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function TestInlineStructAllocation() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let struct = builder.addStruct(
+      [makeField(kWasmI32, false), makeField(wasmOptRefType(0), false)]);
+
+  // Builds a linked list of {n} structs holding the values n-1..0.
+  builder.addFunction('build', makeSig([kWasmI32], [wasmOptRefType(struct)]))
+      .addLocals(wasmOptRefType(struct), 1)
+      .addBody([
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+          kExprLocalGet, 1,
+          kGCPrefix, kExprRttCanon, struct,
+          kGCPrefix, kExprStructNewWithRtt, struct,
+          kExprLocalSet, 1,
+          kExprLocalGet, 0, kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 1
+      ])
+      .exportFunc();
+
+  // Sums up the values of all structs in the list.
+  builder.addFunction('sum', makeSig([wasmOptRefType(struct)], [kWasmI32]))
+      .addLocals(kWasmI32, 1)
+      .addBody([
+        kExprBlock, kWasmVoid,
+          kExprLoop, kWasmVoid,
+            kExprLocalGet, 0, kExprRefIsNull, kExprBrIf, 1,
+            kExprLocalGet, 1,
+            kExprLocalGet, 0, kGCPrefix, kExprStructGet, struct, 0,
+            kExprI32Add, kExprLocalSet, 1,
+            kExprLocalGet, 0, kGCPrefix, kExprStructGet, struct, 1,
+            kExprLocalSet, 0,
+            kExprBr, 0,
+          kExprEnd,
+        kExprEnd,
+        kExprLocalGet, 1
+      ])
+      .exportFunc();
+
+  let instance = builder.instantiate();
+  // Allocate enough structs to exhaust the linear allocation area several
+  // times, so that both the inline path and the builtin fallback are taken.
+  const kLength = 100000;
+  let list = instance.exports.build(kLength);
+  gc();
+  assertEquals(((kLength - 1) * kLength / 2) | 0, instance.exports.sum(list));
+  assertEquals(0, instance.exports.sum(instance.exports.build(1)));
+})();
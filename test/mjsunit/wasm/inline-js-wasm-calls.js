@@ -0,0 +1,97 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Inlining of JS->Wasm calls is on by default; check that optimized callers
+// still convert arguments and results correctly.
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+builder.addFunction('add', kSig_i_ii)
+    .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Add])
+    .exportFunc();
+builder.addFunction('mul_f32', makeSig([kWasmF32, kWasmF32], [kWasmF32]))
+    .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprF32Mul])
+    .exportFunc();
+builder.addFunction('trap', kSig_i_v)
+    .addBody([kExprUnreachable])
+    .exportFunc();
+const exports = builder.instantiate().exports;
+
+(function TestInlinedI32Call() {
+  print(arguments.callee.name);
+  function caller(a, b) {
+    return exports.add(a, b);
+  }
+  %PrepareFunctionForOptimization(caller);
+  assertEquals(3, caller(1, 2));
+  assertEquals(3, caller(1, 2));
+  %OptimizeFunctionOnNextCall(caller);
+  assertEquals(7, caller(3, 4));
+  assertEquals(-2, caller(0x7fffffff, 0x7fffffff));
+  // Non-number arguments deoptimize but still convert correctly.
+  assertEquals(3, caller('1', {valueOf: () => 2}));
+})();
+
+(function TestInlinedF32Call() {
+  print(arguments.callee.name);
+  function caller(a, b) {
+    return exports.mul_f32(a, b);
+  }
+  %PrepareFunctionForOptimization(caller);
+  assertEquals(6, caller(2, 3));
+  %OptimizeFunctionOnNextCall(caller);
+  assertEquals(Math.fround(Math.fround(1.1) * Math.fround(1.1)),
+               caller(1.1, 1.1));
+})();
+
+(function TestInlinedArityMismatch() {
+  print(arguments.callee.name);
+  function caller(a) {
+    return exports.add(a) + exports.add(a, 1, 2);
+  }
+  %PrepareFunctionForOptimization(caller);
+  assertEquals(11, caller(5));
+  %OptimizeFunctionOnNextCall(caller);
+  assertEquals(11, caller(5));
+})();
+
+(function TestInlinedTrap() {
+  print(arguments.callee.name);
+  function caller() {
+    try {
+      return exports.trap();
+    } catch (e) {
+      return e instanceof WebAssembly.RuntimeError;
+    }
+  }
+  %PrepareFunctionForOptimization(caller);
+  assertTrue(caller());
+  %OptimizeFunctionOnNextCall(caller);
+  assertTrue(caller());
+})();
+
+(function TestAsmJsNotAffected() {
+  print(arguments.callee.name);
+  function Module() {
+    'use asm';
+    function add(a, b) {
+      a = a | 0;
+      b = b | 0;
+      return (a + b) | 0;
+    }
+    return {add: add};
+  }
+  const add = Module().add;
+  function caller(a, b) {
+    return add(a, b);
+  }
+  %PrepareFunctionForOptimization(caller);
+  assertEquals(3, caller(1, 2));
+  %OptimizeFunctionOnNextCall(caller);
+  assertEquals(3, caller(1, 2));
+  assertEquals(1, caller(undefined, 1));
+})();
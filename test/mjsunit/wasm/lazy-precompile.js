@@ -0,0 +1,38 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-lazy-compilation --wasm-lazy-precompile
+// Flags: --experimental-wasm-return-call
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function testPrecompileDirectCallees() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addImport('mod', 'log', kSig_v_i);
+  const leaf = builder.addFunction('leaf', kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add]);
+  const tail = builder.addFunction('tail', kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprReturnCall, leaf.index]);
+  const middle = builder.addFunction('middle', kSig_i_i)
+      .addBody([
+        kExprLocalGet, 0, kExprCallFunction, 0,  // log
+        kExprLocalGet, 0, kExprCallFunction, tail.index,
+        kExprCallFunction, leaf.index
+      ]);
+  builder.addFunction('main', kSig_i_i)
+      .addBody([
+        kExprLocalGet, 0, kExprCallFunction, middle.index,
+        kExprLocalGet, 0, kExprCallFunction, middle.index,
+        kExprI32Add
+      ])
+      .exportFunc();
+
+  const logged = [];
+  const instance =
+      builder.instantiate({mod: {log: value => logged.push(value)}});
+  assertEquals(2 * (3 + 2), instance.exports.main(3));
+  assertEquals([3, 3], logged);
+  assertEquals(2 * (10 + 2), instance.exports.main(10));
+})();
@@ -0,0 +1,54 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-loop-locals-in-registers --liftoff --no-wasm-tier-up
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Locals which are constants or share a register with another value at the
+// loop header must still get independent values in the loop body.
+const builder = new WasmModuleBuilder();
+builder.addFunction('main', kSig_i_i)
+    .addLocals(kWasmI32, 2)  // a (1), b (2)
+    .addLocals(kWasmI64, 1)  // c (3)
+    .addLocals(kWasmF64, 1)  // d (4)
+    .addBody([
+      ...wasmI32Const(7), kExprLocalSet, 1,               // a = 7
+      kExprLocalGet, 0, kExprLocalSet, 2,                 // b = n
+      ...wasmI64Const(0), kExprLocalSet, 3,               // c = 0
+      ...wasmF64Const(0.5), kExprLocalSet, 4,             // d = 0.5
+      kExprLoop, kWasmVoid,                               // loop
+        kExprLocalGet, 1, ...wasmI32Const(1), kExprI32Add,
+        kExprLocalSet, 1,                                 // a = a + 1
+        kExprLocalGet, 2, kExprLocalGet, 1, kExprI32Add,
+        kExprLocalSet, 2,                                 // b = b + a
+        kExprLocalGet, 3, kExprLocalGet, 1, kExprI64SConvertI32,
+        kExprI64Add, kExprLocalSet, 3,                    // c = c + a
+        kExprLocalGet, 4, ...wasmF64Const(1.5), kExprF64Add,
+        kExprLocalSet, 4,                                 // d = d + 1.5
+        kExprLocalGet, 0, ...wasmI32Const(1), kExprI32Sub,
+        kExprLocalTee, 0,                                 // n = n - 1
+        kExprBrIf, 0,                                     // continue if n
+      kExprEnd,                                           // end
+      kExprLocalGet, 2,
+      kExprLocalGet, 3, kExprI32ConvertI64, kExprI32Add,
+      kExprLocalGet, 4, kExprI32SConvertF64, kExprI32Add  // b + c + d
+    ])
+    .exportFunc();
+const instance = builder.instantiate();
+
+function expected(n) {
+  let a = 7, b = n, c = 0, d = 0.5;
+  for (; n > 0; --n) {
+    a += 1;
+    b += a;
+    c += a;
+    d += 1.5;
+  }
+  return b + c + Math.trunc(d);
+}
+
+for (let n of [1, 2, 10, 100]) {
+  assertEquals(expected(n), instance.exports.main(n));
+}
@@ -87,6 +87,27 @@ function BasicMemory64Tests(num_pages) {
 //  BasicMemory64Tests(num_pages);
 //})();
 
+(function TestHugeIndexOutOfBounds() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  builder.addMemory64(1, 1, false);
+
+  builder.addFunction('load', makeSig([kWasmI64], [kWasmI32]))
+      .addBody([
+        kExprLocalGet, 0,       // local.get 0
+        kExprI32LoadMem, 0, 0,  // i32.load_mem align=1 offset=0
+      ])
+      .exportFunc();
+
+  let load = builder.instantiate().exports.load;
+  assertEquals(0, load(0n));
+  // Indexes beyond 4GB are not covered by guard regions and need to trap.
+  assertTraps(kTrapMemOutOfBounds, () => load(1n << 32n));
+  assertTraps(kTrapMemOutOfBounds, () => load((1n << 32n) + 16n));
+  assertTraps(kTrapMemOutOfBounds, () => load(1n << 40n));
+  assertTraps(kTrapMemOutOfBounds, () => load(-4n));
+})();
+
 (function TestGrow64() {
   print(arguments.callee.name);
   let builder = new WasmModuleBuilder();
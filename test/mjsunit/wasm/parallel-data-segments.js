@@ -0,0 +1,36 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-parallel-data-segments
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function TestLargeDataSegment() {
+  print(arguments.callee.name);
+  // Larger than two chunks, and not a multiple of the chunk size.
+  const kSize = 3 * 1024 * 1024 + 17;
+  const data = new Array(kSize);
+  for (let i = 0; i < kSize; ++i) data[i] = (i * 7) & 0xFF;
+
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(64, 64, false);
+  builder.exportMemoryAs('memory');
+  builder.addDataSegment(16, data);
+  // A later overlapping segment must still win.
+  builder.addDataSegment(1024 * 1024, [1, 2, 3]);
+  const instance = builder.instantiate();
+
+  const memory = new Uint8Array(instance.exports.memory.buffer);
+  for (let i = 0; i < 16; ++i) assertEquals(0, memory[i]);
+  for (let i = 0; i < kSize; ++i) {
+    const offset = 16 + i;
+    if (offset >= 1024 * 1024 && offset < 1024 * 1024 + 3) continue;
+    if (memory[offset] != data[i]) {
+      assertEquals(data[i], memory[offset], 'offset ' + offset);
+    }
+  }
+  const kOverlap = 1024 * 1024;
+  assertEquals([1, 2, 3], Array.from(memory.slice(kOverlap, kOverlap + 3)));
+  assertEquals(0, memory[16 + kSize]);
+})();
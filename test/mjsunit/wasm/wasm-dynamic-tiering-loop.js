@@ -0,0 +1,38 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --wasm-dynamic-tiering --liftoff
+// Flags: --no-wasm-tier-up --no-stress-opt
+
+// This test busy-waits for tier-up to be complete, hence it does not work in
+// predictable mode where we only have a single thread.
+// Flags: --no-predictable
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+builder.addFunction('loop', kSig_v_i)
+    .addBody([
+      kExprLoop, kWasmVoid,                       // loop
+        kExprLocalGet, 0, kExprI32Const, 1,       // -
+        kExprI32Sub, kExprLocalTee, 0,            // i = i - 1
+        kExprBrIf, 0,                             // continue while i != 0
+      kExprEnd                                    // end
+    ])
+    .exportFunc();
+builder.addFunction('straight', kSig_i_v)
+    .addBody(wasmI32Const(42))
+    .exportFunc();
+
+let instance = builder.instantiate();
+
+// A single call is not enough to make a function hot, but loop back edges in
+// a single call are.
+instance.exports.loop(100);
+assertEquals(42, instance.exports.straight());
+
+// Busy waiting until the function with the loop is tiered up.
+while (%IsLiftoffFunction(instance.exports.loop)) {
+}
+assertTrue(%IsLiftoffFunction(instance.exports.straight));
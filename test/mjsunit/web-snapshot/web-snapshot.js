@@ -188,6 +188,21 @@ function takeAndUseWebSnapshot(createObjects, exports) {
   assertFalse(re.test('ac'));
 })();
 
+(function TestDate() {
+  function createObjects() {
+    globalThis.foo = {
+      date: new Date(Date.UTC(2021, 6, 15, 12, 30, 5, 11)),
+      invalid: new Date(NaN),
+    };
+  }
+  const { foo } = takeAndUseWebSnapshot(createObjects, ['foo']);
+  assertTrue(foo.date instanceof Date);
+  assertEquals('2021-07-15T12:30:05.011Z', foo.date.toISOString());
+  assertEquals(2021, foo.date.getUTCFullYear());
+  assertTrue(foo.invalid instanceof Date);
+  assertEquals(NaN, foo.invalid.getTime());
+})();
+
 (function TestObjectReferencingObject() {
   function createObjects() {
     globalThis.foo = {
@@ -72,7 +72,7 @@ class CompilerDispatcherTest : public TestWithNativeContext {
 
   static base::Optional<CompilerDispatcher::JobId> EnqueueUnoptimizedCompileJob(
       CompilerDispatcher* dispatcher, Isolate* isolate,
-      Handle<SharedFunctionInfo> shared) {
+      Handle<SharedFunctionInfo> shared, bool is_likely_called = false) {
     UnoptimizedCompileState state(isolate);
     std::unique_ptr<ParseInfo> outer_parse_info =
         test::OuterParseInfoForShared(isolate, shared, &state);
@@ -102,7 +102,7 @@ class CompilerDispatcherTest : public TestWithNativeContext {
             shared->function_literal_id(), nullptr);
 
     return dispatcher->Enqueue(outer_parse_info.get(), function_name,
-                               function_literal);
+                               function_literal, is_likely_called);
   }
 
  protected:
@@ -518,6 +518,49 @@ TEST_F(CompilerDispatcherTest, IdleTaskSmallIdleTime) {
   dispatcher.AbortAll();
 }
 
+TEST_F(CompilerDispatcherTest, LikelyCalledJobsRunFirst) {
+  MockPlatform platform;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+
+  Handle<SharedFunctionInfo> shared_1 =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+  Handle<SharedFunctionInfo> shared_2 =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+  Handle<SharedFunctionInfo> shared_3 =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+
+  base::Optional<CompilerDispatcher::JobId> job_id_1 =
+      EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared_1);
+  base::Optional<CompilerDispatcher::JobId> job_id_2 =
+      EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared_2, true);
+  base::Optional<CompilerDispatcher::JobId> job_id_3 =
+      EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared_3);
+
+  // The likely called job comes first, the others in enqueuing order.
+  {
+    base::MutexGuard lock(&dispatcher.mutex_);
+    ASSERT_EQ(dispatcher.pending_background_jobs_.size(), 3u);
+    auto it = dispatcher.pending_background_jobs_.begin();
+    ASSERT_EQ((*it++)->id, *job_id_2);
+    ASSERT_EQ((*it++)->id, *job_id_1);
+    ASSERT_EQ((*it++)->id, *job_id_3);
+  }
+
+  dispatcher.RegisterSharedFunctionInfo(*job_id_1, *shared_1);
+  dispatcher.RegisterSharedFunctionInfo(*job_id_2, *shared_2);
+  dispatcher.RegisterSharedFunctionInfo(*job_id_3, *shared_3);
+
+  platform.RunWorkerTasksAndBlock(V8::GetCurrentPlatform());
+  platform.RunIdleTask(1000.0, 0.0);
+
+  ASSERT_TRUE(shared_1->is_compiled());
+  ASSERT_TRUE(shared_2->is_compiled());
+  ASSERT_TRUE(shared_3->is_compiled());
+  ASSERT_FALSE(platform.IdleTaskPending());
+  ASSERT_FALSE(platform.WorkerTasksPending());
+  dispatcher.AbortAll();
+}
+
 TEST_F(CompilerDispatcherTest, IdleTaskException) {
   MockPlatform platform;
   CompilerDispatcher dispatcher(i_isolate(), &platform, 50);
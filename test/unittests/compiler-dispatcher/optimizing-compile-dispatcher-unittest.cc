@@ -15,6 +15,7 @@
 #include "src/heap/local-heap.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/parse-info.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-helpers.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -64,6 +65,15 @@ class BlockingCompilationJob : public OptimizedCompilationJob {
   base::Semaphore semaphore_;
 };
 
+Handle<JSFunction> CompileFunctionWithFeedback(Isolate* isolate,
+                                               Handle<JSFunction> function) {
+  IsCompiledScope is_compiled_scope;
+  CHECK(Compiler::Compile(isolate, function, Compiler::CLEAR_EXCEPTION,
+                          &is_compiled_scope));
+  JSFunction::EnsureFeedbackVector(function, &is_compiled_scope);
+  return function;
+}
+
 }  // namespace
 
 TEST_F(OptimizingCompileDispatcherTest, Construct) {
@@ -97,5 +107,57 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, HotterJobsAreCompiledFirst) {
+  FlagScope<bool> block_recompilation(&FLAG_block_concurrent_recompilation,
+                                      true);
+  Handle<JSFunction> cold = CompileFunctionWithFeedback(
+      i_isolate(), RunJS<JSFunction>("(function cold() {})"));
+  Handle<JSFunction> hot = CompileFunctionWithFeedback(
+      i_isolate(), RunJS<JSFunction>("(function hot() {})"));
+  cold->feedback_vector().set_invocation_count(1);
+  hot->feedback_vector().set_invocation_count(1000);
+
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  BlockingCompilationJob* cold_job =
+      new BlockingCompilationJob(i_isolate(), cold);
+  BlockingCompilationJob* hot_job =
+      new BlockingCompilationJob(i_isolate(), hot);
+  dispatcher.QueueForOptimization(cold_job);
+  dispatcher.QueueForOptimization(hot_job);
+
+  EXPECT_EQ(hot_job, dispatcher.NextInput(nullptr));
+  EXPECT_EQ(cold_job, dispatcher.NextInput(nullptr));
+  EXPECT_EQ(nullptr, dispatcher.NextInput(nullptr));
+  delete cold_job;
+  delete hot_job;
+  dispatcher.Stop();
+}
+
+TEST_F(OptimizingCompileDispatcherTest, CancelStaleJobs) {
+  FlagScope<bool> block_recompilation(&FLAG_block_concurrent_recompilation,
+                                      true);
+  Handle<JSFunction> live = CompileFunctionWithFeedback(
+      i_isolate(), RunJS<JSFunction>("(function live() {})"));
+  Handle<JSFunction> stale = CompileFunctionWithFeedback(
+      i_isolate(), RunJS<JSFunction>("(function stale() {})"));
+
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  BlockingCompilationJob* live_job =
+      new BlockingCompilationJob(i_isolate(), live);
+  dispatcher.QueueForOptimization(live_job);
+  dispatcher.QueueForOptimization(
+      new BlockingCompilationJob(i_isolate(), stale));
+  EXPECT_EQ(0, dispatcher.CancelStaleJobs());
+
+  stale->shared().DisableOptimization(BailoutReason::kNeverOptimize);
+  EXPECT_EQ(1, dispatcher.CancelStaleJobs());
+  EXPECT_EQ(0, dispatcher.CancelStaleJobs());
+
+  EXPECT_EQ(live_job, dispatcher.NextInput(nullptr));
+  EXPECT_EQ(nullptr, dispatcher.NextInput(nullptr));
+  delete live_job;
+  dispatcher.Stop();
+}
+
 }  // namespace internal
 }  // namespace v8
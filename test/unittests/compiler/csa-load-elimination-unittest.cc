@@ -6,6 +6,7 @@
 
 #include "src/compiler/graph-reducer.h"
 #include "src/compiler/js-graph.h"
+#include "src/compiler/linkage.h"
 #include "src/compiler/machine-operator-reducer.h"
 #include "src/compiler/node-matchers.h"
 #include "src/compiler/node.h"
@@ -150,6 +151,65 @@ TEST_F(CsaLoadEliminationTest, Uint8_constant) {
 
 #undef SETUP_SIMPLE_TEST
 
+TEST_F(CsaLoadEliminationTest, OffHeapStoreKeepsState) {
+  Node* object = graph()->NewNode(common()->Parameter(0), graph()->start());
+  Node* offset = constant(5);
+  Node* value = param1();
+  Node* control = graph()->start();
+  ObjectAccess access(MachineType::Int32(), kNoWriteBarrier);
+
+  Node* store =
+      graph()->NewNode(simplified()->StoreToObject(access), object, offset,
+                       value, graph()->start(), control);
+  Node* top_address = jsgraph()->ExternalConstant(
+      ExternalReference::new_space_allocation_top_address(isolate()));
+  Node* raw_store = graph()->NewNode(
+      machine()->Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                                           kNoWriteBarrier)),
+      top_address, jsgraph()->IntPtrConstant(0), jsgraph()->IntPtrConstant(0),
+      store, control);
+  Node* load = graph()->NewNode(simplified()->LoadFromObject(access), object,
+                                offset, raw_store, control);
+  Node* ret = graph()->NewNode(common()->Return(0), load, load, control);
+  graph()->end()->InsertInput(zone(), 0, ret);
+
+  reducer()->ReduceGraph();
+
+  EXPECT_EQ(ret->InputAt(0), value);
+}
+
+// Allocation runtime calls can trigger a full GC, which rewrites fields in
+// place (e.g. weak reference clearing or bytecode flushing).
+TEST_F(CsaLoadEliminationTest, AllocationRuntimeCallKillsState) {
+  Node* object = graph()->NewNode(common()->Parameter(0), graph()->start());
+  Node* offset = constant(5);
+  Node* value = param1();
+  Node* control = graph()->start();
+  ObjectAccess access(MachineType::Int32(), kNoWriteBarrier);
+
+  Node* store =
+      graph()->NewNode(simplified()->StoreToObject(access), object, offset,
+                       value, graph()->start(), control);
+  auto call_descriptor = Linkage::GetRuntimeCallDescriptor(
+      zone(), Runtime::kAllocateInYoungGeneration, 2, Operator::kNoProperties,
+      CallDescriptor::kNoFlags);
+  Node* centry = jsgraph()->CEntryStubConstant(1);
+  Node* ref = jsgraph()->ExternalConstant(
+      ExternalReference::Create(Runtime::kAllocateInYoungGeneration));
+  Node* call = graph()->NewNode(
+      common()->Call(call_descriptor), centry, jsgraph()->SmiConstant(16),
+      jsgraph()->SmiConstant(0), ref, jsgraph()->Int32Constant(2),
+      jsgraph()->NoContextConstant(), store, control);
+  Node* load = graph()->NewNode(simplified()->LoadFromObject(access), object,
+                                offset, call, call);
+  Node* ret = graph()->NewNode(common()->Return(0), load, load, call);
+  graph()->end()->InsertInput(zone(), 0, ret);
+
+  reducer()->ReduceGraph();
+
+  EXPECT_EQ(ret->InputAt(0), load);
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
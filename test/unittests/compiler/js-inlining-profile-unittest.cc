@@ -0,0 +1,45 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/js-inlining-profile.h"
+
+#include <sstream>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+TEST(InliningProfileTest, EntryBlockCountsAreSummed) {
+  std::istringstream log(
+      "shared-library,/usr/lib/libc.so,0x1000,0x2000,0\n"
+      "block,hot,0,1000\n"
+      "block,hot,1,5\n"
+      "block,cold,0,3\n"
+      "builtin_hash,hot,0\n"
+      "block,hot,0,500\n");
+  InliningProfile profile(log);
+  EXPECT_EQ(2u, profile.size());
+  EXPECT_EQ(1500, profile.GetInvocationCount("hot"));
+  EXPECT_EQ(3, profile.GetInvocationCount("cold"));
+  EXPECT_EQ(0, profile.GetInvocationCount("unknown"));
+}
+
+TEST(InliningProfileTest, MalformedLinesAreIgnored) {
+  std::istringstream log(
+      "block\n"
+      "block,f\n"
+      "block,f,x,10\n"
+      "block,f,0\n"
+      "block,f,0,y\n"
+      "block,f,0,7\n");
+  InliningProfile profile(log);
+  EXPECT_EQ(1u, profile.size());
+  EXPECT_EQ(7, profile.GetInvocationCount("f"));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
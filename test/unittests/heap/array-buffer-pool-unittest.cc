@@ -0,0 +1,96 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/array-buffer-pool.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+class CountingAllocator final : public v8::ArrayBuffer::Allocator {
+ public:
+  void* Allocate(size_t length) override {
+    allocations_++;
+    return calloc(length, 1);
+  }
+  void* AllocateUninitialized(size_t length) override {
+    allocations_++;
+    return malloc(length);
+  }
+  void Free(void* data, size_t) override {
+    frees_++;
+    free(data);
+  }
+
+  size_t allocations() const { return allocations_; }
+  size_t frees() const { return frees_; }
+
+ private:
+  size_t allocations_ = 0;
+  size_t frees_ = 0;
+};
+
+bool IsZeroed(void* buffer, size_t length) {
+  uint8_t* bytes = static_cast<uint8_t*>(buffer);
+  for (size_t i = 0; i < length; i++) {
+    if (bytes[i] != 0) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST(ArrayBufferPoolTest, RecyclesWithinSizeClass) {
+  CountingAllocator allocator;
+  {
+    ArrayBufferPool pool(&allocator, nullptr, 1 * MB);
+    void* first = pool.Allocate(21 * KB, InitializedFlag::kUninitialized);
+    memset(first, 0xAB, 21 * KB);
+    pool.Release(first, 21 * KB);
+    // 23KB falls into the same 24KB size class.
+    void* second = pool.Allocate(23 * KB, InitializedFlag::kZeroInitialized);
+    EXPECT_EQ(first, second);
+    EXPECT_TRUE(IsZeroed(second, 23 * KB));
+    EXPECT_EQ(1u, allocator.allocations());
+
+    ArrayBufferPool::Stats stats = pool.GetStats();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(24 * KB, stats.zero_fill_avoided_bytes);
+    EXPECT_EQ(0u, stats.cached_bytes);
+
+    // A different size class does not reuse the buffer.
+    pool.Release(second, 23 * KB);
+    void* third = pool.Allocate(32 * KB, InitializedFlag::kZeroInitialized);
+    EXPECT_NE(second, third);
+    EXPECT_EQ(2u, allocator.allocations());
+    pool.Release(third, 32 * KB);
+    EXPECT_EQ(56 * KB, pool.GetStats().cached_bytes);
+  }
+  EXPECT_EQ(2u, allocator.frees());
+}
+
+TEST(ArrayBufferPoolTest, RespectsCacheLimit) {
+  CountingAllocator allocator;
+  ArrayBufferPool pool(&allocator, nullptr, 64 * KB);
+  void* first = pool.Allocate(64 * KB, InitializedFlag::kUninitialized);
+  void* second = pool.Allocate(64 * KB, InitializedFlag::kUninitialized);
+  pool.Release(first, 64 * KB);
+  EXPECT_EQ(0u, allocator.frees());
+  pool.Release(second, 64 * KB);
+  EXPECT_EQ(1u, allocator.frees());
+  EXPECT_EQ(64 * KB, pool.GetStats().cached_bytes);
+  pool.Flush();
+  EXPECT_EQ(2u, allocator.frees());
+  EXPECT_EQ(0u, pool.GetStats().cached_bytes);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -331,5 +331,37 @@ TEST(CppgcWorkListTest, MergeGlobalPool) {
   EXPECT_TRUE(worklist2.IsEmpty());
 }
 
+TEST(CppgcWorkListTest, ShareWorkIfGlobalPoolIsEmpty) {
+  TestWorklist worklist;
+  TestWorklist::Local worklist_local1(&worklist);
+  TestWorklist::Local worklist_local2(&worklist);
+  SomeObject objects[10];
+  // A single entry is never shared.
+  worklist_local1.Push(&objects[0]);
+  EXPECT_FALSE(worklist_local1.ShareWorkIfGlobalPoolIsEmpty());
+  EXPECT_TRUE(worklist.IsEmpty());
+  for (size_t i = 1; i < 10; i++) {
+    worklist_local1.Push(&objects[i]);
+  }
+  EXPECT_TRUE(worklist_local1.ShareWorkIfGlobalPoolIsEmpty());
+  EXPECT_EQ(1U, worklist.Size());
+  EXPECT_EQ(5U, worklist_local1.PushSegmentSize());
+  // Nothing is shared while the global pool still holds work.
+  EXPECT_FALSE(worklist_local1.ShareWorkIfGlobalPoolIsEmpty());
+  // The oldest half goes to the other local worklist.
+  SomeObject* retrieved = nullptr;
+  for (size_t i = 5; i > 0; i--) {
+    EXPECT_TRUE(worklist_local2.Pop(&retrieved));
+    EXPECT_EQ(&objects[i - 1], retrieved);
+  }
+  EXPECT_FALSE(worklist_local2.Pop(&retrieved));
+  for (size_t i = 10; i > 5; i--) {
+    EXPECT_TRUE(worklist_local1.Pop(&retrieved));
+    EXPECT_EQ(&objects[i - 1], retrieved);
+  }
+  EXPECT_FALSE(worklist_local1.Pop(&retrieved));
+  EXPECT_TRUE(worklist.IsEmpty());
+}
+
 }  // namespace base
 }  // namespace heap
@@ -240,5 +240,49 @@ TEST_F(CompactorTest, InteriorSlotToNextObject) {
   EXPECT_EQ(references[1], holder->objects[1]->other);
 }
 
+TEST_F(CompactorTest, FragmentedSpaceIsCompacted) {
+  heap()->DisableHeapGrowingForTesting();
+  static constexpr size_t kObjectsPerPage =
+      kPageSize / (sizeof(CompactableGCed) + sizeof(HeapObjectHeader));
+  static constexpr size_t kNumObjects = 16 * kObjectsPerPage;
+  static constexpr size_t kLiveObjectInterval = 16;
+  Persistent<CompactableGCed> head =
+      MakeGarbageCollected<CompactableGCed>(GetAllocationHandle());
+  CompactableGCed* tail = head.Get();
+  for (size_t i = 1; i < kNumObjects; ++i) {
+    CompactableGCed* object =
+        MakeGarbageCollected<CompactableGCed>(GetAllocationHandle());
+    if (i % kLiveObjectInterval == 0) {
+      tail->other = object;
+      tail = object;
+    }
+  }
+  tail = nullptr;
+  // A garbage collection without compaction leaves the space fragmented.
+  heap()->CollectGarbage(GarbageCollector::Config::PreciseAtomicConfig());
+  const BaseSpace* space =
+      heap()->raw_heap().CustomSpace(CompactableCustomSpace::kSpaceIndex);
+  const size_t pages_before_compaction = space->size();
+
+  compactor().InitializeIfShouldCompact(
+      GarbageCollector::Config::MarkingType::kIncremental,
+      GarbageCollector::Config::StackState::kNoHeapPointers);
+  EXPECT_TRUE(compactor().IsEnabledForTesting());
+  CompactableGCed::g_destructor_callcount = 0u;
+  heap()->StartIncrementalGarbageCollection(
+      GarbageCollector::Config::PreciseIncrementalConfig());
+  EndGC();
+
+  EXPECT_TRUE(space->is_compacted());
+  EXPECT_LT(space->size(), pages_before_compaction);
+  EXPECT_EQ(0u, CompactableGCed::g_destructor_callcount);
+  size_t live_objects = 0;
+  for (CompactableGCed* object = head.Get(); object;
+       object = object->other.Get()) {
+    live_objects++;
+  }
+  EXPECT_EQ(1 + (kNumObjects - 1) / kLiveObjectInterval, live_objects);
+}
+
 }  // namespace internal
 }  // namespace cppgc
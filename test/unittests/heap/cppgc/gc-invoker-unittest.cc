@@ -112,6 +112,32 @@ TEST(GCInvokerTest, ConservativeGCIsInvokedAsPreciseGCViaPlatform) {
   platform.RunAllForegroundTasks();
 }
 
+TEST(GCInvokerTest, MinorGCWithStackIsScheduledAsPreciseGCViaPlatform) {
+  testing::TestPlatform platform;
+  MockGarbageCollector gc;
+  // Minor GCs cannot scan the stack even if the heap supports it.
+  GCInvoker invoker(&gc, &platform,
+                    cppgc::Heap::StackSupport::kSupportsConservativeStackScan);
+  GarbageCollector::Config config =
+      GarbageCollector::Config::MinorPreciseAtomicConfig();
+  config.stack_state =
+      GarbageCollector::Config::StackState::kMayContainHeapPointers;
+  EXPECT_CALL(gc, epoch).WillRepeatedly(::testing::Return(0));
+  EXPECT_CALL(gc, CollectGarbage).Times(0);
+  invoker.CollectGarbage(config);
+  ::testing::Mock::VerifyAndClearExpectations(&gc);
+  EXPECT_CALL(gc, epoch).WillRepeatedly(::testing::Return(0));
+  EXPECT_CALL(gc, CollectGarbage(::testing::AllOf(
+                      ::testing::Field(
+                          &GarbageCollector::Config::collection_type,
+                          GarbageCollector::Config::CollectionType::kMinor),
+                      ::testing::Field(
+                          &GarbageCollector::Config::stack_state,
+                          GarbageCollector::Config::StackState::
+                              kNoHeapPointers))));
+  platform.RunAllForegroundTasks();
+}
+
 TEST(GCInvokerTest, IncrementalGCIsStarted) {
   // Since StartIncrementalGarbageCollection doesn't scan the stack, support for
   // conservative stack scanning should not matter.
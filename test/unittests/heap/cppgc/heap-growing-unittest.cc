@@ -174,5 +174,28 @@ TEST(HeapGrowingTest, IncrementalGCFinalized) {
   FakeAllocate(&stats_collector, StatsCollector::kAllocationThresholdBytes);
 }
 
+#if defined(CPPGC_YOUNG_GENERATION)
+TEST(HeapGrowingTest, MinorGCInvoked) {
+  StatsCollector stats_collector(kNoPlatform);
+  MockGarbageCollector gc;
+  cppgc::Heap::ResourceConstraints constraints;
+  // Keep the major GC limits far away.
+  constraints.initial_heap_size_bytes = 100 * kMB;
+  HeapGrowing growing(&gc, &stats_collector, constraints,
+                      cppgc::Heap::MarkingType::kIncrementalAndConcurrent,
+                      cppgc::Heap::SweepingType::kIncrementalAndConcurrent);
+  EXPECT_EQ(HeapGrowing::kYoungGenerationAllocationLimit,
+            growing.limit_for_minor_gc());
+  EXPECT_CALL(gc, CollectGarbage(::testing::_)).Times(0);
+  FakeAllocate(&stats_collector, HeapGrowing::kYoungGenerationAllocationLimit);
+  ::testing::Mock::VerifyAndClearExpectations(&gc);
+  EXPECT_CALL(
+      gc, CollectGarbage(::testing::Field(
+              &GarbageCollector::Config::collection_type,
+              GarbageCollector::Config::CollectionType::kMinor)));
+  FakeAllocate(&stats_collector, 1);
+}
+#endif  // CPPGC_YOUNG_GENERATION
+
 }  // namespace internal
 }  // namespace cppgc
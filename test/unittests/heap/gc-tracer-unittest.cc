@@ -9,6 +9,7 @@
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/heap/gc-tracer.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -186,6 +187,46 @@ TEST_F(GCTracerTest, RegularScope) {
   EXPECT_DOUBLE_EQ(100.0, tracer->current_.scopes[GCTracer::Scope::MC_MARK]);
 }
 
+TEST_F(GCTracerTest, PhaseHistograms) {
+  FlagScope<int> flag_scope(&FLAG_gc_phase_histograms_interval, 2);
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+
+  tracer->Start(MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->AddScopeSample(GCTracer::Scope::MC_MARK, 0.5);
+  tracer->AddScopeSampleBackground(GCTracer::Scope::MC_BACKGROUND_MARKING, 3);
+  tracer->Stop(MARK_COMPACTOR);
+  EXPECT_EQ(1, tracer->phase_histograms_gc_count_);
+  const GCTracer::PhaseHistogram& mark =
+      tracer->phase_histograms_[GCTracer::Scope::MC_MARK];
+  EXPECT_EQ(1, mark.sample_count);
+  EXPECT_DOUBLE_EQ(0.5, mark.total_duration_ms);
+  EXPECT_EQ(1, mark.buckets[GCTracer::PhaseHistogramBucket(0.5)]);
+  EXPECT_EQ(0, tracer->phase_histograms_[GCTracer::Scope::MC_SWEEP]
+                   .sample_count);
+  EXPECT_DOUBLE_EQ(3.0, tracer->phase_histograms_background_ms_);
+
+  tracer->Start(MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->AddScopeSample(GCTracer::Scope::MC_MARK, 0.5);
+  tracer->Stop(MARK_COMPACTOR);
+  // The histograms are reported and reset after two collections.
+  EXPECT_EQ(0, tracer->phase_histograms_gc_count_);
+  EXPECT_EQ(0, mark.sample_count);
+  EXPECT_DOUBLE_EQ(0.0, tracer->phase_histograms_background_ms_);
+}
+
+TEST_F(GCTracerTest, PhaseHistogramBucket) {
+  EXPECT_EQ(0, GCTracer::PhaseHistogramBucket(0));
+  EXPECT_EQ(0, GCTracer::PhaseHistogramBucket(0.001));
+  EXPECT_EQ(1, GCTracer::PhaseHistogramBucket(0.002));
+  EXPECT_EQ(1, GCTracer::PhaseHistogramBucket(0.003));
+  EXPECT_EQ(9, GCTracer::PhaseHistogramBucket(1));
+  EXPECT_EQ(GCTracer::kPhaseHistogramBuckets - 1,
+            GCTracer::PhaseHistogramBucket(1e9));
+}
+
 TEST_F(GCTracerTest, IncrementalScope) {
   GCTracer* tracer = i_isolate()->heap()->tracer();
   tracer->ResetForTesting();
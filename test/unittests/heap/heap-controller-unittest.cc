@@ -108,5 +108,19 @@ TEST_F(MemoryControllerTest, OldGenerationAllocationLimit) {
           new_space_capacity, factor, Heap::HeapGrowingMode::kMinimal));
 }
 
+TEST(NewSpaceControllerTest, TargetCapacity) {
+  const size_t kMin = 1 * MB;
+  const size_t kMax = 16 * MB;
+  // 4MB are allocated within the target interval on top of 1MB survivors.
+  EXPECT_EQ(RoundUp(5 * MB, Page::kPageSize),
+            NewSpaceController::TargetCapacity(4.0 * KB, 1024, 1 * MB, kMin,
+                                               kMax));
+  // Low throughput is clamped to the minimum capacity.
+  EXPECT_EQ(kMin, NewSpaceController::TargetCapacity(1.0, 1, 0, kMin, kMax));
+  // High throughput is clamped to the maximum capacity.
+  EXPECT_EQ(kMax, NewSpaceController::TargetCapacity(1.0 * MB, 1000, 0, kMin,
+                                                     kMax));
+}
+
 }  // namespace internal
 }  // namespace v8
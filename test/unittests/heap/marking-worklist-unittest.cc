@@ -133,5 +133,32 @@ TEST_F(MarkingWorklistTest, ContextWorklistCrossTask) {
   holder.ReleaseContextWorklists();
 }
 
+TEST_F(MarkingWorklistTest, PrefetchBufferVisitsInWorklistOrder) {
+  MarkingWorklists holder;
+  MarkingWorklists::Local worklists(&holder);
+  ReadOnlyRoots roots(i_isolate()->heap());
+  HeapObject objects[] = {roots.undefined_value(), roots.null_value(),
+                          roots.true_value(), roots.false_value()};
+  for (HeapObject object : objects) worklists.Push(object);
+  auto pop = [&worklists](HeapObject* object) {
+    return worklists.Pop(object);
+  };
+  MarkingPrefetchBuffer buffer(2);
+  HeapObject popped_object;
+  // The worklist is LIFO; the buffer must not change that order.
+  EXPECT_TRUE(buffer.Pop(pop, &popped_object));
+  EXPECT_EQ(objects[3], popped_object);
+  EXPECT_FALSE(buffer.IsEmpty());
+  // Objects still held by the buffer go back to the worklist on flush.
+  buffer.Flush([&worklists](HeapObject object) { worklists.Push(object); });
+  EXPECT_TRUE(buffer.IsEmpty());
+  for (int i = 2; i >= 0; i--) {
+    EXPECT_TRUE(buffer.Pop(pop, &popped_object));
+    EXPECT_EQ(objects[i], popped_object);
+  }
+  EXPECT_FALSE(buffer.Pop(pop, &popped_object));
+  EXPECT_TRUE(worklists.IsEmpty());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,49 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/memory-budget.h"
+
+#include "src/common/globals.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+TEST(MemoryBudgetTest, UpdateTracksContributions) {
+  MemoryBudget budget(10 * MB, 20 * MB);
+  budget.Update(0, 4 * MB);
+  budget.Update(0, 3 * MB);
+  EXPECT_EQ(7 * MB, budget.used_in_bytes());
+  budget.Update(4 * MB, 1 * MB);
+  EXPECT_EQ(4 * MB, budget.used_in_bytes());
+  budget.Update(3 * MB, 0);
+  budget.Update(1 * MB, 0);
+  EXPECT_EQ(0u, budget.used_in_bytes());
+}
+
+TEST(MemoryBudgetTest, PressureLevels) {
+  MemoryBudget budget(10 * MB, 20 * MB);
+  EXPECT_EQ(MemoryBudget::PressureLevel::kNone, budget.CurrentPressureLevel());
+  budget.Update(0, 12 * MB);
+  EXPECT_EQ(MemoryBudget::PressureLevel::kReduceMemory,
+            budget.CurrentPressureLevel());
+  budget.Update(12 * MB, 17 * MB);
+  EXPECT_EQ(MemoryBudget::PressureLevel::kFlushBytecode,
+            budget.CurrentPressureLevel());
+  budget.Update(17 * MB, 21 * MB);
+  EXPECT_EQ(MemoryBudget::PressureLevel::kEvictCompilationCache,
+            budget.CurrentPressureLevel());
+}
+
+TEST(MemoryBudgetTest, ScaleGrowingFactor) {
+  MemoryBudget budget(10 * MB, 20 * MB);
+  EXPECT_DOUBLE_EQ(4.0, budget.ScaleGrowingFactor(4.0, 1.1));
+  budget.Update(0, 15 * MB);
+  EXPECT_DOUBLE_EQ(2.5, budget.ScaleGrowingFactor(4.0, 1.0));
+  budget.Update(15 * MB, 20 * MB);
+  EXPECT_DOUBLE_EQ(1.1, budget.ScaleGrowingFactor(4.0, 1.1));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -7,6 +7,9 @@
 #include "src/heap/object-stats.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/roots/roots-inl.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace v8 {
@@ -33,6 +36,43 @@ TEST(ObjectStats, NoClashWithInstanceTypes) {
 #undef CHECK_REGULARINSTANCE_TYPE
 }
 
+using SampledObjectStatsTest = TestWithIsolate;
+
+TEST_F(SampledObjectStatsTest, CountsOneInSamplingRate) {
+  FlagScope<int> sampling_rate(&FLAG_object_stats_sampling_rate, 3);
+  Map map = ReadOnlyRoots(i_isolate()).fixed_array_map();
+  SampledObjectStats stats;
+  for (int i = 0; i < 9; i++) stats.Sample(map, 16);
+  EXPECT_EQ(3, stats.sampling_rate());
+  EXPECT_EQ(3u, stats.count(FIXED_ARRAY_TYPE));
+  EXPECT_EQ(48u, stats.size(FIXED_ARRAY_TYPE));
+
+  SampledObjectStats other;
+  for (int i = 0; i < 3; i++) other.Sample(map, 16);
+  stats.Merge(other);
+  EXPECT_EQ(4u, stats.count(FIXED_ARRAY_TYPE));
+  EXPECT_EQ(64u, stats.size(FIXED_ARRAY_TYPE));
+
+  // Stats that have not sampled anything yet merge as zeros.
+  SampledObjectStats empty;
+  EXPECT_EQ(0u, empty.count(FIXED_ARRAY_TYPE));
+  stats.Merge(empty);
+  EXPECT_EQ(4u, stats.count(FIXED_ARRAY_TYPE));
+  empty.Merge(stats);
+  EXPECT_EQ(4u, empty.count(FIXED_ARRAY_TYPE));
+
+  stats.Clear();
+  EXPECT_EQ(0u, stats.count(FIXED_ARRAY_TYPE));
+  EXPECT_EQ(0u, stats.size(FIXED_ARRAY_TYPE));
+}
+
+TEST(SampledObjectStats, InstanceTypeName) {
+  EXPECT_STREQ("FIXED_ARRAY_TYPE",
+               SampledObjectStats::InstanceTypeName(FIXED_ARRAY_TYPE));
+  EXPECT_STREQ("JS_OBJECT_TYPE",
+               SampledObjectStats::InstanceTypeName(JS_OBJECT_TYPE));
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -137,5 +137,55 @@ TEST_F(SafepointTest, StopRunningThreads) {
   CHECK_EQ(safepoint_count, kRuns * kSafepoints);
 }
 
+class NamedRunningThread final : public v8::base::Thread {
+ public:
+  NamedRunningThread(Heap* heap, std::atomic<bool>* running,
+                     std::atomic<bool>* done)
+      : v8::base::Thread(base::Thread::Options("ThreadWithLocalHeap")),
+        heap_(heap),
+        running_(running),
+        done_(done) {}
+
+  void Run() override {
+    LocalHeap local_heap(heap_, ThreadKind::kBackground);
+    local_heap.set_thread_name("NamedRunningThread");
+    UnparkedScope unparked_scope(&local_heap);
+    running_->store(true);
+
+    while (!done_->load()) {
+      local_heap.Safepoint();
+    }
+  }
+
+  Heap* heap_;
+  std::atomic<bool>* running_;
+  std::atomic<bool>* done_;
+};
+
+TEST_F(SafepointTest, ReportsSlowestThread) {
+  Heap* heap = i_isolate()->heap();
+
+  {
+    SafepointScope scope(heap);
+    EXPECT_EQ(nullptr, heap->safepoint()->SlowestThreadForTesting());
+  }
+
+  std::atomic<bool> running(false);
+  std::atomic<bool> done(false);
+  NamedRunningThread thread(heap, &running, &done);
+  CHECK(thread.Start());
+  while (!running.load()) {
+  }
+
+  {
+    SafepointScope scope(heap);
+    EXPECT_STREQ("NamedRunningThread",
+                 heap->safepoint()->SlowestThreadForTesting());
+  }
+
+  done.store(true);
+  thread.Join();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -266,6 +266,24 @@ TEST(TypedSlotSet, Iterate) {
   EXPECT_EQ(added / 2, iterated);
 }
 
+TEST(TypedSlotSet, ConsecutiveDuplicatesAreFiltered) {
+  TypedSlotSet set(0);
+  set.Insert(CODE_TARGET_SLOT, 8);
+  set.Insert(CODE_TARGET_SLOT, 8);
+  set.Insert(FULL_EMBEDDED_OBJECT_SLOT, 8);
+  set.Insert(CODE_TARGET_SLOT, 16);
+  set.Insert(CODE_TARGET_SLOT, 16);
+  set.Insert(CODE_TARGET_SLOT, 8);
+  int iterated = 0;
+  set.Iterate(
+      [&iterated](SlotType type, Address addr) {
+        ++iterated;
+        return KEEP_SLOT;
+      },
+      TypedSlotSet::KEEP_EMPTY_CHUNKS);
+  EXPECT_EQ(4, iterated);
+}
+
 TEST(TypedSlotSet, ClearInvalidSlots) {
   TypedSlotSet set(0);
   const int kHostDelta = 100;
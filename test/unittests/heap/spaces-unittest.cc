@@ -6,6 +6,7 @@
 
 #include <memory>
 
+#include "src/base/bits.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/heap/heap-inl.h"
@@ -14,6 +15,7 @@
 #include "src/heap/large-spaces.h"
 #include "src/heap/memory-chunk.h"
 #include "src/heap/spaces-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 
 namespace v8 {
@@ -293,5 +295,100 @@ TEST_F(SpacesTest,
   }
 }
 
+// Tests that FreeListManyBitmap::CategoriesFrom only returns non-empty
+// categories that are at least as large as the requested one, and never the
+// last category.
+TEST_F(SpacesTest, FreeListManyBitmapCategoriesFrom) {
+  FreeListManyBitmap free_list;
+  EXPECT_EQ(0u, free_list.CategoriesFrom(kFirstCategory));
+
+  const uint32_t all_categories =
+      (uint32_t{1} << (free_list.last_category_ + 1)) - 1;
+  free_list.nonempty_categories_ = all_categories;
+  for (int cat = kFirstCategory; cat <= free_list.last_category_; cat++) {
+    uint32_t candidates =
+        free_list.CategoriesFrom(static_cast<FreeListCategoryType>(cat));
+    EXPECT_EQ(0u, candidates & (uint32_t{1} << free_list.last_category_));
+    if (cat < free_list.last_category_) {
+      EXPECT_EQ(static_cast<uint32_t>(cat),
+                base::bits::CountTrailingZeros32(candidates));
+    } else {
+      EXPECT_EQ(0u, candidates);
+    }
+  }
+
+  // Only categories 3 and 7 are non-empty.
+  free_list.nonempty_categories_ = (uint32_t{1} << 3) | (uint32_t{1} << 7);
+  EXPECT_EQ(3u, base::bits::CountTrailingZeros32(free_list.CategoriesFrom(0)));
+  EXPECT_EQ(3u, base::bits::CountTrailingZeros32(free_list.CategoriesFrom(3)));
+  EXPECT_EQ(7u, base::bits::CountTrailingZeros32(free_list.CategoriesFrom(4)));
+  EXPECT_EQ(0u, free_list.CategoriesFrom(8));
+  free_list.nonempty_categories_ = 0;
+}
+
+// Tests that the bitmap of FreeListManyBitmap follows the categories of a
+// real page as blocks are added, allocated and evicted.
+TEST_F(SpacesTest, FreeListManyBitmapTracksCategories) {
+  FlagScope<bool> freelist_bitmap(&FLAG_gc_freelist_bitmap, true);
+  Heap* heap = i_isolate()->heap();
+  std::unique_ptr<CompactionSpace> space(
+      new CompactionSpace(heap, OLD_SPACE, NOT_EXECUTABLE,
+                          CompactionSpaceKind::kCompactionSpaceForMarkCompact));
+  FreeListManyBitmap* free_list =
+      static_cast<FreeListManyBitmap*>(space->free_list());
+  EXPECT_EQ(0u, free_list->nonempty_categories_);
+
+  // Take a block from a new page and empty the free list of the page.
+  HeapObject object =
+      space->AllocateRawUnaligned(kMaxRegularHeapObjectSize).ToObjectChecked();
+  heap->CreateFillerObjectAt(object.address(), kMaxRegularHeapObjectSize,
+                             ClearRecordedSlots::kNo);
+  Page* page = Page::FromHeapObject(object);
+  space->FreeLinearAllocationArea();
+  free_list->EvictFreeListItems(page);
+  EXPECT_EQ(0u, free_list->nonempty_categories_);
+
+  // Give back a small and a large part of the block.
+  const size_t kSmall = 64;
+  const size_t kLarge = 8 * KB;
+  const Address small_start = object.address();
+  const Address large_start = small_start + kSmall;
+  const uint32_t small_bit =
+      uint32_t{1} << free_list->SelectFreeListCategoryType(kSmall);
+  const uint32_t large_bit =
+      uint32_t{1} << free_list->SelectFreeListCategoryType(kLarge);
+  ASSERT_NE(small_bit, large_bit);
+  heap->CreateFillerObjectAt(
+      large_start + kLarge,
+      static_cast<int>(kMaxRegularHeapObjectSize - kSmall - kLarge),
+      ClearRecordedSlots::kNo);
+  space->Free(small_start, kSmall, SpaceAccountingMode::kSpaceAccounted);
+  EXPECT_EQ(small_bit, free_list->nonempty_categories_);
+  space->Free(large_start, kLarge, SpaceAccountingMode::kSpaceAccounted);
+  EXPECT_EQ(small_bit | large_bit, free_list->nonempty_categories_);
+
+  // The GC takes the best fit, which drains the small category.
+  size_t node_size = 0;
+  FreeSpace node =
+      free_list->Allocate(kSmall, &node_size, AllocationOrigin::kGC);
+  EXPECT_EQ(small_start, node.address());
+  EXPECT_EQ(kSmall, node_size);
+  EXPECT_EQ(large_bit, free_list->nonempty_categories_);
+
+  // The mutator prefers a node that leaves a large allocation area.
+  space->Free(small_start, kSmall, SpaceAccountingMode::kSpaceAccounted);
+  EXPECT_EQ(small_bit | large_bit, free_list->nonempty_categories_);
+  node = free_list->Allocate(kSmall, &node_size, AllocationOrigin::kRuntime);
+  EXPECT_EQ(large_start, node.address());
+  EXPECT_EQ(kLarge, node_size);
+  EXPECT_EQ(small_bit, free_list->nonempty_categories_);
+
+  // Evicting the page clears the bits of all its categories.
+  space->Free(large_start, kLarge, SpaceAccountingMode::kSpaceAccounted);
+  EXPECT_EQ(small_bit | large_bit, free_list->nonempty_categories_);
+  free_list->EvictFreeListItems(page);
+  EXPECT_EQ(0u, free_list->nonempty_categories_);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -218,6 +218,68 @@ TEST_F(BytecodeRegisterOptimizerTest, RangeOfTemporariesMaterializedForInput) {
   CHECK_EQ(output()->at(1).output.index(), temp1.index());
 }
 
+TEST_F(BytecodeRegisterOptimizerTest, ImmutableContextSlotLoadReused) {
+  Initialize(1, 1);
+  Register context = Register::current_context();
+  Register temp = NewTemporary();
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kLdaImmutableCurrentContextSlot,
+                           ImplicitRegisterUse::kWriteAccumulator>();
+  optimizer()->RecordImmutableContextSlotLoad(context, 2, 0);
+  optimizer()->DoStar(temp);
+
+  // The value is still in the accumulator.
+  Register equivalent;
+  CHECK(optimizer()->FindImmutableContextSlotLoad(context, 2, 0, &equivalent));
+  CHECK_EQ(Register::virtual_accumulator().index(), equivalent.index());
+
+  // Once the accumulator is clobbered, the temporary still holds the value.
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kLdaSmi,
+                           ImplicitRegisterUse::kWriteAccumulator>();
+  CHECK(optimizer()->FindImmutableContextSlotLoad(context, 2, 0, &equivalent));
+  CHECK_EQ(temp.index(), equivalent.index());
+  CHECK(!optimizer()->FindImmutableContextSlotLoad(context, 3, 0, &equivalent));
+  CHECK(!optimizer()->FindImmutableContextSlotLoad(context, 2, 1, &equivalent));
+
+  // Overwriting the temporary loses the value.
+  optimizer()->DoStar(temp);
+  CHECK(!optimizer()->FindImmutableContextSlotLoad(context, 2, 0, &equivalent));
+}
+
+TEST_F(BytecodeRegisterOptimizerTest, ImmutableContextSlotLoadInvalidated) {
+  Initialize(1, 1);
+  Register context = Register::current_context();
+  Register temp = NewTemporary();
+  Register equivalent;
+
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kLdaImmutableCurrentContextSlot,
+                           ImplicitRegisterUse::kWriteAccumulator>();
+  optimizer()->RecordImmutableContextSlotLoad(context, 2, 0);
+  optimizer()->DoStar(temp);
+  optimizer()->InvalidateContextSlotLoads(2);
+  CHECK(!optimizer()->FindImmutableContextSlotLoad(context, 2, 0, &equivalent));
+
+  // Changing the current context forgets the load.
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kLdaImmutableCurrentContextSlot,
+                           ImplicitRegisterUse::kWriteAccumulator>();
+  optimizer()->RecordImmutableContextSlotLoad(context, 2, 0);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kPopContext, ImplicitRegisterUse::kNone>();
+  CHECK(!optimizer()->FindImmutableContextSlotLoad(context, 2, 0, &equivalent));
+
+  // So do basic block boundaries.
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kLdaImmutableCurrentContextSlot,
+                           ImplicitRegisterUse::kWriteAccumulator>();
+  optimizer()->RecordImmutableContextSlotLoad(context, 2, 0);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kJump, ImplicitRegisterUse::kNone>();
+  CHECK(!optimizer()->FindImmutableContextSlotLoad(context, 2, 0, &equivalent));
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
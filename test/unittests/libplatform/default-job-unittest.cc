@@ -240,6 +240,62 @@ TEST(DefaultJobTest, FinishBeforeJoin) {
   EXPECT_EQ(0U, job_raw->max_concurrency);
 }
 
+// Verify that work added with NotifyConcurrencyIncrease() while workers are
+// returning because they ran out of work is still picked up by a worker.
+TEST(DefaultJobTest, NotifyConcurrencyIncreaseWhileWorkersReturn) {
+  static constexpr size_t kMaxTask = 4;
+  static constexpr size_t kNumItems = 10000;
+  DefaultPlatform platform(kMaxTask);
+
+  // This Job processes one item per Run() call, and wants one worker per
+  // pending item.
+  class JobTest : public JobTask {
+   public:
+    ~JobTest() override = default;
+
+    void Run(JobDelegate* delegate) override {
+      size_t pending = pending_items.load(std::memory_order_relaxed);
+      while (pending > 0 && !pending_items.compare_exchange_weak(
+                                pending, pending - 1,
+                                std::memory_order_relaxed)) {
+      }
+      if (pending == 0) return;
+      base::MutexGuard guard(&mutex);
+      processed_items++;
+      item_processed.NotifyOne();
+    }
+
+    size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+      return pending_items.load(std::memory_order_relaxed);
+    }
+
+    std::atomic_size_t pending_items{0};
+    base::Mutex mutex;
+    base::ConditionVariable item_processed;
+    size_t processed_items = 0;
+  };
+
+  auto job = std::make_unique<JobTest>();
+  JobTest* job_raw = job.get();
+  auto state = std::make_shared<DefaultJobState>(
+      &platform, std::move(job), TaskPriority::kUserVisible, kMaxTask);
+
+  for (size_t i = 0; i < kNumItems; ++i) {
+    job_raw->pending_items.fetch_add(1, std::memory_order_relaxed);
+    state->NotifyConcurrencyIncrease();
+  }
+
+  // Without Join(), all items must be processed by the workers.
+  {
+    base::MutexGuard guard(&job_raw->mutex);
+    while (job_raw->processed_items < kNumItems) {
+      job_raw->item_processed.Wait(&job_raw->mutex);
+    }
+  }
+  state->Join();
+  EXPECT_EQ(kNumItems, job_raw->processed_items);
+}
+
 // Verify that destroying a DefaultJobHandle triggers a DCHECK if neither Join()
 // or Cancel() was called.
 TEST(DefaultJobTest, LeakHandle) {
@@ -114,6 +114,63 @@ TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskOrderMultipleWorkers) {
   ASSERT_EQ(1, std::count(order.begin(), order.end(), 5));
 }
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskNumaPinned) {
+  // Pinning is a no-op on single-node machines, but the workers have to run
+  // tasks either way.
+  DefaultWorkerThreadsTaskRunner runner(4, RealTime, NumaPinning::kEnabled);
+
+  std::atomic_int count{0};
+  base::Semaphore semaphore(0);
+  for (int i = 0; i < 8; ++i) {
+    runner.PostTask(std::make_unique<TestTask>([&] {
+      if (++count == 8) semaphore.Signal();
+    }));
+  }
+
+  semaphore.Wait();
+  runner.Terminate();
+  ASSERT_EQ(8, count);
+}
+
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskPriorityOrder) {
+  DefaultWorkerThreadsTaskRunner runner(1, RealTime);
+
+  std::vector<int> order;
+  base::Semaphore started(0);
+  base::Semaphore blocked(0);
+  base::Semaphore done(0);
+
+  // Keep the only worker busy while the other tasks are posted.
+  runner.PostTask(std::make_unique<TestTask>([&] {
+    started.Signal();
+    blocked.Wait();
+  }));
+  started.Wait();
+
+  runner.PostTask(TaskPriority::kBestEffort,
+                  std::make_unique<TestTask>([&] { order.push_back(1); }));
+  runner.PostTask(TaskPriority::kUserVisible,
+                  std::make_unique<TestTask>([&] { order.push_back(2); }));
+  runner.PostTask(TaskPriority::kUserBlocking,
+                  std::make_unique<TestTask>([&] { order.push_back(3); }));
+  runner.PostTask(TaskPriority::kBestEffort, std::make_unique<TestTask>([&] {
+                    order.push_back(4);
+                    done.Signal();
+                  }));
+  runner.PostTask(TaskPriority::kUserBlocking,
+                  std::make_unique<TestTask>([&] { order.push_back(5); }));
+  blocked.Signal();
+  done.Wait();
+
+  runner.Terminate();
+  ASSERT_EQ(5UL, order.size());
+  ASSERT_EQ(3, order[0]);
+  ASSERT_EQ(5, order[1]);
+  ASSERT_EQ(2, order[2]);
+  ASSERT_EQ(1, order[3]);
+  ASSERT_EQ(4, order[4]);
+}
+
 class FakeClock {
  public:
   static double time() { return time_.load(); }
@@ -222,6 +279,32 @@ TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostDelayedTaskOrder2) {
   ASSERT_EQ(1, order[2]);
 }
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostDelayedTasksMultipleWorkers) {
+  FakeClock::set_time(0.0);
+  DefaultWorkerThreadsTaskRunner runner(4, FakeClock::time);
+
+  static constexpr int kNumTasks = 20;
+  std::atomic_int count{0};
+  base::Semaphore semaphore(0);
+
+  for (int i = 0; i < kNumTasks; ++i) {
+    runner.PostDelayedTask(std::make_unique<TestTask>([&] {
+                             count++;
+                             semaphore.Signal();
+                           }),
+                           10 + i);
+  }
+  FakeClock::set_time_and_wake_up_runner(5, &runner);
+  ASSERT_EQ(0, count);
+
+  // All tasks that became due at once are run, by whichever worker wakes up.
+  FakeClock::set_time_and_wake_up_runner(100, &runner);
+  for (int i = 0; i < kNumTasks; ++i) semaphore.Wait();
+
+  runner.Terminate();
+  ASSERT_EQ(kNumTasks, count);
+}
+
 TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostAfterTerminate) {
   FakeClock::set_time(0.0);
   DefaultWorkerThreadsTaskRunner runner(1, FakeClock::time);
@@ -10,6 +10,7 @@
 #include "src/flags/flags.h"
 #include "src/handles/handles-inl.h"
 #include "src/logging/counters.h"
+#include "src/logging/metrics.h"
 #include "src/objects/objects-inl.h"
 #include "src/tracing/tracing-category-observer.h"
 #include "test/unittests/test-utils.h"
@@ -118,6 +119,16 @@ class V8_NODISCARD NativeTimeScope {
   }
 };
 
+class RuntimeCallStatsSampleRecorder : public v8::metrics::Recorder {
+ public:
+  void AddThreadSafeEvent(
+      const v8::metrics::RuntimeCallStatsSample& event) override {
+    events_.push_back(event);
+  }
+
+  std::vector<v8::metrics::RuntimeCallStatsSample> events_;
+};
+
 }  // namespace
 
 TEST_F(RuntimeCallStatsTest, RuntimeCallTimer) {
@@ -643,5 +654,46 @@ TEST_F(RuntimeCallStatsTest, GarbageCollection) {
       v8::Isolate::kFullGarbageCollection);
 }
 
+TEST_F(RuntimeCallStatsTest, Sampler) {
+  TracingFlags::runtime_stats.store(
+      v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING,
+      std::memory_order_relaxed);
+  auto recorder = std::make_shared<RuntimeCallStatsSampleRecorder>();
+  isolate()->metrics_recorder()->SetEmbedderRecorder(isolate(), recorder);
+  RuntimeCallStatsSampler sampler(isolate(),
+                                  base::TimeDelta::FromMilliseconds(1),
+                                  base::TimeDelta::FromSeconds(10));
+  sampler.SampleForTesting();
+  {
+    RuntimeCallTimerScope scope(stats(), counter_id());
+    Sleep(100);
+    sampler.SampleForTesting();
+    {
+      RuntimeCallTimerScope inner_scope(stats(), counter_id2());
+      sampler.SampleForTesting();
+    }
+    sampler.SampleForTesting();
+  }
+  // Sampling does not time the scopes.
+  EXPECT_EQ(0, counter()->count());
+  EXPECT_EQ(0, counter()->time().InMicroseconds());
+
+  sampler.ReportForTesting();
+  ASSERT_EQ(1u, recorder->events_.size());
+  const v8::metrics::RuntimeCallStatsSample& event = recorder->events_[0];
+  EXPECT_EQ(1000, event.sampling_interval_in_us);
+  EXPECT_EQ(4, event.main_thread_sample_count);
+  ASSERT_EQ(2u, event.entries.size());
+  EXPECT_STREQ(counter()->name(), event.entries[0].name);
+  EXPECT_EQ(2, event.entries[0].main_thread_samples);
+  EXPECT_EQ(0, event.entries[0].background_samples);
+  EXPECT_STREQ(counter2()->name(), event.entries[1].name);
+  EXPECT_EQ(1, event.entries[1].main_thread_samples);
+
+  // The samples are reset after each report, and empty reports are skipped.
+  sampler.ReportForTesting();
+  EXPECT_EQ(1u, recorder->events_.size());
+}
+
 }  // namespace internal
 }  // namespace v8
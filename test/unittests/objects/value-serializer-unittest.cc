@@ -782,6 +782,73 @@ TEST_F(ValueSerializerTest, InvalidDecodeObjectWithInvalidKeyType) {
       {0xFF, 0x09, 0x6F, 0x61, 0x00, 0x40, 0x00, 0x00, 0x7B, 0x01});
 }
 
+TEST_F(ValueSerializerTest, RoundTripObjectsWithShape) {
+  FlagScope<bool> object_shapes(&FLAG_value_serializer_object_shapes, true);
+  Local<Value> value = RoundTripTest(
+      "[{ alpha: 1, beta: 'x' }, { alpha: 2, beta: 'y' },"
+      " { alpha: 3.5, beta: {} }]");
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result.length === 3");
+  ExpectScriptTrue("result[0].alpha === 1 && result[0].beta === 'x'");
+  ExpectScriptTrue("result[1].alpha === 2 && result[1].beta === 'y'");
+  ExpectScriptTrue("result[2].alpha === 3.5");
+  ExpectScriptTrue(
+      "Object.getPrototypeOf(result[2].beta) === Object.prototype");
+  ExpectScriptTrue("Object.keys(result[2]).toString() === 'alpha,beta'");
+
+  // The keys are only written once.
+  std::vector<uint8_t> encoded =
+      EncodeTest("[{ alpha: 1 }, { alpha: 2 }, { alpha: 3 }]");
+  const char kKey[] = "alpha";
+  auto first = std::search(encoded.begin(), encoded.end(), std::begin(kKey),
+                           std::end(kKey) - 1);
+  ASSERT_NE(encoded.end(), first);
+  EXPECT_EQ(encoded.end(), std::search(first + 1, encoded.end(),
+                                       std::begin(kKey), std::end(kKey) - 1));
+
+  // Objects with a shape can still be referenced from their own values.
+  value = RoundTripTest("var y = { self: null }; y.self = y; [y, y];");
+  ExpectScriptTrue("result[0] === result[0].self && result[0] === result[1]");
+
+  // Properties deleted while writing earlier values are skipped.
+  value = RoundTripTest(
+      "var o = { a: { get x() { delete o.b; return 1; } }, b: 2, c: 3 }; o");
+  ExpectScriptTrue("result.a.x === 1");
+  ExpectScriptTrue("Object.keys(result).toString() === 'a,c'");
+}
+
+TEST_F(ValueSerializerTest, DecodeObjectsWithShape) {
+  // [{a: 1}, {a: 2}], sharing the shape of the first object.
+  Local<Value> value =
+      DecodeTest({0xFF, 0x0E, 0x41, 0x02, 0x4F, 0x01, 0x22, 0x01, 0x61, 0x49,
+                  0x02, 0x68, 0x00, 0x49, 0x04, 0x24, 0x00, 0x02});
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result.length === 2");
+  ExpectScriptTrue("result[0].a === 1 && result[1].a === 2");
+
+  // A hole means that the property is absent.
+  value = DecodeTest({0xFF, 0x0E, 0x4F, 0x02, 0x22, 0x01, 0x61, 0x22, 0x01,
+                      0x62, 0x2D, 0x49, 0x02});
+  ASSERT_TRUE(value->IsObject());
+  ExpectScriptTrue("Object.keys(result).toString() === 'b'");
+  ExpectScriptTrue("result.b === 1");
+}
+
+TEST_F(ValueSerializerTest, InvalidDecodeObjectsWithShape) {
+  // Unknown shape ID.
+  InvalidDecodeTest({0xFF, 0x0E, 0x68, 0x00});
+  // Keys must be strings.
+  InvalidDecodeTest({0xFF, 0x0E, 0x4F, 0x01, 0x49, 0x02, 0x49, 0x02});
+  // Keys must be unique.
+  InvalidDecodeTest({0xFF, 0x0E, 0x4F, 0x02, 0x22, 0x01, 0x61, 0x22, 0x01,
+                     0x61, 0x49, 0x02, 0x49, 0x02});
+  // Missing values.
+  InvalidDecodeTest({0xFF, 0x0E, 0x4F, 0x01, 0x22, 0x01, 0x61});
+  // The tags did not exist before version 14.
+  InvalidDecodeTest({0xFF, 0x0D, 0x4F, 0x01, 0x22, 0x01, 0x61, 0x49, 0x02});
+  InvalidDecodeTest({0xFF, 0x0D, 0x68, 0x00});
+}
+
 TEST_F(ValueSerializerTest, RoundTripOnlyOwnEnumerableStringKeys) {
   // Only "own" properties should be serialized, not ones on the prototype.
   Local<Value> value = RoundTripTest("var x = {}; x.__proto__ = {a: 4}; x;");
@@ -2461,6 +2528,118 @@ TEST_F(ValueSerializerTestWithHostObject, DecodeSimpleHostObject) {
       "Object.getPrototypeOf(result) === ExampleHostObject.prototype");
 }
 
+class ValueSerializerTestWithExternalStrings : public ValueSerializerTest {
+ protected:
+  ValueSerializerTestWithExternalStrings() : serializer_delegate_(this) {}
+
+  class TestResource : public String::ExternalOneByteStringResource {
+   public:
+    explicit TestResource(const char* data)
+        : data_(data), length_(strlen(data)) {}
+    const char* data() const override { return data_; }
+    size_t length() const override { return length_; }
+
+   private:
+    const char* data_;
+    size_t length_;
+  };
+
+  Local<String> NewExternalString(const char* data) {
+    return String::NewExternalOneByte(isolate(), new TestResource(data))
+        .ToLocalChecked();
+  }
+
+// GMock doesn't use the "override" keyword.
+#if __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Winconsistent-missing-override"
+#endif
+
+  class SerializerDelegate : public ValueSerializer::Delegate {
+   public:
+    explicit SerializerDelegate(ValueSerializerTestWithExternalStrings* test)
+        : test_(test) {}
+    MOCK_METHOD(Maybe<uint32_t>, GetExternalStringTransferId,
+                (Isolate*, Local<String> string), (override));
+    void ThrowDataCloneError(Local<String> message) override {
+      test_->isolate()->ThrowException(Exception::Error(message));
+    }
+
+   private:
+    ValueSerializerTestWithExternalStrings* test_;
+  };
+
+  class DeserializerDelegate : public ValueDeserializer::Delegate {
+   public:
+    MOCK_METHOD(MaybeLocal<String>, GetExternalStringFromId,
+                (Isolate*, uint32_t transfer_id), (override));
+  };
+
+#if __clang__
+#pragma clang diagnostic pop
+#endif
+
+  ValueSerializer::Delegate* GetSerializerDelegate() override {
+    return &serializer_delegate_;
+  }
+  ValueDeserializer::Delegate* GetDeserializerDelegate() override {
+    return &deserializer_delegate_;
+  }
+
+  SerializerDelegate serializer_delegate_;
+  DeserializerDelegate deserializer_delegate_;
+};
+
+TEST_F(ValueSerializerTestWithExternalStrings, TransferExternalString) {
+  static const char kData[] = "a fairly long external string";
+  Local<String> string = NewExternalString(kData);
+  EXPECT_CALL(serializer_delegate_,
+              GetExternalStringTransferId(isolate(), string))
+      .WillOnce(Return(Just(42u)));
+  std::vector<uint8_t> encoded = EncodeTest(string);
+  // Only the tag and the transfer ID are written, not the contents.
+  EXPECT_EQ(encoded.end(),
+            std::search(encoded.begin(), encoded.end(), std::begin(kData),
+                        std::end(kData) - 1));
+
+  EXPECT_CALL(deserializer_delegate_, GetExternalStringFromId(isolate(), 42u))
+      .WillOnce(Return(string));
+  Local<Value> value = DecodeTest(encoded);
+  ASSERT_TRUE(value->IsString());
+  EXPECT_TRUE(value->StrictEquals(string));
+  EXPECT_TRUE(value.As<String>()->IsExternalOneByte());
+}
+
+TEST_F(ValueSerializerTestWithExternalStrings, DeclinedTransferCopies) {
+  // If the delegate declines, the contents are serialized as usual.
+  EXPECT_CALL(serializer_delegate_, GetExternalStringTransferId(isolate(), _))
+      .WillOnce(Return(Nothing<uint32_t>()));
+  EXPECT_CALL(deserializer_delegate_, GetExternalStringFromId(_, _)).Times(0);
+  Local<Value> value = RoundTripTest(NewExternalString("abc"));
+  ASSERT_TRUE(value->IsString());
+  EXPECT_EQ("abc", Utf8Value(value));
+}
+
+TEST_F(ValueSerializerTestWithExternalStrings, InternalStringNotOffered) {
+  EXPECT_CALL(serializer_delegate_, GetExternalStringTransferId(_, _))
+      .Times(0);
+  Local<Value> value = RoundTripTest("'abc'");
+  ASSERT_TRUE(value->IsString());
+  EXPECT_EQ("abc", Utf8Value(value));
+}
+
+TEST_F(ValueSerializerTestWithExternalStrings, DecodeUnknownTransferId) {
+  EXPECT_CALL(deserializer_delegate_, GetExternalStringFromId(isolate(), 7u))
+      .WillOnce(Return(MaybeLocal<String>()));
+  InvalidDecodeTest({0xFF, 0x0F, 0x58, 0x07});
+}
+
+TEST_F(ValueSerializerTestWithExternalStrings, DecodeTransferBeforeVersion15) {
+  // The tag did not exist before version 15.
+  EXPECT_CALL(deserializer_delegate_, GetExternalStringFromId(_, _)).Times(0);
+  InvalidDecodeTest({0xFF, 0x0E, 0x58, 0x2A});
+}
+
 class ValueSerializerTestWithHostArrayBufferView
     : public ValueSerializerTestWithHostObject {
  protected:
@@ -211,6 +211,35 @@ TEST_F(CancelableTaskManagerTest, RemoveAfterCancelAndWait) {
   EXPECT_EQ(1u, result1);
 }
 
+TEST_F(CancelableTaskManagerTest, ReusedSlotGetsNewId) {
+  ResultType result1{0};
+  ResultType result2{0};
+  ResultType result3{0};
+  SequentialRunner runner1(NewTask(&result1));
+  CancelableTaskManager::Id id1 = runner1.task_id();
+  runner1.Run();
+  EXPECT_EQ(id1, result1);
+
+  // The second task reuses the storage of the finished first one, but must
+  // not be reachable through the id of the first task.
+  SequentialRunner runner2(NewTask(&result2, TestTask::kCheckNotRun));
+  CancelableTaskManager::Id id2 = runner2.task_id();
+  EXPECT_NE(id1, id2);
+  EXPECT_EQ(TryAbortResult::kTaskRemoved, manager()->TryAbort(id1));
+  EXPECT_EQ(TryAbortResult::kTaskAborted, manager()->TryAbort(id2));
+  EXPECT_EQ(TryAbortResult::kTaskRemoved, manager()->TryAbort(id2));
+  runner2.Run();
+  EXPECT_EQ(0u, result2);
+
+  SequentialRunner runner3(NewTask(&result3));
+  CancelableTaskManager::Id id3 = runner3.task_id();
+  EXPECT_NE(id1, id3);
+  EXPECT_NE(id2, id3);
+  runner3.Run();
+  EXPECT_EQ(id3, result3);
+  CancelAndWait();
+}
+
 TEST_F(CancelableTaskManagerTest, RemoveUnmanagedId) {
   EXPECT_EQ(TryAbortResult::kTaskRemoved, manager()->TryAbort(1));
   EXPECT_EQ(TryAbortResult::kTaskRemoved, manager()->TryAbort(2));
@@ -0,0 +1,111 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/utils/memcopy.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr size_t kMaxSize = 160;
+constexpr size_t kMaxMisalignment = 8;
+constexpr size_t kBufferSize = kMaxSize + 2 * kMaxMisalignment;
+constexpr uint8_t kUntouched = 0xEE;
+
+// Fills |buffer| with a pattern in which no two neighbouring bytes are equal,
+// so that copies from the wrong offset are detected.
+void FillPattern(uint8_t* buffer, size_t size, uint8_t seed) {
+  for (size_t i = 0; i < size; i++) {
+    buffer[i] = static_cast<uint8_t>(seed + i * 7 + 1);
+  }
+}
+
+void CheckCopyBlockBytes(size_t size, size_t src_misalignment,
+                         size_t dst_misalignment) {
+  alignas(16) uint8_t src[kBufferSize];
+  alignas(16) uint8_t dst[kBufferSize];
+  FillPattern(src, kBufferSize, static_cast<uint8_t>(size));
+  memset(dst, kUntouched, kBufferSize);
+
+  uint8_t* from = src + src_misalignment;
+  uint8_t* to = dst + kMaxMisalignment + dst_misalignment;
+  CopyBlockBytes(reinterpret_cast<Address>(to), reinterpret_cast<Address>(from),
+                 size);
+
+  for (size_t i = 0; i < size; i++) {
+    ASSERT_EQ(from[i], to[i]) << "size " << size << ", src misalignment "
+                              << src_misalignment << ", dst misalignment "
+                              << dst_misalignment << ", index " << i;
+  }
+  // Nothing outside of the destination block must be written.
+  for (uint8_t* p = dst; p < to; p++) {
+    ASSERT_EQ(kUntouched, *p) << "size " << size << ", before the block";
+  }
+  for (uint8_t* p = to + size; p < dst + kBufferSize; p++) {
+    ASSERT_EQ(kUntouched, *p) << "size " << size << ", after the block";
+  }
+}
+
+}  // namespace
+
+// Covers every size class of CopyBlockBytes (0, 1-3, 4-7, 8-16, 17-32, 33-64,
+// and larger than 64) including the sizes on both sides of each boundary.
+TEST(CopyBlockBytesTest, AllSizesAligned) {
+  for (size_t size = 0; size <= kMaxSize; size++) {
+    CheckCopyBlockBytes(size, 0, 0);
+  }
+}
+
+TEST(CopyBlockBytesTest, AllSizesUnaligned) {
+  for (size_t size = 0; size <= kMaxSize; size++) {
+    for (size_t src_misalignment = 0; src_misalignment < kMaxMisalignment;
+         src_misalignment++) {
+      for (size_t dst_misalignment = 0; dst_misalignment < kMaxMisalignment;
+           dst_misalignment++) {
+        CheckCopyBlockBytes(size, src_misalignment, dst_misalignment);
+      }
+    }
+  }
+}
+
+// CopyHeadAndTail reads both halves before writing, so it must also be
+// correct when source and destination overlap in either direction.
+template <size_t N>
+void CheckCopyHeadAndTailOverlapping() {
+  for (size_t size = N; size <= 2 * N; size++) {
+    for (size_t distance = 1; distance <= size; distance++) {
+      for (bool forward : {true, false}) {
+        uint8_t buffer[4 * N + 1];
+        FillPattern(buffer, sizeof(buffer), static_cast<uint8_t>(distance));
+        uint8_t expected[4 * N + 1];
+        memcpy(expected, buffer, sizeof(buffer));
+        uint8_t* src = forward ? buffer : buffer + distance;
+        uint8_t* dst = forward ? buffer + distance : buffer;
+        memmove(expected + (dst - buffer), expected + (src - buffer), size);
+
+        CopyHeadAndTail<N>(reinterpret_cast<Address>(dst),
+                           reinterpret_cast<Address>(src), size);
+
+        for (size_t i = 0; i < sizeof(buffer); i++) {
+          ASSERT_EQ(expected[i], buffer[i])
+              << "N " << N << ", size " << size << ", distance " << distance
+              << (forward ? ", forward" : ", backward") << ", index " << i;
+        }
+      }
+    }
+  }
+}
+
+TEST(CopyBlockBytesTest, CopyHeadAndTailOverlapping) {
+  CheckCopyHeadAndTailOverlapping<4>();
+  CheckCopyHeadAndTailOverlapping<8>();
+  CheckCopyHeadAndTailOverlapping<16>();
+  CheckCopyHeadAndTailOverlapping<32>();
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -4,7 +4,10 @@
 
 #include "src/zone/zone.h"
 
+#include "src/flags/flags.h"
 #include "src/zone/accounting-allocator.h"
+#include "src/zone/zone-segment.h"
+#include "test/common/flag-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace v8 {
@@ -22,5 +25,72 @@ TEST(Zone, 8ByteAlignment) {
   }
 }
 
+TEST(Zone, SegmentPool) {
+  FlagScope<size_t> pool_size(&FLAG_zone_segment_pool_size, 64);
+  AccountingAllocator allocator;
+  const size_t kSize = 32 * KB;
+
+  Segment* first = allocator.AllocateSegment(kSize, false);
+  ASSERT_NE(nullptr, first);
+  allocator.ReturnSegment(first, false);
+  // Pooled segments do not count as zone memory in use.
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+
+  Segment* second = allocator.AllocateSegment(kSize, false);
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(kSize, second->total_size());
+  EXPECT_EQ(kSize, allocator.GetCurrentMemoryUsage());
+
+  EXPECT_EQ(1u, allocator.GetSegmentPoolHits());
+  EXPECT_EQ(1u, allocator.GetSegmentPoolMisses());
+
+  // Segments larger than the largest size class are never pooled.
+  Segment* large = allocator.AllocateSegment(kSize + 1, false);
+  ASSERT_NE(nullptr, large);
+  EXPECT_EQ(kSize + 1, large->total_size());
+  allocator.ReturnSegment(large, false);
+  allocator.ReturnSegment(second, false);
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(1u, allocator.GetSegmentPoolMisses());
+  allocator.ReleasePooledSegments();
+}
+
+TEST(Zone, SegmentPoolSizeClasses) {
+  FlagScope<size_t> pool_size(&FLAG_zone_segment_pool_size, 64);
+  AccountingAllocator allocator;
+
+  // Requests are rounded up to the next size class.
+  Segment* small = allocator.AllocateSegment(8 * KB, false);
+  Segment* medium = allocator.AllocateSegment(10 * KB, false);
+  ASSERT_NE(nullptr, small);
+  ASSERT_NE(nullptr, medium);
+  EXPECT_EQ(8 * KB, small->total_size());
+  EXPECT_EQ(16 * KB, medium->total_size());
+  allocator.ReturnSegment(small, false);
+  allocator.ReturnSegment(medium, false);
+
+  // Each size class hands out its own segments.
+  EXPECT_EQ(medium, allocator.AllocateSegment(12 * KB, false));
+  EXPECT_EQ(small, allocator.AllocateSegment(4 * KB, false));
+  EXPECT_EQ(2u, allocator.GetSegmentPoolHits());
+  allocator.ReturnSegment(small, false);
+  allocator.ReturnSegment(medium, false);
+
+  // The pool is bounded by the flag in bytes: with 8 and 16 KB pooled, only
+  // one more 32 KB segment fits into 64 KB.
+  Segment* first = allocator.AllocateSegment(32 * KB, false);
+  Segment* second = allocator.AllocateSegment(32 * KB, false);
+  allocator.ReturnSegment(first, false);
+  allocator.ReturnSegment(second, false);
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(first, allocator.AllocateSegment(32 * KB, false));
+  const size_t misses = allocator.GetSegmentPoolMisses();
+  Segment* third = allocator.AllocateSegment(32 * KB, false);
+  EXPECT_EQ(misses + 1, allocator.GetSegmentPoolMisses());
+  allocator.ReturnSegment(first, false);
+  allocator.ReturnSegment(third, false);
+  allocator.ReleasePooledSegments();
+}
+
 }  // namespace internal
 }  // namespace v8